@@ -0,0 +1,337 @@
+/* © 2008 David Given.
+ * WordGrinder is licensed under the MIT open source license. See the COPYING
+ * file in this distribution for the full text.
+ */
+
+#ifndef GLOBALS_H
+#define GLOBALS_H
+
+#if !defined _WIN32
+#if !defined _XOPEN_SOURCE
+#define _XOPEN_SOURCE
+#endif
+
+#if !defined _XOPEN_SOURCE_EXTENDED
+#define _XOPEN_SOURCE_EXTENDED
+#endif
+
+#if !defined _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <assert.h>
+#include <errno.h>
+#include <wctype.h>
+#include <string>
+#include <string_view>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+#include "wgcore.h"
+
+/* --- Platform detection ------------------------------------------------ */
+
+#if defined(__APPLE__) && defined(__MACH__)
+#define OSX
+#endif
+
+#if defined _WIN32
+#undef WIN32
+#define WIN32
+#endif
+
+extern int main(int argc, char* argv[]);
+
+/* --- Lua --------------------------------------------------------------- */
+
+#include "lua.h"
+#include "lauxlib.h"
+
+#if defined WINSHIM
+#include "winshim.h"
+#endif
+
+extern lua_State* L;
+
+typedef struct
+{
+    const char* name;
+    int value;
+} luaL_Constant;
+
+extern void luaL_setconstants(
+    lua_State* L, const luaL_Constant* array, int len);
+
+typedef struct
+{
+    std::string data;
+    const char* name;
+} FileDescriptor;
+
+extern void* scriptalloc(void* ud, void* ptr, size_t osize, size_t nsize);
+extern void allocator_init(void);
+extern void profiler_init(void);
+extern void heapreport_init(void);
+extern void tracestartup(std::string_view name);
+
+/* Records a span for the trace (see profiler.cc) covering its lifetime. */
+extern std::atomic<bool> tracing;
+extern uint64_t tracenow();
+extern void traceemit(std::string_view name, uint64_t start);
+
+class TraceSpan
+{
+public:
+    TraceSpan(const char* name):
+        _name(name),
+        _active(tracing.load(std::memory_order_relaxed)),
+        _start(_active ? tracenow() : 0)
+    {
+    }
+
+    ~TraceSpan()
+    {
+        if (_active)
+            traceemit(_name, _start);
+    }
+
+private:
+    const char* _name;
+    bool _active;
+    uint64_t _start;
+};
+extern void workers_init(void);
+extern void workers_afterfork(void);
+
+extern void server_init(void);
+extern int submitjob(const char* path, int argc, char* const* argv);
+extern int attachsession(const char* path);
+extern int listenonsocket(const char* path);
+extern bool issocketlive(const char* path);
+extern bool ispeerowner(int conn);
+extern bool receiverequest(
+    int conn, std::vector<std::string>& strings, int* fds);
+extern void sendstatus(int conn, int32_t status);
+
+extern void script_init(void);
+extern void script_load(const char* filename);
+extern void script_load_from_table(const FileDescriptor* table);
+extern void script_register_modules(const FileDescriptor* table);
+extern void script_run(const char* argv[]);
+
+#if !defined LUA_VERSION_NUM || LUA_VERSION_NUM == 501
+extern void luaL_setfuncs(lua_State* L, const luaL_Reg* l, int nup);
+#define lua_pushglobaltable(L) lua_pushvalue(L, LUA_GLOBALSINDEX)
+#endif
+
+extern void bit32_init(lua_State* L);
+
+#define forceinteger(L, offset) (int)lua_tonumber(L, offset)
+#define forcedouble(L, offset) (double)lua_tonumber(L, offset)
+
+/* --- Screen management ------------------------------------------------- */
+
+extern void screen_init(const char* argv[]);
+extern void screen_deinit(void);
+extern void dpy_writeunichar(int x, int y, uni_t c);
+extern void decode_mouse_event(uni_t key, int* x, int* y, bool* p);
+extern uni_t encode_mouse_event(int x, int y, bool p);
+
+/* --- Word management --------------------------------------------------- */
+
+/* WordMetrics, StyleRuns and computewordmetrics() are in wgcore.h. */
+
+extern void word_init(void);
+extern const WordMetrics& getwordmetrics(const char* s, size_t size);
+
+/* --- Paragraph storage ------------------------------------------------ */
+
+extern bool packparagraphs;
+extern void paragraph_init(void);
+extern void pushpackedwords(lua_State* L, const char* text, size_t len);
+extern const char* getpackedwords(lua_State* L, int index, size_t* len);
+extern void foreachparagraphword(lua_State* L, int index,
+    const std::function<void(const char*, size_t)>& cb);
+
+/* --- Regular expressions ----------------------------------------------- */
+
+struct Regex
+{
+    struct Instruction
+    {
+        int op;
+        int x;
+        int y;
+    };
+
+    typedef std::vector<std::pair<uni_t, uni_t>> Class;
+
+    std::vector<Instruction> program;
+    std::vector<Class> classes;
+};
+
+extern bool compileregex(
+    Regex& regex, std::string_view pattern, std::string& error);
+extern bool searchregex(const Regex& regex,
+    std::string_view text,
+    size_t from,
+    size_t* start,
+    size_t* end);
+
+/* --- Dumpfile management ----------------------------------------------- */
+
+extern void dumpfile_init(void);
+
+/* --- Spellchecker dictionaries ----------------------------------------- */
+
+extern void dictionary_init(void);
+
+/* --- Sequence comparison ----------------------------------------------- */
+
+extern void diff_init(void);
+
+/* --- Importers --------------------------------------------------------- */
+
+/* Accumulates styled words into a paragraph (see importer.cc). */
+struct ParagraphBuilder
+{
+    std::string arena;        /* the paragraph's words, back to back */
+    std::vector<size_t> ends; /* where each finished word ends in arena */
+    bool pending = false;     /* the current word exists, even if empty */
+    int oldattr = 0;
+    int attr = 0;
+};
+
+extern void importer_init(void);
+extern void importreset(ParagraphBuilder& pb);
+extern void importtext(ParagraphBuilder& pb, const char* s, size_t len);
+extern void importflushword(ParagraphBuilder& pb, bool force);
+extern bool importparagraph(lua_State* L, ParagraphBuilder& pb);
+
+/* --- Exporters --------------------------------------------------------- */
+
+extern void export_init(void);
+
+/* --- HTML -------------------------------------------------------------- */
+
+extern void html_init(void);
+
+/* --- XML --------------------------------------------------------------- */
+
+extern void xml_init(void);
+
+/* --- Zipfile management ------------------------------------------------ */
+
+extern void zip_init(void);
+
+struct ZipReader;
+extern ZipReader* tozipreader(lua_State* L, int index);
+extern int readzipreader(ZipReader* zr, char* buffer, size_t len);
+
+/* --- CommonMark -------------------------------------------------------- */
+
+extern void cmark_init(void);
+
+/* --- General utilities ------------------------------------------------- */
+
+/* The UTF-8 and escaping primitives are in wgcore.h. */
+
+extern void escapehtml(
+    std::string& dest, const char* src, size_t len, const char* space);
+
+/* A read-only view of a file's contents (see filesystem.cc). */
+
+struct MappedFile
+{
+    const char* data;
+    size_t len;
+    bool owned; /* data was read into a malloc()ed buffer, not mapped */
+#if defined WIN32
+    void* mapping;
+#endif
+};
+
+extern bool mapfile(const char* filename, MappedFile* mf);
+extern void unmapfile(MappedFile* mf);
+extern const char* checkbuffer(lua_State* L, int index, size_t* len);
+
+struct Writer;
+extern Writer* towriter(lua_State* L, int index);
+extern void writetowriter(Writer* w, const char* data, size_t len);
+extern int writefileatomically(const std::string& filename,
+    const std::vector<std::string_view>& chunks,
+    std::atomic<size_t>* written = nullptr,
+    bool* renamefailed = nullptr);
+
+extern void utils_init(void);
+extern void filesystem_init(void);
+extern void clipboard_init(void);
+
+#define STRINGIFY1(x) #x
+#define STRINGIFY(x) STRINGIFY1(x)
+
+/* --- Display layer ----------------------------------------------------- */
+
+enum
+{
+    /* These four are also style control codes. */
+    DPY_ITALIC = STYLE_ITALIC,
+    DPY_UNDERLINE = STYLE_UNDERLINE,
+    DPY_REVERSE = STYLE_REVERSE,
+    DPY_BOLD = STYLE_BOLD,
+
+    /* These cannot appear in text. */
+    DPY_BRIGHT = (1 << 4),
+    DPY_DIM = (1 << 5),
+};
+
+enum
+{
+    /* uni_t special values for representing mouse events. */
+
+    KEYM_MOUSE = 0x7f << 24,
+    KEY_MOUSEDOWN = 1 << 24,
+    KEY_MOUSEUP = 2 << 24,
+    KEY_SCROLLUP = 3 << 24,
+    KEY_SCROLLDOWN = 4 << 24,
+    KEY_MENU = 5 << 24,
+    KEY_RESIZE = 6 << 24,
+    KEY_TIMEOUT = 7 << 24,
+    KEY_QUIT = 8 << 24,
+};
+
+typedef struct
+{
+    float r, g, b;
+} colour_t;
+
+extern void dpy_init(const char* argv[]);
+extern void dpy_start(void);
+extern void dpy_shutdown(void);
+
+extern void dpy_setattr(int andmask, int ormask);
+extern void dpy_setcolour(const colour_t* fg, const colour_t* bg);
+extern void dpy_writechar(int x, int y, uni_t c);
+extern void dpy_setcursor(int x, int y, bool shown);
+/* Asks for the cursor to blink (or not) by itself; returns false if the
+ * display can't do that, and the scripts have to. */
+extern bool dpy_setcursorblink(bool blink);
+extern void dpy_clearscreen(void);
+extern void dpy_sync(void);
+extern void dpy_cleararea(int x1, int y1, int x2, int y2);
+extern void dpy_scrollarea(int y1, int y2, int delta);
+extern void dpy_getscreensize(int* x, int* y);
+extern uni_t dpy_getchar(double timeout);
+extern double dpy_getkeytime(void);
+extern std::string dpy_getkeyname(uni_t key);
+
+extern bool enable_unicode;
+
+#endif
@@ -0,0 +1,3868 @@
+
+/* This is src/lua/xml.lua */
+static const unsigned char lazy_script_table_0[] = {
+  0x05, 0x02, 0x0a, 0x00, 0x01, 0x20, 0x05, 0x5f, 0x6e, 0x61, 0x6d, 0x65,
+  0x08, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x74, 0x61, 0x67, 0x07, 0x6f, 0x70,
+  0x65, 0x6e, 0x74, 0x61, 0x67, 0x04, 0x74, 0x65, 0x78, 0x74, 0x09, 0x70,
+  0x61, 0x72, 0x73, 0x65, 0x5f, 0x74, 0x61, 0x67, 0x08, 0x50, 0x61, 0x72,
+  0x73, 0x65, 0x58, 0x4d, 0x4c, 0x02, 0x77, 0x67, 0x09, 0x78, 0x6d, 0x6c,
+  0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x73, 0x03, 0x0d, 0x03, 0x02, 0x00, 0x00,
+  0x22, 0x05, 0x02, 0x06, 0x05, 0x03, 0x03, 0x03, 0x04, 0x0f, 0x0f, 0x0f,
+  0x04, 0x09, 0x16, 0x0f, 0x05, 0x09, 0x16, 0x0f, 0x06, 0x09, 0x16, 0x0f,
+  0x07, 0x09, 0x16, 0x03, 0x03, 0x00, 0x21, 0x0f, 0x02, 0x07, 0x1a, 0x21,
+  0x06, 0x03, 0x01, 0x00, 0x50, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x04, 0x00, 0x00, 0x05, 0x05, 0x01, 0x00, 0x06, 0x06, 0x03, 0x00,
+  0x31, 0x03, 0x04, 0x06, 0x10, 0x03, 0x02, 0x31, 0x02, 0x00, 0x00, 0x00,
+  0x09, 0x04, 0x00, 0x00, 0x15, 0x04, 0x01, 0x05, 0x1a, 0x04, 0x02, 0x00,
+  0x50, 0x04, 0x02, 0x00, 0x03, 0x00, 0x00, 0x80, 0x16, 0x02, 0x02, 0x00,
+  0x50, 0x04, 0x0a, 0x00, 0x04, 0x00, 0x00, 0x80, 0x34, 0x09, 0x02, 0x00,
+  0x27, 0x08, 0x09, 0x05, 0x09, 0x09, 0x01, 0x00, 0x06, 0x0a, 0x05, 0x00,
+  0x06, 0x0b, 0x06, 0x00, 0x06, 0x0c, 0x07, 0x00, 0x15, 0x09, 0x04, 0x02,
+  0x0e, 0x09, 0x02, 0x08, 0x17, 0x00, 0x05, 0x00, 0x50, 0x04, 0x04, 0x00,
+  0x06, 0x00, 0x00, 0x80, 0x34, 0x09, 0x02, 0x00, 0x27, 0x08, 0x09, 0x05,
+  0x0e, 0x05, 0x02, 0x08, 0x18, 0x00, 0xe9, 0xff, 0x16, 0x00, 0x01, 0x00,
+  0x07, 0x03, 0x01, 0x03, 0x02, 0x03, 0x03, 0x03, 0x04, 0x03, 0x05, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x03, 0x06, 0x00, 0x17,
+  0x07, 0x01, 0x18, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x03, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xf9, 0x0a,
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x01, 0x01, 0x00, 0x00, 0x1c, 0x00,
+  0x01, 0x06, 0x0f, 0x0f, 0x03, 0x06, 0x0e, 0x0f, 0x04, 0x06, 0x0e, 0x0f,
+  0x05, 0x06, 0x0e, 0x0f, 0x06, 0x06, 0x0e, 0x0f, 0x01, 0x00, 0x16, 0x0f,
+  0x02, 0x03, 0x13, 0x16, 0x09, 0x01, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00,
+  0x15, 0x01, 0x02, 0x02, 0x13, 0x02, 0x00, 0x00, 0x46, 0x00, 0x01, 0x00,
+  0x46, 0x00, 0x02, 0x00, 0x06, 0x03, 0x01, 0x00, 0x15, 0x03, 0x01, 0x05,
+  0x19, 0x03, 0x03, 0x00, 0x35, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x16, 0x07, 0x02, 0x00, 0x50, 0x03, 0x07, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0x06, 0x07, 0x02, 0x00, 0x06, 0x08, 0x04, 0x00, 0x06, 0x09, 0x05, 0x00,
+  0x06, 0x0a, 0x06, 0x00, 0x15, 0x07, 0x04, 0x00, 0x16, 0x07, 0x00, 0x00,
+  0x18, 0x00, 0xf1, 0xff, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x05, 0x01,
+  0x00, 0x14, 0x08, 0x01, 0x18, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x19,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xfb, 0x08, 0x15, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01,
+  0x03, 0x07, 0x00, 0x00, 0x01, 0x0f, 0x00, 0x01, 0x07, 0x08, 0x41, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x80, 0x40, 0x01,
+  0x03, 0x00, 0x46, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x02, 0x04, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0x05, 0x03, 0x09, 0x03, 0x0a, 0x04,
+  0x00, 0x04, 0x00, 0x80, 0x06, 0x01, 0x03, 0x08, 0x01, 0x01, 0x01, 0x00,
+  0x01, 0x18, 0x00, 0x06, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x02,
+};
+
+/* This is src/lua/export/text.lua */
+static const unsigned char lazy_script_table_1[] = {
+  0x05, 0x02, 0x1c, 0x08, 0x70, 0x72, 0x6f, 0x6c, 0x6f, 0x67, 0x75, 0x65,
+  0x07, 0x72, 0x61, 0x77, 0x74, 0x65, 0x78, 0x74, 0x04, 0x74, 0x65, 0x78,
+  0x74, 0x06, 0x6e, 0x6f, 0x74, 0x65, 0x78, 0x74, 0x09, 0x69, 0x74, 0x61,
+  0x6c, 0x69, 0x63, 0x5f, 0x6f, 0x6e, 0x0a, 0x69, 0x74, 0x61, 0x6c, 0x69,
+  0x63, 0x5f, 0x6f, 0x66, 0x66, 0x0c, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x6c,
+  0x69, 0x6e, 0x65, 0x5f, 0x6f, 0x6e, 0x0d, 0x75, 0x6e, 0x64, 0x65, 0x72,
+  0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x6f, 0x66, 0x66, 0x07, 0x62, 0x6f, 0x6c,
+  0x64, 0x5f, 0x6f, 0x6e, 0x08, 0x62, 0x6f, 0x6c, 0x64, 0x5f, 0x6f, 0x66,
+  0x66, 0x0a, 0x6c, 0x69, 0x73, 0x74, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74,
+  0x08, 0x6c, 0x69, 0x73, 0x74, 0x5f, 0x65, 0x6e, 0x64, 0x0f, 0x70, 0x61,
+  0x72, 0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5f, 0x73, 0x74, 0x61, 0x72,
+  0x74, 0x01, 0x0a, 0x0d, 0x70, 0x61, 0x72, 0x61, 0x67, 0x72, 0x61, 0x70,
+  0x68, 0x5f, 0x65, 0x6e, 0x64, 0x08, 0x65, 0x70, 0x69, 0x6c, 0x6f, 0x67,
+  0x75, 0x65, 0x18, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x46, 0x69, 0x6c,
+  0x65, 0x55, 0x73, 0x69, 0x6e, 0x67, 0x43, 0x61, 0x6c, 0x6c, 0x62, 0x61,
+  0x63, 0x6b, 0x73, 0x08, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b,
+  0x16, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x44, 0x6f, 0x63, 0x75, 0x6d,
+  0x65, 0x6e, 0x74, 0x4e, 0x61, 0x74, 0x69, 0x76, 0x65, 0x6c, 0x79, 0x0e,
+  0x6e, 0x61, 0x74, 0x69, 0x76, 0x65, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61,
+  0x63, 0x6b, 0x10, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x46, 0x69, 0x6c,
+  0x65, 0x57, 0x69, 0x74, 0x68, 0x55, 0x49, 0x10, 0x45, 0x78, 0x70, 0x6f,
+  0x72, 0x74, 0x20, 0x54, 0x65, 0x78, 0x74, 0x20, 0x46, 0x69, 0x6c, 0x65,
+  0x04, 0x2e, 0x74, 0x78, 0x74, 0x0e, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74,
+  0x54, 0x65, 0x78, 0x74, 0x46, 0x69, 0x6c, 0x65, 0x0f, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x74, 0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+  0x12, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x54, 0x6f, 0x54, 0x65, 0x78,
+  0x74, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x0c, 0x4c, 0x75, 0x61, 0x45,
+  0x78, 0x70, 0x6f, 0x72, 0x74, 0x65, 0x72, 0x73, 0x03, 0x43, 0x6d, 0x64,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x16, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x09, 0x01, 0x01, 0x18, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x04, 0x09, 0x01, 0x00, 0x00, 0x06,
+  0x02, 0x00, 0x00, 0x15, 0x01, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x0c, 0x02, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x04, 0x09, 0x01, 0x00,
+  0x00, 0x06, 0x02, 0x00, 0x00, 0x15, 0x01, 0x02, 0x01, 0x16, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x10, 0x03, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01, 0x11,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x16,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x04, 0x01, 0x18, 0x00, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x16, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x17, 0x05, 0x01, 0x18, 0x00, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x16, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x1a, 0x06, 0x01, 0x18, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x16, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x1d, 0x07, 0x01, 0x18, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x16, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x20, 0x08, 0x01, 0x18, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x16, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x23, 0x09, 0x01, 0x18, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x16, 0x00, 0x01, 0x00, 0x00, 0x00, 0x26,
+  0x0a, 0x01, 0x18, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x16, 0x00, 0x01, 0x00, 0x00, 0x00, 0x29, 0x0b,
+  0x01, 0x18, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x16, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2c, 0x0c, 0x01,
+  0x18, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x16, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2f, 0x0d, 0x01, 0x18,
+  0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x09, 0x01, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x15, 0x01, 0x02,
+  0x01, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x0e, 0x00, 0x32, 0x0f, 0x01,
+  0x18, 0x00, 0x00, 0x00, 0x01, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x16, 0x00, 0x01, 0x00, 0x00, 0x00, 0x36,
+  0x10, 0x01, 0x18, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x06, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x36, 0x0c, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40,
+  0x06, 0x03, 0x01, 0x00, 0x36, 0x04, 0x11, 0x00, 0x40, 0x05, 0x12, 0x00,
+  0x10, 0x05, 0x04, 0xac, 0x02, 0x00, 0x00, 0x00, 0x13, 0x05, 0x01, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x10, 0x05, 0x04, 0x06, 0x03, 0x00, 0x00, 0x00,
+  0x13, 0x05, 0x02, 0x00, 0x46, 0x00, 0x00, 0x00, 0x10, 0x05, 0x04, 0xd5,
+  0x04, 0x00, 0x00, 0x00, 0x40, 0x05, 0x13, 0x00, 0x10, 0x05, 0x04, 0x14,
+  0x05, 0x00, 0x00, 0x00, 0x40, 0x05, 0x14, 0x00, 0x10, 0x05, 0x04, 0xea,
+  0x06, 0x00, 0x00, 0x00, 0x40, 0x05, 0x15, 0x00, 0x10, 0x05, 0x04, 0x49,
+  0x07, 0x00, 0x00, 0x00, 0x40, 0x05, 0x16, 0x00, 0x10, 0x05, 0x04, 0xc1,
+  0x08, 0x00, 0x00, 0x00, 0x40, 0x05, 0x17, 0x00, 0x10, 0x05, 0x04, 0x96,
+  0x09, 0x00, 0x00, 0x00, 0x40, 0x05, 0x18, 0x00, 0x10, 0x05, 0x04, 0x80,
+  0x0a, 0x00, 0x00, 0x00, 0x40, 0x05, 0x19, 0x00, 0x10, 0x05, 0x04, 0x41,
+  0x0b, 0x00, 0x00, 0x00, 0x40, 0x05, 0x1a, 0x00, 0x10, 0x05, 0x04, 0x12,
+  0x0c, 0x00, 0x00, 0x00, 0x40, 0x05, 0x1b, 0x00, 0x10, 0x05, 0x04, 0xc6,
+  0x0d, 0x00, 0x00, 0x00, 0x40, 0x05, 0x1c, 0x00, 0x10, 0x05, 0x04, 0x69,
+  0x0e, 0x00, 0x00, 0x00, 0x13, 0x05, 0x0d, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x10, 0x05, 0x04, 0x13, 0x0f, 0x00, 0x00, 0x00, 0x40, 0x05, 0x1d, 0x00,
+  0x10, 0x05, 0x04, 0xcd, 0x10, 0x00, 0x00, 0x00, 0x15, 0x02, 0x03, 0x00,
+  0x16, 0x02, 0x00, 0x00, 0x1e, 0x03, 0x11, 0x04, 0x00, 0x00, 0x00, 0x40,
+  0x03, 0x01, 0x03, 0x02, 0x03, 0x03, 0x03, 0x04, 0x03, 0x05, 0x03, 0x06,
+  0x03, 0x07, 0x03, 0x08, 0x03, 0x09, 0x03, 0x0a, 0x03, 0x0b, 0x03, 0x0c,
+  0x03, 0x0d, 0x03, 0x0f, 0x03, 0x10, 0x05, 0x0f, 0x02, 0x03, 0x04, 0x05,
+  0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x06,
+  0x00, 0x06, 0x03, 0x06, 0x04, 0x06, 0x05, 0x06, 0x06, 0x06, 0x07, 0x06,
+  0x08, 0x06, 0x09, 0x06, 0x0a, 0x06, 0x0b, 0x06, 0x0c, 0x06, 0x0e, 0x0f,
+  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+  0x0c, 0x0d, 0x0e, 0x06, 0x12, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xd1,
+  0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x08, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x0c, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x06, 0x04, 0x01,
+  0x00, 0x05, 0x05, 0x02, 0x00, 0x02, 0x06, 0x00, 0x00, 0x06, 0x07, 0x02,
+  0x00, 0x15, 0x03, 0x05, 0x01, 0x16, 0x00, 0x01, 0x00, 0x03, 0x03, 0x13,
+  0x04, 0x00, 0x00, 0x00, 0x40, 0x03, 0x03, 0x00, 0x3d, 0x14, 0x01, 0x18,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3e, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0x01, 0x01, 0x00, 0x00, 0x00, 0x08, 0x0c, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x40, 0x06, 0x02, 0x00, 0x00, 0x05, 0x03, 0x02, 0x00,
+  0x05, 0x04, 0x03, 0x00, 0x09, 0x05, 0x00, 0x00, 0x15, 0x01, 0x05, 0x00,
+  0x16, 0x01, 0x00, 0x00, 0x04, 0x03, 0x15, 0x04, 0x00, 0x00, 0x00, 0x40,
+  0x03, 0x16, 0x03, 0x17, 0x00, 0x41, 0x18, 0x01, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xff, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x06, 0x01, 0x00, 0x00, 0x19, 0x01, 0x02,
+  0x00, 0x0c, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x06, 0x00, 0x01,
+  0x00, 0x0c, 0x01, 0x03, 0x00, 0x00, 0x00, 0x20, 0x40, 0x06, 0x02, 0x00,
+  0x00, 0x05, 0x03, 0x04, 0x00, 0x15, 0x01, 0x03, 0x00, 0x16, 0x01, 0x00,
+  0x00, 0x05, 0x03, 0x19, 0x04, 0x00, 0x00, 0x00, 0x40, 0x03, 0x13, 0x04,
+  0x00, 0x00, 0x20, 0x40, 0x03, 0x03, 0x00, 0x46, 0x1a, 0x01, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x02, 0x00, 0x13, 0x41, 0x00,
+  0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x02, 0x00, 0x00, 0x00,
+  0x10, 0x40, 0x10, 0x00, 0x01, 0xd5, 0x03, 0x00, 0x00, 0x00, 0x40, 0x01,
+  0x04, 0x00, 0x40, 0x02, 0x05, 0x00, 0x46, 0x00, 0x01, 0x00, 0x0c, 0x03,
+  0x07, 0x00, 0x00, 0x00, 0x60, 0x40, 0x10, 0x02, 0x03, 0xad, 0x08, 0x00,
+  0x00, 0x00, 0x40, 0x02, 0x09, 0x00, 0x0c, 0x03, 0x07, 0x00, 0x00, 0x00,
+  0x60, 0x40, 0x10, 0x02, 0x03, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x01, 0x00, 0x0b, 0x06, 0x0f, 0x03, 0x1b, 0x04, 0x00, 0x00, 0x10, 0x40,
+  0x03, 0x03, 0x06, 0x10, 0x06, 0x11, 0x03, 0x1c, 0x04, 0x00, 0x00, 0x60,
+  0x40, 0x03, 0x18, 0x06, 0x12, 0x03, 0x1a, 0x04, 0x0f, 0x10, 0x11, 0x12,
+  0x01, 0x00, 0x01, 0x18, 0x00, 0x05, 0x35, 0x00, 0x00, 0x00, 0x02, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x13,
+};
+
+/* This is src/lua/export/latex.lua */
+static const unsigned char lazy_script_table_2[] = {
+  0x05, 0x02, 0x4f, 0x2c, 0x25, 0x25, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20,
+  0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x75, 0x74,
+  0x6f, 0x6d, 0x61, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x67,
+  0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20,
+  0x0c, 0x57, 0x6f, 0x72, 0x64, 0x47, 0x72, 0x69, 0x6e, 0x64, 0x65, 0x72,
+  0x20, 0x07, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4f, 0x4e, 0x02, 0x2e, 0x0a,
+  0x18, 0x5c, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x63, 0x6c,
+  0x61, 0x73, 0x73, 0x7b, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x7d,
+  0x0a, 0x29, 0x5c, 0x75, 0x73, 0x65, 0x70, 0x61, 0x63, 0x6b, 0x61, 0x67,
+  0x65, 0x7b, 0x78, 0x75, 0x6e, 0x69, 0x63, 0x6f, 0x64, 0x65, 0x2c, 0x20,
+  0x73, 0x65, 0x74, 0x73, 0x70, 0x61, 0x63, 0x65, 0x2c, 0x20, 0x78, 0x6c,
+  0x74, 0x78, 0x74, 0x72, 0x61, 0x7d, 0x0a, 0x08, 0x5c, 0x73, 0x6c, 0x6f,
+  0x70, 0x70, 0x79, 0x0a, 0x10, 0x5c, 0x6f, 0x6e, 0x65, 0x68, 0x61, 0x6c,
+  0x66, 0x73, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x0a, 0x11, 0x5c, 0x62,
+  0x65, 0x67, 0x69, 0x6e, 0x7b, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e,
+  0x74, 0x7d, 0x0a, 0x07, 0x5c, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x7b, 0x0f,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x44, 0x6f, 0x63, 0x75, 0x6d,
+  0x65, 0x6e, 0x74, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x02, 0x7d, 0x0a, 0x15,
+  0x5c, 0x61, 0x75, 0x74, 0x68, 0x6f, 0x72, 0x7b, 0x28, 0x6e, 0x6f, 0x20,
+  0x61, 0x75, 0x74, 0x68, 0x6f, 0x72, 0x29, 0x7d, 0x0a, 0x0b, 0x5c, 0x6d,
+  0x61, 0x6b, 0x65, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x0a, 0x08, 0x70, 0x72,
+  0x6f, 0x6c, 0x6f, 0x67, 0x75, 0x65, 0x07, 0x72, 0x61, 0x77, 0x74, 0x65,
+  0x78, 0x74, 0x04, 0x74, 0x65, 0x78, 0x74, 0x0c, 0x5c, 0x70, 0x61, 0x72,
+  0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x7b, 0x7d, 0x06, 0x6e, 0x6f, 0x74,
+  0x65, 0x78, 0x74, 0x08, 0x5c, 0x74, 0x65, 0x78, 0x74, 0x69, 0x74, 0x7b,
+  0x09, 0x69, 0x74, 0x61, 0x6c, 0x69, 0x63, 0x5f, 0x6f, 0x6e, 0x01, 0x7d,
+  0x0a, 0x69, 0x74, 0x61, 0x6c, 0x69, 0x63, 0x5f, 0x6f, 0x66, 0x66, 0x08,
+  0x5c, 0x74, 0x65, 0x78, 0x74, 0x62, 0x66, 0x7b, 0x07, 0x62, 0x6f, 0x6c,
+  0x64, 0x5f, 0x6f, 0x6e, 0x08, 0x62, 0x6f, 0x6c, 0x64, 0x5f, 0x6f, 0x66,
+  0x66, 0x0b, 0x5c, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65,
+  0x7b, 0x0c, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x5f,
+  0x6f, 0x6e, 0x0d, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65,
+  0x5f, 0x6f, 0x66, 0x66, 0x12, 0x5c, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x7b,
+  0x65, 0x6e, 0x75, 0x6d, 0x65, 0x72, 0x61, 0x74, 0x65, 0x7d, 0x0a, 0x0a,
+  0x6c, 0x69, 0x73, 0x74, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74, 0x10, 0x5c,
+  0x65, 0x6e, 0x64, 0x7b, 0x65, 0x6e, 0x75, 0x6d, 0x65, 0x72, 0x61, 0x74,
+  0x65, 0x7d, 0x0a, 0x08, 0x6c, 0x69, 0x73, 0x74, 0x5f, 0x65, 0x6e, 0x64,
+  0x00, 0x05, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x0f, 0x70, 0x61, 0x72, 0x61,
+  0x67, 0x72, 0x61, 0x70, 0x68, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74, 0x01,
+  0x0a, 0x0d, 0x70, 0x61, 0x72, 0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5f,
+  0x65, 0x6e, 0x64, 0x0f, 0x5c, 0x65, 0x6e, 0x64, 0x7b, 0x64, 0x6f, 0x63,
+  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x7d, 0x0a, 0x08, 0x65, 0x70, 0x69, 0x6c,
+  0x6f, 0x67, 0x75, 0x65, 0x0b, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x43,
+  0x61, 0x63, 0x68, 0x65, 0x05, 0x6c, 0x61, 0x74, 0x65, 0x78, 0x06, 0x77,
+  0x72, 0x69, 0x74, 0x65, 0x72, 0x18, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74,
+  0x46, 0x69, 0x6c, 0x65, 0x55, 0x73, 0x69, 0x6e, 0x67, 0x43, 0x61, 0x6c,
+  0x6c, 0x62, 0x61, 0x63, 0x6b, 0x73, 0x05, 0x63, 0x61, 0x63, 0x68, 0x65,
+  0x08, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b, 0x10, 0x45, 0x78,
+  0x70, 0x6f, 0x72, 0x74, 0x46, 0x69, 0x6c, 0x65, 0x57, 0x69, 0x74, 0x68,
+  0x55, 0x49, 0x11, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x4c, 0x61,
+  0x54, 0x65, 0x58, 0x20, 0x46, 0x69, 0x6c, 0x65, 0x04, 0x2e, 0x74, 0x65,
+  0x78, 0x0f, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x4c, 0x61, 0x74, 0x65,
+  0x78, 0x46, 0x69, 0x6c, 0x65, 0x0e, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74,
+  0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x13, 0x45, 0x78, 0x70,
+  0x6f, 0x72, 0x74, 0x54, 0x6f, 0x4c, 0x61, 0x74, 0x65, 0x78, 0x53, 0x74,
+  0x72, 0x69, 0x6e, 0x67, 0x02, 0x77, 0x67, 0x0b, 0x65, 0x73, 0x63, 0x61,
+  0x70, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x78, 0x09, 0x5c, 0x73, 0x65, 0x63,
+  0x74, 0x69, 0x6f, 0x6e, 0x7b, 0x02, 0x48, 0x31, 0x0c, 0x5c, 0x73, 0x75,
+  0x62, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x7b, 0x02, 0x48, 0x32,
+  0x0f, 0x5c, 0x73, 0x75, 0x62, 0x73, 0x75, 0x62, 0x73, 0x65, 0x63, 0x74,
+  0x69, 0x6f, 0x6e, 0x7b, 0x02, 0x48, 0x33, 0x0b, 0x5c, 0x70, 0x61, 0x72,
+  0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x7b, 0x02, 0x48, 0x34, 0x01, 0x50,
+  0x08, 0x5c, 0x69, 0x74, 0x65, 0x6d, 0x5b, 0x5d, 0x7b, 0x01, 0x4c, 0x13,
+  0x5c, 0x69, 0x74, 0x65, 0x6d, 0x5b, 0x5c, 0x74, 0x65, 0x78, 0x74, 0x62,
+  0x75, 0x6c, 0x6c, 0x65, 0x74, 0x5d, 0x7b, 0x02, 0x4c, 0x42, 0x06, 0x5c,
+  0x69, 0x74, 0x65, 0x6d, 0x7b, 0x02, 0x4c, 0x4e, 0x12, 0x5c, 0x62, 0x65,
+  0x67, 0x69, 0x6e, 0x7b, 0x71, 0x75, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x7d, 0x0a, 0x10, 0x0a, 0x5c, 0x65, 0x6e, 0x64, 0x7b, 0x71, 0x75,
+  0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x7d, 0x01, 0x51, 0x01, 0x56,
+  0x03, 0x52, 0x41, 0x57, 0x11, 0x5c, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x7b,
+  0x76, 0x65, 0x72, 0x62, 0x61, 0x74, 0x69, 0x6d, 0x7d, 0x0a, 0x0f, 0x0a,
+  0x5c, 0x65, 0x6e, 0x64, 0x7b, 0x76, 0x65, 0x72, 0x62, 0x61, 0x74, 0x69,
+  0x6d, 0x7d, 0x03, 0x50, 0x52, 0x45, 0x03, 0x43, 0x6d, 0x64, 0x13, 0x06,
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x26, 0x09, 0x00, 0x00, 0x00, 0x05, 0x02,
+  0x00, 0x00, 0x05, 0x03, 0x01, 0x00, 0x0c, 0x04, 0x03, 0x00, 0x00, 0x00,
+  0x20, 0x40, 0x05, 0x05, 0x04, 0x00, 0x31, 0x01, 0x02, 0x05, 0x15, 0x00,
+  0x02, 0x01, 0x09, 0x00, 0x00, 0x00, 0x05, 0x01, 0x05, 0x00, 0x15, 0x00,
+  0x02, 0x01, 0x09, 0x00, 0x00, 0x00, 0x05, 0x01, 0x06, 0x00, 0x15, 0x00,
+  0x02, 0x01, 0x09, 0x00, 0x00, 0x00, 0x05, 0x01, 0x07, 0x00, 0x15, 0x00,
+  0x02, 0x01, 0x09, 0x00, 0x00, 0x00, 0x05, 0x01, 0x08, 0x00, 0x15, 0x00,
+  0x02, 0x01, 0x09, 0x00, 0x00, 0x00, 0x05, 0x01, 0x09, 0x00, 0x15, 0x00,
+  0x02, 0x01, 0x09, 0x00, 0x00, 0x00, 0x05, 0x01, 0x0a, 0x00, 0x09, 0x02,
+  0x01, 0x00, 0x0c, 0x03, 0x0d, 0x00, 0x00, 0x30, 0xb0, 0x80, 0x15, 0x02,
+  0x02, 0x02, 0x05, 0x03, 0x0e, 0x00, 0x15, 0x00, 0x04, 0x01, 0x09, 0x00,
+  0x00, 0x00, 0x05, 0x01, 0x0f, 0x00, 0x15, 0x00, 0x02, 0x01, 0x09, 0x00,
+  0x00, 0x00, 0x05, 0x01, 0x10, 0x00, 0x15, 0x00, 0x02, 0x01, 0x16, 0x00,
+  0x01, 0x00, 0x11, 0x03, 0x01, 0x03, 0x02, 0x03, 0x03, 0x04, 0x00, 0x00,
+  0x20, 0x40, 0x03, 0x04, 0x03, 0x05, 0x03, 0x06, 0x03, 0x07, 0x03, 0x08,
+  0x03, 0x09, 0x03, 0x0a, 0x03, 0x0b, 0x03, 0x0c, 0x04, 0x00, 0x30, 0xb0,
+  0x80, 0x03, 0x0d, 0x03, 0x0e, 0x03, 0x0f, 0x00, 0x20, 0x10, 0x01, 0x18,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x00, 0x00,
+  0x00, 0x04, 0x09, 0x01, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00, 0x15, 0x01,
+  0x02, 0x01, 0x16, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2d, 0x11, 0x01, 0x18,
+  0x00, 0x00, 0x00, 0x01, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x02,
+  0x00, 0x00, 0x00, 0x06, 0x09, 0x01, 0x00, 0x00, 0x09, 0x02, 0x01, 0x00,
+  0x06, 0x03, 0x00, 0x00, 0x15, 0x02, 0x02, 0x00, 0x15, 0x01, 0x00, 0x01,
+  0x16, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x12, 0x01, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x32, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00,
+  0x15, 0x00, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x13, 0x00,
+  0x35, 0x14, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01, 0x36, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00,
+  0x05, 0x01, 0x00, 0x00, 0x15, 0x00, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00,
+  0x01, 0x03, 0x15, 0x00, 0x39, 0x16, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01,
+  0x3a, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04,
+  0x09, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x15, 0x00, 0x02, 0x01,
+  0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x17, 0x00, 0x3d, 0x18, 0x01, 0x18,
+  0x00, 0x00, 0x00, 0x01, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00,
+  0x15, 0x00, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x19, 0x00,
+  0x41, 0x1a, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01, 0x42, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00,
+  0x05, 0x01, 0x00, 0x00, 0x15, 0x00, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00,
+  0x01, 0x03, 0x17, 0x00, 0x45, 0x1b, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01,
+  0x46, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04,
+  0x09, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x15, 0x00, 0x02, 0x01,
+  0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x1c, 0x00, 0x49, 0x1d, 0x01, 0x18,
+  0x00, 0x00, 0x00, 0x01, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00,
+  0x15, 0x00, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x17, 0x00,
+  0x4d, 0x1e, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01, 0x4e, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x04, 0x09, 0x01, 0x00, 0x00,
+  0x05, 0x02, 0x00, 0x00, 0x15, 0x01, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00,
+  0x01, 0x03, 0x1f, 0x00, 0x51, 0x20, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01,
+  0x52, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x04,
+  0x09, 0x01, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x15, 0x01, 0x02, 0x01,
+  0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x21, 0x00, 0x55, 0x22, 0x01, 0x18,
+  0x00, 0x00, 0x00, 0x01, 0x56, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x02,
+  0x00, 0x00, 0x00, 0x09, 0x09, 0x01, 0x00, 0x00, 0x09, 0x05, 0x01, 0x00,
+  0x0f, 0x06, 0x00, 0x9a, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x04, 0x05, 0x06,
+  0x11, 0x03, 0x04, 0x00, 0x30, 0x02, 0x03, 0x00, 0x15, 0x01, 0x02, 0x01,
+  0x16, 0x00, 0x01, 0x00, 0x02, 0x03, 0x23, 0x03, 0x24, 0x00, 0x59, 0x25,
+  0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5a,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x09,
+  0x01, 0x00, 0x00, 0x09, 0x05, 0x01, 0x00, 0x0f, 0x06, 0x00, 0x9a, 0x01,
+  0x00, 0x00, 0x00, 0x0d, 0x04, 0x05, 0x06, 0x11, 0x03, 0x04, 0x01, 0x30,
+  0x02, 0x03, 0x00, 0x15, 0x01, 0x02, 0x01, 0x09, 0x01, 0x00, 0x00, 0x05,
+  0x02, 0x02, 0x00, 0x15, 0x01, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00, 0x03,
+  0x03, 0x23, 0x03, 0x24, 0x03, 0x26, 0x00, 0x5d, 0x27, 0x01, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x5e,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x09,
+  0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x15, 0x00, 0x02, 0x01, 0x16,
+  0x00, 0x01, 0x00, 0x01, 0x03, 0x28, 0x00, 0x62, 0x29, 0x01, 0x18, 0x00,
+  0x00, 0x00, 0x01, 0x63, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x02, 0x00,
+  0x00, 0x00, 0x50, 0x0c, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x05,
+  0x03, 0x02, 0x00, 0x06, 0x04, 0x00, 0x00, 0x15, 0x02, 0x03, 0x02, 0x0f,
+  0x00, 0x02, 0xdc, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x05, 0x00, 0x00,
+  0x00, 0x40, 0x40, 0x06, 0x04, 0x01, 0x00, 0x36, 0x05, 0x16, 0x00, 0x10,
+  0x02, 0x05, 0xa3, 0x06, 0x00, 0x00, 0x00, 0x13, 0x06, 0x00, 0x00, 0x46,
+  0x01, 0x00, 0x00, 0x46, 0x02, 0x00, 0x00, 0x10, 0x06, 0x05, 0xac, 0x07,
+  0x00, 0x00, 0x00, 0x13, 0x06, 0x01, 0x00, 0x46, 0x01, 0x00, 0x00, 0x10,
+  0x06, 0x05, 0x06, 0x08, 0x00, 0x00, 0x00, 0x13, 0x06, 0x02, 0x00, 0x46,
+  0x01, 0x00, 0x00, 0x46, 0x02, 0x00, 0x00, 0x10, 0x06, 0x05, 0xd5, 0x09,
+  0x00, 0x00, 0x00, 0x13, 0x06, 0x03, 0x00, 0x46, 0x01, 0x00, 0x00, 0x10,
+  0x06, 0x05, 0x14, 0x0a, 0x00, 0x00, 0x00, 0x13, 0x06, 0x04, 0x00, 0x46,
+  0x01, 0x00, 0x00, 0x10, 0x06, 0x05, 0xea, 0x0b, 0x00, 0x00, 0x00, 0x13,
+  0x06, 0x05, 0x00, 0x46, 0x01, 0x00, 0x00, 0x10, 0x06, 0x05, 0x49, 0x0c,
+  0x00, 0x00, 0x00, 0x13, 0x06, 0x06, 0x00, 0x46, 0x01, 0x00, 0x00, 0x10,
+  0x06, 0x05, 0x80, 0x0d, 0x00, 0x00, 0x00, 0x13, 0x06, 0x07, 0x00, 0x46,
+  0x01, 0x00, 0x00, 0x10, 0x06, 0x05, 0x41, 0x0e, 0x00, 0x00, 0x00, 0x13,
+  0x06, 0x08, 0x00, 0x46, 0x01, 0x00, 0x00, 0x10, 0x06, 0x05, 0xc1, 0x0f,
+  0x00, 0x00, 0x00, 0x13, 0x06, 0x09, 0x00, 0x46, 0x01, 0x00, 0x00, 0x10,
+  0x06, 0x05, 0x96, 0x10, 0x00, 0x00, 0x00, 0x13, 0x06, 0x0a, 0x00, 0x46,
+  0x01, 0x00, 0x00, 0x10, 0x06, 0x05, 0x12, 0x11, 0x00, 0x00, 0x00, 0x13,
+  0x06, 0x0b, 0x00, 0x46, 0x01, 0x00, 0x00, 0x10, 0x06, 0x05, 0xc6, 0x12,
+  0x00, 0x00, 0x00, 0x13, 0x06, 0x0c, 0x00, 0x46, 0x01, 0x00, 0x00, 0x46,
+  0x02, 0x01, 0x00, 0x10, 0x06, 0x05, 0x69, 0x13, 0x00, 0x00, 0x00, 0x13,
+  0x06, 0x0d, 0x00, 0x46, 0x01, 0x00, 0x00, 0x46, 0x02, 0x01, 0x00, 0x10,
+  0x06, 0x05, 0x13, 0x14, 0x00, 0x00, 0x00, 0x13, 0x06, 0x0e, 0x00, 0x46,
+  0x01, 0x00, 0x00, 0x10, 0x06, 0x05, 0xcd, 0x15, 0x00, 0x00, 0x00, 0x15,
+  0x03, 0x03, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x17,
+  0x03, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x40, 0x03, 0x2b, 0x03, 0x2c, 0x03,
+  0x2d, 0x04, 0x00, 0x00, 0x40, 0x40, 0x03, 0x2e, 0x03, 0x10, 0x03, 0x11,
+  0x03, 0x12, 0x03, 0x14, 0x03, 0x16, 0x03, 0x18, 0x03, 0x1a, 0x03, 0x1b,
+  0x03, 0x1d, 0x03, 0x1e, 0x03, 0x20, 0x03, 0x22, 0x03, 0x25, 0x03, 0x27,
+  0x03, 0x29, 0x05, 0x10, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d,
+  0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x0f, 0x00, 0x01, 0x02,
+  0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+  0x18, 0x2f, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x01, 0x00, 0x00, 0x00, 0x08,
+  0x0c, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x06, 0x02, 0x00, 0x00,
+  0x05, 0x03, 0x02, 0x00, 0x05, 0x04, 0x03, 0x00, 0x09, 0x05, 0x00, 0x00,
+  0x15, 0x01, 0x05, 0x00, 0x16, 0x01, 0x00, 0x00, 0x04, 0x03, 0x30, 0x04,
+  0x00, 0x00, 0x00, 0x40, 0x03, 0x31, 0x03, 0x32, 0x00, 0x68, 0x33, 0x01,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0x69, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x0c, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x0c, 0x01, 0x03, 0x00, 0x00, 0x00, 0x20,
+  0x40, 0x09, 0x02, 0x00, 0x00, 0x15, 0x00, 0x03, 0x00, 0x16, 0x00, 0x00,
+  0x00, 0x04, 0x03, 0x34, 0x04, 0x00, 0x00, 0x00, 0x40, 0x03, 0x0b, 0x04,
+  0x00, 0x00, 0x20, 0x40, 0x00, 0x6d, 0x35, 0x01, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
+  0x01, 0x02, 0x00, 0x75, 0x41, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x02, 0x00,
+  0x00, 0x04, 0x00, 0x80, 0x35, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x35, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x03, 0x03, 0x00,
+  0x05, 0x04, 0x04, 0x00, 0x37, 0x02, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x02, 0x01, 0xb7, 0x05, 0x00, 0x00, 0x00, 0x35, 0x02, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x05, 0x03, 0x06, 0x00, 0x05, 0x04, 0x04, 0x00,
+  0x37, 0x02, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x10, 0x02, 0x01, 0x14,
+  0x07, 0x00, 0x00, 0x00, 0x35, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x05, 0x03, 0x08, 0x00, 0x05, 0x04, 0x04, 0x00, 0x37, 0x02, 0x03, 0x03,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x02, 0x01, 0xf5, 0x09, 0x00, 0x00, 0x00,
+  0x35, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x03, 0x0a, 0x00,
+  0x05, 0x04, 0x04, 0x00, 0x37, 0x02, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x02, 0x01, 0x53, 0x0b, 0x00, 0x00, 0x00, 0x35, 0x02, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x05, 0x03, 0x0c, 0x00, 0x05, 0x04, 0x0d, 0x00,
+  0x37, 0x02, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x10, 0x02, 0x01, 0x71,
+  0x0e, 0x00, 0x00, 0x00, 0x35, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x05, 0x03, 0x0f, 0x00, 0x05, 0x04, 0x04, 0x00, 0x37, 0x02, 0x03, 0x03,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x02, 0x01, 0x6d, 0x10, 0x00, 0x00, 0x00,
+  0x35, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x03, 0x11, 0x00,
+  0x05, 0x04, 0x04, 0x00, 0x37, 0x02, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x02, 0x01, 0xec, 0x12, 0x00, 0x00, 0x00, 0x35, 0x02, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x05, 0x03, 0x13, 0x00, 0x05, 0x04, 0x04, 0x00,
+  0x37, 0x02, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x10, 0x02, 0x01, 0x63,
+  0x14, 0x00, 0x00, 0x00, 0x35, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x05, 0x03, 0x15, 0x00, 0x05, 0x04, 0x16, 0x00, 0x37, 0x02, 0x03, 0x03,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x02, 0x01, 0x70, 0x17, 0x00, 0x00, 0x00,
+  0x35, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x03, 0x15, 0x00,
+  0x05, 0x04, 0x16, 0x00, 0x37, 0x02, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x02, 0x01, 0x77, 0x18, 0x00, 0x00, 0x00, 0x35, 0x02, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x05, 0x03, 0x0c, 0x00, 0x05, 0x04, 0x0c, 0x00,
+  0x37, 0x02, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x10, 0x02, 0x01, 0x72,
+  0x19, 0x00, 0x00, 0x00, 0x35, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x05, 0x03, 0x1a, 0x00, 0x05, 0x04, 0x1b, 0x00, 0x37, 0x02, 0x03, 0x03,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x02, 0x01, 0xca, 0x1c, 0x00, 0x00, 0x00,
+  0x40, 0x02, 0x1d, 0x00, 0x46, 0x00, 0x00, 0x00, 0x46, 0x00, 0x01, 0x00,
+  0x40, 0x03, 0x1e, 0x00, 0x46, 0x00, 0x02, 0x00, 0x0c, 0x04, 0x20, 0x00,
+  0x00, 0x00, 0xf0, 0x41, 0x10, 0x03, 0x04, 0x33, 0x21, 0x00, 0x00, 0x00,
+  0x40, 0x03, 0x22, 0x00, 0x46, 0x00, 0x02, 0x00, 0x0c, 0x04, 0x20, 0x00,
+  0x00, 0x00, 0xf0, 0x41, 0x10, 0x03, 0x04, 0x50, 0x23, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x01, 0x00, 0x24, 0x03, 0x36, 0x03, 0x37, 0x04, 0x00, 0x04,
+  0x00, 0x80, 0x03, 0x38, 0x03, 0x17, 0x03, 0x39, 0x03, 0x3a, 0x03, 0x3b,
+  0x03, 0x3c, 0x03, 0x3d, 0x03, 0x3e, 0x03, 0x3f, 0x03, 0x23, 0x03, 0x26,
+  0x03, 0x40, 0x03, 0x41, 0x03, 0x42, 0x03, 0x43, 0x03, 0x44, 0x03, 0x45,
+  0x03, 0x46, 0x03, 0x47, 0x03, 0x48, 0x03, 0x49, 0x03, 0x4a, 0x03, 0x4b,
+  0x03, 0x4c, 0x03, 0x4d, 0x03, 0x4e, 0x06, 0x0f, 0x06, 0x10, 0x03, 0x4f,
+  0x04, 0x00, 0x00, 0xf0, 0x41, 0x03, 0x33, 0x06, 0x11, 0x03, 0x35, 0x03,
+  0x0f, 0x10, 0x11, 0x01, 0x00, 0x01, 0x18, 0x00, 0x05, 0x00, 0x03, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x12,
+};
+
+/* This is src/lua/export/troff.lua */
+static const unsigned char lazy_script_table_3[] = {
+  0x05, 0x02, 0x52, 0x01, 0x0a, 0x07, 0x6e, 0x65, 0x77, 0x6c, 0x69, 0x6e,
+  0x65, 0x07, 0x5e, 0x28, 0x5b, 0x2e, 0x27, 0x5d, 0x29, 0x03, 0x5c, 0x25,
+  0x31, 0x04, 0x5e, 0x25, 0x73, 0x2b, 0x00, 0x09, 0x65, 0x6d, 0x69, 0x74,
+  0x5f, 0x74, 0x65, 0x78, 0x74, 0x05, 0x2e, 0x55, 0x4c, 0x20, 0x22, 0x03,
+  0x5c, 0x66, 0x49, 0x05, 0x5c, 0x66, 0x28, 0x42, 0x49, 0x03, 0x5c, 0x66,
+  0x42, 0x03, 0x5c, 0x66, 0x52, 0x02, 0x22, 0x0a, 0x0b, 0x63, 0x68, 0x61,
+  0x6e, 0x67, 0x65, 0x73, 0x74, 0x61, 0x74, 0x65, 0x05, 0x73, 0x74, 0x79,
+  0x6c, 0x65, 0x06, 0x63, 0x61, 0x63, 0x68, 0x65, 0x64, 0x2d, 0x2e, 0x5c,
+  0x22, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x6d, 0x61, 0x74, 0x69,
+  0x63, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61,
+  0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x0c, 0x57, 0x6f, 0x72, 0x64,
+  0x47, 0x72, 0x69, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x07, 0x56, 0x45, 0x52,
+  0x53, 0x49, 0x4f, 0x4e, 0x02, 0x2e, 0x0a, 0x1f, 0x2e, 0x5c, 0x22, 0x20,
+  0x55, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x2e, 0x6d, 0x73, 0x20,
+  0x6d, 0x61, 0x63, 0x72, 0x6f, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x61, 0x67,
+  0x65, 0x21, 0x0a, 0x04, 0x2e, 0x54, 0x4c, 0x0a, 0x0f, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x74, 0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+  0x04, 0x6e, 0x61, 0x6d, 0x65, 0x08, 0x70, 0x72, 0x6f, 0x6c, 0x6f, 0x67,
+  0x75, 0x65, 0x07, 0x72, 0x61, 0x77, 0x74, 0x65, 0x78, 0x74, 0x06, 0x6e,
+  0x6f, 0x74, 0x65, 0x78, 0x74, 0x09, 0x69, 0x74, 0x61, 0x6c, 0x69, 0x63,
+  0x5f, 0x6f, 0x6e, 0x0a, 0x69, 0x74, 0x61, 0x6c, 0x69, 0x63, 0x5f, 0x6f,
+  0x66, 0x66, 0x0c, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65,
+  0x5f, 0x6f, 0x6e, 0x0d, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e,
+  0x65, 0x5f, 0x6f, 0x66, 0x66, 0x07, 0x62, 0x6f, 0x6c, 0x64, 0x5f, 0x6f,
+  0x6e, 0x08, 0x62, 0x6f, 0x6c, 0x64, 0x5f, 0x6f, 0x66, 0x66, 0x0a, 0x6c,
+  0x69, 0x73, 0x74, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74, 0x08, 0x6c, 0x69,
+  0x73, 0x74, 0x5f, 0x65, 0x6e, 0x64, 0x03, 0x50, 0x52, 0x45, 0x04, 0x2e,
+  0x44, 0x45, 0x0a, 0x02, 0x4c, 0x4e, 0x06, 0x73, 0x74, 0x72, 0x69, 0x6e,
+  0x67, 0x06, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x09, 0x2e, 0x49, 0x50,
+  0x20, 0x25, 0x64, 0x2e, 0x20, 0x33, 0x06, 0x6e, 0x75, 0x6d, 0x62, 0x65,
+  0x72, 0x03, 0x2e, 0x4c, 0x50, 0x0f, 0x70, 0x61, 0x72, 0x61, 0x67, 0x72,
+  0x61, 0x70, 0x68, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74, 0x0d, 0x70, 0x61,
+  0x72, 0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5f, 0x65, 0x6e, 0x64, 0x08,
+  0x65, 0x70, 0x69, 0x6c, 0x6f, 0x67, 0x75, 0x65, 0x0b, 0x45, 0x78, 0x70,
+  0x6f, 0x72, 0x74, 0x43, 0x61, 0x63, 0x68, 0x65, 0x05, 0x74, 0x72, 0x6f,
+  0x66, 0x66, 0x06, 0x77, 0x72, 0x69, 0x74, 0x65, 0x72, 0x18, 0x45, 0x78,
+  0x70, 0x6f, 0x72, 0x74, 0x46, 0x69, 0x6c, 0x65, 0x55, 0x73, 0x69, 0x6e,
+  0x67, 0x43, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b, 0x73, 0x05, 0x63,
+  0x61, 0x63, 0x68, 0x65, 0x04, 0x74, 0x65, 0x78, 0x74, 0x08, 0x63, 0x61,
+  0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b, 0x10, 0x45, 0x78, 0x70, 0x6f, 0x72,
+  0x74, 0x46, 0x69, 0x6c, 0x65, 0x57, 0x69, 0x74, 0x68, 0x55, 0x49, 0x11,
+  0x45, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x54, 0x72, 0x6f, 0x66, 0x66,
+  0x20, 0x46, 0x69, 0x6c, 0x65, 0x03, 0x2e, 0x74, 0x72, 0x0f, 0x45, 0x78,
+  0x70, 0x6f, 0x72, 0x74, 0x54, 0x72, 0x6f, 0x66, 0x66, 0x46, 0x69, 0x6c,
+  0x65, 0x0e, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x54, 0x6f, 0x53, 0x74,
+  0x72, 0x69, 0x6e, 0x67, 0x13, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x54,
+  0x6f, 0x54, 0x72, 0x6f, 0x66, 0x66, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67,
+  0x02, 0x77, 0x67, 0x0b, 0x65, 0x73, 0x63, 0x61, 0x70, 0x65, 0x74, 0x72,
+  0x6f, 0x66, 0x66, 0x04, 0x67, 0x73, 0x75, 0x62, 0x05, 0x2e, 0x4e, 0x48,
+  0x20, 0x31, 0x02, 0x48, 0x31, 0x05, 0x2e, 0x4e, 0x48, 0x20, 0x32, 0x02,
+  0x48, 0x32, 0x05, 0x2e, 0x4e, 0x48, 0x20, 0x33, 0x02, 0x48, 0x33, 0x05,
+  0x2e, 0x4e, 0x48, 0x20, 0x34, 0x02, 0x48, 0x34, 0x01, 0x50, 0x08, 0x2e,
+  0x49, 0x50, 0x20, 0x22, 0x22, 0x20, 0x33, 0x01, 0x4c, 0x0b, 0x2e, 0x49,
+  0x50, 0x20, 0x5c, 0x5b, 0x62, 0x75, 0x5d, 0x20, 0x33, 0x02, 0x4c, 0x42,
+  0x07, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x03, 0x2e, 0x49, 0x50,
+  0x01, 0x51, 0x01, 0x56, 0x03, 0x52, 0x41, 0x57, 0x05, 0x2e, 0x4c, 0x44,
+  0x20, 0x31, 0x03, 0x43, 0x6d, 0x64, 0x16, 0x02, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x08, 0x09, 0x00, 0x00, 0x00, 0x19, 0x00, 0x03, 0x00, 0x09, 0x00,
+  0x01, 0x00, 0x05, 0x01, 0x00, 0x00, 0x15, 0x00, 0x02, 0x01, 0x03, 0x00,
+  0x01, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03,
+  0x01, 0x00, 0x24, 0x02, 0x01, 0x18, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02,
+  0x00, 0x01, 0x25, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x05, 0x00, 0x00,
+  0x00, 0x17, 0x09, 0x01, 0x00, 0x00, 0x1a, 0x01, 0x0e, 0x00, 0x09, 0x01,
+  0x01, 0x00, 0x06, 0x02, 0x00, 0x00, 0x05, 0x03, 0x00, 0x00, 0x05, 0x04,
+  0x01, 0x00, 0x15, 0x01, 0x04, 0x02, 0x06, 0x00, 0x01, 0x00, 0x09, 0x01,
+  0x01, 0x00, 0x06, 0x02, 0x00, 0x00, 0x05, 0x03, 0x02, 0x00, 0x05, 0x04,
+  0x03, 0x00, 0x15, 0x01, 0x04, 0x02, 0x06, 0x00, 0x01, 0x00, 0x03, 0x01,
+  0x00, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x09, 0x01, 0x02, 0x00, 0x09, 0x02,
+  0x03, 0x00, 0x06, 0x03, 0x00, 0x00, 0x09, 0x04, 0x04, 0x00, 0x15, 0x02,
+  0x03, 0x00, 0x15, 0x01, 0x00, 0x01, 0x16, 0x00, 0x01, 0x00, 0x04, 0x03,
+  0x03, 0x03, 0x04, 0x03, 0x05, 0x03, 0x06, 0x00, 0x2b, 0x07, 0x01, 0x18,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2c,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0x06, 0x00, 0x00, 0x00, 0x42, 0x1a,
+  0x01, 0x10, 0x00, 0x09, 0x03, 0x00, 0x00, 0x19, 0x03, 0x0e, 0x00, 0x09,
+  0x03, 0x01, 0x00, 0x19, 0x03, 0x03, 0x00, 0x09, 0x03, 0x02, 0x00, 0x05,
+  0x04, 0x00, 0x00, 0x15, 0x03, 0x02, 0x01, 0x03, 0x03, 0x01, 0x00, 0x0a,
+  0x03, 0x01, 0x00, 0x09, 0x03, 0x02, 0x00, 0x05, 0x04, 0x01, 0x00, 0x15,
+  0x03, 0x02, 0x01, 0x03, 0x03, 0x01, 0x00, 0x0a, 0x03, 0x03, 0x00, 0x03,
+  0x03, 0x00, 0x00, 0x0a, 0x03, 0x01, 0x00, 0x1a, 0x00, 0x07, 0x00, 0x19,
+  0x02, 0x06, 0x00, 0x09, 0x03, 0x02, 0x00, 0x05, 0x04, 0x02, 0x00, 0x15,
+  0x03, 0x02, 0x01, 0x03, 0x03, 0x00, 0x00, 0x0a, 0x03, 0x01, 0x00, 0x17,
+  0x00, 0x1b, 0x00, 0x1a, 0x00, 0x07, 0x00, 0x1a, 0x02, 0x06, 0x00, 0x09,
+  0x03, 0x02, 0x00, 0x05, 0x04, 0x03, 0x00, 0x15, 0x03, 0x02, 0x01, 0x03,
+  0x03, 0x00, 0x00, 0x0a, 0x03, 0x01, 0x00, 0x17, 0x00, 0x13, 0x00, 0x19,
+  0x00, 0x07, 0x00, 0x1a, 0x02, 0x06, 0x00, 0x09, 0x03, 0x02, 0x00, 0x05,
+  0x04, 0x04, 0x00, 0x15, 0x03, 0x02, 0x01, 0x03, 0x03, 0x00, 0x00, 0x0a,
+  0x03, 0x01, 0x00, 0x17, 0x00, 0x0b, 0x00, 0x19, 0x00, 0x0a, 0x00, 0x19,
+  0x02, 0x09, 0x00, 0x09, 0x03, 0x04, 0x00, 0x19, 0x03, 0x02, 0x00, 0x09,
+  0x03, 0x05, 0x00, 0x1a, 0x03, 0x05, 0x00, 0x09, 0x03, 0x02, 0x00, 0x05,
+  0x04, 0x05, 0x00, 0x15, 0x03, 0x02, 0x01, 0x03, 0x03, 0x00, 0x00, 0x0a,
+  0x03, 0x01, 0x00, 0x19, 0x01, 0x09, 0x00, 0x09, 0x03, 0x00, 0x00, 0x1a,
+  0x03, 0x07, 0x00, 0x09, 0x03, 0x02, 0x00, 0x05, 0x04, 0x06, 0x00, 0x15,
+  0x03, 0x02, 0x01, 0x03, 0x03, 0x00, 0x00, 0x0a, 0x03, 0x03, 0x00, 0x03,
+  0x03, 0x01, 0x00, 0x0a, 0x03, 0x01, 0x00, 0x0a, 0x00, 0x04, 0x00, 0x0a,
+  0x01, 0x00, 0x00, 0x0a, 0x02, 0x05, 0x00, 0x16, 0x00, 0x01, 0x00, 0x07,
+  0x03, 0x01, 0x03, 0x08, 0x03, 0x09, 0x03, 0x0a, 0x03, 0x0b, 0x03, 0x0c,
+  0x03, 0x0d, 0x00, 0x35, 0x0e, 0x01, 0x18, 0x11, 0x00, 0x00, 0xef, 0x00,
+  0x01, 0x00, 0x00, 0x02, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x03, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x03,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x01, 0x01,
+  0x01, 0x25, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x02, 0x00, 0x00, 0x00,
+  0x06, 0x0f, 0x01, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x01, 0x00,
+  0x00, 0x03, 0x01, 0x01, 0x00, 0x0a, 0x01, 0x01, 0x00, 0x16, 0x00, 0x01,
+  0x00, 0x01, 0x03, 0x0f, 0x00, 0x5b, 0x10, 0x01, 0x18, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x01, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00,
+  0x00, 0x00, 0x2c, 0x09, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x05,
+  0x03, 0x01, 0x00, 0x0c, 0x04, 0x03, 0x00, 0x00, 0x00, 0x20, 0x40, 0x05,
+  0x05, 0x04, 0x00, 0x31, 0x01, 0x02, 0x05, 0x15, 0x00, 0x02, 0x01, 0x09,
+  0x00, 0x00, 0x00, 0x05, 0x01, 0x05, 0x00, 0x15, 0x00, 0x02, 0x01, 0x09,
+  0x00, 0x00, 0x00, 0x05, 0x01, 0x06, 0x00, 0x15, 0x00, 0x02, 0x01, 0x0c,
+  0x00, 0x09, 0x00, 0x00, 0x20, 0x70, 0x80, 0x09, 0x01, 0x01, 0x00, 0x1a,
+  0x01, 0x0e, 0x00, 0x09, 0x01, 0x02, 0x00, 0x06, 0x02, 0x00, 0x00, 0x05,
+  0x03, 0x0a, 0x00, 0x05, 0x04, 0x0b, 0x00, 0x15, 0x01, 0x04, 0x02, 0x06,
+  0x00, 0x01, 0x00, 0x09, 0x01, 0x02, 0x00, 0x06, 0x02, 0x00, 0x00, 0x05,
+  0x03, 0x0c, 0x00, 0x05, 0x04, 0x0d, 0x00, 0x15, 0x01, 0x04, 0x02, 0x06,
+  0x00, 0x01, 0x00, 0x03, 0x01, 0x00, 0x00, 0x0a, 0x01, 0x01, 0x00, 0x09,
+  0x01, 0x00, 0x00, 0x09, 0x02, 0x03, 0x00, 0x06, 0x03, 0x00, 0x00, 0x09,
+  0x04, 0x04, 0x00, 0x15, 0x02, 0x03, 0x00, 0x15, 0x01, 0x00, 0x01, 0x09,
+  0x00, 0x00, 0x00, 0x05, 0x01, 0x0e, 0x00, 0x15, 0x00, 0x02, 0x01, 0x03,
+  0x00, 0x01, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x0f,
+  0x03, 0x11, 0x03, 0x12, 0x03, 0x13, 0x04, 0x00, 0x00, 0x20, 0x40, 0x03,
+  0x14, 0x03, 0x15, 0x03, 0x16, 0x03, 0x17, 0x03, 0x18, 0x04, 0x00, 0x20,
+  0x70, 0x80, 0x03, 0x03, 0x03, 0x04, 0x03, 0x05, 0x03, 0x06, 0x03, 0x01,
+  0x00, 0x60, 0x19, 0x01, 0x18, 0x35, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0xc7, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x01, 0x00,
+  0x01, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x09, 0x01, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00, 0x15, 0x01, 0x02,
+  0x01, 0x16, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6c, 0x1a, 0x01, 0x18, 0x00,
+  0x00, 0x00, 0x01, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x16, 0x00, 0x01, 0x00, 0x00, 0x00, 0x70, 0x1b, 0x01,
+  0x18, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x06, 0x09, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x00, 0x09, 0x02,
+  0x01, 0x00, 0x09, 0x03, 0x02, 0x00, 0x15, 0x00, 0x04, 0x01, 0x16, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x73, 0x1c, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x74, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x06, 0x09, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x09, 0x02,
+  0x01, 0x00, 0x09, 0x03, 0x02, 0x00, 0x15, 0x00, 0x04, 0x01, 0x16, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x77, 0x1d, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x78, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x06, 0x09, 0x00, 0x00, 0x00, 0x09, 0x01, 0x01, 0x00, 0x03, 0x02,
+  0x01, 0x00, 0x09, 0x03, 0x02, 0x00, 0x15, 0x00, 0x04, 0x01, 0x16, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x7b, 0x1e, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x06, 0x09, 0x00, 0x00, 0x00, 0x09, 0x01, 0x01, 0x00, 0x03, 0x02,
+  0x00, 0x00, 0x09, 0x03, 0x02, 0x00, 0x15, 0x00, 0x04, 0x01, 0x16, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x7f, 0x1f, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x06, 0x09, 0x00, 0x00, 0x00, 0x09, 0x01, 0x01, 0x00, 0x09, 0x02,
+  0x02, 0x00, 0x03, 0x03, 0x01, 0x00, 0x15, 0x00, 0x04, 0x01, 0x16, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x83, 0x01, 0x20, 0x01, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x06, 0x09, 0x00, 0x00, 0x00, 0x09, 0x01, 0x01, 0x00, 0x09,
+  0x02, 0x02, 0x00, 0x03, 0x03, 0x00, 0x00, 0x15, 0x00, 0x04, 0x01, 0x16,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x87, 0x01, 0x21, 0x01, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x16, 0x00, 0x01, 0x00, 0x00, 0x00, 0x8b, 0x01,
+  0x22, 0x01, 0x18, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x16, 0x00, 0x01, 0x00, 0x00, 0x00, 0x8e, 0x01,
+  0x23, 0x01, 0x18, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x04,
+  0x00, 0x00, 0x00, 0x24, 0x0f, 0x01, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x02, 0x00, 0x00, 0x50, 0x02, 0x03, 0x00, 0x01, 0x00, 0x00, 0x80,
+  0x50, 0x01, 0x1a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x02, 0x00, 0x00,
+  0x50, 0x02, 0x04, 0x00, 0x01, 0x00, 0x00, 0x80, 0x09, 0x02, 0x01, 0x00,
+  0x05, 0x03, 0x02, 0x00, 0x15, 0x02, 0x02, 0x01, 0x50, 0x01, 0x0a, 0x00,
+  0x03, 0x00, 0x00, 0x80, 0x09, 0x02, 0x01, 0x00, 0x0c, 0x03, 0x06, 0x00,
+  0x00, 0x14, 0x40, 0x80, 0x05, 0x04, 0x07, 0x00, 0x0f, 0x05, 0x00, 0x60,
+  0x08, 0x00, 0x00, 0x00, 0x15, 0x03, 0x03, 0x00, 0x15, 0x02, 0x00, 0x01,
+  0x17, 0x00, 0x05, 0x00, 0x09, 0x02, 0x01, 0x00, 0x09, 0x05, 0x02, 0x00,
+  0x0d, 0x04, 0x05, 0x01, 0x30, 0x03, 0x04, 0x09, 0x15, 0x02, 0x02, 0x01,
+  0x09, 0x02, 0x01, 0x00, 0x05, 0x03, 0x0a, 0x00, 0x15, 0x02, 0x02, 0x01,
+  0x03, 0x02, 0x01, 0x00, 0x0a, 0x02, 0x03, 0x00, 0x0a, 0x01, 0x00, 0x00,
+  0x16, 0x00, 0x01, 0x00, 0x0b, 0x03, 0x0f, 0x03, 0x24, 0x03, 0x25, 0x03,
+  0x26, 0x03, 0x27, 0x03, 0x28, 0x04, 0x00, 0x14, 0x40, 0x80, 0x03, 0x29,
+  0x03, 0x2a, 0x03, 0x2b, 0x03, 0x01, 0x00, 0x91, 0x01, 0x2c, 0x01, 0x18,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x01, 0x01,
+  0x92, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x02, 0x00, 0x00, 0x00, 0x08,
+  0x09, 0x01, 0x00, 0x00, 0x19, 0x01, 0x03, 0x00, 0x09, 0x01, 0x01, 0x00,
+  0x05, 0x02, 0x00, 0x00, 0x15, 0x01, 0x02, 0x01, 0x03, 0x01, 0x01, 0x00,
+  0x0a, 0x01, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x01, 0x00,
+  0xa2, 0x01, 0x2d, 0x01, 0x18, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00,
+  0x7c, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x16, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa6, 0x01, 0x2e, 0x01, 0x18,
+  0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x03, 0x00, 0x00, 0x00,
+  0x75, 0x0c, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x05, 0x03, 0x02,
+  0x00, 0x06, 0x04, 0x00, 0x00, 0x15, 0x02, 0x03, 0x02, 0x0f, 0x00, 0x02,
+  0xdc, 0x03, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x03, 0x04, 0x00,
+  0x00, 0x03, 0x05, 0x00, 0x00, 0x03, 0x06, 0x00, 0x00, 0x03, 0x07, 0x00,
+  0x00, 0x03, 0x08, 0x01, 0x00, 0x13, 0x09, 0x00, 0x00, 0x46, 0x01, 0x08,
+  0x00, 0x46, 0x01, 0x00, 0x00, 0x13, 0x0a, 0x01, 0x00, 0x46, 0x01, 0x08,
+  0x00, 0x46, 0x02, 0x00, 0x00, 0x46, 0x01, 0x00, 0x00, 0x46, 0x02, 0x01,
+  0x00, 0x46, 0x01, 0x07, 0x00, 0x13, 0x0b, 0x02, 0x00, 0x46, 0x01, 0x04,
+  0x00, 0x46, 0x01, 0x08, 0x00, 0x46, 0x01, 0x00, 0x00, 0x46, 0x01, 0x07,
+  0x00, 0x46, 0x01, 0x05, 0x00, 0x46, 0x01, 0x06, 0x00, 0x0c, 0x0c, 0x05,
+  0x00, 0x00, 0x00, 0x40, 0x40, 0x06, 0x0d, 0x01, 0x00, 0x36, 0x0e, 0x17,
+  0x00, 0x10, 0x02, 0x0e, 0xa3, 0x06, 0x00, 0x00, 0x00, 0x13, 0x0f, 0x03,
+  0x00, 0x46, 0x01, 0x03, 0x00, 0x46, 0x01, 0x08, 0x00, 0x10, 0x0f, 0x0e,
+  0xba, 0x07, 0x00, 0x00, 0x00, 0x13, 0x0f, 0x04, 0x00, 0x46, 0x01, 0x00,
+  0x00, 0x46, 0x01, 0x08, 0x00, 0x46, 0x02, 0x00, 0x00, 0x46, 0x02, 0x01,
+  0x00, 0x46, 0x01, 0x07, 0x00, 0x10, 0x0f, 0x0e, 0xac, 0x08, 0x00, 0x00,
+  0x00, 0x10, 0x0a, 0x0e, 0xd5, 0x09, 0x00, 0x00, 0x00, 0x13, 0x0f, 0x05,
+  0x00, 0x46, 0x01, 0x00, 0x00, 0x10, 0x0f, 0x0e, 0x06, 0x0a, 0x00, 0x00,
+  0x00, 0x40, 0x0f, 0x18, 0x00, 0x10, 0x0f, 0x0e, 0x14, 0x0b, 0x00, 0x00,
+  0x00, 0x13, 0x0f, 0x07, 0x00, 0x46, 0x00, 0x0b, 0x00, 0x46, 0x01, 0x04,
+  0x00, 0x46, 0x01, 0x06, 0x00, 0x10, 0x0f, 0x0e, 0xea, 0x0c, 0x00, 0x00,
+  0x00, 0x13, 0x0f, 0x08, 0x00, 0x46, 0x00, 0x0b, 0x00, 0x46, 0x01, 0x04,
+  0x00, 0x46, 0x01, 0x06, 0x00, 0x10, 0x0f, 0x0e, 0x49, 0x0d, 0x00, 0x00,
+  0x00, 0x13, 0x0f, 0x09, 0x00, 0x46, 0x00, 0x0b, 0x00, 0x46, 0x01, 0x05,
+  0x00, 0x46, 0x01, 0x06, 0x00, 0x10, 0x0f, 0x0e, 0xc1, 0x0e, 0x00, 0x00,
+  0x00, 0x13, 0x0f, 0x0a, 0x00, 0x46, 0x00, 0x0b, 0x00, 0x46, 0x01, 0x05,
+  0x00, 0x46, 0x01, 0x06, 0x00, 0x10, 0x0f, 0x0e, 0x96, 0x0f, 0x00, 0x00,
+  0x00, 0x13, 0x0f, 0x0b, 0x00, 0x46, 0x00, 0x0b, 0x00, 0x46, 0x01, 0x05,
+  0x00, 0x46, 0x01, 0x04, 0x00, 0x10, 0x0f, 0x0e, 0x80, 0x10, 0x00, 0x00,
+  0x00, 0x13, 0x0f, 0x0c, 0x00, 0x46, 0x00, 0x0b, 0x00, 0x46, 0x01, 0x05,
+  0x00, 0x46, 0x01, 0x04, 0x00, 0x10, 0x0f, 0x0e, 0x41, 0x11, 0x00, 0x00,
+  0x00, 0x40, 0x0f, 0x19, 0x00, 0x10, 0x0f, 0x0e, 0x12, 0x12, 0x00, 0x00,
+  0x00, 0x40, 0x0f, 0x1a, 0x00, 0x10, 0x0f, 0x0e, 0xc6, 0x13, 0x00, 0x00,
+  0x00, 0x13, 0x0f, 0x0f, 0x00, 0x46, 0x01, 0x03, 0x00, 0x46, 0x01, 0x00,
+  0x00, 0x46, 0x02, 0x02, 0x00, 0x46, 0x01, 0x08, 0x00, 0x10, 0x0f, 0x0e,
+  0x69, 0x14, 0x00, 0x00, 0x00, 0x13, 0x0f, 0x10, 0x00, 0x46, 0x01, 0x08,
+  0x00, 0x46, 0x01, 0x00, 0x00, 0x10, 0x0f, 0x0e, 0x13, 0x15, 0x00, 0x00,
+  0x00, 0x40, 0x0f, 0x1b, 0x00, 0x10, 0x0f, 0x0e, 0xcd, 0x16, 0x00, 0x00,
+  0x00, 0x15, 0x0c, 0x03, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x16, 0x0c, 0x00,
+  0x00, 0x1c, 0x03, 0x2f, 0x04, 0x00, 0x00, 0x00, 0x40, 0x03, 0x30, 0x03,
+  0x31, 0x03, 0x32, 0x04, 0x00, 0x00, 0x40, 0x40, 0x03, 0x33, 0x03, 0x10,
+  0x03, 0x19, 0x03, 0x34, 0x03, 0x1a, 0x03, 0x1b, 0x03, 0x1c, 0x03, 0x1d,
+  0x03, 0x1e, 0x03, 0x1f, 0x03, 0x20, 0x03, 0x21, 0x03, 0x22, 0x03, 0x23,
+  0x03, 0x2c, 0x03, 0x2d, 0x03, 0x2e, 0x05, 0x11, 0x06, 0x07, 0x08, 0x09,
+  0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+  0x16, 0x06, 0x06, 0x06, 0x0d, 0x06, 0x0e, 0x06, 0x11, 0x12, 0x00, 0x01,
+  0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d,
+  0x0e, 0x0f, 0x10, 0x11, 0x19, 0x35, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x21, 0x00, 0x00, 0x01, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0xb0, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x0c, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0x06, 0x02, 0x00, 0x00, 0x05, 0x03, 0x02, 0x00, 0x05, 0x04, 0x03,
+  0x00, 0x09, 0x05, 0x00, 0x00, 0x15, 0x01, 0x05, 0x00, 0x16, 0x01, 0x00,
+  0x00, 0x04, 0x03, 0x36, 0x04, 0x00, 0x00, 0x00, 0x40, 0x03, 0x37, 0x03,
+  0x38, 0x00, 0xab, 0x01, 0x39, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xff, 0x00, 0xac, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x07, 0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0c,
+  0x01, 0x03, 0x00, 0x00, 0x00, 0x20, 0x40, 0x09, 0x02, 0x00, 0x00, 0x15,
+  0x00, 0x03, 0x00, 0x16, 0x00, 0x00, 0x00, 0x04, 0x03, 0x3a, 0x04, 0x00,
+  0x00, 0x00, 0x40, 0x03, 0x17, 0x04, 0x00, 0x00, 0x20, 0x40, 0x00, 0xb0,
+  0x01, 0x3b, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x01, 0x02, 0x00, 0x3c, 0x41,
+  0x00, 0x00, 0x00, 0x0c, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x80, 0x0c,
+  0x01, 0x05, 0x00, 0x00, 0x10, 0x30, 0x80, 0x35, 0x02, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0x03, 0x06, 0x00, 0x10, 0x03, 0x02, 0xb7, 0x07,
+  0x00, 0x00, 0x00, 0x05, 0x03, 0x08, 0x00, 0x10, 0x03, 0x02, 0x14, 0x09,
+  0x00, 0x00, 0x00, 0x05, 0x03, 0x0a, 0x00, 0x10, 0x03, 0x02, 0xf5, 0x0b,
+  0x00, 0x00, 0x00, 0x05, 0x03, 0x0c, 0x00, 0x10, 0x03, 0x02, 0x53, 0x0d,
+  0x00, 0x00, 0x00, 0x05, 0x03, 0x0e, 0x00, 0x10, 0x03, 0x02, 0x71, 0x0f,
+  0x00, 0x00, 0x00, 0x05, 0x03, 0x10, 0x00, 0x10, 0x03, 0x02, 0x6d, 0x11,
+  0x00, 0x00, 0x00, 0x05, 0x03, 0x12, 0x00, 0x10, 0x03, 0x02, 0xec, 0x13,
+  0x00, 0x00, 0x00, 0x05, 0x03, 0x14, 0x00, 0x10, 0x03, 0x02, 0x63, 0x15,
+  0x00, 0x00, 0x00, 0x05, 0x03, 0x16, 0x00, 0x10, 0x03, 0x02, 0x70, 0x17,
+  0x00, 0x00, 0x00, 0x05, 0x03, 0x16, 0x00, 0x10, 0x03, 0x02, 0x77, 0x18,
+  0x00, 0x00, 0x00, 0x05, 0x03, 0x19, 0x00, 0x10, 0x03, 0x02, 0x72, 0x1a,
+  0x00, 0x00, 0x00, 0x05, 0x03, 0x1b, 0x00, 0x10, 0x03, 0x02, 0xca, 0x1c,
+  0x00, 0x00, 0x00, 0x40, 0x03, 0x1d, 0x00, 0x46, 0x00, 0x01, 0x00, 0x46,
+  0x00, 0x00, 0x00, 0x46, 0x00, 0x02, 0x00, 0x40, 0x04, 0x1e, 0x00, 0x46,
+  0x00, 0x03, 0x00, 0x0c, 0x05, 0x20, 0x00, 0x00, 0x00, 0xf0, 0x41, 0x10,
+  0x04, 0x05, 0xea, 0x21, 0x00, 0x00, 0x00, 0x40, 0x04, 0x22, 0x00, 0x46,
+  0x00, 0x03, 0x00, 0x0c, 0x05, 0x20, 0x00, 0x00, 0x00, 0xf0, 0x41, 0x10,
+  0x04, 0x05, 0x38, 0x23, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0x24,
+  0x03, 0x3c, 0x03, 0x3d, 0x04, 0x00, 0x04, 0x00, 0x80, 0x03, 0x27, 0x03,
+  0x3e, 0x04, 0x00, 0x10, 0x30, 0x80, 0x03, 0x3f, 0x03, 0x40, 0x03, 0x41,
+  0x03, 0x42, 0x03, 0x43, 0x03, 0x44, 0x03, 0x45, 0x03, 0x46, 0x03, 0x2b,
+  0x03, 0x47, 0x03, 0x48, 0x03, 0x49, 0x03, 0x4a, 0x03, 0x4b, 0x03, 0x4c,
+  0x03, 0x26, 0x03, 0x4d, 0x03, 0x4e, 0x03, 0x4f, 0x03, 0x06, 0x03, 0x50,
+  0x03, 0x51, 0x03, 0x24, 0x06, 0x12, 0x06, 0x13, 0x03, 0x52, 0x04, 0x00,
+  0x00, 0xf0, 0x41, 0x03, 0x39, 0x06, 0x14, 0x03, 0x3b, 0x03, 0x12, 0x13,
+  0x14, 0x01, 0x00, 0x01, 0x18, 0x00, 0x05, 0x00, 0x01, 0x00, 0x03, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x15,
+};
+
+/* This is src/lua/export/opendocument.lua */
+static const unsigned char lazy_script_table_4[] = {
+  0x05, 0x02, 0x6d, 0x09, 0x3c, 0x74, 0x65, 0x78, 0x74, 0x3a, 0x73, 0x2f,
+  0x3e, 0x06, 0x75, 0x6e, 0x68, 0x74, 0x6d, 0x6c, 0x04, 0x65, 0x6d, 0x69,
+  0x74, 0x34, 0x3c, 0x74, 0x65, 0x78, 0x74, 0x3a, 0x68, 0x20, 0x74, 0x65,
+  0x78, 0x74, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2d, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x25, 0x73, 0x22, 0x20, 0x74, 0x65, 0x78, 0x74, 0x3a,
+  0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x6c, 0x65, 0x76, 0x65,
+  0x6c, 0x3d, 0x22, 0x31, 0x22, 0x3e, 0x05, 0x73, 0x74, 0x79, 0x6c, 0x65,
+  0x06, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x1d, 0x3c, 0x74, 0x65, 0x78,
+  0x74, 0x3a, 0x70, 0x20, 0x74, 0x65, 0x78, 0x74, 0x3a, 0x73, 0x74, 0x79,
+  0x6c, 0x65, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x25, 0x73, 0x22,
+  0x3e, 0x06, 0x73, 0x69, 0x6d, 0x70, 0x6c, 0x65, 0x4e, 0x3c, 0x74, 0x65,
+  0x78, 0x74, 0x3a, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x74, 0x65, 0x78, 0x74,
+  0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x25, 0x73, 0x22, 0x3e, 0x3c, 0x74, 0x65, 0x78, 0x74, 0x3a, 0x6c,
+  0x69, 0x73, 0x74, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x25, 0x73, 0x3e, 0x3c,
+  0x74, 0x65, 0x78, 0x74, 0x3a, 0x70, 0x20, 0x74, 0x65, 0x78, 0x74, 0x3a,
+  0x73, 0x74, 0x79, 0x6c, 0x65, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x50, 0x22, 0x3e, 0x06, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x16, 0x20,
+  0x74, 0x65, 0x78, 0x74, 0x3a, 0x73, 0x74, 0x61, 0x72, 0x74, 0x2d, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x25, 0x64, 0x22, 0x00, 0x04, 0x6c,
+  0x69, 0x73, 0x74, 0x01, 0x0a, 0x0a, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65,
+  0x70, 0x61, 0x72, 0x61, 0x06, 0x63, 0x61, 0x63, 0x68, 0x65, 0x64, 0x94,
+  0x03, 0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69,
+  0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63,
+  0x6f, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38,
+  0x22, 0x3f, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x6f, 0x66,
+  0x66, 0x69, 0x63, 0x65, 0x3a, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e,
+  0x74, 0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x6f, 0x66,
+  0x66, 0x69, 0x63, 0x65, 0x3a, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e,
+  0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x6f, 0x66, 0x66, 0x69, 0x63, 0x65,
+  0x3d, 0x22, 0x75, 0x72, 0x6e, 0x3a, 0x6f, 0x61, 0x73, 0x69, 0x73, 0x3a,
+  0x6e, 0x61, 0x6d, 0x65, 0x73, 0x3a, 0x74, 0x63, 0x3a, 0x6f, 0x70, 0x65,
+  0x6e, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3a, 0x78, 0x6d,
+  0x6c, 0x6e, 0x73, 0x3a, 0x6f, 0x66, 0x66, 0x69, 0x63, 0x65, 0x3a, 0x31,
+  0x2e, 0x30, 0x22, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x78, 0x6d, 0x6c,
+  0x6e, 0x73, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x75, 0x72, 0x6e,
+  0x3a, 0x6f, 0x61, 0x73, 0x69, 0x73, 0x3a, 0x6e, 0x61, 0x6d, 0x65, 0x73,
+  0x3a, 0x74, 0x63, 0x3a, 0x6f, 0x70, 0x65, 0x6e, 0x64, 0x6f, 0x63, 0x75,
+  0x6d, 0x65, 0x6e, 0x74, 0x3a, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74,
+  0x65, 0x78, 0x74, 0x3a, 0x31, 0x2e, 0x30, 0x22, 0x0a, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x66, 0x6f, 0x3d, 0x22,
+  0x75, 0x72, 0x6e, 0x3a, 0x6f, 0x61, 0x73, 0x69, 0x73, 0x3a, 0x6e, 0x61,
+  0x6d, 0x65, 0x73, 0x3a, 0x74, 0x63, 0x3a, 0x6f, 0x70, 0x65, 0x6e, 0x64,
+  0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3a, 0x78, 0x6d, 0x6c, 0x6e,
+  0x73, 0x3a, 0x78, 0x73, 0x6c, 0x2d, 0x66, 0x6f, 0x2d, 0x63, 0x6f, 0x6d,
+  0x70, 0x61, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x3a, 0x31, 0x2e, 0x30, 0x22,
+  0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+  0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x75, 0x72, 0x6e, 0x3a, 0x6f,
+  0x61, 0x73, 0x69, 0x73, 0x3a, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x3a, 0x74,
+  0x63, 0x3a, 0x6f, 0x70, 0x65, 0x6e, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65,
+  0x6e, 0x74, 0x3a, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x73, 0x74, 0x79,
+  0x6c, 0x65, 0x3a, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x3c, 0x6f, 0x66, 0x66, 0x69, 0x63, 0x65, 0x3a, 0x62, 0x6f,
+  0x64, 0x79, 0x3e, 0x3c, 0x6f, 0x66, 0x66, 0x69, 0x63, 0x65, 0x3a, 0x74,
+  0x65, 0x78, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x08, 0x70, 0x72,
+  0x6f, 0x6c, 0x6f, 0x67, 0x75, 0x65, 0x37, 0x3c, 0x2f, 0x6f, 0x66, 0x66,
+  0x69, 0x63, 0x65, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3e, 0x3c, 0x2f, 0x6f,
+  0x66, 0x66, 0x69, 0x63, 0x65, 0x3a, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x3c,
+  0x2f, 0x6f, 0x66, 0x66, 0x69, 0x63, 0x65, 0x3a, 0x64, 0x6f, 0x63, 0x75,
+  0x6d, 0x65, 0x6e, 0x74, 0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
+  0x3e, 0x0a, 0x08, 0x65, 0x70, 0x69, 0x6c, 0x6f, 0x67, 0x75, 0x65, 0x07,
+  0x72, 0x61, 0x77, 0x74, 0x65, 0x78, 0x74, 0x04, 0x74, 0x65, 0x78, 0x74,
+  0x06, 0x6e, 0x6f, 0x74, 0x65, 0x78, 0x74, 0x1f, 0x3c, 0x74, 0x65, 0x78,
+  0x74, 0x3a, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x74, 0x65, 0x78, 0x74, 0x3a,
+  0x73, 0x74, 0x79, 0x6c, 0x65, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x49, 0x22, 0x3e, 0x09, 0x69, 0x74, 0x61, 0x6c, 0x69, 0x63, 0x5f, 0x6f,
+  0x6e, 0x0c, 0x3c, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x3a, 0x73, 0x70, 0x61,
+  0x6e, 0x3e, 0x0a, 0x69, 0x74, 0x61, 0x6c, 0x69, 0x63, 0x5f, 0x6f, 0x66,
+  0x66, 0x1f, 0x3c, 0x74, 0x65, 0x78, 0x74, 0x3a, 0x73, 0x70, 0x61, 0x6e,
+  0x20, 0x74, 0x65, 0x78, 0x74, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2d,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x42, 0x22, 0x3e, 0x07, 0x62, 0x6f,
+  0x6c, 0x64, 0x5f, 0x6f, 0x6e, 0x08, 0x62, 0x6f, 0x6c, 0x64, 0x5f, 0x6f,
+  0x66, 0x66, 0x20, 0x3c, 0x74, 0x65, 0x78, 0x74, 0x3a, 0x73, 0x70, 0x61,
+  0x6e, 0x20, 0x74, 0x65, 0x78, 0x74, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65,
+  0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x55, 0x4c, 0x22, 0x3e, 0x0c,
+  0x75, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x6f, 0x6e,
+  0x0d, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x6f,
+  0x66, 0x66, 0x0a, 0x6c, 0x69, 0x73, 0x74, 0x5f, 0x73, 0x74, 0x61, 0x72,
+  0x74, 0x08, 0x6c, 0x69, 0x73, 0x74, 0x5f, 0x65, 0x6e, 0x64, 0x0f, 0x70,
+  0x61, 0x72, 0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5f, 0x73, 0x74, 0x61,
+  0x72, 0x74, 0x0d, 0x70, 0x61, 0x72, 0x61, 0x67, 0x72, 0x61, 0x70, 0x68,
+  0x5f, 0x65, 0x6e, 0x64, 0x0b, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x43,
+  0x61, 0x63, 0x68, 0x65, 0x0c, 0x6f, 0x70, 0x65, 0x6e, 0x64, 0x6f, 0x63,
+  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x06, 0x77, 0x72, 0x69, 0x74, 0x65, 0x72,
+  0x0b, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x53, 0x65, 0x74,
+  0x06, 0x61, 0x64, 0x64, 0x6f, 0x6e, 0x73, 0x0a, 0x68, 0x74, 0x6d, 0x6c,
+  0x65, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x18, 0x45, 0x78, 0x70, 0x6f, 0x72,
+  0x74, 0x46, 0x69, 0x6c, 0x65, 0x55, 0x73, 0x69, 0x6e, 0x67, 0x43, 0x61,
+  0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b, 0x73, 0x05, 0x63, 0x61, 0x63, 0x68,
+  0x65, 0x08, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b, 0x05, 0x77,
+  0x72, 0x69, 0x74, 0x65, 0x05, 0x66, 0x6c, 0x75, 0x73, 0x68, 0x0f, 0x63,
+  0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65,
+  0x6e, 0x74, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x05, 0x25, 0x2e, 0x2e, 0x2d,
+  0x24, 0x04, 0x66, 0x69, 0x6e, 0x64, 0x04, 0x67, 0x73, 0x75, 0x62, 0x09,
+  0x28, 0x75, 0x6e, 0x6e, 0x61, 0x6d, 0x65, 0x64, 0x29, 0x0b, 0x46, 0x69,
+  0x6c, 0x65, 0x42, 0x72, 0x6f, 0x77, 0x73, 0x65, 0x72, 0x0a, 0x45, 0x78,
+  0x70, 0x6f, 0x72, 0x74, 0x20, 0x61, 0x73, 0x3a, 0x06, 0x61, 0x73, 0x73,
+  0x65, 0x72, 0x74, 0x07, 0x2f, 0x5b, 0x5e, 0x2e, 0x5d, 0x2a, 0x24, 0x08,
+  0x6d, 0x69, 0x6d, 0x65, 0x74, 0x79, 0x70, 0x65, 0x27, 0x61, 0x70, 0x70,
+  0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76, 0x6e, 0x64,
+  0x2e, 0x6f, 0x61, 0x73, 0x69, 0x73, 0x2e, 0x6f, 0x70, 0x65, 0x6e, 0x64,
+  0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x74, 0x65, 0x78, 0x74,
+  0x05, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x15, 0x4d, 0x45, 0x54, 0x41, 0x2d,
+  0x49, 0x4e, 0x46, 0x2f, 0x6d, 0x61, 0x6e, 0x69, 0x66, 0x65, 0x73, 0x74,
+  0x2e, 0x78, 0x6d, 0x6c, 0xad, 0x05, 0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20,
+  0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30,
+  0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22,
+  0x55, 0x54, 0x46, 0x2d, 0x38, 0x22, 0x3f, 0x3e, 0x0a, 0x09, 0x09, 0x09,
+  0x3c, 0x6d, 0x61, 0x6e, 0x69, 0x66, 0x65, 0x73, 0x74, 0x3a, 0x6d, 0x61,
+  0x6e, 0x69, 0x66, 0x65, 0x73, 0x74, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+  0x3a, 0x6d, 0x61, 0x6e, 0x69, 0x66, 0x65, 0x73, 0x74, 0x3d, 0x22, 0x75,
+  0x72, 0x6e, 0x3a, 0x6f, 0x61, 0x73, 0x69, 0x73, 0x3a, 0x6e, 0x61, 0x6d,
+  0x65, 0x73, 0x3a, 0x74, 0x63, 0x3a, 0x6f, 0x70, 0x65, 0x6e, 0x64, 0x6f,
+  0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3a, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+  0x3a, 0x6d, 0x61, 0x6e, 0x69, 0x66, 0x65, 0x73, 0x74, 0x3a, 0x31, 0x2e,
+  0x30, 0x22, 0x3e, 0x20, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x6d, 0x61,
+  0x6e, 0x69, 0x66, 0x65, 0x73, 0x74, 0x3a, 0x66, 0x69, 0x6c, 0x65, 0x2d,
+  0x65, 0x6e, 0x74, 0x72, 0x79, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x6d,
+  0x61, 0x6e, 0x69, 0x66, 0x65, 0x73, 0x74, 0x3a, 0x6d, 0x65, 0x64, 0x69,
+  0x61, 0x2d, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x61, 0x70, 0x70, 0x6c,
+  0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76, 0x6e, 0x64, 0x2e,
+  0x6f, 0x61, 0x73, 0x69, 0x73, 0x2e, 0x6f, 0x70, 0x65, 0x6e, 0x64, 0x6f,
+  0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x22,
+  0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x6d, 0x61, 0x6e, 0x69, 0x66, 0x65,
+  0x73, 0x74, 0x3a, 0x66, 0x75, 0x6c, 0x6c, 0x2d, 0x70, 0x61, 0x74, 0x68,
+  0x3d, 0x22, 0x2f, 0x22, 0x2f, 0x3e, 0x20, 0x0a, 0x09, 0x09, 0x09, 0x09,
+  0x3c, 0x6d, 0x61, 0x6e, 0x69, 0x66, 0x65, 0x73, 0x74, 0x3a, 0x66, 0x69,
+  0x6c, 0x65, 0x2d, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x0a, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x6d, 0x61, 0x6e, 0x69, 0x66, 0x65, 0x73, 0x74, 0x3a, 0x6d,
+  0x65, 0x64, 0x69, 0x61, 0x2d, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74,
+  0x65, 0x78, 0x74, 0x2f, 0x78, 0x6d, 0x6c, 0x22, 0x0a, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x6d, 0x61, 0x6e, 0x69, 0x66, 0x65, 0x73, 0x74, 0x3a, 0x66,
+  0x75, 0x6c, 0x6c, 0x2d, 0x70, 0x61, 0x74, 0x68, 0x3d, 0x22, 0x63, 0x6f,
+  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2e, 0x78, 0x6d, 0x6c, 0x22, 0x2f, 0x3e,
+  0x20, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x6d, 0x61, 0x6e, 0x69, 0x66,
+  0x65, 0x73, 0x74, 0x3a, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x65, 0x6e, 0x74,
+  0x72, 0x79, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x6d, 0x61, 0x6e, 0x69,
+  0x66, 0x65, 0x73, 0x74, 0x3a, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2d, 0x74,
+  0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x78, 0x6d,
+  0x6c, 0x22, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x6d, 0x61, 0x6e, 0x69,
+  0x66, 0x65, 0x73, 0x74, 0x3a, 0x66, 0x75, 0x6c, 0x6c, 0x2d, 0x70, 0x61,
+  0x74, 0x68, 0x3d, 0x22, 0x6d, 0x65, 0x74, 0x61, 0x2e, 0x78, 0x6d, 0x6c,
+  0x22, 0x2f, 0x3e, 0x20, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x6d, 0x61,
+  0x6e, 0x69, 0x66, 0x65, 0x73, 0x74, 0x3a, 0x66, 0x69, 0x6c, 0x65, 0x2d,
+  0x65, 0x6e, 0x74, 0x72, 0x79, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x6d,
+  0x61, 0x6e, 0x69, 0x66, 0x65, 0x73, 0x74, 0x3a, 0x6d, 0x65, 0x64, 0x69,
+  0x61, 0x2d, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74,
+  0x2f, 0x78, 0x6d, 0x6c, 0x22, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x6d,
+  0x61, 0x6e, 0x69, 0x66, 0x65, 0x73, 0x74, 0x3a, 0x66, 0x75, 0x6c, 0x6c,
+  0x2d, 0x70, 0x61, 0x74, 0x68, 0x3d, 0x22, 0x73, 0x65, 0x74, 0x74, 0x69,
+  0x6e, 0x67, 0x73, 0x2e, 0x78, 0x6d, 0x6c, 0x22, 0x2f, 0x3e, 0x20, 0x0a,
+  0x09, 0x09, 0x09, 0x09, 0x3c, 0x6d, 0x61, 0x6e, 0x69, 0x66, 0x65, 0x73,
+  0x74, 0x3a, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x65, 0x6e, 0x74, 0x72, 0x79,
+  0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x6d, 0x61, 0x6e, 0x69, 0x66, 0x65,
+  0x73, 0x74, 0x3a, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2d, 0x74, 0x79, 0x70,
+  0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x78, 0x6d, 0x6c, 0x22,
+  0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x6d, 0x61, 0x6e, 0x69, 0x66, 0x65,
+  0x73, 0x74, 0x3a, 0x66, 0x75, 0x6c, 0x6c, 0x2d, 0x70, 0x61, 0x74, 0x68,
+  0x3d, 0x22, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x2e, 0x78, 0x6d, 0x6c,
+  0x22, 0x2f, 0x3e, 0x20, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x2f, 0x6d, 0x61,
+  0x6e, 0x69, 0x66, 0x65, 0x73, 0x74, 0x3a, 0x6d, 0x61, 0x6e, 0x69, 0x66,
+  0x65, 0x73, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x0a, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x73, 0x2e, 0x78, 0x6d, 0x6c, 0xe9, 0x2d, 0x3c, 0x3f, 0x78, 0x6d,
+  0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31,
+  0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67,
+  0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22, 0x3f, 0x3e, 0x0a, 0x09,
+  0x09, 0x09, 0x3c, 0x6f, 0x66, 0x66, 0x69, 0x63, 0x65, 0x3a, 0x64, 0x6f,
+  0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65,
+  0x73, 0x20, 0x6f, 0x66, 0x66, 0x69, 0x63, 0x65, 0x3a, 0x76, 0x65, 0x72,
+  0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x0a, 0x09,
+  0x09, 0x09, 0x09, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x65, 0x78,
+  0x74, 0x3d, 0x22, 0x75, 0x72, 0x6e, 0x3a, 0x6f, 0x61, 0x73, 0x69, 0x73,
+  0x3a, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x3a, 0x74, 0x63, 0x3a, 0x6f, 0x70,
+  0x65, 0x6e, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3a, 0x78,
+  0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x3a, 0x31, 0x2e,
+  0x30, 0x22, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+  0x3a, 0x66, 0x6f, 0x3d, 0x22, 0x75, 0x72, 0x6e, 0x3a, 0x6f, 0x61, 0x73,
+  0x69, 0x73, 0x3a, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x3a, 0x74, 0x63, 0x3a,
+  0x6f, 0x70, 0x65, 0x6e, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+  0x3a, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x73, 0x6c, 0x2d, 0x66,
+  0x6f, 0x2d, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x74, 0x69, 0x62, 0x6c, 0x65,
+  0x3a, 0x31, 0x2e, 0x30, 0x22, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x78, 0x6d,
+  0x6c, 0x6e, 0x73, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x75,
+  0x72, 0x6e, 0x3a, 0x6f, 0x61, 0x73, 0x69, 0x73, 0x3a, 0x6e, 0x61, 0x6d,
+  0x65, 0x73, 0x3a, 0x74, 0x63, 0x3a, 0x6f, 0x70, 0x65, 0x6e, 0x64, 0x6f,
+  0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3a, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+  0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x31, 0x2e, 0x30, 0x22, 0x0a,
+  0x09, 0x09, 0x09, 0x09, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x73, 0x76,
+  0x67, 0x3d, 0x22, 0x75, 0x72, 0x6e, 0x3a, 0x6f, 0x61, 0x73, 0x69, 0x73,
+  0x3a, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x3a, 0x74, 0x63, 0x3a, 0x6f, 0x70,
+  0x65, 0x6e, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3a, 0x78,
+  0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x73, 0x76, 0x67, 0x2d, 0x63, 0x6f, 0x6d,
+  0x70, 0x61, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x3a, 0x31, 0x2e, 0x30, 0x22,
+  0x0a, 0x09, 0x09, 0x09, 0x09, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x6f,
+  0x66, 0x66, 0x69, 0x63, 0x65, 0x3d, 0x22, 0x75, 0x72, 0x6e, 0x3a, 0x6f,
+  0x61, 0x73, 0x69, 0x73, 0x3a, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x3a, 0x74,
+  0x63, 0x3a, 0x6f, 0x70, 0x65, 0x6e, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65,
+  0x6e, 0x74, 0x3a, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x6f, 0x66, 0x66,
+  0x69, 0x63, 0x65, 0x3a, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x0a, 0x09, 0x09,
+  0x09, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x6f, 0x66, 0x66, 0x69,
+  0x63, 0x65, 0x3a, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x63, 0x65,
+  0x2d, 0x64, 0x65, 0x63, 0x6c, 0x73, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09,
+  0x20, 0x20, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x66, 0x6f, 0x6e,
+  0x74, 0x2d, 0x66, 0x61, 0x63, 0x65, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65,
+  0x3a, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x6f, 0x6e, 0x6f, 0x73,
+  0x70, 0x61, 0x63, 0x65, 0x22, 0x20, 0x73, 0x76, 0x67, 0x3a, 0x66, 0x6f,
+  0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3d, 0x22, 0x6d,
+  0x6f, 0x6e, 0x6f, 0x73, 0x70, 0x61, 0x63, 0x65, 0x22, 0x20, 0x73, 0x74,
+  0x79, 0x6c, 0x65, 0x3a, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d,
+  0x69, 0x6c, 0x79, 0x2d, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x69, 0x63, 0x3d,
+  0x22, 0x6d, 0x6f, 0x64, 0x65, 0x72, 0x6e, 0x22, 0x20, 0x73, 0x74, 0x79,
+  0x6c, 0x65, 0x3a, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x70, 0x69, 0x74, 0x63,
+  0x68, 0x3d, 0x22, 0x66, 0x69, 0x78, 0x65, 0x64, 0x22, 0x2f, 0x3e, 0x0a,
+  0x09, 0x09, 0x09, 0x09, 0x20, 0x20, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65,
+  0x3a, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x63, 0x65, 0x20, 0x73,
+  0x74, 0x79, 0x6c, 0x65, 0x3a, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73,
+  0x65, 0x72, 0x69, 0x66, 0x22, 0x20, 0x73, 0x76, 0x67, 0x3a, 0x66, 0x6f,
+  0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3d, 0x22, 0x73,
+  0x65, 0x72, 0x69, 0x66, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a,
+  0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x2d,
+  0x67, 0x65, 0x6e, 0x65, 0x72, 0x69, 0x63, 0x3d, 0x22, 0x72, 0x6f, 0x6d,
+  0x61, 0x6e, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x66, 0x6f,
+  0x6e, 0x74, 0x2d, 0x70, 0x69, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x76, 0x61,
+  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x09, 0x09,
+  0x09, 0x09, 0x3c, 0x2f, 0x6f, 0x66, 0x66, 0x69, 0x63, 0x65, 0x3a, 0x66,
+  0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x63, 0x65, 0x2d, 0x64, 0x65, 0x63,
+  0x6c, 0x73, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x20, 0x0a, 0x09, 0x09,
+  0x09, 0x09, 0x3c, 0x6f, 0x66, 0x66, 0x69, 0x63, 0x65, 0x3a, 0x73, 0x74,
+  0x79, 0x6c, 0x65, 0x73, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3c,
+  0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x20,
+  0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x42, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x66, 0x61, 0x6d,
+  0x69, 0x6c, 0x79, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 0x0a,
+  0x09, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x2d, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74,
+  0x69, 0x65, 0x73, 0x20, 0x66, 0x6f, 0x3a, 0x66, 0x6f, 0x6e, 0x74, 0x2d,
+  0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x62, 0x6f, 0x6c, 0x64,
+  0x22, 0x0a, 0x09, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x09, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x3a, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68,
+  0x74, 0x2d, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x78, 0x3d, 0x22, 0x62,
+  0x6f, 0x6c, 0x64, 0x22, 0x0a, 0x09, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09,
+  0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77,
+  0x65, 0x69, 0x67, 0x68, 0x74, 0x2d, 0x61, 0x73, 0x69, 0x61, 0x6e, 0x3d,
+  0x22, 0x62, 0x6f, 0x6c, 0x64, 0x22, 0x2f, 0x3e, 0x0a, 0x09, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x3c,
+  0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65,
+  0x3e, 0x0a, 0x09, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x73,
+  0x74, 0x79, 0x6c, 0x65, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x73,
+  0x74, 0x79, 0x6c, 0x65, 0x3a, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x49,
+  0x22, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x66, 0x61, 0x6d, 0x69,
+  0x6c, 0x79, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 0x0a, 0x09,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x74,
+  0x65, 0x78, 0x74, 0x2d, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x69,
+  0x65, 0x73, 0x20, 0x66, 0x6f, 0x3a, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73,
+  0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x69, 0x74, 0x61, 0x6c, 0x69, 0x63,
+  0x22, 0x0a, 0x09, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x09, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x3a, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65,
+  0x2d, 0x61, 0x73, 0x69, 0x61, 0x6e, 0x3d, 0x22, 0x69, 0x74, 0x61, 0x6c,
+  0x69, 0x63, 0x22, 0x0a, 0x09, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x73,
+  0x74, 0x79, 0x6c, 0x65, 0x3a, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x74,
+  0x79, 0x6c, 0x65, 0x2d, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x78, 0x3d,
+  0x22, 0x69, 0x74, 0x61, 0x6c, 0x69, 0x63, 0x22, 0x2f, 0x3e, 0x0a, 0x09,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x09, 0x3c, 0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x73, 0x74, 0x79,
+  0x6c, 0x65, 0x3e, 0x0a, 0x09, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65,
+  0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x55, 0x4c, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x66,
+  0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22,
+  0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x79,
+  0x6c, 0x65, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x70, 0x72, 0x6f, 0x70,
+  0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65,
+  0x3a, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x6c,
+  0x69, 0x6e, 0x65, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x73,
+  0x6f, 0x6c, 0x69, 0x64, 0x22, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x2d,
+  0x75, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x77, 0x69,
+  0x64, 0x74, 0x68, 0x3d, 0x22, 0x61, 0x75, 0x74, 0x6f, 0x22, 0x0a, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x2d, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69,
+  0x6e, 0x65, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3d, 0x22, 0x66, 0x6f,
+  0x6e, 0x74, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x22, 0x2f, 0x3e, 0x0a,
+  0x09, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x09, 0x3c, 0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x73, 0x74,
+  0x79, 0x6c, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x09, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x73,
+  0x74, 0x79, 0x6c, 0x65, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x48, 0x31, 0x22, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x09, 0x09, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x66, 0x61, 0x6d,
+  0x69, 0x6c, 0x79, 0x3d, 0x22, 0x70, 0x61, 0x72, 0x61, 0x67, 0x72, 0x61,
+  0x70, 0x68, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x63, 0x6c,
+  0x61, 0x73, 0x73, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65,
+  0x3a, 0x70, 0x61, 0x72, 0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x2d, 0x70,
+  0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x09, 0x09, 0x09, 0x66, 0x6f, 0x3a, 0x6d, 0x61, 0x72, 0x67,
+  0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x70, 0x3d, 0x22, 0x35, 0x6d, 0x6d, 0x22,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x09, 0x66, 0x6f, 0x3a, 0x6d,
+  0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d,
+  0x3d, 0x22, 0x32, 0x6d, 0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x74, 0x65,
+  0x78, 0x74, 0x2d, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65,
+  0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x09, 0x66, 0x6f, 0x3a,
+  0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x31,
+  0x35, 0x30, 0x25, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x09,
+  0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x72, 0x69, 0x66, 0x22, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x09, 0x66, 0x6f, 0x3a, 0x66, 0x6f,
+  0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x62,
+  0x6f, 0x6c, 0x64, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09,
+  0x3c, 0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x09, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x73, 0x74, 0x79,
+  0x6c, 0x65, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x48, 0x32, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09,
+  0x09, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x66, 0x61, 0x6d, 0x69, 0x6c,
+  0x79, 0x3d, 0x22, 0x70, 0x61, 0x72, 0x61, 0x67, 0x72, 0x61, 0x70, 0x68,
+  0x22, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x63, 0x6c, 0x61, 0x73,
+  0x73, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x70,
+  0x61, 0x72, 0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x2d, 0x70, 0x72, 0x6f,
+  0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x09, 0x09, 0x09, 0x66, 0x6f, 0x3a, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e,
+  0x2d, 0x74, 0x6f, 0x70, 0x3d, 0x22, 0x35, 0x6d, 0x6d, 0x22, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x09, 0x09, 0x09, 0x66, 0x6f, 0x3a, 0x6d, 0x61, 0x72,
+  0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3d, 0x22,
+  0x32, 0x6d, 0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09,
+  0x09, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x74, 0x65, 0x78, 0x74,
+  0x2d, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x09, 0x66, 0x6f, 0x3a, 0x66, 0x6f,
+  0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x31, 0x33, 0x30,
+  0x25, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x09, 0x73, 0x74,
+  0x79, 0x6c, 0x65, 0x3a, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x6e, 0x61, 0x6d,
+  0x65, 0x3d, 0x22, 0x73, 0x65, 0x72, 0x69, 0x66, 0x22, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x09, 0x09, 0x09, 0x66, 0x6f, 0x3a, 0x66, 0x6f, 0x6e, 0x74,
+  0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x62, 0x6f, 0x6c,
+  0x64, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x3c, 0x2f,
+  0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09,
+  0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65,
+  0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x48, 0x33, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x73,
+  0x74, 0x79, 0x6c, 0x65, 0x3a, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3d,
+  0x22, 0x70, 0x61, 0x72, 0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x22, 0x20,
+  0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+  0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x09, 0x09, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x70, 0x61, 0x72,
+  0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x2d, 0x70, 0x72, 0x6f, 0x70, 0x65,
+  0x72, 0x74, 0x69, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09,
+  0x09, 0x66, 0x6f, 0x3a, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x74,
+  0x6f, 0x70, 0x3d, 0x22, 0x35, 0x6d, 0x6d, 0x22, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x09, 0x09, 0x09, 0x66, 0x6f, 0x3a, 0x6d, 0x61, 0x72, 0x67, 0x69,
+  0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3d, 0x22, 0x32, 0x6d,
+  0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x3c,
+  0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x70,
+  0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x09, 0x09, 0x09, 0x66, 0x6f, 0x3a, 0x66, 0x6f, 0x6e, 0x74,
+  0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x22, 0x31, 0x31, 0x30, 0x25, 0x22,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x09, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x3a, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x73, 0x65, 0x72, 0x69, 0x66, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x09, 0x09, 0x09, 0x66, 0x6f, 0x3a, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77,
+  0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 0x62, 0x6f, 0x6c, 0x64, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x3c, 0x2f, 0x73, 0x74,
+  0x79, 0x6c, 0x65, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x09, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x3c, 0x73,
+  0x74, 0x79, 0x6c, 0x65, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x73,
+  0x74, 0x79, 0x6c, 0x65, 0x3a, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x48,
+  0x34, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x73, 0x74, 0x79,
+  0x6c, 0x65, 0x3a, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3d, 0x22, 0x70,
+  0x61, 0x72, 0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x22, 0x20, 0x73, 0x74,
+  0x79, 0x6c, 0x65, 0x3a, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x74,
+  0x65, 0x78, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09,
+  0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x67,
+  0x72, 0x61, 0x70, 0x68, 0x2d, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74,
+  0x69, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x09, 0x66,
+  0x6f, 0x3a, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x70,
+  0x3d, 0x22, 0x35, 0x6d, 0x6d, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09,
+  0x09, 0x09, 0x66, 0x6f, 0x3a, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d,
+  0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3d, 0x22, 0x32, 0x6d, 0x6d, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x3c, 0x73, 0x74,
+  0x79, 0x6c, 0x65, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x70, 0x72, 0x6f,
+  0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x09, 0x09, 0x09, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x66, 0x6f, 0x6e,
+  0x74, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x72, 0x69,
+  0x66, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x09, 0x66, 0x6f,
+  0x3a, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74,
+  0x3d, 0x22, 0x62, 0x6f, 0x6c, 0x64, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x09, 0x3c, 0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x73,
+  0x74, 0x79, 0x6c, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x09, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a,
+  0x73, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x22, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x09, 0x09, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x66, 0x61, 0x6d,
+  0x69, 0x6c, 0x79, 0x3d, 0x22, 0x70, 0x61, 0x72, 0x61, 0x67, 0x72, 0x61,
+  0x70, 0x68, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x63, 0x6c,
+  0x61, 0x73, 0x73, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65,
+  0x3a, 0x70, 0x61, 0x72, 0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x2d, 0x70,
+  0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x09, 0x09, 0x09, 0x66, 0x6f, 0x3a, 0x6d, 0x61, 0x72, 0x67,
+  0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x70, 0x3d, 0x22, 0x31, 0x2e, 0x35, 0x6d,
+  0x6d, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x09, 0x66, 0x6f,
+  0x3a, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74,
+  0x6f, 0x6d, 0x3d, 0x22, 0x31, 0x2e, 0x35, 0x6d, 0x6d, 0x22, 0x2f, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x70, 0x72, 0x6f, 0x70, 0x65,
+  0x72, 0x74, 0x69, 0x65, 0x73, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a,
+  0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73,
+  0x65, 0x72, 0x69, 0x66, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x09, 0x3c, 0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x73, 0x74, 0x79,
+  0x6c, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x09, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x73, 0x74,
+  0x79, 0x6c, 0x65, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x51, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09,
+  0x09, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x66, 0x61, 0x6d, 0x69, 0x6c,
+  0x79, 0x3d, 0x22, 0x70, 0x61, 0x72, 0x61, 0x67, 0x72, 0x61, 0x70, 0x68,
+  0x22, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x63, 0x6c, 0x61, 0x73,
+  0x73, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x70,
+  0x61, 0x72, 0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x2d, 0x70, 0x72, 0x6f,
+  0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x0a, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x66, 0x6f, 0x3a, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e,
+  0x2d, 0x74, 0x6f, 0x70, 0x3d, 0x22, 0x31, 0x2e, 0x35, 0x6d, 0x6d, 0x22,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x09, 0x66, 0x6f, 0x3a, 0x6d,
+  0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d,
+  0x3d, 0x22, 0x31, 0x2e, 0x35, 0x6d, 0x6d, 0x22, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x09, 0x09, 0x09, 0x66, 0x6f, 0x3a, 0x6d, 0x61, 0x72, 0x67, 0x69,
+  0x6e, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3d, 0x22, 0x31, 0x30, 0x6d, 0x6d,
+  0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x3c, 0x73,
+  0x74, 0x79, 0x6c, 0x65, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x70, 0x72,
+  0x6f, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x20, 0x73, 0x74, 0x79,
+  0x6c, 0x65, 0x3a, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x73, 0x65, 0x72, 0x69, 0x66, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x09, 0x3c, 0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a,
+  0x73, 0x74, 0x79, 0x6c, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65,
+  0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65,
+  0x3a, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x56, 0x22, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x09, 0x09, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x66, 0x61,
+  0x6d, 0x69, 0x6c, 0x79, 0x3d, 0x22, 0x70, 0x61, 0x72, 0x61, 0x67, 0x72,
+  0x61, 0x70, 0x68, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x63,
+  0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x2d,
+  0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x09, 0x09, 0x09, 0x66, 0x6f, 0x3a, 0x6d, 0x61, 0x72,
+  0x67, 0x69, 0x6e, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3d, 0x22, 0x31, 0x30,
+  0x6d, 0x6d, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x09, 0x66,
+  0x6f, 0x3a, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x70,
+  0x3d, 0x22, 0x30, 0x6d, 0x6d, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09,
+  0x09, 0x09, 0x66, 0x6f, 0x3a, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d,
+  0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3d, 0x22, 0x30, 0x6d, 0x6d, 0x22,
+  0x2f, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x3c, 0x73, 0x74,
+  0x79, 0x6c, 0x65, 0x3a, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x70, 0x72, 0x6f,
+  0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x20, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x3a, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+  0x22, 0x73, 0x65, 0x72, 0x69, 0x66, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x09, 0x3c, 0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x73,
+  0x74, 0x79, 0x6c, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x09, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a,
+  0x73, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x50, 0x52, 0x45, 0x22, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x09, 0x09, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x66,
+  0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3d, 0x22, 0x70, 0x61, 0x72, 0x61, 0x67,
+  0x72, 0x61, 0x70, 0x68, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a,
+  0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x79,
+  0x6c, 0x65, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x67, 0x72, 0x61, 0x70, 0x68,
+  0x2d, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x09, 0x66, 0x6f, 0x3a, 0x6d, 0x61,
+  0x72, 0x67, 0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x70, 0x3d, 0x22, 0x30, 0x6d,
+  0x6d, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x09, 0x66, 0x6f,
+  0x3a, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74,
+  0x6f, 0x6d, 0x3d, 0x22, 0x30, 0x6d, 0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a,
+  0x74, 0x65, 0x78, 0x74, 0x2d, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74,
+  0x69, 0x65, 0x73, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x66, 0x6f,
+  0x6e, 0x74, 0x2d, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x6f, 0x6e,
+  0x6f, 0x73, 0x70, 0x61, 0x63, 0x65, 0x22, 0x2f, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x09, 0x3c, 0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x73,
+  0x74, 0x79, 0x6c, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x09, 0x3c, 0x74, 0x65, 0x78, 0x74, 0x3a, 0x6c,
+  0x69, 0x73, 0x74, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x73, 0x74,
+  0x79, 0x6c, 0x65, 0x3a, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x42,
+  0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x3c, 0x74, 0x65,
+  0x78, 0x74, 0x3a, 0x6c, 0x69, 0x73, 0x74, 0x2d, 0x6c, 0x65, 0x76, 0x65,
+  0x6c, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2d, 0x62, 0x75, 0x6c, 0x6c,
+  0x65, 0x74, 0x20, 0x74, 0x65, 0x78, 0x74, 0x3a, 0x6c, 0x65, 0x76, 0x65,
+  0x6c, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x65, 0x78, 0x74, 0x3a, 0x62,
+  0x75, 0x6c, 0x6c, 0x65, 0x74, 0x2d, 0x63, 0x68, 0x61, 0x72, 0x3d, 0x22,
+  0xe2, 0x80, 0xa2, 0x22, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x6c, 0x69, 0x73, 0x74,
+  0x2d, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x2d, 0x70, 0x72, 0x6f, 0x70, 0x65,
+  0x72, 0x74, 0x69, 0x65, 0x73, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x74, 0x65, 0x78, 0x74, 0x3a, 0x73, 0x70, 0x61, 0x63, 0x65,
+  0x2d, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x3d, 0x22, 0x35, 0x6d, 0x6d,
+  0x22, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x74, 0x65,
+  0x78, 0x74, 0x3a, 0x6d, 0x69, 0x6e, 0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c,
+  0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x35, 0x6d, 0x6d, 0x22,
+  0x2f, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x2f, 0x74,
+  0x65, 0x78, 0x74, 0x3a, 0x6c, 0x69, 0x73, 0x74, 0x2d, 0x6c, 0x65, 0x76,
+  0x65, 0x6c, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2d, 0x62, 0x75, 0x6c,
+  0x6c, 0x65, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x3c, 0x2f,
+  0x74, 0x65, 0x78, 0x74, 0x3a, 0x6c, 0x69, 0x73, 0x74, 0x2d, 0x73, 0x74,
+  0x79, 0x6c, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x09, 0x3c, 0x74, 0x65, 0x78, 0x74, 0x3a, 0x6c, 0x69,
+  0x73, 0x74, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x73, 0x74, 0x79,
+  0x6c, 0x65, 0x3a, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x4e, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x3c, 0x74, 0x65, 0x78,
+  0x74, 0x3a, 0x6c, 0x69, 0x73, 0x74, 0x2d, 0x6c, 0x65, 0x76, 0x65, 0x6c,
+  0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2d, 0x6e, 0x75, 0x6d, 0x62, 0x65,
+  0x72, 0x20, 0x74, 0x65, 0x78, 0x74, 0x3a, 0x6c, 0x65, 0x76, 0x65, 0x6c,
+  0x3d, 0x22, 0x31, 0x22, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x6c, 0x69, 0x73, 0x74,
+  0x2d, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x2d, 0x70, 0x72, 0x6f, 0x70, 0x65,
+  0x72, 0x74, 0x69, 0x65, 0x73, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x74, 0x65, 0x78, 0x74, 0x3a, 0x73, 0x70, 0x61, 0x63, 0x65,
+  0x2d, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x3d, 0x22, 0x35, 0x6d, 0x6d,
+  0x22, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x74, 0x65,
+  0x78, 0x74, 0x3a, 0x6d, 0x69, 0x6e, 0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c,
+  0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x35, 0x6d, 0x6d, 0x22,
+  0x2f, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x2f, 0x74,
+  0x65, 0x78, 0x74, 0x3a, 0x6c, 0x69, 0x73, 0x74, 0x2d, 0x6c, 0x65, 0x76,
+  0x65, 0x6c, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2d, 0x6e, 0x75, 0x6d,
+  0x62, 0x65, 0x72, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x3c, 0x2f,
+  0x74, 0x65, 0x78, 0x74, 0x3a, 0x6c, 0x69, 0x73, 0x74, 0x2d, 0x73, 0x74,
+  0x79, 0x6c, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x09, 0x3c, 0x74, 0x65, 0x78, 0x74, 0x3a, 0x6c, 0x69,
+  0x73, 0x74, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x73, 0x74, 0x79,
+  0x6c, 0x65, 0x3a, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x4c, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x09, 0x3c, 0x74, 0x65, 0x78, 0x74,
+  0x3a, 0x6c, 0x69, 0x73, 0x74, 0x2d, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x2d,
+  0x73, 0x74, 0x79, 0x6c, 0x65, 0x2d, 0x62, 0x75, 0x6c, 0x6c, 0x65, 0x74,
+  0x20, 0x74, 0x65, 0x78, 0x74, 0x3a, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x3d,
+  0x22, 0x31, 0x22, 0x20, 0x74, 0x65, 0x78, 0x74, 0x3a, 0x62, 0x75, 0x6c,
+  0x6c, 0x65, 0x74, 0x2d, 0x63, 0x68, 0x61, 0x72, 0x3d, 0x22, 0x20, 0x22,
+  0x3e, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x73, 0x74,
+  0x79, 0x6c, 0x65, 0x3a, 0x6c, 0x69, 0x73, 0x74, 0x2d, 0x6c, 0x65, 0x76,
+  0x65, 0x6c, 0x2d, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65,
+  0x73, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x74, 0x65,
+  0x78, 0x74, 0x3a, 0x73, 0x70, 0x61, 0x63, 0x65, 0x2d, 0x62, 0x65, 0x66,
+  0x6f, 0x72, 0x65, 0x3d, 0x22, 0x35, 0x6d, 0x6d, 0x22, 0x0a, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x74, 0x65, 0x78, 0x74, 0x3a, 0x6d,
+  0x69, 0x6e, 0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2d, 0x77, 0x69, 0x64,
+  0x74, 0x68, 0x3d, 0x22, 0x35, 0x6d, 0x6d, 0x22, 0x2f, 0x3e, 0x0a, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x3a,
+  0x6c, 0x69, 0x73, 0x74, 0x2d, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x2d, 0x73,
+  0x74, 0x79, 0x6c, 0x65, 0x2d, 0x62, 0x75, 0x6c, 0x6c, 0x65, 0x74, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x3c, 0x2f, 0x74, 0x65, 0x78, 0x74,
+  0x3a, 0x6c, 0x69, 0x73, 0x74, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3e,
+  0x0a, 0x09, 0x09, 0x09, 0x09, 0x3c, 0x2f, 0x6f, 0x66, 0x66, 0x69, 0x63,
+  0x65, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x3e, 0x0a, 0x09, 0x09,
+  0x09, 0x3c, 0x2f, 0x6f, 0x66, 0x66, 0x69, 0x63, 0x65, 0x3a, 0x64, 0x6f,
+  0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65,
+  0x73, 0x3e, 0x0a, 0x09, 0x09, 0x0c, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e,
+  0x67, 0x73, 0x2e, 0x78, 0x6d, 0x6c, 0xa1, 0x01, 0x3c, 0x3f, 0x78, 0x6d,
+  0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31,
+  0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67,
+  0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22, 0x3f, 0x3e, 0x0a, 0x09,
+  0x09, 0x09, 0x3c, 0x6f, 0x66, 0x66, 0x69, 0x63, 0x65, 0x3a, 0x64, 0x6f,
+  0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2d, 0x73, 0x65, 0x74, 0x74, 0x69,
+  0x6e, 0x67, 0x73, 0x20, 0x6f, 0x66, 0x66, 0x69, 0x63, 0x65, 0x3a, 0x76,
+  0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22,
+  0x0a, 0x09, 0x09, 0x09, 0x09, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x6f,
+  0x66, 0x66, 0x69, 0x63, 0x65, 0x3d, 0x22, 0x75, 0x72, 0x6e, 0x3a, 0x6f,
+  0x61, 0x73, 0x69, 0x73, 0x3a, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x3a, 0x74,
+  0x63, 0x3a, 0x6f, 0x70, 0x65, 0x6e, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65,
+  0x6e, 0x74, 0x3a, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x6f, 0x66, 0x66,
+  0x69, 0x63, 0x65, 0x3a, 0x31, 0x2e, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x09,
+  0x09, 0x08, 0x6d, 0x65, 0x74, 0x61, 0x2e, 0x78, 0x6d, 0x6c, 0x9d, 0x01,
+  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f,
+  0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22,
+  0x3f, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6f, 0x66, 0x66, 0x69, 0x63,
+  0x65, 0x3a, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2d, 0x6d,
+  0x65, 0x74, 0x61, 0x20, 0x6f, 0x66, 0x66, 0x69, 0x63, 0x65, 0x3a, 0x76,
+  0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22,
+  0x0a, 0x09, 0x09, 0x09, 0x09, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x6f,
+  0x66, 0x66, 0x69, 0x63, 0x65, 0x3d, 0x22, 0x75, 0x72, 0x6e, 0x3a, 0x6f,
+  0x61, 0x73, 0x69, 0x73, 0x3a, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x3a, 0x74,
+  0x63, 0x3a, 0x6f, 0x70, 0x65, 0x6e, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65,
+  0x6e, 0x74, 0x3a, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x6f, 0x66, 0x66,
+  0x69, 0x63, 0x65, 0x3a, 0x31, 0x2e, 0x30, 0x22, 0x2f, 0x3e, 0x0a, 0x09,
+  0x09, 0x10, 0x49, 0x6d, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x4d,
+  0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x0c, 0x45, 0x78, 0x70, 0x6f, 0x72,
+  0x74, 0x69, 0x6e, 0x67, 0x2e, 0x2e, 0x2e, 0x0c, 0x4d, 0x6f, 0x64, 0x61,
+  0x6c, 0x4d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x1f, 0x55, 0x6e, 0x61,
+  0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x6f, 0x70, 0x65, 0x6e, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x66,
+  0x69, 0x6c, 0x65, 0x2e, 0x0b, 0x51, 0x75, 0x65, 0x75, 0x65, 0x52, 0x65,
+  0x64, 0x72, 0x61, 0x77, 0x06, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x05,
+  0x62, 0x65, 0x67, 0x69, 0x6e, 0x0b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
+  0x74, 0x2e, 0x78, 0x6d, 0x6c, 0x05, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x20,
+  0x55, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x77, 0x72,
+  0x69, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x70,
+  0x75, 0x74, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x12, 0x65, 0x78, 0x70,
+  0x6f, 0x72, 0x74, 0x5f, 0x6f, 0x64, 0x74, 0x5f, 0x77, 0x69, 0x74, 0x68,
+  0x5f, 0x75, 0x69, 0x0f, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x4f,
+  0x44, 0x54, 0x20, 0x46, 0x69, 0x6c, 0x65, 0x04, 0x2e, 0x6f, 0x64, 0x74,
+  0x0d, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x4f, 0x44, 0x54, 0x46, 0x69,
+  0x6c, 0x65, 0x0e, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x54, 0x6f, 0x53,
+  0x74, 0x72, 0x69, 0x6e, 0x67, 0x11, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74,
+  0x54, 0x6f, 0x4f, 0x44, 0x54, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x05,
+  0x74, 0x61, 0x62, 0x6c, 0x65, 0x06, 0x63, 0x6f, 0x6e, 0x63, 0x61, 0x74,
+  0x02, 0x77, 0x67, 0x09, 0x7a, 0x69, 0x70, 0x77, 0x72, 0x69, 0x74, 0x65,
+  0x72, 0x06, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x06, 0x66, 0x6f, 0x72,
+  0x6d, 0x61, 0x74, 0x0a, 0x65, 0x73, 0x63, 0x61, 0x70, 0x65, 0x68, 0x74,
+  0x6d, 0x6c, 0x09, 0x3c, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x3a, 0x68, 0x3e,
+  0x02, 0x48, 0x31, 0x02, 0x48, 0x32, 0x02, 0x48, 0x33, 0x02, 0x48, 0x34,
+  0x1c, 0x3c, 0x74, 0x65, 0x78, 0x74, 0x3a, 0x70, 0x20, 0x74, 0x65, 0x78,
+  0x74, 0x3a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2d, 0x6e, 0x61, 0x6d, 0x65,
+  0x3d, 0x22, 0x50, 0x22, 0x3e, 0x09, 0x3c, 0x2f, 0x74, 0x65, 0x78, 0x74,
+  0x3a, 0x70, 0x3e, 0x01, 0x50, 0x26, 0x3c, 0x2f, 0x74, 0x65, 0x78, 0x74,
+  0x3a, 0x70, 0x3e, 0x3c, 0x2f, 0x74, 0x65, 0x78, 0x74, 0x3a, 0x6c, 0x69,
+  0x73, 0x74, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x3e, 0x3c, 0x2f, 0x74, 0x65,
+  0x78, 0x74, 0x3a, 0x6c, 0x69, 0x73, 0x74, 0x3e, 0x01, 0x4c, 0x02, 0x4c,
+  0x42, 0x02, 0x4c, 0x4e, 0x01, 0x51, 0x01, 0x56, 0x03, 0x52, 0x41, 0x57,
+  0x03, 0x50, 0x52, 0x45, 0x03, 0x43, 0x6d, 0x64, 0x21, 0x04, 0x01, 0x01,
+  0x00, 0x00, 0x00, 0x05, 0x09, 0x01, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00,
+  0x05, 0x03, 0x00, 0x00, 0x15, 0x01, 0x03, 0x00, 0x16, 0x01, 0x00, 0x00,
+  0x01, 0x03, 0x01, 0x00, 0x0f, 0x02, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x09, 0x01, 0x00, 0x00, 0x16, 0x01, 0x02, 0x00, 0x00, 0x00, 0x14,
+  0x00, 0x01, 0x18, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x13, 0x01, 0x00, 0x00, 0x46, 0x00, 0x00,
+  0x00, 0x16, 0x01, 0x02, 0x00, 0x00, 0x01, 0x01, 0x13, 0x03, 0x01, 0x18,
+  0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x06, 0x09, 0x01, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x0f,
+  0x03, 0x00, 0x9a, 0x01, 0x00, 0x00, 0x00, 0x15, 0x01, 0x03, 0x00, 0x16,
+  0x01, 0x00, 0x00, 0x02, 0x03, 0x04, 0x03, 0x05, 0x00, 0x18, 0x00, 0x01,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x46,
+  0x02, 0x00, 0x00, 0x16, 0x00, 0x02, 0x00, 0x01, 0x06, 0x03, 0x01, 0x03,
+  0x17, 0x06, 0x01, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x01, 0x01, 0x00, 0x00, 0x00, 0x06, 0x09, 0x01, 0x00, 0x00, 0x05,
+  0x02, 0x00, 0x00, 0x0f, 0x03, 0x00, 0x9a, 0x01, 0x00, 0x00, 0x00, 0x15,
+  0x01, 0x03, 0x00, 0x16, 0x01, 0x00, 0x00, 0x02, 0x03, 0x07, 0x03, 0x05,
+  0x00, 0x1e, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x40,
+  0x00, 0x00, 0x00, 0x46, 0x02, 0x00, 0x00, 0x16, 0x00, 0x02, 0x00, 0x01,
+  0x06, 0x05, 0x01, 0x05, 0x1d, 0x08, 0x01, 0x18, 0x00, 0x00, 0x00, 0x1e,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x01, 0x00, 0x00, 0x00, 0x10, 0x09,
+  0x01, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x0f, 0x03, 0x00, 0x9a, 0x01,
+  0x00, 0x00, 0x00, 0x0f, 0x05, 0x00, 0x60, 0x02, 0x00, 0x00, 0x00, 0x1a,
+  0x05, 0x06, 0x00, 0x09, 0x04, 0x00, 0x00, 0x05, 0x05, 0x03, 0x00, 0x0f,
+  0x06, 0x00, 0x60, 0x02, 0x00, 0x00, 0x00, 0x15, 0x04, 0x03, 0x02, 0x19,
+  0x04, 0x01, 0x00, 0x05, 0x04, 0x04, 0x00, 0x15, 0x01, 0x04, 0x00, 0x16,
+  0x01, 0x00, 0x00, 0x05, 0x03, 0x09, 0x03, 0x05, 0x03, 0x0a, 0x03, 0x0b,
+  0x03, 0x0c, 0x00, 0x24, 0x00, 0x01, 0x18, 0x00, 0x00, 0x01, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x25,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x40,
+  0x00, 0x00, 0x00, 0x46, 0x02, 0x00, 0x00, 0x16, 0x00, 0x02, 0x00, 0x01,
+  0x06, 0x07, 0x01, 0x07, 0x23, 0x0d, 0x01, 0x18, 0x00, 0x00, 0x00, 0x24,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x03, 0x00, 0x00, 0x00, 0x26, 0x06,
+  0x01, 0x00, 0x00, 0x1a, 0x01, 0x02, 0x00, 0x0f, 0x01, 0x00, 0x9a, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x03, 0x00, 0x00, 0x09, 0x04, 0x01, 0x00, 0x0d,
+  0x02, 0x03, 0x04, 0x09, 0x04, 0x00, 0x00, 0x0d, 0x03, 0x04, 0x01, 0x09,
+  0x04, 0x01, 0x00, 0x1e, 0x01, 0x06, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1a,
+  0x01, 0x04, 0x00, 0x11, 0x04, 0x02, 0x00, 0x1a, 0x04, 0x02, 0x00, 0x11,
+  0x04, 0x03, 0x00, 0x19, 0x04, 0x11, 0x00, 0x1a, 0x02, 0x05, 0x00, 0x09,
+  0x04, 0x02, 0x00, 0x11, 0x05, 0x02, 0x02, 0x06, 0x06, 0x00, 0x00, 0x15,
+  0x05, 0x02, 0x00, 0x15, 0x04, 0x00, 0x01, 0x09, 0x04, 0x02, 0x00, 0x05,
+  0x05, 0x01, 0x00, 0x15, 0x04, 0x02, 0x01, 0x1a, 0x03, 0x05, 0x00, 0x09,
+  0x04, 0x02, 0x00, 0x11, 0x05, 0x03, 0x01, 0x06, 0x06, 0x00, 0x00, 0x15,
+  0x05, 0x02, 0x00, 0x15, 0x04, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x00, 0x16,
+  0x00, 0x01, 0x00, 0x09, 0x04, 0x02, 0x00, 0x05, 0x05, 0x01, 0x00, 0x15,
+  0x04, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00, 0x02, 0x03, 0x05, 0x03, 0x0e,
+  0x00, 0x42, 0x0f, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x02, 0x43, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x04, 0x0f, 0x01, 0x00, 0x9a, 0x00,
+  0x00, 0x00, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0x01,
+  0x03, 0x05, 0x00, 0x5d, 0x10, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01, 0x5e,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x09,
+  0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x15, 0x00, 0x02, 0x01, 0x16,
+  0x00, 0x01, 0x00, 0x01, 0x03, 0x11, 0x00, 0x61, 0x12, 0x01, 0x18, 0x00,
+  0x01, 0xff, 0x0b, 0x62, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x08, 0x07, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x01, 0x00, 0x00, 0x15, 0x00, 0x02, 0x01, 0x09, 0x00, 0x00, 0x00, 0x05,
+  0x01, 0x01, 0x00, 0x15, 0x00, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00, 0x02,
+  0x03, 0x0f, 0x03, 0x13, 0x00, 0x6f, 0x14, 0x01, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x70, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x09, 0x01, 0x00, 0x00, 0x06, 0x02, 0x00,
+  0x00, 0x15, 0x01, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00, 0x00, 0x00, 0x74,
+  0x15, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01, 0x75, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x01, 0x02, 0x00, 0x00, 0x00, 0x06, 0x09, 0x01, 0x00, 0x00, 0x09,
+  0x02, 0x01, 0x00, 0x06, 0x03, 0x00, 0x00, 0x15, 0x02, 0x02, 0x00, 0x15,
+  0x01, 0x00, 0x01, 0x16, 0x00, 0x01, 0x00, 0x00, 0x00, 0x78, 0x16, 0x01,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x79, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x16, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x7c, 0x17, 0x01, 0x18, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x05, 0x01,
+  0x00, 0x00, 0x15, 0x00, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03,
+  0x18, 0x00, 0x7f, 0x19, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x09, 0x00,
+  0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x15, 0x00, 0x02, 0x01, 0x16, 0x00,
+  0x01, 0x00, 0x01, 0x03, 0x1a, 0x00, 0x83, 0x01, 0x1b, 0x01, 0x18, 0x00,
+  0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x15,
+  0x00, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x1c, 0x00, 0x87,
+  0x01, 0x1d, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00,
+  0x05, 0x01, 0x00, 0x00, 0x15, 0x00, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00,
+  0x01, 0x03, 0x1a, 0x00, 0x8b, 0x01, 0x1e, 0x01, 0x18, 0x00, 0x00, 0x00,
+  0x01, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x09, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x15, 0x00, 0x02,
+  0x01, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x1f, 0x00, 0x8f, 0x01, 0x20,
+  0x01, 0x18, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x05, 0x01,
+  0x00, 0x00, 0x15, 0x00, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03,
+  0x1a, 0x00, 0x93, 0x01, 0x21, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01, 0x94,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x16,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x97, 0x01, 0x22, 0x01, 0x18, 0x00, 0x98,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x16,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x9a, 0x01, 0x23, 0x01, 0x18, 0x00, 0x9b,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x07,
+  0x01, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00, 0x15,
+  0x01, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x0f, 0x00, 0x9d,
+  0x01, 0x24, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9e, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x16, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0xa1, 0x01, 0x25, 0x01, 0x18, 0x00, 0xa2, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x02, 0x02, 0x00, 0x00, 0x00, 0x55, 0x0c, 0x02, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x05, 0x03, 0x02, 0x00, 0x06, 0x04, 0x00,
+  0x00, 0x15, 0x02, 0x03, 0x02, 0x0f, 0x00, 0x02, 0xdc, 0x03, 0x00, 0x00,
+  0x00, 0x0c, 0x03, 0x07, 0x00, 0x06, 0x14, 0x40, 0xc0, 0x02, 0x04, 0x00,
+  0x00, 0x13, 0x05, 0x00, 0x00, 0x46, 0x02, 0x00, 0x00, 0x46, 0x01, 0x04,
+  0x00, 0x46, 0x01, 0x00, 0x00, 0x08, 0x05, 0x00, 0xa9, 0x08, 0x00, 0x00,
+  0x00, 0x0c, 0x05, 0x0a, 0x00, 0x00, 0x00, 0x90, 0x40, 0x06, 0x06, 0x01,
+  0x00, 0x36, 0x07, 0x1c, 0x00, 0x10, 0x02, 0x07, 0xa3, 0x0b, 0x00, 0x00,
+  0x00, 0x13, 0x08, 0x01, 0x00, 0x46, 0x01, 0x04, 0x00, 0x10, 0x08, 0x07,
+  0xba, 0x0c, 0x00, 0x00, 0x00, 0x13, 0x08, 0x02, 0x00, 0x46, 0x01, 0x00,
+  0x00, 0x10, 0x08, 0x07, 0xac, 0x0d, 0x00, 0x00, 0x00, 0x13, 0x08, 0x03,
+  0x00, 0x46, 0x01, 0x00, 0x00, 0x10, 0x08, 0x07, 0xcd, 0x0e, 0x00, 0x00,
+  0x00, 0x13, 0x08, 0x04, 0x00, 0x46, 0x01, 0x00, 0x00, 0x10, 0x08, 0x07,
+  0x06, 0x0f, 0x00, 0x00, 0x00, 0x13, 0x08, 0x05, 0x00, 0x46, 0x01, 0x00,
+  0x00, 0x46, 0x02, 0x01, 0x00, 0x10, 0x08, 0x07, 0xd5, 0x10, 0x00, 0x00,
+  0x00, 0x40, 0x08, 0x1d, 0x00, 0x10, 0x08, 0x07, 0x14, 0x11, 0x00, 0x00,
+  0x00, 0x13, 0x08, 0x07, 0x00, 0x46, 0x01, 0x00, 0x00, 0x10, 0x08, 0x07,
+  0xea, 0x12, 0x00, 0x00, 0x00, 0x13, 0x08, 0x08, 0x00, 0x46, 0x01, 0x00,
+  0x00, 0x10, 0x08, 0x07, 0x49, 0x13, 0x00, 0x00, 0x00, 0x13, 0x08, 0x09,
+  0x00, 0x46, 0x01, 0x00, 0x00, 0x10, 0x08, 0x07, 0x80, 0x14, 0x00, 0x00,
+  0x00, 0x13, 0x08, 0x0a, 0x00, 0x46, 0x01, 0x00, 0x00, 0x10, 0x08, 0x07,
+  0x41, 0x15, 0x00, 0x00, 0x00, 0x13, 0x08, 0x0b, 0x00, 0x46, 0x01, 0x00,
+  0x00, 0x10, 0x08, 0x07, 0xc1, 0x16, 0x00, 0x00, 0x00, 0x13, 0x08, 0x0c,
+  0x00, 0x46, 0x01, 0x00, 0x00, 0x10, 0x08, 0x07, 0x96, 0x17, 0x00, 0x00,
+  0x00, 0x40, 0x08, 0x1e, 0x00, 0x10, 0x08, 0x07, 0x12, 0x18, 0x00, 0x00,
+  0x00, 0x40, 0x08, 0x1f, 0x00, 0x10, 0x08, 0x07, 0xc6, 0x19, 0x00, 0x00,
+  0x00, 0x40, 0x08, 0x20, 0x00, 0x10, 0x08, 0x07, 0x69, 0x1a, 0x00, 0x00,
+  0x00, 0x40, 0x08, 0x21, 0x00, 0x10, 0x08, 0x07, 0x13, 0x1b, 0x00, 0x00,
+  0x00, 0x15, 0x05, 0x03, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x16, 0x05, 0x00,
+  0x00, 0x22, 0x03, 0x26, 0x04, 0x00, 0x00, 0x00, 0x40, 0x03, 0x27, 0x03,
+  0x28, 0x03, 0x29, 0x03, 0x2a, 0x03, 0x2b, 0x04, 0x06, 0x14, 0x40, 0xc0,
+  0x03, 0x0f, 0x03, 0x2c, 0x04, 0x00, 0x00, 0x90, 0x40, 0x03, 0x2d, 0x03,
+  0x10, 0x03, 0x12, 0x03, 0x14, 0x03, 0x15, 0x03, 0x16, 0x03, 0x17, 0x03,
+  0x19, 0x03, 0x1b, 0x03, 0x1d, 0x03, 0x1e, 0x03, 0x20, 0x03, 0x21, 0x03,
+  0x22, 0x03, 0x23, 0x03, 0x24, 0x03, 0x25, 0x05, 0x11, 0x0b, 0x0c, 0x0d,
+  0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+  0x1a, 0x1b, 0x06, 0x0f, 0x06, 0x16, 0x06, 0x17, 0x06, 0x18, 0x06, 0x19,
+  0x11, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13,
+  0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x3b, 0x2e, 0x01, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x00, 0x01, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x3c,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x10, 0x09,
+  0x00, 0x00, 0x00, 0x1a, 0x00, 0x07, 0x00, 0x09, 0x00, 0x01, 0x00, 0x09,
+  0x02, 0x02, 0x00, 0x09, 0x03, 0x03, 0x00, 0x15, 0x02, 0x02, 0x00, 0x14,
+  0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x02, 0x0a,
+  0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+  0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x04, 0x00, 0x16,
+  0x00, 0x01, 0x00, 0x01, 0x03, 0x2f, 0x00, 0xff, 0x02, 0x30, 0x01, 0x18,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0x05, 0x01, 0x05,
+  0x00, 0x00, 0x00, 0x1d, 0x09, 0x01, 0x00, 0x00, 0x09, 0x04, 0x00, 0x00,
+  0x34, 0x03, 0x04, 0x00, 0x27, 0x02, 0x03, 0x00, 0x0e, 0x00, 0x01, 0x02,
+  0x09, 0x02, 0x01, 0x00, 0x34, 0x03, 0x00, 0x00, 0x21, 0x01, 0x02, 0x03,
+  0x0a, 0x01, 0x01, 0x00, 0x09, 0x01, 0x01, 0x00, 0x05, 0x02, 0x01, 0x00,
+  0x1f, 0x02, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x01, 0x02, 0x00,
+  0x1a, 0x01, 0x07, 0x00, 0x09, 0x01, 0x03, 0x00, 0x09, 0x03, 0x04, 0x00,
+  0x09, 0x04, 0x00, 0x00, 0x15, 0x03, 0x02, 0x00, 0x14, 0x01, 0x01, 0xd2,
+  0x02, 0x00, 0x00, 0x00, 0x15, 0x01, 0x00, 0x02, 0x0a, 0x01, 0x02, 0x00,
+  0x35, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x01, 0x00, 0x00,
+  0x04, 0x01, 0x00, 0x00, 0x0a, 0x01, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00,
+  0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x40, 0x03, 0x2f, 0x00, 0x84, 0x03,
+  0x00, 0x01, 0x18, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x08, 0x80, 0x01, 0x00, 0x00,
+  0x00, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x00, 0xb3, 0x01, 0x19, 0x00, 0x2b,
+  0x00, 0x0c, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x80, 0x1a, 0x00, 0x10,
+  0x00, 0x05, 0x05, 0x03, 0x00, 0x14, 0x03, 0x00, 0x56, 0x04, 0x00, 0x00,
+  0x00, 0x15, 0x03, 0x03, 0x02, 0x19, 0x03, 0x04, 0x00, 0x06, 0x03, 0x00,
+  0x00, 0x06, 0x04, 0x02, 0x00, 0x31, 0x00, 0x03, 0x04, 0x17, 0x00, 0x08,
+  0x00, 0x05, 0x05, 0x03, 0x00, 0x06, 0x06, 0x02, 0x00, 0x14, 0x03, 0x00,
+  0xcc, 0x05, 0x00, 0x00, 0x00, 0x15, 0x03, 0x04, 0x02, 0x06, 0x00, 0x03,
+  0x00, 0x17, 0x00, 0x01, 0x00, 0x05, 0x00, 0x06, 0x00, 0x0c, 0x03, 0x08,
+  0x00, 0x00, 0x00, 0x70, 0x40, 0x06, 0x04, 0x01, 0x00, 0x05, 0x05, 0x09,
+  0x00, 0x03, 0x06, 0x01, 0x00, 0x06, 0x07, 0x00, 0x00, 0x15, 0x03, 0x05,
+  0x02, 0x19, 0x03, 0x02, 0x00, 0x03, 0x04, 0x00, 0x00, 0x16, 0x04, 0x02,
+  0x00, 0x49, 0x01, 0x03, 0x03, 0x06, 0x05, 0x03, 0x00, 0x0c, 0x04, 0x0b,
+  0x00, 0x00, 0x00, 0xa0, 0x40, 0x15, 0x04, 0x02, 0x01, 0x05, 0x06, 0x0c,
+  0x00, 0x14, 0x04, 0x03, 0x56, 0x04, 0x00, 0x00, 0x00, 0x15, 0x04, 0x03,
+  0x02, 0x1a, 0x04, 0x03, 0x00, 0x06, 0x04, 0x03, 0x00, 0x06, 0x05, 0x02,
+  0x00, 0x31, 0x03, 0x04, 0x05, 0x35, 0x03, 0x00, 0x00, 0x05, 0x00, 0x00,
+  0x00, 0x35, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x05, 0x0d,
+  0x00, 0x05, 0x06, 0x0e, 0x00, 0x05, 0x07, 0x0f, 0x00, 0x37, 0x04, 0x05,
+  0x04, 0x01, 0x00, 0x00, 0x00, 0x35, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x05, 0x06, 0x10, 0x00, 0x05, 0x07, 0x11, 0x00, 0x37, 0x05, 0x06,
+  0x03, 0x01, 0x00, 0x00, 0x00, 0x35, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x05, 0x07, 0x12, 0x00, 0x05, 0x08, 0x13, 0x00, 0x37, 0x06, 0x07,
+  0x03, 0x01, 0x00, 0x00, 0x00, 0x35, 0x07, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x05, 0x08, 0x14, 0x00, 0x05, 0x09, 0x15, 0x00, 0x37, 0x07, 0x08,
+  0x03, 0x01, 0x00, 0x00, 0x00, 0x35, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x05, 0x09, 0x16, 0x00, 0x05, 0x0a, 0x17, 0x00, 0x37, 0x08, 0x09,
+  0x03, 0x01, 0x00, 0x00, 0x00, 0x37, 0x03, 0x04, 0x06, 0x01, 0x00, 0x00,
+  0x00, 0x0c, 0x04, 0x19, 0x00, 0x00, 0x00, 0x80, 0x41, 0x05, 0x05, 0x1a,
+  0x00, 0x15, 0x04, 0x02, 0x01, 0x09, 0x04, 0x00, 0x00, 0x06, 0x05, 0x00,
+  0x00, 0x15, 0x04, 0x02, 0x02, 0x19, 0x04, 0x0a, 0x00, 0x0c, 0x05, 0x1c,
+  0x00, 0x00, 0x00, 0xb0, 0x41, 0x02, 0x06, 0x00, 0x00, 0x05, 0x07, 0x1d,
+  0x00, 0x15, 0x05, 0x03, 0x01, 0x0c, 0x05, 0x1f, 0x00, 0x00, 0x00, 0xe0,
+  0x41, 0x15, 0x05, 0x01, 0x01, 0x03, 0x05, 0x00, 0x00, 0x16, 0x05, 0x02,
+  0x00, 0x03, 0x05, 0x01, 0x00, 0x0c, 0x06, 0x21, 0x00, 0x00, 0x00, 0x00,
+  0x42, 0x06, 0x07, 0x03, 0x00, 0x15, 0x06, 0x02, 0x04, 0x3b, 0x06, 0x0d,
+  0x00, 0x06, 0x0b, 0x05, 0x00, 0x1a, 0x0b, 0x0a, 0x00, 0x11, 0x0d, 0x0a,
+  0x00, 0x11, 0x0e, 0x0a, 0x02, 0x14, 0x0b, 0x04, 0x98, 0x22, 0x00, 0x00,
+  0x00, 0x15, 0x0b, 0x04, 0x02, 0x1a, 0x0b, 0x04, 0x00, 0x11, 0x0d, 0x0a,
+  0x01, 0x14, 0x0b, 0x04, 0xd2, 0x23, 0x00, 0x00, 0x00, 0x15, 0x0b, 0x03,
+  0x02, 0x06, 0x05, 0x0b, 0x00, 0x3a, 0x06, 0xf2, 0xff, 0x02, 0x00, 0x00,
+  0x80, 0x06, 0x06, 0x05, 0x00, 0x1a, 0x06, 0x04, 0x00, 0x05, 0x08, 0x24,
+  0x00, 0x14, 0x06, 0x04, 0x98, 0x22, 0x00, 0x00, 0x00, 0x15, 0x06, 0x03,
+  0x02, 0x06, 0x05, 0x06, 0x00, 0x35, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x07, 0x00, 0x00, 0x13, 0x08, 0x00, 0x00, 0x46, 0x01, 0x05,
+  0x00, 0x46, 0x00, 0x04, 0x00, 0x46, 0x02, 0x01, 0x00, 0x46, 0x01, 0x06,
+  0x00, 0x46, 0x01, 0x07, 0x00, 0x13, 0x09, 0x01, 0x00, 0x46, 0x01, 0x06,
+  0x00, 0x46, 0x01, 0x07, 0x00, 0x46, 0x01, 0x05, 0x00, 0x46, 0x00, 0x04,
+  0x00, 0x46, 0x02, 0x01, 0x00, 0x09, 0x0a, 0x02, 0x00, 0x06, 0x0b, 0x09,
+  0x00, 0x0c, 0x0c, 0x25, 0x00, 0x00, 0x00, 0x00, 0x40, 0x15, 0x0a, 0x03,
+  0x01, 0x06, 0x0a, 0x05, 0x00, 0x1a, 0x0a, 0x06, 0x00, 0x09, 0x0c, 0x01,
+  0x00, 0x06, 0x0d, 0x06, 0x00, 0x15, 0x0c, 0x02, 0x00, 0x14, 0x0a, 0x04,
+  0xd2, 0x23, 0x00, 0x00, 0x00, 0x15, 0x0a, 0x00, 0x02, 0x06, 0x05, 0x0a,
+  0x00, 0x35, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x07, 0x00,
+  0x00, 0x14, 0x0a, 0x04, 0x83, 0x26, 0x00, 0x00, 0x00, 0x15, 0x0a, 0x02,
+  0x02, 0x2d, 0x05, 0x0a, 0x05, 0x19, 0x05, 0x0b, 0x00, 0x0c, 0x0a, 0x1c,
+  0x00, 0x00, 0x00, 0xb0, 0x41, 0x02, 0x0b, 0x00, 0x00, 0x05, 0x0c, 0x27,
+  0x00, 0x15, 0x0a, 0x03, 0x01, 0x0c, 0x0a, 0x1f, 0x00, 0x00, 0x00, 0xe0,
+  0x41, 0x15, 0x0a, 0x01, 0x01, 0x03, 0x0a, 0x00, 0x00, 0x0b, 0x05, 0x00,
+  0x00, 0x16, 0x0a, 0x02, 0x00, 0x0c, 0x0a, 0x1f, 0x00, 0x00, 0x00, 0xe0,
+  0x41, 0x15, 0x0a, 0x01, 0x01, 0x03, 0x0a, 0x01, 0x00, 0x0b, 0x05, 0x00,
+  0x00, 0x16, 0x0a, 0x02, 0x00, 0x28, 0x03, 0x31, 0x03, 0x32, 0x04, 0x00,
+  0x04, 0x00, 0x80, 0x03, 0x33, 0x03, 0x34, 0x03, 0x35, 0x03, 0x36, 0x03,
+  0x37, 0x04, 0x00, 0x00, 0x70, 0x40, 0x03, 0x38, 0x03, 0x39, 0x04, 0x00,
+  0x00, 0xa0, 0x40, 0x03, 0x3a, 0x03, 0x3b, 0x03, 0x3c, 0x03, 0x3d, 0x03,
+  0x3e, 0x03, 0x3f, 0x03, 0x40, 0x03, 0x41, 0x03, 0x42, 0x03, 0x43, 0x03,
+  0x44, 0x03, 0x45, 0x03, 0x46, 0x04, 0x00, 0x00, 0x80, 0x41, 0x03, 0x47,
+  0x03, 0x48, 0x04, 0x00, 0x00, 0xb0, 0x41, 0x03, 0x49, 0x03, 0x4a, 0x04,
+  0x00, 0x00, 0xe0, 0x41, 0x03, 0x4b, 0x04, 0x00, 0x00, 0x00, 0x42, 0x03,
+  0x4c, 0x03, 0x2f, 0x03, 0x4d, 0x04, 0x00, 0x00, 0x00, 0x40, 0x03, 0x4e,
+  0x03, 0x4f, 0x02, 0x1b, 0x1c, 0xa7, 0x01, 0x50, 0x01, 0x18, 0x00, 0x01,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xff, 0x02, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x03,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0xf5,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x0c,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0xa8, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x01, 0x01, 0x00, 0x00, 0x00, 0x06, 0x09, 0x01, 0x00,
+  0x00, 0x06, 0x02, 0x00, 0x00, 0x05, 0x03, 0x00, 0x00, 0x05, 0x04, 0x01,
+  0x00, 0x15, 0x01, 0x04, 0x02, 0x16, 0x01, 0x02, 0x00, 0x02, 0x03, 0x51,
+  0x03, 0x52, 0x00, 0x99, 0x03, 0x53, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x9a, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x07, 0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0c, 0x01,
+  0x03, 0x00, 0x00, 0x00, 0x20, 0x40, 0x09, 0x02, 0x00, 0x00, 0x15, 0x00,
+  0x03, 0x00, 0x16, 0x00, 0x00, 0x00, 0x04, 0x03, 0x54, 0x04, 0x00, 0x00,
+  0x00, 0x40, 0x03, 0x31, 0x04, 0x00, 0x00, 0x20, 0x40, 0x00, 0x9e, 0x03,
+  0x55, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x01,
+  0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x02, 0x00, 0xba, 0x01, 0x41,
+  0x00, 0x00, 0x00, 0x0c, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x80, 0x0c,
+  0x01, 0x05, 0x00, 0x00, 0x10, 0x30, 0x80, 0x0c, 0x02, 0x08, 0x00, 0x00,
+  0x1c, 0x60, 0x80, 0x0c, 0x03, 0x0a, 0x00, 0x00, 0x24, 0x30, 0x80, 0x40,
+  0x04, 0x0b, 0x00, 0x46, 0x00, 0x03, 0x00, 0x40, 0x05, 0x0c, 0x00, 0x40,
+  0x06, 0x0d, 0x00, 0x46, 0x00, 0x02, 0x00, 0x40, 0x07, 0x0e, 0x00, 0x46,
+  0x00, 0x02, 0x00, 0x40, 0x08, 0x0f, 0x00, 0x46, 0x00, 0x02, 0x00, 0x35,
+  0x09, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x0a, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x00, 0x40, 0x0c, 0x10, 0x00, 0x46,
+  0x00, 0x02, 0x00, 0x05, 0x0e, 0x11, 0x00, 0x13, 0x0d, 0x06, 0x00, 0x46,
+  0x00, 0x0e, 0x00, 0x37, 0x0a, 0x0b, 0x04, 0x01, 0x00, 0x00, 0x00, 0x10,
+  0x0a, 0x09, 0xb7, 0x12, 0x00, 0x00, 0x00, 0x35, 0x0a, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x00, 0x40, 0x0c, 0x10, 0x00, 0x46,
+  0x00, 0x02, 0x00, 0x05, 0x0e, 0x11, 0x00, 0x13, 0x0d, 0x06, 0x00, 0x46,
+  0x00, 0x0e, 0x00, 0x37, 0x0a, 0x0b, 0x04, 0x01, 0x00, 0x00, 0x00, 0x10,
+  0x0a, 0x09, 0x14, 0x13, 0x00, 0x00, 0x00, 0x35, 0x0a, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x00, 0x40, 0x0c, 0x10, 0x00, 0x46,
+  0x00, 0x02, 0x00, 0x05, 0x0e, 0x11, 0x00, 0x13, 0x0d, 0x06, 0x00, 0x46,
+  0x00, 0x0e, 0x00, 0x37, 0x0a, 0x0b, 0x04, 0x01, 0x00, 0x00, 0x00, 0x10,
+  0x0a, 0x09, 0xf5, 0x14, 0x00, 0x00, 0x00, 0x35, 0x0a, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x00, 0x40, 0x0c, 0x10, 0x00, 0x46,
+  0x00, 0x02, 0x00, 0x05, 0x0e, 0x11, 0x00, 0x13, 0x0d, 0x06, 0x00, 0x46,
+  0x00, 0x0e, 0x00, 0x37, 0x0a, 0x0b, 0x04, 0x01, 0x00, 0x00, 0x00, 0x10,
+  0x0a, 0x09, 0x53, 0x15, 0x00, 0x00, 0x00, 0x35, 0x0a, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x00, 0x05, 0x0d, 0x16, 0x00, 0x13,
+  0x0c, 0x06, 0x00, 0x46, 0x00, 0x0d, 0x00, 0x05, 0x0e, 0x17, 0x00, 0x13,
+  0x0d, 0x06, 0x00, 0x46, 0x00, 0x0e, 0x00, 0x37, 0x0a, 0x0b, 0x04, 0x01,
+  0x00, 0x00, 0x00, 0x10, 0x0a, 0x09, 0x71, 0x18, 0x00, 0x00, 0x00, 0x35,
+  0x0a, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x00, 0x40,
+  0x0c, 0x19, 0x00, 0x46, 0x00, 0x02, 0x00, 0x05, 0x0e, 0x1a, 0x00, 0x13,
+  0x0d, 0x06, 0x00, 0x46, 0x00, 0x0e, 0x00, 0x37, 0x0a, 0x0b, 0x04, 0x01,
+  0x00, 0x00, 0x00, 0x10, 0x0a, 0x09, 0x6d, 0x1b, 0x00, 0x00, 0x00, 0x35,
+  0x0a, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x00, 0x40,
+  0x0c, 0x19, 0x00, 0x46, 0x00, 0x02, 0x00, 0x05, 0x0e, 0x1a, 0x00, 0x13,
+  0x0d, 0x06, 0x00, 0x46, 0x00, 0x0e, 0x00, 0x37, 0x0a, 0x0b, 0x04, 0x01,
+  0x00, 0x00, 0x00, 0x10, 0x0a, 0x09, 0xec, 0x1c, 0x00, 0x00, 0x00, 0x35,
+  0x0a, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x00, 0x40,
+  0x0c, 0x19, 0x00, 0x46, 0x00, 0x02, 0x00, 0x05, 0x0e, 0x1a, 0x00, 0x13,
+  0x0d, 0x06, 0x00, 0x46, 0x00, 0x0e, 0x00, 0x37, 0x0a, 0x0b, 0x04, 0x01,
+  0x00, 0x00, 0x00, 0x10, 0x0a, 0x09, 0x63, 0x1d, 0x00, 0x00, 0x00, 0x35,
+  0x0a, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x00, 0x40,
+  0x0c, 0x1e, 0x00, 0x46, 0x00, 0x02, 0x00, 0x05, 0x0e, 0x17, 0x00, 0x13,
+  0x0d, 0x06, 0x00, 0x46, 0x00, 0x0e, 0x00, 0x37, 0x0a, 0x0b, 0x04, 0x01,
+  0x00, 0x00, 0x00, 0x10, 0x0a, 0x09, 0x70, 0x1f, 0x00, 0x00, 0x00, 0x35,
+  0x0a, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x00, 0x40,
+  0x0c, 0x1e, 0x00, 0x46, 0x00, 0x02, 0x00, 0x05, 0x0e, 0x17, 0x00, 0x13,
+  0x0d, 0x06, 0x00, 0x46, 0x00, 0x0e, 0x00, 0x37, 0x0a, 0x0b, 0x04, 0x01,
+  0x00, 0x00, 0x00, 0x10, 0x0a, 0x09, 0x77, 0x20, 0x00, 0x00, 0x00, 0x35,
+  0x0a, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x00, 0x05,
+  0x0d, 0x21, 0x00, 0x13, 0x0c, 0x06, 0x00, 0x46, 0x00, 0x0d, 0x00, 0x05,
+  0x0e, 0x21, 0x00, 0x13, 0x0d, 0x06, 0x00, 0x46, 0x00, 0x0e, 0x00, 0x37,
+  0x0a, 0x0b, 0x04, 0x01, 0x00, 0x00, 0x00, 0x10, 0x0a, 0x09, 0x72, 0x22,
+  0x00, 0x00, 0x00, 0x35, 0x0a, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+  0x0b, 0x00, 0x00, 0x40, 0x0c, 0x1e, 0x00, 0x46, 0x00, 0x02, 0x00, 0x05,
+  0x0e, 0x17, 0x00, 0x13, 0x0d, 0x06, 0x00, 0x46, 0x00, 0x0e, 0x00, 0x37,
+  0x0a, 0x0b, 0x04, 0x01, 0x00, 0x00, 0x00, 0x10, 0x0a, 0x09, 0xca, 0x23,
+  0x00, 0x00, 0x00, 0x40, 0x0a, 0x24, 0x00, 0x46, 0x00, 0x09, 0x00, 0x46,
+  0x00, 0x04, 0x00, 0x40, 0x0b, 0x25, 0x00, 0x46, 0x00, 0x01, 0x00, 0x46,
+  0x00, 0x00, 0x00, 0x46, 0x00, 0x0a, 0x00, 0x40, 0x0c, 0x26, 0x00, 0x46,
+  0x00, 0x0b, 0x00, 0x0c, 0x0d, 0x28, 0x00, 0x00, 0x00, 0x70, 0x42, 0x10,
+  0x0c, 0x0d, 0x31, 0x29, 0x00, 0x00, 0x00, 0x40, 0x0c, 0x2a, 0x00, 0x46,
+  0x00, 0x0a, 0x00, 0x0c, 0x0d, 0x28, 0x00, 0x00, 0x00, 0x70, 0x42, 0x10,
+  0x0c, 0x0d, 0x41, 0x2b, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0x2c,
+  0x03, 0x56, 0x03, 0x57, 0x04, 0x00, 0x04, 0x00, 0x80, 0x03, 0x58, 0x03,
+  0x59, 0x04, 0x00, 0x10, 0x30, 0x80, 0x03, 0x5a, 0x03, 0x5b, 0x04, 0x00,
+  0x1c, 0x60, 0x80, 0x03, 0x5c, 0x04, 0x00, 0x24, 0x30, 0x80, 0x06, 0x00,
+  0x06, 0x02, 0x06, 0x04, 0x06, 0x06, 0x06, 0x08, 0x06, 0x03, 0x03, 0x5d,
+  0x03, 0x5e, 0x03, 0x5f, 0x03, 0x60, 0x03, 0x61, 0x03, 0x62, 0x03, 0x63,
+  0x03, 0x64, 0x06, 0x07, 0x03, 0x65, 0x03, 0x66, 0x03, 0x67, 0x03, 0x68,
+  0x06, 0x05, 0x03, 0x69, 0x03, 0x6a, 0x03, 0x0c, 0x03, 0x6b, 0x03, 0x6c,
+  0x06, 0x1a, 0x06, 0x1d, 0x06, 0x1e, 0x03, 0x6d, 0x04, 0x00, 0x00, 0x70,
+  0x42, 0x03, 0x53, 0x06, 0x1f, 0x03, 0x55, 0x0d, 0x00, 0x02, 0x04, 0x06,
+  0x08, 0x03, 0x01, 0x07, 0x05, 0x1a, 0x1d, 0x1e, 0x1f, 0x01, 0x00, 0x01,
+  0x02, 0x00, 0x05, 0x00, 0x01, 0xfa, 0x01, 0x00, 0x05, 0xfa, 0x02, 0x00,
+  0x04, 0xfa, 0x00, 0x06, 0x00, 0xfa, 0x00, 0x09, 0x00, 0x0c, 0x00, 0x00,
+  0xeb, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0xfd, 0x00, 0x00,
+  0xea, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0xfd, 0x00, 0x00,
+  0xe9, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0xfd, 0x00, 0x00,
+  0xe8, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x01, 0x00, 0x00,
+  0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xe3, 0x01, 0x00,
+  0x00, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xe2, 0x01, 0x00,
+  0x00, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xe1, 0x01, 0x00,
+  0x00, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x20, 0xe0, 0x01, 0x00,
+  0x00, 0x09, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x21, 0xdf, 0x01, 0x00,
+  0x00, 0x09, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x22, 0xde, 0x01, 0x00,
+  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x23, 0xe6, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0xfd, 0x6c, 0x00, 0x00, 0x94, 0xf2, 0x00, 0x00, 0x0e, 0x00, 0x00,
+  0x05, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x06,
+  0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0c,
+  0x00, 0x00, 0x00, 0xf5, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xe3, 0xff, 0xff, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xe2, 0xff, 0xff, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xe1, 0xff, 0xff, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0xdf, 0xff, 0xff, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0xde, 0xff, 0xff, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0xdd, 0xff, 0xff, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x6c,
+  0x00, 0x00, 0x00, 0xf2, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20,
+};
+
+/* This is src/lua/export/org.lua */
+static const unsigned char lazy_script_table_5[] = {
+  0x05, 0x02, 0x4a, 0x01, 0x23, 0x02, 0x5c, 0x23, 0x04, 0x67, 0x73, 0x75,
+  0x62, 0x02, 0x2d, 0x20, 0x03, 0x5c, 0x2d, 0x20, 0x01, 0x3c, 0x02, 0x5c,
+  0x3c, 0x01, 0x3e, 0x02, 0x5c, 0x3e, 0x01, 0x60, 0x02, 0x5c, 0x60, 0x01,
+  0x5f, 0x02, 0x5c, 0x5f, 0x01, 0x2a, 0x02, 0x5c, 0x2a, 0x05, 0x75, 0x6e,
+  0x6f, 0x72, 0x67, 0x01, 0x0a, 0x0a, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65,
+  0x70, 0x61, 0x72, 0x61, 0x05, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x06, 0x63,
+  0x61, 0x63, 0x68, 0x65, 0x64, 0x09, 0x23, 0x2b, 0x54, 0x49, 0x54, 0x4c,
+  0x45, 0x3a, 0x20, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x08, 0x70, 0x72, 0x6f,
+  0x6c, 0x6f, 0x67, 0x75, 0x65, 0x07, 0x72, 0x61, 0x77, 0x74, 0x65, 0x78,
+  0x74, 0x04, 0x74, 0x65, 0x78, 0x74, 0x06, 0x6e, 0x6f, 0x74, 0x65, 0x78,
+  0x74, 0x01, 0x2f, 0x09, 0x69, 0x74, 0x61, 0x6c, 0x69, 0x63, 0x5f, 0x6f,
+  0x6e, 0x0a, 0x69, 0x74, 0x61, 0x6c, 0x69, 0x63, 0x5f, 0x6f, 0x66, 0x66,
+  0x0c, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x6f,
+  0x6e, 0x0d, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x5f,
+  0x6f, 0x66, 0x66, 0x07, 0x62, 0x6f, 0x6c, 0x64, 0x5f, 0x6f, 0x6e, 0x08,
+  0x62, 0x6f, 0x6c, 0x64, 0x5f, 0x6f, 0x66, 0x66, 0x0a, 0x6c, 0x69, 0x73,
+  0x74, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74, 0x08, 0x6c, 0x69, 0x73, 0x74,
+  0x5f, 0x65, 0x6e, 0x64, 0x0f, 0x70, 0x61, 0x72, 0x61, 0x67, 0x72, 0x61,
+  0x70, 0x68, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74, 0x0d, 0x70, 0x61, 0x72,
+  0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5f, 0x65, 0x6e, 0x64, 0x08, 0x65,
+  0x70, 0x69, 0x6c, 0x6f, 0x67, 0x75, 0x65, 0x0b, 0x45, 0x78, 0x70, 0x6f,
+  0x72, 0x74, 0x43, 0x61, 0x63, 0x68, 0x65, 0x03, 0x6f, 0x72, 0x67, 0x06,
+  0x77, 0x72, 0x69, 0x74, 0x65, 0x72, 0x18, 0x45, 0x78, 0x70, 0x6f, 0x72,
+  0x74, 0x46, 0x69, 0x6c, 0x65, 0x55, 0x73, 0x69, 0x6e, 0x67, 0x43, 0x61,
+  0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b, 0x73, 0x05, 0x63, 0x61, 0x63, 0x68,
+  0x65, 0x08, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b, 0x10, 0x45,
+  0x78, 0x70, 0x6f, 0x72, 0x74, 0x46, 0x69, 0x6c, 0x65, 0x57, 0x69, 0x74,
+  0x68, 0x55, 0x49, 0x0f, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x4f,
+  0x72, 0x67, 0x20, 0x46, 0x69, 0x6c, 0x65, 0x04, 0x2e, 0x6f, 0x72, 0x67,
+  0x0d, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x4f, 0x72, 0x67, 0x46, 0x69,
+  0x6c, 0x65, 0x0e, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x54, 0x6f, 0x53,
+  0x74, 0x72, 0x69, 0x6e, 0x67, 0x0f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x74, 0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x11, 0x45, 0x78,
+  0x70, 0x6f, 0x72, 0x74, 0x54, 0x6f, 0x4f, 0x72, 0x67, 0x53, 0x74, 0x72,
+  0x69, 0x6e, 0x67, 0x02, 0x2a, 0x20, 0x02, 0x48, 0x31, 0x03, 0x2a, 0x2a,
+  0x20, 0x02, 0x48, 0x32, 0x04, 0x2a, 0x2a, 0x2a, 0x20, 0x02, 0x48, 0x33,
+  0x05, 0x2a, 0x2a, 0x2a, 0x2a, 0x20, 0x02, 0x48, 0x34, 0x00, 0x01, 0x50,
+  0x01, 0x4c, 0x02, 0x4c, 0x42, 0x03, 0x31, 0x2e, 0x20, 0x02, 0x4c, 0x4e,
+  0x0e, 0x23, 0x2b, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x5f, 0x71, 0x75, 0x6f,
+  0x74, 0x65, 0x0a, 0x0d, 0x0a, 0x23, 0x2b, 0x65, 0x6e, 0x64, 0x5f, 0x71,
+  0x75, 0x6f, 0x74, 0x65, 0x0a, 0x01, 0x51, 0x01, 0x56, 0x03, 0x52, 0x41,
+  0x57, 0x0c, 0x23, 0x2b, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x5f, 0x73, 0x72,
+  0x63, 0x0a, 0x0b, 0x0a, 0x23, 0x2b, 0x65, 0x6e, 0x64, 0x5f, 0x73, 0x72,
+  0x63, 0x0a, 0x03, 0x50, 0x52, 0x45, 0x03, 0x43, 0x6d, 0x64, 0x16, 0x05,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x05, 0x03, 0x00, 0x00, 0x05, 0x04,
+  0x01, 0x00, 0x14, 0x01, 0x00, 0xcc, 0x02, 0x00, 0x00, 0x00, 0x15, 0x01,
+  0x04, 0x02, 0x06, 0x00, 0x01, 0x00, 0x05, 0x03, 0x03, 0x00, 0x05, 0x04,
+  0x04, 0x00, 0x14, 0x01, 0x00, 0xcc, 0x02, 0x00, 0x00, 0x00, 0x15, 0x01,
+  0x04, 0x02, 0x06, 0x00, 0x01, 0x00, 0x05, 0x03, 0x05, 0x00, 0x05, 0x04,
+  0x06, 0x00, 0x14, 0x01, 0x00, 0xcc, 0x02, 0x00, 0x00, 0x00, 0x15, 0x01,
+  0x04, 0x02, 0x06, 0x00, 0x01, 0x00, 0x05, 0x03, 0x07, 0x00, 0x05, 0x04,
+  0x08, 0x00, 0x14, 0x01, 0x00, 0xcc, 0x02, 0x00, 0x00, 0x00, 0x15, 0x01,
+  0x04, 0x02, 0x06, 0x00, 0x01, 0x00, 0x05, 0x03, 0x09, 0x00, 0x05, 0x04,
+  0x0a, 0x00, 0x14, 0x01, 0x00, 0xcc, 0x02, 0x00, 0x00, 0x00, 0x15, 0x01,
+  0x04, 0x02, 0x06, 0x00, 0x01, 0x00, 0x05, 0x03, 0x0b, 0x00, 0x05, 0x04,
+  0x0c, 0x00, 0x14, 0x01, 0x00, 0xcc, 0x02, 0x00, 0x00, 0x00, 0x15, 0x01,
+  0x04, 0x02, 0x06, 0x00, 0x01, 0x00, 0x05, 0x03, 0x0d, 0x00, 0x05, 0x04,
+  0x0e, 0x00, 0x14, 0x01, 0x00, 0xcc, 0x02, 0x00, 0x00, 0x00, 0x15, 0x01,
+  0x04, 0x02, 0x06, 0x00, 0x01, 0x00, 0x16, 0x00, 0x02, 0x00, 0x0f, 0x03,
+  0x01, 0x03, 0x02, 0x03, 0x03, 0x03, 0x04, 0x03, 0x05, 0x03, 0x06, 0x03,
+  0x07, 0x03, 0x08, 0x03, 0x09, 0x03, 0x0a, 0x03, 0x0b, 0x03, 0x0c, 0x03,
+  0x0d, 0x03, 0x0e, 0x03, 0x0f, 0x00, 0x02, 0x10, 0x01, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01,
+  0x03, 0x00, 0x00, 0x00, 0x1e, 0x09, 0x02, 0x00, 0x00, 0x09, 0x03, 0x01,
+  0x00, 0x0d, 0x01, 0x02, 0x03, 0x09, 0x03, 0x00, 0x00, 0x0d, 0x02, 0x03,
+  0x00, 0x09, 0x03, 0x01, 0x00, 0x1e, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x1a, 0x00, 0x04, 0x00, 0x11, 0x03, 0x01, 0x00, 0x1a, 0x03, 0x02,
+  0x00, 0x11, 0x03, 0x02, 0x00, 0x19, 0x03, 0x0d, 0x00, 0x1a, 0x01, 0x03,
+  0x00, 0x09, 0x03, 0x02, 0x00, 0x11, 0x04, 0x01, 0x02, 0x15, 0x03, 0x02,
+  0x01, 0x09, 0x03, 0x02, 0x00, 0x05, 0x04, 0x00, 0x00, 0x15, 0x03, 0x02,
+  0x01, 0x1a, 0x02, 0x03, 0x00, 0x09, 0x03, 0x02, 0x00, 0x11, 0x04, 0x02,
+  0x01, 0x15, 0x03, 0x02, 0x01, 0x0a, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01,
+  0x00, 0x09, 0x03, 0x02, 0x00, 0x05, 0x04, 0x00, 0x00, 0x15, 0x03, 0x02,
+  0x01, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x11, 0x00, 0x23, 0x12, 0x01,
+  0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x01, 0x00, 0x02, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x02, 0x24, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x04, 0x0f, 0x01, 0x00, 0x9a, 0x00,
+  0x00, 0x00, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0x01,
+  0x03, 0x13, 0x00, 0x3d, 0x14, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01, 0x3e,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x09,
+  0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x09, 0x03, 0x01, 0x00, 0x0f,
+  0x02, 0x03, 0x5a, 0x01, 0x00, 0x00, 0x00, 0x05, 0x03, 0x02, 0x00, 0x15,
+  0x00, 0x04, 0x01, 0x16, 0x00, 0x01, 0x00, 0x03, 0x03, 0x15, 0x03, 0x16,
+  0x03, 0x11, 0x00, 0x41, 0x17, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x42, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x04, 0x09, 0x01, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00, 0x15,
+  0x01, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x18, 0x01,
+  0x18, 0x00, 0x00, 0x00, 0x01, 0x46, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01,
+  0x02, 0x00, 0x00, 0x00, 0x06, 0x09, 0x01, 0x00, 0x00, 0x09, 0x02, 0x01,
+  0x00, 0x06, 0x03, 0x00, 0x00, 0x15, 0x02, 0x02, 0x02, 0x15, 0x01, 0x02,
+  0x01, 0x16, 0x00, 0x01, 0x00, 0x00, 0x00, 0x49, 0x19, 0x01, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x16, 0x00, 0x01, 0x00, 0x00, 0x00, 0x4d,
+  0x1a, 0x01, 0x18, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00,
+  0x15, 0x00, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x1b, 0x00,
+  0x50, 0x1c, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01, 0x51, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00,
+  0x05, 0x01, 0x00, 0x00, 0x15, 0x00, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00,
+  0x01, 0x03, 0x1b, 0x00, 0x54, 0x1d, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01,
+  0x55, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04,
+  0x09, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x15, 0x00, 0x02, 0x01,
+  0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x0c, 0x00, 0x58, 0x1e, 0x01, 0x18,
+  0x00, 0x00, 0x00, 0x01, 0x59, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00,
+  0x15, 0x00, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x0c, 0x00,
+  0x5c, 0x1f, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01, 0x5d, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00,
+  0x05, 0x01, 0x00, 0x00, 0x15, 0x00, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00,
+  0x01, 0x03, 0x0e, 0x00, 0x60, 0x20, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01,
+  0x61, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04,
+  0x09, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x15, 0x00, 0x02, 0x01,
+  0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x0e, 0x00, 0x64, 0x21, 0x01, 0x18,
+  0x00, 0x00, 0x00, 0x01, 0x65, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00,
+  0x15, 0x00, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x11, 0x00,
+  0x68, 0x22, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00,
+  0x05, 0x01, 0x00, 0x00, 0x15, 0x00, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00,
+  0x01, 0x03, 0x11, 0x00, 0x6c, 0x23, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01,
+  0x6d, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x06,
+  0x07, 0x01, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x02, 0x00, 0x9a,
+  0x01, 0x00, 0x00, 0x00, 0x15, 0x01, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00,
+  0x02, 0x03, 0x12, 0x03, 0x13, 0x00, 0x70, 0x24, 0x01, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x71, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x16, 0x00, 0x01, 0x00, 0x00, 0x00, 0x74, 0x25,
+  0x01, 0x18, 0x00, 0x75, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x07, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x01, 0x00, 0x00, 0x15, 0x00, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00, 0x01,
+  0x03, 0x12, 0x00, 0x77, 0x26, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x78, 0x00, 0x00, 0x00, 0x00, 0x08, 0x02, 0x02, 0x00, 0x00, 0x00, 0x55,
+  0x0c, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x05, 0x03, 0x02, 0x00,
+  0x06, 0x04, 0x00, 0x00, 0x15, 0x02, 0x03, 0x02, 0x0f, 0x00, 0x02, 0xdc,
+  0x03, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x13, 0x04, 0x00, 0x00,
+  0x46, 0x02, 0x00, 0x00, 0x46, 0x01, 0x03, 0x00, 0x46, 0x01, 0x00, 0x00,
+  0x08, 0x04, 0x00, 0xa9, 0x04, 0x00, 0x00, 0x00, 0x0c, 0x04, 0x06, 0x00,
+  0x00, 0x00, 0x50, 0x40, 0x06, 0x05, 0x01, 0x00, 0x36, 0x06, 0x18, 0x00,
+  0x10, 0x02, 0x06, 0xa3, 0x07, 0x00, 0x00, 0x00, 0x13, 0x07, 0x01, 0x00,
+  0x46, 0x01, 0x03, 0x00, 0x10, 0x07, 0x06, 0xba, 0x08, 0x00, 0x00, 0x00,
+  0x13, 0x07, 0x02, 0x00, 0x46, 0x01, 0x00, 0x00, 0x46, 0x00, 0x01, 0x00,
+  0x10, 0x07, 0x06, 0xac, 0x09, 0x00, 0x00, 0x00, 0x13, 0x07, 0x03, 0x00,
+  0x46, 0x01, 0x00, 0x00, 0x10, 0x07, 0x06, 0x06, 0x0a, 0x00, 0x00, 0x00,
+  0x13, 0x07, 0x04, 0x00, 0x46, 0x01, 0x00, 0x00, 0x46, 0x02, 0x01, 0x00,
+  0x10, 0x07, 0x06, 0xd5, 0x0b, 0x00, 0x00, 0x00, 0x40, 0x07, 0x19, 0x00,
+  0x10, 0x07, 0x06, 0x14, 0x0c, 0x00, 0x00, 0x00, 0x13, 0x07, 0x06, 0x00,
+  0x46, 0x01, 0x00, 0x00, 0x10, 0x07, 0x06, 0xea, 0x0d, 0x00, 0x00, 0x00,
+  0x13, 0x07, 0x07, 0x00, 0x46, 0x01, 0x00, 0x00, 0x10, 0x07, 0x06, 0x49,
+  0x0e, 0x00, 0x00, 0x00, 0x13, 0x07, 0x08, 0x00, 0x46, 0x01, 0x00, 0x00,
+  0x10, 0x07, 0x06, 0xc1, 0x0f, 0x00, 0x00, 0x00, 0x13, 0x07, 0x09, 0x00,
+  0x46, 0x01, 0x00, 0x00, 0x10, 0x07, 0x06, 0x96, 0x10, 0x00, 0x00, 0x00,
+  0x13, 0x07, 0x0a, 0x00, 0x46, 0x01, 0x00, 0x00, 0x10, 0x07, 0x06, 0x80,
+  0x11, 0x00, 0x00, 0x00, 0x13, 0x07, 0x0b, 0x00, 0x46, 0x01, 0x00, 0x00,
+  0x10, 0x07, 0x06, 0x41, 0x12, 0x00, 0x00, 0x00, 0x13, 0x07, 0x0c, 0x00,
+  0x46, 0x01, 0x00, 0x00, 0x10, 0x07, 0x06, 0x12, 0x13, 0x00, 0x00, 0x00,
+  0x13, 0x07, 0x0d, 0x00, 0x46, 0x01, 0x00, 0x00, 0x10, 0x07, 0x06, 0xc6,
+  0x14, 0x00, 0x00, 0x00, 0x40, 0x07, 0x1a, 0x00, 0x10, 0x07, 0x06, 0x69,
+  0x15, 0x00, 0x00, 0x00, 0x40, 0x07, 0x1b, 0x00, 0x10, 0x07, 0x06, 0x13,
+  0x16, 0x00, 0x00, 0x00, 0x40, 0x07, 0x1c, 0x00, 0x10, 0x07, 0x06, 0xcd,
+  0x17, 0x00, 0x00, 0x00, 0x15, 0x04, 0x03, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x16, 0x04, 0x00, 0x00, 0x1d, 0x03, 0x27, 0x04, 0x00, 0x00, 0x00, 0x40,
+  0x03, 0x28, 0x03, 0x29, 0x03, 0x12, 0x03, 0x2a, 0x04, 0x00, 0x00, 0x50,
+  0x40, 0x03, 0x2b, 0x03, 0x14, 0x03, 0x17, 0x03, 0x18, 0x03, 0x19, 0x03,
+  0x1a, 0x03, 0x1c, 0x03, 0x1d, 0x03, 0x1e, 0x03, 0x1f, 0x03, 0x20, 0x03,
+  0x21, 0x03, 0x22, 0x03, 0x23, 0x03, 0x24, 0x03, 0x25, 0x03, 0x26, 0x05,
+  0x11, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11,
+  0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x06, 0x06, 0x06, 0x0f, 0x06, 0x10,
+  0x06, 0x11, 0x11, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+  0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x1d, 0x2c, 0x01, 0x18,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x00, 0x01, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0xc2, 0x00,
+  0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x0c, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x06, 0x02, 0x00,
+  0x00, 0x05, 0x03, 0x02, 0x00, 0x05, 0x04, 0x03, 0x00, 0x09, 0x05, 0x00,
+  0x00, 0x15, 0x01, 0x05, 0x00, 0x16, 0x01, 0x00, 0x00, 0x04, 0x03, 0x2d,
+  0x04, 0x00, 0x00, 0x00, 0x40, 0x03, 0x2e, 0x03, 0x2f, 0x00, 0x7d, 0x30,
+  0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x0c, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0c, 0x01, 0x03, 0x00, 0x00, 0x00,
+  0x20, 0x40, 0x09, 0x02, 0x00, 0x00, 0x15, 0x00, 0x03, 0x00, 0x16, 0x00,
+  0x00, 0x00, 0x04, 0x03, 0x31, 0x04, 0x00, 0x00, 0x00, 0x40, 0x03, 0x32,
+  0x04, 0x00, 0x00, 0x20, 0x40, 0x00, 0x81, 0x01, 0x33, 0x01, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x06,
+  0x00, 0x00, 0x01, 0x02, 0x00, 0x80, 0x01, 0x41, 0x00, 0x00, 0x00, 0x40,
+  0x00, 0x00, 0x00, 0x35, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35,
+  0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x05,
+  0x04, 0x01, 0x00, 0x05, 0x05, 0x02, 0x00, 0x37, 0x02, 0x03, 0x04, 0x01,
+  0x00, 0x00, 0x00, 0x10, 0x02, 0x01, 0xb7, 0x03, 0x00, 0x00, 0x00, 0x35,
+  0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x05,
+  0x04, 0x04, 0x00, 0x05, 0x05, 0x02, 0x00, 0x37, 0x02, 0x03, 0x04, 0x01,
+  0x00, 0x00, 0x00, 0x10, 0x02, 0x01, 0x14, 0x05, 0x00, 0x00, 0x00, 0x35,
+  0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x05,
+  0x04, 0x06, 0x00, 0x05, 0x05, 0x02, 0x00, 0x37, 0x02, 0x03, 0x04, 0x01,
+  0x00, 0x00, 0x00, 0x10, 0x02, 0x01, 0xf5, 0x07, 0x00, 0x00, 0x00, 0x35,
+  0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x05,
+  0x04, 0x08, 0x00, 0x05, 0x05, 0x02, 0x00, 0x37, 0x02, 0x03, 0x04, 0x01,
+  0x00, 0x00, 0x00, 0x10, 0x02, 0x01, 0x53, 0x09, 0x00, 0x00, 0x00, 0x35,
+  0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x05,
+  0x04, 0x0a, 0x00, 0x05, 0x05, 0x02, 0x00, 0x37, 0x02, 0x03, 0x04, 0x01,
+  0x00, 0x00, 0x00, 0x10, 0x02, 0x01, 0x71, 0x0b, 0x00, 0x00, 0x00, 0x35,
+  0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x05,
+  0x04, 0x0c, 0x00, 0x05, 0x05, 0x0a, 0x00, 0x37, 0x02, 0x03, 0x04, 0x01,
+  0x00, 0x00, 0x00, 0x10, 0x02, 0x01, 0x6d, 0x0d, 0x00, 0x00, 0x00, 0x35,
+  0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x05,
+  0x04, 0x0c, 0x00, 0x05, 0x05, 0x0a, 0x00, 0x37, 0x02, 0x03, 0x04, 0x01,
+  0x00, 0x00, 0x00, 0x10, 0x02, 0x01, 0xec, 0x0e, 0x00, 0x00, 0x00, 0x35,
+  0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x05,
+  0x04, 0x0f, 0x00, 0x05, 0x05, 0x0a, 0x00, 0x37, 0x02, 0x03, 0x04, 0x01,
+  0x00, 0x00, 0x00, 0x10, 0x02, 0x01, 0x63, 0x10, 0x00, 0x00, 0x00, 0x35,
+  0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x05,
+  0x04, 0x11, 0x00, 0x05, 0x05, 0x12, 0x00, 0x37, 0x02, 0x03, 0x04, 0x01,
+  0x00, 0x00, 0x00, 0x10, 0x02, 0x01, 0x70, 0x13, 0x00, 0x00, 0x00, 0x35,
+  0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x05,
+  0x04, 0x11, 0x00, 0x05, 0x05, 0x12, 0x00, 0x37, 0x02, 0x03, 0x04, 0x01,
+  0x00, 0x00, 0x00, 0x10, 0x02, 0x01, 0x77, 0x14, 0x00, 0x00, 0x00, 0x35,
+  0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x05,
+  0x04, 0x0a, 0x00, 0x05, 0x05, 0x0a, 0x00, 0x37, 0x02, 0x03, 0x04, 0x01,
+  0x00, 0x00, 0x00, 0x10, 0x02, 0x01, 0x72, 0x15, 0x00, 0x00, 0x00, 0x35,
+  0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x03, 0x01, 0x00, 0x05,
+  0x04, 0x16, 0x00, 0x05, 0x05, 0x17, 0x00, 0x37, 0x02, 0x03, 0x04, 0x01,
+  0x00, 0x00, 0x00, 0x10, 0x02, 0x01, 0xca, 0x18, 0x00, 0x00, 0x00, 0x40,
+  0x02, 0x19, 0x00, 0x46, 0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x00, 0x40,
+  0x03, 0x1a, 0x00, 0x46, 0x00, 0x02, 0x00, 0x0c, 0x04, 0x1c, 0x00, 0x00,
+  0x00, 0xb0, 0x41, 0x10, 0x03, 0x04, 0x14, 0x1d, 0x00, 0x00, 0x00, 0x40,
+  0x03, 0x1e, 0x00, 0x46, 0x00, 0x02, 0x00, 0x0c, 0x04, 0x1c, 0x00, 0x00,
+  0x00, 0xb0, 0x41, 0x10, 0x03, 0x04, 0xde, 0x1f, 0x00, 0x00, 0x00, 0x16,
+  0x00, 0x01, 0x00, 0x20, 0x06, 0x00, 0x03, 0x34, 0x03, 0x11, 0x03, 0x35,
+  0x03, 0x36, 0x03, 0x37, 0x03, 0x38, 0x03, 0x39, 0x03, 0x3a, 0x03, 0x3b,
+  0x03, 0x3c, 0x03, 0x3d, 0x03, 0x04, 0x03, 0x3e, 0x03, 0x3f, 0x03, 0x40,
+  0x03, 0x41, 0x03, 0x42, 0x03, 0x43, 0x03, 0x44, 0x03, 0x45, 0x03, 0x46,
+  0x03, 0x47, 0x03, 0x48, 0x03, 0x49, 0x06, 0x12, 0x06, 0x13, 0x03, 0x4a,
+  0x04, 0x00, 0x00, 0xb0, 0x41, 0x03, 0x30, 0x06, 0x14, 0x03, 0x33, 0x04,
+  0x00, 0x12, 0x13, 0x14, 0x01, 0x00, 0x01, 0x18, 0x00, 0x01, 0x0c, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x15,
+};
+
+/* This is src/lua/export/markdown.lua */
+static const unsigned char lazy_script_table_6[] = {
+  0x05, 0x02, 0x49, 0x01, 0x23, 0x02, 0x5c, 0x23, 0x04, 0x67, 0x73, 0x75,
+  0x62, 0x02, 0x2d, 0x20, 0x03, 0x5c, 0x2d, 0x20, 0x01, 0x3c, 0x02, 0x5c,
+  0x3c, 0x01, 0x3e, 0x02, 0x5c, 0x3e, 0x01, 0x60, 0x02, 0x5c, 0x60, 0x01,
+  0x5f, 0x02, 0x5c, 0x5f, 0x01, 0x2a, 0x02, 0x5c, 0x2a, 0x0a, 0x75, 0x6e,
+  0x6d, 0x61, 0x72, 0x6b, 0x64, 0x6f, 0x77, 0x6e, 0x01, 0x0a, 0x0a, 0x63,
+  0x68, 0x61, 0x6e, 0x67, 0x65, 0x70, 0x61, 0x72, 0x61, 0x08, 0x70, 0x72,
+  0x6f, 0x6c, 0x6f, 0x67, 0x75, 0x65, 0x07, 0x72, 0x61, 0x77, 0x74, 0x65,
+  0x78, 0x74, 0x04, 0x74, 0x65, 0x78, 0x74, 0x06, 0x6e, 0x6f, 0x74, 0x65,
+  0x78, 0x74, 0x03, 0x3c, 0x69, 0x3e, 0x09, 0x69, 0x74, 0x61, 0x6c, 0x69,
+  0x63, 0x5f, 0x6f, 0x6e, 0x04, 0x3c, 0x2f, 0x69, 0x3e, 0x0a, 0x69, 0x74,
+  0x61, 0x6c, 0x69, 0x63, 0x5f, 0x6f, 0x66, 0x66, 0x03, 0x3c, 0x75, 0x3e,
+  0x0c, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x6f,
+  0x6e, 0x04, 0x3c, 0x2f, 0x75, 0x3e, 0x0d, 0x75, 0x6e, 0x64, 0x65, 0x72,
+  0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x6f, 0x66, 0x66, 0x03, 0x3c, 0x62, 0x3e,
+  0x07, 0x62, 0x6f, 0x6c, 0x64, 0x5f, 0x6f, 0x6e, 0x04, 0x3c, 0x2f, 0x62,
+  0x3e, 0x08, 0x62, 0x6f, 0x6c, 0x64, 0x5f, 0x6f, 0x66, 0x66, 0x0a, 0x6c,
+  0x69, 0x73, 0x74, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74, 0x08, 0x6c, 0x69,
+  0x73, 0x74, 0x5f, 0x65, 0x6e, 0x64, 0x05, 0x73, 0x74, 0x79, 0x6c, 0x65,
+  0x0f, 0x70, 0x61, 0x72, 0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5f, 0x73,
+  0x74, 0x61, 0x72, 0x74, 0x0d, 0x70, 0x61, 0x72, 0x61, 0x67, 0x72, 0x61,
+  0x70, 0x68, 0x5f, 0x65, 0x6e, 0x64, 0x08, 0x65, 0x70, 0x69, 0x6c, 0x6f,
+  0x67, 0x75, 0x65, 0x18, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x46, 0x69,
+  0x6c, 0x65, 0x55, 0x73, 0x69, 0x6e, 0x67, 0x43, 0x61, 0x6c, 0x6c, 0x62,
+  0x61, 0x63, 0x6b, 0x73, 0x08, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63,
+  0x6b, 0x16, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x44, 0x6f, 0x63, 0x75,
+  0x6d, 0x65, 0x6e, 0x74, 0x4e, 0x61, 0x74, 0x69, 0x76, 0x65, 0x6c, 0x79,
+  0x08, 0x6d, 0x61, 0x72, 0x6b, 0x64, 0x6f, 0x77, 0x6e, 0x0e, 0x6e, 0x61,
+  0x74, 0x69, 0x76, 0x65, 0x63, 0x61, 0x6c, 0x6c, 0x62, 0x61, 0x63, 0x6b,
+  0x10, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x46, 0x69, 0x6c, 0x65, 0x57,
+  0x69, 0x74, 0x68, 0x55, 0x49, 0x14, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74,
+  0x20, 0x4d, 0x61, 0x72, 0x6b, 0x64, 0x6f, 0x77, 0x6e, 0x20, 0x46, 0x69,
+  0x6c, 0x65, 0x03, 0x2e, 0x6d, 0x64, 0x12, 0x45, 0x78, 0x70, 0x6f, 0x72,
+  0x74, 0x4d, 0x61, 0x72, 0x6b, 0x64, 0x6f, 0x77, 0x6e, 0x46, 0x69, 0x6c,
+  0x65, 0x0f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x44, 0x6f, 0x63,
+  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x16, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74,
+  0x54, 0x6f, 0x4d, 0x61, 0x72, 0x6b, 0x64, 0x6f, 0x77, 0x6e, 0x53, 0x74,
+  0x72, 0x69, 0x6e, 0x67, 0x02, 0x23, 0x20, 0x02, 0x48, 0x31, 0x03, 0x23,
+  0x23, 0x20, 0x02, 0x48, 0x32, 0x04, 0x23, 0x23, 0x23, 0x20, 0x02, 0x48,
+  0x33, 0x05, 0x23, 0x23, 0x23, 0x23, 0x20, 0x02, 0x48, 0x34, 0x00, 0x01,
+  0x50, 0x01, 0x4c, 0x02, 0x4c, 0x42, 0x03, 0x31, 0x2e, 0x20, 0x02, 0x4c,
+  0x4e, 0x02, 0x3e, 0x20, 0x01, 0x51, 0x01, 0x56, 0x04, 0x20, 0x20, 0x20,
+  0x20, 0x03, 0x52, 0x41, 0x57, 0x03, 0x50, 0x52, 0x45, 0x0c, 0x4c, 0x75,
+  0x61, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x65, 0x72, 0x73, 0x03, 0x43,
+  0x6d, 0x64, 0x16, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x05, 0x03,
+  0x00, 0x00, 0x05, 0x04, 0x01, 0x00, 0x14, 0x01, 0x00, 0xcc, 0x02, 0x00,
+  0x00, 0x00, 0x15, 0x01, 0x04, 0x02, 0x06, 0x00, 0x01, 0x00, 0x05, 0x03,
+  0x03, 0x00, 0x05, 0x04, 0x04, 0x00, 0x14, 0x01, 0x00, 0xcc, 0x02, 0x00,
+  0x00, 0x00, 0x15, 0x01, 0x04, 0x02, 0x06, 0x00, 0x01, 0x00, 0x05, 0x03,
+  0x05, 0x00, 0x05, 0x04, 0x06, 0x00, 0x14, 0x01, 0x00, 0xcc, 0x02, 0x00,
+  0x00, 0x00, 0x15, 0x01, 0x04, 0x02, 0x06, 0x00, 0x01, 0x00, 0x05, 0x03,
+  0x07, 0x00, 0x05, 0x04, 0x08, 0x00, 0x14, 0x01, 0x00, 0xcc, 0x02, 0x00,
+  0x00, 0x00, 0x15, 0x01, 0x04, 0x02, 0x06, 0x00, 0x01, 0x00, 0x05, 0x03,
+  0x09, 0x00, 0x05, 0x04, 0x0a, 0x00, 0x14, 0x01, 0x00, 0xcc, 0x02, 0x00,
+  0x00, 0x00, 0x15, 0x01, 0x04, 0x02, 0x06, 0x00, 0x01, 0x00, 0x05, 0x03,
+  0x0b, 0x00, 0x05, 0x04, 0x0c, 0x00, 0x14, 0x01, 0x00, 0xcc, 0x02, 0x00,
+  0x00, 0x00, 0x15, 0x01, 0x04, 0x02, 0x06, 0x00, 0x01, 0x00, 0x05, 0x03,
+  0x0d, 0x00, 0x05, 0x04, 0x0e, 0x00, 0x14, 0x01, 0x00, 0xcc, 0x02, 0x00,
+  0x00, 0x00, 0x15, 0x01, 0x04, 0x02, 0x06, 0x00, 0x01, 0x00, 0x16, 0x00,
+  0x02, 0x00, 0x0f, 0x03, 0x01, 0x03, 0x02, 0x03, 0x03, 0x03, 0x04, 0x03,
+  0x05, 0x03, 0x06, 0x03, 0x07, 0x03, 0x08, 0x03, 0x09, 0x03, 0x0a, 0x03,
+  0x0b, 0x03, 0x0c, 0x03, 0x0d, 0x03, 0x0e, 0x03, 0x0f, 0x00, 0x03, 0x10,
+  0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x01, 0x03, 0x00, 0x00, 0x00, 0x1e, 0x09, 0x02, 0x00,
+  0x00, 0x09, 0x03, 0x01, 0x00, 0x0d, 0x01, 0x02, 0x03, 0x09, 0x03, 0x00,
+  0x00, 0x0d, 0x02, 0x03, 0x00, 0x09, 0x03, 0x01, 0x00, 0x1e, 0x00, 0x06,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x04, 0x00, 0x11, 0x03, 0x01,
+  0x00, 0x1a, 0x03, 0x02, 0x00, 0x11, 0x03, 0x02, 0x00, 0x19, 0x03, 0x0d,
+  0x00, 0x1a, 0x01, 0x03, 0x00, 0x09, 0x03, 0x02, 0x00, 0x11, 0x04, 0x01,
+  0x02, 0x15, 0x03, 0x02, 0x01, 0x09, 0x03, 0x02, 0x00, 0x05, 0x04, 0x00,
+  0x00, 0x15, 0x03, 0x02, 0x01, 0x1a, 0x02, 0x03, 0x00, 0x09, 0x03, 0x02,
+  0x00, 0x11, 0x04, 0x02, 0x01, 0x15, 0x03, 0x02, 0x01, 0x0a, 0x00, 0x01,
+  0x00, 0x16, 0x00, 0x01, 0x00, 0x09, 0x03, 0x02, 0x00, 0x05, 0x04, 0x00,
+  0x00, 0x15, 0x03, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x11,
+  0x00, 0x21, 0x12, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x00, 0x02, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x02, 0x22,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x16,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x39, 0x13, 0x01, 0x18, 0x00, 0x3a, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x04, 0x09, 0x01,
+  0x00, 0x00, 0x06, 0x02, 0x00, 0x00, 0x15, 0x01, 0x02, 0x01, 0x16, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x3c, 0x14, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01,
+  0x3d, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x02, 0x00, 0x00, 0x00, 0x06,
+  0x09, 0x01, 0x00, 0x00, 0x09, 0x02, 0x01, 0x00, 0x06, 0x03, 0x00, 0x00,
+  0x15, 0x02, 0x02, 0x02, 0x15, 0x01, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x40, 0x15, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x16, 0x00, 0x01, 0x00, 0x00, 0x00, 0x44, 0x16, 0x01, 0x18, 0x00, 0x45,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x09,
+  0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x15, 0x00, 0x02, 0x01, 0x16,
+  0x00, 0x01, 0x00, 0x01, 0x03, 0x17, 0x00, 0x47, 0x18, 0x01, 0x18, 0x00,
+  0x00, 0x00, 0x01, 0x48, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x15,
+  0x00, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x19, 0x00, 0x4b,
+  0x1a, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01, 0x4c, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x05,
+  0x01, 0x00, 0x00, 0x15, 0x00, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00, 0x01,
+  0x03, 0x1b, 0x00, 0x4f, 0x1c, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x09,
+  0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x15, 0x00, 0x02, 0x01, 0x16,
+  0x00, 0x01, 0x00, 0x01, 0x03, 0x1d, 0x00, 0x53, 0x1e, 0x01, 0x18, 0x00,
+  0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x15,
+  0x00, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x1f, 0x00, 0x57,
+  0x20, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01, 0x58, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x05,
+  0x01, 0x00, 0x00, 0x15, 0x00, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00, 0x01,
+  0x03, 0x21, 0x00, 0x5b, 0x22, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01, 0x5c,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x09,
+  0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x15, 0x00, 0x02, 0x01, 0x16,
+  0x00, 0x01, 0x00, 0x01, 0x03, 0x11, 0x00, 0x5f, 0x23, 0x01, 0x18, 0x00,
+  0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x15,
+  0x00, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x11, 0x00, 0x63,
+  0x24, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01, 0x64, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00, 0xa9, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0x02, 0x00, 0x9a, 0x01, 0x00, 0x00, 0x00, 0x15,
+  0x01, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00, 0x02, 0x03, 0x12, 0x03, 0x25,
+  0x00, 0x67, 0x26, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x68,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x16,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x6b, 0x27, 0x01, 0x18, 0x00, 0x6c, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x07, 0x00,
+  0x00, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x15, 0x00,
+  0x02, 0x01, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x12, 0x00, 0x6e, 0x28,
+  0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6f, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x02, 0x02, 0x00, 0x00, 0x00, 0x46, 0x02, 0x02, 0x00, 0x00, 0x13,
+  0x03, 0x00, 0x00, 0x46, 0x02, 0x00, 0x00, 0x46, 0x01, 0x02, 0x00, 0x46,
+  0x00, 0x00, 0x00, 0x08, 0x03, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x0c,
+  0x03, 0x02, 0x00, 0x00, 0x00, 0x10, 0x40, 0x06, 0x04, 0x01, 0x00, 0x36,
+  0x05, 0x12, 0x00, 0x40, 0x06, 0x13, 0x00, 0x10, 0x06, 0x05, 0xac, 0x03,
+  0x00, 0x00, 0x00, 0x13, 0x06, 0x02, 0x00, 0x46, 0x00, 0x00, 0x00, 0x10,
+  0x06, 0x05, 0x06, 0x04, 0x00, 0x00, 0x00, 0x13, 0x06, 0x03, 0x00, 0x46,
+  0x00, 0x00, 0x00, 0x46, 0x02, 0x01, 0x00, 0x10, 0x06, 0x05, 0xd5, 0x05,
+  0x00, 0x00, 0x00, 0x40, 0x06, 0x14, 0x00, 0x10, 0x06, 0x05, 0x14, 0x06,
+  0x00, 0x00, 0x00, 0x13, 0x06, 0x05, 0x00, 0x46, 0x00, 0x00, 0x00, 0x10,
+  0x06, 0x05, 0xea, 0x07, 0x00, 0x00, 0x00, 0x13, 0x06, 0x06, 0x00, 0x46,
+  0x00, 0x00, 0x00, 0x10, 0x06, 0x05, 0x49, 0x08, 0x00, 0x00, 0x00, 0x13,
+  0x06, 0x07, 0x00, 0x46, 0x00, 0x00, 0x00, 0x10, 0x06, 0x05, 0xc1, 0x09,
+  0x00, 0x00, 0x00, 0x13, 0x06, 0x08, 0x00, 0x46, 0x00, 0x00, 0x00, 0x10,
+  0x06, 0x05, 0x96, 0x0a, 0x00, 0x00, 0x00, 0x13, 0x06, 0x09, 0x00, 0x46,
+  0x00, 0x00, 0x00, 0x10, 0x06, 0x05, 0x80, 0x0b, 0x00, 0x00, 0x00, 0x13,
+  0x06, 0x0a, 0x00, 0x46, 0x00, 0x00, 0x00, 0x10, 0x06, 0x05, 0x41, 0x0c,
+  0x00, 0x00, 0x00, 0x13, 0x06, 0x0b, 0x00, 0x46, 0x00, 0x00, 0x00, 0x10,
+  0x06, 0x05, 0x12, 0x0d, 0x00, 0x00, 0x00, 0x13, 0x06, 0x0c, 0x00, 0x46,
+  0x00, 0x00, 0x00, 0x10, 0x06, 0x05, 0xc6, 0x0e, 0x00, 0x00, 0x00, 0x40,
+  0x06, 0x15, 0x00, 0x10, 0x06, 0x05, 0x69, 0x0f, 0x00, 0x00, 0x00, 0x40,
+  0x06, 0x16, 0x00, 0x10, 0x06, 0x05, 0x13, 0x10, 0x00, 0x00, 0x00, 0x40,
+  0x06, 0x17, 0x00, 0x10, 0x06, 0x05, 0xcd, 0x11, 0x00, 0x00, 0x00, 0x15,
+  0x03, 0x03, 0x00, 0x0b, 0x02, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x18,
+  0x03, 0x12, 0x03, 0x29, 0x04, 0x00, 0x00, 0x10, 0x40, 0x03, 0x13, 0x03,
+  0x14, 0x03, 0x15, 0x03, 0x16, 0x03, 0x18, 0x03, 0x1a, 0x03, 0x1c, 0x03,
+  0x1e, 0x03, 0x20, 0x03, 0x22, 0x03, 0x23, 0x03, 0x24, 0x03, 0x26, 0x03,
+  0x27, 0x03, 0x28, 0x05, 0x0f, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+  0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x06, 0x02, 0x06, 0x05,
+  0x06, 0x0e, 0x06, 0x0f, 0x06, 0x10, 0x10, 0x01, 0x02, 0x03, 0x04, 0x05,
+  0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x1e,
+  0x2a, 0x01, 0x18, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0xc9, 0x00,
+  0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x08, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x0c, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x06, 0x04, 0x01,
+  0x00, 0x05, 0x05, 0x02, 0x00, 0x02, 0x06, 0x00, 0x00, 0x06, 0x07, 0x02,
+  0x00, 0x15, 0x03, 0x05, 0x01, 0x16, 0x00, 0x01, 0x00, 0x03, 0x03, 0x2b,
+  0x04, 0x00, 0x00, 0x00, 0x40, 0x03, 0x2c, 0x00, 0x76, 0x2d, 0x01, 0x18,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x77, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0x01, 0x01, 0x00, 0x00, 0x00, 0x08, 0x0c, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x40, 0x06, 0x02, 0x00, 0x00, 0x05, 0x03, 0x02, 0x00,
+  0x05, 0x04, 0x03, 0x00, 0x09, 0x05, 0x00, 0x00, 0x15, 0x01, 0x05, 0x00,
+  0x16, 0x01, 0x00, 0x00, 0x04, 0x03, 0x2e, 0x04, 0x00, 0x00, 0x00, 0x40,
+  0x03, 0x2f, 0x03, 0x30, 0x00, 0x7a, 0x31, 0x01, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xff, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0x0c, 0x01, 0x03, 0x00, 0x00, 0x00, 0x20, 0x40, 0x05, 0x02, 0x04,
+  0x00, 0x15, 0x00, 0x03, 0x00, 0x16, 0x00, 0x00, 0x00, 0x05, 0x03, 0x2b,
+  0x04, 0x00, 0x00, 0x00, 0x40, 0x03, 0x32, 0x04, 0x00, 0x00, 0x20, 0x40,
+  0x03, 0x2c, 0x00, 0x7f, 0x33, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x01, 0x02,
+  0x00, 0x84, 0x01, 0x41, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x35,
+  0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x02, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x05, 0x04, 0x01, 0x00, 0x05,
+  0x05, 0x02, 0x00, 0x37, 0x02, 0x03, 0x04, 0x01, 0x00, 0x00, 0x00, 0x10,
+  0x02, 0x01, 0xb7, 0x03, 0x00, 0x00, 0x00, 0x35, 0x02, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x05, 0x04, 0x04, 0x00, 0x05,
+  0x05, 0x02, 0x00, 0x37, 0x02, 0x03, 0x04, 0x01, 0x00, 0x00, 0x00, 0x10,
+  0x02, 0x01, 0x14, 0x05, 0x00, 0x00, 0x00, 0x35, 0x02, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x05, 0x04, 0x06, 0x00, 0x05,
+  0x05, 0x02, 0x00, 0x37, 0x02, 0x03, 0x04, 0x01, 0x00, 0x00, 0x00, 0x10,
+  0x02, 0x01, 0xf5, 0x07, 0x00, 0x00, 0x00, 0x35, 0x02, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x05, 0x04, 0x08, 0x00, 0x05,
+  0x05, 0x02, 0x00, 0x37, 0x02, 0x03, 0x04, 0x01, 0x00, 0x00, 0x00, 0x10,
+  0x02, 0x01, 0x53, 0x09, 0x00, 0x00, 0x00, 0x35, 0x02, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x05, 0x04, 0x0a, 0x00, 0x05,
+  0x05, 0x02, 0x00, 0x37, 0x02, 0x03, 0x04, 0x01, 0x00, 0x00, 0x00, 0x10,
+  0x02, 0x01, 0x71, 0x0b, 0x00, 0x00, 0x00, 0x35, 0x02, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x05, 0x04, 0x0c, 0x00, 0x05,
+  0x05, 0x0a, 0x00, 0x37, 0x02, 0x03, 0x04, 0x01, 0x00, 0x00, 0x00, 0x10,
+  0x02, 0x01, 0x6d, 0x0d, 0x00, 0x00, 0x00, 0x35, 0x02, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x05, 0x04, 0x0c, 0x00, 0x05,
+  0x05, 0x0a, 0x00, 0x37, 0x02, 0x03, 0x04, 0x01, 0x00, 0x00, 0x00, 0x10,
+  0x02, 0x01, 0xec, 0x0e, 0x00, 0x00, 0x00, 0x35, 0x02, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x05, 0x04, 0x0f, 0x00, 0x05,
+  0x05, 0x0a, 0x00, 0x37, 0x02, 0x03, 0x04, 0x01, 0x00, 0x00, 0x00, 0x10,
+  0x02, 0x01, 0x63, 0x10, 0x00, 0x00, 0x00, 0x35, 0x02, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x05, 0x04, 0x11, 0x00, 0x05,
+  0x05, 0x02, 0x00, 0x37, 0x02, 0x03, 0x04, 0x01, 0x00, 0x00, 0x00, 0x10,
+  0x02, 0x01, 0x70, 0x12, 0x00, 0x00, 0x00, 0x35, 0x02, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x05, 0x04, 0x11, 0x00, 0x05,
+  0x05, 0x02, 0x00, 0x37, 0x02, 0x03, 0x04, 0x01, 0x00, 0x00, 0x00, 0x10,
+  0x02, 0x01, 0x77, 0x13, 0x00, 0x00, 0x00, 0x35, 0x02, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x05, 0x04, 0x14, 0x00, 0x05,
+  0x05, 0x0a, 0x00, 0x37, 0x02, 0x03, 0x04, 0x01, 0x00, 0x00, 0x00, 0x10,
+  0x02, 0x01, 0x72, 0x15, 0x00, 0x00, 0x00, 0x35, 0x02, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x03, 0x03, 0x01, 0x00, 0x05, 0x04, 0x16, 0x00, 0x05,
+  0x05, 0x16, 0x00, 0x37, 0x02, 0x03, 0x04, 0x01, 0x00, 0x00, 0x00, 0x10,
+  0x02, 0x01, 0xca, 0x17, 0x00, 0x00, 0x00, 0x40, 0x02, 0x18, 0x00, 0x46,
+  0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x1a, 0x00, 0x00,
+  0x00, 0x90, 0x41, 0x10, 0x02, 0x03, 0x5a, 0x1b, 0x00, 0x00, 0x00, 0x40,
+  0x03, 0x1c, 0x00, 0x40, 0x04, 0x1d, 0x00, 0x46, 0x00, 0x03, 0x00, 0x0c,
+  0x05, 0x1f, 0x00, 0x00, 0x00, 0xe0, 0x41, 0x10, 0x04, 0x05, 0xaf, 0x20,
+  0x00, 0x00, 0x00, 0x40, 0x04, 0x21, 0x00, 0x0c, 0x05, 0x1f, 0x00, 0x00,
+  0x00, 0xe0, 0x41, 0x10, 0x04, 0x05, 0x1f, 0x22, 0x00, 0x00, 0x00, 0x16,
+  0x00, 0x01, 0x00, 0x23, 0x06, 0x00, 0x03, 0x34, 0x03, 0x11, 0x03, 0x35,
+  0x03, 0x36, 0x03, 0x37, 0x03, 0x38, 0x03, 0x39, 0x03, 0x3a, 0x03, 0x3b,
+  0x03, 0x3c, 0x03, 0x3d, 0x03, 0x04, 0x03, 0x3e, 0x03, 0x3f, 0x03, 0x40,
+  0x03, 0x41, 0x03, 0x42, 0x03, 0x43, 0x03, 0x44, 0x03, 0x45, 0x03, 0x46,
+  0x03, 0x0a, 0x03, 0x47, 0x06, 0x11, 0x03, 0x48, 0x04, 0x00, 0x00, 0x90,
+  0x41, 0x03, 0x2c, 0x06, 0x12, 0x06, 0x13, 0x03, 0x49, 0x04, 0x00, 0x00,
+  0xe0, 0x41, 0x03, 0x31, 0x06, 0x14, 0x03, 0x33, 0x05, 0x00, 0x11, 0x12,
+  0x13, 0x14, 0x01, 0x00, 0x01, 0x18, 0x00, 0x02, 0x0c, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x56, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x15,
+};
+
+/* This is src/lua/import/html.lua */
+static const unsigned char lazy_script_table_7[] = {
+  0x05, 0x02, 0x48, 0x0e, 0x66, 0x6c, 0x75, 0x73, 0x68, 0x70, 0x61, 0x72,
+  0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x01, 0x50, 0x05, 0x66, 0x6c, 0x75,
+  0x73, 0x68, 0x09, 0x66, 0x6c, 0x75, 0x73, 0x68, 0x77, 0x6f, 0x72, 0x64,
+  0x03, 0x50, 0x52, 0x45, 0x08, 0x66, 0x6c, 0x75, 0x73, 0x68, 0x70, 0x72,
+  0x65, 0x02, 0x48, 0x31, 0x02, 0x48, 0x32, 0x02, 0x48, 0x33, 0x02, 0x48,
+  0x34, 0x02, 0x4c, 0x4e, 0x02, 0x4c, 0x42, 0x08, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x5f, 0x6f, 0x6e, 0x09, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x5f, 0x6f,
+  0x66, 0x66, 0x03, 0x74, 0x61, 0x67, 0x06, 0x3c, 0x62, 0x6f, 0x64, 0x79,
+  0x3e, 0x0e, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x44, 0x6f, 0x63, 0x75,
+  0x6d, 0x65, 0x6e, 0x74, 0x0e, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x49,
+  0x6d, 0x70, 0x6f, 0x72, 0x74, 0x65, 0x72, 0x01, 0x20, 0x03, 0x3c, 0x70,
+  0x3e, 0x04, 0x3c, 0x62, 0x72, 0x3e, 0x05, 0x3c, 0x62, 0x72, 0x2f, 0x3e,
+  0x05, 0x3c, 0x2f, 0x68, 0x31, 0x3e, 0x05, 0x3c, 0x2f, 0x68, 0x32, 0x3e,
+  0x05, 0x3c, 0x2f, 0x68, 0x33, 0x3e, 0x05, 0x3c, 0x2f, 0x68, 0x34, 0x3e,
+  0x04, 0x3c, 0x68, 0x31, 0x3e, 0x04, 0x3c, 0x68, 0x32, 0x3e, 0x04, 0x3c,
+  0x68, 0x33, 0x3e, 0x04, 0x3c, 0x68, 0x34, 0x3e, 0x04, 0x3c, 0x6f, 0x6c,
+  0x3e, 0x04, 0x3c, 0x75, 0x6c, 0x3e, 0x04, 0x3c, 0x6c, 0x69, 0x3e, 0x03,
+  0x3c, 0x69, 0x3e, 0x04, 0x3c, 0x2f, 0x69, 0x3e, 0x04, 0x3c, 0x65, 0x6d,
+  0x3e, 0x05, 0x3c, 0x2f, 0x65, 0x6d, 0x3e, 0x03, 0x3c, 0x75, 0x3e, 0x04,
+  0x3c, 0x2f, 0x75, 0x3e, 0x03, 0x3c, 0x62, 0x3e, 0x04, 0x3c, 0x2f, 0x62,
+  0x3e, 0x05, 0x3c, 0x70, 0x72, 0x65, 0x3e, 0x06, 0x3c, 0x2f, 0x70, 0x72,
+  0x65, 0x3e, 0x01, 0x0a, 0x05, 0x72, 0x65, 0x73, 0x65, 0x74, 0x04, 0x74,
+  0x65, 0x78, 0x74, 0x06, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x11, 0x64,
+  0x65, 0x6c, 0x65, 0x74, 0x65, 0x50, 0x61, 0x72, 0x61, 0x67, 0x72, 0x61,
+  0x70, 0x68, 0x41, 0x74, 0x10, 0x49, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x48,
+  0x54, 0x4d, 0x4c, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x10, 0x49, 0x6d,
+  0x70, 0x6f, 0x72, 0x74, 0x46, 0x69, 0x6c, 0x65, 0x57, 0x69, 0x74, 0x68,
+  0x55, 0x49, 0x10, 0x49, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x48, 0x54,
+  0x4d, 0x4c, 0x20, 0x46, 0x69, 0x6c, 0x65, 0x03, 0x43, 0x6d, 0x64, 0x0e,
+  0x49, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x48, 0x54, 0x4d, 0x4c, 0x46, 0x69,
+  0x6c, 0x65, 0x02, 0x77, 0x67, 0x06, 0x49, 0x54, 0x41, 0x4c, 0x49, 0x43,
+  0x09, 0x55, 0x4e, 0x44, 0x45, 0x52, 0x4c, 0x49, 0x4e, 0x45, 0x04, 0x42,
+  0x4f, 0x4c, 0x44, 0x09, 0x70, 0x61, 0x72, 0x73, 0x65, 0x77, 0x6f, 0x72,
+  0x64, 0x07, 0x77, 0x72, 0x69, 0x74, 0x65, 0x75, 0x38, 0x0a, 0x68, 0x74,
+  0x6d, 0x6c, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x73, 0x0e, 0x64, 0x65, 0x63,
+  0x6f, 0x64, 0x65, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x69, 0x65, 0x73, 0x05,
+  0x62, 0x69, 0x74, 0x33, 0x32, 0x04, 0x62, 0x61, 0x6e, 0x64, 0x03, 0x62,
+  0x6f, 0x72, 0x04, 0x62, 0x78, 0x6f, 0x72, 0x05, 0x62, 0x74, 0x65, 0x73,
+  0x74, 0x06, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x04, 0x63, 0x68, 0x61,
+  0x72, 0x04, 0x66, 0x69, 0x6e, 0x64, 0x03, 0x73, 0x75, 0x62, 0x05, 0x74,
+  0x61, 0x62, 0x6c, 0x65, 0x06, 0x63, 0x6f, 0x6e, 0x63, 0x61, 0x74, 0x18,
+  0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x09, 0x00, 0x00, 0x00, 0x09,
+  0x02, 0x01, 0x00, 0x14, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x00, 0x03, 0x01, 0x05, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x16,
+  0x00, 0x01, 0x00, 0x02, 0x03, 0x01, 0x03, 0x02, 0x00, 0x2f, 0x03, 0x01,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x09, 0x00, 0x00,
+  0x00, 0x09, 0x02, 0x01, 0x00, 0x14, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00,
+  0x00, 0x15, 0x00, 0x03, 0x01, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x04,
+  0x00, 0x34, 0x04, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x35,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x09,
+  0x00, 0x00, 0x00, 0x09, 0x02, 0x01, 0x00, 0x14, 0x00, 0x00, 0xa8, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0x00, 0x03, 0x01, 0x05, 0x00, 0x01, 0x00, 0x0a,
+  0x00, 0x01, 0x00, 0x09, 0x00, 0x02, 0x00, 0x1a, 0x00, 0x02, 0x00, 0x05,
+  0x00, 0x02, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x03,
+  0x03, 0x01, 0x03, 0x02, 0x03, 0x05, 0x00, 0x38, 0x06, 0x01, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x00, 0x01, 0x00, 0x02, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0a, 0x09,
+  0x00, 0x00, 0x00, 0x09, 0x02, 0x01, 0x00, 0x14, 0x00, 0x00, 0xa8, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0x00, 0x03, 0x01, 0x05, 0x00, 0x01, 0x00, 0x0a,
+  0x00, 0x01, 0x00, 0x05, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x16,
+  0x00, 0x01, 0x00, 0x03, 0x03, 0x01, 0x03, 0x02, 0x03, 0x07, 0x00, 0x49,
+  0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x18, 0x00,
+  0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x0a, 0x09, 0x00, 0x00, 0x00, 0x09, 0x02, 0x01, 0x00, 0x14, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x03, 0x01, 0x05, 0x00, 0x01,
+  0x00, 0x0a, 0x00, 0x01, 0x00, 0x05, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x01,
+  0x00, 0x16, 0x00, 0x01, 0x00, 0x03, 0x03, 0x01, 0x03, 0x02, 0x03, 0x08,
+  0x00, 0x4a, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x19, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x0a, 0x09, 0x00, 0x00, 0x00, 0x09, 0x02, 0x01, 0x00, 0x14,
+  0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x03, 0x01, 0x05,
+  0x00, 0x01, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x05, 0x00, 0x02, 0x00, 0x0a,
+  0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x03, 0x03, 0x01, 0x03, 0x02,
+  0x03, 0x09, 0x00, 0x4b, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x1a, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x0a, 0x09, 0x00, 0x00, 0x00, 0x09, 0x02, 0x01,
+  0x00, 0x14, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x03,
+  0x01, 0x05, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x05, 0x00, 0x02,
+  0x00, 0x0a, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x03, 0x03, 0x01,
+  0x03, 0x02, 0x03, 0x0a, 0x00, 0x4c, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x1b, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x05, 0x00, 0x00, 0x00, 0x0a,
+  0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x0b, 0x00, 0x4d,
+  0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x05, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x0c, 0x00, 0x4e, 0x00,
+  0x01, 0x18, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x0a, 0x09, 0x00, 0x00, 0x00, 0x09, 0x02, 0x01,
+  0x00, 0x14, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x03,
+  0x01, 0x05, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x09, 0x00, 0x02,
+  0x00, 0x0a, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x02, 0x03, 0x01,
+  0x03, 0x02, 0x00, 0x4f, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x1e, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x06, 0x09, 0x00, 0x00, 0x00, 0x09, 0x02, 0x01,
+  0x00, 0x14, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x03,
+  0x01, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x0d, 0x00, 0x50, 0x00, 0x01,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x09, 0x00, 0x00, 0x00, 0x09,
+  0x02, 0x01, 0x00, 0x14, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x00, 0x03, 0x01, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x0e, 0x00, 0x51,
+  0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x09, 0x00, 0x00,
+  0x00, 0x09, 0x02, 0x01, 0x00, 0x14, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x00, 0x15, 0x00, 0x03, 0x01, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x0d,
+  0x00, 0x52, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x09,
+  0x00, 0x00, 0x00, 0x09, 0x02, 0x01, 0x00, 0x14, 0x00, 0x00, 0x62, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0x00, 0x03, 0x01, 0x16, 0x00, 0x01, 0x00, 0x01,
+  0x03, 0x0e, 0x00, 0x53, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x06, 0x09, 0x00, 0x00, 0x00, 0x09, 0x02, 0x01, 0x00, 0x14, 0x00, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x03, 0x01, 0x16, 0x00, 0x01,
+  0x00, 0x01, 0x03, 0x0d, 0x00, 0x54, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x06, 0x09, 0x00, 0x00, 0x00, 0x09, 0x02, 0x01, 0x00, 0x14,
+  0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x03, 0x01, 0x16,
+  0x00, 0x01, 0x00, 0x01, 0x03, 0x0e, 0x00, 0x55, 0x00, 0x01, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x06, 0x09, 0x00, 0x00, 0x00, 0x09, 0x02, 0x01,
+  0x00, 0x14, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x03,
+  0x01, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x0d, 0x00, 0x56, 0x00, 0x01,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x09, 0x00, 0x00, 0x00, 0x09,
+  0x02, 0x01, 0x00, 0x14, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x00, 0x03, 0x01, 0x16, 0x00, 0x01, 0x00, 0x01, 0x03, 0x0e, 0x00, 0x57,
+  0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x09, 0x00, 0x00,
+  0x00, 0x09, 0x02, 0x01, 0x00, 0x14, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0x00, 0x15, 0x00, 0x03, 0x01, 0x05, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x01,
+  0x00, 0x05, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01,
+  0x00, 0x0a, 0x00, 0x02, 0x00, 0x16, 0x00, 0x01, 0x00, 0x03, 0x03, 0x01,
+  0x03, 0x02, 0x03, 0x05, 0x00, 0x58, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0a, 0x09, 0x00, 0x00,
+  0x00, 0x09, 0x02, 0x01, 0x00, 0x14, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0x00, 0x15, 0x00, 0x03, 0x01, 0x05, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x01,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x16, 0x00, 0x01,
+  0x00, 0x02, 0x03, 0x01, 0x03, 0x02, 0x00, 0x59, 0x00, 0x01, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x28, 0x00, 0x00, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x12, 0x09, 0x00, 0x00,
+  0x00, 0x1a, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x01, 0x00, 0x09, 0x02, 0x02,
+  0x00, 0x14, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x03,
+  0x01, 0x05, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x05, 0x00, 0x02,
+  0x00, 0x0a, 0x00, 0x02, 0x00, 0x16, 0x00, 0x01, 0x00, 0x09, 0x00, 0x01,
+  0x00, 0x09, 0x02, 0x00, 0x00, 0x14, 0x00, 0x00, 0x95, 0x03, 0x00, 0x00,
+  0x00, 0x15, 0x00, 0x03, 0x01, 0x16, 0x00, 0x01, 0x00, 0x04, 0x03, 0x01,
+  0x03, 0x02, 0x03, 0x05, 0x03, 0x04, 0x00, 0x5a, 0x00, 0x01, 0x18, 0x2a,
+  0x00, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x29, 0x00, 0x00, 0xdb,
+  0x00, 0x00, 0x00, 0x00, 0x25, 0x30, 0x00, 0x00, 0x00, 0x00, 0x14, 0x01,
+  0x05, 0x00, 0x00, 0x00, 0xbe, 0x01, 0x09, 0x01, 0x00, 0x00, 0x06, 0x02,
+  0x00, 0x00, 0x15, 0x01, 0x02, 0x02, 0x06, 0x02, 0x01, 0x00, 0x02, 0x03,
+  0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x4c, 0x02, 0x04, 0x00, 0x50, 0x05,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x80, 0x50, 0x06, 0x03, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x3a, 0x02, 0xfb, 0xff, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x02,
+  0x03, 0x00, 0x00, 0x00, 0x20, 0x40, 0x15, 0x02, 0x01, 0x02, 0x0c, 0x03,
+  0x05, 0x00, 0x00, 0x00, 0x40, 0x40, 0x06, 0x04, 0x02, 0x00, 0x15, 0x03,
+  0x02, 0x02, 0x05, 0x04, 0x06, 0x00, 0x05, 0x05, 0x07, 0x00, 0x03, 0x06,
+  0x00, 0x00, 0x13, 0x07, 0x00, 0x00, 0x46, 0x00, 0x03, 0x00, 0x46, 0x01,
+  0x04, 0x00, 0x13, 0x08, 0x01, 0x00, 0x46, 0x00, 0x03, 0x00, 0x46, 0x01,
+  0x06, 0x00, 0x13, 0x09, 0x02, 0x00, 0x46, 0x00, 0x03, 0x00, 0x46, 0x01,
+  0x04, 0x00, 0x46, 0x01, 0x06, 0x00, 0x35, 0x0a, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x08, 0x0a, 0x41, 0x08, 0x00, 0x00, 0x00, 0x10, 0x07,
+  0x0a, 0x0c, 0x09, 0x00, 0x00, 0x00, 0x10, 0x09, 0x0a, 0xa5, 0x0a, 0x00,
+  0x00, 0x00, 0x10, 0x09, 0x0a, 0x81, 0x0b, 0x00, 0x00, 0x00, 0x10, 0x07,
+  0x0a, 0xa0, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x07, 0x0a, 0xc8, 0x0d, 0x00,
+  0x00, 0x00, 0x10, 0x07, 0x0a, 0xb3, 0x0e, 0x00, 0x00, 0x00, 0x10, 0x07,
+  0x0a, 0x36, 0x0f, 0x00, 0x00, 0x00, 0x13, 0x0b, 0x03, 0x00, 0x46, 0x00,
+  0x03, 0x00, 0x46, 0x01, 0x04, 0x00, 0x10, 0x0b, 0x0a, 0xea, 0x10, 0x00,
+  0x00, 0x00, 0x13, 0x0b, 0x04, 0x00, 0x46, 0x00, 0x03, 0x00, 0x46, 0x01,
+  0x04, 0x00, 0x10, 0x0b, 0x0a, 0x4e, 0x11, 0x00, 0x00, 0x00, 0x13, 0x0b,
+  0x05, 0x00, 0x46, 0x00, 0x03, 0x00, 0x46, 0x01, 0x04, 0x00, 0x10, 0x0b,
+  0x0a, 0x87, 0x12, 0x00, 0x00, 0x00, 0x13, 0x0b, 0x06, 0x00, 0x46, 0x00,
+  0x03, 0x00, 0x46, 0x01, 0x04, 0x00, 0x10, 0x0b, 0x0a, 0xbc, 0x13, 0x00,
+  0x00, 0x00, 0x13, 0x0b, 0x07, 0x00, 0x46, 0x01, 0x05, 0x00, 0x10, 0x0b,
+  0x0a, 0x5d, 0x14, 0x00, 0x00, 0x00, 0x13, 0x0b, 0x08, 0x00, 0x46, 0x01,
+  0x05, 0x00, 0x10, 0x0b, 0x0a, 0x21, 0x15, 0x00, 0x00, 0x00, 0x13, 0x0b,
+  0x09, 0x00, 0x46, 0x00, 0x03, 0x00, 0x46, 0x01, 0x04, 0x00, 0x46, 0x01,
+  0x05, 0x00, 0x10, 0x0b, 0x0a, 0x2b, 0x16, 0x00, 0x00, 0x00, 0x13, 0x0b,
+  0x0a, 0x00, 0x46, 0x00, 0x03, 0x00, 0x46, 0x02, 0x01, 0x00, 0x10, 0x0b,
+  0x0a, 0xaa, 0x17, 0x00, 0x00, 0x00, 0x13, 0x0b, 0x0b, 0x00, 0x46, 0x00,
+  0x03, 0x00, 0x46, 0x02, 0x01, 0x00, 0x10, 0x0b, 0x0a, 0xe1, 0x18, 0x00,
+  0x00, 0x00, 0x13, 0x0b, 0x0c, 0x00, 0x46, 0x00, 0x03, 0x00, 0x46, 0x02,
+  0x01, 0x00, 0x10, 0x0b, 0x0a, 0x4c, 0x19, 0x00, 0x00, 0x00, 0x13, 0x0b,
+  0x0d, 0x00, 0x46, 0x00, 0x03, 0x00, 0x46, 0x02, 0x01, 0x00, 0x10, 0x0b,
+  0x0a, 0x27, 0x1a, 0x00, 0x00, 0x00, 0x13, 0x0b, 0x0e, 0x00, 0x46, 0x00,
+  0x03, 0x00, 0x46, 0x02, 0x02, 0x00, 0x10, 0x0b, 0x0a, 0x25, 0x1b, 0x00,
+  0x00, 0x00, 0x13, 0x0b, 0x0f, 0x00, 0x46, 0x00, 0x03, 0x00, 0x46, 0x02,
+  0x02, 0x00, 0x10, 0x0b, 0x0a, 0xb0, 0x1c, 0x00, 0x00, 0x00, 0x13, 0x0b,
+  0x10, 0x00, 0x46, 0x00, 0x03, 0x00, 0x46, 0x02, 0x03, 0x00, 0x10, 0x0b,
+  0x0a, 0x5d, 0x1d, 0x00, 0x00, 0x00, 0x13, 0x0b, 0x11, 0x00, 0x46, 0x00,
+  0x03, 0x00, 0x46, 0x02, 0x03, 0x00, 0x10, 0x0b, 0x0a, 0xac, 0x1e, 0x00,
+  0x00, 0x00, 0x13, 0x0b, 0x12, 0x00, 0x46, 0x00, 0x03, 0x00, 0x46, 0x01,
+  0x04, 0x00, 0x46, 0x01, 0x06, 0x00, 0x10, 0x0b, 0x0a, 0x3e, 0x1f, 0x00,
+  0x00, 0x00, 0x13, 0x0b, 0x13, 0x00, 0x46, 0x00, 0x03, 0x00, 0x46, 0x01,
+  0x04, 0x00, 0x46, 0x01, 0x06, 0x00, 0x10, 0x0b, 0x0a, 0x9b, 0x20, 0x00,
+  0x00, 0x00, 0x13, 0x0b, 0x14, 0x00, 0x46, 0x01, 0x06, 0x00, 0x46, 0x00,
+  0x03, 0x00, 0x46, 0x01, 0x04, 0x00, 0x10, 0x0b, 0x0a, 0x2b, 0x21, 0x00,
+  0x00, 0x00, 0x14, 0x0b, 0x03, 0x9f, 0x22, 0x00, 0x00, 0x00, 0x15, 0x0b,
+  0x02, 0x01, 0x06, 0x0b, 0x01, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x02, 0x0d,
+  0x00, 0x00, 0x4c, 0x0b, 0x17, 0x00, 0x50, 0x0e, 0x06, 0x00, 0x23, 0x00,
+  0x00, 0x80, 0x06, 0x12, 0x0f, 0x00, 0x14, 0x10, 0x03, 0xd5, 0x23, 0x00,
+  0x00, 0x00, 0x15, 0x10, 0x03, 0x01, 0x17, 0x00, 0x10, 0x00, 0x50, 0x0e,
+  0x0b, 0x00, 0x24, 0x00, 0x00, 0x80, 0x09, 0x10, 0x04, 0x00, 0x06, 0x11,
+  0x0f, 0x00, 0x15, 0x10, 0x02, 0x02, 0x1b, 0x10, 0x0a, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0x06, 0x13, 0x10, 0x00, 0x14, 0x11, 0x03, 0xd5, 0x23, 0x00,
+  0x00, 0x00, 0x15, 0x11, 0x03, 0x01, 0x17, 0x00, 0x04, 0x00, 0x0d, 0x10,
+  0x0a, 0x0f, 0x1a, 0x10, 0x02, 0x00, 0x06, 0x11, 0x10, 0x00, 0x15, 0x11,
+  0x01, 0x01, 0x3a, 0x0b, 0xe8, 0xff, 0x02, 0x00, 0x00, 0x00, 0x06, 0x0d,
+  0x04, 0x00, 0x14, 0x0b, 0x03, 0xa8, 0x25, 0x00, 0x00, 0x00, 0x15, 0x0b,
+  0x03, 0x01, 0x05, 0x04, 0x06, 0x00, 0x34, 0x0b, 0x02, 0x00, 0x04, 0x0c,
+  0x01, 0x00, 0x20, 0x0c, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x04, 0x0d,
+  0x01, 0x00, 0x14, 0x0b, 0x02, 0x54, 0x26, 0x00, 0x00, 0x00, 0x15, 0x0b,
+  0x03, 0x01, 0x0b, 0x04, 0x00, 0x00, 0x16, 0x02, 0x02, 0x00, 0x27, 0x03,
+  0x0f, 0x03, 0x10, 0x03, 0x11, 0x04, 0x00, 0x00, 0x20, 0x40, 0x03, 0x12,
+  0x04, 0x00, 0x00, 0x40, 0x40, 0x03, 0x02, 0x03, 0x0c, 0x03, 0x13, 0x03,
+  0x14, 0x03, 0x15, 0x03, 0x16, 0x03, 0x17, 0x03, 0x18, 0x03, 0x19, 0x03,
+  0x1a, 0x03, 0x1b, 0x03, 0x1c, 0x03, 0x1d, 0x03, 0x1e, 0x03, 0x1f, 0x03,
+  0x20, 0x03, 0x21, 0x03, 0x22, 0x03, 0x23, 0x03, 0x24, 0x03, 0x25, 0x03,
+  0x26, 0x03, 0x27, 0x03, 0x28, 0x03, 0x29, 0x03, 0x2a, 0x03, 0x2b, 0x03,
+  0x2c, 0x03, 0x2d, 0x03, 0x2e, 0x03, 0x2f, 0x03, 0x01, 0x03, 0x30, 0x15,
+  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+  0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x19, 0x31, 0x01,
+  0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xff, 0x00, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+  0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x01, 0x01, 0x00, 0xf3, 0x00, 0xd0, 0x00, 0x00, 0x00,
+  0x01, 0x44, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1d,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0c,
+  0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x06, 0x02, 0x00, 0x00, 0x05,
+  0x03, 0x02, 0x00, 0x0c, 0x04, 0x05, 0x00, 0x00, 0x10, 0x30, 0x80, 0x15,
+  0x01, 0x04, 0x00, 0x16, 0x01, 0x00, 0x00, 0x06, 0x03, 0x32, 0x04, 0x00,
+  0x00, 0x00, 0x40, 0x03, 0x33, 0x03, 0x34, 0x03, 0x31, 0x04, 0x00, 0x10,
+  0x30, 0x80, 0x00, 0x7c, 0x35, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01,
+  0x02, 0x00, 0x2f, 0x41, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x02, 0x00, 0x00,
+  0x04, 0x00, 0x80, 0x0c, 0x01, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x80, 0x0c,
+  0x02, 0x06, 0x00, 0x00, 0x14, 0x00, 0x80, 0x0c, 0x03, 0x08, 0x00, 0x00,
+  0x1c, 0x00, 0x80, 0x0c, 0x04, 0x0a, 0x00, 0x00, 0x24, 0x00, 0x80, 0x0c,
+  0x05, 0x0c, 0x00, 0x00, 0x2c, 0x00, 0x80, 0x0c, 0x06, 0x0e, 0x00, 0x00,
+  0x34, 0x00, 0x80, 0x0c, 0x07, 0x11, 0x00, 0x00, 0x40, 0xf0, 0x80, 0x0c,
+  0x08, 0x13, 0x00, 0x00, 0x48, 0xf0, 0x80, 0x0c, 0x09, 0x15, 0x00, 0x00,
+  0x50, 0xf0, 0x80, 0x0c, 0x0a, 0x17, 0x00, 0x00, 0x58, 0xf0, 0x80, 0x0c,
+  0x0b, 0x1a, 0x00, 0x00, 0x64, 0x80, 0x81, 0x0c, 0x0c, 0x1c, 0x00, 0x00,
+  0x6c, 0x80, 0x81, 0x0c, 0x0d, 0x1e, 0x00, 0x00, 0x74, 0x80, 0x81, 0x0c,
+  0x0e, 0x21, 0x00, 0x00, 0x80, 0xf0, 0x81, 0x40, 0x0f, 0x22, 0x00, 0x46,
+  0x00, 0x05, 0x00, 0x46, 0x00, 0x00, 0x00, 0x46, 0x00, 0x01, 0x00, 0x46,
+  0x00, 0x02, 0x00, 0x46, 0x00, 0x06, 0x00, 0x0c, 0x10, 0x24, 0x00, 0x00,
+  0x00, 0x30, 0x42, 0x10, 0x0f, 0x10, 0xf5, 0x25, 0x00, 0x00, 0x00, 0x40,
+  0x0f, 0x26, 0x00, 0x0c, 0x10, 0x24, 0x00, 0x00, 0x00, 0x30, 0x42, 0x10,
+  0x0f, 0x10, 0x88, 0x27, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0x28,
+  0x03, 0x36, 0x03, 0x37, 0x04, 0x00, 0x04, 0x00, 0x80, 0x03, 0x38, 0x04,
+  0x00, 0x0c, 0x00, 0x80, 0x03, 0x39, 0x04, 0x00, 0x14, 0x00, 0x80, 0x03,
+  0x3a, 0x04, 0x00, 0x1c, 0x00, 0x80, 0x03, 0x3b, 0x04, 0x00, 0x24, 0x00,
+  0x80, 0x03, 0x3c, 0x04, 0x00, 0x2c, 0x00, 0x80, 0x03, 0x3d, 0x04, 0x00,
+  0x34, 0x00, 0x80, 0x03, 0x3e, 0x03, 0x3f, 0x04, 0x00, 0x40, 0xf0, 0x80,
+  0x03, 0x40, 0x04, 0x00, 0x48, 0xf0, 0x80, 0x03, 0x41, 0x04, 0x00, 0x50,
+  0xf0, 0x80, 0x03, 0x42, 0x04, 0x00, 0x58, 0xf0, 0x80, 0x03, 0x43, 0x03,
+  0x44, 0x04, 0x00, 0x64, 0x80, 0x81, 0x03, 0x45, 0x04, 0x00, 0x6c, 0x80,
+  0x81, 0x03, 0x46, 0x04, 0x00, 0x74, 0x80, 0x81, 0x03, 0x47, 0x03, 0x48,
+  0x04, 0x00, 0x80, 0xf0, 0x81, 0x06, 0x15, 0x03, 0x34, 0x04, 0x00, 0x00,
+  0x30, 0x42, 0x03, 0x31, 0x06, 0x16, 0x03, 0x35, 0x02, 0x15, 0x16, 0x01,
+  0x00, 0x01, 0x18, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x17,
+};
+
+/* This is src/lua/import/text.lua */
+static const unsigned char lazy_script_table_8[] = {
+  0x05, 0x02, 0x1b, 0x0e, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x44, 0x6f,
+  0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x0f, 0x43, 0x72, 0x65, 0x61, 0x74,
+  0x65, 0x50, 0x61, 0x72, 0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x01, 0x50,
+  0x0f, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x50, 0x61, 0x72, 0x61, 0x67,
+  0x72, 0x61, 0x70, 0x68, 0x11, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x50,
+  0x61, 0x72, 0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x41, 0x74, 0x10, 0x49,
+  0x6d, 0x70, 0x6f, 0x72, 0x74, 0x54, 0x65, 0x78, 0x74, 0x53, 0x74, 0x72,
+  0x69, 0x6e, 0x67, 0x10, 0x49, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x46, 0x69,
+  0x6c, 0x65, 0x57, 0x69, 0x74, 0x68, 0x55, 0x49, 0x10, 0x49, 0x6d, 0x70,
+  0x6f, 0x72, 0x74, 0x20, 0x54, 0x65, 0x78, 0x74, 0x20, 0x46, 0x69, 0x6c,
+  0x65, 0x03, 0x43, 0x6d, 0x64, 0x0e, 0x49, 0x6d, 0x70, 0x6f, 0x72, 0x74,
+  0x54, 0x65, 0x78, 0x74, 0x46, 0x69, 0x6c, 0x65, 0x02, 0x77, 0x67, 0x06,
+  0x49, 0x54, 0x41, 0x4c, 0x49, 0x43, 0x09, 0x55, 0x4e, 0x44, 0x45, 0x52,
+  0x4c, 0x49, 0x4e, 0x45, 0x09, 0x70, 0x61, 0x72, 0x73, 0x65, 0x77, 0x6f,
+  0x72, 0x64, 0x07, 0x77, 0x72, 0x69, 0x74, 0x65, 0x75, 0x38, 0x0a, 0x69,
+  0x6d, 0x70, 0x6f, 0x72, 0x74, 0x74, 0x65, 0x78, 0x74, 0x05, 0x62, 0x69,
+  0x74, 0x33, 0x32, 0x04, 0x62, 0x61, 0x6e, 0x64, 0x03, 0x62, 0x6f, 0x72,
+  0x04, 0x62, 0x78, 0x6f, 0x72, 0x05, 0x62, 0x74, 0x65, 0x73, 0x74, 0x06,
+  0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x04, 0x63, 0x68, 0x61, 0x72, 0x04,
+  0x66, 0x69, 0x6e, 0x64, 0x03, 0x73, 0x75, 0x62, 0x05, 0x74, 0x61, 0x62,
+  0x6c, 0x65, 0x06, 0x63, 0x6f, 0x6e, 0x63, 0x61, 0x74, 0x03, 0x0c, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x1a, 0x0c, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0x15, 0x01, 0x01, 0x02, 0x09, 0x02, 0x00, 0x00, 0x06, 0x03, 0x00,
+  0x00, 0x15, 0x02, 0x02, 0x04, 0x4c, 0x02, 0x08, 0x00, 0x0c, 0x09, 0x03,
+  0x00, 0x00, 0x00, 0x20, 0x40, 0x05, 0x0a, 0x04, 0x00, 0x06, 0x0b, 0x06,
+  0x00, 0x15, 0x09, 0x03, 0x00, 0x14, 0x07, 0x01, 0xb4, 0x05, 0x00, 0x00,
+  0x00, 0x15, 0x07, 0x00, 0x01, 0x3a, 0x02, 0xf7, 0xff, 0x02, 0x00, 0x00,
+  0x00, 0x34, 0x02, 0x01, 0x00, 0x04, 0x03, 0x01, 0x00, 0x20, 0x03, 0x05,
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x04, 0x01, 0x00, 0x14, 0x02, 0x01,
+  0x54, 0x06, 0x00, 0x00, 0x00, 0x15, 0x02, 0x03, 0x01, 0x16, 0x01, 0x02,
+  0x00, 0x07, 0x03, 0x01, 0x04, 0x00, 0x00, 0x00, 0x40, 0x03, 0x02, 0x04,
+  0x00, 0x00, 0x20, 0x40, 0x03, 0x03, 0x03, 0x04, 0x03, 0x05, 0x00, 0x17,
+  0x06, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x0c, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0x06, 0x02, 0x00, 0x00, 0x05, 0x03, 0x02, 0x00, 0x0c, 0x04, 0x05,
+  0x00, 0x00, 0x10, 0x30, 0x80, 0x03, 0x05, 0x01, 0x00, 0x15, 0x01, 0x05,
+  0x00, 0x16, 0x01, 0x00, 0x00, 0x06, 0x03, 0x07, 0x04, 0x00, 0x00, 0x00,
+  0x40, 0x03, 0x08, 0x03, 0x09, 0x03, 0x06, 0x04, 0x00, 0x10, 0x30, 0x80,
+  0x00, 0x26, 0x0a, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xff, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x02,
+  0x00, 0x27, 0x41, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x02, 0x00, 0x00, 0x04,
+  0x00, 0x80, 0x0c, 0x01, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x80, 0x0c, 0x02,
+  0x06, 0x00, 0x00, 0x14, 0x00, 0x80, 0x0c, 0x03, 0x08, 0x00, 0x00, 0x1c,
+  0x00, 0x80, 0x0c, 0x04, 0x0a, 0x00, 0x00, 0x24, 0x00, 0x80, 0x0c, 0x05,
+  0x0d, 0x00, 0x00, 0x30, 0xb0, 0x80, 0x0c, 0x06, 0x0f, 0x00, 0x00, 0x38,
+  0xb0, 0x80, 0x0c, 0x07, 0x11, 0x00, 0x00, 0x40, 0xb0, 0x80, 0x0c, 0x08,
+  0x13, 0x00, 0x00, 0x48, 0xb0, 0x80, 0x0c, 0x09, 0x16, 0x00, 0x00, 0x54,
+  0x40, 0x81, 0x0c, 0x0a, 0x18, 0x00, 0x00, 0x5c, 0x40, 0x81, 0x0c, 0x0b,
+  0x1a, 0x00, 0x00, 0x64, 0x40, 0x81, 0x0c, 0x0c, 0x1d, 0x00, 0x00, 0x70,
+  0xb0, 0x81, 0x40, 0x0d, 0x1e, 0x00, 0x46, 0x00, 0x04, 0x00, 0x0c, 0x0e,
+  0x20, 0x00, 0x00, 0x00, 0xf0, 0x41, 0x10, 0x0d, 0x0e, 0xdd, 0x21, 0x00,
+  0x00, 0x00, 0x40, 0x0d, 0x22, 0x00, 0x0c, 0x0e, 0x20, 0x00, 0x00, 0x00,
+  0xf0, 0x41, 0x10, 0x0d, 0x0e, 0x0f, 0x23, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x01, 0x00, 0x24, 0x03, 0x0b, 0x03, 0x0c, 0x04, 0x00, 0x04, 0x00, 0x80,
+  0x03, 0x0d, 0x04, 0x00, 0x0c, 0x00, 0x80, 0x03, 0x0e, 0x04, 0x00, 0x14,
+  0x00, 0x80, 0x03, 0x0f, 0x04, 0x00, 0x1c, 0x00, 0x80, 0x03, 0x10, 0x04,
+  0x00, 0x24, 0x00, 0x80, 0x03, 0x11, 0x03, 0x12, 0x04, 0x00, 0x30, 0xb0,
+  0x80, 0x03, 0x13, 0x04, 0x00, 0x38, 0xb0, 0x80, 0x03, 0x14, 0x04, 0x00,
+  0x40, 0xb0, 0x80, 0x03, 0x15, 0x04, 0x00, 0x48, 0xb0, 0x80, 0x03, 0x16,
+  0x03, 0x17, 0x04, 0x00, 0x54, 0x40, 0x81, 0x03, 0x18, 0x04, 0x00, 0x5c,
+  0x40, 0x81, 0x03, 0x19, 0x04, 0x00, 0x64, 0x40, 0x81, 0x03, 0x1a, 0x03,
+  0x1b, 0x04, 0x00, 0x70, 0xb0, 0x81, 0x06, 0x00, 0x03, 0x09, 0x04, 0x00,
+  0x00, 0xf0, 0x41, 0x03, 0x06, 0x06, 0x01, 0x03, 0x0a, 0x02, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x18, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x02,
+};
+
+/* This is src/lua/import/opendocument.lua */
+static const unsigned char lazy_script_table_9[] = {
+  0x05, 0x02, 0x67, 0x07, 0x6f, 0x70, 0x65, 0x6e, 0x74, 0x61, 0x67, 0x08,
+  0x63, 0x6c, 0x6f, 0x73, 0x65, 0x74, 0x61, 0x67, 0x0c, 0x73, 0x6b, 0x69,
+  0x70, 0x5f, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x2f, 0x75, 0x72,
+  0x6e, 0x3a, 0x6f, 0x61, 0x73, 0x69, 0x73, 0x3a, 0x6e, 0x61, 0x6d, 0x65,
+  0x73, 0x3a, 0x74, 0x63, 0x3a, 0x6f, 0x70, 0x65, 0x6e, 0x64, 0x6f, 0x63,
+  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3a, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+  0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x31, 0x2e, 0x30, 0x05, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x0c, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x2d,
+  0x6e, 0x61, 0x6d, 0x65, 0x3b, 0x75, 0x72, 0x6e, 0x3a, 0x6f, 0x61, 0x73,
+  0x69, 0x73, 0x3a, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x3a, 0x74, 0x63, 0x3a,
+  0x6f, 0x70, 0x65, 0x6e, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+  0x3a, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x73, 0x6c, 0x2d, 0x66,
+  0x6f, 0x2d, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x74, 0x69, 0x62, 0x6c, 0x65,
+  0x3a, 0x31, 0x2e, 0x30, 0x0b, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73,
+  0x74, 0x79, 0x6c, 0x65, 0x0c, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77,
+  0x65, 0x69, 0x67, 0x68, 0x74, 0x15, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2d,
+  0x75, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x73, 0x74,
+  0x79, 0x6c, 0x65, 0x0c, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d,
+  0x6c, 0x65, 0x66, 0x74, 0x06, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x0f,
+  0x74, 0x65, 0x78, 0x74, 0x2d, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74,
+  0x69, 0x65, 0x73, 0x06, 0x69, 0x74, 0x61, 0x6c, 0x69, 0x63, 0x04, 0x62,
+  0x6f, 0x6c, 0x64, 0x05, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x09, 0x75, 0x6e,
+  0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x14, 0x70, 0x61, 0x72, 0x61,
+  0x67, 0x72, 0x61, 0x70, 0x68, 0x2d, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72,
+  0x74, 0x69, 0x65, 0x73, 0x08, 0x69, 0x6e, 0x64, 0x65, 0x6e, 0x74, 0x65,
+  0x64, 0x0b, 0x70, 0x61, 0x72, 0x73, 0x65, 0x5f, 0x73, 0x74, 0x79, 0x6c,
+  0x65, 0x05, 0x61, 0x74, 0x74, 0x72, 0x73, 0x09, 0x70, 0x61, 0x72, 0x61,
+  0x67, 0x72, 0x61, 0x70, 0x68, 0x01, 0x51, 0x07, 0x72, 0x65, 0x73, 0x6f,
+  0x6c, 0x76, 0x65, 0x15, 0x72, 0x65, 0x73, 0x6f, 0x6c, 0x76, 0x65, 0x5f,
+  0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x74, 0x79, 0x6c, 0x65,
+  0x73, 0x05, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x0e, 0x63, 0x6f, 0x6c, 0x6c,
+  0x65, 0x63, 0x74, 0x5f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x2e, 0x75,
+  0x72, 0x6e, 0x3a, 0x6f, 0x61, 0x73, 0x69, 0x73, 0x3a, 0x6e, 0x61, 0x6d,
+  0x65, 0x73, 0x3a, 0x74, 0x63, 0x3a, 0x6f, 0x70, 0x65, 0x6e, 0x64, 0x6f,
+  0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3a, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+  0x3a, 0x74, 0x65, 0x78, 0x74, 0x3a, 0x31, 0x2e, 0x30, 0x02, 0x20, 0x63,
+  0x0b, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2d, 0x6e, 0x61, 0x6d, 0x65,
+  0x09, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x5f, 0x6f, 0x66, 0x66, 0x04, 0x74,
+  0x65, 0x78, 0x74, 0x02, 0x5e, 0x20, 0x03, 0x25, 0x53, 0x2b, 0x09, 0x66,
+  0x6c, 0x75, 0x73, 0x68, 0x77, 0x6f, 0x72, 0x64, 0x02, 0x20, 0x24, 0x01,
+  0x73, 0x08, 0x74, 0x6f, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x04, 0x73,
+  0x70, 0x61, 0x6e, 0x00, 0x08, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x5f, 0x6f,
+  0x6e, 0x08, 0x61, 0x64, 0x64, 0x5f, 0x74, 0x65, 0x78, 0x74, 0x0e, 0x20,
+  0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x6c, 0x65, 0x76, 0x65,
+  0x6c, 0x01, 0x70, 0x0e, 0x66, 0x6c, 0x75, 0x73, 0x68, 0x70, 0x61, 0x72,
+  0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x01, 0x68, 0x06, 0x61, 0x73, 0x73,
+  0x65, 0x72, 0x74, 0x01, 0x48, 0x04, 0x6c, 0x69, 0x73, 0x74, 0x11, 0x69,
+  0x6d, 0x70, 0x6f, 0x72, 0x74, 0x5f, 0x70, 0x61, 0x72, 0x61, 0x67, 0x72,
+  0x61, 0x70, 0x68, 0x73, 0x0c, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x2d,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x02, 0x4c, 0x4e, 0x02, 0x4c, 0x42, 0x30,
+  0x75, 0x72, 0x6e, 0x3a, 0x6f, 0x61, 0x73, 0x69, 0x73, 0x3a, 0x6e, 0x61,
+  0x6d, 0x65, 0x73, 0x3a, 0x74, 0x63, 0x3a, 0x6f, 0x70, 0x65, 0x6e, 0x64,
+  0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3a, 0x78, 0x6d, 0x6c, 0x6e,
+  0x73, 0x3a, 0x6f, 0x66, 0x66, 0x69, 0x63, 0x65, 0x3a, 0x31, 0x2e, 0x30,
+  0x06, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x10, 0x61, 0x75, 0x74, 0x6f,
+  0x6d, 0x61, 0x74, 0x69, 0x63, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73,
+  0x04, 0x62, 0x6f, 0x64, 0x79, 0x01, 0x50, 0x0a, 0x69, 0x6d, 0x70, 0x6f,
+  0x72, 0x74, 0x5f, 0x78, 0x6d, 0x6c, 0x0b, 0x46, 0x69, 0x6c, 0x65, 0x42,
+  0x72, 0x6f, 0x77, 0x73, 0x65, 0x72, 0x0f, 0x49, 0x6d, 0x70, 0x6f, 0x72,
+  0x74, 0x20, 0x4f, 0x44, 0x54, 0x20, 0x46, 0x69, 0x6c, 0x65, 0x0c, 0x49,
+  0x6d, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3a, 0x10,
+  0x49, 0x6d, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x4d, 0x65, 0x73,
+  0x73, 0x61, 0x67, 0x65, 0x0c, 0x49, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x69,
+  0x6e, 0x67, 0x2e, 0x2e, 0x2e, 0x0a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73,
+  0x2e, 0x78, 0x6d, 0x6c, 0x04, 0x6f, 0x70, 0x65, 0x6e, 0x0b, 0x63, 0x6f,
+  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2e, 0x78, 0x6d, 0x6c, 0x05, 0x63, 0x6c,
+  0x6f, 0x73, 0x65, 0x0c, 0x4d, 0x6f, 0x64, 0x61, 0x6c, 0x4d, 0x65, 0x73,
+  0x73, 0x61, 0x67, 0x65, 0x40, 0x54, 0x68, 0x65, 0x20, 0x69, 0x6d, 0x70,
+  0x6f, 0x72, 0x74, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x2c, 0x20,
+  0x70, 0x72, 0x6f, 0x62, 0x61, 0x62, 0x6c, 0x79, 0x20, 0x62, 0x65, 0x63,
+  0x61, 0x75, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6c,
+  0x65, 0x20, 0x63, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x6e, 0x6f, 0x74, 0x20,
+  0x62, 0x65, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x2e, 0x0b, 0x51, 0x75,
+  0x65, 0x75, 0x65, 0x52, 0x65, 0x64, 0x72, 0x61, 0x77, 0x0e, 0x43, 0x72,
+  0x65, 0x61, 0x74, 0x65, 0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+  0x0e, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x49, 0x6d, 0x70, 0x6f, 0x72,
+  0x74, 0x65, 0x72, 0x05, 0x72, 0x65, 0x73, 0x65, 0x74, 0x11, 0x64, 0x65,
+  0x6c, 0x65, 0x74, 0x65, 0x50, 0x61, 0x72, 0x61, 0x67, 0x72, 0x61, 0x70,
+  0x68, 0x41, 0x74, 0x08, 0x4c, 0x65, 0x61, 0x66, 0x6e, 0x61, 0x6d, 0x65,
+  0x0b, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x53, 0x65, 0x74,
+  0x0d, 0x5f, 0x66, 0x69, 0x6e, 0x64, 0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65,
+  0x6e, 0x74, 0x01, 0x2d, 0x0b, 0x61, 0x64, 0x64, 0x44, 0x6f, 0x63, 0x75,
+  0x6d, 0x65, 0x6e, 0x74, 0x0a, 0x73, 0x65, 0x74, 0x43, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x74, 0x0d, 0x49, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x4f, 0x44,
+  0x54, 0x46, 0x69, 0x6c, 0x65, 0x02, 0x77, 0x67, 0x06, 0x49, 0x54, 0x41,
+  0x4c, 0x49, 0x43, 0x09, 0x55, 0x4e, 0x44, 0x45, 0x52, 0x4c, 0x49, 0x4e,
+  0x45, 0x04, 0x42, 0x4f, 0x4c, 0x44, 0x09, 0x70, 0x61, 0x72, 0x73, 0x65,
+  0x77, 0x6f, 0x72, 0x64, 0x07, 0x77, 0x72, 0x69, 0x74, 0x65, 0x75, 0x38,
+  0x07, 0x6f, 0x70, 0x65, 0x6e, 0x7a, 0x69, 0x70, 0x09, 0x78, 0x6d, 0x6c,
+  0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x73, 0x05, 0x62, 0x69, 0x74, 0x33, 0x32,
+  0x04, 0x62, 0x61, 0x6e, 0x64, 0x03, 0x62, 0x6f, 0x72, 0x04, 0x62, 0x78,
+  0x6f, 0x72, 0x05, 0x62, 0x74, 0x65, 0x73, 0x74, 0x06, 0x73, 0x74, 0x72,
+  0x69, 0x6e, 0x67, 0x04, 0x63, 0x68, 0x61, 0x72, 0x04, 0x66, 0x69, 0x6e,
+  0x64, 0x03, 0x73, 0x75, 0x62, 0x06, 0x67, 0x6d, 0x61, 0x74, 0x63, 0x68,
+  0x05, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x06, 0x63, 0x6f, 0x6e, 0x63, 0x61,
+  0x74, 0x03, 0x43, 0x6d, 0x64, 0x0b, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x04, 0x01, 0x01, 0x00, 0x06, 0x02, 0x00, 0x00, 0x15, 0x02, 0x01,
+  0x02, 0x19, 0x02, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x50, 0x02, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x80, 0x27, 0x01, 0x01, 0x01, 0x17, 0x00, 0x06,
+  0x00, 0x50, 0x02, 0x05, 0x00, 0x02, 0x00, 0x00, 0x80, 0x28, 0x01, 0x01,
+  0x01, 0x4f, 0x01, 0x02, 0x00, 0x03, 0x00, 0x00, 0x80, 0x16, 0x00, 0x01,
+  0x00, 0x18, 0x00, 0xf1, 0xff, 0x16, 0x00, 0x01, 0x00, 0x04, 0x03, 0x01,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x03, 0x02, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x03, 0x01,
+  0x18, 0x00, 0x02, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x01, 0x01, 0x00, 0x01, 0xf7, 0x0d, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x03, 0x01, 0x00, 0x00, 0x00, 0x46, 0x05, 0x04, 0x00, 0x00, 0x05, 0x05,
+  0x01, 0x00, 0x31, 0x03, 0x04, 0x05, 0x05, 0x05, 0x00, 0x00, 0x05, 0x06,
+  0x02, 0x00, 0x31, 0x04, 0x05, 0x06, 0x05, 0x06, 0x03, 0x00, 0x05, 0x07,
+  0x04, 0x00, 0x31, 0x05, 0x06, 0x07, 0x05, 0x07, 0x03, 0x00, 0x05, 0x08,
+  0x05, 0x00, 0x31, 0x06, 0x07, 0x08, 0x05, 0x08, 0x00, 0x00, 0x05, 0x09,
+  0x06, 0x00, 0x31, 0x07, 0x08, 0x09, 0x05, 0x09, 0x03, 0x00, 0x05, 0x0a,
+  0x07, 0x00, 0x31, 0x08, 0x09, 0x0a, 0x36, 0x09, 0x09, 0x00, 0x0d, 0x0a,
+  0x02, 0x04, 0x10, 0x0a, 0x09, 0xc4, 0x08, 0x00, 0x00, 0x00, 0x06, 0x0a,
+  0x01, 0x00, 0x15, 0x0a, 0x01, 0x05, 0x1a, 0x0a, 0x2a, 0x00, 0x50, 0x0a,
+  0x02, 0x00, 0x0a, 0x00, 0x00, 0x80, 0x17, 0x00, 0x27, 0x00, 0x50, 0x0a,
+  0x25, 0x00, 0x0b, 0x00, 0x00, 0x80, 0x50, 0x0b, 0x19, 0x00, 0x00, 0x00,
+  0x00, 0x80, 0x50, 0x0c, 0x17, 0x00, 0x0c, 0x00, 0x00, 0x80, 0x0d, 0x0f,
+  0x0d, 0x05, 0x50, 0x0f, 0x02, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x03, 0x0e,
+  0x00, 0x01, 0x03, 0x0e, 0x01, 0x00, 0x10, 0x0e, 0x09, 0x49, 0x0d, 0x00,
+  0x00, 0x00, 0x0d, 0x0f, 0x0d, 0x06, 0x50, 0x0f, 0x02, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x03, 0x0e, 0x00, 0x01, 0x03, 0x0e, 0x01, 0x00, 0x10, 0x0e,
+  0x09, 0x2c, 0x0e, 0x00, 0x00, 0x00, 0x0d, 0x0f, 0x0d, 0x07, 0x50, 0x0f,
+  0x02, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x03, 0x0e, 0x00, 0x01, 0x03, 0x0e,
+  0x01, 0x00, 0x10, 0x0e, 0x09, 0x46, 0x10, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x07, 0x00, 0x50, 0x0b, 0x06, 0x00, 0x00, 0x00, 0x00, 0x80, 0x50, 0x0c,
+  0x04, 0x00, 0x11, 0x00, 0x00, 0x80, 0x0d, 0x0e, 0x0d, 0x08, 0x10, 0x0e,
+  0x09, 0xfe, 0x12, 0x00, 0x00, 0x00, 0x09, 0x0e, 0x00, 0x00, 0x06, 0x0f,
+  0x01, 0x00, 0x15, 0x0e, 0x02, 0x01, 0x18, 0x00, 0xd3, 0xff, 0x0d, 0x0a,
+  0x02, 0x03, 0x0e, 0x09, 0x00, 0x0a, 0x16, 0x00, 0x01, 0x00, 0x13, 0x03,
+  0x04, 0x03, 0x05, 0x03, 0x06, 0x03, 0x07, 0x03, 0x08, 0x03, 0x09, 0x03,
+  0x0a, 0x03, 0x0b, 0x03, 0x0c, 0x05, 0x01, 0x08, 0x03, 0x02, 0x03, 0x01,
+  0x03, 0x0d, 0x03, 0x0e, 0x03, 0x0f, 0x03, 0x10, 0x03, 0x11, 0x03, 0x12,
+  0x03, 0x13, 0x00, 0x50, 0x14, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x03, 0x01, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00,
+  0x00, 0xf4, 0x10, 0x00, 0x01, 0x51, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01,
+  0x09, 0x00, 0x00, 0x00, 0x4a, 0x09, 0x02, 0x00, 0x00, 0x0d, 0x01, 0x02,
+  0x00, 0x1a, 0x01, 0x01, 0x00, 0x16, 0x01, 0x02, 0x00, 0x09, 0x03, 0x01,
+  0x00, 0x0d, 0x02, 0x03, 0x00, 0x1a, 0x02, 0x03, 0x00, 0x09, 0x04, 0x02,
+  0x00, 0x0d, 0x03, 0x04, 0x00, 0x1a, 0x03, 0x02, 0x00, 0x09, 0x03, 0x03,
+  0x00, 0x16, 0x03, 0x02, 0x00, 0x09, 0x03, 0x02, 0x00, 0x03, 0x04, 0x01,
+  0x00, 0x0e, 0x04, 0x03, 0x00, 0x0f, 0x04, 0x02, 0xc4, 0x00, 0x00, 0x00,
+  0x00, 0x1a, 0x04, 0x05, 0x00, 0x09, 0x03, 0x04, 0x00, 0x0f, 0x04, 0x02,
+  0xc4, 0x00, 0x00, 0x00, 0x00, 0x15, 0x03, 0x02, 0x02, 0x19, 0x03, 0x01,
+  0x00, 0x09, 0x03, 0x03, 0x00, 0x09, 0x04, 0x02, 0x00, 0x02, 0x05, 0x00,
+  0x00, 0x0e, 0x05, 0x04, 0x00, 0x0f, 0x04, 0x03, 0xd0, 0x01, 0x00, 0x00,
+  0x00, 0x0f, 0x05, 0x02, 0x49, 0x02, 0x00, 0x00, 0x00, 0x1a, 0x05, 0x07,
+  0x00, 0x09, 0x07, 0x05, 0x00, 0x4a, 0x1f, 0x04, 0x03, 0x07, 0x00, 0x00,
+  0x00, 0x06, 0x06, 0x04, 0x00, 0x09, 0x05, 0x06, 0x00, 0x15, 0x05, 0x03,
+  0x02, 0x06, 0x04, 0x05, 0x00, 0x0f, 0x05, 0x02, 0x2c, 0x03, 0x00, 0x00,
+  0x00, 0x1a, 0x05, 0x07, 0x00, 0x09, 0x07, 0x07, 0x00, 0x4a, 0x1f, 0x04,
+  0x03, 0x07, 0x00, 0x00, 0x00, 0x06, 0x06, 0x04, 0x00, 0x09, 0x05, 0x06,
+  0x00, 0x15, 0x05, 0x03, 0x02, 0x06, 0x04, 0x05, 0x00, 0x0f, 0x05, 0x02,
+  0x46, 0x04, 0x00, 0x00, 0x00, 0x1a, 0x05, 0x07, 0x00, 0x09, 0x07, 0x08,
+  0x00, 0x4a, 0x1f, 0x04, 0x03, 0x07, 0x00, 0x00, 0x00, 0x06, 0x06, 0x04,
+  0x00, 0x09, 0x05, 0x06, 0x00, 0x15, 0x05, 0x03, 0x02, 0x06, 0x04, 0x05,
+  0x00, 0x36, 0x05, 0x06, 0x00, 0x10, 0x04, 0x05, 0xd0, 0x01, 0x00, 0x00,
+  0x00, 0x0f, 0x07, 0x02, 0xfe, 0x07, 0x00, 0x00, 0x00, 0x1a, 0x07, 0x02,
+  0x00, 0x05, 0x06, 0x08, 0x00, 0x17, 0x00, 0x02, 0x00, 0x0f, 0x06, 0x03,
+  0x8b, 0x05, 0x00, 0x00, 0x00, 0x10, 0x06, 0x05, 0x8b, 0x05, 0x00, 0x00,
+  0x00, 0x09, 0x06, 0x00, 0x00, 0x0e, 0x05, 0x06, 0x00, 0x16, 0x05, 0x02,
+  0x00, 0x09, 0x03, 0x0c, 0x03, 0x15, 0x03, 0x0e, 0x03, 0x0f, 0x03, 0x11,
+  0x03, 0x16, 0x05, 0x02, 0x01, 0x05, 0x03, 0x13, 0x03, 0x17, 0x00, 0x77,
+  0x18, 0x01, 0x18, 0x00, 0x00, 0x01, 0x01, 0x02, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x00, 0x01, 0x78, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x01,
+  0x05, 0x00, 0x00, 0x00, 0x18, 0x35, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x35, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x03, 0x00,
+  0x00, 0x46, 0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x00, 0x46, 0x00, 0x02,
+  0x00, 0x46, 0x02, 0x00, 0x00, 0x46, 0x00, 0x03, 0x00, 0x46, 0x02, 0x01,
+  0x00, 0x46, 0x02, 0x02, 0x00, 0x46, 0x02, 0x03, 0x00, 0x46, 0x02, 0x04,
+  0x00, 0x06, 0x04, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x02, 0x06, 0x00,
+  0x00, 0x4c, 0x04, 0x03, 0x00, 0x06, 0x09, 0x03, 0x00, 0x06, 0x0a, 0x07,
+  0x00, 0x15, 0x09, 0x02, 0x01, 0x3a, 0x04, 0xfc, 0xff, 0x01, 0x00, 0x00,
+  0x00, 0x16, 0x01, 0x02, 0x00, 0x00, 0x01, 0x02, 0x73, 0x19, 0x01, 0x18,
+  0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xff, 0x00, 0x03,
+  0x74, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x02, 0x02, 0x00, 0x00, 0x00, 0x17,
+  0x06, 0x02, 0x01, 0x00, 0x15, 0x02, 0x01, 0x05, 0x1a, 0x02, 0x02, 0x00,
+  0x50, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x80, 0x16, 0x00, 0x01, 0x00,
+  0x50, 0x02, 0x0e, 0x00, 0x01, 0x00, 0x00, 0x80, 0x50, 0x03, 0x09, 0x00,
+  0x02, 0x00, 0x00, 0x80, 0x50, 0x04, 0x07, 0x00, 0x03, 0x00, 0x00, 0x80,
+  0x09, 0x06, 0x00, 0x00, 0x06, 0x07, 0x00, 0x00, 0x06, 0x08, 0x01, 0x00,
+  0x06, 0x09, 0x05, 0x00, 0x15, 0x06, 0x04, 0x01, 0x17, 0x00, 0x03, 0x00,
+  0x09, 0x06, 0x01, 0x00, 0x06, 0x07, 0x01, 0x00, 0x15, 0x06, 0x02, 0x01,
+  0x18, 0x00, 0xea, 0xff, 0x16, 0x00, 0x01, 0x00, 0x04, 0x03, 0x02, 0x03,
+  0x01, 0x03, 0x04, 0x03, 0x1a, 0x00, 0x9e, 0x01, 0x1b, 0x01, 0x18, 0x01,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xf8, 0x0c, 0x9f, 0x00,
+  0x00, 0x00, 0x00, 0x13, 0x03, 0x04, 0x00, 0x00, 0x00, 0x74, 0x05, 0x04,
+  0x00, 0x00, 0x05, 0x05, 0x01, 0x00, 0x31, 0x03, 0x04, 0x05, 0x05, 0x05,
+  0x00, 0x00, 0x05, 0x06, 0x02, 0x00, 0x31, 0x04, 0x05, 0x06, 0x35, 0x05,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x02, 0x00, 0x15, 0x06,
+  0x01, 0x05, 0x19, 0x06, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x50, 0x06,
+  0x0f, 0x00, 0x03, 0x00, 0x00, 0x80, 0x34, 0x0a, 0x05, 0x00, 0x4f, 0x0a,
+  0x02, 0x00, 0x04, 0x00, 0x00, 0x80, 0x16, 0x00, 0x01, 0x00, 0x0d, 0x0b,
+  0x05, 0x0a, 0x02, 0x0c, 0x00, 0x00, 0x0e, 0x0c, 0x05, 0x0a, 0x4f, 0x0b,
+  0x5c, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x0e, 0x0b, 0x00, 0x14, 0x0c,
+  0x01, 0x62, 0x05, 0x00, 0x00, 0x00, 0x15, 0x0c, 0x03, 0x01, 0x17, 0x00,
+  0x56, 0x00, 0x50, 0x06, 0x23, 0x00, 0x06, 0x00, 0x00, 0x80, 0x03, 0x0a,
+  0x00, 0x00, 0x09, 0x0b, 0x00, 0x00, 0x06, 0x0c, 0x07, 0x00, 0x05, 0x0d,
+  0x07, 0x00, 0x15, 0x0b, 0x03, 0x02, 0x1a, 0x0b, 0x01, 0x00, 0x03, 0x0a,
+  0x01, 0x00, 0x09, 0x0b, 0x01, 0x00, 0x06, 0x0c, 0x07, 0x00, 0x05, 0x0d,
+  0x08, 0x00, 0x15, 0x0b, 0x03, 0x04, 0x4c, 0x0b, 0x0a, 0x00, 0x1a, 0x0a,
+  0x04, 0x00, 0x03, 0x12, 0x00, 0x00, 0x14, 0x10, 0x01, 0x95, 0x09, 0x00,
+  0x00, 0x00, 0x15, 0x10, 0x03, 0x01, 0x06, 0x12, 0x0e, 0x00, 0x14, 0x10,
+  0x01, 0xd5, 0x06, 0x00, 0x00, 0x00, 0x15, 0x10, 0x03, 0x01, 0x03, 0x0a,
+  0x01, 0x00, 0x3a, 0x0b, 0xf5, 0xff, 0x01, 0x00, 0x00, 0x00, 0x09, 0x0b,
+  0x00, 0x00, 0x06, 0x0c, 0x07, 0x00, 0x05, 0x0d, 0x0a, 0x00, 0x15, 0x0b,
+  0x03, 0x02, 0x1a, 0x0b, 0x37, 0x00, 0x03, 0x0d, 0x00, 0x00, 0x14, 0x0b,
+  0x01, 0x95, 0x09, 0x00, 0x00, 0x00, 0x15, 0x0b, 0x03, 0x01, 0x17, 0x00,
+  0x32, 0x00, 0x50, 0x06, 0x31, 0x00, 0x0b, 0x00, 0x00, 0x80, 0x50, 0x07,
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x80, 0x50, 0x08, 0x14, 0x00, 0x0c, 0x00,
+  0x00, 0x80, 0x0d, 0x0c, 0x09, 0x03, 0x49, 0x3e, 0x0c, 0x02, 0x0c, 0x0b,
+  0x0e, 0x00, 0x00, 0x00, 0xd0, 0x40, 0x15, 0x0b, 0x02, 0x02, 0x30, 0x0a,
+  0x0b, 0x04, 0x04, 0x0d, 0x01, 0x00, 0x27, 0x0b, 0x0a, 0x0f, 0x04, 0x0c,
+  0x01, 0x00, 0x38, 0x0b, 0x05, 0x00, 0x03, 0x10, 0x00, 0x00, 0x14, 0x0e,
+  0x01, 0x95, 0x09, 0x00, 0x00, 0x00, 0x15, 0x0e, 0x03, 0x01, 0x39, 0x0b,
+  0xfb, 0xff, 0x09, 0x0b, 0x02, 0x00, 0x06, 0x0c, 0x02, 0x00, 0x15, 0x0b,
+  0x02, 0x01, 0x17, 0x00, 0x19, 0x00, 0x50, 0x07, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x80, 0x50, 0x08, 0x12, 0x00, 0x10, 0x00, 0x00, 0x80, 0x0d, 0x0c,
+  0x09, 0x04, 0x30, 0x0b, 0x0c, 0x11, 0x0d, 0x0a, 0x00, 0x0b, 0x19, 0x0a,
+  0x01, 0x00, 0x09, 0x0a, 0x03, 0x00, 0x0f, 0x0b, 0x0a, 0xd0, 0x12, 0x00,
+  0x00, 0x00, 0x4f, 0x0b, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x0e,
+  0x0b, 0x00, 0x14, 0x0c, 0x01, 0x31, 0x13, 0x00, 0x00, 0x00, 0x15, 0x0c,
+  0x03, 0x01, 0x34, 0x0d, 0x05, 0x00, 0x27, 0x0c, 0x0d, 0x0f, 0x0e, 0x0b,
+  0x05, 0x0c, 0x17, 0x00, 0x04, 0x00, 0x34, 0x0b, 0x05, 0x00, 0x27, 0x0a,
+  0x0b, 0x0f, 0x04, 0x0b, 0x00, 0x00, 0x0e, 0x0b, 0x05, 0x0a, 0x18, 0x00,
+  0x95, 0xff, 0x16, 0x00, 0x01, 0x00, 0x14, 0x03, 0x1c, 0x03, 0x1d, 0x03,
+  0x1e, 0x03, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x1f, 0x03, 0x20, 0x03, 0x21, 0x03, 0x22, 0x03, 0x23, 0x03, 0x24,
+  0x03, 0x01, 0x03, 0x25, 0x03, 0x26, 0x04, 0x00, 0x00, 0xd0, 0x40, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x03, 0x27, 0x03, 0x28,
+  0x03, 0x15, 0x03, 0x29, 0x00, 0xb0, 0x01, 0x2a, 0x01, 0x18, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x01, 0x01, 0x00,
+  0x01, 0x01, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x01, 0xfb, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x03,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xd2, 0x32, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x04, 0x04, 0x00, 0x00, 0x00, 0x50, 0x05, 0x05, 0x00, 0x00, 0x05, 0x06,
+  0x01, 0x00, 0x31, 0x04, 0x05, 0x06, 0x05, 0x06, 0x00, 0x00, 0x05, 0x07,
+  0x02, 0x00, 0x31, 0x05, 0x06, 0x07, 0x06, 0x06, 0x02, 0x00, 0x15, 0x06,
+  0x01, 0x05, 0x1a, 0x06, 0x02, 0x00, 0x50, 0x06, 0x02, 0x00, 0x03, 0x00,
+  0x00, 0x80, 0x16, 0x00, 0x01, 0x00, 0x50, 0x06, 0x41, 0x00, 0x04, 0x00,
+  0x00, 0x80, 0x50, 0x07, 0x14, 0x00, 0x00, 0x00, 0x00, 0x80, 0x50, 0x08,
+  0x12, 0x00, 0x05, 0x00, 0x00, 0x80, 0x0d, 0x0c, 0x09, 0x05, 0x30, 0x0b,
+  0x0c, 0x06, 0x0d, 0x0a, 0x00, 0x0b, 0x19, 0x0a, 0x01, 0x00, 0x09, 0x0a,
+  0x00, 0x00, 0x09, 0x0b, 0x01, 0x00, 0x06, 0x0c, 0x00, 0x00, 0x06, 0x0d,
+  0x01, 0x00, 0x06, 0x0e, 0x02, 0x00, 0x15, 0x0b, 0x04, 0x01, 0x0f, 0x0e,
+  0x0a, 0x8b, 0x07, 0x00, 0x00, 0x00, 0x2e, 0x0d, 0x0e, 0x03, 0x14, 0x0b,
+  0x01, 0xa8, 0x08, 0x00, 0x00, 0x00, 0x15, 0x0b, 0x03, 0x01, 0x17, 0x00,
+  0x2b, 0x00, 0x50, 0x07, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x80, 0x50, 0x08,
+  0x1b, 0x00, 0x09, 0x00, 0x00, 0x80, 0x0d, 0x0d, 0x09, 0x04, 0x30, 0x0c,
+  0x0d, 0x0a, 0x49, 0x3e, 0x0c, 0x02, 0x0c, 0x0b, 0x0c, 0x00, 0x00, 0x00,
+  0xb0, 0x40, 0x15, 0x0b, 0x02, 0x02, 0x49, 0x01, 0x0b, 0x02, 0x0c, 0x0a,
+  0x0e, 0x00, 0x00, 0x00, 0xd0, 0x40, 0x15, 0x0a, 0x02, 0x02, 0x04, 0x0b,
+  0x04, 0x00, 0x20, 0x0b, 0x02, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x0a,
+  0x04, 0x00, 0x09, 0x0b, 0x01, 0x00, 0x06, 0x0c, 0x00, 0x00, 0x06, 0x0d,
+  0x01, 0x00, 0x06, 0x0e, 0x02, 0x00, 0x15, 0x0b, 0x04, 0x01, 0x05, 0x0e,
+  0x0f, 0x00, 0x06, 0x0f, 0x0a, 0x00, 0x31, 0x0d, 0x0e, 0x0f, 0x14, 0x0b,
+  0x01, 0xa8, 0x08, 0x00, 0x00, 0x00, 0x15, 0x0b, 0x03, 0x01, 0x17, 0x00,
+  0x0d, 0x00, 0x50, 0x07, 0x09, 0x00, 0x00, 0x00, 0x00, 0x80, 0x50, 0x08,
+  0x07, 0x00, 0x10, 0x00, 0x00, 0x80, 0x09, 0x0a, 0x02, 0x00, 0x06, 0x0b,
+  0x00, 0x00, 0x06, 0x0c, 0x01, 0x00, 0x06, 0x0d, 0x02, 0x00, 0x15, 0x0a,
+  0x04, 0x01, 0x17, 0x00, 0x03, 0x00, 0x09, 0x0a, 0x03, 0x00, 0x06, 0x0b,
+  0x02, 0x00, 0x15, 0x0a, 0x02, 0x01, 0x18, 0x00, 0xb7, 0xff, 0x16, 0x00,
+  0x01, 0x00, 0x11, 0x03, 0x1c, 0x03, 0x2b, 0x03, 0x1e, 0x03, 0x02, 0x03,
+  0x01, 0x03, 0x2c, 0x03, 0x28, 0x03, 0x16, 0x03, 0x2d, 0x03, 0x2e, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x03, 0x26, 0x04, 0x00,
+  0x00, 0xb0, 0x40, 0x03, 0x2f, 0x04, 0x00, 0x00, 0xd0, 0x40, 0x03, 0x30,
+  0x03, 0x31, 0x00, 0xeb, 0x01, 0x32, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0xeb, 0x19, 0xee, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x03, 0x01,
+  0x00, 0x00, 0x00, 0x1b, 0x05, 0x04, 0x00, 0x00, 0x05, 0x05, 0x01, 0x00,
+  0x31, 0x03, 0x04, 0x05, 0x06, 0x04, 0x02, 0x00, 0x15, 0x04, 0x01, 0x05,
+  0x1a, 0x04, 0x02, 0x00, 0x50, 0x04, 0x02, 0x00, 0x02, 0x00, 0x00, 0x80,
+  0x16, 0x00, 0x01, 0x00, 0x50, 0x04, 0x0f, 0x00, 0x03, 0x00, 0x00, 0x80,
+  0x0d, 0x09, 0x07, 0x03, 0x4d, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0x03, 0x08, 0x00, 0x01, 0x03, 0x08, 0x01, 0x00, 0x09, 0x09, 0x00, 0x00,
+  0x06, 0x0a, 0x00, 0x00, 0x06, 0x0b, 0x01, 0x00, 0x06, 0x0c, 0x02, 0x00,
+  0x1a, 0x08, 0x02, 0x00, 0x05, 0x0d, 0x04, 0x00, 0x17, 0x00, 0x01, 0x00,
+  0x05, 0x0d, 0x05, 0x00, 0x15, 0x09, 0x05, 0x01, 0x18, 0x00, 0xe9, 0xff,
+  0x16, 0x00, 0x01, 0x00, 0x06, 0x03, 0x1c, 0x03, 0x33, 0x03, 0x02, 0x03,
+  0x01, 0x03, 0x34, 0x03, 0x35, 0x00, 0x8c, 0x02, 0x00, 0x01, 0x18, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff,
+  0xfa, 0x0b, 0x0e, 0x01, 0x00, 0x00, 0x00, 0x10, 0x03, 0x05, 0x00, 0x00,
+  0x00, 0x42, 0x09, 0x03, 0x00, 0x00, 0x06, 0x04, 0x02, 0x00, 0x15, 0x03,
+  0x02, 0x02, 0x06, 0x04, 0x03, 0x00, 0x15, 0x04, 0x01, 0x02, 0x19, 0x04,
+  0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x50, 0x04, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0xf9, 0xff, 0x06, 0x04, 0x03, 0x00, 0x15, 0x04,
+  0x01, 0x04, 0x1a, 0x04, 0x02, 0x00, 0x50, 0x04, 0x02, 0x00, 0x01, 0x00,
+  0x00, 0x80, 0x16, 0x00, 0x01, 0x00, 0x50, 0x04, 0x2f, 0x00, 0x00, 0x00,
+  0x00, 0x80, 0x50, 0x05, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x80, 0x50, 0x06,
+  0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x50, 0x06, 0x06, 0x00, 0x04, 0x00,
+  0x00, 0x80, 0x09, 0x07, 0x01, 0x00, 0x06, 0x08, 0x00, 0x00, 0x06, 0x09,
+  0x03, 0x00, 0x15, 0x07, 0x03, 0x01, 0x17, 0x00, 0x23, 0x00, 0x1a, 0x01,
+  0x1f, 0x00, 0x50, 0x05, 0x1e, 0x00, 0x02, 0x00, 0x00, 0x80, 0x50, 0x06,
+  0x1c, 0x00, 0x05, 0x00, 0x00, 0x80, 0x09, 0x07, 0x02, 0x00, 0x06, 0x08,
+  0x00, 0x00, 0x15, 0x07, 0x02, 0x02, 0x06, 0x08, 0x03, 0x00, 0x15, 0x08,
+  0x01, 0x04, 0x1a, 0x08, 0x18, 0x00, 0x50, 0x08, 0x02, 0x00, 0x01, 0x00,
+  0x00, 0x80, 0x17, 0x00, 0x15, 0x00, 0x50, 0x08, 0x0f, 0x00, 0x00, 0x00,
+  0x00, 0x80, 0x50, 0x09, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x80, 0x50, 0x0a,
+  0x08, 0x00, 0x06, 0x00, 0x00, 0x80, 0x09, 0x0b, 0x03, 0x00, 0x06, 0x0c,
+  0x07, 0x00, 0x06, 0x0d, 0x01, 0x00, 0x06, 0x0e, 0x03, 0x00, 0x05, 0x0f,
+  0x07, 0x00, 0x15, 0x0b, 0x05, 0x01, 0x17, 0x00, 0x03, 0x00, 0x09, 0x0b,
+  0x04, 0x00, 0x06, 0x0c, 0x03, 0x00, 0x15, 0x0b, 0x02, 0x01, 0x18, 0x00,
+  0xe9, 0xff, 0x17, 0x00, 0x03, 0x00, 0x09, 0x07, 0x04, 0x00, 0x06, 0x08,
+  0x03, 0x00, 0x15, 0x07, 0x02, 0x01, 0x18, 0x00, 0xc9, 0xff, 0x16, 0x00,
+  0x01, 0x00, 0x08, 0x03, 0x01, 0x03, 0x02, 0x03, 0x36, 0x03, 0x37, 0x03,
+  0x38, 0x03, 0x39, 0x03, 0x20, 0x03, 0x3a, 0x00, 0x9f, 0x02, 0x3b, 0x01,
+  0x18, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x01, 0x01, 0x00, 0xfc, 0x0a,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0xf8, 0x00, 0x0d, 0x00, 0x00, 0xe7, 0x1d, 0x20, 0x01, 0x00, 0x00, 0x00,
+  0x0d, 0x01, 0x02, 0x00, 0x00, 0x00, 0x84, 0x01, 0x19, 0x00, 0x0a, 0x00,
+  0x0c, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x05, 0x02, 0x02, 0x00,
+  0x05, 0x03, 0x03, 0x00, 0x03, 0x04, 0x00, 0x00, 0x15, 0x01, 0x04, 0x02,
+  0x06, 0x00, 0x01, 0x00, 0x19, 0x00, 0x02, 0x00, 0x03, 0x01, 0x00, 0x00,
+  0x16, 0x01, 0x02, 0x00, 0x49, 0x01, 0x00, 0x03, 0x06, 0x02, 0x00, 0x00,
+  0x0c, 0x01, 0x05, 0x00, 0x00, 0x00, 0x40, 0x40, 0x15, 0x01, 0x02, 0x01,
+  0x0c, 0x01, 0x07, 0x00, 0x00, 0x00, 0x60, 0x40, 0x05, 0x02, 0x08, 0x00,
+  0x15, 0x01, 0x02, 0x01, 0x09, 0x01, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00,
+  0x15, 0x01, 0x02, 0x02, 0x06, 0x02, 0x01, 0x00, 0x1a, 0x02, 0x04, 0x00,
+  0x05, 0x04, 0x09, 0x00, 0x14, 0x02, 0x01, 0x76, 0x0a, 0x00, 0x00, 0x00,
+  0x15, 0x02, 0x03, 0x02, 0x06, 0x03, 0x01, 0x00, 0x1a, 0x03, 0x04, 0x00,
+  0x05, 0x05, 0x0b, 0x00, 0x14, 0x03, 0x01, 0x76, 0x0a, 0x00, 0x00, 0x00,
+  0x15, 0x03, 0x03, 0x02, 0x1a, 0x01, 0x03, 0x00, 0x14, 0x04, 0x01, 0x83,
+  0x0c, 0x00, 0x00, 0x00, 0x15, 0x04, 0x02, 0x01, 0x1a, 0x02, 0x01, 0x00,
+  0x19, 0x03, 0x0a, 0x00, 0x0c, 0x04, 0x0e, 0x00, 0x00, 0x00, 0xd0, 0x40,
+  0x02, 0x05, 0x00, 0x00, 0x05, 0x06, 0x0f, 0x00, 0x15, 0x04, 0x03, 0x01,
+  0x0c, 0x04, 0x11, 0x00, 0x00, 0x00, 0x00, 0x41, 0x15, 0x04, 0x01, 0x01,
+  0x03, 0x04, 0x00, 0x00, 0x16, 0x04, 0x02, 0x00, 0x35, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0x05, 0x13, 0x00, 0x00, 0x00, 0x20, 0x41,
+  0x15, 0x05, 0x01, 0x02, 0x0c, 0x06, 0x15, 0x00, 0x00, 0x00, 0x40, 0x41,
+  0x06, 0x07, 0x05, 0x00, 0x15, 0x06, 0x02, 0x02, 0x14, 0x07, 0x06, 0x9f,
+  0x16, 0x00, 0x00, 0x00, 0x15, 0x07, 0x02, 0x01, 0x09, 0x07, 0x01, 0x00,
+  0x06, 0x08, 0x04, 0x00, 0x02, 0x09, 0x00, 0x00, 0x06, 0x0a, 0x02, 0x00,
+  0x15, 0x07, 0x04, 0x01, 0x09, 0x07, 0x01, 0x00, 0x06, 0x08, 0x04, 0x00,
+  0x06, 0x09, 0x06, 0x00, 0x06, 0x0a, 0x03, 0x00, 0x15, 0x07, 0x04, 0x01,
+  0x14, 0x07, 0x02, 0x83, 0x0c, 0x00, 0x00, 0x00, 0x15, 0x07, 0x02, 0x01,
+  0x14, 0x07, 0x03, 0x83, 0x0c, 0x00, 0x00, 0x00, 0x15, 0x07, 0x02, 0x01,
+  0x34, 0x07, 0x05, 0x00, 0x04, 0x08, 0x01, 0x00, 0x20, 0x08, 0x05, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x04, 0x09, 0x01, 0x00, 0x14, 0x07, 0x05, 0x54,
+  0x17, 0x00, 0x00, 0x00, 0x15, 0x07, 0x03, 0x01, 0x0c, 0x07, 0x19, 0x00,
+  0x00, 0x00, 0x80, 0x41, 0x06, 0x08, 0x00, 0x00, 0x15, 0x07, 0x02, 0x02,
+  0x0c, 0x08, 0x1b, 0x00, 0x00, 0x00, 0xa0, 0x41, 0x06, 0x0a, 0x07, 0x00,
+  0x14, 0x08, 0x08, 0x5b, 0x1c, 0x00, 0x00, 0x00, 0x15, 0x08, 0x03, 0x02,
+  0x1a, 0x08, 0x10, 0x00, 0x04, 0x08, 0x01, 0x00, 0x06, 0x0a, 0x07, 0x00,
+  0x05, 0x0b, 0x1d, 0x00, 0x06, 0x0c, 0x08, 0x00, 0x31, 0x09, 0x0a, 0x0c,
+  0x0c, 0x0a, 0x1b, 0x00, 0x00, 0x00, 0xa0, 0x41, 0x06, 0x0c, 0x09, 0x00,
+  0x14, 0x0a, 0x0a, 0x5b, 0x1c, 0x00, 0x00, 0x00, 0x15, 0x0a, 0x03, 0x02,
+  0x19, 0x0a, 0x02, 0x00, 0x06, 0x07, 0x09, 0x00, 0x17, 0x00, 0x02, 0x00,
+  0x27, 0x08, 0x08, 0x1e, 0x18, 0x00, 0xf1, 0xff, 0x0c, 0x08, 0x1b, 0x00,
+  0x00, 0x00, 0xa0, 0x41, 0x06, 0x0a, 0x05, 0x00, 0x06, 0x0b, 0x07, 0x00,
+  0x14, 0x08, 0x08, 0x16, 0x1f, 0x00, 0x00, 0x00, 0x15, 0x08, 0x04, 0x01,
+  0x0c, 0x08, 0x1b, 0x00, 0x00, 0x00, 0xa0, 0x41, 0x06, 0x0a, 0x07, 0x00,
+  0x14, 0x08, 0x08, 0x6a, 0x20, 0x00, 0x00, 0x00, 0x15, 0x08, 0x03, 0x01,
+  0x0c, 0x08, 0x11, 0x00, 0x00, 0x00, 0x00, 0x41, 0x15, 0x08, 0x01, 0x01,
+  0x03, 0x08, 0x01, 0x00, 0x16, 0x08, 0x02, 0x00, 0x21, 0x03, 0x3c, 0x04,
+  0x00, 0x00, 0x00, 0x40, 0x03, 0x3d, 0x03, 0x3e, 0x03, 0x2f, 0x04, 0x00,
+  0x00, 0x40, 0x40, 0x03, 0x3f, 0x04, 0x00, 0x00, 0x60, 0x40, 0x03, 0x40,
+  0x03, 0x41, 0x03, 0x42, 0x03, 0x43, 0x03, 0x44, 0x03, 0x45, 0x04, 0x00,
+  0x00, 0xd0, 0x40, 0x03, 0x46, 0x03, 0x47, 0x04, 0x00, 0x00, 0x00, 0x41,
+  0x03, 0x48, 0x04, 0x00, 0x00, 0x20, 0x41, 0x03, 0x49, 0x04, 0x00, 0x00,
+  0x40, 0x41, 0x03, 0x4a, 0x03, 0x4b, 0x03, 0x4c, 0x04, 0x00, 0x00, 0x80,
+  0x41, 0x03, 0x4d, 0x04, 0x00, 0x00, 0xa0, 0x41, 0x03, 0x4e, 0x03, 0x4f,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x03, 0x50, 0x03,
+  0x51, 0x00, 0xcc, 0x02, 0x52, 0x01, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x02, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00,
+  0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02,
+  0xfa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x4d, 0x01, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x00, 0x01, 0x02, 0x00, 0x4d, 0x41, 0x00, 0x00, 0x00, 0x0c,
+  0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x80, 0x0c, 0x01, 0x04, 0x00, 0x00,
+  0x0c, 0x00, 0x80, 0x0c, 0x02, 0x06, 0x00, 0x00, 0x14, 0x00, 0x80, 0x0c,
+  0x03, 0x08, 0x00, 0x00, 0x1c, 0x00, 0x80, 0x0c, 0x04, 0x0a, 0x00, 0x00,
+  0x24, 0x00, 0x80, 0x0c, 0x05, 0x0c, 0x00, 0x00, 0x2c, 0x00, 0x80, 0x0c,
+  0x06, 0x0e, 0x00, 0x00, 0x34, 0x00, 0x80, 0x0c, 0x07, 0x11, 0x00, 0x00,
+  0x40, 0xf0, 0x80, 0x0c, 0x08, 0x13, 0x00, 0x00, 0x48, 0xf0, 0x80, 0x0c,
+  0x09, 0x15, 0x00, 0x00, 0x50, 0xf0, 0x80, 0x0c, 0x0a, 0x17, 0x00, 0x00,
+  0x58, 0xf0, 0x80, 0x0c, 0x0b, 0x1a, 0x00, 0x00, 0x64, 0x80, 0x81, 0x0c,
+  0x0c, 0x1c, 0x00, 0x00, 0x6c, 0x80, 0x81, 0x0c, 0x0d, 0x1e, 0x00, 0x00,
+  0x74, 0x80, 0x81, 0x0c, 0x0e, 0x20, 0x00, 0x00, 0x7c, 0x80, 0x81, 0x0c,
+  0x0f, 0x23, 0x00, 0x00, 0x88, 0x10, 0x82, 0x36, 0x10, 0x25, 0x00, 0x04,
+  0x11, 0x00, 0x00, 0x10, 0x11, 0x10, 0xd0, 0x24, 0x00, 0x00, 0x00, 0x40,
+  0x11, 0x26, 0x00, 0x40, 0x12, 0x27, 0x00, 0x46, 0x00, 0x11, 0x00, 0x40,
+  0x13, 0x28, 0x00, 0x46, 0x00, 0x10, 0x00, 0x46, 0x00, 0x00, 0x00, 0x46,
+  0x00, 0x08, 0x00, 0x46, 0x00, 0x02, 0x00, 0x46, 0x00, 0x01, 0x00, 0x40,
+  0x14, 0x29, 0x00, 0x46, 0x00, 0x12, 0x00, 0x46, 0x00, 0x11, 0x00, 0x40,
+  0x15, 0x2a, 0x00, 0x46, 0x00, 0x0c, 0x00, 0x46, 0x00, 0x0e, 0x00, 0x46,
+  0x00, 0x11, 0x00, 0x46, 0x00, 0x10, 0x00, 0x02, 0x16, 0x00, 0x00, 0x13,
+  0x17, 0x05, 0x00, 0x46, 0x00, 0x10, 0x00, 0x46, 0x00, 0x15, 0x00, 0x46,
+  0x01, 0x16, 0x00, 0x46, 0x00, 0x11, 0x00, 0x40, 0x16, 0x2b, 0x00, 0x46,
+  0x00, 0x17, 0x00, 0x40, 0x18, 0x2c, 0x00, 0x46, 0x00, 0x06, 0x00, 0x46,
+  0x00, 0x14, 0x00, 0x46, 0x00, 0x13, 0x00, 0x46, 0x00, 0x17, 0x00, 0x46,
+  0x00, 0x11, 0x00, 0x40, 0x19, 0x2d, 0x00, 0x46, 0x00, 0x05, 0x00, 0x46,
+  0x00, 0x18, 0x00, 0x0c, 0x1a, 0x2f, 0x00, 0x00, 0x00, 0xe0, 0x42, 0x10,
+  0x19, 0x1a, 0x4c, 0x30, 0x00, 0x00, 0x00, 0x0b, 0x16, 0x00, 0x00, 0x16,
+  0x00, 0x01, 0x00, 0x31, 0x03, 0x53, 0x03, 0x54, 0x04, 0x00, 0x04, 0x00,
+  0x80, 0x03, 0x55, 0x04, 0x00, 0x0c, 0x00, 0x80, 0x03, 0x56, 0x04, 0x00,
+  0x14, 0x00, 0x80, 0x03, 0x57, 0x04, 0x00, 0x1c, 0x00, 0x80, 0x03, 0x58,
+  0x04, 0x00, 0x24, 0x00, 0x80, 0x03, 0x59, 0x04, 0x00, 0x2c, 0x00, 0x80,
+  0x03, 0x5a, 0x04, 0x00, 0x34, 0x00, 0x80, 0x03, 0x5b, 0x03, 0x5c, 0x04,
+  0x00, 0x40, 0xf0, 0x80, 0x03, 0x5d, 0x04, 0x00, 0x48, 0xf0, 0x80, 0x03,
+  0x5e, 0x04, 0x00, 0x50, 0xf0, 0x80, 0x03, 0x5f, 0x04, 0x00, 0x58, 0xf0,
+  0x80, 0x03, 0x60, 0x03, 0x61, 0x04, 0x00, 0x64, 0x80, 0x81, 0x03, 0x62,
+  0x04, 0x00, 0x6c, 0x80, 0x81, 0x03, 0x63, 0x04, 0x00, 0x74, 0x80, 0x81,
+  0x03, 0x64, 0x04, 0x00, 0x7c, 0x80, 0x81, 0x03, 0x65, 0x03, 0x66, 0x04,
+  0x00, 0x88, 0x10, 0x82, 0x03, 0x15, 0x05, 0x01, 0x24, 0x06, 0x00, 0x06,
+  0x01, 0x06, 0x03, 0x06, 0x04, 0x06, 0x05, 0x06, 0x07, 0x06, 0x08, 0x06,
+  0x09, 0x03, 0x67, 0x04, 0x00, 0x00, 0xe0, 0x42, 0x03, 0x52, 0x09, 0x00,
+  0x01, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x01, 0x00, 0x01, 0x04,
+  0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x00, 0x01, 0x00, 0x01, 0xf4, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0xf8, 0x1e, 0x00, 0x00,
+  0x00, 0x0c, 0x11, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00,
+  0x77, 0x12, 0x00, 0x00, 0x00, 0x00, 0x39, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x13, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x45, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00,
+  0x00, 0x08, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00,
+  0x00, 0x00, 0x0a,
+};
+
+/* This is src/lua/import/markdown.lua */
+static const unsigned char lazy_script_table_10[] = {
+  0x05, 0x02, 0x0a, 0x0e, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x44, 0x6f,
+  0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x0b, 0x43, 0x4d, 0x61, 0x72, 0x6b,
+  0x49, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x0f, 0x43, 0x72, 0x65, 0x61, 0x74,
+  0x65, 0x50, 0x61, 0x72, 0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x05, 0x73,
+  0x74, 0x79, 0x6c, 0x65, 0x0f, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x50,
+  0x61, 0x72, 0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x14, 0x49, 0x6d, 0x70,
+  0x6f, 0x72, 0x74, 0x4d, 0x61, 0x72, 0x6b, 0x64, 0x6f, 0x77, 0x6e, 0x53,
+  0x74, 0x72, 0x69, 0x6e, 0x67, 0x10, 0x49, 0x6d, 0x70, 0x6f, 0x72, 0x74,
+  0x46, 0x69, 0x6c, 0x65, 0x57, 0x69, 0x74, 0x68, 0x55, 0x49, 0x14, 0x49,
+  0x6d, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x4d, 0x61, 0x72, 0x6b, 0x64, 0x6f,
+  0x77, 0x6e, 0x20, 0x46, 0x69, 0x6c, 0x65, 0x03, 0x43, 0x6d, 0x64, 0x12,
+  0x49, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x4d, 0x61, 0x72, 0x6b, 0x64, 0x6f,
+  0x77, 0x6e, 0x46, 0x69, 0x6c, 0x65, 0x03, 0x0c, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x14, 0x0c, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x15, 0x01,
+  0x01, 0x02, 0x0c, 0x02, 0x03, 0x00, 0x00, 0x00, 0x20, 0x40, 0x06, 0x03,
+  0x00, 0x00, 0x15, 0x02, 0x02, 0x04, 0x4c, 0x02, 0x09, 0x00, 0x0c, 0x09,
+  0x05, 0x00, 0x00, 0x00, 0x40, 0x40, 0x0f, 0x0a, 0x06, 0x9a, 0x06, 0x00,
+  0x00, 0x00, 0x06, 0x0b, 0x06, 0x00, 0x15, 0x09, 0x03, 0x00, 0x14, 0x07,
+  0x01, 0xb4, 0x07, 0x00, 0x00, 0x00, 0x15, 0x07, 0x00, 0x01, 0x3a, 0x02,
+  0xf6, 0xff, 0x02, 0x00, 0x00, 0x00, 0x16, 0x01, 0x02, 0x00, 0x08, 0x03,
+  0x01, 0x04, 0x00, 0x00, 0x00, 0x40, 0x03, 0x02, 0x04, 0x00, 0x00, 0x20,
+  0x40, 0x03, 0x03, 0x04, 0x00, 0x00, 0x40, 0x40, 0x03, 0x04, 0x03, 0x05,
+  0x00, 0x09, 0x06, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,
+  0x03, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x0c, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x06, 0x02, 0x00,
+  0x00, 0x05, 0x03, 0x02, 0x00, 0x0c, 0x04, 0x05, 0x00, 0x00, 0x10, 0x30,
+  0x80, 0x03, 0x05, 0x01, 0x00, 0x15, 0x01, 0x05, 0x00, 0x16, 0x01, 0x00,
+  0x00, 0x06, 0x03, 0x07, 0x04, 0x00, 0x00, 0x00, 0x40, 0x03, 0x08, 0x03,
+  0x09, 0x03, 0x06, 0x04, 0x00, 0x10, 0x30, 0x80, 0x00, 0x11, 0x0a, 0x01,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xff, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x02, 0x00, 0x0c, 0x41, 0x00,
+  0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x02, 0x00, 0x00, 0x00,
+  0x10, 0x40, 0x10, 0x00, 0x01, 0xbd, 0x03, 0x00, 0x00, 0x00, 0x40, 0x00,
+  0x04, 0x00, 0x0c, 0x01, 0x02, 0x00, 0x00, 0x00, 0x10, 0x40, 0x10, 0x00,
+  0x01, 0x39, 0x05, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0x06, 0x06,
+  0x00, 0x03, 0x09, 0x04, 0x00, 0x00, 0x10, 0x40, 0x03, 0x06, 0x06, 0x01,
+  0x03, 0x0a, 0x02, 0x00, 0x01, 0x01, 0x00, 0x01, 0x18, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x02,
+};
+
+/* This is src/lua/viewer.lua */
+static const unsigned char lazy_script_table_11[] = {
+  0x05, 0x02, 0x83, 0x01, 0x05, 0x63, 0x61, 0x63, 0x68, 0x65, 0x06, 0x63,
+  0x61, 0x63, 0x68, 0x65, 0x64, 0x0f, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65,
+  0x50, 0x61, 0x72, 0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x01, 0x50, 0x04,
+  0x76, 0x69, 0x65, 0x77, 0x05, 0x77, 0x6f, 0x72, 0x64, 0x73, 0x0c, 0x67,
+  0x65, 0x74, 0x70, 0x61, 0x72, 0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x0b,
+  0x53, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x57, 0x69, 0x64, 0x74, 0x68, 0x04,
+  0x6d, 0x61, 0x74, 0x68, 0x03, 0x6d, 0x61, 0x78, 0x08, 0x67, 0x65, 0x74,
+  0x77, 0x69, 0x64, 0x74, 0x68, 0x04, 0x77, 0x72, 0x61, 0x70, 0x05, 0x6c,
+  0x69, 0x6e, 0x65, 0x73, 0x09, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x72, 0x6f,
+  0x77, 0x73, 0x03, 0x73, 0x75, 0x62, 0x03, 0x74, 0x6f, 0x70, 0x06, 0x73,
+  0x63, 0x72, 0x6f, 0x6c, 0x6c, 0x03, 0x6d, 0x69, 0x6e, 0x08, 0x67, 0x6f,
+  0x74, 0x6f, 0x6c, 0x69, 0x6e, 0x65, 0x0c, 0x53, 0x63, 0x72, 0x65, 0x65,
+  0x6e, 0x48, 0x65, 0x69, 0x67, 0x68, 0x74, 0x0f, 0x53, 0x70, 0x65, 0x6c,
+  0x6c, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x72, 0x4f, 0x66, 0x66, 0x09,
+  0x53, 0x65, 0x74, 0x43, 0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x07, 0x50, 0x61,
+  0x6c, 0x65, 0x74, 0x74, 0x65, 0x07, 0x44, 0x65, 0x73, 0x6b, 0x74, 0x6f,
+  0x70, 0x05, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x02, 0x6c, 0x6e, 0x02, 0x6d,
+  0x77, 0x02, 0x6d, 0x6f, 0x02, 0x65, 0x77, 0x02, 0x65, 0x6f, 0x12, 0x53,
+  0x65, 0x74, 0x50, 0x61, 0x72, 0x61, 0x67, 0x72, 0x61, 0x70, 0x68, 0x43,
+  0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x05, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x0a,
+  0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x4c, 0x69, 0x6e, 0x65, 0x13, 0x53,
+  0x70, 0x65, 0x6c, 0x6c, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x72, 0x52,
+  0x65, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x0b, 0x53, 0x74, 0x61, 0x74, 0x75,
+  0x73, 0x62, 0x61, 0x72, 0x42, 0x47, 0x0b, 0x53, 0x74, 0x61, 0x74, 0x75,
+  0x73, 0x62, 0x61, 0x72, 0x46, 0x47, 0x0e, 0x44, 0x72, 0x61, 0x77, 0x53,
+  0x74, 0x61, 0x74, 0x75, 0x73, 0x4c, 0x69, 0x6e, 0x65, 0x06, 0x73, 0x74,
+  0x72, 0x69, 0x6e, 0x67, 0x06, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x53,
+  0x25, 0x73, 0x20, 0x28, 0x72, 0x65, 0x61, 0x64, 0x20, 0x6f, 0x6e, 0x6c,
+  0x79, 0x29, 0x20, 0xe2, 0x94, 0x82, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20,
+  0x25, 0x64, 0x20, 0x6f, 0x66, 0x20, 0x25, 0x64, 0x20, 0xe2, 0x94, 0x82,
+  0x20, 0x5e, 0x46, 0x20, 0x66, 0x69, 0x6e, 0x64, 0x20, 0xe2, 0x94, 0x82,
+  0x20, 0x5e, 0x4b, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x20, 0xe2, 0x94, 0x82,
+  0x20, 0x5e, 0x47, 0x20, 0x67, 0x6f, 0x20, 0x74, 0x6f, 0x20, 0xe2, 0x94,
+  0x82, 0x20, 0x25, 0x73, 0x20, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x73, 0x08,
+  0x4c, 0x65, 0x61, 0x66, 0x6e, 0x61, 0x6d, 0x65, 0x08, 0x66, 0x69, 0x6c,
+  0x65, 0x6e, 0x61, 0x6d, 0x65, 0x0a, 0x45, 0x53, 0x43, 0x41, 0x50, 0x45,
+  0x5f, 0x4b, 0x45, 0x59, 0x06, 0x72, 0x65, 0x64, 0x72, 0x61, 0x77, 0x0e,
+  0x54, 0x61, 0x73, 0x6b, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69,
+  0x6e, 0x74, 0x04, 0x66, 0x69, 0x6e, 0x64, 0x02, 0x61, 0x74, 0x06, 0x73,
+  0x65, 0x61, 0x72, 0x63, 0x68, 0x0d, 0x47, 0x65, 0x74, 0x53, 0x65, 0x61,
+  0x72, 0x63, 0x68, 0x54, 0x65, 0x78, 0x74, 0x0c, 0x4d, 0x6f, 0x64, 0x61,
+  0x6c, 0x4d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x04, 0x46, 0x69, 0x6e,
+  0x64, 0x06, 0x61, 0x73, 0x73, 0x65, 0x72, 0x74, 0x03, 0x6c, 0x65, 0x6e,
+  0x06, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x07, 0x52, 0x75, 0x6e, 0x54,
+  0x61, 0x73, 0x6b, 0x0c, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x69, 0x6e,
+  0x67, 0x2e, 0x2e, 0x2e, 0x0a, 0x4e, 0x6f, 0x74, 0x20, 0x66, 0x6f, 0x75,
+  0x6e, 0x64, 0x2e, 0x08, 0x66, 0x69, 0x6e, 0x64, 0x6e, 0x65, 0x78, 0x74,
+  0x04, 0x46, 0x6f, 0x72, 0x6d, 0x09, 0x54, 0x65, 0x78, 0x74, 0x46, 0x69,
+  0x65, 0x6c, 0x64, 0x05, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x06, 0x63, 0x75,
+  0x72, 0x73, 0x6f, 0x72, 0x02, 0x78, 0x31, 0x02, 0x79, 0x31, 0x02, 0x78,
+  0x32, 0x02, 0x79, 0x32, 0x00, 0x08, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x62,
+  0x6f, 0x78, 0x05, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x12, 0x52, 0x65, 0x67,
+  0x75, 0x6c, 0x61, 0x72, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73,
+  0x69, 0x6f, 0x6e, 0x05, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x05, 0x77, 0x69,
+  0x64, 0x74, 0x68, 0x06, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x07, 0x61,
+  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x07, 0x77, 0x69, 0x64, 0x67, 0x65,
+  0x74, 0x73, 0x05, 0x6c, 0x61, 0x72, 0x67, 0x65, 0x07, 0x63, 0x6f, 0x6e,
+  0x66, 0x69, 0x72, 0x6d, 0x0a, 0x4b, 0x45, 0x59, 0x5f, 0x52, 0x45, 0x54,
+  0x55, 0x52, 0x4e, 0x09, 0x4b, 0x45, 0x59, 0x5f, 0x45, 0x4e, 0x54, 0x45,
+  0x52, 0x05, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x05, 0x61, 0x6c, 0x69, 0x67,
+  0x6e, 0x05, 0x46, 0x69, 0x6e, 0x64, 0x3a, 0x04, 0x6c, 0x65, 0x66, 0x74,
+  0x03, 0x52, 0x75, 0x6e, 0x13, 0x52, 0x45, 0x54, 0x55, 0x52, 0x4e, 0x20,
+  0x74, 0x6f, 0x20, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x72, 0x6d, 0x2c, 0x20,
+  0x0a, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x61, 0x6e, 0x63, 0x65, 0x6c, 0x0c,
+  0x66, 0x69, 0x6e, 0x64, 0x64, 0x69, 0x61, 0x6c, 0x6f, 0x67, 0x75, 0x65,
+  0x0f, 0x50, 0x72, 0x6f, 0x6d, 0x70, 0x74, 0x46, 0x6f, 0x72, 0x53, 0x74,
+  0x72, 0x69, 0x6e, 0x67, 0x0a, 0x47, 0x6f, 0x20, 0x74, 0x6f, 0x20, 0x6c,
+  0x69, 0x6e, 0x65, 0x15, 0x57, 0x68, 0x69, 0x63, 0x68, 0x20, 0x6c, 0x69,
+  0x6e, 0x65, 0x20, 0x28, 0x31, 0x20, 0x74, 0x6f, 0x20, 0x25, 0x64, 0x29,
+  0x3f, 0x08, 0x74, 0x6f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x08, 0x74,
+  0x6f, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x0c, 0x67, 0x6f, 0x74, 0x6f,
+  0x64, 0x69, 0x61, 0x6c, 0x6f, 0x67, 0x75, 0x65, 0x0c, 0x52, 0x65, 0x73,
+  0x69, 0x7a, 0x65, 0x53, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x06, 0x4b, 0x45,
+  0x59, 0x5f, 0x55, 0x50, 0x08, 0x4b, 0x45, 0x59, 0x5f, 0x44, 0x4f, 0x57,
+  0x4e, 0x08, 0x4b, 0x45, 0x59, 0x5f, 0x50, 0x47, 0x55, 0x50, 0x08, 0x4b,
+  0x45, 0x59, 0x5f, 0x50, 0x47, 0x44, 0x4e, 0x09, 0x4b, 0x45, 0x59, 0x5f,
+  0x5e, 0x50, 0x47, 0x55, 0x50, 0x09, 0x4b, 0x45, 0x59, 0x5f, 0x5e, 0x50,
+  0x47, 0x44, 0x4e, 0x06, 0x4b, 0x45, 0x59, 0x5f, 0x5e, 0x46, 0x06, 0x4b,
+  0x45, 0x59, 0x5f, 0x5e, 0x4b, 0x06, 0x4b, 0x45, 0x59, 0x5f, 0x5e, 0x47,
+  0x0a, 0x4b, 0x45, 0x59, 0x5f, 0x52, 0x45, 0x53, 0x49, 0x5a, 0x45, 0x08,
+  0x51, 0x75, 0x69, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x08, 0x4b, 0x45, 0x59,
+  0x5f, 0x51, 0x55, 0x49, 0x54, 0x12, 0x51, 0x75, 0x69, 0x74, 0x46, 0x6f,
+  0x72, 0x63, 0x65, 0x64, 0x42, 0x79, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d,
+  0x0a, 0x4b, 0x45, 0x59, 0x5f, 0x45, 0x53, 0x43, 0x41, 0x50, 0x45, 0x06,
+  0x4b, 0x45, 0x59, 0x5f, 0x5e, 0x43, 0x01, 0x71, 0x04, 0x74, 0x79, 0x70,
+  0x65, 0x03, 0x72, 0x75, 0x6e, 0x0b, 0x46, 0x69, 0x6c, 0x65, 0x42, 0x72,
+  0x6f, 0x77, 0x73, 0x65, 0x72, 0x0e, 0x56, 0x69, 0x65, 0x77, 0x20, 0x54,
+  0x65, 0x78, 0x74, 0x20, 0x46, 0x69, 0x6c, 0x65, 0x05, 0x56, 0x69, 0x65,
+  0x77, 0x3a, 0x10, 0x49, 0x6d, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65,
+  0x4d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x0a, 0x4f, 0x70, 0x65, 0x6e,
+  0x69, 0x6e, 0x67, 0x2e, 0x2e, 0x2e, 0x13, 0x55, 0x6e, 0x61, 0x62, 0x6c,
+  0x65, 0x20, 0x74, 0x6f, 0x20, 0x6f, 0x70, 0x65, 0x6e, 0x20, 0x66, 0x69,
+  0x6c, 0x65, 0x1e, 0x54, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20,
+  0x63, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x62, 0x65,
+  0x20, 0x6f, 0x70, 0x65, 0x6e, 0x65, 0x64, 0x3a, 0x20, 0x0d, 0x75, 0x6e,
+  0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x0b,
+  0x51, 0x75, 0x65, 0x75, 0x65, 0x52, 0x65, 0x64, 0x72, 0x61, 0x77, 0x05,
+  0x63, 0x6c, 0x6f, 0x73, 0x65, 0x0c, 0x56, 0x69, 0x65, 0x77, 0x54, 0x65,
+  0x78, 0x74, 0x46, 0x69, 0x6c, 0x65, 0x02, 0x77, 0x67, 0x07, 0x67, 0x65,
+  0x74, 0x63, 0x68, 0x61, 0x72, 0x0a, 0x68, 0x69, 0x64, 0x65, 0x63, 0x75,
+  0x72, 0x73, 0x6f, 0x72, 0x09, 0x73, 0x65, 0x74, 0x6e, 0x6f, 0x72, 0x6d,
+  0x61, 0x6c, 0x09, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x61, 0x72, 0x65, 0x61,
+  0x08, 0x76, 0x69, 0x65, 0x77, 0x74, 0x65, 0x78, 0x74, 0x05, 0x66, 0x6c,
+  0x6f, 0x6f, 0x72, 0x03, 0x43, 0x6d, 0x64, 0x19, 0x08, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x24, 0x0f, 0x03, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x0d,
+  0x02, 0x03, 0x01, 0x19, 0x02, 0x1f, 0x00, 0x0f, 0x03, 0x00, 0xba, 0x01,
+  0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x02, 0x1f, 0x04, 0x08, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x35, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x03, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x10,
+  0x03, 0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x03, 0x00, 0x00,
+  0x00, 0x20, 0x40, 0x05, 0x04, 0x04, 0x00, 0x0f, 0x05, 0x00, 0x60, 0x05,
+  0x00, 0x00, 0x00, 0x06, 0x07, 0x01, 0x00, 0x14, 0x05, 0x05, 0xb1, 0x06,
+  0x00, 0x00, 0x00, 0x15, 0x05, 0x03, 0x00, 0x15, 0x03, 0x00, 0x02, 0x06,
+  0x02, 0x03, 0x00, 0x0f, 0x03, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x0e,
+  0x02, 0x03, 0x01, 0x0f, 0x04, 0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0x27,
+  0x03, 0x04, 0x07, 0x10, 0x03, 0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0x16,
+  0x02, 0x02, 0x00, 0x08, 0x03, 0x01, 0x03, 0x02, 0x03, 0x03, 0x04, 0x00,
+  0x00, 0x20, 0x40, 0x03, 0x04, 0x03, 0x05, 0x03, 0x06, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x00, 0x34, 0x07, 0x01, 0x18, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x35,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0c,
+  0x02, 0x02, 0x00, 0x00, 0x00, 0x10, 0x40, 0x28, 0x01, 0x02, 0x00, 0x4b,
+  0x12, 0x01, 0x04, 0x03, 0x00, 0x00, 0x00, 0x05, 0x02, 0x03, 0x00, 0x0c,
+  0x00, 0x06, 0x00, 0x00, 0x14, 0x40, 0x80, 0x15, 0x00, 0x03, 0x02, 0x16,
+  0x00, 0x02, 0x00, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0x03, 0x08, 0x04, 0x00, 0x00, 0x10, 0x40, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xf0, 0x3f, 0x03, 0x09, 0x03, 0x0a, 0x04, 0x00, 0x14,
+  0x40, 0x80, 0x00, 0x42, 0x0b, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x00, 0x09, 0x02,
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x09, 0x04, 0x00, 0x00, 0x06, 0x05, 0x00,
+  0x00, 0x06, 0x06, 0x01, 0x00, 0x15, 0x04, 0x03, 0x02, 0x0c, 0x08, 0x02,
+  0x00, 0x00, 0x00, 0x10, 0x40, 0x28, 0x07, 0x08, 0x00, 0x4b, 0x12, 0x07,
+  0x04, 0x03, 0x00, 0x00, 0x00, 0x05, 0x08, 0x03, 0x00, 0x0c, 0x06, 0x06,
+  0x00, 0x00, 0x14, 0x40, 0x80, 0x15, 0x06, 0x03, 0x02, 0x14, 0x04, 0x04,
+  0xd5, 0x07, 0x00, 0x00, 0x00, 0x15, 0x04, 0x03, 0x02, 0x0f, 0x03, 0x04,
+  0xe1, 0x08, 0x00, 0x00, 0x00, 0x34, 0x02, 0x03, 0x00, 0x16, 0x02, 0x02,
+  0x00, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x03,
+  0x08, 0x04, 0x00, 0x00, 0x10, 0x40, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xf0, 0x3f, 0x03, 0x09, 0x03, 0x0a, 0x04, 0x00, 0x14, 0x40, 0x80,
+  0x03, 0x0c, 0x03, 0x0d, 0x00, 0x46, 0x0e, 0x01, 0x18, 0x04, 0x00, 0x00,
+  0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x02,
+  0x01, 0x00, 0x00, 0x00, 0x68, 0x04, 0x02, 0x00, 0x00, 0x20, 0x02, 0x32,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x02, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0x00, 0x0f, 0x04, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x09, 0x06, 0x00,
+  0x00, 0x06, 0x07, 0x00, 0x00, 0x06, 0x08, 0x04, 0x00, 0x15, 0x06, 0x03,
+  0x02, 0x0c, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x30, 0x40, 0x28, 0x09, 0x0a,
+  0x02, 0x4b, 0x12, 0x09, 0x04, 0x05, 0x00, 0x00, 0x00, 0x05, 0x0a, 0x05,
+  0x00, 0x0c, 0x08, 0x08, 0x00, 0x00, 0x1c, 0x60, 0x80, 0x15, 0x08, 0x03,
+  0x02, 0x14, 0x06, 0x06, 0xd5, 0x09, 0x00, 0x00, 0x00, 0x15, 0x06, 0x03,
+  0x02, 0x0f, 0x05, 0x06, 0xe1, 0x0a, 0x00, 0x00, 0x00, 0x34, 0x03, 0x05,
+  0x00, 0x20, 0x02, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0f, 0x03, 0x00,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x27, 0x02, 0x03, 0x05, 0x10, 0x02, 0x00,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x10, 0x00, 0x0f, 0x02, 0x00,
+  0xb8, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x03, 0x00, 0xe1, 0x0a, 0x00, 0x00,
+  0x00, 0x20, 0x02, 0x0d, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0f, 0x03, 0x00,
+  0xb8, 0x01, 0x00, 0x00, 0x00, 0x27, 0x02, 0x03, 0x05, 0x10, 0x02, 0x00,
+  0xb8, 0x01, 0x00, 0x00, 0x00, 0x04, 0x02, 0x01, 0x00, 0x10, 0x02, 0x00,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0x17, 0x00, 0x02,
+  0x00, 0x28, 0x01, 0x01, 0x05, 0x18, 0x00, 0xcc, 0xff, 0x04, 0x02, 0x00,
+  0x00, 0x20, 0x01, 0x31, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0f, 0x02, 0x00,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0x01, 0x00, 0x20, 0x03, 0x07,
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x0f, 0x03, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0x00, 0x28, 0x02, 0x03, 0x05, 0x10, 0x02, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0x00, 0x17, 0x00, 0x23, 0x00, 0x0f, 0x02, 0x00, 0xb8, 0x01, 0x00, 0x00,
+  0x00, 0x04, 0x03, 0x01, 0x00, 0x20, 0x03, 0x21, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x0f, 0x03, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x28, 0x02, 0x03,
+  0x05, 0x10, 0x02, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x03, 0x00,
+  0xb8, 0x01, 0x00, 0x00, 0x00, 0x09, 0x05, 0x00, 0x00, 0x06, 0x06, 0x00,
+  0x00, 0x06, 0x07, 0x03, 0x00, 0x15, 0x05, 0x03, 0x02, 0x0c, 0x09, 0x04,
+  0x00, 0x00, 0x00, 0x30, 0x40, 0x28, 0x08, 0x09, 0x02, 0x4b, 0x12, 0x08,
+  0x04, 0x05, 0x00, 0x00, 0x00, 0x05, 0x09, 0x05, 0x00, 0x0c, 0x07, 0x08,
+  0x00, 0x00, 0x1c, 0x60, 0x80, 0x15, 0x07, 0x03, 0x02, 0x14, 0x05, 0x05,
+  0xd5, 0x09, 0x00, 0x00, 0x00, 0x15, 0x05, 0x03, 0x02, 0x0f, 0x04, 0x05,
+  0xe1, 0x0a, 0x00, 0x00, 0x00, 0x34, 0x02, 0x04, 0x00, 0x10, 0x02, 0x00,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01,
+  0x00, 0x27, 0x01, 0x01, 0x05, 0x18, 0x00, 0xcd, 0xff, 0x16, 0x00, 0x01,
+  0x00, 0x0b, 0x03, 0x0f, 0x03, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x40, 0x03, 0x08, 0x04, 0x00, 0x00, 0x30, 0x40, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x03, 0x09, 0x03, 0x0a, 0x04,
+  0x00, 0x1c, 0x60, 0x80, 0x03, 0x0c, 0x03, 0x0d, 0x00, 0x4b, 0x11, 0x01,
+  0x18, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x02, 0x02, 0xf7, 0x0c, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xea, 0x00, 0x00, 0x00, 0xfc,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x00, 0x02, 0x02, 0xf7, 0x0b, 0x43, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x02, 0x01, 0x00, 0x00, 0x00, 0x17, 0x49, 0x0c, 0x01,
+  0x02, 0x06, 0x05, 0x01, 0x00, 0x09, 0x04, 0x00, 0x00, 0x15, 0x04, 0x02,
+  0x02, 0x0f, 0x05, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x13, 0x04,
+  0x03, 0x05, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x03, 0x00, 0x00, 0x08, 0x10,
+  0x80, 0x15, 0x03, 0x03, 0x02, 0x4b, 0x12, 0x03, 0x04, 0x04, 0x00, 0x00,
+  0x00, 0x05, 0x04, 0x04, 0x00, 0x0c, 0x02, 0x06, 0x00, 0x00, 0x14, 0x10,
+  0x80, 0x15, 0x02, 0x03, 0x02, 0x10, 0x02, 0x00, 0xb8, 0x07, 0x00, 0x00,
+  0x00, 0x04, 0x02, 0x01, 0x00, 0x10, 0x02, 0x00, 0xf0, 0x08, 0x00, 0x00,
+  0x00, 0x16, 0x00, 0x01, 0x00, 0x09, 0x03, 0x0d, 0x03, 0x09, 0x03, 0x12,
+  0x04, 0x00, 0x08, 0x10, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf0, 0x3f, 0x03, 0x0a, 0x04, 0x00, 0x14, 0x10, 0x80, 0x03, 0x10, 0x03,
+  0x0f, 0x00, 0x65, 0x13, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x66, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01,
+  0x04, 0x00, 0x00, 0x00, 0x85, 0x01, 0x0c, 0x03, 0x02, 0x00, 0x00, 0x00,
+  0x10, 0x40, 0x28, 0x02, 0x03, 0x00, 0x4b, 0x12, 0x02, 0x04, 0x03, 0x00,
+  0x00, 0x00, 0x05, 0x03, 0x03, 0x00, 0x0c, 0x01, 0x06, 0x00, 0x00, 0x14,
+  0x40, 0x80, 0x15, 0x01, 0x03, 0x02, 0x0c, 0x03, 0x08, 0x00, 0x00, 0x00,
+  0x70, 0x40, 0x28, 0x02, 0x03, 0x03, 0x0c, 0x03, 0x0a, 0x00, 0x00, 0x00,
+  0x90, 0x40, 0x15, 0x03, 0x01, 0x02, 0x0f, 0x04, 0x00, 0xb8, 0x0b, 0x00,
+  0x00, 0x00, 0x0f, 0x05, 0x00, 0xf0, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x06,
+  0x00, 0x00, 0x20, 0x06, 0x50, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0x07,
+  0x00, 0x00, 0x15, 0x07, 0x01, 0x01, 0x0c, 0x07, 0x0e, 0x00, 0x00, 0x00,
+  0xd0, 0x40, 0x02, 0x08, 0x00, 0x00, 0x0c, 0x09, 0x11, 0x00, 0x00, 0x40,
+  0xf0, 0x80, 0x15, 0x07, 0x03, 0x01, 0x09, 0x07, 0x01, 0x00, 0x04, 0x08,
+  0x00, 0x00, 0x06, 0x09, 0x06, 0x00, 0x0c, 0x0b, 0x02, 0x00, 0x00, 0x00,
+  0x10, 0x40, 0x28, 0x0a, 0x0b, 0x03, 0x06, 0x0b, 0x06, 0x00, 0x15, 0x07,
+  0x05, 0x01, 0x0f, 0x07, 0x00, 0xe1, 0x12, 0x00, 0x00, 0x00, 0x1f, 0x04,
+  0x3a, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x07, 0x02, 0x00, 0x06, 0x08,
+  0x00, 0x00, 0x06, 0x09, 0x04, 0x00, 0x15, 0x07, 0x03, 0x02, 0x06, 0x0a,
+  0x01, 0x00, 0x14, 0x08, 0x07, 0xd5, 0x13, 0x00, 0x00, 0x00, 0x15, 0x08,
+  0x03, 0x02, 0x0f, 0x09, 0x00, 0xe7, 0x14, 0x00, 0x00, 0x00, 0x02, 0x0a,
+  0x00, 0x00, 0x1a, 0x09, 0x15, 0x00, 0x0f, 0x0b, 0x09, 0xbb, 0x15, 0x00,
+  0x00, 0x00, 0x1e, 0x0b, 0x12, 0x00, 0x04, 0x00, 0x00, 0x00, 0x35, 0x0b,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x35, 0x0c, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x00, 0x0f, 0x0d, 0x09, 0x8f, 0x16, 0x00, 0x00, 0x00, 0x0f, 0x0e,
+  0x09, 0x95, 0x17, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x09, 0x87, 0x18, 0x00,
+  0x00, 0x00, 0x0f, 0x10, 0x09, 0x9d, 0x19, 0x00, 0x00, 0x00, 0x37, 0x0c,
+  0x0d, 0x05, 0x01, 0x00, 0x00, 0x00, 0x37, 0x0b, 0x0c, 0x02, 0x01, 0x00,
+  0x00, 0x00, 0x06, 0x0a, 0x0b, 0x00, 0x0c, 0x0b, 0x1b, 0x00, 0x00, 0x00,
+  0xa0, 0x41, 0x0f, 0x0c, 0x07, 0x9a, 0x1c, 0x00, 0x00, 0x00, 0x15, 0x0b,
+  0x02, 0x01, 0x09, 0x0b, 0x00, 0x00, 0x15, 0x0b, 0x01, 0x01, 0x0f, 0x0e,
+  0x08, 0xe1, 0x12, 0x00, 0x00, 0x00, 0x0d, 0x0d, 0x0e, 0x05, 0x04, 0x0e,
+  0x01, 0x00, 0x06, 0x0f, 0x06, 0x00, 0x06, 0x10, 0x0a, 0x00, 0x14, 0x0b,
+  0x07, 0x8f, 0x1d, 0x00, 0x00, 0x00, 0x15, 0x0b, 0x06, 0x01, 0x27, 0x05,
+  0x05, 0x03, 0x0f, 0x0c, 0x08, 0xe1, 0x12, 0x00, 0x00, 0x00, 0x34, 0x0b,
+  0x0c, 0x00, 0x20, 0x0b, 0x03, 0x00, 0x05, 0x00, 0x00, 0x00, 0x27, 0x04,
+  0x04, 0x03, 0x04, 0x05, 0x01, 0x00, 0x27, 0x06, 0x06, 0x03, 0x18, 0x00,
+  0xaf, 0xff, 0x0c, 0x07, 0x1f, 0x00, 0x00, 0x00, 0xe0, 0x41, 0x06, 0x08,
+  0x03, 0x00, 0x15, 0x07, 0x02, 0x01, 0x0c, 0x07, 0x0e, 0x00, 0x00, 0x00,
+  0xd0, 0x40, 0x0c, 0x08, 0x21, 0x00, 0x00, 0x80, 0xf0, 0x80, 0x0c, 0x09,
+  0x23, 0x00, 0x00, 0x88, 0xf0, 0x80, 0x15, 0x07, 0x03, 0x01, 0x0c, 0x07,
+  0x25, 0x00, 0x00, 0x00, 0x40, 0x42, 0x0c, 0x08, 0x28, 0x00, 0x00, 0x9c,
+  0x60, 0x82, 0x05, 0x09, 0x29, 0x00, 0x0c, 0x0a, 0x2b, 0x00, 0x00, 0x00,
+  0xa0, 0x42, 0x0f, 0x0b, 0x00, 0x8a, 0x2c, 0x00, 0x00, 0x00, 0x15, 0x0a,
+  0x02, 0x02, 0x0f, 0x0b, 0x00, 0xb8, 0x0b, 0x00, 0x00, 0x00, 0x0f, 0x0c,
+  0x00, 0xe1, 0x12, 0x00, 0x00, 0x00, 0x0c, 0x0d, 0x2e, 0x00, 0x00, 0x00,
+  0xd0, 0x42, 0x15, 0x08, 0x06, 0x00, 0x15, 0x07, 0x00, 0x01, 0x09, 0x07,
+  0x03, 0x00, 0x15, 0x07, 0x01, 0x01, 0x16, 0x00, 0x01, 0x00, 0x2f, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x03, 0x08, 0x04, 0x00,
+  0x00, 0x10, 0x40, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f,
+  0x03, 0x09, 0x03, 0x0a, 0x04, 0x00, 0x14, 0x40, 0x80, 0x03, 0x14, 0x04,
+  0x00, 0x00, 0x70, 0x40, 0x03, 0x15, 0x04, 0x00, 0x00, 0x90, 0x40, 0x03,
+  0x10, 0x03, 0x0f, 0x03, 0x16, 0x04, 0x00, 0x00, 0xd0, 0x40, 0x03, 0x17,
+  0x03, 0x18, 0x04, 0x00, 0x40, 0xf0, 0x80, 0x03, 0x0d, 0x03, 0x0c, 0x03,
+  0x19, 0x03, 0x1a, 0x03, 0x1b, 0x03, 0x1c, 0x03, 0x1d, 0x03, 0x1e, 0x03,
+  0x1f, 0x04, 0x00, 0x00, 0xa0, 0x41, 0x03, 0x20, 0x03, 0x21, 0x03, 0x22,
+  0x04, 0x00, 0x00, 0xe0, 0x41, 0x03, 0x23, 0x04, 0x00, 0x80, 0xf0, 0x80,
+  0x03, 0x24, 0x04, 0x00, 0x88, 0xf0, 0x80, 0x03, 0x25, 0x04, 0x00, 0x00,
+  0x40, 0x42, 0x03, 0x26, 0x03, 0x27, 0x04, 0x00, 0x9c, 0x60, 0x82, 0x03,
+  0x28, 0x03, 0x29, 0x04, 0x00, 0x00, 0xa0, 0x42, 0x03, 0x2a, 0x03, 0x2b,
+  0x04, 0x00, 0x00, 0xd0, 0x42, 0x00, 0x6a, 0x2c, 0x01, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x03, 0xe8, 0x1a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x03, 0x00, 0x01, 0x43,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x02, 0x03, 0x00, 0x00, 0x00, 0x33, 0x06,
+  0x04, 0x00, 0x00, 0x06, 0x02, 0x01, 0x00, 0x05, 0x03, 0x00, 0x00, 0x38,
+  0x02, 0x2d, 0x00, 0x0c, 0x05, 0x02, 0x00, 0x00, 0x00, 0x10, 0x40, 0x22,
+  0x07, 0x04, 0x00, 0x22, 0x09, 0x01, 0x00, 0x4b, 0x12, 0x09, 0x04, 0x03,
+  0x00, 0x00, 0x00, 0x05, 0x0a, 0x03, 0x00, 0x0c, 0x08, 0x06, 0x00, 0x00,
+  0x14, 0x40, 0x80, 0x15, 0x08, 0x03, 0x02, 0x24, 0x06, 0x07, 0x08, 0x15,
+  0x05, 0x02, 0x01, 0x09, 0x06, 0x00, 0x00, 0x0f, 0x05, 0x06, 0x60, 0x07,
+  0x00, 0x00, 0x00, 0x09, 0x07, 0x01, 0x00, 0x09, 0x08, 0x02, 0x00, 0x06,
+  0x09, 0x04, 0x00, 0x27, 0x0c, 0x04, 0x00, 0x28, 0x0b, 0x0c, 0x03, 0x4a,
+  0x13, 0x0b, 0x04, 0x01, 0x00, 0x00, 0x00, 0x06, 0x0c, 0x01, 0x00, 0x0c,
+  0x0a, 0x09, 0x00, 0x00, 0x20, 0x40, 0x80, 0x15, 0x0a, 0x03, 0x02, 0x14,
+  0x05, 0x05, 0x56, 0x0a, 0x00, 0x00, 0x00, 0x15, 0x05, 0x06, 0x07, 0x1a,
+  0x05, 0x0e, 0x00, 0x36, 0x0b, 0x11, 0x00, 0x10, 0x05, 0x0b, 0xbb, 0x0b,
+  0x00, 0x00, 0x00, 0x10, 0x06, 0x0b, 0x8f, 0x0c, 0x00, 0x00, 0x00, 0x10,
+  0x07, 0x0b, 0x95, 0x0d, 0x00, 0x00, 0x00, 0x10, 0x08, 0x0b, 0x87, 0x0e,
+  0x00, 0x00, 0x00, 0x10, 0x09, 0x0b, 0x9d, 0x0f, 0x00, 0x00, 0x00, 0x10,
+  0x0a, 0x0b, 0xf8, 0x10, 0x00, 0x00, 0x00, 0x16, 0x0b, 0x02, 0x00, 0x39,
+  0x02, 0xd3, 0xff, 0x02, 0x02, 0x00, 0x00, 0x16, 0x02, 0x02, 0x00, 0x12,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x41, 0x03, 0x2d, 0x04,
+  0x00, 0x00, 0x10, 0x40, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
+  0x3f, 0x03, 0x09, 0x03, 0x0a, 0x04, 0x00, 0x14, 0x40, 0x80, 0x03, 0x05,
+  0x03, 0x12, 0x04, 0x00, 0x20, 0x40, 0x80, 0x03, 0x2e, 0x03, 0x1a, 0x03,
+  0x1b, 0x03, 0x1c, 0x03, 0x1d, 0x03, 0x1e, 0x03, 0x2f, 0x05, 0x06, 0x0b,
+  0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x00, 0xa5, 0x01, 0x30, 0x01, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb,
+  0x08, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x0b, 0x09, 0x00, 0x00, 0x00, 0x09, 0x01, 0x01, 0x00, 0x09, 0x02,
+  0x02, 0x00, 0x15, 0x00, 0x03, 0x02, 0x19, 0x00, 0x05, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x04, 0x01, 0x01, 0x00, 0x09, 0x03, 0x01, 0x00, 0x28, 0x02,
+  0x03, 0x00, 0x15, 0x00, 0x03, 0x02, 0x16, 0x00, 0x02, 0x00, 0x01, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x00, 0xb1, 0x01, 0x00,
+  0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x04, 0x00, 0x00, 0x00,
+  0x6a, 0x0c, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x09, 0x02, 0x00,
+  0x00, 0x09, 0x03, 0x01, 0x00, 0x15, 0x01, 0x03, 0x03, 0x19, 0x01, 0x0b,
+  0x00, 0x0c, 0x03, 0x03, 0x00, 0x00, 0x00, 0x20, 0x40, 0x05, 0x04, 0x04,
+  0x00, 0x49, 0x01, 0x02, 0x03, 0x06, 0x06, 0x02, 0x00, 0x0c, 0x05, 0x06,
+  0x00, 0x00, 0x00, 0x50, 0x40, 0x15, 0x05, 0x02, 0x00, 0x15, 0x03, 0x00,
+  0x01, 0x03, 0x03, 0x00, 0x00, 0x16, 0x03, 0x02, 0x00, 0x0f, 0x03, 0x00,
+  0x60, 0x07, 0x00, 0x00, 0x00, 0x14, 0x03, 0x03, 0x3c, 0x08, 0x00, 0x00,
+  0x00, 0x15, 0x03, 0x02, 0x02, 0x0f, 0x04, 0x00, 0x60, 0x07, 0x00, 0x00,
+  0x00, 0x0f, 0x06, 0x00, 0xb8, 0x09, 0x00, 0x00, 0x00, 0x14, 0x04, 0x04,
+  0x50, 0x0a, 0x00, 0x00, 0x00, 0x15, 0x04, 0x03, 0x02, 0x0f, 0x05, 0x00,
+  0xe7, 0x0b, 0x00, 0x00, 0x00, 0x1a, 0x05, 0x09, 0x00, 0x0f, 0x06, 0x05,
+  0xbb, 0x0c, 0x00, 0x00, 0x00, 0x0f, 0x07, 0x00, 0xb8, 0x09, 0x00, 0x00,
+  0x00, 0x1e, 0x06, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0f, 0x06, 0x05,
+  0xf8, 0x0e, 0x00, 0x00, 0x00, 0x27, 0x04, 0x06, 0x0d, 0x13, 0x06, 0x00,
+  0x00, 0x46, 0x00, 0x00, 0x00, 0x46, 0x00, 0x01, 0x00, 0x46, 0x02, 0x01,
+  0x00, 0x0c, 0x07, 0x10, 0x00, 0x00, 0x00, 0xf0, 0x40, 0x05, 0x08, 0x11,
+  0x00, 0x13, 0x09, 0x01, 0x00, 0x46, 0x00, 0x06, 0x00, 0x46, 0x01, 0x04,
+  0x00, 0x46, 0x00, 0x03, 0x00, 0x15, 0x07, 0x03, 0x03, 0x19, 0x07, 0x03,
+  0x00, 0x03, 0x09, 0x00, 0x00, 0x0b, 0x04, 0x00, 0x00, 0x16, 0x09, 0x02,
+  0x00, 0x19, 0x08, 0x08, 0x00, 0x0c, 0x09, 0x03, 0x00, 0x00, 0x00, 0x20,
+  0x40, 0x05, 0x0a, 0x04, 0x00, 0x05, 0x0b, 0x12, 0x00, 0x15, 0x09, 0x03,
+  0x01, 0x03, 0x09, 0x00, 0x00, 0x0b, 0x04, 0x00, 0x00, 0x16, 0x09, 0x02,
+  0x00, 0x10, 0x08, 0x00, 0xe7, 0x0b, 0x00, 0x00, 0x00, 0x0f, 0x09, 0x08,
+  0xbb, 0x0c, 0x00, 0x00, 0x00, 0x49, 0x0c, 0x09, 0x02, 0x06, 0x0d, 0x09,
+  0x00, 0x09, 0x0c, 0x02, 0x00, 0x15, 0x0c, 0x02, 0x02, 0x0f, 0x0d, 0x00,
+  0xe1, 0x13, 0x00, 0x00, 0x00, 0x4a, 0x13, 0x0c, 0x03, 0x0d, 0x00, 0x00,
+  0x00, 0x0c, 0x0b, 0x16, 0x00, 0x00, 0x54, 0x40, 0x81, 0x15, 0x0b, 0x03,
+  0x02, 0x4b, 0x12, 0x0b, 0x04, 0x0d, 0x00, 0x00, 0x00, 0x05, 0x0c, 0x0d,
+  0x00, 0x0c, 0x0a, 0x18, 0x00, 0x00, 0x5c, 0x40, 0x81, 0x15, 0x0a, 0x03,
+  0x02, 0x10, 0x0a, 0x00, 0xb8, 0x09, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x01,
+  0x00, 0x10, 0x0a, 0x00, 0xf0, 0x19, 0x00, 0x00, 0x00, 0x09, 0x09, 0x03,
+  0x00, 0x06, 0x0a, 0x00, 0x00, 0x0c, 0x0f, 0x1c, 0x00, 0x00, 0x00, 0xb0,
+  0x41, 0x28, 0x0e, 0x0f, 0x0d, 0x2a, 0x0d, 0x0e, 0x1a, 0x49, 0x0c, 0x0d,
+  0x01, 0x09, 0x0c, 0x02, 0x00, 0x15, 0x0c, 0x02, 0x02, 0x33, 0x0b, 0x0c,
+  0x00, 0x15, 0x09, 0x03, 0x01, 0x03, 0x09, 0x01, 0x00, 0x0b, 0x04, 0x00,
+  0x00, 0x16, 0x09, 0x02, 0x00, 0x1d, 0x03, 0x31, 0x04, 0x00, 0x00, 0x00,
+  0x40, 0x03, 0x32, 0x04, 0x00, 0x00, 0x20, 0x40, 0x03, 0x33, 0x03, 0x34,
+  0x04, 0x00, 0x00, 0x50, 0x40, 0x03, 0x05, 0x03, 0x35, 0x03, 0x10, 0x03,
+  0x36, 0x03, 0x19, 0x03, 0x1a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf0, 0x3f, 0x03, 0x2f, 0x03, 0x37, 0x04, 0x00, 0x00, 0xf0, 0x40, 0x03,
+  0x38, 0x03, 0x39, 0x03, 0x0d, 0x03, 0x09, 0x03, 0x12, 0x04, 0x00, 0x54,
+  0x40, 0x81, 0x03, 0x0a, 0x04, 0x00, 0x5c, 0x40, 0x81, 0x03, 0x0f, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x03, 0x14, 0x04, 0x00,
+  0x00, 0xb0, 0x41, 0x02, 0x06, 0x07, 0x97, 0x01, 0x3a, 0x01, 0x18, 0x32,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0xa9, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x66, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x09, 0x00, 0x00,
+  0x00, 0x09, 0x01, 0x01, 0x00, 0x15, 0x00, 0x02, 0x01, 0x16, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0xe8, 0x01, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0xe8, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x01, 0x04, 0x00, 0x00, 0x00, 0x7d,
+  0x0c, 0x01, 0x02, 0x00, 0x00, 0x04, 0x00, 0x80, 0x36, 0x02, 0x09, 0x00,
+  0x09, 0x04, 0x00, 0x00, 0x30, 0x03, 0x04, 0x0a, 0x10, 0x03, 0x02, 0xcc,
+  0x03, 0x00, 0x00, 0x00, 0x09, 0x05, 0x00, 0x00, 0x30, 0x04, 0x05, 0x0a,
+  0x14, 0x04, 0x04, 0x3c, 0x0c, 0x00, 0x00, 0x00, 0x15, 0x04, 0x02, 0x02,
+  0x27, 0x03, 0x04, 0x0b, 0x10, 0x03, 0x02, 0x46, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x03, 0x0b, 0x00, 0x10, 0x03, 0x02, 0x87, 0x05, 0x00, 0x00, 0x00,
+  0x04, 0x03, 0x01, 0x00, 0x10, 0x03, 0x02, 0x86, 0x06, 0x00, 0x00, 0x00,
+  0x04, 0x03, 0xff, 0xff, 0x10, 0x03, 0x02, 0xe4, 0x07, 0x00, 0x00, 0x00,
+  0x04, 0x03, 0x02, 0x00, 0x10, 0x03, 0x02, 0xe5, 0x08, 0x00, 0x00, 0x00,
+  0x15, 0x01, 0x02, 0x02, 0x0c, 0x02, 0x0e, 0x00, 0x00, 0x34, 0x00, 0x80,
+  0x36, 0x03, 0x10, 0x00, 0x05, 0x04, 0x11, 0x00, 0x10, 0x04, 0x03, 0xe3,
+  0x0f, 0x00, 0x00, 0x00, 0x09, 0x04, 0x01, 0x00, 0x10, 0x04, 0x03, 0xcc,
+  0x03, 0x00, 0x00, 0x00, 0x04, 0x04, 0x01, 0x00, 0x10, 0x04, 0x03, 0x87,
+  0x05, 0x00, 0x00, 0x00, 0x04, 0x04, 0x03, 0x00, 0x10, 0x04, 0x03, 0x86,
+  0x06, 0x00, 0x00, 0x00, 0x04, 0x04, 0xff, 0xff, 0x10, 0x04, 0x03, 0xe4,
+  0x07, 0x00, 0x00, 0x00, 0x04, 0x04, 0x03, 0x00, 0x10, 0x04, 0x03, 0xe5,
+  0x08, 0x00, 0x00, 0x00, 0x15, 0x02, 0x02, 0x02, 0x36, 0x03, 0x17, 0x00,
+  0x05, 0x04, 0x18, 0x00, 0x10, 0x04, 0x03, 0x9a, 0x12, 0x00, 0x00, 0x00,
+  0x05, 0x04, 0x19, 0x00, 0x10, 0x04, 0x03, 0xf7, 0x13, 0x00, 0x00, 0x00,
+  0x04, 0x04, 0x04, 0x00, 0x10, 0x04, 0x03, 0xdc, 0x14, 0x00, 0x00, 0x00,
+  0x35, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x1a, 0x00,
+  0x10, 0x05, 0x04, 0xb5, 0x1b, 0x00, 0x00, 0x00, 0x05, 0x05, 0x1a, 0x00,
+  0x10, 0x05, 0x04, 0xde, 0x1c, 0x00, 0x00, 0x00, 0x10, 0x04, 0x03, 0x8e,
+  0x15, 0x00, 0x00, 0x00, 0x35, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x0c, 0x05, 0x1e, 0x00, 0x00, 0x74, 0x00, 0x80, 0x36, 0x06, 0x20, 0x00,
+  0x05, 0x07, 0x21, 0x00, 0x10, 0x07, 0x06, 0xcc, 0x03, 0x00, 0x00, 0x00,
+  0x04, 0x07, 0x01, 0x00, 0x10, 0x07, 0x06, 0x87, 0x05, 0x00, 0x00, 0x00,
+  0x04, 0x07, 0x01, 0x00, 0x10, 0x07, 0x06, 0x86, 0x06, 0x00, 0x00, 0x00,
+  0x04, 0x07, 0x0a, 0x00, 0x10, 0x07, 0x06, 0xe4, 0x07, 0x00, 0x00, 0x00,
+  0x04, 0x07, 0x01, 0x00, 0x10, 0x07, 0x06, 0xe5, 0x08, 0x00, 0x00, 0x00,
+  0x05, 0x07, 0x22, 0x00, 0x10, 0x07, 0x06, 0xd4, 0x1f, 0x00, 0x00, 0x00,
+  0x15, 0x05, 0x02, 0x02, 0x06, 0x06, 0x01, 0x00, 0x06, 0x07, 0x02, 0x00,
+  0x37, 0x04, 0x05, 0x04, 0x01, 0x00, 0x00, 0x00, 0x10, 0x04, 0x03, 0xf7,
+  0x16, 0x00, 0x00, 0x00, 0x0c, 0x04, 0x24, 0x00, 0x00, 0x8c, 0x00, 0x80,
+  0x06, 0x05, 0x03, 0x00, 0x13, 0x06, 0x00, 0x00, 0x46, 0x02, 0x02, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x05, 0x08, 0x25, 0x00, 0x0c, 0x09, 0x27, 0x00,
+  0x00, 0x00, 0x60, 0x42, 0x05, 0x0a, 0x28, 0x00, 0x31, 0x07, 0x08, 0x0a,
+  0x15, 0x04, 0x04, 0x02, 0x19, 0x04, 0x02, 0x00, 0x03, 0x04, 0x00, 0x00,
+  0x16, 0x04, 0x02, 0x00, 0x0f, 0x04, 0x01, 0xcc, 0x03, 0x00, 0x00, 0x00,
+  0x0a, 0x04, 0x00, 0x00, 0x0f, 0x04, 0x02, 0xcc, 0x03, 0x00, 0x00, 0x00,
+  0x0a, 0x04, 0x01, 0x00, 0x09, 0x04, 0x03, 0x00, 0x06, 0x05, 0x00, 0x00,
+  0x15, 0x04, 0x02, 0x02, 0x16, 0x04, 0x02, 0x00, 0x29, 0x03, 0x3b, 0x03,
+  0x3c, 0x04, 0x00, 0x04, 0x00, 0x80, 0x03, 0x3d, 0x03, 0x3e, 0x03, 0x3f,
+  0x03, 0x40, 0x03, 0x41, 0x03, 0x42, 0x05, 0x06, 0x03, 0x04, 0x05, 0x06,
+  0x07, 0x08, 0x03, 0x43, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
+  0x3f, 0x03, 0x35, 0x03, 0x44, 0x04, 0x00, 0x34, 0x00, 0x80, 0x03, 0x45,
+  0x05, 0x06, 0x0f, 0x03, 0x05, 0x06, 0x07, 0x08, 0x03, 0x46, 0x03, 0x47,
+  0x03, 0x48, 0x03, 0x49, 0x03, 0x4a, 0x03, 0x4b, 0x05, 0x05, 0x12, 0x13,
+  0x14, 0x15, 0x16, 0x03, 0x33, 0x03, 0x4c, 0x03, 0x4d, 0x03, 0x4e, 0x03,
+  0x4f, 0x03, 0x50, 0x04, 0x00, 0x74, 0x00, 0x80, 0x03, 0x51, 0x05, 0x06,
+  0x03, 0x05, 0x06, 0x07, 0x08, 0x1f, 0x03, 0x52, 0x03, 0x53, 0x03, 0x54,
+  0x04, 0x00, 0x8c, 0x00, 0x80, 0x03, 0x55, 0x03, 0x2b, 0x04, 0x00, 0x00,
+  0x60, 0x42, 0x03, 0x56, 0x01, 0x09, 0xc4, 0x01, 0x57, 0x01, 0x18, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xfd, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfd, 0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0xfe, 0x00, 0x05, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xfd, 0x06, 0x01, 0x00,
+  0x00, 0xf8, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x01,
+  0x00, 0x00, 0x00, 0x2f, 0x0c, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40,
+  0x05, 0x02, 0x02, 0x00, 0x0c, 0x03, 0x05, 0x00, 0x00, 0x10, 0x30, 0x80,
+  0x05, 0x04, 0x06, 0x00, 0x0f, 0x05, 0x00, 0xe1, 0x07, 0x00, 0x00, 0x00,
+  0x15, 0x03, 0x03, 0x02, 0x0f, 0x05, 0x00, 0xb8, 0x08, 0x00, 0x00, 0x00,
+  0x49, 0x3f, 0x05, 0x02, 0x0c, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x90, 0x40,
+  0x15, 0x04, 0x02, 0x02, 0x15, 0x01, 0x04, 0x02, 0x06, 0x02, 0x01, 0x00,
+  0x1a, 0x02, 0x05, 0x00, 0x49, 0x3e, 0x01, 0x03, 0x06, 0x03, 0x01, 0x00,
+  0x0c, 0x02, 0x0c, 0x00, 0x00, 0x00, 0xb0, 0x40, 0x15, 0x02, 0x02, 0x02,
+  0x1a, 0x02, 0x16, 0x00, 0x49, 0x0c, 0x02, 0x02, 0x06, 0x06, 0x02, 0x00,
+  0x09, 0x05, 0x00, 0x00, 0x15, 0x05, 0x02, 0x02, 0x0f, 0x06, 0x00, 0xe1,
+  0x07, 0x00, 0x00, 0x00, 0x4a, 0x13, 0x05, 0x03, 0x06, 0x00, 0x00, 0x00,
+  0x0c, 0x04, 0x0f, 0x00, 0x00, 0x38, 0xd0, 0x80, 0x15, 0x04, 0x03, 0x02,
+  0x4b, 0x12, 0x04, 0x04, 0x10, 0x00, 0x00, 0x00, 0x05, 0x05, 0x10, 0x00,
+  0x0c, 0x03, 0x12, 0x00, 0x00, 0x44, 0xd0, 0x80, 0x15, 0x03, 0x03, 0x02,
+  0x10, 0x03, 0x00, 0xb8, 0x08, 0x00, 0x00, 0x00, 0x04, 0x03, 0x01, 0x00,
+  0x10, 0x03, 0x00, 0xf0, 0x13, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00,
+  0x14, 0x03, 0x58, 0x04, 0x00, 0x00, 0x00, 0x40, 0x03, 0x59, 0x03, 0x26,
+  0x03, 0x27, 0x04, 0x00, 0x10, 0x30, 0x80, 0x03, 0x5a, 0x03, 0x0d, 0x03,
+  0x10, 0x03, 0x5b, 0x04, 0x00, 0x00, 0x90, 0x40, 0x03, 0x5c, 0x04, 0x00,
+  0x00, 0xb0, 0x40, 0x03, 0x09, 0x03, 0x12, 0x04, 0x00, 0x38, 0xd0, 0x80,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x03, 0x0a, 0x04,
+  0x00, 0x44, 0xd0, 0x80, 0x03, 0x0f, 0x00, 0xf1, 0x01, 0x5d, 0x01, 0x18,
+  0x8c, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x91, 0x66,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x09,
+  0x00, 0x00, 0x00, 0x09, 0x01, 0x01, 0x00, 0x04, 0x02, 0xff, 0xff, 0x15,
+  0x00, 0x03, 0x01, 0x16, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x00,
+  0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x09, 0x00, 0x00, 0x00, 0x09,
+  0x01, 0x01, 0x00, 0x04, 0x02, 0x01, 0x00, 0x15, 0x00, 0x03, 0x01, 0x16,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0xfd, 0x01, 0x00, 0x01, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x08, 0x09, 0x00, 0x00, 0x00, 0x09, 0x01, 0x01, 0x00, 0x0c,
+  0x04, 0x02, 0x00, 0x00, 0x00, 0x10, 0x40, 0x28, 0x03, 0x04, 0x00, 0x33,
+  0x02, 0x03, 0x00, 0x15, 0x00, 0x03, 0x01, 0x16, 0x00, 0x01, 0x00, 0x03,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x03, 0x14, 0x04,
+  0x00, 0x00, 0x10, 0x40, 0x00, 0xfe, 0x01, 0x00, 0x01, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x00, 0x00, 0x09, 0x01,
+  0x01, 0x00, 0x0c, 0x03, 0x02, 0x00, 0x00, 0x00, 0x10, 0x40, 0x28, 0x02,
+  0x03, 0x00, 0x15, 0x00, 0x03, 0x01, 0x16, 0x00, 0x01, 0x00, 0x03, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x03, 0x14, 0x04, 0x00,
+  0x00, 0x10, 0x40, 0x00, 0xff, 0x01, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x15, 0x09, 0x00, 0x00, 0x00, 0x04, 0x03, 0x01, 0x00,
+  0x0f, 0x04, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x13, 0x03, 0x03,
+  0x04, 0x00, 0x00, 0x00, 0x0c, 0x02, 0x03, 0x00, 0x00, 0x08, 0x10, 0x80,
+  0x15, 0x02, 0x03, 0x02, 0x4b, 0x12, 0x02, 0x04, 0x04, 0x00, 0x00, 0x00,
+  0x05, 0x03, 0x04, 0x00, 0x0c, 0x01, 0x06, 0x00, 0x00, 0x14, 0x10, 0x80,
+  0x15, 0x01, 0x03, 0x02, 0x10, 0x01, 0x00, 0xb8, 0x07, 0x00, 0x00, 0x00,
+  0x04, 0x01, 0x01, 0x00, 0x10, 0x01, 0x00, 0xf0, 0x08, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x01, 0x00, 0x09, 0x03, 0x0d, 0x03, 0x09, 0x03, 0x12, 0x04,
+  0x00, 0x08, 0x10, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
+  0x3f, 0x03, 0x0a, 0x04, 0x00, 0x14, 0x10, 0x80, 0x03, 0x10, 0x03, 0x0f,
+  0x00, 0x80, 0x02, 0x00, 0x01, 0x18, 0x9a, 0x66, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x99, 0x66, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x1b, 0x09, 0x00, 0x00, 0x00, 0x09, 0x02, 0x00, 0x00, 0x0f,
+  0x01, 0x02, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x49, 0x0c, 0x01, 0x02, 0x06,
+  0x05, 0x01, 0x00, 0x09, 0x04, 0x01, 0x00, 0x15, 0x04, 0x02, 0x02, 0x0f,
+  0x05, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x13, 0x04, 0x03, 0x05,
+  0x00, 0x00, 0x00, 0x0c, 0x03, 0x03, 0x00, 0x00, 0x08, 0x10, 0x80, 0x15,
+  0x03, 0x03, 0x02, 0x4b, 0x12, 0x03, 0x04, 0x04, 0x00, 0x00, 0x00, 0x05,
+  0x04, 0x04, 0x00, 0x0c, 0x02, 0x06, 0x00, 0x00, 0x14, 0x10, 0x80, 0x15,
+  0x02, 0x03, 0x02, 0x10, 0x02, 0x00, 0xb8, 0x07, 0x00, 0x00, 0x00, 0x04,
+  0x02, 0x01, 0x00, 0x10, 0x02, 0x00, 0xf0, 0x08, 0x00, 0x00, 0x00, 0x16,
+  0x00, 0x01, 0x00, 0x09, 0x03, 0x0d, 0x03, 0x09, 0x03, 0x12, 0x04, 0x00,
+  0x08, 0x10, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f,
+  0x03, 0x0a, 0x04, 0x00, 0x14, 0x10, 0x80, 0x03, 0x10, 0x03, 0x0f, 0x00,
+  0x81, 0x02, 0x00, 0x01, 0x18, 0x9b, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x9a, 0x66, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00,
+  0x09, 0x01, 0x01, 0x00, 0x15, 0x00, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x82, 0x02, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0a, 0x09,
+  0x00, 0x00, 0x00, 0x1a, 0x00, 0x04, 0x00, 0x09, 0x00, 0x01, 0x00, 0x09,
+  0x01, 0x02, 0x00, 0x15, 0x00, 0x02, 0x01, 0x16, 0x00, 0x01, 0x00, 0x09,
+  0x00, 0x03, 0x00, 0x09, 0x01, 0x02, 0x00, 0x15, 0x00, 0x02, 0x01, 0x16,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x83, 0x02, 0x00, 0x01, 0x18, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x04, 0x01, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x02, 0x00, 0x00, 0x00, 0x30, 0x09, 0x00, 0x00, 0x00,
+  0x0c, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x05, 0x02, 0x02, 0x00,
+  0x0c, 0x03, 0x05, 0x00, 0x00, 0x10, 0x30, 0x80, 0x05, 0x04, 0x06, 0x00,
+  0x0f, 0x05, 0x00, 0xe1, 0x07, 0x00, 0x00, 0x00, 0x15, 0x03, 0x03, 0x02,
+  0x0f, 0x05, 0x00, 0xb8, 0x08, 0x00, 0x00, 0x00, 0x49, 0x3f, 0x05, 0x02,
+  0x0c, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x90, 0x40, 0x15, 0x04, 0x02, 0x02,
+  0x15, 0x01, 0x04, 0x02, 0x06, 0x02, 0x01, 0x00, 0x1a, 0x02, 0x05, 0x00,
+  0x49, 0x3e, 0x01, 0x03, 0x06, 0x03, 0x01, 0x00, 0x0c, 0x02, 0x0c, 0x00,
+  0x00, 0x00, 0xb0, 0x40, 0x15, 0x02, 0x02, 0x02, 0x1a, 0x02, 0x16, 0x00,
+  0x49, 0x0c, 0x02, 0x02, 0x06, 0x06, 0x02, 0x00, 0x09, 0x05, 0x01, 0x00,
+  0x15, 0x05, 0x02, 0x02, 0x0f, 0x06, 0x00, 0xe1, 0x07, 0x00, 0x00, 0x00,
+  0x4a, 0x13, 0x05, 0x03, 0x06, 0x00, 0x00, 0x00, 0x0c, 0x04, 0x0f, 0x00,
+  0x00, 0x38, 0xd0, 0x80, 0x15, 0x04, 0x03, 0x02, 0x4b, 0x12, 0x04, 0x04,
+  0x10, 0x00, 0x00, 0x00, 0x05, 0x05, 0x10, 0x00, 0x0c, 0x03, 0x12, 0x00,
+  0x00, 0x44, 0xd0, 0x80, 0x15, 0x03, 0x03, 0x02, 0x10, 0x03, 0x00, 0xb8,
+  0x08, 0x00, 0x00, 0x00, 0x04, 0x03, 0x01, 0x00, 0x10, 0x03, 0x00, 0xf0,
+  0x13, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0x14, 0x03, 0x58, 0x04,
+  0x00, 0x00, 0x00, 0x40, 0x03, 0x59, 0x03, 0x26, 0x03, 0x27, 0x04, 0x00,
+  0x10, 0x30, 0x80, 0x03, 0x5a, 0x03, 0x0d, 0x03, 0x10, 0x03, 0x5b, 0x04,
+  0x00, 0x00, 0x90, 0x40, 0x03, 0x5c, 0x04, 0x00, 0x00, 0xb0, 0x40, 0x03,
+  0x09, 0x03, 0x12, 0x04, 0x00, 0x38, 0xd0, 0x80, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xf0, 0x3f, 0x03, 0x0a, 0x04, 0x00, 0x44, 0xd0, 0x80,
+  0x03, 0x0f, 0x00, 0x8a, 0x02, 0x00, 0x01, 0x18, 0xa4, 0xe8, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x71, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xa3, 0x66, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x40, 0x15, 0x00, 0x01, 0x01, 0x16, 0x00, 0x01, 0x00,
+  0x02, 0x03, 0x5e, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x8b, 0x02, 0x00,
+  0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x00, 0x05,
+  0x01, 0x07, 0x00, 0x00, 0x00, 0x58, 0x35, 0x01, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x13, 0x02, 0x00, 0x00, 0x46, 0x02, 0x00, 0x00, 0x46, 0x00,
+  0x00, 0x00, 0x10, 0x02, 0x01, 0x48, 0x00, 0x00, 0x00, 0x00, 0x13, 0x02,
+  0x01, 0x00, 0x46, 0x02, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x10, 0x02,
+  0x01, 0xf9, 0x01, 0x00, 0x00, 0x00, 0x13, 0x02, 0x02, 0x00, 0x46, 0x02,
+  0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x10, 0x02, 0x01, 0x81, 0x02, 0x00,
+  0x00, 0x00, 0x13, 0x02, 0x03, 0x00, 0x46, 0x02, 0x00, 0x00, 0x46, 0x00,
+  0x00, 0x00, 0x10, 0x02, 0x01, 0x22, 0x03, 0x00, 0x00, 0x00, 0x13, 0x02,
+  0x04, 0x00, 0x46, 0x00, 0x00, 0x00, 0x10, 0x02, 0x01, 0x36, 0x04, 0x00,
+  0x00, 0x00, 0x13, 0x02, 0x05, 0x00, 0x46, 0x00, 0x00, 0x00, 0x46, 0x02,
+  0x01, 0x00, 0x10, 0x02, 0x01, 0xbd, 0x05, 0x00, 0x00, 0x00, 0x13, 0x02,
+  0x06, 0x00, 0x46, 0x02, 0x02, 0x00, 0x46, 0x00, 0x00, 0x00, 0x10, 0x02,
+  0x01, 0x8e, 0x06, 0x00, 0x00, 0x00, 0x13, 0x02, 0x07, 0x00, 0x46, 0x02,
+  0x03, 0x00, 0x46, 0x02, 0x04, 0x00, 0x46, 0x00, 0x00, 0x00, 0x46, 0x02,
+  0x02, 0x00, 0x10, 0x02, 0x01, 0xc0, 0x07, 0x00, 0x00, 0x00, 0x13, 0x02,
+  0x08, 0x00, 0x46, 0x00, 0x00, 0x00, 0x46, 0x02, 0x01, 0x00, 0x10, 0x02,
+  0x01, 0x9c, 0x08, 0x00, 0x00, 0x00, 0x40, 0x02, 0x09, 0x00, 0x10, 0x02,
+  0x01, 0xbd, 0x0a, 0x00, 0x00, 0x00, 0x0c, 0x02, 0x0c, 0x00, 0x00, 0x00,
+  0xb0, 0x40, 0x15, 0x02, 0x01, 0x01, 0x0c, 0x02, 0x0e, 0x00, 0x00, 0x00,
+  0xd0, 0x40, 0x19, 0x02, 0x1e, 0x00, 0x09, 0x02, 0x05, 0x00, 0x06, 0x03,
+  0x00, 0x00, 0x15, 0x02, 0x02, 0x01, 0x09, 0x02, 0x06, 0x00, 0x15, 0x02,
+  0x01, 0x02, 0x50, 0x02, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x80, 0x0c, 0x03,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x41, 0x15, 0x03, 0x01, 0x01, 0x17, 0x00,
+  0x12, 0x00, 0x50, 0x02, 0x12, 0x00, 0x12, 0x00, 0x00, 0x00, 0x50, 0x02,
+  0x10, 0x00, 0x13, 0x00, 0x00, 0x00, 0x50, 0x02, 0x02, 0x00, 0x14, 0x00,
+  0x00, 0x80, 0x16, 0x00, 0x01, 0x00, 0x49, 0x28, 0x02, 0x03, 0x06, 0x04,
+  0x02, 0x00, 0x0c, 0x03, 0x16, 0x00, 0x00, 0x00, 0x50, 0x41, 0x15, 0x03,
+  0x02, 0x02, 0x50, 0x03, 0x05, 0x00, 0x17, 0x00, 0x00, 0x80, 0x0d, 0x03,
+  0x01, 0x02, 0x1a, 0x03, 0x02, 0x00, 0x06, 0x04, 0x03, 0x00, 0x15, 0x04,
+  0x01, 0x01, 0x18, 0x00, 0xdf, 0xff, 0x16, 0x00, 0x01, 0x00, 0x18, 0x03,
+  0x5f, 0x03, 0x60, 0x03, 0x61, 0x03, 0x62, 0x03, 0x63, 0x03, 0x64, 0x03,
+  0x65, 0x03, 0x66, 0x03, 0x67, 0x06, 0x15, 0x03, 0x68, 0x03, 0x5e, 0x04,
+  0x00, 0x00, 0xb0, 0x40, 0x03, 0x69, 0x04, 0x00, 0x00, 0xd0, 0x40, 0x03,
+  0x6a, 0x03, 0x6b, 0x04, 0x00, 0x00, 0x00, 0x41, 0x03, 0x6c, 0x03, 0x6d,
+  0x03, 0x6e, 0x03, 0x6f, 0x04, 0x00, 0x00, 0x50, 0x41, 0x03, 0x26, 0x0a,
+  0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0xfa, 0x01,
+  0x70, 0x01, 0x18, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x01, 0x00, 0xf6, 0x0e, 0xfb, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x01, 0x02, 0x00, 0x00, 0x00, 0x46, 0x19, 0x00, 0x0a, 0x00, 0x0c,
+  0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x05, 0x02, 0x02, 0x00, 0x05,
+  0x03, 0x03, 0x00, 0x03, 0x04, 0x00, 0x00, 0x15, 0x01, 0x04, 0x02, 0x06,
+  0x00, 0x01, 0x00, 0x19, 0x00, 0x02, 0x00, 0x03, 0x01, 0x00, 0x00, 0x16,
+  0x01, 0x02, 0x00, 0x49, 0x01, 0x00, 0x03, 0x06, 0x02, 0x00, 0x00, 0x0c,
+  0x01, 0x05, 0x00, 0x00, 0x00, 0x40, 0x40, 0x15, 0x01, 0x02, 0x01, 0x0c,
+  0x01, 0x07, 0x00, 0x00, 0x00, 0x60, 0x40, 0x05, 0x02, 0x08, 0x00, 0x15,
+  0x01, 0x02, 0x01, 0x09, 0x01, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00, 0x15,
+  0x01, 0x02, 0x03, 0x19, 0x01, 0x0c, 0x00, 0x0c, 0x03, 0x0a, 0x00, 0x00,
+  0x00, 0x90, 0x40, 0x05, 0x04, 0x0b, 0x00, 0x05, 0x06, 0x0c, 0x00, 0x30,
+  0x07, 0x02, 0x0d, 0x31, 0x05, 0x06, 0x07, 0x15, 0x03, 0x03, 0x01, 0x0c,
+  0x03, 0x0f, 0x00, 0x00, 0x00, 0xe0, 0x40, 0x15, 0x03, 0x01, 0x01, 0x03,
+  0x03, 0x00, 0x00, 0x16, 0x03, 0x02, 0x00, 0x36, 0x03, 0x17, 0x00, 0x10,
+  0x01, 0x03, 0x60, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x03, 0x8a, 0x11,
+  0x00, 0x00, 0x00, 0x14, 0x04, 0x01, 0xe1, 0x12, 0x00, 0x00, 0x00, 0x15,
+  0x04, 0x02, 0x02, 0x10, 0x04, 0x03, 0xe1, 0x12, 0x00, 0x00, 0x00, 0x04,
+  0x04, 0x01, 0x00, 0x10, 0x04, 0x03, 0xb8, 0x13, 0x00, 0x00, 0x00, 0x04,
+  0x04, 0x01, 0x00, 0x10, 0x04, 0x03, 0xf0, 0x14, 0x00, 0x00, 0x00, 0x35,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x04, 0x03, 0xa3, 0x15,
+  0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x10, 0x04, 0x03, 0xba, 0x16,
+  0x00, 0x00, 0x00, 0x09, 0x04, 0x01, 0x00, 0x06, 0x05, 0x03, 0x00, 0x15,
+  0x04, 0x02, 0x01, 0x14, 0x04, 0x01, 0x83, 0x18, 0x00, 0x00, 0x00, 0x15,
+  0x04, 0x02, 0x01, 0x0c, 0x04, 0x0f, 0x00, 0x00, 0x00, 0xe0, 0x40, 0x15,
+  0x04, 0x01, 0x01, 0x03, 0x04, 0x01, 0x00, 0x16, 0x04, 0x02, 0x00, 0x19,
+  0x03, 0x71, 0x04, 0x00, 0x00, 0x00, 0x40, 0x03, 0x72, 0x03, 0x73, 0x03,
+  0x34, 0x04, 0x00, 0x00, 0x40, 0x40, 0x03, 0x74, 0x04, 0x00, 0x00, 0x60,
+  0x40, 0x03, 0x75, 0x03, 0x32, 0x04, 0x00, 0x00, 0x90, 0x40, 0x03, 0x76,
+  0x03, 0x77, 0x03, 0x78, 0x03, 0x79, 0x04, 0x00, 0x00, 0xe0, 0x40, 0x03,
+  0x05, 0x03, 0x2a, 0x03, 0x0d, 0x03, 0x10, 0x03, 0x0f, 0x03, 0x01, 0x03,
+  0x02, 0x05, 0x07, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x03, 0x7a,
+  0x00, 0xa4, 0x02, 0x7b, 0x01, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0xff, 0x02, 0x00, 0x00, 0x01, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x25, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
+  0x01, 0x02, 0x00, 0x39, 0x41, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x02, 0x00,
+  0x00, 0x04, 0x00, 0x80, 0x0c, 0x01, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x80,
+  0x0c, 0x02, 0x06, 0x00, 0x00, 0x14, 0x00, 0x80, 0x0c, 0x03, 0x08, 0x00,
+  0x00, 0x1c, 0x00, 0x80, 0x0c, 0x04, 0x0a, 0x00, 0x00, 0x24, 0x00, 0x80,
+  0x0c, 0x05, 0x0d, 0x00, 0x00, 0x30, 0xb0, 0x80, 0x02, 0x06, 0x00, 0x00,
+  0x03, 0x07, 0x00, 0x00, 0x40, 0x08, 0x0e, 0x00, 0x40, 0x09, 0x0f, 0x00,
+  0x40, 0x0a, 0x10, 0x00, 0x46, 0x00, 0x08, 0x00, 0x40, 0x0b, 0x11, 0x00,
+  0x46, 0x00, 0x08, 0x00, 0x40, 0x0c, 0x12, 0x00, 0x46, 0x00, 0x05, 0x00,
+  0x40, 0x0d, 0x13, 0x00, 0x46, 0x00, 0x02, 0x00, 0x46, 0x00, 0x03, 0x00,
+  0x46, 0x00, 0x08, 0x00, 0x46, 0x00, 0x01, 0x00, 0x13, 0x0e, 0x06, 0x00,
+  0x46, 0x01, 0x06, 0x00, 0x46, 0x01, 0x07, 0x00, 0x46, 0x00, 0x05, 0x00,
+  0x46, 0x00, 0x0b, 0x00, 0x13, 0x0f, 0x07, 0x00, 0x46, 0x01, 0x06, 0x00,
+  0x46, 0x01, 0x07, 0x00, 0x46, 0x00, 0x0d, 0x00, 0x46, 0x00, 0x0e, 0x00,
+  0x40, 0x10, 0x14, 0x00, 0x46, 0x00, 0x05, 0x00, 0x13, 0x11, 0x09, 0x00,
+  0x46, 0x00, 0x0b, 0x00, 0x46, 0x00, 0x05, 0x00, 0x46, 0x00, 0x0f, 0x00,
+  0x46, 0x01, 0x06, 0x00, 0x46, 0x00, 0x0e, 0x00, 0x46, 0x00, 0x0d, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x40, 0x12, 0x15, 0x00, 0x46, 0x00, 0x04, 0x00,
+  0x46, 0x00, 0x11, 0x00, 0x0c, 0x13, 0x17, 0x00, 0x00, 0x00, 0x60, 0x41,
+  0x10, 0x12, 0x13, 0x82, 0x18, 0x00, 0x00, 0x00, 0x0b, 0x06, 0x00, 0x00,
+  0x16, 0x00, 0x01, 0x00, 0x19, 0x03, 0x7c, 0x03, 0x7d, 0x04, 0x00, 0x04,
+  0x00, 0x80, 0x03, 0x7e, 0x04, 0x00, 0x0c, 0x00, 0x80, 0x03, 0x7f, 0x04,
+  0x00, 0x14, 0x00, 0x80, 0x03, 0x80, 0x01, 0x04, 0x00, 0x1c, 0x00, 0x80,
+  0x03, 0x81, 0x01, 0x04, 0x00, 0x24, 0x00, 0x80, 0x03, 0x09, 0x03, 0x82,
+  0x01, 0x04, 0x00, 0x30, 0xb0, 0x80, 0x06, 0x00, 0x06, 0x01, 0x06, 0x02,
+  0x06, 0x03, 0x06, 0x04, 0x06, 0x05, 0x06, 0x0b, 0x06, 0x17, 0x03, 0x83,
+  0x01, 0x04, 0x00, 0x00, 0x60, 0x41, 0x03, 0x7b, 0x0b, 0x00, 0x01, 0x02,
+  0x03, 0x04, 0x05, 0x08, 0x0a, 0x0b, 0x16, 0x17, 0x01, 0x00, 0x01, 0x05,
+  0x00, 0x0c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x00, 0x1f, 0x01, 0x02, 0x0e, 0x04, 0x00, 0x05, 0x00, 0x1a, 0x00, 0x05,
+  0x00, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x6a, 0x2d, 0x00, 0x00,
+  0x00, 0x00, 0x2d, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x96, 0x00, 0x00, 0x00, 0x00, 0x18,
+};
+const FileDescriptor lazy_script_table[] = {
+  { std::string((const char*) lazy_script_table_0, sizeof(lazy_script_table_0)), "src/lua/xml.lua" },
+  { std::string((const char*) lazy_script_table_1, sizeof(lazy_script_table_1)), "src/lua/export/text.lua" },
+  { std::string((const char*) lazy_script_table_2, sizeof(lazy_script_table_2)), "src/lua/export/latex.lua" },
+  { std::string((const char*) lazy_script_table_3, sizeof(lazy_script_table_3)), "src/lua/export/troff.lua" },
+  { std::string((const char*) lazy_script_table_4, sizeof(lazy_script_table_4)), "src/lua/export/opendocument.lua" },
+  { std::string((const char*) lazy_script_table_5, sizeof(lazy_script_table_5)), "src/lua/export/org.lua" },
+  { std::string((const char*) lazy_script_table_6, sizeof(lazy_script_table_6)), "src/lua/export/markdown.lua" },
+  { std::string((const char*) lazy_script_table_7, sizeof(lazy_script_table_7)), "src/lua/import/html.lua" },
+  { std::string((const char*) lazy_script_table_8, sizeof(lazy_script_table_8)), "src/lua/import/text.lua" },
+  { std::string((const char*) lazy_script_table_9, sizeof(lazy_script_table_9)), "src/lua/import/opendocument.lua" },
+  { std::string((const char*) lazy_script_table_10, sizeof(lazy_script_table_10)), "src/lua/import/markdown.lua" },
+  { std::string((const char*) lazy_script_table_11, sizeof(lazy_script_table_11)), "src/lua/viewer.lua" },
+  {}
+};
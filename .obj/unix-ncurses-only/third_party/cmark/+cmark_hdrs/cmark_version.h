@@ -0,0 +1,7 @@
+#ifndef CMARK_VERSION_H
+#define CMARK_VERSION_H
+
+#define CMARK_VERSION ((0 << 16) | (31 << 8)  | 0)
+#define CMARK_VERSION_STRING "0.31.0"
+
+#endif
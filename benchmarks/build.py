@@ -0,0 +1,194 @@
+from build.ab import normalrule, Rule, Target, Targets, export
+from config import BINARIES
+
+# Everything runs on the headless build, so that the redraw benchmarks don't
+# need a terminal, at a fixed screen size so that they always draw the same
+# thing.
+BENCHMARK_BINARY = "src/c/+wordgrinder-headless"
+
+BENCHMARKS = [
+    "editing",
+    "fileio",
+    "memory",
+    "redraw",
+    "typing",
+]
+
+HARNESS = ["./harness.lua", "./generator.lua", "./json.lua"]
+
+# The sizes, in words, of the documents for "make benchmark-sweep", which
+# shows how the time each scenario takes grows with them.
+SWEEP = "10k,100k,1M,5M"
+
+
+# Each benchmark waits for the one before, so that they don't run at the same
+# time and slow each other down.
+@Rule
+def benchmark(
+    self, name, exe: Target = None, script=None, sizes=None, after: Targets = []
+):
+    env = "COLUMNS=80 LINES=25"
+    if sizes:
+        env += " WG_BENCHMARK_SIZES=" + sizes
+    normalrule(
+        replaces=self,
+        ins=["./" + (script or self.localname) + ".lua", exe],
+        deps=HARNESS + after,
+        outs=["results.json"],
+        commands=[
+            env
+            + " {ins[1]} --lua {ins[0]} {outs} >{outs}.log 2>&1"
+            + " || (cat {outs}.log && rm -f {outs} && false)"
+        ],
+        label="BENCHMARK",
+    )
+
+
+# Runs the C++ micro-benchmarks: those for the primitives the scripts call, and
+# those for the core library on its own. Their results are just printed, as
+# there's no baseline to compare them against.
+@Rule
+def microbench(self, name, exe: Target = None):
+    normalrule(
+        replaces=self,
+        ins=[exe],
+        outs=["report"],
+        commands=[
+            "{ins[0]} >{outs} 2>&1"
+            + " && cat {outs} || (cat {outs} && rm -f {outs} && false)"
+        ],
+        label="MICROBENCH",
+    )
+
+
+# Times starting up each of the frontends, cold and warm, with a document; see
+# startup.py. Like the micro-benchmarks, the results are just printed.
+@Rule
+def startup(self, name, document, exes: Targets = None, names=[]):
+    normalrule(
+        replaces=self,
+        ins=["./startup.py", document] + exes,
+        outs=["report"],
+        commands=[
+            "python3 {ins[0]} {ins[1]} "
+            + " ".join(
+                "%s={ins[%d]}" % (n.replace("$(EXT)", ""), i + 2)
+                for i, n in enumerate(names)
+            )
+            + " >{outs} 2>&1"
+            + " && cat {outs} || (cat {outs} && rm -f {outs} && false)"
+        ],
+        label="STARTUP",
+    )
+
+
+# Prints the scaling curves for a sweep; see scaling.lua.
+@Rule
+def scaling(self, name, results: Targets = None, exe: Target = None):
+    normalrule(
+        replaces=self,
+        ins=["./scaling.lua", exe] + results,
+        deps=["./json.lua"],
+        outs=["report"],
+        commands=[
+            "{ins[1]} --lua {ins[0]} "
+            + " ".join("{ins[%d]}" % (i + 2) for i in range(len(results)))
+            + " >{outs} 2>&1"
+            + " && cat {outs} || (cat {outs} && rm -f {outs} && false)"
+        ],
+        label="SCALING",
+    )
+
+
+@Rule
+def compare(
+    self,
+    name,
+    results: Targets = None,
+    exe: Target = None,
+    baseline: Targets = [],
+    flags="",
+):
+    normalrule(
+        replaces=self,
+        ins=["./compare.lua", exe] + results,
+        deps=["./json.lua"] + baseline,
+        outs=["report"],
+        commands=[
+            "{ins[1]} --lua {ins[0]} " + flags + " benchmarks/baseline.json "
+            + " ".join("{ins[%d]}" % (i + 2) for i in range(len(results)))
+            + " >{outs} 2>&1"
+            + " && cat {outs} || (cat {outs} && rm -f {outs} && false)"
+        ],
+        label="COMPARE",
+    )
+
+
+results = []
+for b in BENCHMARKS:
+    results += [benchmark(name=b, exe=BENCHMARK_BINARY, after=results[-1:])]
+
+# "make benchmarks" fails if anything's slower than the baseline (and "make
+# BENCHMARKS=1" makes "make all" do the same); "make benchmark-baseline"
+# replaces it with the results from this machine. "make benchmark-sweep" runs
+# everything on much bigger documents too and shows how the times scale; it
+# takes a few minutes.
+export(
+    name="benchmarks",
+    deps=[
+        compare(
+            name="compare",
+            results=results,
+            exe=BENCHMARK_BINARY,
+            baseline=["./baseline.json"],
+        )
+    ],
+)
+export(
+    name="baseline",
+    deps=[
+        compare(
+            name="update",
+            results=results,
+            exe=BENCHMARK_BINARY,
+            flags="--update",
+        )
+    ],
+)
+
+sweep = []
+for b in BENCHMARKS:
+    sweep += [
+        benchmark(
+            name=b + "-sweep",
+            script=b,
+            exe=BENCHMARK_BINARY,
+            sizes=SWEEP,
+            after=sweep[-1:],
+        )
+    ]
+
+export(
+    name="sweep",
+    deps=[scaling(name="scaling", results=sweep, exe=BENCHMARK_BINARY)],
+)
+
+export(
+    name="startup",
+    deps=[
+        startup(
+            name="startup-report",
+            document="README.wg",
+            exes=list(BINARIES.values()),
+            names=list(BINARIES.keys()),
+        )
+    ],
+)
+
+export(
+    name="micro",
+    deps=[
+        microbench(name="microbench", exe="src/c+microbench"),
+        microbench(name="corebench", exe="src/c+corebench"),
+    ],
+)
@@ -0,0 +1,146 @@
+--!nonstrict
+-- © 2026 David Given.
+-- WordGrinder is licensed under the MIT open source license. See the COPYING
+-- file in this distribution for the full text.
+
+-- Checks benchmark results against the baseline:
+--
+--     wordgrinder --lua benchmarks/compare.lua [--update] baseline.json
+--         results.json...
+--
+-- A scenario has regressed if its median time has grown by more than the
+-- baseline's time tolerance (and by more than its minimum, so that noise on
+-- the very quick ones doesn't count), or if its allocations, screen writes or
+-- (for the memory benchmarks) live heap have grown by more than the
+-- allocation tolerance (and its slack). Any
+-- regression makes this exit with an error. Timings are only comparable on
+-- the machine which made the baseline; --update replaces the baseline's
+-- results with these ones.
+
+local JSON = loadfile("benchmarks/json.lua")()
+
+-- Wall clock times are noisy, even on an idle machine, so the time tolerance
+-- is only tight enough to catch things going badly wrong; the allocation
+-- counts are much steadier.
+local DEFAULT_TOLERANCE = {
+	time = 1.0,        -- fraction of the median
+	minimum = 1.0,     -- milliseconds
+	allocations = 0.1, -- fraction of the block and write counts
+	slack = 8,         -- blocks or writes
+}
+
+local args = {...}
+local update = false
+if args[1] == "--update" then
+	update = true
+	table.remove(args, 1)
+end
+local baselinefile = table.remove(args, 1)
+if not baselinefile then
+	error("syntax: compare.lua [--update] baseline.json results.json...")
+end
+
+local function readjson(filename)
+	local data, e = wg.readfile(filename)
+	if not data then
+		error(filename..": "..e)
+	end
+	local value, e = JSON.Decode(data)
+	if not value then
+		error(filename..": "..e)
+	end
+	return value
+end
+
+local results = {}
+for _, filename in args do
+	for name, result in readjson(filename) do
+		results[name] = result
+	end
+end
+
+local baseline = { tolerance = DEFAULT_TOLERANCE, scenarios = {} }
+if wg.access(baselinefile, wg.R_OK) then
+	baseline = readjson(baselinefile)
+end
+local tolerance = table.clone(DEFAULT_TOLERANCE)
+for k, v in baseline.tolerance or {} do
+	tolerance[k] = v
+end
+tolerance.time = tonumber(wg.getenv("WG_BENCHMARK_TOLERANCE") or "")
+	or tolerance.time
+
+if update then
+	baseline.scenarios = results
+	local _, e = wg.writefile(baselinefile, JSON.Encode(baseline))
+	if e then
+		error(baselinefile..": "..e)
+	end
+	print("updated "..baselinefile)
+	return
+end
+
+local names = {}
+for name in results do
+	names[#names+1] = name
+end
+table.sort(names)
+
+local function change(now, before)
+	if before == 0 then
+		return (now == 0) and "" or "new"
+	end
+	return string.format("%+.1f%%", (now - before) * 100 / before)
+end
+
+local regressions = {}
+print(string.format("%-24s %11s %11s %8s %9s %9s",
+	"scenario", "median", "baseline", "change", "allocs", "baseline"))
+for _, name in names do
+	local r = results[name]
+	local b = baseline.scenarios[name]
+	if not b then
+		print(string.format("%-24s %9.3fms %11s %8s %9d %9s",
+			name, r.median, "-", "new", r.allocations, "-"))
+		continue
+	end
+
+	print(string.format("%-24s %9.3fms %9.3fms %8s %9d %9d",
+		name, r.median, b.median, change(r.median, b.median),
+		r.allocations, b.allocations))
+
+	if (r.median > b.median * (1 + tolerance.time))
+			and ((r.median - b.median) > tolerance.minimum) then
+		regressions[#regressions+1] = string.format(
+			"%s: median %.3fms is %s on %.3fms", name, r.median,
+			change(r.median, b.median), b.median)
+	end
+
+	local function checkcount(what, now, before)
+		now = now or 0
+		before = before or 0
+		if (now - before) > math.max(before * tolerance.allocations,
+				tolerance.slack) then
+			regressions[#regressions+1] = string.format(
+				"%s: %d %s is %s on %d", name, now, what,
+				change(now, before), before)
+		end
+	end
+	checkcount("allocations", r.allocations, b.allocations)
+	checkcount("writes", r.writes, b.writes)
+	checkcount("live bytes", r.live, b.live)
+end
+
+for name in baseline.scenarios do
+	if not results[name] then
+		print(string.format("%-24s (no result)", name))
+	end
+end
+
+if #regressions > 0 then
+	print()
+	for _, s in regressions do
+		print("regression in "..s)
+	end
+	wg.exit(1)
+end
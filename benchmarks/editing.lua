@@ -0,0 +1,64 @@
+--!nonstrict
+loadfile("benchmarks/harness.lua")()
+
+-- Wrapping, searching and undo checkpoints.
+
+local outputfile = ...
+
+-- Paragraphs remember their last few layouts, so a rewrap at the same width
+-- would find them all cached.
+local function forgetwrapping(document)
+	for _, p in ipairs(document) do
+		p._wrapdata = nil
+		p._wrapcache = nil
+	end
+end
+
+ForEachSize(
+	function(words)
+		local document = GenerateDocuments(words)[1]
+
+		for _, width in {40, 60, 80} do
+			Benchmark("wrap-"..width,
+				function()
+					for _, p in ipairs(document) do
+						p:wrap(width)
+					end
+				end,
+				function()
+					forgetwrapping(document)
+				end)
+		end
+
+		-- The only match is in the last paragraph, so both of these search
+		-- the whole document.
+
+		Benchmark("find-hit",
+			function()
+				assert(Cmd.Find(UNIQUE_WORD))
+			end,
+			Cmd.GotoBeginningOfDocument)
+
+		Benchmark("find-miss",
+			function()
+				assert(not Cmd.Find("plugh"))
+			end,
+			Cmd.GotoBeginningOfDocument)
+
+		-- Each run changes one word in the middle of the document and then
+		-- takes a checkpoint, which has to work out what changed.
+
+		Cmd.Checkpoint()
+		Benchmark("undo-checkpoint",
+			function()
+				Cmd.Checkpoint()
+			end,
+			function()
+				document.cp = math.floor(#document / 2)
+				document.cw = 1
+				document.co = 1
+				Cmd.InsertStringIntoWord("x")
+			end)
+	end)
+
+WriteResults(outputfile)
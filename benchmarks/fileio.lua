@@ -0,0 +1,72 @@
+--!nonstrict
+loadfile("benchmarks/harness.lua")()
+
+-- Loading, saving, importing and exporting.
+
+local outputfile = ...
+local dir = wg.mkdtemp()
+
+local EXPORTERS = {
+	{ "html", Cmd.ExportHTMLFile },
+	{ "md",   Cmd.ExportMarkdownFile },
+	{ "odt",  Cmd.ExportODTFile },
+	{ "org",  Cmd.ExportOrgFile },
+	{ "tex",  Cmd.ExportLatexFile },
+	{ "tr",   Cmd.ExportTroffFile },
+	{ "txt",  Cmd.ExportTextFile },
+}
+
+local IMPORTERS = {
+	{ "html", Cmd.ImportHTMLFile },
+	{ "md",   Cmd.ImportMarkdownFile },
+	{ "odt",  Cmd.ImportODTFile },
+	{ "txt",  Cmd.ImportTextFile },
+}
+
+-- The importers add what they read to the document set, so each run throws
+-- away the previous one's.
+
+local function forgetimports()
+	documentSet:setCurrent("benchmark")
+	for _, d in ipairs(table.clone(documentSet.documents)) do
+		if d.name ~= "benchmark" then
+			documentSet:deleteDocument(d.name)
+		end
+	end
+end
+
+ForEachSize(
+	function(words)
+		GenerateDocuments(words)
+
+		Benchmark("save-wg",
+			function()
+				Cmd.SaveCurrentDocumentAs(dir.."/document.wg")
+				assert(FinishBackgroundSave())
+			end)
+
+		Benchmark("load-wg",
+			function()
+				assert(LoadFromFile(dir.."/document.wg"))
+			end)
+
+		for _, e in EXPORTERS do
+			local extension, exporter = e[1], e[2]
+			Benchmark("export-"..extension,
+				function()
+					exporter(dir.."/document."..extension)
+				end)
+		end
+
+		for _, i in IMPORTERS do
+			local extension, importer = i[1], i[2]
+			Benchmark("import-"..extension,
+				function()
+					importer(dir.."/document."..extension)
+					assert(currentDocument.name ~= "benchmark")
+				end,
+				forgetimports)
+		end
+	end)
+
+WriteResults(outputfile)
@@ -0,0 +1,209 @@
+--!nonstrict
+-- © 2026 David Given.
+-- WordGrinder is licensed under the MIT open source license. See the COPYING
+-- file in this distribution for the full text.
+
+-- Makes synthetic documents for the benchmarks. Everything comes from the
+-- seeded random number generator, so the same options always give the same
+-- documents. The options, all of which have sensible defaults, are:
+--
+--   words       total number of words across the whole set
+--   documents   number of documents the words are shared between
+--   paragraphs  paragraph lengths, as a list of { weight, min, max } ranges
+--               which are picked from in proportion to their weights
+--   styles      fraction of words which are italic, bold or underlined
+--   headings    fraction of paragraphs which are headings
+--   lists       fraction of paragraphs which are list items
+--   unicode     fraction of words which aren't plain ASCII
+--   cjk         fraction of paragraphs which are Chinese or Japanese, which
+--               have no spaces and so wrap as very long words
+--   seed        for the random number generator
+
+local string_char = string.char
+local math_random = math.random
+
+local DEFAULTS = {
+	words = 50000,
+	documents = 1,
+	paragraphs = {
+		{ 70, 20, 120 },
+		{ 25, 1, 15 },
+		{ 5, 200, 600 },
+	},
+	styles = 0.05,
+	headings = 0.04,
+	lists = 0.15,
+	unicode = 0.05,
+	cjk = 0.02,
+	seed = 0,
+}
+
+local LATIN = [[Sed ut perspiciatis unde omnis iste natus error sit voluptatem
+accusantium doloremque laudantium, totam rem aperiam, eaque ipsa quae ab illo
+inventore veritatis et quasi architecto beatae vitae dicta sunt explicabo. Nemo
+enim ipsam voluptatem quia voluptas sit aspernatur aut odit aut fugit, sed quia
+consequuntur magni dolores eos qui ratione voluptatem sequi nesciunt. Neque
+porro quisquam est, qui dolorem ipsum quia dolor sit amet, consectetur,
+adipisci velit, sed quia non numquam eius modi tempora incidunt ut labore et
+dolore magnam aliquam quaerat voluptatem. Ut enim ad minima veniam, quis
+nostrum exercitationem ullam corporis suscipit laboriosam, nisi ut aliquid ex
+ea commodi consequatur? Quis autem vel eum iure reprehenderit qui in ea
+voluptate velit esse quam nihil molestiae consequatur, vel illum qui dolorem
+eum fugiat quo voluptas nulla pariatur?]]
+
+local UNICODE = [[café naïve fiancée Überseeische Straße señor ﬁnancial
+Ελληνικά προχωρώ ψυχή Москва жизнь здравствуйте ĳzer Ångström œuvre ﬂuß]]
+
+local CJK = "日本語の文章を書くことは難しいです。中文字符测试，漢字かなカナ混じり文。"
+
+local function split(text)
+	local words = {}
+	for w in text:gmatch("%S+") do
+		words[#words+1] = w
+	end
+	return words
+end
+
+SOURCE_WORDS = split(LATIN)
+local UNICODE_WORDS = split(UNICODE)
+local CJK_CHARACTERS = {}
+for _, c in utf8.codes(CJK) do
+	CJK_CHARACTERS[#CJK_CHARACTERS+1] = utf8.char(c)
+end
+
+-- Appears nowhere in the generated text except at the end of the first
+-- document, for the find benchmarks.
+UNIQUE_WORD = "xyzzy"
+
+local HEADINGS = { "H1", "H2", "H3", "H4" }
+local LISTS = { "LB", "LN" }
+local STYLES = { wg.ITALIC, wg.BOLD, wg.UNDERLINE }
+
+local function pick(t)
+	return t[math_random(#t)]
+end
+
+local function picklength(ranges)
+	local total = 0
+	for _, r in ranges do
+		total = total + r[1]
+	end
+
+	local n = math_random() * total
+	for _, r in ranges do
+		n = n - r[1]
+		if n <= 0 then
+			return math_random(r[2], r[3])
+		end
+	end
+	local r = ranges[#ranges]
+	return math_random(r[2], r[3])
+end
+
+local function cjkword()
+	local t = {}
+	for i = 1, math_random(5, 40) do
+		t[i] = pick(CJK_CHARACTERS)
+	end
+	return table.concat(t)
+end
+
+local function generate(options, wordcount)
+	local document = CreateDocument()
+	document:deleteParagraphAt(1)
+
+	local count = 0
+	while count < wordcount do
+		local style = "P"
+		local length
+		local r = math_random()
+		if r < options.headings then
+			style = pick(HEADINGS)
+			length = math_random(2, 8)
+		elseif r < (options.headings + options.lists) then
+			style = pick(LISTS)
+			length = math_random(3, 25)
+		else
+			length = picklength(options.paragraphs)
+		end
+		length = math.min(length, wordcount - count)
+
+		local words = {}
+		if math_random() < options.cjk then
+			-- Runs of ideographs, each of which wraps as one word.
+			for i = 1, length do
+				words[i] = cjkword()
+			end
+		else
+			-- Runs of consecutive source words, so that the text reads
+			-- (slightly) more like text than a word salad.
+			local source = math_random(#SOURCE_WORDS)
+			for i = 1, length do
+				local w
+				if math_random() < options.unicode then
+					w = pick(UNICODE_WORDS)
+				else
+					w = SOURCE_WORDS[source]
+					source = (source % #SOURCE_WORDS) + 1
+				end
+				if math_random() < options.styles then
+					w = string_char(16 + pick(STYLES))..w..string_char(16)
+				end
+				words[i] = w
+			end
+		end
+
+		count = count + length
+		document:appendParagraph(CreateParagraph(style, words))
+	end
+	return document
+end
+
+-- Adds the documents to the document set, with the first one current, and
+-- returns them.
+function GenerateDocuments(options)
+	if type(options) == "number" then
+		options = { words = options }
+	end
+	local o = table.clone(DEFAULTS)
+	for k, v in options or {} do
+		o[k] = v
+	end
+	math.randomseed(o.seed)
+
+	local documents = {}
+	for i = 1, o.documents do
+		local words = math.floor(o.words / o.documents)
+		if i == 1 then
+			words = o.words - words * (o.documents - 1)
+		end
+
+		local document = generate(o, words)
+		if i == 1 then
+			document:appendParagraph(
+				CreateParagraph("P", {"The", "end:", UNIQUE_WORD}))
+		end
+
+		local name = (i == 1) and "benchmark" or ("benchmark-"..i)
+		documentSet:addDocument(document, name)
+		documents[i] = document
+	end
+
+	documentSet:setCurrent("benchmark")
+	FireEvent("Changed")
+	return documents
+end
+
+-- Removes the documents added by GenerateDocuments(), and anything else,
+-- leaving a blank document behind.
+function ForgetDocuments()
+	local blank = CreateDocument()
+	documentSet:addDocument(blank, "main")
+	documentSet:setCurrent("main")
+	for _, d in ipairs(table.clone(documentSet.documents)) do
+		if d ~= blank then
+			documentSet:deleteDocument(d.name)
+		end
+	end
+	wg.collectgarbage()
+end
@@ -0,0 +1,294 @@
+--!nonstrict
+-- © 2026 David Given.
+-- WordGrinder is licensed under the MIT open source license. See the COPYING
+-- file in this distribution for the full text.
+
+-- Shared by the benchmark scripts, which load it the way the tests load
+-- testsuite.lua. Each script is run by the headless build as:
+--
+--     wordgrinder-headless --lua benchmarks/fileio.lua [results.json]
+--
+-- and prints a line for each scenario. The results file is what compare.lua
+-- checks against benchmarks/baseline.json.
+--
+-- The scripts run their scenarios once for each of the document sizes in
+-- WG_BENCHMARK_SIZES, a list like "10k,100k,1M" (the default is 10k and
+-- 100k); the results are named after the scenario and the size, like
+-- "wrap-40@10k", and scaling.lua turns them into scaling curves.
+--
+-- Every scenario runs WG_BENCHMARK_ITERATIONS times (ten by default; fewer,
+-- but at least three, on documents over a hundred thousand words), each
+-- after a full collection, and reports the median and 95th percentile of the
+-- wall clock time, and the median number of blocks and bytes allocated.
+-- Allocation counts don't depend on how busy the machine is, so they're the
+-- more reliable thing to watch.
+
+JSON = loadfile("benchmarks/json.lua")()
+loadfile("benchmarks/generator.lua")()
+
+local ITERATIONS = tonumber(wg.getenv("WG_BENCHMARK_ITERATIONS") or "") or 10
+
+local results = {}
+local size = nil
+
+-- The scenarios mostly measure what the editor does, so collect the way it
+-- does rather than the way conversions do.
+wg.setgcmode("interactive")
+
+local function median(values)
+	local sorted = table.clone(values)
+	table.sort(sorted)
+	return sorted[math.ceil(#sorted / 2)]
+end
+
+local function percentile(values, p)
+	local sorted = table.clone(values)
+	table.sort(sorted)
+	return sorted[math.max(1, math.ceil(#sorted * p))]
+end
+
+-- Names a scenario after the current document size, and works out how many
+-- times to run it.
+local function sized(name)
+	if not size then
+		return name, ITERATIONS
+	end
+	return name.."@"..size.label, math.min(ITERATIONS,
+		math.max(3, math.ceil(ITERATIONS * 100000 / size.words)))
+end
+
+-- Runs and records a scenario. Only body is timed; setup, if given, runs
+-- before each iteration to put things back the way body expects them. There's
+-- usually an extra iteration first which isn't counted, as the first run of
+-- anything is slow: it loads modules and fills caches.
+function Benchmark(name, body, setup)
+	local times = {}
+	local allocations = {}
+	local bytes = {}
+	local writes = {}
+
+	local iterations
+	name, iterations = sized(name)
+
+	-- On big documents one run dwarfs any start-up costs; and takes a while.
+	if iterations == ITERATIONS then
+		if setup then
+			setup()
+		end
+		body()
+	end
+
+	for i = 1, iterations do
+		if setup then
+			setup()
+		end
+		wg.collectgarbage()
+		if headless then
+			headless.resetstats()
+		end
+
+		local before = wg.allocstats()
+		local start = wg.time()
+		body()
+		local elapsed = wg.time() - start
+		local after = wg.allocstats()
+
+		times[i] = elapsed * 1000
+		allocations[i] = after.allocations - before.allocations
+		bytes[i] = after.total - before.total
+		if headless then
+			writes[i] = headless.getstats().writes
+		end
+	end
+
+	local result = {
+		iterations = iterations,
+		median = median(times),
+		p95 = percentile(times, 0.95),
+		allocations = median(allocations),
+		bytes = median(bytes),
+	}
+	if (#writes > 0) and (median(writes) > 0) then
+		-- Only the scenarios which draw anything are interested.
+		result.writes = median(writes)
+	end
+	results[name] = result
+
+	print(string.format("%-24s %9.3fms median %9.3fms p95 %9d allocs %9dkB",
+		name, result.median, result.p95, result.allocations,
+		math.floor(result.bytes / 1024)))
+	return result
+end
+
+-- Records a result worked out some other way, returning the name it's
+-- recorded under.
+function Record(name, result)
+	name = sized(name)
+	results[name] = result
+	return name
+end
+
+-- Reads a file made by wordgrinder --record-keys into a list of events, each
+-- what wg.getchar() returned. The timestamps are kept as when, alongside, to
+-- show how quickly the keys were typed.
+function ReadKeyStream(filename)
+	local data, e = wg.readfile(filename)
+	if not data then
+		error(filename..": "..e)
+	end
+
+	local keys = {}
+	local when = {}
+	for line in data:gmatch("[^\n]+") do
+		local t, key = line:match("^([%d%.]+)\t(.+)$")
+		if not t then
+			error(filename..": bad line '"..line.."'")
+		end
+		local x, y, b = key:match("^MOUSE (%d+) (%d+) (%d)$")
+		if x then
+			key = { x = tonumber(x), y = tonumber(y), b = (b == "1") }
+		end
+		keys[#keys+1] = key
+		when[#when+1] = tonumber(t)
+	end
+	return keys, when
+end
+
+local handleevent = nil
+
+local function queueevent(c)
+	if type(c) == "table" then
+		headless.queuemouse(c.x, c.y, c.b)
+	elseif c:match("^KEY_") then
+		headless.queuekey(c)
+	else
+		headless.queuekeys(c)
+	end
+end
+
+-- Runs and records a typing scenario. The keys, a list of events like
+-- ReadKeyStream() returns, are queued up on the headless display and then
+-- read back one at a time; each goes to the same handler the event loop
+-- uses and then the screen is redrawn, as though every key was typed slowly
+-- enough to see its result. The times and allocations are per key, from the
+-- key being read to the redraw finishing, and include p99 and the worst
+-- case. Keys which open dialogues read the following keys themselves, and
+-- count as one long key. If timed is given, only the keys in it are counted,
+-- but the others are still typed.
+function BenchmarkKeys(name, keys, setup, timed)
+	if not headless then
+		error("the typing benchmarks need the headless build")
+	end
+	handleevent = handleevent or CreateEventHandler()
+
+	local iterations
+	name, iterations = sized(name)
+
+	-- Anything already queued (like the resize from wg.initscreen()) isn't
+	-- part of the scenario.
+	while wg.getchar(0) ~= "KEY_TIMEOUT" do
+	end
+
+	local times = {}
+	local allocations = {}
+	local bytes = {}
+	local writes = {}
+	for i = 1, iterations do
+		if setup then
+			setup()
+		end
+		RedrawScreen()
+		wg.collectgarbage()
+
+		for _, c in keys do
+			queueevent(c)
+		end
+		while true do
+			local c = wg.getchar(0)
+			if c == "KEY_TIMEOUT" then
+				break
+			end
+
+			headless.resetstats()
+			local before = wg.allocstats()
+			local start = wg.time()
+			if c ~= "KEY_RESIZE" then
+				ResetNonmodalMessages()
+			end
+			handleevent(c)
+			RedrawScreen()
+			local elapsed = wg.time() - start
+			local after = wg.allocstats()
+
+			if not timed or timed[c] then
+				times[#times+1] = elapsed * 1000
+				allocations[#allocations+1] =
+					after.allocations - before.allocations
+				bytes[#bytes+1] = after.total - before.total
+				writes[#writes+1] = headless.getstats().writes
+			end
+
+			-- The event loop does this while waiting for the next key.
+			if documentSet._justchanged then
+				FireEvent("Changed")
+				documentSet._justchanged = false
+			end
+		end
+	end
+
+	local result = {
+		iterations = iterations,
+		keys = #times,
+		median = median(times),
+		p95 = percentile(times, 0.95),
+		p99 = percentile(times, 0.99),
+		max = percentile(times, 1),
+		allocations = median(allocations),
+		bytes = median(bytes),
+	}
+	if median(writes) > 0 then
+		result.writes = median(writes)
+	end
+	results[name] = result
+
+	print(string.format(
+		"%-24s %9.3fms median %9.3fms p99 %9.3fms max %9d allocs/key",
+		name, result.median, result.p99, result.max, result.allocations))
+	return result
+end
+
+-- Writes everything recorded so far, if there's anywhere to write it.
+function WriteResults(filename)
+	if filename then
+		local _, e = wg.writefile(filename, JSON.Encode(results))
+		if e then
+			error("can't write benchmark results: "..e)
+		end
+	end
+end
+
+local function parsesize(s)
+	local n, suffix = s:match("^%s*(%d+)([kM]?)%s*$")
+	if not n then
+		error("bad benchmark size '"..s.."'")
+	end
+	local words = tonumber(n) * ((suffix == "k") and 1000
+		or (suffix == "M") and 1000000 or 1)
+	return { words = words, label = n..suffix }
+end
+
+local SIZES = {}
+for s in (wg.getenv("WG_BENCHMARK_SIZES") or "10k,100k"):gmatch("[^,]+") do
+	SIZES[#SIZES+1] = parsesize(s)
+end
+
+-- Calls cb with the number of words for each of the sizes in turn, and then
+-- throws away any documents it made.
+function ForEachSize(cb)
+	for _, s in SIZES do
+		size = s
+		cb(s.words)
+		ForgetDocuments()
+	end
+	size = nil
+end
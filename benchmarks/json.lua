@@ -0,0 +1,220 @@
+--!nonstrict
+-- © 2026 David Given.
+-- WordGrinder is licensed under the MIT open source license. See the COPYING
+-- file in this distribution for the full text.
+
+-- Just enough JSON for the benchmark results and baseline: objects, arrays,
+-- strings, numbers and booleans. Objects are written with their keys sorted
+-- so that the baseline diffs cleanly.
+
+local string_format = string.format
+local string_byte = string.byte
+local string_sub = string.sub
+local string_find = string.find
+local table_concat = table.concat
+local table_sort = table.sort
+
+local ESCAPES = {
+	['"'] = '\\"', ["\\"] = "\\\\", ["\b"] = "\\b", ["\f"] = "\\f",
+	["\n"] = "\\n", ["\r"] = "\\r", ["\t"] = "\\t",
+}
+
+local UNESCAPES = {
+	['"'] = '"', ["\\"] = "\\", ["/"] = "/", b = "\b", f = "\f",
+	n = "\n", r = "\r", t = "\t",
+}
+
+local function encodestring(s)
+	return '"'..s:gsub('[%c"\\]',
+		function(c)
+			return ESCAPES[c] or string_format("\\u%04x", string_byte(c))
+		end)..'"'
+end
+
+local function encode(value, indent, out)
+	local t = type(value)
+	if t == "table" then
+		local inner = indent.."\t"
+		if #value > 0 then
+			out[#out+1] = "[\n"
+			for i, v in ipairs(value) do
+				out[#out+1] = inner
+				encode(v, inner, out)
+				out[#out+1] = (i < #value) and ",\n" or "\n"
+			end
+			out[#out+1] = indent.."]"
+			return
+		end
+
+		local keys = {}
+		for k in pairs(value) do
+			keys[#keys+1] = tostring(k)
+		end
+		if #keys == 0 then
+			out[#out+1] = "{}"
+			return
+		end
+		table_sort(keys)
+
+		out[#out+1] = "{\n"
+		for i, k in ipairs(keys) do
+			out[#out+1] = inner..encodestring(k)..": "
+			encode(value[k], inner, out)
+			out[#out+1] = (i < #keys) and ",\n" or "\n"
+		end
+		out[#out+1] = indent.."}"
+	elseif t == "string" then
+		out[#out+1] = encodestring(value)
+	elseif t == "number" then
+		if value == math.floor(value) then
+			out[#out+1] = string_format("%d", value)
+		else
+			out[#out+1] = string_format("%.4f", value)
+		end
+	elseif t == "boolean" then
+		out[#out+1] = tostring(value)
+	else
+		error("can't encode a "..t.." as JSON")
+	end
+end
+
+local function Encode(value)
+	local out = {}
+	encode(value, "", out)
+	out[#out+1] = "\n"
+	return table_concat(out)
+end
+
+-- Returns the decoded value, or nil and a message.
+local function Decode(s)
+	local pos = 1
+
+	local function fail(message)
+		error(string_format("%s at offset %d", message, pos), 0)
+	end
+
+	local function skip()
+		pos = string_find(s, "[^ \t\r\n]", pos) or (#s + 1)
+	end
+
+	local function expect(c)
+		skip()
+		if string_sub(s, pos, pos) ~= c then
+			fail("expected '"..c.."'")
+		end
+		pos = pos + 1
+	end
+
+	local value
+
+	local function decodestring()
+		expect('"')
+		local out = {}
+		while true do
+			local i, j, text, c = string_find(s, '^([^"\\]*)(["\\])', pos)
+			if not i then
+				fail("unterminated string")
+			end
+			out[#out+1] = text
+			pos = j + 1
+			if c == '"' then
+				return table_concat(out)
+			end
+
+			c = string_sub(s, pos, pos)
+			if c == "u" then
+				local hex = string_sub(s, pos+1, pos+4)
+				if not hex:find("^%x%x%x%x$") then
+					fail("bad escape")
+				end
+				out[#out+1] = utf8.char(tonumber(hex, 16))
+				pos = pos + 5
+			elseif UNESCAPES[c] then
+				out[#out+1] = UNESCAPES[c]
+				pos = pos + 1
+			else
+				fail("bad escape")
+			end
+		end
+	end
+
+	function value()
+		skip()
+		local c = string_sub(s, pos, pos)
+		if c == "{" then
+			pos = pos + 1
+			local t = {}
+			skip()
+			if string_sub(s, pos, pos) == "}" then
+				pos = pos + 1
+				return t
+			end
+			while true do
+				local k = decodestring()
+				expect(":")
+				t[k] = value()
+				skip()
+				c = string_sub(s, pos, pos)
+				pos = pos + 1
+				if c == "}" then
+					return t
+				elseif c ~= "," then
+					fail("expected ',' or '}'")
+				end
+			end
+		elseif c == "[" then
+			pos = pos + 1
+			local t = {}
+			skip()
+			if string_sub(s, pos, pos) == "]" then
+				pos = pos + 1
+				return t
+			end
+			while true do
+				t[#t+1] = value()
+				skip()
+				c = string_sub(s, pos, pos)
+				pos = pos + 1
+				if c == "]" then
+					return t
+				elseif c ~= "," then
+					fail("expected ',' or ']'")
+				end
+			end
+		elseif c == '"' then
+			return decodestring()
+		elseif string_find(s, "^true", pos) then
+			pos = pos + 4
+			return true
+		elseif string_find(s, "^false", pos) then
+			pos = pos + 5
+			return false
+		else
+			local i, j = string_find(s, "^-?%d+%.?%d*[eE]?[-+]?%d*", pos)
+			if not i then
+				fail("unexpected character")
+			end
+			pos = j + 1
+			return tonumber(string_sub(s, i, j)) or fail("bad number")
+		end
+	end
+
+	local ok, result = pcall(
+		function()
+			local v = value()
+			skip()
+			if pos <= #s then
+				fail("trailing garbage")
+			end
+			return v
+		end)
+	if not ok then
+		return nil, result
+	end
+	return result
+end
+
+return {
+	Encode = Encode,
+	Decode = Decode,
+}
@@ -0,0 +1,205 @@
+--!nonstrict
+loadfile("benchmarks/harness.lua")()
+
+-- What a loaded document costs. Each of the test documents, and a synthetic
+-- document of each size, is loaded, put into the state the editor would have
+-- it in (wrapped, spellchecked, with an undo step) and then taken apart again
+-- a piece at a time; the bytes in live objects after a full collection,
+-- before and after each piece goes, is what that piece costs. The pieces
+-- are:
+--
+--   paragraphs  the paragraphs and their words
+--   wrapping    each paragraph's _wrapdata and _wrapcache
+--   spellcheck  the remembered verdicts and the misspelling index
+--   undo        the undo and redo stacks
+--   journal     the journal's snapshots of the paragraph lists
+--   metadata    the document set and documents themselves, menus, settings
+--
+-- The heap figure is what the allocator has handed out for all of it, which
+-- is more, as the interpreter gets its objects a page at a time.
+--
+-- Each is also recorded as the scenario "memory-<document>", with the time
+-- and allocations of the load and the total live bytes, which compare.lua
+-- checks. Run with WG_BENCHMARK_PACKED=1 to measure packed paragraphs.
+
+local outputfile = ...
+local dir = wg.mkdtemp()
+-- This is a setting rather than a switch, as every load applies it.
+GlobalSettings.debug = GlobalSettings.debug or {}
+GlobalSettings.debug.packparagraphs =
+	(wg.getenv("WG_BENCHMARK_PACKED") or "") ~= ""
+
+local dictionary = {}
+for i, w in SOURCE_WORDS do
+	if (i % 5) ~= 0 then
+		dictionary[#dictionary+1] = GetWordSimpleText(w)
+	end
+end
+SetSystemDictionaryForTesting(dictionary)
+
+local function live()
+	wg.collectgarbage()
+	local stats = wg.allocstats()
+	return stats.objects, stats.live
+end
+
+local function alldocuments()
+	local documents = {}
+	for _, d in documentSet.documents do
+		if IsLazyDocument(d) then
+			MaterialiseDocument(d)
+		end
+		documents[#documents+1] = d
+	end
+	return documents
+end
+
+-- Loads something with load(), which should leave it as the current document
+-- set, and measures it.
+local function footprint(name, load)
+	ResetDocumentSet()
+	documentSet:clean()
+	wg.collectgarbage()
+
+	local before = wg.allocstats()
+	local start = wg.time()
+	assert(load())
+	local elapsed = wg.time() - start
+	local after = wg.allocstats()
+
+	local documents = alldocuments()
+	local words = 0
+	local distinct = 0
+	local paragraphs = 0
+	for _, d in documents do
+		local n, nd = wg.wordstats(d)
+		words = words + n
+		distinct = distinct + nd
+		paragraphs = paragraphs + #d
+	end
+
+	-- Put everything in use.
+
+	for _, d in documents do
+		for _, p in ipairs(d) do
+			p:wrap()
+		end
+	end
+	documentSet.addons.spellchecker.enabled = true
+	documentSet.addons.spellchecker.usesystemdictionary = true
+	while not GetMisspeltWordCount() do
+		FireEvent("Idle")
+	end
+	Cmd.Checkpoint()
+	Cmd.GotoEndOfDocument()
+	Cmd.InsertStringIntoWord("x")
+	Cmd.Checkpoint()
+
+	-- And take it apart again.
+
+	local sizes = {}
+	local total, heap = live()
+	local last, lastheap = total, heap
+	local function strip(what, cb)
+		cb()
+		local now
+		now, lastheap = live()
+		sizes[what] = last - now
+		last = now
+	end
+
+	strip("undo", function()
+		for _, d in documents do
+			d._undostack = nil
+			d._redostack = nil
+		end
+	end)
+	strip("spellcheck", ForgetSpellcheckerCaches)
+	strip("wrapping", function()
+		for _, d in documents do
+			for _, p in ipairs(d) do
+				p._wrapdata = nil
+				p._wrapcache = nil
+			end
+		end
+	end)
+	strip("journal", function()
+		documentSet._journal = nil
+	end)
+	strip("paragraphs", function()
+		for _, d in documents do
+			table.clear(d :: any)
+		end
+	end)
+	strip("metadata", function()
+		documents = nil
+		documentSet = nil
+		currentDocument = nil
+	end)
+	ResetDocumentSet()
+
+	local result = {
+		iterations = 1,
+		median = elapsed * 1000,
+		p95 = elapsed * 1000,
+		allocations = after.allocations - before.allocations,
+		bytes = after.total - before.total,
+		live = total - last,
+		heap = heap - lastheap,
+		words = words,
+		distinctwords = distinct,
+		paragraphcount = paragraphs,
+		bytesperword = (words > 0) and ((total - last) / words) or 0,
+		bytesperparagraph = (paragraphs > 0)
+			and ((total - last) / paragraphs) or 0,
+	}
+	for what, bytes in sizes do
+		result[what] = bytes
+	end
+	name = Record("memory-"..name, result)
+
+	local function kb(n)
+		return string.format("%8dkB", math.floor(n / 1024))
+	end
+	print(string.format(
+		"%-24s %s (heap %s) %7.1fB/word %7.1fB/para:"
+		.." paragraphs %s wrapping %s spellcheck %s undo %s journal %s"
+		.." metadata %s",
+		name, kb(result.live), kb(result.heap), result.bytesperword,
+		result.bytesperparagraph,
+		kb(sizes.paragraphs), kb(sizes.wrapping), kb(sizes.spellcheck),
+		kb(sizes.undo), kb(sizes.journal), kb(sizes.metadata)))
+end
+
+local testdocs = assert(wg.readdir("testdocs"))
+table.sort(testdocs)
+for _, f in testdocs do
+	local filename = "testdocs/"..f
+	local name = f:gsub("%.%w+$", "")
+	if f:find("%.wg$") then
+		footprint(name,
+			function()
+				return Cmd.LoadDocumentSet(filename)
+			end)
+	elseif f:find("%.odt$") then
+		footprint(name,
+			function()
+				return Cmd.ImportODTFile(filename)
+			end)
+	end
+end
+
+ForEachSize(
+	function(words)
+		local filename = dir.."/synthetic.wg"
+		GenerateDocuments(words)
+		Cmd.SaveCurrentDocumentAs(filename)
+		assert(FinishBackgroundSave())
+
+		footprint("synthetic",
+			function()
+				return Cmd.LoadDocumentSet(filename)
+			end)
+	end)
+
+WriteResults(outputfile)
@@ -0,0 +1,54 @@
+--!nonstrict
+loadfile("benchmarks/harness.lua")()
+
+-- Redrawing the screen. This needs the headless build, which draws into
+-- memory and counts what's drawn, so these also record the number of writes
+-- to the display.
+
+local outputfile = ...
+if not headless then
+	error("the redraw benchmarks need the headless build")
+end
+
+wg.initscreen()
+ResizeScreen()
+
+-- The spellchecker's dictionary knows most of the source words, so some are
+-- highlighted as misspelt.
+local dictionary = {}
+for i, w in SOURCE_WORDS do
+	if (i % 5) ~= 0 then
+		dictionary[#dictionary+1] = GetWordSimpleText(w)
+	end
+end
+SetSystemDictionaryForTesting(dictionary)
+
+ForEachSize(
+	function(words)
+		GenerateDocuments(words)
+		documentSet.addons.spellchecker.enabled = false
+		Cmd.GotoBeginningOfDocument()
+		RedrawScreen()
+
+		Benchmark("redraw-unchanged", RedrawScreen)
+
+		Benchmark("redraw-full", RedrawScreen, wg.clearscreen)
+
+		Benchmark("redraw-scroll", RedrawScreen, Cmd.GotoNextLine)
+
+		Benchmark("redraw-type", RedrawScreen,
+			function()
+				Cmd.InsertStringIntoWord("x")
+			end)
+
+		-- Every word on the screen is looked up.
+
+		documentSet.addons.spellchecker.enabled = true
+		documentSet.addons.spellchecker.usesystemdictionary = true
+		FireEvent("Changed")
+
+		Benchmark("spellcheck-redraw", RedrawScreen, wg.clearscreen)
+	end)
+
+wg.deinitscreen()
+WriteResults(outputfile)
@@ -0,0 +1,100 @@
+--!nonstrict
+-- © 2026 David Given.
+-- WordGrinder is licensed under the MIT open source license. See the COPYING
+-- file in this distribution for the full text.
+
+-- Shows how each scenario's time grows with the document size:
+--
+--     wordgrinder --lua benchmarks/scaling.lua results.json...
+--
+-- Between each pair of sizes it prints the exponent k for which the time goes
+-- up as size^k: 1 is linear, 2 is quadratic, and 0 means the size doesn't
+-- matter. Anything much worse than linear is flagged, as that's where
+-- accidentally quadratic code shows up.
+
+local JSON = loadfile("benchmarks/json.lua")()
+
+local SUPERLINEAR = 1.4
+
+local function parselabel(label)
+	local n, suffix = label:match("^(%d+)([kM]?)$")
+	return tonumber(n) * ((suffix == "k") and 1000
+		or (suffix == "M") and 1000000 or 1)
+end
+
+local scenarios = {}
+local sizes = {}
+for _, filename in {...} do
+	local data, e = wg.readfile(filename)
+	if not data then
+		error(filename..": "..e)
+	end
+	local results, e = JSON.Decode(data)
+	if not results then
+		error(filename..": "..e)
+	end
+
+	for key, result in results do
+		local name, label = key:match("^(.*)@(%w+)$")
+		if name then
+			scenarios[name] = scenarios[name] or {}
+			scenarios[name][label] = result
+			sizes[label] = parselabel(label)
+		end
+	end
+end
+
+local labels = {}
+for label in sizes do
+	labels[#labels+1] = label
+end
+table.sort(labels, function(a, b) return sizes[a] < sizes[b] end)
+
+local names = {}
+for name in scenarios do
+	names[#names+1] = name
+end
+table.sort(names)
+
+local header = { string.format("%-20s", "scenario") }
+for _, label in labels do
+	header[#header+1] = string.format("%12s%8s", label, "")
+end
+print(table.concat(header))
+
+local flagged = {}
+for _, name in names do
+	local line = { string.format("%-20s", name) }
+	local previous, previouslabel
+	for _, label in labels do
+		local r = scenarios[name][label]
+		if not r then
+			line[#line+1] = string.format("%12s%8s", "-", "")
+			previous = nil
+			continue
+		end
+
+		local k = ""
+		if previous and (previous.median > 0) and (r.median > 0) then
+			local exponent = math.log(r.median / previous.median)
+				/ math.log(sizes[label] / sizes[previouslabel])
+			k = string.format("(%.2f%s)", exponent,
+				(exponent > SUPERLINEAR) and "!" or "")
+			if exponent > SUPERLINEAR then
+				flagged[#flagged+1] = string.format(
+					"%s: %.3fms at %s to %.3fms at %s", name,
+					previous.median, previouslabel, r.median, label)
+			end
+		end
+		line[#line+1] = string.format("%10.2fms%8s", r.median, k)
+		previous, previouslabel = r, label
+	end
+	print(table.concat(line))
+end
+
+if #flagged > 0 then
+	print()
+	for _, s in flagged do
+		print("worse than linear in "..s)
+	end
+end
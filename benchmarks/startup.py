@@ -0,0 +1,140 @@
+# Measures how long each frontend takes to start up: from being run to the
+# editor first waiting for the user, with a document loaded, as reported by
+# --trace-startup. Each binary runs on a pseudoterminal of its own (which the
+# GUI frontends just ignore) and is killed once it's ready.
+#
+# A cold start has a fresh home directory, so there are no settings or
+# caches, and the binary and document are dropped from the page cache first
+# (where the OS allows). Warm starts reuse everything from the run before.
+#
+# The results are just printed; they depend too much on the machine to be
+# worth keeping.
+#
+# Syntax: startup.py document name=binary...
+
+import os
+import pty
+import signal
+import statistics
+import sys
+import tempfile
+import time
+
+WARM_RUNS = 5
+TIMEOUT = 30
+
+
+def evict(filename):
+    if not hasattr(os, "posix_fadvise"):
+        return
+    fd = os.open(filename, os.O_RDONLY)
+    try:
+        os.posix_fadvise(fd, 0, 0, os.POSIX_FADV_DONTNEED)
+    finally:
+        os.close(fd)
+
+
+def rss(pid):
+    try:
+        with open("/proc/%d/status" % pid) as f:
+            for line in f:
+                if line.startswith("VmRSS:"):
+                    return int(line.split()[1])
+    except OSError:
+        pass
+    return None
+
+
+def runonce(binary, document, home):
+    trace = os.path.join(home, "trace.txt")
+    if os.path.exists(trace):
+        os.remove(trace)
+
+    env = dict(os.environ, HOME=home, TERM="xterm", COLUMNS="80", LINES="25")
+    start = time.monotonic()
+    pid, fd = pty.fork()
+    if pid == 0:
+        os.execve(binary, [binary, "--trace-startup", trace, document], env)
+
+    # Keep the terminal drained, so the frontend never blocks drawing.
+    os.set_blocking(fd, False)
+    try:
+        while not os.path.exists(trace):
+            if (time.monotonic() - start) > TIMEOUT:
+                return None
+            try:
+                os.read(fd, 65536)
+            except OSError:
+                pass
+            if os.waitpid(pid, os.WNOHANG)[0] == pid:
+                pid = None
+                return None
+            time.sleep(0.0005)
+        elapsed = time.monotonic() - start
+        kb = rss(pid)
+    finally:
+        if pid:
+            os.kill(pid, signal.SIGKILL)
+            os.waitpid(pid, 0)
+        os.close(fd)
+
+    with open(trace) as f:
+        stages = [l.split(None, 3) for l in f if not l.startswith("#")]
+    return {
+        "wall": elapsed * 1000,
+        "ready": float(stages[-1][0]),
+        "rss": kb,
+        "stages": stages,
+    }
+
+
+def formatrss(kb):
+    return "?" if kb is None else "%.1fMB" % (kb / 1024)
+
+
+def main(document, binaries):
+    document = os.path.abspath(document)
+    for arg in binaries:
+        name, binary = arg.split("=", 1)
+        binary = os.path.abspath(binary)
+        print(name)
+
+        with tempfile.TemporaryDirectory() as home:
+            evict(binary)
+            evict(document)
+            cold = runonce(binary, document, home)
+            if not cold:
+                print("    failed to start (no terminal or display?)\n")
+                continue
+            warm = [runonce(binary, document, home) for _ in range(WARM_RUNS)]
+            warm = [w for w in warm if w]
+
+        print(
+            "    cold: %8.1fms (%.1fms in process), rss %s"
+            % (cold["wall"], cold["ready"], formatrss(cold["rss"]))
+        )
+        if warm:
+            print(
+                "    warm: %8.1fms (%.1fms in process), rss %s, median of %d"
+                % (
+                    statistics.median(w["wall"] for w in warm),
+                    statistics.median(w["ready"] for w in warm),
+                    formatrss(warm[-1]["rss"]),
+                    len(warm),
+                )
+            )
+
+        # The slowest stages of the last warm start, as that's the one which
+        # is most repeatable.
+        stages = (warm or [cold])[-1]["stages"]
+        slowest = sorted(stages, key=lambda s: -float(s[1]))[:8]
+        print("    slowest stages:")
+        for s in slowest:
+            print("        %8.3fms  %s" % (float(s[1]), s[3].strip()))
+        print()
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 3:
+        sys.exit("syntax: startup.py document name=binary...")
+    main(sys.argv[1], sys.argv[2:])
@@ -0,0 +1,94 @@
+--!nonstrict
+loadfile("benchmarks/harness.lua")()
+
+-- How long each key takes to reach the screen, in the middle of a large
+-- document: typing into a paragraph, the spaces and returns which take undo
+-- checkpoints, deleting, paging down, and pasting. If WG_KEYSTREAM names a
+-- file made with --record-keys, that's replayed too, from the same place.
+
+local outputfile = ...
+if not headless then
+	error("the typing benchmarks need the headless build")
+end
+
+wg.initscreen()
+ResizeScreen()
+
+-- One key per character.
+local function keysof(text)
+	local keys = {}
+	for _, c in utf8.codes(text) do
+		keys[#keys+1] = utf8.char(c)
+	end
+	return keys
+end
+
+local function rep(keys, n)
+	local t = {}
+	for i = 1, n do
+		for _, c in keys do
+			t[#t+1] = c
+		end
+	end
+	return t
+end
+
+local TYPING = keysof("quisquamestquidolorem")
+local SPACERETURN = rep({ "a", "b", " ", "c", "d", " ", "e", "KEY_RETURN" }, 8)
+local DELETE = rep({ "KEY_BACKSPACE", "KEY_DELETE" }, 20)
+local PAGEDOWN = rep({ "KEY_PGDN" }, 10)
+local PASTE = rep({ "KEY_^V" }, 10)
+
+local stream = wg.getenv("WG_KEYSTREAM")
+local recorded, when
+if stream then
+	recorded, when = ReadKeyStream(stream)
+	if #when > 1 then
+		print(string.format("%s: %d keys recorded over %.1fs", stream,
+			#recorded, when[#when] - when[1]))
+	end
+end
+
+ForEachSize(
+	function(words)
+		local document = GenerateDocuments(words)[1]
+		documentSet.addons.spellchecker.enabled = false
+
+		-- Somewhere in the middle of a long paragraph half way through.
+		local middle = math.floor(#document / 2)
+		while (#document[middle] < 20) and (middle < #document) do
+			middle = middle + 1
+		end
+		local function gotomiddle()
+			Cmd.UnsetMark()
+			document.cp = middle
+			document.cw = math.floor(#document[middle] / 2)
+			document.co = 1
+			QueueRedraw()
+		end
+
+		BenchmarkKeys("type-mid-paragraph", TYPING, gotomiddle)
+
+		BenchmarkKeys("type-space-return", SPACERETURN, gotomiddle,
+			{ [" "] = true, ["KEY_RETURN"] = true })
+
+		BenchmarkKeys("type-delete", DELETE, gotomiddle)
+
+		BenchmarkKeys("type-page-down", PAGEDOWN, gotomiddle)
+
+		-- A few paragraphs' worth on the clipboard.
+		gotomiddle()
+		Cmd.SetMark()
+		for i = 1, 3 do
+			Cmd.GotoNextParagraph()
+		end
+		Cmd.Copy()
+		BenchmarkKeys("type-paste", PASTE, gotomiddle)
+
+		if recorded then
+			BenchmarkKeys("type-replay", recorded, gotomiddle)
+		end
+	end)
+
+wg.deinitscreen()
+WriteResults(outputfile)
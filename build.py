@@ -1,33 +1,24 @@
 from build.ab import export
-from config import TEST_BINARY, VERSION, BUILDTYPE
+from config import BINARIES, VERSION, BUILDTYPE
 
+export(name="binaries", items=BINARIES)
+
+# Not built by default: "make jit" builds a terminal binary with Luau's native
+# code generator enabled, which can run the scripts in benchmarks for
+# comparison.
 export(
-    name="binaries",
-    items={
-        "bin/wordgrinder$(EXT)": TEST_BINARY,
-    }
-    | (
-        {"bin/xwordgrinder": "src/c+wordgrinder-glfw-x11"}
-        if BUILDTYPE == "unix"
-        else {}
-    )
-    | (
-        {"bin/wordgrinder-haiku": "src/c+wordgrinder-glfw-haiku"}
-        if BUILDTYPE == "haiku"
-        else {}
-    )
-    | (
-        {"bin/wordgrinder-osx": "src/c+wordgrinder-glfw-osx"}
-        if BUILDTYPE == "osx"
-        else {}
-    )
-    | (
-        {"bin/wordgrinder-windows$(EXT)": "src/c+wordgrinder-glfw-windows"}
-        if BUILDTYPE == "windows"
-        else {}
-    ),
+    name="jit",
+    items={"bin/wordgrinder-jit$(EXT)": "src/c+wordgrinder-ncurses-jit"},
 )
 
+# Also not built by default, as they take a while and the baseline timings only
+# mean anything on the machine which made them; see benchmarks/build.py.
+export(name="benchmarks", deps=["benchmarks"])
+export(name="benchmark-baseline", deps=["benchmarks+baseline"])
+export(name="benchmark-sweep", deps=["benchmarks+sweep"])
+export(name="microbenchmarks", deps=["benchmarks+micro"])
+export(name="startup-benchmark", deps=["benchmarks+startup"])
+
 export(
     name="all",
     items=(
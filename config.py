@@ -19,3 +19,30 @@ if IS_WINDOWS:
     TEST_BINARY = "src/c/+wordgrinder-wincon"
 else:
     TEST_BINARY = "src/c/+wordgrinder-ncurses"
+
+# The frontend binaries installed by "make", and what each is built from.
+BINARIES = (
+    {
+        "bin/wordgrinder$(EXT)": TEST_BINARY,
+    }
+    | (
+        {"bin/xwordgrinder": "src/c+wordgrinder-glfw-x11"}
+        if BUILDTYPE == "unix"
+        else {}
+    )
+    | (
+        {"bin/wordgrinder-haiku": "src/c+wordgrinder-glfw-haiku"}
+        if BUILDTYPE == "haiku"
+        else {}
+    )
+    | (
+        {"bin/wordgrinder-osx": "src/c+wordgrinder-glfw-osx"}
+        if BUILDTYPE == "osx"
+        else {}
+    )
+    | (
+        {"bin/wordgrinder-windows$(EXT)": "src/c+wordgrinder-glfw-windows"}
+        if BUILDTYPE == "windows"
+        else {}
+    )
+)
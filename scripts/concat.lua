@@ -15,6 +15,10 @@
 -- If mynovel.wg contains subdocuments called Foo, Bar and Baz, this will
 -- create a single file called output.wg with the contents of all the
 -- subdocuments moved into a new subdocument called 'all'.
+--
+-- (To join several files together, one after the other, use
+-- wordgrinder --concat output.wg input1.wg input2.wg... instead, which
+-- doesn't need to load them.)
 
 -- Main program
 
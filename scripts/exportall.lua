@@ -23,36 +23,9 @@ local function main(inputfile, template)
 		os.exit(1)
 	end
 
-    local export_table =
-    {
-        ["wg"] = Cmd.SaveCurrentDocumentAs,
-        ["odt"] = Cmd.ExportODTFile,
-        ["html"] = Cmd.ExportHTMLFile,
-        ["tr"] = Cmd.ExportTroffFile,
-        ["tex"] = Cmd.ExportLatexFile, 
-        ["txt"] = Cmd.ExportTextFile,
-		["md"] = Cmd.ExportMarkdownFile,
-    }
-    local _, _, extension = template:find("%.(%w+)$")
-    local exporter = export_table[extension or ""]
-    if not exporter then
-        print("Unknown output format")
-        os.exit(1)
-    end
-
-    if not Cmd.LoadDocumentSet(inputfile) then
-        print("failed to load document")
-        os.exit(1)
-    end
-
-    for i, doc in ipairs(documentSet:getDocumentList()) do
-        local outputfile = template:gsub("%.(%w+)$", "."..i.."."..doc.name..".%1")
-        Document = doc
-        if not exporter(outputfile) then
-            print("failed to write output file")
-            os.exit(1)
-        end
-    end
+	-- This is now built in, as --export-all, which does the same thing (but
+	-- faster).
+	CliExportAll(inputfile, template)
 end
 
 main(...)
@@ -0,0 +1,242 @@
+/* © 2026 David Given.
+ * WordGrinder is licensed under the MIT open source license. See the COPYING
+ * file in this distribution for the full text.
+ */
+
+#include "globals.h"
+#include <string.h>
+#include <algorithm>
+#if !defined WIN32
+#include <sys/resource.h>
+#endif
+
+/* The interpreter's allocator. Luau carves its small objects (words,
+ * paragraphs, line tables) out of pages itself, so what arrives here is
+ * mostly those pages, in a handful of fixed sizes, plus the larger blocks
+ * like table arrays and long strings. Luau hands a page back as soon as its
+ * last object dies, and a busy document frees and reallocates pages
+ * constantly; so freed blocks are kept on free lists, one per size class,
+ * and reused rather than going back to malloc.
+ *
+ * Lua tells us the size of every block it frees or resizes, so blocks don't
+ * need headers: the size class is worked out from that. Only the thread
+ * running the interpreter ever allocates from it, so nothing is locked. */
+
+static const size_t GRANULE = 512;
+static const size_t MAXPOOLED = 64 * 1024;
+static const size_t CLASSES = MAXPOOLED / GRANULE;
+static const size_t MAXCACHED = 8 * 1024 * 1024; /* bytes on free lists */
+
+struct FreeBlock
+{
+    FreeBlock* next;
+};
+
+struct Pool
+{
+    FreeBlock* free;
+    size_t allocations;
+};
+
+static Pool pools[CLASSES];
+
+static struct
+{
+    size_t total;       /* bytes ever allocated */
+    size_t allocations; /* blocks ever allocated */
+    size_t reused;      /* ...of which came from a free list */
+    size_t live;        /* bytes currently allocated */
+    size_t peak;        /* largest value of live */
+    size_t cached;      /* bytes on the free lists */
+} stats;
+
+/* Returns the size class of a block of the given size, or -1 if it's too
+ * big to be pooled. */
+
+static int sizeclass(size_t size)
+{
+    if (size > MAXPOOLED)
+        return -1;
+    return (std::max<size_t>(size, 1) - 1) / GRANULE;
+}
+
+static size_t classsize(int c)
+{
+    return (c + 1) * GRANULE;
+}
+
+static void accountalloc(size_t osize, size_t nsize)
+{
+    stats.total += nsize;
+    stats.allocations++;
+    stats.live += nsize - osize;
+    stats.peak = std::max(stats.peak, stats.live);
+}
+
+static void* acquire(size_t size)
+{
+    int c = sizeclass(size);
+    void* p;
+    if (c == -1)
+        p = malloc(size);
+    else
+    {
+        Pool& pool = pools[c];
+        pool.allocations++;
+        if (pool.free)
+        {
+            p = pool.free;
+            pool.free = pool.free->next;
+            stats.cached -= classsize(c);
+            stats.reused++;
+        }
+        else
+            p = malloc(classsize(c));
+    }
+
+    if (p)
+        accountalloc(0, size);
+    return p;
+}
+
+static void release(void* p, size_t size)
+{
+    if (!p)
+        return;
+    stats.live -= size;
+
+    int c = sizeclass(size);
+    if ((c == -1) || (stats.cached + classsize(c) > MAXCACHED))
+    {
+        free(p);
+        return;
+    }
+
+    FreeBlock* b = (FreeBlock*)p;
+    b->next = pools[c].free;
+    pools[c].free = b;
+    stats.cached += classsize(c);
+}
+
+void* scriptalloc(void* ud, void* ptr, size_t osize, size_t nsize)
+{
+    if (nsize == 0)
+    {
+        release(ptr, osize);
+        return nullptr;
+    }
+    if (!ptr)
+        return acquire(nsize);
+
+    int oc = sizeclass(osize);
+    int nc = sizeclass(nsize);
+    if ((oc != -1) && (oc == nc))
+    {
+        /* Still fits in the same block. */
+        accountalloc(osize, nsize);
+        return ptr;
+    }
+    if ((oc == -1) && (nc == -1))
+    {
+        void* p = realloc(ptr, nsize);
+        if (p)
+            accountalloc(osize, nsize);
+        return p;
+    }
+
+    /* Moving between a pooled block and a malloced one. On failure the old
+     * block must stay as it is. */
+
+    void* p = acquire(nsize);
+    if (!p)
+        return nullptr;
+    memcpy(p, ptr, std::min(osize, nsize));
+    release(ptr, osize);
+    return p;
+}
+
+static void printallocstats(void)
+{
+    fprintf(stderr,
+        "wordgrinder: allocated %zu kB in %zu blocks (%zu reused); peak %zu "
+        "kB, %zu kB in use at exit\n",
+        stats.total / 1024,
+        stats.allocations,
+        stats.reused,
+        stats.peak / 1024,
+        stats.live / 1024);
+}
+
+static int reportallocations_cb(lua_State* L)
+{
+    static bool registered = false;
+    if (!registered)
+        atexit(printallocstats);
+    registered = true;
+    return 0;
+}
+
+/* Returns a table of the allocator's counters; classes maps each size class
+ * (by the size of its blocks) to the number of allocations from it. As the
+ * interpreter gets its small objects from pages, live counts whole pages;
+ * objects is the interpreter's own count of the bytes in live objects, which
+ * goes down as soon as anything is collected. Where the system can say,
+ * maxrss is the most memory the whole process has ever had resident, which
+ * includes what the native code allocates for itself. */
+
+static int allocstats_cb(lua_State* L)
+{
+    lua_createtable(L, 0, 9);
+
+    auto setfield = [&](const char* name, size_t value)
+    {
+        lua_pushnumber(L, value);
+        lua_setfield(L, -2, name);
+    };
+    setfield("total", stats.total);
+    setfield("allocations", stats.allocations);
+    setfield("reused", stats.reused);
+    setfield("live", stats.live);
+    setfield("peak", stats.peak);
+    setfield("cached", stats.cached);
+    setfield("objects",
+        (size_t)lua_gc(L, LUA_GCCOUNT, 0) * 1024 + lua_gc(L, LUA_GCCOUNTB, 0));
+
+#if !defined WIN32
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+#if defined __APPLE__
+        setfield("maxrss", usage.ru_maxrss);
+#else
+        setfield("maxrss", (size_t)usage.ru_maxrss * 1024);
+#endif
+    }
+#endif
+
+    lua_newtable(L);
+    for (int c = 0; c < (int)CLASSES; c++)
+    {
+        if (pools[c].allocations)
+        {
+            lua_pushnumber(L, pools[c].allocations);
+            lua_rawseti(L, -2, classsize(c));
+        }
+    }
+    lua_setfield(L, -2, "classes");
+    return 1;
+}
+
+void allocator_init(void)
+{
+    const static luaL_Reg funcs[] = {
+        {"allocstats",        allocstats_cb       },
+        {"reportallocations", reportallocations_cb},
+        {NULL,                NULL                }
+    };
+
+    luaL_register(L, "wg", funcs);
+    lua_pop(L, 1);
+}
+
+// vim: sw=4 ts=4 et
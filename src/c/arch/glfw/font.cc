@@ -2,6 +2,10 @@
 #include "gui.h"
 #include "stb_rect_pack.h"
 #include "stb_truetype.h"
+#include <math.h>
+#include <string.h>
+#include <string>
+#include <unordered_map>
 
 #include "font_table.h"
 
@@ -11,6 +15,16 @@ extern const FileDescriptor font_table[];
 #define FONT_YPADDING 2
 #define PAGE_WIDTH 256
 #define PAGE_HEIGHT 256
+#define MAX_PAGES 32 /* 2MB of textures */
+
+/* In SDF mode, glyphs are rendered once as signed distance fields at this
+ * size (with SDF_PADDING pixels of falloff around them) and scaled to
+ * whatever size they're drawn at; the edge is wherever the texture crosses
+ * SDF_EDGE. */
+
+#define SDF_SIZE 48
+#define SDF_PADDING 4
+#define SDF_EDGE 128
 
 class Font
 {
@@ -19,6 +33,7 @@ public:
 
 public:
     uint8_t* data;
+    size_t len;
     stbtt_fontinfo info;
 };
 
@@ -28,23 +43,42 @@ public:
     ~StaticFont() {}
 };
 
+/* Font files are mapped rather than read, so that large fallback fonts only
+ * cost the pages of them which actually get used. */
+
 class DynamicFont : public Font
 {
 public:
-	DynamicFont(FILE* fp)
+	DynamicFont(const MappedFile& mf): mf(mf)
 	{
-        (void)fseek(fp, 0, SEEK_END);
-        unsigned len = ftell(fp);
-        (void)fseek(fp, 0, SEEK_SET);
-
-        data = new uint8_t[len];
-        fread(data, 1, len, fp);
+        data = (uint8_t*)mf.data;
+        len = mf.len;
 	}
 
     ~DynamicFont()
     {
-        delete[] data;
+        unmapfile(&mf);
     }
+
+private:
+    MappedFile mf;
+};
+
+/* Everything drawn in a frame is queued up in vertex arrays and drawn in a
+ * handful of calls by flushChars(), rather than cell by cell. These are laid
+ * out for glInterleavedArrays(). */
+
+struct Vertex /* GL_C3F_V3F */
+{
+    GLfloat r, g, b;
+    GLfloat x, y, z;
+};
+
+struct TexturedVertex /* GL_T2F_C3F_V3F */
+{
+    GLfloat s, t;
+    GLfloat r, g, b;
+    GLfloat x, y, z;
 };
 
 struct Page
@@ -52,6 +86,9 @@ struct Page
     uint8_t textureData[PAGE_WIDTH * PAGE_HEIGHT];
     stbtt_pack_context ctx;
     GLuint texture;
+    bool sealed = false; /* loaded from the atlas cache; nothing more fits */
+    uint64_t lastUsed = 0; /* the frame it was last drawn in */
+    std::vector<TexturedVertex> vertices; /* glyph quads for this frame */
 
 	Page()
 	{
@@ -59,6 +96,29 @@ struct Page
 		glBindTexture(GL_TEXTURE_2D, texture);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		begin();
+	}
+
+	~Page()
+	{
+		stbtt_PackEnd(&ctx);
+		glDeleteTextures(1, &texture);
+	}
+
+	/* Empties the page, so it can be reused for other glyphs. */
+
+	void recycle()
+	{
+		stbtt_PackEnd(&ctx);
+		sealed = false;
+		glBindTexture(GL_TEXTURE_2D, texture);
+		begin();
+	}
+
+private:
+	void begin()
+	{
+		/* This also clears textureData. */
 
 		stbtt_PackBegin(&ctx,
 			&textureData[0],
@@ -67,12 +127,19 @@ struct Page
 			PAGE_WIDTH,
 			1,
 			NULL);
-	}
 
-	~Page()
-	{
-		stbtt_PackEnd(&ctx);
-		glDeleteTextures(1, &texture);
+		/* Allocate the (blank) texture now; glyphs are uploaded into it
+		 * piecemeal as they're rendered. */
+
+		glTexImage2D(GL_TEXTURE_2D,
+			0,
+			GL_ALPHA,
+			PAGE_WIDTH,
+			PAGE_HEIGHT,
+			0,
+			GL_ALPHA,
+			GL_UNSIGNED_BYTE,
+			&textureData[0]);
 	}
 };
 
@@ -86,39 +153,127 @@ struct CharData
 int fontWidth;
 int fontHeight;
 static int fontSize;
+static bool sdfMode;
 static int fontAscent;
 static int fontXOffset;
 static float fontScale;
 static std::map<int, std::unique_ptr<Font>> fonts;
+static std::vector<std::unique_ptr<Font>> fallbackFonts;
+static std::unordered_map<uint32_t, Font*> fontForCodepoint;
 static std::vector<std::unique_ptr<Page>> pages;
-static std::map<uint32_t, CharData> chardata;
+static Page* currentPage; /* the one new glyphs are packed into */
+static uint64_t frame;    /* counts calls to flushChars() */
+static std::unordered_map<uint32_t, CharData> chardata;
+static std::vector<Vertex> backgroundVertices; /* quads */
+static std::vector<Vertex> shapeVertices;      /* triangles */
+static std::vector<Vertex> lineVertices;       /* lines */
 
 static std::unique_ptr<Font> loadFont(const char* filename, int defaultfont)
 {
     std::unique_ptr<Font> font;
-    FILE* fp = fopen(filename, "rb");
-    if (fp)
-    {
-        font = std::make_unique<DynamicFont>(fp);
-        fclose(fp);
-    }
+    MappedFile mf;
+    if (mapfile(filename, &mf))
+        font = std::make_unique<DynamicFont>(mf);
     else
     {
         font = std::make_unique<StaticFont>();
         font->data = (uint8_t*)&font_table[defaultfont].data[0];
+        font->len = font_table[defaultfont].data.size();
     }
 
     stbtt_InitFont(&font->info, font->data, 0);
     return font;
 }
 
+/* Loads the fallback fonts, a semicolon-separated list of files which are
+ * searched in order for glyphs the styled font doesn't have. Ones which
+ * can't be loaded are skipped. */
+
+static void loadFallbackFonts(const char* filenames)
+{
+    fallbackFonts.clear();
+    fontForCodepoint.clear();
+    if (!filenames)
+        return;
+
+    std::string_view list(filenames);
+    while (!list.empty())
+    {
+        size_t i = list.find(';');
+        std::string filename(list.substr(0, i));
+        list = (i == std::string_view::npos) ? "" : list.substr(i + 1);
+
+        MappedFile mf;
+        if (filename.empty() || !mapfile(filename.c_str(), &mf))
+            continue;
+        auto font = std::make_unique<DynamicFont>(mf);
+        if (stbtt_InitFont(&font->info, font->data, 0))
+            fallbackFonts.push_back(std::move(font));
+    }
+}
+
+/* Works out which font to draw a codepoint in: the styled font if it has
+ * the glyph, otherwise the regular one, otherwise the first fallback which
+ * does. If none of them do, the styled font's missing glyph is used. The
+ * answer's cached, as searching the fallbacks isn't cheap and glyphs can be
+ * evicted and rendered again many times. */
+
+static Font* resolveFont(uni_t c, int style)
+{
+    uint32_t key = c | (style << 24);
+    auto it = fontForCodepoint.find(key);
+    if (it != fontForCodepoint.end())
+        return it->second;
+
+    Font* styled = fonts[style].get();
+    Font* font = nullptr;
+    auto has = [&](Font* f)
+    {
+        return f && stbtt_FindGlyphIndex(&f->info, c);
+    };
+    if (has(styled))
+        font = styled;
+    else if (has(fonts[REGULAR].get()))
+        font = fonts[REGULAR].get();
+    else
+    {
+        for (auto& f : fallbackFonts)
+            if (has(f.get()))
+            {
+                font = f.get();
+                break;
+            }
+        if (!font)
+            font = styled;
+    }
+
+    fontForCodepoint[key] = font;
+    return font;
+}
+
+static CharData* getCharData(uni_t c, int style);
+static bool loadAtlas();
+static void saveAtlas();
+
+/* Renders the printable ASCII characters in every style up front, so that
+ * the first screenful doesn't have to do it glyph by glyph. */
+
+static void prewarmFontCache()
+{
+    for (int style = 0; style <= (BOLD | ITALIC); style++)
+        for (uni_t c = 33; c < 127; c++)
+            getCharData(c, style);
+}
+
 void loadFonts()
 {
     fontSize = get_ivar("font_size");
+    sdfMode = get_bvar("sdf_glyphs");
     fonts[REGULAR] = loadFont(get_svar("font_regular"), 0);
     fonts[ITALIC] = loadFont(get_svar("font_italic"), 1);
     fonts[BOLD] = loadFont(get_svar("font_bold"), 2);
     fonts[BOLD | ITALIC] = loadFont(get_svar("font_bolditalic"), 3);
+    loadFallbackFonts(get_svar("font_fallbacks"));
 
     auto& font = fonts[REGULAR];
 
@@ -132,27 +287,307 @@ void loadFonts()
     stbtt_GetCodepointHMetrics(&font->info, 'M', &advance, &bearing);
     fontWidth = advance * fontScale + FONT_YPADDING;
     fontXOffset = bearing * fontScale;
+
+    if (!loadAtlas())
+        prewarmFontCache();
 }
 
 void unloadFonts()
 {
+    saveAtlas();
 	fonts.clear();
+    fallbackFonts.clear();
+    fontForCodepoint.clear();
 }
 
+/* Returns an empty page. Once there are MAX_PAGES, the one drawn least
+ * recently is emptied and reused, and its glyphs are forgotten (to be
+ * rendered again if they turn up again); pages drawn in this frame are left
+ * alone, as their quads are still queued, so if that's all of them there
+ * are temporarily more. */
+
 static Page* addPage()
 {
-	pages.push_back(std::make_unique<Page>());
-	return pages.back().get();
+	Page* victim = nullptr;
+	if (pages.size() >= MAX_PAGES)
+	{
+		for (auto& page : pages)
+			if ((page->lastUsed < frame) &&
+				(!victim || (page->lastUsed < victim->lastUsed)))
+				victim = page.get();
+	}
+
+	if (!victim)
+	{
+		pages.push_back(std::make_unique<Page>());
+		return pages.back().get();
+	}
+
+	for (auto it = chardata.begin(); it != chardata.end();)
+	{
+		if (it->second.page == victim)
+			it = chardata.erase(it);
+		else
+			++it;
+	}
+	victim->recycle();
+	return victim;
 }
 
 void flushFontCache()
 {
 	pages.clear();
 	chardata.clear();
+	currentPage = nullptr;
+}
+
+/* The glyph atlas cache. Rendering the glyphs is most of what starting up
+ * costs, so the pages of rendered glyphs are saved on exit and put straight
+ * back into textures next time. The cache is keyed by the contents of the
+ * fonts (just the start of the fallbacks, which is where the table
+ * checksums are, as they can be big) and the size they're rendered at, so changing either just makes a
+ * new one (except that SDF glyphs don't depend on the size, so they're all
+ * kept in the same one). Like the dictionary images, it's native-endian and only meant to
+ * be read by the machine which wrote it; anything which doesn't look right
+ * is ignored, and the glyphs get rendered as usual. */
+
+static const char ATLASMAGIC[8] = {'W', 'G', 'G', 'L', 'Y', 'P', 'H', 1};
+static const uint32_t BYTEORDER = 0x01020304;
+
+struct AtlasHeader
+{
+    char magic[8];
+    uint32_t byteorder;
+    uint32_t pagesize; /* PAGE_WIDTH * PAGE_HEIGHT */
+    uint64_t key;
+    uint32_t pagecount;
+    uint32_t glyphcount;
+};
+
+struct AtlasGlyph
+{
+    uint32_t key;
+    uint32_t page;
+    stbtt_packedchar packData;
+};
+
+static bool atlasDirty; /* glyphs have been rendered since it was loaded */
+
+static uint64_t atlasKey()
+{
+    /* FNV-1a, over the fonts and the size (or the mode). */
+
+    uint64_t h = 0xcbf29ce484222325ULL;
+    auto add = [&](const uint8_t* p, size_t len)
+    {
+        for (size_t i = 0; i < len; i++)
+            h = (h ^ p[i]) * 0x100000001b3ULL;
+    };
+    for (int style = 0; style <= (BOLD | ITALIC); style++)
+    {
+        auto& font = fonts[style];
+        if (font)
+            add(font->data, font->len);
+    }
+    for (auto& font : fallbackFonts)
+    {
+        add((const uint8_t*)&font->len, sizeof(font->len));
+        add(font->data, std::min(font->len, (size_t)4096));
+    }
+    if (sdfMode)
+    {
+        int sdfSize = -SDF_SIZE;
+        add((const uint8_t*)&sdfSize, sizeof(sdfSize));
+    }
+    else
+        add((const uint8_t*)&fontSize, sizeof(fontSize));
+    return h;
+}
+
+static std::string atlasFilename()
+{
+    lua_checkstack(L, 2);
+    lua_getglobal(L, "CONFIGDIR");
+    const char* dir = lua_tostring(L, -1);
+    std::string filename;
+    if (dir)
+    {
+        char leaf[64];
+        snprintf(leaf,
+            sizeof(leaf),
+            "/glyphs-%016llx.wgatlas",
+            (unsigned long long)atlasKey());
+        filename = std::string(dir) + leaf;
+    }
+    lua_pop(L, 1);
+    return filename;
+}
+
+static bool loadAtlas()
+{
+    std::string filename = atlasFilename();
+    MappedFile mf;
+    if (filename.empty() || !mapfile(filename.c_str(), &mf))
+        return false;
+    pages.clear();
+    chardata.clear();
+    currentPage = nullptr;
+
+    AtlasHeader header;
+    bool valid = mf.len >= sizeof(header);
+    if (valid)
+    {
+        memcpy(&header, mf.data, sizeof(header));
+        valid = !memcmp(header.magic, ATLASMAGIC, sizeof(ATLASMAGIC)) &&
+                (header.byteorder == BYTEORDER) &&
+                (header.pagesize == (PAGE_WIDTH * PAGE_HEIGHT)) &&
+                (header.key == atlasKey()) &&
+                (header.pagecount <= MAX_PAGES) &&
+                (mf.len == (sizeof(header) +
+                               (size_t)header.pagecount * header.pagesize +
+                               (size_t)header.glyphcount * sizeof(AtlasGlyph)));
+    }
+    if (!valid)
+    {
+        unmapfile(&mf);
+        return false;
+    }
+
+    const char* p = mf.data + sizeof(header);
+    for (uint32_t i = 0; i < header.pagecount; i++)
+    {
+        Page* page = addPage();
+        page->sealed = true;
+        memcpy(page->textureData, p, header.pagesize);
+        p += header.pagesize;
+
+        glBindTexture(GL_TEXTURE_2D, page->texture);
+        glTexSubImage2D(GL_TEXTURE_2D,
+            0,
+            0,
+            0,
+            PAGE_WIDTH,
+            PAGE_HEIGHT,
+            GL_ALPHA,
+            GL_UNSIGNED_BYTE,
+            &page->textureData[0]);
+    }
+
+    for (uint32_t i = 0; i < header.glyphcount; i++)
+    {
+        AtlasGlyph g;
+        memcpy(&g, p, sizeof(g));
+        p += sizeof(g);
+        if (g.page >= pages.size())
+            continue;
+
+        CharData& cd = chardata[g.key];
+        cd.key = g.key;
+        cd.page = pages[g.page].get();
+        cd.packData = g.packData;
+    }
+
+    unmapfile(&mf);
+    atlasDirty = false;
+    return true;
+}
+
+static void saveAtlas()
+{
+    if (!atlasDirty || pages.empty())
+        return;
+    std::string filename = atlasFilename();
+    if (filename.empty())
+        return;
+
+    std::unordered_map<Page*, uint32_t> pageNumbers;
+    for (size_t i = 0; i < pages.size(); i++)
+        pageNumbers[pages[i].get()] = i;
+
+    std::vector<AtlasGlyph> glyphs;
+    for (auto& [key, cd] : chardata)
+        if (cd.page)
+            glyphs.push_back(AtlasGlyph{key, pageNumbers[cd.page], cd.packData});
+
+    AtlasHeader header = {};
+    memcpy(header.magic, ATLASMAGIC, sizeof(ATLASMAGIC));
+    header.byteorder = BYTEORDER;
+    header.pagesize = PAGE_WIDTH * PAGE_HEIGHT;
+    header.key = atlasKey();
+    header.pagecount = pages.size();
+    header.glyphcount = glyphs.size();
+
+    std::vector<std::string_view> chunks;
+    chunks.push_back(std::string_view((const char*)&header, sizeof(header)));
+    for (auto& page : pages)
+        chunks.push_back(std::string_view(
+            (const char*)page->textureData, sizeof(page->textureData)));
+    chunks.push_back(std::string_view(
+        (const char*)glyphs.data(), glyphs.size() * sizeof(AtlasGlyph)));
+
+    /* If it can't be written, it just gets rendered again next time. */
+    (void)writefileatomically(filename, chunks);
+    atlasDirty = false;
+}
+
+/* Renders a glyph as a distance field at SDF_SIZE. The packData offsets
+ * are kept at that size too, and scaled when the glyph is drawn. */
+
+static int rawRenderSdf(Font& font, Page* page, CharData& cd, uni_t c)
+{
+    float scale = stbtt_ScaleForMappingEmToPixels(&font.info, SDF_SIZE);
+    int w, h, xoff, yoff;
+    uint8_t* bitmap = stbtt_GetCodepointSDF(&font.info,
+        scale,
+        c,
+        SDF_PADDING,
+        SDF_EDGE,
+        (float)SDF_EDGE / SDF_PADDING,
+        &w,
+        &h,
+        &xoff,
+        &yoff);
+
+    int advance, bearing;
+    stbtt_GetCodepointHMetrics(&font.info, c, &advance, &bearing);
+    stbtt_packedchar& pd = cd.packData;
+    pd = {};
+    pd.xadvance = advance * scale;
+    if (!bitmap)
+        return 1; /* nothing to draw, such as a space */
+
+    stbrp_rect rect = {};
+    rect.w = w + 1;
+    rect.h = h + 1;
+    stbtt_PackFontRangesPackRects(&page->ctx, &rect, 1);
+    if (!rect.was_packed)
+    {
+        stbtt_FreeSDF(bitmap, NULL);
+        return 0;
+    }
+
+    for (int y = 0; y < h; y++)
+        memcpy(&page->textureData[(rect.y + y) * PAGE_WIDTH + rect.x],
+            &bitmap[y * w],
+            w);
+    stbtt_FreeSDF(bitmap, NULL);
+
+    pd.x0 = rect.x;
+    pd.y0 = rect.y;
+    pd.x1 = rect.x + w;
+    pd.y1 = rect.y + h;
+    pd.xoff = xoff;
+    pd.yoff = yoff;
+    pd.xoff2 = xoff + w;
+    pd.yoff2 = yoff + h;
+    return 1;
 }
 
 static int rawRender(Font& font, Page* page, CharData& cd, uni_t c)
 {
+    if (sdfMode)
+        return rawRenderSdf(font, page, cd, c);
+
     stbtt_pack_range range;
     range.first_unicode_codepoint_in_range = c;
     range.array_of_unicode_codepoints = NULL;
@@ -172,90 +607,182 @@ static int rawRender(Font& font, Page* page, CharData& cd, uni_t c)
         &page->ctx, &font.info, &range, 1, &rect);
 }
 
-static void renderTtfChar(uni_t c, uint8_t attrs, float x, float y)
+static void addVertex(std::vector<Vertex>& v, const colour_t& colour, int x, int y)
 {
-    int style = REGULAR;
-    if (attrs & DPY_BOLD)
-        style |= BOLD;
-    if (attrs & DPY_ITALIC)
-        style |= ITALIC;
+    v.push_back({colour.r, colour.g, colour.b, (GLfloat)x, (GLfloat)y, 0});
+}
 
+static void addLine(const colour_t& colour, int x0, int y0, int x1, int y1)
+{
+    addVertex(lineVertices, colour, x0, y0);
+    addVertex(lineVertices, colour, x1, y1);
+}
+
+static void addTriangle(
+    const colour_t& colour, int x0, int y0, int x1, int y1, int x2, int y2)
+{
+    addVertex(shapeVertices, colour, x0, y0);
+    addVertex(shapeVertices, colour, x1, y1);
+    addVertex(shapeVertices, colour, x2, y2);
+}
+
+static void addRect(const colour_t& colour, int x0, int y0, int x1, int y1)
+{
+    addTriangle(colour, x0, y0, x1, y0, x1, y1);
+    addTriangle(colour, x0, y0, x1, y1, x0, y1);
+}
+
+/* Looks up a glyph, rendering it into a page (and uploading the rows it
+ * occupies to the page's texture) if it's not been seen before. Returns
+ * NULL if the glyph can't be rendered. */
+
+static CharData* getCharData(uni_t c, int style)
+{
     uint32_t key = c | (style << 24);
-	auto [it, inserted] = chardata.emplace(key, CharData{});
-	auto& cd = it->second;
-    if (inserted)
+    auto it = chardata.find(key);
+    if (it != chardata.end())
     {
-        Page* page = pages.empty() ? addPage() : pages.back().get();
-
-        auto& font = fonts[style];
-        if (!font)
-            return;
+        CharData& cd = it->second;
+        if (!cd.page)
+            return NULL;
+        cd.page->lastUsed = frame;
+        return &cd;
+    }
 
-		cd.key = key;
+    Font* font = resolveFont(c, style);
+    if (!font)
+    {
+        chardata[key] = CharData{key, nullptr};
+        return NULL;
+    }
 
-        /* First try rendering into the current page. If that fails, the
-         * page is full and we need a new one. */
+    /* First try rendering into the current page. If that fails, the page
+     * is full and we need a new one (which may mean evicting another's
+     * glyphs, which is why this one isn't in chardata yet). */
 
-        if (!rawRender(*font, page, cd, c))
+    CharData cd = {key, nullptr};
+    if (!currentPage || currentPage->sealed)
+        currentPage = addPage();
+    if (!rawRender(*font, currentPage, cd, c))
+    {
+        currentPage = addPage();
+        if (!rawRender(*font, currentPage, cd, c))
         {
-            page = addPage();
-            if (!rawRender(*font, page, cd, c))
-            {
-                printf("Unrenderable codepoint %d\n", c);
-				pages.pop_back();
-                return;
-            }
+            printf("Unrenderable codepoint %d\n", c);
+            chardata[key] = cd;
+            return NULL;
         }
-        cd.page = page;
+    }
+    Page* page = cd.page = currentPage;
+    page->lastUsed = frame;
+    atlasDirty = true;
+
+    /* Now we have a valid rendered glyph, but we need to update the
+     * texture. Only the rows containing the new glyph have changed. */
+
+    int y0 = cd.packData.y0;
+    int y1 = cd.packData.y1;
+    glBindTexture(GL_TEXTURE_2D, page->texture);
+    glTexSubImage2D(GL_TEXTURE_2D,
+        0,
+        0,
+        y0,
+        PAGE_WIDTH,
+        y1 - y0,
+        GL_ALPHA,
+        GL_UNSIGNED_BYTE,
+        &page->textureData[y0 * PAGE_WIDTH]);
+
+    return &(chardata[key] = cd);
+}
 
-        /* Now we have a valid rendered glyph, but we need to update the
-         * texture. */
+/* Queues a glyph, drawn with its origin at x, y and then scaled by the given
+ * factor around the point (ox, oy). */
+
+static void renderTtfChar(uni_t c,
+    uint8_t attrs,
+    const colour_t& colour,
+    float x,
+    float y,
+    float scale = 1.0,
+    float ox = 0.0,
+    float oy = 0.0)
+{
+    int style = REGULAR;
+    if (attrs & DPY_BOLD)
+        style |= BOLD;
+    if (attrs & DPY_ITALIC)
+        style |= ITALIC;
 
-        glBindTexture(GL_TEXTURE_2D, page->texture);
-        glTexImage2D(GL_TEXTURE_2D,
-            0,
-            GL_ALPHA,
-            PAGE_WIDTH,
-            PAGE_HEIGHT,
-            0,
-            GL_ALPHA,
-            GL_UNSIGNED_BYTE,
-            &page->textureData[0]);
-    }
+    CharData* cd = getCharData(c, style);
+    if (!cd)
+        return;
 
     stbtt_aligned_quad q;
-    stbtt_GetPackedQuad(
-        &cd.packData, PAGE_WIDTH, PAGE_HEIGHT, 0, &x, &y, &q, true);
+    if (sdfMode)
+    {
+        const stbtt_packedchar& pd = cd->packData;
+        float k = (float)fontSize / SDF_SIZE;
+        x = floorf(x + 0.5f);
+        y = floorf(y + 0.5f);
+        q.x0 = x + pd.xoff * k;
+        q.y0 = y + pd.yoff * k;
+        q.x1 = x + pd.xoff2 * k;
+        q.y1 = y + pd.yoff2 * k;
+        q.s0 = pd.x0 / (float)PAGE_WIDTH;
+        q.t0 = pd.y0 / (float)PAGE_HEIGHT;
+        q.s1 = pd.x1 / (float)PAGE_WIDTH;
+        q.t1 = pd.y1 / (float)PAGE_HEIGHT;
+    }
+    else
+        stbtt_GetPackedQuad(
+            &cd->packData, PAGE_WIDTH, PAGE_HEIGHT, 0, &x, &y, &q, true);
 
-    glEnable(GL_BLEND);
-    glBindTexture(GL_TEXTURE_2D, cd.page->texture);
-    glBegin(GL_QUADS);
-    glTexCoord2f(q.s0, q.t0);
-    glVertex2f(q.x0, q.y0);
-    glTexCoord2f(q.s1, q.t0);
-    glVertex2f(q.x1, q.y0);
-    glTexCoord2f(q.s1, q.t1);
-    glVertex2f(q.x1, q.y1);
-    glTexCoord2f(q.s0, q.t1);
-    glVertex2f(q.x0, q.y1);
-    glEnd();
+    auto vertex = [&](float s, float t, float x, float y)
+    {
+        cd->page->vertices.push_back({s,
+            t,
+            colour.r,
+            colour.g,
+            colour.b,
+            ox + (x - ox) * scale,
+            oy + (y - oy) * scale,
+            0});
+    };
+    vertex(q.s0, q.t0, q.x0, q.y0);
+    vertex(q.s1, q.t0, q.x1, q.y0);
+    vertex(q.s1, q.t1, q.x1, q.y1);
+    vertex(q.s0, q.t1, q.x0, q.y1);
 }
 
 void printChar(const cell_t* cell, float x, float y)
 {
-    GLfloat* fg = (GLfloat*)&cell->fg;
-    GLfloat* bg = (GLfloat*)&cell->bg;
-
-    /* Draw background. */
-
-    glDisable(GL_BLEND);
-    glColor3fv((cell->attr & DPY_REVERSE) ? fg : bg);
-    glRectf(x, y, x + fontWidth, y + fontHeight);
+    const colour_t& fg = (cell->attr & DPY_REVERSE) ? cell->bg : cell->fg;
+    const colour_t& bg = (cell->attr & DPY_REVERSE) ? cell->fg : cell->bg;
+
+    /* Draw background. Cells are printed left to right, so if this one
+     * carries on from the previous quad in the same colour, that's just
+     * stretched over it; a screen of plain text is then a handful of quads
+     * per row rather than one per cell. */
+
+    size_t n = backgroundVertices.size();
+    Vertex* last = n ? &backgroundVertices[n - 4] : nullptr;
+    if (last && (last[1].x == x) && (last[1].y == y) &&
+        (last[2].y == (y + fontHeight)) && (last[0].r == bg.r) &&
+        (last[0].g == bg.g) && (last[0].b == bg.b))
+    {
+        last[1].x = last[2].x = x + fontWidth;
+    }
+    else
+    {
+        addVertex(backgroundVertices, bg, x, y);
+        addVertex(backgroundVertices, bg, x + fontWidth, y);
+        addVertex(backgroundVertices, bg, x + fontWidth, y + fontHeight);
+        addVertex(backgroundVertices, bg, x, y + fontHeight);
+    }
 
     /* Draw foreground. */
 
-    glColor3fv((cell->attr & DPY_REVERSE) ? bg : fg);
-
     int w = fontWidth;
     int h = fontHeight;
     int w2 = fontWidth / 2;
@@ -268,165 +795,112 @@ void printChar(const cell_t* cell, float x, float y)
 
         case 0x2500: /* ─ */
         case 0x2501: /* ━ */
-            glBegin(GL_LINES);
-            glVertex2i(x + 0, y + h2);
-            glVertex2i(x + w, y + h2);
-            glEnd();
+            addLine(fg, x + 0, y + h2, x + w, y + h2);
             break;
 
         case 0x2502: /* │ */
         case 0x2503: /* ┃ */
-            glBegin(GL_LINES);
-            glVertex2i(x + w2, y + 0);
-            glVertex2i(x + w2, y + h);
-            glEnd();
+            addLine(fg, x + w2, y + 0, x + w2, y + h);
             break;
 
         case 0x250c: /* ┌ */
         case 0x250d: /* ┍ */
         case 0x250e: /* ┎ */
         case 0x250f: /* ┏ */
-            glBegin(GL_LINES);
-            glVertex2i(x + w2, y + h2);
-            glVertex2i(x + w2, y + h);
-
-            glVertex2i(x + w2, y + h2);
-            glVertex2i(x + w, y + h2);
-            glEnd();
+            addLine(fg, x + w2, y + h2, x + w2, y + h);
+            addLine(fg, x + w2, y + h2, x + w, y + h2);
             break;
 
         case 0x2510: /* ┐ */
         case 0x2511: /* ┑ */
         case 0x2512: /* ┒ */
         case 0x2513: /* ┓ */
-            glBegin(GL_LINES);
-            glVertex2i(x + w2, y + h2);
-            glVertex2i(x + w2, y + h);
-
-            glVertex2i(x + 0, y + h2);
-            glVertex2i(x + w2, y + h2);
-            glEnd();
+            addLine(fg, x + w2, y + h2, x + w2, y + h);
+            addLine(fg, x + 0, y + h2, x + w2, y + h2);
             break;
 
         case 0x2514: /* └ */
         case 0x2515: /* ┕ */
         case 0x2516: /* ┖ */
         case 0x2517: /* ┗ */
-            glBegin(GL_LINES);
-            glVertex2i(x + w2, y + 0);
-            glVertex2i(x + w2, y + h2);
-
-            glVertex2i(x + w2, y + h2);
-            glVertex2i(x + w, y + h2);
-            glEnd();
+            addLine(fg, x + w2, y + 0, x + w2, y + h2);
+            addLine(fg, x + w2, y + h2, x + w, y + h2);
             break;
 
         case 0x2518: /* ┘ */
         case 0x2519: /* ┙ */
         case 0x251a: /* ┚ */
         case 0x251b: /* ┛ */
-            glBegin(GL_LINES);
-            glVertex2i(x + w2, y + 0);
-            glVertex2i(x + w2, y + h2);
-
-            glVertex2i(x + 0, y + h2);
-            glVertex2i(x + w2, y + h2);
-            glEnd();
+            addLine(fg, x + w2, y + 0, x + w2, y + h2);
+            addLine(fg, x + 0, y + h2, x + w2, y + h2);
             break;
 
         case 0x2551: /* ║ */
-            glBegin(GL_LINES);
-            glVertex2i(x + w2 - 1, y);
-            glVertex2i(x + w2 - 1, y + h);
-
-            glVertex2i(x + w2 + 1, y);
-            glVertex2i(x + w2 + 1, y + h);
-            glEnd();
+            addLine(fg, x + w2 - 1, y, x + w2 - 1, y + h);
+            addLine(fg, x + w2 + 1, y, x + w2 + 1, y + h);
             break;
 
         case 0x2594: /* ▔ */
-            glBegin(GL_POLYGON);
-            glVertex2i(x, y + 0);
-            glVertex2i(x + w, y + 0);
-            glVertex2i(x + w, y + 2);
-            glVertex2i(x, y + 2);
-            glEnd();
+            addRect(fg, x, y + 0, x + w, y + 2);
             break;
 
         case 0x2581: /* ▁ */
-            glBegin(GL_POLYGON);
-            glVertex2i(x + w, y + h - 2);
-            glVertex2i(x, y + h - 2);
-            glVertex2i(x, y + h);
-            glVertex2i(x + w, y + h);
-            glEnd();
+            addRect(fg, x, y + h - 2, x + w, y + h);
             break;
 
         case 0x25bc: /* ▼ */
-            glBegin(GL_POLYGON);
-            glVertex2i(x, y + h - w - 1);
-            glVertex2i(x + w / 2, y + h - 1);
-            glVertex2i(x + w, y + h - w - 1);
-            glEnd();
+            addTriangle(fg,
+                x, y + h - w - 1,
+                x + w / 2, y + h - 1,
+                x + w, y + h - w - 1);
             break;
 
         case 0x25be: /* ▾ */
-            glBegin(GL_POLYGON);
-            glVertex2i(x + w * 1 / 3, y + h * 2 / 3);
-            glVertex2i(x + w / 2, y + h - 1);
-            glVertex2i(x + w * 2 / 3, y + h * 2 / 3);
-            glEnd();
+            addTriangle(fg,
+                x + w * 1 / 3, y + h * 2 / 3,
+                x + w / 2, y + h - 1,
+                x + w * 2 / 3, y + h * 2 / 3);
             break;
 
         case 0x25e4: /* ◤ */
-            glBegin(GL_POLYGON);
-            glVertex2i(x, y + h - w - 1);
-            glVertex2i(x + w, y + h - w - 1);
-            glVertex2i(x, y + h - 1);
-            glEnd();
+            addTriangle(fg,
+                x, y + h - w - 1,
+                x + w, y + h - w - 1,
+                x, y + h - 1);
             break;
 
         case 0x25e5: /* ◥ */
-            glBegin(GL_POLYGON);
-            glVertex2i(x, y + h - w - 1);
-            glVertex2i(x + w, y + h - w - 1);
-            glVertex2i(x + w, y + h - 1);
-            glEnd();
+            addTriangle(fg,
+                x, y + h - w - 1,
+                x + w, y + h - w - 1,
+                x + w, y + h - 1);
             break;
 
         case 0x25b3: /* △ */
-            glBegin(GL_LINE_LOOP);
-            glVertex2i(x, y + w);
-            glVertex2i(x + w / 2, y);
-            glVertex2i(x + w, y + w);
-            glEnd();
+            addLine(fg, x, y + w, x + w / 2, y);
+            addLine(fg, x + w / 2, y, x + w, y + w);
+            addLine(fg, x + w, y + w, x, y + w);
             break;
 
         case 0x25ff: /* ◿ */
-            glBegin(GL_LINE_LOOP);
-            glVertex2i(x + w, y);
-            glVertex2i(x + w, y + w);
-            glVertex2i(x, y + w);
-            glEnd();
+            addLine(fg, x + w, y, x + w, y + w);
+            addLine(fg, x + w, y + w, x, y + w);
+            addLine(fg, x, y + w, x + w, y);
             break;
 
         case 0x25fa: /* ◺ */
-            glBegin(GL_LINE_LOOP);
-            glVertex2i(x, y);
-            glVertex2i(x + w, y + w);
-            glVertex2i(x, y + w);
-            glEnd();
+            addLine(fg, x, y, x + w, y + w);
+            addLine(fg, x + w, y + w, x, y + w);
+            addLine(fg, x, y + w, x, y);
             break;
 
         case 0x25c7: /* ◇ */
         {
             int d = w / 2;
-            glBegin(GL_LINE_LOOP);
-            glVertex2i(x, y + h / 2);
-            glVertex2i(x + d, y + h / 2 + d);
-            glVertex2i(x + 2 * d, y + h / 2);
-            glVertex2i(x + d, y + h / 2 - d);
-            glEnd();
+            addLine(fg, x, y + h / 2, x + d, y + h / 2 + d);
+            addLine(fg, x + d, y + h / 2 + d, x + 2 * d, y + h / 2);
+            addLine(fg, x + 2 * d, y + h / 2, x + d, y + h / 2 - d);
+            addLine(fg, x + d, y + h / 2 - d, x, y + h / 2);
             break;
         }
 
@@ -443,28 +917,85 @@ void printChar(const cell_t* cell, float x, float y)
         {
             int xx = x + w / 2;
             int yy = y + h;
-            glPushMatrix();
-            glTranslatef(xx, yy, 0);
-            glScalef(0.7, 0.7, 0.7);
-            glTranslatef(-xx, -yy, 0);
             renderTtfChar(cell->c - 0x2080 + '0',
                 cell->attr,
+                fg,
                 x + fontXOffset,
-                y + fontAscent);
-            glPopMatrix();
+                y + fontAscent,
+                0.7,
+                xx,
+                yy);
             break;
         }
 
         default:
-            renderTtfChar(cell->c, cell->attr, x + fontXOffset, y + fontAscent);
+            renderTtfChar(
+                cell->c, cell->attr, fg, x + fontXOffset, y + fontAscent);
     }
 
     if (cell->attr & DPY_UNDERLINE)
+        addLine(fg,
+            x + fontXOffset,
+            y + fontAscent + 1,
+            x + fontXOffset + fontWidth,
+            y + fontAscent + 1);
+}
+
+static void drawVertices(
+    GLenum mode, GLenum format, const void* data, size_t count)
+{
+    if (!count)
+        return;
+    glInterleavedArrays(format, 0, data);
+    glDrawArrays(mode, 0, count);
+}
+
+void flushChars()
+{
+    /* Backgrounds and shapes are drawn untextured and unblended, in that
+     * order; then everything textured, one call per glyph page. Distance
+     * fields are thresholded at the edge by the alpha test, which keeps
+     * them sharp at any scale without needing a shader. */
+
+    glDisable(GL_BLEND);
+    glDisable(GL_TEXTURE_2D);
+    drawVertices(GL_QUADS,
+        GL_C3F_V3F,
+        backgroundVertices.data(),
+        backgroundVertices.size());
+    drawVertices(GL_TRIANGLES,
+        GL_C3F_V3F,
+        shapeVertices.data(),
+        shapeVertices.size());
+    drawVertices(
+        GL_LINES, GL_C3F_V3F, lineVertices.data(), lineVertices.size());
+
+    glEnable(GL_TEXTURE_2D);
+    glEnable(GL_BLEND);
+    if (sdfMode)
+    {
+        glEnable(GL_ALPHA_TEST);
+        glAlphaFunc(GL_GEQUAL, SDF_EDGE / 255.0f);
+    }
+    for (auto& page : pages)
     {
-        glDisable(GL_BLEND);
-        glBegin(GL_LINES);
-        glVertex2i(x + fontXOffset, y + fontAscent + 1);
-        glVertex2i(x + fontXOffset + fontWidth, y + fontAscent + 1);
-        glEnd();
+        if (page->vertices.empty())
+            continue;
+        glBindTexture(GL_TEXTURE_2D, page->texture);
+        drawVertices(GL_QUADS,
+            GL_T2F_C3F_V3F,
+            page->vertices.data(),
+            page->vertices.size());
+        page->vertices.clear();
     }
+    glDisable(GL_ALPHA_TEST);
+
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+
+    backgroundVertices.clear();
+    shapeVertices.clear();
+    lineVertices.clear();
+    frame++;
 }
@@ -31,9 +31,11 @@ extern void loadFonts();
 extern void unloadFonts();
 extern void flushFontCache();
 extern void printChar(const cell_t* cell, float x, float y);
+extern void flushChars();
 
 extern int get_ivar(const char* name);
 extern const char* get_svar(const char* name);
+extern bool get_bvar(const char* name);
 
 #endif
 
@@ -2,6 +2,12 @@
 #include "gui.h"
 #include <GLFW/glfw3.h>
 #include <deque>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <math.h>
+#include <string.h>
 
 #define VKM_SHIFT 0x10000
 #define VKM_CTRL 0x20000
@@ -14,16 +20,26 @@ static colour_t currentBg;
 static int screenWidth;
 static int screenHeight;
 static cell_t* screen;
+static cell_t* drawnScreen; /* what's currently in retainedTexture */
+static GLuint retainedTexture;
+static int retainedWidth;
+static int retainedHeight;
+static bool retainedValid;
 static int cursorx;
 static int cursory;
 static bool cursorShown;
 static std::deque<uni_t> keyboardQueue;
 static bool pendingRedraw;
+static bool screenDirty = true;
+static bool syncPending;
+static double lastFrameTime;
+static double minFrameInterval;
 static bool fullScreen;
 static int oldWindowX;
 static int oldWindowY;
 static int oldWindowW;
 static int oldWindowH;
+static bool exposed; /* the window needs repainting before Lua gets to it */
 
 static void queueRedraw()
 {
@@ -173,11 +189,15 @@ static void character_cb(GLFWwindow* window, unsigned int c)
 
 static void resize_cb(GLFWwindow* window, int width, int height)
 {
+    screenDirty = true;
+    exposed = true;
     queueRedraw();
 }
 
 static void refresh_cb(GLFWwindow* window)
 {
+    screenDirty = true;
+    exposed = true;
     queueRedraw();
 }
 
@@ -186,6 +206,13 @@ static void close_cb(GLFWwindow* window)
     keyboardQueue.push_back(-KEY_QUIT);
 }
 
+/* While dragging, the pointer can cross several cells a frame, and each
+ * event moves the cursor. So if the last thing in the queue is a drag which
+ * hasn't been picked up yet it's replaced rather than added to; this is the
+ * value of that event, or zero. */
+
+static uni_t queuedDrag;
+
 static void handle_mouse(double x, double y, bool b)
 {
     static bool motion = false;
@@ -201,7 +228,15 @@ static void handle_mouse(double x, double y, bool b)
 
     if ((ix != oldix) || (iy != oldiy) || (b != oldb))
     {
-        keyboardQueue.push_back(-encode_mouse_event(ix, iy, b));
+        uni_t e = -encode_mouse_event(ix, iy, b);
+        bool drag = b && oldb;
+        if (drag && !keyboardQueue.empty() &&
+            (keyboardQueue.back() == queuedDrag))
+            keyboardQueue.back() = e;
+        else
+            keyboardQueue.push_back(e);
+        queuedDrag = drag ? e : 0;
+
         oldix = ix;
         oldiy = iy;
         oldb = b;
@@ -232,12 +267,68 @@ static void mousebutton_cb(GLFWwindow* window, int button, int action, int mods)
     }
 }
 
+/* Touchpads scroll in fractions of a notch, many times a frame, so these
+ * are added up and only whole notches are sent on (a wheel always sends
+ * whole ones). Changing direction starts again. */
+
 void scroll_cb(GLFWwindow* window, double xoffset, double yoffset)
 {
-    if (yoffset < 0)
+    static double scrolled = 0.0;
+    if ((scrolled < 0) != (yoffset < 0))
+        scrolled = 0.0;
+    scrolled += yoffset;
+
+    while (scrolled <= -1.0)
+    {
         keyboardQueue.push_back(-KEY_SCROLLDOWN);
-    else
+        scrolled += 1.0;
+    }
+    while (scrolled >= 1.0)
+    {
         keyboardQueue.push_back(-KEY_SCROLLUP);
+        scrolled -= 1.0;
+    }
+}
+
+/* While the scripts are busy (with a long import or save, say) nothing
+ * calls dpy_getchar(), so window events would go unanswered and the window
+ * manager would decide we'd hung. So a thread asks the interpreter, every
+ * PUMP_INTERVAL, to call pump() at its next safepoint; that handles the
+ * window's events, repainting it from the current screen if it's been
+ * exposed or resized. Input is just queued for when the scripts next want
+ * it. (GLFW only allows events to be handled on the main thread, so this
+ * can't be done by drawing from a thread of its own.) This shares the
+ * interrupt with the profiler, so each only arms it if it's free; a
+ * collision just costs a sample or a pump. */
+
+static const auto PUMP_INTERVAL = std::chrono::milliseconds(100);
+static std::thread pumpThread;
+static std::atomic<bool> pumpRunning;
+
+static void render(void);
+
+static void pump(lua_State* L, int gc)
+{
+    lua_Callbacks* callbacks = lua_callbacks(L);
+    if (callbacks->interrupt == pump)
+        callbacks->interrupt = nullptr;
+    if (gc >= 0)
+        return;
+
+    glfwPollEvents();
+    if (exposed)
+        render();
+}
+
+static void pumpTicker()
+{
+    lua_Callbacks* callbacks = lua_callbacks(L);
+    while (pumpRunning)
+    {
+        std::this_thread::sleep_for(PUMP_INTERVAL);
+        if (!callbacks->interrupt)
+            callbacks->interrupt = pump;
+    }
 }
 
 void dpy_init(const char* argv[]) {}
@@ -276,13 +367,26 @@ void dpy_start(void)
     image.pixels = icon_data;
     glfwSetWindowIcon(window, 1, &image);
 
+    int maxFps = get_ivar("max_fps");
+    minFrameInterval = (maxFps > 0) ? (1.0 / maxFps) : 0.0;
+    screenDirty = true;
+
     loadFonts();
+
+    pumpRunning = true;
+    pumpThread = std::thread(pumpTicker);
 }
 
 void dpy_shutdown(void)
 {
+    pumpRunning = false;
+    pumpThread.join();
+    if (lua_callbacks(L)->interrupt == pump)
+        lua_callbacks(L)->interrupt = nullptr;
+
     unloadFonts();
     flushFontCache();
+    glDeleteTextures(1, &retainedTexture);
     glfwDestroyWindow(window);
     glfwTerminate();
 }
@@ -304,9 +408,40 @@ void dpy_getmouse(uni_t key, int* x, int* y, bool* p)
     *p = false;
 }
 
-void dpy_sync(void)
+static bool sameCell(const cell_t* a, const cell_t* b)
 {
-    pendingRedraw = false;
+    return (a->c == b->c) && (a->attr == b->attr) && (a->fg.r == b->fg.r) &&
+           (a->fg.g == b->fg.g) && (a->fg.b == b->fg.b) &&
+           (a->bg.r == b->bg.r) && (a->bg.g == b->bg.g) &&
+           (a->bg.b == b->bg.b);
+}
+
+/* The window's contents (without the cursor) are kept in retainedTexture.
+ * Each frame starts by copying that back into the framebuffer; then only
+ * the cells which differ from what was drawn last time are redrawn, and the
+ * rows they're on copied back into the texture. So a blinking cursor or a
+ * single typed character don't cost a whole-window repaint. */
+
+static void drawRetainedTexture(int w, int h)
+{
+    glDisable(GL_BLEND);
+    glBindTexture(GL_TEXTURE_2D, retainedTexture);
+    glColor3f(1.0f, 1.0f, 1.0f);
+    glBegin(GL_QUADS);
+    glTexCoord2f(0, 1);
+    glVertex2i(0, 0);
+    glTexCoord2f(1, 1);
+    glVertex2i(w, 0);
+    glTexCoord2f(1, 0);
+    glVertex2i(w, h);
+    glTexCoord2f(0, 0);
+    glVertex2i(0, h);
+    glEnd();
+}
+
+static void render(void)
+{
+    exposed = false;
 
     /* Configure viewport for 2D graphics. */
 
@@ -333,53 +468,168 @@ void dpy_sync(void)
     glMatrixMode(GL_MODELVIEW);
     glLoadIdentity();
 
-    glClear(GL_COLOR_BUFFER_BIT);
+    bool fullRedraw = !retainedValid;
+    if (!retainedTexture || (retainedWidth != w) || (retainedHeight != h))
+    {
+        if (!retainedTexture)
+            glGenTextures(1, &retainedTexture);
+        glBindTexture(GL_TEXTURE_2D, retainedTexture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexImage2D(GL_TEXTURE_2D,
+            0,
+            GL_RGB,
+            w,
+            h,
+            0,
+            GL_RGB,
+            GL_UNSIGNED_BYTE,
+            NULL);
+        retainedWidth = w;
+        retainedHeight = h;
+        fullRedraw = true;
+    }
+
+    /* When the window changes size, what's there is kept (clipped to the
+     * new size) until the scripts get round to drawing the new layout,
+     * which they won't do until the resizing has settled down. */
 
     int sw = w / fontWidth;
     int sh = h / fontHeight;
     if (!screen || (screenWidth != sw) || (screenHeight != sh))
     {
+        cell_t* newScreen = new cell_t[sw * sh];
+        for (int y = 0; y < sh; y++)
+            for (int x = 0; x < sw; x++)
+            {
+                cell_t& cell = newScreen[y * sw + x];
+                if (screen && (x < screenWidth) && (y < screenHeight))
+                    cell = screen[y * screenWidth + x];
+                else
+                    cell = cell_t{' ', 0, currentFg, currentBg};
+            }
+
         delete [] screen;
+        delete [] drawnScreen;
         screenWidth = sw;
         screenHeight = sh;
-        screen = new cell_t[screenWidth * screenHeight];
+        screen = newScreen;
+        drawnScreen = new cell_t[screenWidth * screenHeight];
         keyboardQueue.push_back(-KEY_RESIZE);
+
+        retainedValid = false;
+        fullRedraw = true;
     }
+
+    if (fullRedraw)
+        glClear(GL_COLOR_BUFFER_BIT);
     else
+        drawRetainedTexture(w, h);
+
+    /* A glyph can spill over into the cells either side of it, so those
+     * get redrawn too. */
+
+    int firstRow = screenHeight;
+    int lastRow = -1;
+    std::vector<bool> changed(screenWidth + 2);
+    for (int y = 0; y < screenHeight; y++)
     {
-        const cell_t* p = &screen[0];
-        for (int y = 0; y < screenHeight; y++)
+        const cell_t* p = &screen[y * screenWidth];
+        cell_t* q = &drawnScreen[y * screenWidth];
+
+        bool any = false;
+        for (int x = 0; x < screenWidth; x++)
         {
-            float sy = y * fontHeight;
-            for (int x = 0; x < screenWidth; x++)
-            {
-                float sx = x * fontWidth;
-                printChar(p, sx, sy);
-                p++;
-            }
+            changed[x + 1] = fullRedraw || !sameCell(&p[x], &q[x]);
+            any |= changed[x + 1];
         }
+        if (!any)
+            continue;
 
-        if (cursorShown)
+        firstRow = std::min(firstRow, y);
+        lastRow = y;
+
+        float sy = y * fontHeight;
+        for (int x = 0; x < screenWidth; x++)
         {
-            int x = cursorx * fontWidth - 1;
-            if (x < 0)
-                x = 0;
-            int y = cursory * fontHeight;
-
-            glColor3f(1.0f, 1.0f, 1.0f);
-            glLogicOp(GL_XOR);
-            glDisable(GL_BLEND);
-            glDisable(GL_POLYGON_SMOOTH);
-            glEnable(GL_COLOR_LOGIC_OP);
-            glRecti(x, y, x + fontWidth, y + fontHeight);
-            glLogicOp(GL_CLEAR);
-            glDisable(GL_COLOR_LOGIC_OP);
+            if (changed[x] || changed[x + 1] || changed[x + 2])
+            {
+                printChar(&p[x], x * fontWidth, sy);
+                q[x] = p[x];
+            }
         }
     }
+    flushChars();
+
+    if (fullRedraw)
+    {
+        firstRow = 0;
+        lastRow = screenHeight;
+    }
+    if (lastRow >= firstRow)
+    {
+        /* The framebuffer's origin is at the bottom left. */
+
+        int top = firstRow * fontHeight;
+        int bottom = std::min(h, (lastRow + 1) * fontHeight);
+        glBindTexture(GL_TEXTURE_2D, retainedTexture);
+        glCopyTexSubImage2D(GL_TEXTURE_2D,
+            0,
+            0,
+            h - bottom,
+            0,
+            h - bottom,
+            w,
+            bottom - top);
+    }
+    retainedValid = true;
+
+    if (cursorShown)
+    {
+        int x = cursorx * fontWidth - 1;
+        if (x < 0)
+            x = 0;
+        int y = cursory * fontHeight;
+
+        /* The cursor inverts what's under it. That's done by blending
+         * (white times one minus the destination) rather than with an
+         * XOR logic op, which many drivers only emulate. */
+
+        glColor3f(1.0f, 1.0f, 1.0f);
+        glDisable(GL_TEXTURE_2D);
+        glDisable(GL_POLYGON_SMOOTH);
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_ONE_MINUS_DST_COLOR, GL_ZERO);
+        glRecti(x, y, x + fontWidth, y + fontHeight);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    }
 
     glfwSwapBuffers(window);
 }
 
+/* Frames are only rendered if something has changed, and no more often than
+ * the max_fps setting allows; a frame which is too soon is left pending, and
+ * dpy_getchar() renders it when its time comes. */
+
+void dpy_sync(void)
+{
+    pendingRedraw = false;
+    if (!screenDirty)
+        return;
+
+    double now = glfwGetTime();
+    if ((now - lastFrameTime) < minFrameInterval)
+    {
+        syncPending = true;
+        return;
+    }
+
+    render();
+    lastFrameTime = now;
+    screenDirty = false;
+    syncPending = false;
+}
+
 void dpy_setattr(int andmask, int ormask)
 {
     currentAttr &= andmask;
@@ -402,6 +652,7 @@ void dpy_writechar(int x, int y, uni_t c)
         return;
 
     cell_t* p = &screen[x + y * screenWidth];
+    screenDirty = true;
     p->c = c;
     p->attr = currentAttr;
     p->fg = currentFg;
@@ -427,6 +678,7 @@ void dpy_cleararea(int x1, int y1, int x2, int y2)
 
     clipBounds(&x1, &y1);
     clipBounds(&x2, &y2);
+    screenDirty = true;
 
     for (int y = y1; y <= y2; y++)
     {
@@ -442,13 +694,50 @@ void dpy_cleararea(int x1, int y1, int x2, int y2)
     }
 }
 
+void dpy_scrollarea(int y1, int y2, int delta)
+{
+    if (!screen)
+        return;
+
+    y1 = std::max(y1, 0);
+    y2 = std::min(y2, screenHeight - 1);
+    int rows = y2 - y1 + 1;
+    if (rows <= abs(delta))
+    {
+        dpy_cleararea(0, y1, screenWidth - 1, y2);
+        return;
+    }
+
+    cell_t* top = &screen[y1 * screenWidth];
+    size_t moved = (rows - abs(delta)) * screenWidth;
+    if (delta > 0)
+    {
+        memmove(top, top + delta * screenWidth, moved * sizeof(cell_t));
+        dpy_cleararea(0, y2 - delta + 1, screenWidth - 1, y2);
+    }
+    else if (delta < 0)
+    {
+        memmove(top - delta * screenWidth, top, moved * sizeof(cell_t));
+        dpy_cleararea(0, y1, screenWidth - 1, y1 - delta - 1);
+    }
+}
+
 void dpy_setcursor(int x, int y, bool shown)
 {
+    if ((x != cursorx) || (y != cursory) || (shown != cursorShown))
+        screenDirty = true;
     cursorx = x;
     cursory = y;
     cursorShown = shown;
 }
 
+/* The cursor's drawn here, so the scripts blink it. */
+
+bool dpy_setcursorblink(bool blink)
+{
+    return false;
+}
+
 uni_t dpy_getchar(double timeout)
 {
     double endTime = glfwGetTime() + timeout;
@@ -461,18 +750,47 @@ uni_t dpy_getchar(double timeout)
             return c;
         }
 
-        if (timeout == -1)
-            glfwWaitEvents();
-        else
+        double now = glfwGetTime();
+        double frameTime = lastFrameTime + minFrameInterval;
+        if (syncPending && (now >= frameTime))
+        {
+            dpy_sync();
+            continue;
+        }
+        if (exposed)
         {
-            double waitTime = endTime - glfwGetTime();
-            if (waitTime < 0)
+            render();
+            continue;
+        }
+
+        if ((timeout != -1) && (now >= endTime))
+        {
+            /* Pick up anything which has already arrived before giving up
+             * (this is what makes a zero timeout a poll). */
+            glfwPollEvents();
+            if (keyboardQueue.empty())
                 return -KEY_TIMEOUT;
-            glfwWaitEventsTimeout(waitTime);
+            continue;
         }
+
+        /* Wait for input, the timeout or the next frame, whichever is
+         * first. */
+
+        double waitUntil = (timeout == -1) ? HUGE_VAL : endTime;
+        if (syncPending)
+            waitUntil = std::min(waitUntil, frameTime);
+        if (waitUntil == HUGE_VAL)
+            glfwWaitEvents();
+        else
+            glfwWaitEventsTimeout(waitUntil - now);
     }
 }
 
+double dpy_getkeytime(void)
+{
+    return 0;
+}
+
 std::string dpy_getkeyname(uni_t k)
 {
     static char buffer[32];
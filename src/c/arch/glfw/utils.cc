@@ -18,3 +18,12 @@ const char* get_svar(const char* name)
     lua_getfield(L, -1, name);
     return lua_tostring(L, -1);
 }
+
+bool get_bvar(const char* name)
+{
+	lua_checkstack(L, 10);
+    lua_getglobal(L, "GlobalSettings");
+    lua_getfield(L, -1, "gui");
+    lua_getfield(L, -1, name);
+    return lua_toboolean(L, -1);
+}
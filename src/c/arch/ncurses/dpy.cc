@@ -8,8 +8,18 @@
 #include <curses.h>
 #include <wctype.h>
 #include <sys/time.h>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
 #include <time.h>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
 #include <fmt/format.h>
+#include <unordered_map>
+#include <algorithm>
+#include <atomic>
+#include <thread>
 
 #define KEY_TIMEOUT (KEY_MAX + 1)
 #define FIRST_COLOUR_ID 1
@@ -20,27 +30,180 @@ static bool use_italics = false;
 #endif
 
 static bool use_colours = false;
+static bool use_direct = false; /* colour numbers are 24-bit RGB values */
+static bool use_sync = false;   /* frames can be bracketed with DEC mode 2026 */
+static char* cursor_style = nullptr; /* Ss, for DECSCUSR, if there is one */
 static int currentAttr = 0;
-static short currentPair = 0;
+static int cursorBlink = 1;      /* what's wanted */
+static int cursorBlinkSent = -1; /* what the terminal was last told */
+static int currentPair = 0;
 
 typedef struct
 {
-    uint8_t fg;
-    uint8_t bg;
+    int fg;
+    int bg;
 } pair_t;
 
+/* Colour pairs are looked up by the exact pair of colours asked for, so the
+ * common case of setting a colour which has been used before is a single
+ * hash lookup. */
+
+struct colourkey_t
+{
+    colour_t fg;
+    colour_t bg;
+
+    bool operator==(const colourkey_t& other) const
+    {
+        return (fg.r == other.fg.r) && (fg.g == other.fg.g) &&
+               (fg.b == other.fg.b) && (bg.r == other.bg.r) &&
+               (bg.g == other.bg.g) && (bg.b == other.bg.b);
+    }
+};
+
+struct colourkeyhash_t
+{
+    size_t operator()(const colourkey_t& k) const
+    {
+        std::hash<float> h;
+        size_t r = 0;
+        for (float f : {k.fg.r, k.fg.g, k.fg.b, k.bg.r, k.bg.g, k.bg.b})
+            r = (r * 31) ^ h(f);
+        return r;
+    }
+};
+
 static std::vector<colour_t> colours;
 static std::vector<pair_t> colourPairs;
+static std::unordered_map<colourkey_t, int, colourkeyhash_t> pairCache;
 
-void dpy_init(const char* argv[]) {}
+/* The attributes last handed to curses, so that redundant attr_set() calls
+ * (there's one per word) can be skipped. */
 
-void dpy_start(void)
+static attr_t cursesAttr = 0;
+static int cursesPair = 0;
+
+/* Consecutive characters written left to right in the same style are
+ * collected here and written to curses as one string. */
+
+static std::string pendingText;
+static int pendingX;
+static int pendingY;
+static int pendingEndX;
+
+static void flush_pending()
 {
-    initscr();
+    if (pendingText.empty())
+        return;
+
+    mvaddstr(pendingY, pendingX, pendingText.c_str());
+    pendingText.clear();
+}
+
+/* Curses owns the terminal's input and isn't thread safe, so keys are read
+ * on the main thread; but a thread watches the terminal (without reading
+ * it), and notes when input turns up which nothing has asked for yet. This
+ * is when the key dpy_getchar() next returns arrived, however long the
+ * scripts then took to get round to it. */
+
+static std::thread inputThread;
+static std::atomic<bool> inputRunning;
+static int inputWakeup[2] = {-1, -1}; /* written to to stop the watcher */
+static std::atomic<double> inputArrived; /* or zero, if nothing is waiting */
+static double keyTime;
+
+/* An editing session (see wg.startsession()) runs in the background with no
+ * terminal of its own. Clients (attachsession() in server.cc) lend it
+ * theirs, which it draws on directly through a curses screen of its own,
+ * so the client only has to pass on changes of size. While nothing's
+ * attached, drawing does nothing and the screen keeps its last size, so
+ * everything laid out for it is still valid when the next client attaches.
+ * A new client takes over from one which is already attached. */
+
+static std::string sessionPath;
+static int sessionListener = -1;
+static int sessionClient = -1;
+static SCREEN* sessionScreen = nullptr;
+static FILE* sessionIn = nullptr;
+static FILE* sessionOut = nullptr;
+static int terminalIn = STDIN_FILENO;
+static bool attached = true;
+static int detachedWidth = 80;
+static int detachedHeight = 25;
+
+static double timenow(void)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (double)tv.tv_sec + (double)tv.tv_usec / 1000000.0;
+}
 
-    use_colours = has_colors() && can_change_color();
+static void watch_input(void)
+{
+    while (inputRunning)
+    {
+        if (inputArrived)
+        {
+            /* Wait for it to be read. */
+            usleep(1000);
+            continue;
+        }
+
+        struct pollfd pfds[2] = {
+            {terminalIn,     POLLIN, 0},
+            {inputWakeup[0], POLLIN, 0}
+        };
+        /* (Without a pipe to be woken up by, it has to look every so
+         * often to see if it's time to stop.) */
+        int delay = (inputWakeup[0] == -1) ? 10 : -1;
+        if ((poll(pfds, 2, delay) > 0) && (pfds[0].revents & POLLIN))
+            inputArrived = timenow();
+    }
+}
+
+/* Sends a control sequence straight to the terminal, around curses. */
+
+static void sendcontrol(const char* s)
+{
+    FILE* out = sessionScreen ? sessionOut : stdout;
+    fputs(s, out);
+    fflush(out);
+}
+
+/* Sets up the current curses screen, however it was created. */
+
+static void setupterminal(void)
+{
+    /* Direct-colour terminals (ones whose terminfo has the RGB flag, such
+     * as xterm-direct) take colours as RGB values, so there's no palette to
+     * fill; otherwise the palette has to be redefinable. Either way it's
+     * pairs which run out, so each colour only costs one on its own. */
+
+#if defined NCURSES_EXT_COLORS
+    use_direct = has_colors() && (tigetflag("RGB") > 0);
+#endif
+    use_colours = has_colors() && (use_direct || can_change_color());
     if (use_colours)
         start_color();
+    use_direct = use_direct && (COLORS >= 0x1000000);
+    use_colours = use_colours && (use_direct || can_change_color());
+
+    /* The Sync capability says the terminal understands synchronised
+     * updates, where it holds off drawing until the whole frame's arrived;
+     * that stops a remote screen being seen half redrawn. */
+
+    const char* sync = tigetstr("Sync");
+    use_sync = sync && (sync != (const char*)-1);
+
+    /* Terminals with Ss can be told to blink the cursor themselves, which
+     * saves waking up to do it (and, remotely, sending anything while
+     * nothing's happening). Those without it blink it or not as they're
+     * set up to, as the cursor can't be hidden here anyway. */
+
+    cursor_style = tigetstr("Ss");
+    if (cursor_style == (char*)-1)
+        cursor_style = nullptr;
+    cursorBlinkSent = -1;
 
     raw();
     noecho();
@@ -58,13 +221,259 @@ void dpy_start(void)
 #if defined A_ITALIC
     use_italics = !!tigetstr("sitm");
 #endif
+
+    inputArrived = 0;
+    inputRunning = true;
+    if (pipe(inputWakeup) != 0)
+        inputWakeup[0] = inputWakeup[1] = -1;
+    inputThread = std::thread(watch_input);
 }
 
-void dpy_shutdown(void)
+static void closeterminal(void)
 {
+    inputRunning = false;
+    if (inputWakeup[1] != -1)
+        (void)!write(inputWakeup[1], "", 1);
+    inputThread.join();
+    if (inputWakeup[0] != -1)
+    {
+        close(inputWakeup[0]);
+        close(inputWakeup[1]);
+        inputWakeup[0] = inputWakeup[1] = -1;
+    }
+
+    /* Put the cursor back the way the terminal had it. */
+
+    if (cursor_style && (cursorBlinkSent != -1))
+    {
+        const char* reset = tigetstr("Se");
+        if (reset && (reset != (const char*)-1))
+            sendcontrol(reset);
+        else
+            sendcontrol(tparm(cursor_style, 0));
+    }
+
+    flush_pending();
 	colours.clear();
 	colourPairs.clear();
+	pairCache.clear();
+    cursesAttr = 0;
+    cursesPair = 0;
+    currentPair = 0;
+    detachedWidth = COLS;
+    detachedHeight = LINES;
     endwin();
+
+    if (sessionScreen)
+    {
+        delscreen(sessionScreen);
+        fclose(sessionIn);
+        fclose(sessionOut);
+        sessionScreen = nullptr;
+        sessionIn = sessionOut = nullptr;
+        terminalIn = STDIN_FILENO;
+    }
+}
+
+static void detachclient(void)
+{
+    closeterminal();
+    attached = false;
+    sendstatus(sessionClient, 0);
+    sessionClient = -1;
+}
+
+/* Takes over the terminal of a client which has just connected. Only the
+ * session's own user may attach, as whoever does can read and type into
+ * its documents. */
+
+static bool attachclient(int conn)
+{
+    std::vector<std::string> strings;
+    int fds[3];
+    if (!ispeerowner(conn) || !receiverequest(conn, strings, fds))
+    {
+        close(conn);
+        return false;
+    }
+    close(fds[2]);
+
+    FILE* in = fdopen(fds[0], "r");
+    FILE* out = fdopen(fds[1], "w");
+    SCREEN* screen = nullptr;
+    if (in && out && (strings.size() == 3) && (strings[1] == "attach"))
+        screen = newterm(strings[2].c_str(), out, in);
+    if (!screen)
+    {
+        in ? fclose(in) : close(fds[0]);
+        out ? fclose(out) : close(fds[1]);
+        sendstatus(conn, 1);
+        return false;
+    }
+
+    if (attached)
+        detachclient();
+    set_term(screen);
+    sessionScreen = screen;
+    sessionIn = in;
+    sessionOut = out;
+    sessionClient = conn;
+    terminalIn = fds[0];
+    attached = true;
+    setupterminal();
+    return true;
+}
+
+/* Waits for up to delay ms (or forever, if -1) for something to happen to
+ * the session. Returns 0 if the terminal has input for curses to read;
+ * otherwise, a key. */
+
+static uni_t waitforsession(int delay)
+{
+    struct pollfd fds[3] = {
+        {sessionListener,                   POLLIN, 0},
+        {attached ? sessionClient : -1, POLLIN, 0},
+        {attached ? terminalIn : -1,    POLLIN, 0}
+    };
+    if (poll(fds, 3, delay) <= 0)
+        return -KEY_TIMEOUT;
+
+    if (fds[0].revents)
+    {
+        int conn = accept(sessionListener, nullptr, nullptr);
+        if ((conn != -1) && attachclient(conn))
+            return -KEY_RESIZE;
+        return -KEY_TIMEOUT;
+    }
+
+    if (fds[1].revents)
+    {
+        /* Anything from the client means its terminal has changed size. */
+        char buffer[64];
+        if (read(sessionClient, buffer, sizeof(buffer)) <= 0)
+        {
+            detachclient();
+            return -KEY_TIMEOUT;
+        }
+
+        struct winsize ws;
+        if ((ioctl(fileno(sessionOut), TIOCGWINSZ, &ws) == 0) && ws.ws_row &&
+            ws.ws_col)
+            resize_term(ws.ws_row, ws.ws_col);
+        return -KEY_RESIZE;
+    }
+
+    if (fds[2].revents & (POLLHUP | POLLERR | POLLNVAL))
+    {
+        /* The terminal's gone, probably along with the connection. */
+        detachclient();
+        return -KEY_TIMEOUT;
+    }
+    return 0;
+}
+
+static void unlinksession(void)
+{
+    unlink(sessionPath.c_str());
+}
+
+/* wg.startsession(socket) makes this process an editing session listening
+ * on socket, running in the background, and turns the original process
+ * into its first client. If there's already a session on socket, this
+ * process just attaches to it instead. The original process never returns;
+ * in the session, this returns true, or on failure nil and an error. */
+
+static int startsession_cb(lua_State* L)
+{
+    const char* path = luaL_checkstring(L, 1);
+    if (issocketlive(path))
+        exit(attachsession(path));
+
+    int listener = listenonsocket(path);
+    if (listener == -1)
+    {
+        lua_pushnil(L);
+        lua_pushstring(L, strerror(errno));
+        return 2;
+    }
+
+    fflush(nullptr);
+    pid_t pid = fork();
+    if (pid == -1)
+    {
+        lua_pushnil(L);
+        lua_pushstring(L, strerror(errno));
+        close(listener);
+        return 2;
+    }
+    if (pid != 0)
+    {
+        close(listener);
+        exit(attachsession(path));
+    }
+
+    setsid();
+    int null = open("/dev/null", O_RDWR);
+    for (int fd = 0; fd < 3; fd++)
+        dup2(null, fd);
+    if (null > 2)
+        close(null);
+    signal(SIGHUP, SIG_IGN);
+    signal(SIGPIPE, SIG_IGN);
+
+    sessionPath = path;
+    sessionListener = listener;
+    atexit(unlinksession);
+    lua_pushboolean(L, true);
+    return 1;
+}
+
+/* Returns false if this isn't a session, or nothing is attached. */
+
+static int detachsession_cb(lua_State* L)
+{
+    bool ok = (sessionListener != -1) && attached;
+    if (ok)
+        detachclient();
+    lua_pushboolean(L, ok);
+    return 1;
+}
+
+void dpy_init(const char* argv[])
+{
+    const static luaL_Reg funcs[] = {
+        {"startsession",  startsession_cb },
+        {"detachsession", detachsession_cb},
+        {NULL,            NULL            }
+    };
+
+    luaL_register(L, "wg", funcs);
+    lua_pop(L, 1);
+}
+
+void dpy_start(void)
+{
+    if (sessionListener != -1)
+    {
+        /* The first client will be along shortly. */
+        attached = false;
+        return;
+    }
+
+    initscr();
+    setupterminal();
+}
+
+void dpy_shutdown(void)
+{
+    if (!attached)
+        return;
+    closeterminal();
+    if (sessionClient != -1)
+    {
+        close(sessionClient);
+        sessionClient = -1;
+    }
 }
 
 void dpy_clearscreen(void)
@@ -76,6 +485,12 @@ void dpy_clearscreen(void)
 
 void dpy_getscreensize(int* x, int* y)
 {
+    if (!attached)
+    {
+        *x = detachedWidth;
+        *y = detachedHeight;
+        return;
+    }
     getmaxyx(stdscr, *y, *x);
 }
 
@@ -87,14 +502,37 @@ void dpy_getmouse(uni_t key, int* x, int* y, bool* p)
 
 void dpy_sync(void)
 {
-    refresh();
+    if (!attached)
+        return;
+    flush_pending();
+    wnoutrefresh(stdscr);
+    if (cursor_style && (cursorBlinkSent != cursorBlink))
+    {
+        /* Blinking block, or steady block. */
+        sendcontrol(tparm(cursor_style, cursorBlink ? 1 : 2));
+        cursorBlinkSent = cursorBlink;
+    }
+    if (use_sync)
+        sendcontrol("\033[?2026h");
+    doupdate();
+    if (use_sync)
+        sendcontrol("\033[?2026l");
 }
 
 void dpy_setcursor(int x, int y, bool shown)
 {
+    if (!attached)
+        return;
+    flush_pending();
     move(y, x);
 }
 
+bool dpy_setcursorblink(bool blink)
+{
+    cursorBlink = blink;
+    return true;
+}
+
 static void update_attrs()
 {
     attr_t cattr = 0;
@@ -120,10 +558,18 @@ static void update_attrs()
     if (currentAttr & DPY_REVERSE)
         cattr |= WA_REVERSE;
 
-    if (use_colours)
-        attr_set(cattr, currentPair, NULL);
-    else
-        attr_set(cattr, 0, NULL);
+    short pair = use_colours ? currentPair : 0;
+    if (!attached || ((cattr == cursesAttr) && (pair == cursesPair)))
+        return;
+
+    flush_pending();
+#if defined NCURSES_EXT_COLORS
+    attr_set(cattr, (short)pair, &pair);
+#else
+    attr_set(cattr, pair, NULL);
+#endif
+    cursesAttr = cattr;
+    cursesPair = pair;
 }
 
 void dpy_setattr(int andmask, int ormask)
@@ -134,16 +580,25 @@ void dpy_setattr(int andmask, int ormask)
     update_attrs();
 }
 
-static uint8_t lookup_colour(const colour_t* colour)
+static int lookup_colour(const colour_t* colour)
 {
-    for (uint8_t i = 0; i < colours.size(); i++)
+    if (use_direct)
+    {
+        auto c = [](float f)
+        {
+            return std::clamp((int)(f * 255.0 + 0.5), 0, 255);
+        };
+        return (c(colour->r) << 16) | (c(colour->g) << 8) | c(colour->b);
+    }
+
+    for (int i = 0; i < colours.size(); i++)
     {
         if ((colours[i].r == colour->r) && (colours[i].g == colour->g) &&
             (colours[i].b == colour->b))
             return i + FIRST_COLOUR_ID;
     }
 
-    uint8_t id = colours.size() + FIRST_COLOUR_ID;
+    int id = colours.size() + FIRST_COLOUR_ID;
 	colours.emplace_back(*colour);
     init_color(id, colour->r * 1000.0, colour->g * 1000.0, colour->b * 1000.0);
     return id;
@@ -151,11 +606,20 @@ static uint8_t lookup_colour(const colour_t* colour)
 
 void dpy_setcolour(const colour_t* fg, const colour_t* bg)
 {
-    if (!use_colours)
+    if (!attached || !use_colours)
+        return;
+
+    colourkey_t key = {*fg, *bg};
+    auto it = pairCache.find(key);
+    if (it != pairCache.end())
+    {
+        currentPair = it->second;
+        update_attrs();
         return;
+    }
 
-    uint8_t fgc = lookup_colour(fg);
-    uint8_t bgc = lookup_colour(bg);
+    int fgc = lookup_colour(fg);
+    int bgc = lookup_colour(bg);
 
     for (int i = 0; i < colourPairs.size(); i++)
     {
@@ -163,6 +627,7 @@ void dpy_setcolour(const colour_t* fg, const colour_t* bg)
         if ((p->fg == fgc) && (p->bg == bgc))
         {
             currentPair = FIRST_PAIR_ID + i;
+            pairCache[key] = currentPair;
             update_attrs();
             return;
         }
@@ -170,28 +635,115 @@ void dpy_setcolour(const colour_t* fg, const colour_t* bg)
 
     currentPair = colourPairs.size() + FIRST_PAIR_ID;
 	colourPairs.emplace_back(pair_t{fgc, bgc});
+    pairCache[key] = currentPair;
 
+#if defined NCURSES_EXT_COLORS
+    init_extended_pair(currentPair, fgc, bgc);
+#else
     init_pair(currentPair, fgc, bgc);
+#endif
     update_attrs();
 }
 
 void dpy_writechar(int x, int y, uni_t c)
 {
+    if (!attached)
+        return;
+
     char buffer[8];
     char* p = buffer;
     writeu8(&p, c);
     *p = '\0';
 
-    mvaddstr(y, x, buffer);
+    /* Only ordinary spacing characters which fit on the line are batched
+     * (curses would wrap a string onto the next line); anything else goes
+     * straight out where it was asked for. */
+
+    int width = emu_wcwidth(c);
+    if ((width <= 0) || (x < 0) || ((x + width) > COLS))
+    {
+        flush_pending();
+        mvaddstr(y, x, buffer);
+        return;
+    }
+
+    if (pendingText.empty() || (y != pendingY) || (x != pendingEndX))
+    {
+        flush_pending();
+        pendingX = x;
+        pendingY = y;
+        pendingEndX = x;
+    }
+    pendingText += buffer;
+    pendingEndX += width;
 }
 
 void dpy_cleararea(int x1, int y1, int x2, int y2)
 {
-    char cc = ' ';
+    if (!attached)
+        return;
+    flush_pending();
+    x2 = std::min(x2, COLS - 1);
+    if (x2 < x1)
+        return;
 
+    std::string spaces(x2 - x1 + 1, ' ');
     for (int y = y1; y <= y2; y++)
-        for (int x = x1; x <= x2; x++)
-            mvaddnstr(y, x, &cc, 1);
+        mvaddnstr(y, x1, spaces.data(), spaces.size());
+}
+
+void dpy_scrollarea(int y1, int y2, int delta)
+{
+    if (!attached)
+        return;
+    flush_pending();
+    y1 = std::max(y1, 0);
+    y2 = std::min(y2, LINES - 1);
+    if ((y2 - y1 + 1) <= abs(delta))
+    {
+        dpy_cleararea(0, y1, COLS - 1, y2);
+        return;
+    }
+
+    setscrreg(y1, y2);
+    scrollok(stdscr, TRUE);
+    scrl(delta);
+    scrollok(stdscr, FALSE);
+    setscrreg(0, LINES - 1);
+}
+
+/* While dragging, the terminal reports every cell the pointer crosses, and
+ * each report moves the cursor. Any more which have already arrived replace
+ * this one, so only the latest is delivered; anything else is put back. */
+
+static void skip_queued_motion(MEVENT& event)
+{
+    timeout(0);
+    for (;;)
+    {
+        wint_t c;
+        int r = get_wch(&c);
+        if (r == ERR)
+            return;
+
+        if ((r == KEY_CODE_YES) && (c == KEY_MOUSE))
+        {
+            MEVENT next;
+            if (getmouse(&next) != OK)
+                return;
+            if (next.bstate == REPORT_MOUSE_POSITION)
+            {
+                event = next;
+                continue;
+            }
+            ungetmouse(&next);
+        }
+        else if (r == KEY_CODE_YES)
+            ungetch(c);
+        else
+            unget_wch(c);
+        return;
+    }
 }
 
 static int handle_mouse(void)
@@ -205,6 +757,8 @@ static int handle_mouse(void)
     switch (event.bstate)
     {
         case REPORT_MOUSE_POSITION:
+            if (p)
+                skip_queued_motion(event);
             mx = event.x;
             my = event.y;
             if (!p)
@@ -243,7 +797,7 @@ static int handle_mouse(void)
     return encode_mouse_event(mx, my, p);
 }
 
-uni_t dpy_getchar(double timeout)
+static uni_t read_key(double timeout)
 {
     struct timeval then;
     gettimeofday(&then, NULL);
@@ -251,7 +805,7 @@ uni_t dpy_getchar(double timeout)
 
     for (;;)
     {
-
+        int delay = -1;
         if (timeout != -1)
         {
             struct timeval now;
@@ -259,8 +813,9 @@ uni_t dpy_getchar(double timeout)
             uint64_t nowms =
                 (now.tv_usec / 1000) + ((uint64_t)now.tv_sec * 1000);
 
-            int delay = ((uint64_t)(timeout * 1000)) + nowms - thenms;
-            if (delay <= 0)
+            /* A delay of zero makes get_wch() a poll. */
+            delay = (int)(timeout * 1000) - (int)(nowms - thenms);
+            if (delay < 0)
                 return -KEY_TIMEOUT;
 
             timeout(delay);
@@ -268,6 +823,13 @@ uni_t dpy_getchar(double timeout)
         else
             timeout(-1);
 
+        if (sessionListener != -1)
+        {
+            uni_t k = waitforsession(delay);
+            if (k)
+                return k;
+        }
+
         wint_t c;
         int r = get_wch(&c);
 
@@ -285,6 +847,31 @@ uni_t dpy_getchar(double timeout)
     }
 }
 
+uni_t dpy_getchar(double timeout)
+{
+    /* If nothing was noticed, either curses had already read the key along
+     * with the last one, or it turned up while we were waiting for it (and
+     * so before the watcher could look). */
+
+    double start = timenow();
+    uni_t c = read_key(timeout);
+    if (c != -KEY_TIMEOUT)
+    {
+        double t = inputArrived.exchange(0);
+        double end = timenow();
+        if (t)
+            keyTime = t;
+        else if ((end - start) > 0.001)
+            keyTime = end;
+    }
+    return c;
+}
+
+double dpy_getkeytime(void)
+{
+    return keyTime;
+}
+
 static const char* ncurses_prefix_to_name(const char* s)
 {
     if (strcmp(s, "KDC") == 0)
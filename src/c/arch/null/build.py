@@ -0,0 +1,11 @@
+from build.c import cxxlibrary
+
+cxxlibrary(
+    name="null",
+    srcs=["./dpy.cc"],
+    deps=[
+        "src/c+globals",
+        "src/c/luau-em",
+        "third_party/luau",
+    ],
+)
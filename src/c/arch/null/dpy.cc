@@ -0,0 +1,324 @@
+/* © 2026 David Given.
+ * WordGrinder is licensed under the MIT open source license. See the COPYING
+ * file in this distribution for the full text.
+ */
+
+/* A display which isn't there: the screen is an array of cells in memory,
+ * and the only input is what scripts queue up. It counts everything done to
+ * it, so that redraw costs can be measured (and checked) without a terminal
+ * or a GL context. The screen size comes from $COLUMNS and $LINES.
+ *
+ * Scripts get at it through the global 'headless' table. */
+
+#include "globals.h"
+#include <string.h>
+#include <algorithm>
+#include <deque>
+#include <vector>
+#include <fmt/format.h>
+
+typedef struct
+{
+    uni_t c;
+    int attr;
+} cell_t;
+
+static int screenWidth = 80;
+static int screenHeight = 25;
+static std::vector<cell_t> screen;
+static int currentAttr = 0;
+static int cursorX = 0;
+static int cursorY = 0;
+static std::deque<uni_t> keyboardQueue;
+
+/* Named keys (like KEY_RETURN) are queued as a private key code carrying an
+ * index into this list, which dpy_getkeyname() turns back into the name. */
+enum
+{
+    KEY_NAMED = 9 << 24
+};
+static std::vector<std::string> keyNames;
+
+static struct
+{
+    unsigned writes;
+    unsigned attrs;
+    unsigned colours;
+    unsigned clears;
+    unsigned scrolls;
+    unsigned syncs;
+} stats;
+
+static int getenvint(const char* name, int defaultvalue)
+{
+    const char* s = getenv(name);
+    int i = s ? atoi(s) : 0;
+    return (i > 0) ? i : defaultvalue;
+}
+
+/* Returns a table of counters of everything done since the last call to
+ * resetstats(). */
+
+static int getstats_cb(lua_State* L)
+{
+    lua_newtable(L);
+    lua_pushnumber(L, stats.writes);
+    lua_setfield(L, -2, "writes");
+    lua_pushnumber(L, stats.attrs);
+    lua_setfield(L, -2, "attrs");
+    lua_pushnumber(L, stats.colours);
+    lua_setfield(L, -2, "colours");
+    lua_pushnumber(L, stats.clears);
+    lua_setfield(L, -2, "clears");
+    lua_pushnumber(L, stats.scrolls);
+    lua_setfield(L, -2, "scrolls");
+    lua_pushnumber(L, stats.syncs);
+    lua_setfield(L, -2, "syncs");
+    return 1;
+}
+
+static int resetstats_cb(lua_State* L)
+{
+    memset(&stats, 0, sizeof(stats));
+    return 0;
+}
+
+/* Returns the text of a screen row (zero based), as UTF-8. */
+
+static int getrow_cb(lua_State* L)
+{
+    int y = forceinteger(L, 1);
+    if ((y < 0) || (y >= screenHeight) || screen.empty())
+        return 0;
+
+    std::string s;
+    for (int x = 0; x < screenWidth; x++)
+    {
+        char buffer[8];
+        char* p = buffer;
+        writeu8(&p, screen[y * screenWidth + x].c);
+        s.append(buffer, p - buffer);
+    }
+    lua_pushlstring(L, s.data(), s.size());
+    return 1;
+}
+
+/* Returns the attributes of a screen cell. */
+
+static int getattr_cb(lua_State* L)
+{
+    int x = forceinteger(L, 1);
+    int y = forceinteger(L, 2);
+    if ((x < 0) || (x >= screenWidth) || (y < 0) || (y >= screenHeight) ||
+        screen.empty())
+        return 0;
+
+    lua_pushnumber(L, screen[y * screenWidth + x].attr);
+    return 1;
+}
+
+static int getcursor_cb(lua_State* L)
+{
+    lua_pushnumber(L, cursorX);
+    lua_pushnumber(L, cursorY);
+    return 2;
+}
+
+/* Queues up the characters of a string as keypresses. */
+
+static int queuekeys_cb(lua_State* L)
+{
+    size_t size;
+    const char* s = luaL_checklstring(L, 1, &size);
+    const char* send = s + size;
+    while (s < send)
+        keyboardQueue.push_back(readu8(&s));
+    return 0;
+}
+
+/* Queues up a keypress by name, as the event loop sees it (e.g. "KEY_DOWN"). */
+
+static int queuekey_cb(lua_State* L)
+{
+    const char* name = luaL_checkstring(L, 1);
+    auto i = std::find(keyNames.begin(), keyNames.end(), name);
+    if (i == keyNames.end())
+        i = keyNames.insert(i, name);
+    keyboardQueue.push_back(-(KEY_NAMED | (i - keyNames.begin())));
+    return 0;
+}
+
+/* Queues up a mouse event at a screen position, with the button up or down. */
+
+static int queuemouse_cb(lua_State* L)
+{
+    int x = forceinteger(L, 1);
+    int y = forceinteger(L, 2);
+    bool b = lua_toboolean(L, 3);
+    keyboardQueue.push_back(-encode_mouse_event(x, y, b));
+    return 0;
+}
+
+void dpy_init(const char* argv[])
+{
+    const static luaL_Reg funcs[] = {
+        {"getstats",   getstats_cb  },
+        {"resetstats", resetstats_cb},
+        {"getrow",     getrow_cb    },
+        {"getattr",    getattr_cb   },
+        {"getcursor",  getcursor_cb },
+        {"queuekey",   queuekey_cb  },
+        {"queuekeys",  queuekeys_cb },
+        {"queuemouse", queuemouse_cb},
+        {NULL,         NULL         }
+    };
+
+    luaL_register(L, "headless", funcs);
+    lua_pop(L, 1);
+}
+
+void dpy_start(void)
+{
+    screenWidth = getenvint("COLUMNS", 80);
+    screenHeight = getenvint("LINES", 25);
+    screen.assign(screenWidth * screenHeight, cell_t{' ', 0});
+    keyboardQueue.push_back(-KEY_RESIZE);
+}
+
+void dpy_shutdown(void)
+{
+    screen.clear();
+}
+
+void dpy_clearscreen(void)
+{
+    dpy_cleararea(0, 0, screenWidth - 1, screenHeight - 1);
+}
+
+void dpy_getscreensize(int* x, int* y)
+{
+    *x = screenWidth;
+    *y = screenHeight;
+}
+
+void dpy_getmouse(uni_t key, int* x, int* y, bool* p)
+{
+    *x = *y = 0;
+    *p = false;
+}
+
+void dpy_sync(void)
+{
+    stats.syncs++;
+}
+
+void dpy_setcursor(int x, int y, bool shown)
+{
+    cursorX = x;
+    cursorY = y;
+}
+
+bool dpy_setcursorblink(bool blink)
+{
+    return true;
+}
+
+void dpy_setattr(int andmask, int ormask)
+{
+    currentAttr &= andmask;
+    currentAttr |= ormask;
+    stats.attrs++;
+}
+
+void dpy_setcolour(const colour_t* fg, const colour_t* bg)
+{
+    stats.colours++;
+}
+
+void dpy_writechar(int x, int y, uni_t c)
+{
+    stats.writes++;
+    if ((x < 0) || (x >= screenWidth) || (y < 0) || (y >= screenHeight) ||
+        screen.empty())
+        return;
+
+    screen[y * screenWidth + x] = cell_t{c, currentAttr};
+}
+
+void dpy_cleararea(int x1, int y1, int x2, int y2)
+{
+    stats.clears++;
+    if (screen.empty())
+        return;
+
+    x1 = std::max(x1, 0);
+    y1 = std::max(y1, 0);
+    x2 = std::min(x2, screenWidth - 1);
+    y2 = std::min(y2, screenHeight - 1);
+    for (int y = y1; y <= y2; y++)
+        for (int x = x1; x <= x2; x++)
+            screen[y * screenWidth + x] = cell_t{' ', currentAttr};
+}
+
+void dpy_scrollarea(int y1, int y2, int delta)
+{
+    stats.scrolls++;
+    if (screen.empty())
+        return;
+
+    y1 = std::max(y1, 0);
+    y2 = std::min(y2, screenHeight - 1);
+    std::vector<cell_t> old(screen);
+    for (int y = y1; y <= y2; y++)
+    {
+        int from = y + delta;
+        for (int x = 0; x < screenWidth; x++)
+            screen[y * screenWidth + x] = ((from >= y1) && (from <= y2))
+                                              ? old[from * screenWidth + x]
+                                              : cell_t{' ', currentAttr};
+    }
+}
+
+/* There's nothing to wait for, so running out of queued keys is always a
+ * timeout (or, if the caller wanted to wait forever, a request to quit). */
+
+uni_t dpy_getchar(double timeout)
+{
+    if (keyboardQueue.empty())
+        return (timeout == -1) ? -KEY_QUIT : -KEY_TIMEOUT;
+
+    uni_t c = keyboardQueue.front();
+    keyboardQueue.pop_front();
+    return c;
+}
+
+/* Queued keys have been waiting since before anything asked for them. */
+
+double dpy_getkeytime(void)
+{
+    return 0;
+}
+
+std::string dpy_getkeyname(uni_t k)
+{
+    if ((-k & KEYM_MOUSE) == KEY_NAMED)
+        return keyNames.at(-k & ~KEYM_MOUSE);
+
+    switch (-k)
+    {
+        case KEY_RESIZE:
+            return "KEY_RESIZE";
+        case KEY_TIMEOUT:
+            return "KEY_TIMEOUT";
+        case KEY_QUIT:
+            return "KEY_QUIT";
+        case KEY_SCROLLUP:
+            return "KEY_SCROLLUP";
+        case KEY_SCROLLDOWN:
+            return "KEY_SCROLLDOWN";
+        case KEY_MENU:
+            return "KEY_MENU";
+    }
+
+    return fmt::format("KEY_UNKNOWN_{}", -k);
+}
@@ -5,6 +5,8 @@
 
 #include "globals.h"
 #include <string.h>
+#include <algorithm>
+#include <deque>
 #include <windows.h>
 #include <fmt/format.h>
 
@@ -22,28 +24,33 @@ static CHAR_INFO defaultChar;
 static int screenWidth;
 static int screenHeight;
 
-static uni_t queued[4];
-static int numqueued = 0;
+/* For each row, the span of columns which have changed since the last
+ * dpy_sync() (left > right means none). */
 
-static uni_t dequeue(void)
+static std::vector<int> dirtyLeft;
+static std::vector<int> dirtyRight;
+
+static void mark_dirty(int y, int x1, int x2)
 {
-    uni_t c = queued[0];
-    queued[0] = queued[1];
-    queued[1] = queued[2];
-    queued[2] = queued[3];
-    numqueued--;
-    return c;
+    dirtyLeft[y] = std::min(dirtyLeft[y], x1);
+    dirtyRight[y] = std::max(dirtyRight[y], x2);
 }
 
-static void queue(uni_t c)
+static void mark_clean(void)
 {
-    if (numqueued >= (sizeof(queued) / sizeof(*queued)))
-        return;
-
-    queued[numqueued] = c;
-    numqueued++;
+    dirtyLeft.assign(screenHeight, screenWidth);
+    dirtyRight.assign(screenHeight, -1);
 }
 
+/* Keys which have been read from the console but not yet returned. All the
+ * input records waiting are read at once, so that a paste (which arrives as
+ * a pair of records per character) doesn't cost a wait and a read for each
+ * one, and the main loop finds the keys already there and deals with them
+ * all before redrawing. */
+
+static std::deque<uni_t> queued;
+static std::vector<INPUT_RECORD> records;
+
 void dpy_init(const char* argv[]) {}
 
 static bool update_buffer_info(void)
@@ -59,6 +66,12 @@ static bool update_buffer_info(void)
 
         delete [] buffer;
         buffer = new CHAR_INFO[screenWidth * screenHeight];
+        for (int i = 0; i < screenWidth * screenHeight; i++)
+            buffer[i] = defaultChar;
+
+        mark_clean();
+        for (int y = 0; y < screenHeight; y++)
+            mark_dirty(y, 0, screenWidth - 1);
 
         return true;
     }
@@ -84,6 +97,7 @@ void dpy_start(void)
     SetConsoleTitleA("WordGrinder");
 
     update_buffer_info();
+    dpy_sync();
 }
 
 void dpy_shutdown(void)
@@ -91,7 +105,8 @@ void dpy_shutdown(void)
     dpy_clearscreen();
     dpy_setcursor(0, 0, true);
     dpy_sync();
-    free(buffer);
+    delete [] buffer;
+    buffer = NULL;
 }
 
 void dpy_clearscreen(void)
@@ -111,21 +126,69 @@ void dpy_getmouse(uni_t key, int* x, int* y, bool* p)
     *p = false;
 }
 
+/* Only the rows which have changed are sent to the console, one call per
+ * run of adjacent changed rows, covering the columns changed in any of
+ * them. */
+
 void dpy_sync(void)
 {
-    COORD buffersize = {screenWidth, screenHeight};
-    COORD buffercoord = {0, 0};
-    SMALL_RECT destregion = csbi.srWindow;
+    COORD buffersize = {(SHORT)screenWidth, (SHORT)screenHeight};
+
+    int y = 0;
+    while (y < screenHeight)
+    {
+        if (dirtyLeft[y] > dirtyRight[y])
+        {
+            y++;
+            continue;
+        }
+
+        int top = y;
+        int left = dirtyLeft[y];
+        int right = dirtyRight[y];
+        while ((y < screenHeight) && (dirtyLeft[y] <= dirtyRight[y]))
+        {
+            left = std::min(left, dirtyLeft[y]);
+            right = std::max(right, dirtyRight[y]);
+            y++;
+        }
+        int bottom = y - 1;
+
+        COORD buffercoord = {(SHORT)left, (SHORT)top};
+        SMALL_RECT destregion = {
+            (SHORT)(csbi.srWindow.Left + left),
+            (SHORT)(csbi.srWindow.Top + top),
+            (SHORT)(csbi.srWindow.Left + right),
+            (SHORT)(csbi.srWindow.Top + bottom),
+        };
+        WriteConsoleOutputW(
+            cout, buffer, buffersize, buffercoord, &destregion);
+    }
 
-    WriteConsoleOutputW(cout, buffer, buffersize, buffercoord, &destregion);
+    mark_clean();
 }
 
+/* This is called before every key is read, so the cursor is only moved if
+ * it has to be. */
+
 void dpy_setcursor(int x, int y, bool shown)
 {
-    COORD coord = {x + csbi.srWindow.Left, y + csbi.srWindow.Top};
+    static COORD current = {-1, -1};
+    COORD coord = {
+        (SHORT)(x + csbi.srWindow.Left), (SHORT)(y + csbi.srWindow.Top)};
+    if ((coord.X == current.X) && (coord.Y == current.Y))
+        return;
+    current = coord;
     SetConsoleCursorPosition(cout, coord);
 }
 
+/* The console's cursor blinks by itself. */
+
+bool dpy_setcursorblink(bool blink)
+{
+    return true;
+}
+
 void dpy_setattr(int andmask, int ormask)
 {
     static int attr = 0;
@@ -158,8 +221,14 @@ void dpy_writechar(int x, int y, uni_t c)
     if ((x < 0) || (y < 0) || (x >= screenWidth) || (y >= screenHeight))
         return;
 
-    buffer[y * screenWidth + x] = defaultChar;
-    buffer[y * screenWidth + x].Char.UnicodeChar = c;
+    CHAR_INFO* p = &buffer[y * screenWidth + x];
+    if ((p->Char.UnicodeChar == c) &&
+        (p->Attributes == defaultChar.Attributes))
+        return;
+
+    *p = defaultChar;
+    p->Char.UnicodeChar = c;
+    mark_dirty(y, x, x);
 }
 
 static void clipBounds(int* x, int* y)
@@ -180,8 +249,49 @@ void dpy_cleararea(int x1, int y1, int x2, int y2)
     clipBounds(&x2, &y2);
 
     for (int y = y1; y <= y2; y++)
+    {
         for (int x = x1; x <= x2; x++)
             buffer[y * screenWidth + x] = defaultChar;
+        mark_dirty(y, x1, x2);
+    }
+}
+
+void dpy_scrollarea(int y1, int y2, int delta)
+{
+    y1 = std::max(y1, 0);
+    y2 = std::min(y2, screenHeight - 1);
+    int rows = y2 - y1 + 1;
+    if (rows <= abs(delta))
+    {
+        dpy_cleararea(0, y1, screenWidth - 1, y2);
+        return;
+    }
+
+    /* Bring the console up to date, and then get it to move what's there
+     * itself; only the exposed rows then need sending. */
+
+    dpy_sync();
+    SMALL_RECT region = {
+        csbi.srWindow.Left,
+        (SHORT)(csbi.srWindow.Top + y1),
+        csbi.srWindow.Right,
+        (SHORT)(csbi.srWindow.Top + y2),
+    };
+    COORD dest = {csbi.srWindow.Left, (SHORT)(csbi.srWindow.Top + y1 - delta)};
+    ScrollConsoleScreenBufferW(cout, &region, &region, dest, &defaultChar);
+
+    CHAR_INFO* top = &buffer[y1 * screenWidth];
+    size_t moved = (rows - abs(delta)) * screenWidth;
+    if (delta > 0)
+    {
+        memmove(top, top + delta * screenWidth, moved * sizeof(CHAR_INFO));
+        dpy_cleararea(0, y2 - delta + 1, screenWidth - 1, y2);
+    }
+    else if (delta < 0)
+    {
+        memmove(top - delta * screenWidth, top, moved * sizeof(CHAR_INFO));
+        dpy_cleararea(0, y1, screenWidth - 1, y1 - delta - 1);
+    }
 }
 
 static bool get_key_code(KEY_EVENT_RECORD* event, uni_t* r1, uni_t* r2)
@@ -261,41 +371,63 @@ static bool get_key_code(KEY_EVENT_RECORD* event, uni_t* r1, uni_t* r2)
     return false;
 }
 
+static void read_input(void)
+{
+    DWORD pending = 0;
+    GetNumberOfConsoleInputEvents(cin, &pending);
+    records.resize(std::max<DWORD>(pending, 1));
+
+    DWORD numread = 0;
+    if (!ReadConsoleInputW(cin, records.data(), records.size(), &numread))
+        return;
+
+    for (DWORD i = 0; i < numread; i++)
+    {
+        if (records[i].EventType != KEY_EVENT)
+            continue;
+
+        KEY_EVENT_RECORD* event = &records[i].Event.KeyEvent;
+        uni_t q1, q2;
+        if (get_key_code(event, &q1, &q2))
+        {
+            for (int n = std::max<int>(event->wRepeatCount, 1); n > 0; n--)
+            {
+                if (q1)
+                    queued.push_back(q1);
+                if (q2)
+                    queued.push_back(q2);
+            }
+        }
+    }
+}
+
 uni_t dpy_getchar(double timeout)
 {
     for (;;)
     {
-        if (numqueued)
-            return dequeue();
+        if (!queued.empty())
+        {
+            uni_t c = queued.front();
+            queued.pop_front();
+            return c;
+        }
 
-        INPUT_RECORD buffer;
-        DWORD numread;
         if (timeout != -1)
             if (WaitForSingleObject(cin, timeout * 1000) == WAIT_TIMEOUT)
                 return -KEY_TIMEOUT;
 
-        ReadConsoleInputW(cin, &buffer, 1, &numread);
-
-        switch (buffer.EventType)
-        {
-            case KEY_EVENT:
-            {
-                uni_t q1, q2;
-                if (get_key_code(&buffer.Event.KeyEvent, &q1, &q2))
-                {
-                    if (q1)
-                        queue(q1);
-                    if (q2)
-                        queue(q2);
-                }
-            }
-        }
+        read_input();
 
         if (update_buffer_info())
-            queue(-KEY_RESIZE);
+            queued.push_back(-KEY_RESIZE);
     }
 }
 
+double dpy_getkeytime(void)
+{
+    return 0;
+}
+
 std::string dpy_getkeyname(uni_t k)
 {
     switch (-k)
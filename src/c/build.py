@@ -5,29 +5,65 @@ from config import FILEFORMAT
 package(name="libcmark", package="libcmark", fallback="third_party/cmark")
 package(name="fmt", package="fmt", fallback="third_party/fmt")
 
+# Everything which doesn't need the interpreter: the text and word primitives,
+# the file format kernels and the document model. It mustn't depend on Luau, so
+# that it can be used (and benchmarked) on its own; see core/wgcore.h.
+cxxlibrary(
+    name="wgcore",
+    srcs=[
+        "./core/document.cc",
+        "./core/fileformat.cc",
+        "./core/text.cc",
+        "./core/wcwidth.cc",
+        "./core/words.cc",
+    ],
+    hdrs={"wgcore.h": "./core/wgcore.h"},
+    caller_ldflags=["-pthread"],
+    deps=["third_party/minizip+zlib"],
+)
+
 cxxlibrary(
     name="globals",
     srcs=[
         "./utils.cc",
+        "./allocator.cc",
         "./cmark.cc",
+        "./dictionary.cc",
+        "./diff.cc",
+        "./dumpfile.cc",
+        "./export.cc",
         "./filesystem.cc",
+        "./heapreport.cc",
+        "./html.cc",
+        "./importer.cc",
         "./main.cc",
+        "./paragraph.cc",
+        "./profiler.cc",
+        "./regex.cc",
         "./screen.cc",
+        "./server.cc",
         "./word.cc",
+        "./workers.cc",
+        "./xml.cc",
         "./zip.cc",
     ],
-    hdrs={"globals.h": "./globals.h", "script_table.h": "src/lua+luacode"},
+    hdrs={
+        "globals.h": "./globals.h",
+        "script_table.h": "src/lua+luacode",
+        "lazy_script_table.h": "src/lua+lazycode",
+    },
     cflags=[
         f"-DFILEFORMAT={FILEFORMAT}",
         "-DCMARK_STATIC_DEFINE",
         "-I.",
     ],
     caller_cflags=f"-DFILEFORMAT={FILEFORMAT}",
+    caller_ldflags=["-pthread"],
     deps=[
+        ".+wgcore",
         ".+fmt",
         ".+libcmark",
         "third_party/luau",
-        "third_party/wcwidth",
         "src/c/luau-em",
         "third_party/minizip",
     ],
@@ -46,10 +82,10 @@ def make_wordgrinder(name, deps=[], cflags=[], ldflags=[]):
         deps=[
             ".+libcmark",
             ".+globals",
+            ".+wgcore",
             "third_party/clip+clip_common",
             "third_party/luau",
             "third_party/minizip",
-            "third_party/wcwidth",
             "src/c/luau-em",
         ]
         + deps,
@@ -61,11 +97,30 @@ make_wordgrinder(
     deps=[
         "src/c/arch/ncurses",
         "third_party/clip+clip_none",
-        "third_party/wcwidth",
     ],
     cflags=["-DFRONTEND=ncurses"],
 )
 
+# As above, but with Luau's native code generator compiling the modules marked
+# --!native as they load.
+make_wordgrinder(
+    "wordgrinder-ncurses-jit",
+    deps=[
+        "src/c/arch/ncurses",
+        "third_party/clip+clip_none",
+    ],
+    cflags=["-DFRONTEND=ncurses", "-DWITH_CODEGEN"],
+)
+
+make_wordgrinder(
+    "wordgrinder-headless",
+    deps=[
+        "src/c/arch/null",
+        "third_party/clip+clip_none",
+    ],
+    cflags=["-DFRONTEND=headless"],
+)
+
 make_wordgrinder(
     "wordgrinder-wincon",
     deps=[
@@ -130,3 +185,27 @@ make_wordgrinder(
     cflags=["-DFRONTEND=glfw"],
     ldflags=["-lGL"],
 )
+
+# Times the word and string primitives on their own; see microbench.cc. It runs
+# without the scripts, on the headless display.
+cxxprogram(
+    name="microbench",
+    srcs=["./microbench.cc", "./lua.cc"],
+    cflags=["-DFRONTEND=headless"],
+    deps=[
+        ".+fmt",
+        ".+globals",
+        ".+wgcore",
+        "src/c/arch/null",
+        "third_party/luau",
+        "src/c/luau-em",
+    ],
+)
+
+# Times the document model and the kernels in the core library directly, with
+# no interpreter at all; see corebench.cc.
+cxxprogram(
+    name="corebench",
+    srcs=["./corebench.cc"],
+    deps=[".+fmt", ".+wgcore"],
+)
@@ -4,6 +4,9 @@
  */
 
 #include "globals.h"
+#include <string.h>
+#include <string>
+#include <algorithm>
 #include <vector>
 #include <cmark.h>
 
@@ -75,6 +78,277 @@ static int cmark_getlist_cb(lua_State* L)
     return 1;
 }
 
+/* Builds paragraphs with the same ParagraphBuilder as CreateImporter()
+ * uses; each finished paragraph becomes an array of words with a style
+ * field. */
+
+struct MarkdownImporter
+{
+    lua_State* L;
+    int table; /* stack index of the result array */
+    int count = 0;
+    ParagraphBuilder pb;
+    const char* style = "P";
+};
+
+static void styleon(MarkdownImporter& mi, int a)
+{
+    mi.pb.attr |= a;
+}
+
+static void styleoff(MarkdownImporter& mi, int a)
+{
+    mi.pb.attr &= ~a;
+}
+
+static void addtext(MarkdownImporter& mi, const char* s, size_t len)
+{
+    importtext(mi.pb, s, len);
+}
+
+static void flushword(MarkdownImporter& mi, bool force)
+{
+    importflushword(mi.pb, force);
+}
+
+static void flushparagraph(MarkdownImporter& mi, const char* style)
+{
+    lua_State* L = mi.L;
+    if (importparagraph(L, mi.pb))
+    {
+        lua_pushstring(L, style);
+        lua_setfield(L, -2, "style");
+        lua_rawseti(L, mi.table, ++mi.count);
+    }
+}
+
+/* Adds running text, breaking it into words at whitespace. */
+
+static void addwords(MarkdownImporter& mi, const char* s)
+{
+    for (;;)
+    {
+        size_t len = strcspn(s, " \t\n");
+        if (len)
+            addtext(mi, s, len);
+        s += len;
+        if (!*s)
+            break;
+        flushword(mi, false);
+        s++;
+    }
+}
+
+/* Adds a verbatim block as one paragraph per line. Every space separates
+ * two words, so that runs of spaces survive. */
+
+static void addlines(MarkdownImporter& mi, const char* s, const char* style)
+{
+    const char* end = s + strlen(s);
+    while ((end > s) && ((end[-1] == '\n') || (end[-1] == '\r')))
+        end--;
+
+    for (;;)
+    {
+        const char* eol = s;
+        while ((eol < end) && (*eol != '\n') && (*eol != '\r'))
+            eol++;
+
+        for (;;)
+        {
+            const char* space = std::find(s, eol, ' ');
+            addtext(mi, s, space - s);
+            if (space == eol)
+                break;
+            flushword(mi, true);
+            s = space + 1;
+        }
+        flushparagraph(mi, style);
+
+        if (eol == end)
+            break;
+        s = eol + 1;
+        if ((eol[0] == '\r') && (eol[1] == '\n'))
+            s++;
+    }
+}
+
+static void addhtmlinline(MarkdownImporter& mi, const char* s)
+{
+    static const struct
+    {
+        const char* tag;
+        int attr;
+        bool on;
+    } tags[] = {
+        {"<b>",       DPY_BOLD,      true },
+        {"</b>",      DPY_BOLD,      false},
+        {"<strong>",  DPY_BOLD,      true },
+        {"</strong>", DPY_BOLD,      false},
+        {"<i>",       DPY_ITALIC,    true },
+        {"</i>",      DPY_ITALIC,    false},
+        {"<em>",      DPY_ITALIC,    true },
+        {"</em>",     DPY_ITALIC,    false},
+        {"<u>",       DPY_UNDERLINE, true },
+        {"</u>",      DPY_UNDERLINE, false},
+    };
+
+    for (const auto& t : tags)
+    {
+        if (strcasecmp(s, t.tag) == 0)
+        {
+            if (t.on)
+                styleon(mi, t.attr);
+            else
+                styleoff(mi, t.attr);
+            return;
+        }
+    }
+}
+
+static void importnode(MarkdownImporter& mi, cmark_event_type event,
+    cmark_node* node)
+{
+    const char* literal = cmark_node_get_literal(node);
+    if (!literal)
+        literal = "";
+
+    if (event == CMARK_EVENT_ENTER)
+    {
+        switch (cmark_node_get_type(node))
+        {
+            case CMARK_NODE_BLOCK_QUOTE:
+                mi.style = "Q";
+                break;
+
+            case CMARK_NODE_LIST:
+                switch (cmark_node_get_list_type(node))
+                {
+                    case CMARK_BULLET_LIST:
+                        mi.style = "LB";
+                        break;
+
+                    case CMARK_ORDERED_LIST:
+                        mi.style = "LN";
+                        break;
+
+                    default:
+                        break;
+                }
+                break;
+
+            case CMARK_NODE_CODE_BLOCK:
+                addlines(mi, literal, "PRE");
+                break;
+
+            case CMARK_NODE_HTML_BLOCK:
+                addlines(mi, literal, "RAW");
+                break;
+
+            case CMARK_NODE_THEMATIC_BREAK:
+                flushparagraph(mi, "P");
+                addtext(mi, "", 0);
+                flushparagraph(mi, "P");
+                break;
+
+            case CMARK_NODE_TEXT:
+                addwords(mi, literal);
+                break;
+
+            case CMARK_NODE_SOFTBREAK:
+            case CMARK_NODE_LINEBREAK:
+                flushword(mi, false);
+                break;
+
+            case CMARK_NODE_CODE:
+                styleon(mi, DPY_UNDERLINE);
+                addwords(mi, literal);
+                styleoff(mi, DPY_UNDERLINE);
+                break;
+
+            case CMARK_NODE_HTML_INLINE:
+                addhtmlinline(mi, literal);
+                break;
+
+            case CMARK_NODE_EMPH:
+                styleon(mi, DPY_ITALIC);
+                break;
+
+            case CMARK_NODE_STRONG:
+                styleon(mi, DPY_BOLD);
+                break;
+
+            default:
+                break;
+        }
+    }
+    else if (event == CMARK_EVENT_EXIT)
+    {
+        switch (cmark_node_get_type(node))
+        {
+            case CMARK_NODE_BLOCK_QUOTE:
+            case CMARK_NODE_LIST:
+                mi.style = "P";
+                break;
+
+            case CMARK_NODE_PARAGRAPH:
+                flushparagraph(mi, mi.style);
+                break;
+
+            case CMARK_NODE_HEADING:
+            {
+                static const char* headings[] = {"H1", "H2", "H3", "H4"};
+                int level = cmark_node_get_heading_level(node);
+                level = std::max(1, std::min(level, 4));
+                flushparagraph(mi, headings[level - 1]);
+                break;
+            }
+
+            case CMARK_NODE_EMPH:
+                styleoff(mi, DPY_ITALIC);
+                break;
+
+            case CMARK_NODE_STRONG:
+                styleoff(mi, DPY_BOLD);
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
+/* Parses a Markdown document and turns it straight into paragraphs, without
+ * visiting Lua for each node: returns an array of word arrays, each with a
+ * style field. */
+
+static int cmark_import_cb(lua_State* L)
+{
+    size_t len;
+    const char* data = checkbuffer(L, 1, &len);
+
+    cmark_node* document = cmark_parse_document(data, len, CMARK_OPT_DEFAULT);
+    cmark_iter* iter = cmark_iter_new(document);
+
+    lua_newtable(L);
+    MarkdownImporter mi;
+    mi.L = L;
+    mi.table = lua_gettop(L);
+
+    for (;;)
+    {
+        cmark_event_type event = cmark_iter_next(iter);
+        if (event == CMARK_EVENT_DONE)
+            break;
+        importnode(mi, event, cmark_iter_get_node(iter));
+    }
+    flushparagraph(mi, mi.style);
+
+    cmark_iter_free(iter);
+    cmark_node_free(document);
+    return 1;
+}
+
 void cmark_init()
 {
     luaL_newmetatable(L, "cmark.document");
@@ -95,6 +369,7 @@ void cmark_init()
         {"CMarkNext",    cmark_next_cb   },
         {"CMarkGetHeading", cmark_getheading_cb },
         {"CMarkGetList", cmark_getlist_cb },
+        {"CMarkImport",  cmark_import_cb },
         {NULL,           NULL            }
     };
 
@@ -0,0 +1,532 @@
+/* © 2026 David Given.
+ * WordGrinder is licensed under the MIT open source license. See the COPYING
+ * file in this distribution for the full text.
+ */
+
+#include "wgcore.h"
+#include <string.h>
+#include <algorithm>
+
+/* Reads and writes document sets in the v3 (text) and v4 (compressed)
+ * formats without the interpreter, using the same rules as the loaders and
+ * savers in dumpfile.cc: something this reads and then writes again in the
+ * same format comes out byte for byte the same as WordGrinder would save it.
+ * The documents' sections (or frames) are independent, so they're checked
+ * and parsed in parallel. The internal clipboard is dropped, as it is when
+ * WordGrinder loads a file. */
+
+void parsecoreparagraph(const char* s, size_t len, CoreParagraph& p)
+{
+    /* The first field is the style; the rest are words. */
+
+    const char* e = s + len;
+    const char* se = (const char*)memchr(s, ' ', e - s);
+    if (!se)
+        se = e;
+    p.style.assign(s, se - s);
+
+    p.words.clear();
+    p.words.reserve(std::count(se, e, ' '));
+    while (se != e)
+    {
+        s = se + 1;
+        se = (const char*)memchr(s, ' ', e - s);
+        if (!se)
+            se = e;
+        p.words.emplace_back(s, se - s);
+    }
+}
+
+void formatcoreparagraph(const CoreParagraph& p, std::string& out)
+{
+    out += p.style;
+    for (const auto& word : p.words)
+    {
+        out += ' ';
+        out += word;
+    }
+    out += '\n';
+}
+
+/* --- Reader ------------------------------------------------------------- */
+
+struct CoreReader
+{
+    CoreDocumentSet& ds;
+    std::string& error;
+    std::vector<uint32_t> checksums; /* for each document, if it has one */
+    std::vector<bool> haschecksum;
+    std::vector<bool> seen; /* the document has properties */
+};
+
+static bool fail(CoreReader& r, const std::string& message)
+{
+    r.error = message;
+    return false;
+}
+
+/* Reads a line, minus the terminator and any carriage returns. */
+
+static bool readline(const char*& p, const char* end, std::string& line)
+{
+    if (p == end)
+        return false;
+
+    const char* s = p;
+    const char* e = (const char*)memchr(s, '\n', end - s);
+    if (!e)
+        e = end;
+    p = (e == end) ? e : e + 1;
+
+    line.assign(s, e - s);
+    if (memchr(s, '\r', e - s))
+        line.erase(std::remove(line.begin(), line.end(), '\r'), line.end());
+    return true;
+}
+
+static bool isdigits(std::string_view s)
+{
+    if (s.empty())
+        return false;
+    for (char c : s)
+        if ((c < '0') || (c > '9'))
+            return false;
+    return true;
+}
+
+static CoreDocument* getdocument(CoreReader& r, size_t n)
+{
+    if (n == 0)
+        return nullptr;
+    if (n > r.ds.documents.size())
+    {
+        r.ds.documents.resize(n);
+        r.checksums.resize(n);
+        r.haschecksum.resize(n);
+        r.seen.resize(n);
+    }
+    r.seen[n - 1] = true;
+    return &r.ds.documents[n - 1];
+}
+
+/* Splits a property line the same way readproperty() in dumpfile.cc does,
+ * and files it under the set or the document it belongs to. */
+
+static bool readproperty(CoreReader& r, const std::string& line)
+{
+    /* Equivalent to ^(.*)%.([^.:]+): (.*)$; note that the key is greedy. */
+
+    size_t colon = std::string::npos;
+    for (size_t i = line.size(); i-- > 0;)
+    {
+        if (line[i] != '.')
+            continue;
+
+        size_t j = i + 1;
+        while ((j < line.size()) && (line[j] != '.') && (line[j] != ':'))
+            j++;
+        if ((j > (i + 1)) && ((j + 1) < line.size()) && (line[j] == ':') &&
+            (line[j + 1] == ' '))
+        {
+            colon = j;
+            break;
+        }
+    }
+    if (colon == std::string::npos)
+        return fail(r, "malformed line when reading file: '" + line + "'");
+
+    std::string_view key(line.data(), colon);
+    std::string_view value(line.data() + colon + 2, line.size() - colon - 2);
+
+    if (key == ".current")
+    {
+        if (!isdigits(value))
+            return fail(r, "malformed current document: '" + line + "'");
+        r.ds.current = strtoul(std::string(value).c_str(), nullptr, 10);
+        return true;
+    }
+
+    if (key.substr(0, 11) == ".clipboard.")
+        return true;
+
+    static const std::string_view documents = ".documents.";
+    if (key.substr(0, documents.size()) == documents)
+    {
+        std::string_view rest = key.substr(documents.size());
+        size_t dot = rest.find('.');
+        if ((dot != std::string_view::npos) && isdigits(rest.substr(0, dot)))
+        {
+            size_t id =
+                strtoul(std::string(rest.substr(0, dot)).c_str(), nullptr, 10);
+            CoreDocument* d = getdocument(r, id);
+            if (!d)
+                return fail(r, "malformed document id in '" + line + "'");
+            size_t n = d - r.ds.documents.data();
+            std::string_view subkey = rest.substr(dot + 1);
+
+            if (subkey == "name")
+            {
+                if ((value.size() < 2) || (value.front() != '"') ||
+                    (value.back() != '"'))
+                    return fail(r, "malformed document name: '" + line + "'");
+                std::string inner(value.substr(1, value.size() - 2));
+                d->name.clear();
+                unescapestring(d->name, inner.c_str(), inner.size());
+            }
+            else if (subkey == "_checksum")
+            {
+                if (!isdigits(value))
+                    return fail(r, "malformed checksum: '" + line + "'");
+                r.checksums[n] =
+                    strtoul(std::string(value).c_str(), nullptr, 10);
+                r.haschecksum[n] = true;
+            }
+            else
+                d->properties.push_back(
+                    {std::string(subkey), std::string(value)});
+            return true;
+        }
+    }
+
+    r.ds.properties.push_back({std::string(key), std::string(value)});
+    return true;
+}
+
+/* Parses the paragraph lines of a section, which has had its carriage
+ * returns removed. */
+
+static void readparagraphs(const char* text, size_t len, CoreDocument& d)
+{
+    std::vector<std::pair<size_t, size_t>> lines;
+    splitlines(text, len, lines);
+    d.paragraphs.resize(lines.size());
+    for (size_t i = 0; i < lines.size(); i++)
+        parsecoreparagraph(
+            text + lines[i].first, lines[i].second, d.paragraphs[i]);
+}
+
+static bool readtext(CoreReader& r, const char* p, const char* end)
+{
+    struct Section
+    {
+        size_t document;
+        const char* start;
+        const char* end;
+    };
+    std::vector<Section> sections;
+
+    std::string line;
+    while (readline(p, end, line))
+    {
+        if (line.empty())
+            continue;
+        else if (line[0] == '.')
+        {
+            if (!readproperty(r, line))
+                return false;
+        }
+        else if (line[0] == '#')
+        {
+            std::string id = line.substr(1);
+            const char* start = p;
+            const char* e = findsectionend(p, end, &p);
+            if (id == "clipboard")
+                continue;
+            if (!isdigits(id) || (id[0] == '0'))
+                return fail(r, "malformed document id '" + id + "'");
+            sections.push_back({strtoul(id.c_str(), nullptr, 10), start, e});
+        }
+        else
+            return fail(r, "malformed line when reading file: '" + line + "'");
+    }
+
+    for (const auto& s : sections)
+        if (s.document > r.ds.documents.size())
+            return fail(r, "document " + std::to_string(s.document) +
+                               " is missing");
+
+    parallelfor(sections.size(),
+        [&](size_t i)
+        {
+            const Section& s = sections[i];
+            CoreDocument& d = r.ds.documents[s.document - 1];
+            const char* text = s.start;
+            size_t len = s.end - s.start;
+            std::string copy;
+            if (memchr(text, '\r', len))
+            {
+                copy.assign(text, len);
+                copy.erase(
+                    std::remove(copy.begin(), copy.end(), '\r'), copy.end());
+                text = copy.data();
+                len = copy.size();
+            }
+
+            /* Damaged documents are still loaded, as WordGrinder does. */
+
+            if (r.haschecksum[s.document - 1] &&
+                (checksum(text, len) != r.checksums[s.document - 1]))
+                d.damaged = true;
+            readparagraphs(text, len, d);
+        });
+    return true;
+}
+
+static bool readsize(const char*& p, size_t& n)
+{
+    char* e;
+    n = strtoull(p, &e, 10);
+    if (e == p)
+        return false;
+    p = e;
+    return true;
+}
+
+static bool readcompressed(CoreReader& r, const char* p, const char* end)
+{
+    struct Frame
+    {
+        const char* data;
+        size_t compressedsize;
+        size_t size;
+        int64_t crc = -1;
+        std::string text;
+        bool ok;
+    };
+    std::vector<Frame> frames;
+
+    std::string line;
+    if (!readline(p, end, line))
+        return fail(r, "compressed file is truncated");
+    const char* q = line.c_str();
+    size_t count;
+    if (!readsize(q, count))
+        return fail(r, "malformed frame index in compressed file");
+    if (count == 0)
+        return fail(r, "compressed file has no frames");
+    if (count > (size_t)(end - p))
+        return fail(r, "compressed file is truncated");
+    frames.resize(count);
+    for (auto& f : frames)
+    {
+        if (!readline(p, end, line))
+            return fail(r, "compressed file is truncated");
+        q = line.c_str();
+        if (!readsize(q, f.compressedsize) || !readsize(q, f.size))
+            return fail(r, "malformed frame index in compressed file");
+        while (*q == ' ')
+            q++;
+        size_t crc;
+        if (*q && readsize(q, crc))
+            f.crc = crc;
+        if (!plausibleframe(f.compressedsize, f.size))
+            return fail(r, "malformed frame index in compressed file");
+    }
+    for (auto& f : frames)
+    {
+        if (f.compressedsize > (size_t)(end - p))
+            return fail(r, "compressed file is truncated");
+        f.data = p;
+        p += f.compressedsize;
+    }
+
+    parallelfor(frames.size(),
+        [&](size_t i)
+        {
+            Frame& f = frames[i];
+            f.ok = decompressframe(std::string_view(f.data, f.compressedsize),
+                f.size,
+                f.crc,
+                f.text);
+        });
+    for (auto& f : frames)
+        if (!f.ok)
+            return fail(r, "compressed file is corrupt");
+
+    const char* s = frames[0].text.data();
+    const char* e = s + frames[0].text.size();
+    while (readline(s, e, line))
+    {
+        if (line.empty())
+            continue;
+        if ((line[0] != '.') || !readproperty(r, line))
+            return fail(r, "malformed line when reading file: '" + line + "'");
+    }
+    if ((frames.size() - 1) > r.ds.documents.size())
+        return fail(r, "document " +
+                           std::to_string(r.ds.documents.size() + 1) +
+                           " is missing");
+
+    parallelfor(frames.size() - 1,
+        [&](size_t i)
+        {
+            Frame& f = frames[i + 1];
+            readparagraphs(f.text.data(), f.text.size(), r.ds.documents[i]);
+            std::string().swap(f.text);
+        });
+    return true;
+}
+
+bool readcoredocumentset(
+    std::string_view data, CoreDocumentSet& ds, std::string& error)
+{
+    ds = CoreDocumentSet();
+    CoreReader r = {ds, error};
+
+    const std::string_view tmagic(TMAGIC, strlen(TMAGIC) - 1);
+    const std::string_view cmagic(CMAGIC, strlen(CMAGIC) - 1);
+    const char* p = data.data();
+    const char* end = p + data.size();
+    std::string magic;
+    readline(p, end, magic);
+
+    bool ok;
+    if (magic == tmagic)
+        ok = readtext(r, p, end);
+    else if (magic == cmagic)
+        ok = readcompressed(r, p, end);
+    else
+        return fail(r, "this is not a text or compressed WordGrinder file");
+    if (!ok)
+        return false;
+
+    for (size_t i = 0; i < ds.documents.size(); i++)
+        if (!r.seen[i])
+            return fail(r, "document " + std::to_string(i + 1) + " is missing");
+    if (ds.current > ds.documents.size())
+        return fail(r, "the current document is missing");
+    return true;
+}
+
+/* --- Writer ------------------------------------------------------------- */
+
+/* dumpfile.cc writes each table's keys in sorted order, recursing into
+ * tables as it goes, so sorting on the first element of each path (and
+ * keeping everything under it in the order it was read) puts the lines back
+ * where they came from. */
+
+static std::string_view topkey(std::string_view key)
+{
+    size_t start = (!key.empty() && (key[0] == '.')) ? 1 : 0;
+    size_t dot = key.find('.', start);
+    if (dot == std::string_view::npos)
+        dot = key.size();
+    return key.substr(start, dot - start);
+}
+
+static std::vector<const CoreProperty*> sortproperties(
+    const std::vector<CoreProperty>& properties)
+{
+    std::vector<const CoreProperty*> sorted;
+    for (const auto& p : properties)
+        sorted.push_back(&p);
+    std::stable_sort(sorted.begin(),
+        sorted.end(),
+        [](const CoreProperty* a, const CoreProperty* b)
+        {
+            return topkey(a->key) < topkey(b->key);
+        });
+    return sorted;
+}
+
+static void writeproperty(
+    std::string& out, std::string_view key, std::string_view value)
+{
+    out += key;
+    out += ": ";
+    out += value;
+    out += '\n';
+}
+
+static void writedocumentproperties(
+    std::string& out, size_t n, const CoreDocument& d)
+{
+    std::string name = "\"";
+    escapestring(name, d.name.c_str(), d.name.size());
+    name += '"';
+
+    std::vector<CoreProperty> properties = d.properties;
+    properties.push_back({"name", name});
+
+    std::string prefix = ".documents." + std::to_string(n) + ".";
+    for (const CoreProperty* p : sortproperties(properties))
+        writeproperty(out, prefix + p->key, p->value);
+}
+
+static void writeproperties(const CoreDocumentSet& ds, std::string& out)
+{
+    auto sorted = sortproperties(ds.properties);
+    auto it = sorted.begin();
+    while ((it != sorted.end()) && (topkey((*it)->key) < "documents"))
+    {
+        writeproperty(out, (*it)->key, (*it)->value);
+        it++;
+    }
+    for (size_t i = 0; i < ds.documents.size(); i++)
+        writedocumentproperties(out, i + 1, ds.documents[i]);
+    for (; it != sorted.end(); it++)
+        writeproperty(out, (*it)->key, (*it)->value);
+
+    if (ds.current)
+        writeproperty(out, ".current", std::to_string(ds.current));
+}
+
+bool writecoredocumentset(
+    const CoreDocumentSet& ds, bool compressed, std::string& out)
+{
+    std::string properties;
+    writeproperties(ds, properties);
+
+    std::vector<std::string> texts(ds.documents.size());
+    parallelfor(texts.size(),
+        [&](size_t i)
+        {
+            for (const auto& p : ds.documents[i].paragraphs)
+                formatcoreparagraph(p, texts[i]);
+        });
+
+    if (!compressed)
+    {
+        out += TMAGIC;
+        out += properties;
+        for (size_t i = 0; i < texts.size(); i++)
+            writeproperty(out,
+                ".documents." + std::to_string(i + 1) + "._checksum",
+                std::to_string(checksum(texts[i].data(), texts[i].size())));
+        for (size_t i = 0; i < texts.size(); i++)
+        {
+            out += '#';
+            out += std::to_string(i + 1);
+            out += '\n';
+            out += texts[i];
+            out += ".\n";
+        }
+        return true;
+    }
+
+    texts.insert(texts.begin(), std::move(properties));
+    std::vector<std::string> frames(texts.size());
+    std::vector<char> ok(texts.size());
+    parallelfor(texts.size(),
+        [&](size_t i) { ok[i] = compressframe(texts[i], frames[i]); });
+    if (std::count(ok.begin(), ok.end(), 0))
+        return false;
+
+    out += CMAGIC;
+    out += std::to_string(frames.size());
+    out += '\n';
+    for (size_t i = 0; i < frames.size(); i++)
+    {
+        out += std::to_string(frames[i].size());
+        out += ' ';
+        out += std::to_string(texts[i].size());
+        out += ' ';
+        out += std::to_string(checksum(texts[i].data(), texts[i].size()));
+        out += '\n';
+    }
+    for (const auto& frame : frames)
+        out += frame;
+    return true;
+}
+
+// vim: sw=4 ts=4 et
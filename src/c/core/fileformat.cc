@@ -0,0 +1,162 @@
+/* © 2026 David Given.
+ * WordGrinder is licensed under the MIT open source license. See the COPYING
+ * file in this distribution for the full text.
+ */
+
+#include "wgcore.h"
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <zlib.h>
+
+/* The pieces of the dumpfile formats which both the Lua loaders and savers
+ * (dumpfile.cc) and the document model (document.cc) use. */
+
+const char TMAGIC[] =
+    "WordGrinder dumpfile v3: this is a text file; diff me!\n";
+const char CMAGIC[] = "WordGrinder dumpfile v4: this is not a text file!\n";
+const char WMAGIC[] = "WordGrinder dumpfile v5: this is not a text file!\n";
+
+/* Each document's text is checksummed (with CRC-32) when it's saved, and
+ * checked when it's loaded. */
+
+uint32_t checksum(const char* s, size_t len, uint32_t crc)
+{
+    while (len > 0)
+    {
+        uInt n = std::min<size_t>(len, 1 << 30);
+        crc = crc32(crc, (const Bytef*)s, n);
+        s += n;
+        len -= n;
+    }
+    return crc;
+}
+
+/* The frames of a v4 file are each deflated on their own. */
+
+bool compressframe(std::string_view in, std::string& out)
+{
+    uLongf len = compressBound(in.size());
+    out.resize(len);
+    if (compress2((Bytef*)out.data(),
+            &len,
+            (const Bytef*)in.data(),
+            in.size(),
+            Z_DEFAULT_COMPRESSION) != Z_OK)
+        return false;
+    out.resize(len);
+    return true;
+}
+
+/* Deflate can't do better than about 1032:1, so a frame which claims to
+ * inflate to more than that is corrupt (or hostile), and shouldn't be
+ * allowed to make anyone allocate the memory for it. */
+
+bool plausibleframe(size_t compressedsize, size_t size)
+{
+    return (compressedsize <= (SIZE_MAX - 64) / 1032) &&
+           (size <= (compressedsize * 1032 + 64));
+}
+
+/* Inflates a frame which should come to size bytes, and checks it against
+ * its checksum if it has one. This runs on worker threads, so it mustn't
+ * throw. */
+
+bool decompressframe(
+    std::string_view in, size_t size, int64_t crc, std::string& out)
+{
+    if (!plausibleframe(in.size(), size))
+        return false;
+    try
+    {
+        out.resize(size);
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+    uLongf len = size;
+    return (uncompress((Bytef*)out.data(),
+                &len,
+                (const Bytef*)in.data(),
+                in.size()) == Z_OK) &&
+           (len == size) && ((crc < 0) || (checksum(out.data(), size) == crc));
+}
+
+/* Finds the end of a v3 section starting at s, without looking at more of
+ * each line than it has to. Returns where the terminator starts (or end, if
+ * there isn't one) and sets next to just after it. */
+
+const char* findsectionend(const char* s, const char* end, const char** next)
+{
+    while (s != end)
+    {
+        const char* e = (const char*)memchr(s, '\n', end - s);
+        if (!e)
+            e = end;
+        const char* p = (e == end) ? e : e + 1;
+
+        /* The terminator is a single dot, perhaps with carriage returns;
+         * paragraph lines always start with a style, so anything else can
+         * be ruled out from its first byte. */
+
+        size_t len = e - s;
+        if ((len > 0) && ((*s == '.') || (*s == '\r')) &&
+            memchr(s, '.', len) &&
+            ((size_t)std::count(s, e, '\r') == (len - 1)))
+        {
+            *next = p;
+            return s;
+        }
+        s = p;
+    }
+    *next = end;
+    return end;
+}
+
+/* Finds the lines of some text which has had its carriage returns removed,
+ * as (offset, length) pairs. A trailing newline doesn't start another line. */
+
+void splitlines(
+    const char* s, size_t len, std::vector<std::pair<size_t, size_t>>& lines)
+{
+    size_t p = 0;
+    while (p != len)
+    {
+        const char* e = (const char*)memchr(s + p, '\n', len - p);
+        size_t q = e ? (e - s) : len;
+        lines.push_back({p, q - p});
+        p = e ? (q + 1) : len;
+    }
+}
+
+/* Calls cb(i) for every i in [0, count), spread across as many threads as
+ * the machine has. */
+
+void parallelfor(size_t count, const std::function<void(size_t)>& cb)
+{
+    std::atomic<size_t> next = 0;
+    auto worker = [&]()
+    {
+        for (;;)
+        {
+            size_t i = next++;
+            if (i >= count)
+                break;
+            cb(i);
+        }
+    };
+
+    size_t threads = std::min<size_t>(
+        std::max(std::thread::hardware_concurrency(), 1U), count);
+    std::vector<std::thread> pool;
+    for (size_t i = 1; i < threads; i++)
+        pool.emplace_back(worker);
+    worker();
+    for (auto& t : pool)
+        t.join();
+}
+
+// vim: sw=4 ts=4 et
@@ -0,0 +1,612 @@
+/* © 2008 David Given.
+ * WordGrinder is licensed under the MIT open source license. See the COPYING
+ * file in this distribution for the full text.
+ */
+
+#include "wgcore.h"
+#include <assert.h>
+#include <string.h>
+#include <algorithm>
+#include <array>
+#if defined __SSE2__
+#include <emmintrin.h>
+#elif defined __ARM_NEON && defined __aarch64__
+#include <arm_neon.h>
+#endif
+
+/* --- UTF-8 -------------------------------------------------------------- */
+
+int getu8bytes(char c)
+{
+    uint8_t cc = c;
+    if (cc < 0x80)
+        return 1;
+    else if (cc < 0xc0)
+        return 0;
+    else if (cc < 0xe0)
+        return 2;
+    else if (cc < 0xf0)
+        return 3;
+    else if (cc < 0xf8)
+        return 4;
+    else if (cc < 0xfc)
+        return 5;
+    return 6;
+}
+
+/* Returns the length of the UTF-8 sequence at p if it's a complete and
+ * valid one, or 0 otherwise. readu8() will happily read past the end of a
+ * truncated sequence, so untrusted text should be checked with this first. */
+
+int validu8bytes(const char* p, const char* end)
+{
+    int n = getu8bytes(*p);
+    if ((n == 0) || (n > (end - p)))
+        return 0;
+    for (int i = 1; i < n; i++)
+        if (((uint8_t)p[i] & 0xc0) != 0x80)
+            return 0;
+    return n;
+}
+
+/* Returns the number of bytes at the start of s which are printable ASCII
+ * (0x20 to 0x7e), each of which is exactly one column wide and needs no
+ * decoding. Most text is nothing but these, so the width scanners use this
+ * to skip over it sixteen bytes at a time where the CPU allows; the scalar
+ * loop at the end is the reference behaviour. */
+
+size_t printableasciispan(const char* s, size_t len)
+{
+    size_t i = 0;
+
+#if defined __SSE2__
+    const __m128i lo = _mm_set1_epi8(0x1f);
+    const __m128i hi = _mm_set1_epi8(0x7f);
+    while ((i + 16) <= len)
+    {
+        /* Signed compares, so bytes >= 0x80 count as negative and fail. */
+        __m128i v = _mm_loadu_si128((const __m128i*)(s + i));
+        __m128i ok =
+            _mm_and_si128(_mm_cmpgt_epi8(v, lo), _mm_cmplt_epi8(v, hi));
+        if (_mm_movemask_epi8(ok) != 0xffff)
+            break;
+        i += 16;
+    }
+#elif defined __ARM_NEON && defined __aarch64__
+    const uint8x16_t lo = vdupq_n_u8(0x20);
+    const uint8x16_t hi = vdupq_n_u8(0x7f);
+    while ((i + 16) <= len)
+    {
+        uint8x16_t v = vld1q_u8((const uint8_t*)(s + i));
+        uint8x16_t ok = vandq_u8(vcgeq_u8(v, lo), vcltq_u8(v, hi));
+        if (vminvq_u8(ok) != 0xff)
+            break;
+        i += 16;
+    }
+#endif
+
+    while ((i < len) && ((uint8_t)s[i] >= 0x20) && ((uint8_t)s[i] < 0x7f))
+        i++;
+    return i;
+}
+
+/* Returns the number of bytes at the start of s which aren't one of
+ * specials (at most sixteen of them) and, if highbit is set, are below 0x80.
+ * The escapers use this to find the first byte they have to do something
+ * about; usually there isn't one. */
+
+size_t plainspan(
+    const char* s, size_t len, std::string_view specials, bool highbit)
+{
+    size_t i = 0;
+    size_t n = std::min<size_t>(specials.size(), 16);
+
+#if defined __SSE2__
+    __m128i splats[16];
+    for (size_t j = 0; j < n; j++)
+        splats[j] = _mm_set1_epi8(specials[j]);
+    while ((i + 16) <= len)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)(s + i));
+        __m128i hit = _mm_setzero_si128();
+        for (size_t j = 0; j < n; j++)
+            hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, splats[j]));
+        int mask = _mm_movemask_epi8(hit);
+        if (highbit)
+            mask |= _mm_movemask_epi8(v);
+        if (mask)
+            break;
+        i += 16;
+    }
+#elif defined __ARM_NEON && defined __aarch64__
+    uint8x16_t splats[16];
+    for (size_t j = 0; j < n; j++)
+        splats[j] = vdupq_n_u8(specials[j]);
+    const uint8x16_t top = vdupq_n_u8(highbit ? 0x80 : 0x00);
+    while ((i + 16) <= len)
+    {
+        uint8x16_t v = vld1q_u8((const uint8_t*)(s + i));
+        uint8x16_t hit = vtstq_u8(v, top);
+        for (size_t j = 0; j < n; j++)
+            hit = vorrq_u8(hit, vceqq_u8(v, splats[j]));
+        if (vmaxvq_u8(hit))
+            break;
+        i += 16;
+    }
+#endif
+
+    while (i < len)
+    {
+        uint8_t c = s[i];
+        if ((highbit && (c >= 0x80)) || memchr(specials.data(), c, n))
+            break;
+        i++;
+    }
+    return i;
+}
+
+/* Skips over up to *n newlines at the start of s, returning the offset just
+ * after the last one skipped (or 0 if none were) and taking the number
+ * skipped off *n. With *n = SIZE_MAX this counts the newlines. The text
+ * viewer indexes whole files with this, so the newlines are found sixteen
+ * bytes at a time where the CPU allows and whole blocks are counted with a
+ * popcount. */
+
+size_t skiplines(const char* s, size_t len, size_t* n)
+{
+    size_t i = 0;
+    size_t after = 0;
+
+#if defined __SSE2__
+    const __m128i nl = _mm_set1_epi8('\n');
+    while ((*n != 0) && ((i + 16) <= len))
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)(s + i));
+        unsigned mask = _mm_movemask_epi8(_mm_cmpeq_epi8(v, nl));
+        size_t count = __builtin_popcount(mask);
+        if (count >= *n)
+        {
+            /* The one we want is in this block. */
+            for (size_t j = 1; j < *n; j++)
+                mask &= mask - 1;
+            *n = 0;
+            return i + __builtin_ctz(mask) + 1;
+        }
+        if (count)
+            after = i + 32 - __builtin_clz(mask);
+        *n -= count;
+        i += 16;
+    }
+#elif defined __ARM_NEON && defined __aarch64__
+    const uint8x16_t nl = vdupq_n_u8('\n');
+    while ((*n != 0) && ((i + 16) <= len))
+    {
+        uint8x16_t v = vld1q_u8((const uint8_t*)(s + i));
+        size_t count = vaddvq_u8(vandq_u8(vceqq_u8(v, nl), vdupq_n_u8(1)));
+        if (count >= *n)
+            break; /* the scalar loop finds it */
+        if (count)
+        {
+            size_t j = 15;
+            while (s[i + j] != '\n')
+                j--;
+            after = i + j + 1;
+        }
+        *n -= count;
+        i += 16;
+    }
+#endif
+
+    while ((*n != 0) && (i < len))
+    {
+        const char* p = (const char*)memchr(s + i, '\n', len - i);
+        if (!p)
+            break;
+        i = after = p - s + 1;
+        (*n)--;
+    }
+    return after;
+}
+
+/* Höhrmann's UTF-8 DFA. Each byte is mapped to one of twelve classes, and
+ * the state (a multiple of twelve) plus the class indexes the next state.
+ * State 0 is between characters and 12 means the input is malformed. Only
+ * RFC 3629 UTF-8 is accepted: no overlong forms, surrogates, or anything
+ * past U+10FFFF. */
+
+static constexpr uint8_t u8classes[256] = {
+    // clang-format off
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    8, 8, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+   10, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3,
+   11, 6, 6, 6, 5, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    // clang-format on
+};
+
+static constexpr uint8_t u8transitions[108] = {
+    // clang-format off
+     0, 12, 24, 36, 60, 96, 84, 12, 12, 12, 48, 72,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12,  0, 12, 12, 12, 12, 12,  0, 12,  0, 12, 12,
+    12, 24, 12, 12, 12, 12, 12, 24, 12, 24, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 24, 12, 12, 12, 12,
+    12, 24, 12, 12, 12, 12, 12, 12, 12, 24, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 36, 12, 36, 12, 12,
+    12, 36, 12, 12, 12, 12, 12, 36, 12, 36, 12, 12,
+    12, 36, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    // clang-format on
+};
+
+/* The same DFA with the transitions for each byte packed into a word. Each
+ * state is a shift, six bits per state, which finds the next one in it;
+ * stepping is then a load and a shift, rather than two dependent loads. */
+
+static constexpr int U8ACCEPT = 0;
+static constexpr int U8REJECT = 6;
+
+static constexpr std::array<uint64_t, 256> makeu8rows()
+{
+    std::array<uint64_t, 256> rows = {};
+    for (int c = 0; c < 256; c++)
+        for (int state = 0; state < 9; state++)
+        {
+            uint64_t next = u8transitions[state * 12 + u8classes[c]] / 12;
+            rows[c] |= (next * 6) << (state * 6);
+        }
+    return rows;
+}
+
+static constexpr std::array<uint64_t, 256> u8rows = makeu8rows();
+
+/* Returns the number of bytes at the start of s which are well-formed
+ * UTF-8, ending on a character boundary. Runs of ASCII are skipped sixteen
+ * bytes at a time; only the rest goes through the DFA. */
+
+size_t validu8span(const char* s, size_t len)
+{
+    size_t i = 0; /* end of the last complete character */
+    size_t j = 0; /* next byte to look at */
+    uint64_t state = U8ACCEPT;
+    while (j < len)
+    {
+        uint8_t c = s[j];
+        if ((state == U8ACCEPT) && (c < 0x80))
+        {
+            j += plainspan(s + j, len - j, {}, true);
+            i = j;
+            continue;
+        }
+
+        state = (u8rows[c] >> state) & 63;
+        if (state == U8REJECT)
+            break;
+        j++;
+        if (state == U8ACCEPT)
+            i = j;
+    }
+    return i;
+}
+
+/* Appends s to dest, dropping anything which isn't valid UTF-8 and
+ * canonicalising what's left, as read by readu8(). Anything validu8span()
+ * accepts can be copied as it is. */
+
+void appendvalidu8(std::string& dest, std::string_view s)
+{
+    const char* p = s.data();
+    const char* end = p + s.size();
+    while (p < end)
+    {
+        size_t span = validu8span(p, end - p);
+        dest.append(p, span);
+        p += span;
+        if (p == end)
+            break;
+
+        int n = validu8bytes(p, end);
+        if (n == 0)
+            p++;
+        else
+        {
+            char buffer[8];
+            char* out = buffer;
+            writeu8(&out, readu8(&p));
+            dest.append(buffer, out - buffer);
+        }
+    }
+}
+
+uni_t readu8(const char** srcp)
+{
+    const uint8_t* src = (const uint8_t*)*srcp;
+
+    uni_t c = *src++;
+    if (c < 0x80)
+    {
+        /* Do nothing! */
+        goto zero;
+    }
+    else if (c < 0xc0)
+    {
+        /* Invalid character */
+        c = -1;
+        goto zero;
+    }
+    else if (c < 0xe0)
+    {
+        /* One trailing byte */
+        c &= 0x1f;
+        goto one;
+    }
+    else if (c < 0xf0)
+    {
+        /* Two trailing bytes */
+        c &= 0x0f;
+        goto two;
+    }
+    else if (c < 0xf8)
+    {
+        /* Three trailing bytes */
+        c &= 0x07;
+        goto three;
+    }
+    else if (c < 0xfc)
+    {
+        /* Four trailing bytes */
+        c &= 0x03;
+        goto four;
+    }
+    else
+    {
+        /* Five trailing bytes */
+        c &= 0x01;
+        goto five;
+    }
+
+    uint8_t d;
+five:
+    d = *src;
+    src += (d != 0);
+    c <<= 6;
+    c += d & 0x3f;
+four:
+    d = *src;
+    src += (d != 0);
+    c <<= 6;
+    c += d & 0x3f;
+three:
+    d = *src;
+    src += (d != 0);
+    c <<= 6;
+    c += d & 0x3f;
+two:
+    d = *src;
+    src += (d != 0);
+    c <<= 6;
+    c += d & 0x3f;
+one:
+    d = *src;
+    src += (d != 0);
+    c <<= 6;
+    c += d & 0x3f;
+zero:
+    *srcp = (const char*)src;
+    return c;
+}
+
+void writeu8(char** destp, uni_t ch)
+{
+    char* dest = *destp;
+
+    if (ch < 0)
+        assert(false);
+    else if (ch < 0x80)
+    {
+        *dest++ = (char)ch;
+    }
+    else if (ch < 0x800)
+    {
+        *dest++ = (ch >> 6) | 0xC0;
+        *dest++ = (ch & 0x3F) | 0x80;
+    }
+    else if (ch < 0x10000)
+    {
+        *dest++ = (ch >> 12) | 0xE0;
+        *dest++ = ((ch >> 6) & 0x3F) | 0x80;
+        *dest++ = (ch & 0x3F) | 0x80;
+    }
+    else if (ch < 0x200000)
+    {
+        *dest++ = (ch >> 18) | 0xF0;
+        *dest++ = ((ch >> 12) & 0x3F) | 0x80;
+        *dest++ = ((ch >> 6) & 0x3F) | 0x80;
+        *dest++ = (ch & 0x3F) | 0x80;
+    }
+    else if (ch < 0x4000000)
+    {
+        *dest++ = (ch >> 24) | 0xF8;
+        *dest++ = ((ch >> 18) & 0x3F) | 0x80;
+        *dest++ = ((ch >> 12) & 0x3F) | 0x80;
+        *dest++ = ((ch >> 6) & 0x3F) | 0x80;
+        *dest++ = (ch & 0x3F) | 0x80;
+    }
+    else if (ch <= 0x7fffffff)
+    {
+        *dest++ = (ch >> 30) | 0xFC;
+        *dest++ = ((ch >> 24) & 0x3F) | 0x80;
+        *dest++ = ((ch >> 18) & 0x3F) | 0x80;
+        *dest++ = ((ch >> 12) & 0x3F) | 0x80;
+        *dest++ = ((ch >> 6) & 0x3F) | 0x80;
+        *dest++ = (ch & 0x3F) | 0x80;
+    }
+
+    *destp = dest;
+}
+
+/* --- Escaping ---------------------------------------------------------- */
+
+/* The v3 dumpfile escapers decode every character and encode it again, so
+ * they pass through anything which isn't one of their specials and is
+ * well-formed UTF-8 unchanged. This returns how many bytes at the start of s
+ * that is. It's nearly always all of them, and almost all of those are
+ * ASCII, which plainspan() skips sixteen bytes at a time. */
+
+struct Specials
+{
+    Specials(std::string_view chars): chars(chars)
+    {
+        for (char c : chars)
+            table[(uint8_t)c] = true;
+    }
+
+    std::string_view chars;
+    bool table[0x80] = {};
+};
+
+static const Specials ESCAPESPECIALS("\\\"\n\r");
+static const Specials UNESCAPESPECIALS("\\");
+
+static size_t passthroughspan(
+    const char* s, size_t len, const Specials& specials)
+{
+    /* Whole blocks of sixteen first, if there are any. */
+    size_t i = plainspan(s, len & ~15, specials.chars, true);
+
+    while (i < len)
+    {
+        uint8_t c = s[i];
+        if (c < 0x80)
+        {
+            if (specials.table[c])
+                break;
+            i++;
+            continue;
+        }
+
+        /* Overlong sequences are valid enough here but don't survive being
+         * encoded again, hence the round trip. */
+        int n = validu8bytes(s + i, s + len);
+        if (n == 0)
+            break;
+        const char* p = s + i;
+        char buffer[8];
+        char* q = buffer;
+        writeu8(&q, readu8(&p));
+        if (((q - buffer) != n) || memcmp(buffer, s + i, n))
+            break;
+        i += n;
+    }
+    return i;
+}
+
+size_t escapedspan(const char* s, size_t len)
+{
+    return passthroughspan(s, len, ESCAPESPECIALS);
+}
+
+size_t unescapedspan(const char* s, size_t len)
+{
+    return passthroughspan(s, len, UNESCAPESPECIALS);
+}
+
+/* Appends an escaped copy of a string to dest, using the v3 dumpfile quoting
+ * rules. src must be NUL terminated (which Lua strings always are). */
+
+void escapestring(std::string& dest, const char* src, size_t len)
+{
+    const char* in = src;
+    const char* inend = src + len;
+
+    while (in < inend)
+    {
+        size_t n = passthroughspan(in, inend - in, ESCAPESPECIALS);
+        dest.append(in, n);
+        in += n;
+        if (in == inend)
+            break;
+
+        /* Big enough to fit, including malformed UTF-8. */
+        char buffer[16];
+        char* out = buffer;
+        int c = readu8(&in);
+        switch (c)
+        {
+            case '\n':
+                writeu8(&out, '\\');
+                writeu8(&out, 'n');
+                break;
+
+            case '\r':
+                writeu8(&out, '\\');
+                writeu8(&out, 'r');
+                break;
+
+            case '"':
+            case '\\':
+                writeu8(&out, '\\');
+                /* fall through */
+            default:
+                writeu8(&out, c);
+        }
+        dest.append(buffer, out - buffer);
+    }
+}
+
+/* Appends an unescaped copy of a string to dest, reversing escapestring().
+ * src must be NUL terminated. */
+
+void unescapestring(std::string& dest, const char* src, size_t len)
+{
+    const char* in = src;
+    const char* inend = src + len;
+
+    while (in < inend)
+    {
+        size_t n = passthroughspan(in, inend - in, UNESCAPESPECIALS);
+        dest.append(in, n);
+        in += n;
+        if (in == inend)
+            break;
+
+        char buffer[16];
+        char* out = buffer;
+        int c = readu8(&in);
+        switch (c)
+        {
+            case '\\':
+                c = readu8(&in);
+                switch (c)
+                {
+                    case 'n':
+                        writeu8(&out, '\n');
+                        break;
+
+                    case 'r':
+                        writeu8(&out, '\r');
+                        break;
+
+                    default:
+                        writeu8(&out, c);
+                }
+                break;
+
+            default:
+                writeu8(&out, c);
+        }
+        dest.append(buffer, out - buffer);
+    }
+}
+
+// vim: sw=4 ts=4 et
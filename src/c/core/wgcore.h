@@ -0,0 +1,184 @@
+/* © 2026 David Given.
+ * WordGrinder is licensed under the MIT open source license. See the COPYING
+ * file in this distribution for the full text.
+ */
+
+#ifndef WGCORE_H
+#define WGCORE_H
+
+/* The parts of WordGrinder which don't need the interpreter: the text and
+ * word primitives, the file format kernels, and a plain C++ model of a
+ * document set which can be loaded and saved without any scripts at all.
+ * Everything in here is safe to call from any thread. The Luau bindings
+ * (the rest of src/c) are built on top of this, and nothing here may include
+ * a Lua header. */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/* --- Characters -------------------------------------------------------- */
+
+typedef int uni_t;
+
+/* Character widths come from a two-stage table generated at build time (see
+ * tools/makewcwidth.py), so they're the same on every platform and don't
+ * depend on the locale. Each entry is two bits, with 3 meaning -1. */
+
+extern const uint8_t wcwidth_index[0x110000 >> 8];
+extern const uint8_t wcwidth_blocks[][64];
+
+static inline int emu_wcwidth(uni_t c)
+{
+    if ((unsigned)c >= 0x110000)
+        return (c < 0) ? -1 : 1;
+
+    int w = (wcwidth_blocks[wcwidth_index[c >> 8]][(c & 0xff) >> 2] >>
+                ((c & 3) * 2)) &
+            3;
+    return (w == 3) ? -1 : w;
+}
+
+/* See core/text.cc. */
+
+extern int getu8bytes(char c);
+extern uni_t readu8(const char** ptr);
+extern int validu8bytes(const char* p, const char* end);
+extern size_t printableasciispan(const char* s, size_t len);
+extern size_t plainspan(
+    const char* s, size_t len, std::string_view specials, bool highbit);
+extern size_t validu8span(const char* s, size_t len);
+extern size_t skiplines(const char* s, size_t len, size_t* n);
+extern void appendvalidu8(std::string& dest, std::string_view s);
+extern void writeu8(char** ptr, uni_t value);
+extern void escapestring(std::string& dest, const char* src, size_t len);
+extern void unescapestring(std::string& dest, const char* src, size_t len);
+extern size_t escapedspan(const char* s, size_t len);
+extern size_t unescapedspan(const char* s, size_t len);
+
+/* --- Words ------------------------------------------------------------- */
+
+/* A word is UTF-8 text with style control codes embedded in it: a byte
+ * with STYLE_MARKER set and the style bits of what follows. Every word
+ * starts with all styles off. */
+
+enum
+{
+    STYLE_ITALIC = (1 << 0),
+    STYLE_UNDERLINE = (1 << 1),
+    STYLE_REVERSE = (1 << 2),
+    STYLE_BOLD = (1 << 3),
+
+    STYLE_MARKER = (1 << 4), /* always set */
+    STYLE_ALL = 15
+};
+
+struct WordMetrics
+{
+    struct Run
+    {
+        int attr;
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    int width;
+    std::string text;
+    std::vector<Run> runs;
+};
+
+/* A paragraph's text as the longest runs of text in the same style (only
+ * italic, underline and bold), with the spaces between the words included;
+ * built a word at a time by addword(). See core/words.cc. */
+
+struct StyleRuns
+{
+    struct Run
+    {
+        int style;
+        size_t offset;
+        size_t length;
+    };
+
+    std::string text;
+    std::vector<Run> runs;
+    int words = 0;
+    int last = 0; /* the style the last word finished in */
+
+    void addword(const char* w, const WordMetrics& m);
+    void add(int style, const char* s, size_t len);
+};
+
+extern void computewordmetrics(const char* s, size_t size, WordMetrics& m);
+
+/* --- File format kernels ----------------------------------------------- */
+
+/* See core/fileformat.cc. */
+
+extern const char TMAGIC[];
+extern const char CMAGIC[];
+extern const char WMAGIC[];
+
+extern uint32_t checksum(const char* s, size_t len, uint32_t crc = 0);
+extern bool compressframe(std::string_view in, std::string& out);
+extern bool plausibleframe(size_t compressedsize, size_t size);
+extern bool decompressframe(std::string_view in,
+    size_t size,
+    int64_t crc, /* or -1 if not known */
+    std::string& out);
+extern const char* findsectionend(
+    const char* s, const char* end, const char** next);
+extern void splitlines(const char* s,
+    size_t len,
+    std::vector<std::pair<size_t, size_t>>& lines);
+extern void parallelfor(size_t count, const std::function<void(size_t)>& cb);
+
+/* --- Document model ---------------------------------------------------- */
+
+/* A document set as it is in a file (see core/document.cc). Only what the
+ * core needs to understand is picked out; every other setting is kept as
+ * its path and its value exactly as written (so strings are still quoted
+ * and escaped), in the order they were read, and written back unchanged.
+ * Set properties have their full path (".addons.foo.bar"); document
+ * properties have the path inside the document ("viewmode"). */
+
+struct CoreProperty
+{
+    std::string key;
+    std::string value;
+};
+
+struct CoreParagraph
+{
+    std::string style;
+    std::vector<std::string> words;
+};
+
+struct CoreDocument
+{
+    std::string name;
+    std::vector<CoreProperty> properties;
+    std::vector<CoreParagraph> paragraphs;
+    bool damaged = false; /* its text didn't match its checksum */
+};
+
+struct CoreDocumentSet
+{
+    std::vector<CoreProperty> properties;
+    std::vector<CoreDocument> documents;
+    size_t current = 0; /* one based; 0 if there isn't one */
+};
+
+extern void parsecoreparagraph(const char* s, size_t len, CoreParagraph& p);
+extern void formatcoreparagraph(const CoreParagraph& p, std::string& out);
+extern bool readcoredocumentset(
+    std::string_view data, CoreDocumentSet& ds, std::string& error);
+extern bool writecoredocumentset(
+    const CoreDocumentSet& ds, bool compressed, std::string& out);
+
+#endif
+
+// vim: sw=4 ts=4 et
@@ -0,0 +1,120 @@
+/* © 2008 David Given.
+ * WordGrinder is licensed under the MIT open source license. See the COPYING
+ * file in this distribution for the full text.
+ */
+
+#include "wgcore.h"
+#include <wctype.h>
+
+/* Works out a word's metrics without touching the cache, so is safe to call
+ * from any thread. */
+
+void computewordmetrics(const char* s, size_t size, WordMetrics& m)
+{
+    const char* start = s;
+    const char* send = s + size;
+
+    m.width = 0;
+    bool seennul = false;
+    while (s < send)
+    {
+        size_t ascii = printableasciispan(s, send - s);
+        if (ascii)
+        {
+            m.width += ascii;
+            if (!seennul)
+                m.text.append(s, ascii);
+            s += ascii;
+            continue;
+        }
+
+        uni_t c = readu8(&s);
+        if (c == '\0')
+            seennul = true;
+        if (!iswcntrl(c))
+        {
+            m.width += emu_wcwidth(c);
+            if (!seennul)
+            {
+                char buffer[8];
+                char* p = buffer;
+                writeu8(&p, c);
+                m.text.append(buffer, p - buffer);
+            }
+        }
+    }
+
+    /* Split into runs of the same style. */
+
+    s = start;
+    int oldattr = 0;
+    int attr = 0;
+    const char* w = s;
+    const char* wend = NULL;
+    bool flush = false;
+
+    for (;;)
+    {
+        if (flush)
+        {
+            if (w != wend)
+                m.runs.push_back({oldattr,
+                    (uint32_t)(w - start),
+                    (uint32_t)(wend - w)});
+            w = s;
+            oldattr = attr;
+            flush = false;
+        }
+
+        if (s == send)
+        {
+            if (w == s)
+                break;
+
+            flush = true;
+        }
+        else
+        {
+            uni_t c = readu8(&s);
+
+            if (iswcntrl(c))
+            {
+                oldattr = attr;
+                attr = c & STYLE_ALL;
+                flush = true;
+                wend = s - 1;
+            }
+            else
+                wend = s;
+        }
+    }
+}
+
+/* A space keeps the italic and bold of the word before it, but is only
+ * underlined if the words on both sides of it are, so underlining which
+ * stops at the end of a word stops before the space. */
+
+void StyleRuns::addword(const char* w, const WordMetrics& m)
+{
+    const int styles = STYLE_ITALIC | STYLE_UNDERLINE | STYLE_BOLD;
+    int first = m.runs.empty() ? 0 : (m.runs.front().attr & styles);
+    if (words++)
+        add((last & (STYLE_ITALIC | STYLE_BOLD)) |
+                (last & first & STYLE_UNDERLINE),
+            " ",
+            1);
+
+    for (const auto& run : m.runs)
+        add(run.attr & styles, w + run.offset, run.length);
+    last = m.runs.empty() ? 0 : (m.runs.back().attr & styles);
+}
+
+void StyleRuns::add(int style, const char* s, size_t len)
+{
+    if (runs.empty() || (runs.back().style != style))
+        runs.push_back({style, text.size(), 0});
+    text.append(s, len);
+    runs.back().length += len;
+}
+
+// vim: sw=4 ts=4 et
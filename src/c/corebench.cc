@@ -0,0 +1,378 @@
+/* © 2026 David Given.
+ * WordGrinder is licensed under the MIT open source license. See the COPYING
+ * file in this distribution for the full text.
+ */
+
+/* Benchmarks for the core library (see core/wgcore.h), driven directly from
+ * C++ with no interpreter at all, so that the kernels can be timed and
+ * profiled on their own. Run as:
+ *
+ *     corebench [filter] [file.wg...]
+ *
+ * to run every benchmark whose name contains the filter. The document set
+ * benchmarks run on a generated set of chapters, and on any files given.
+ * Each benchmark is run for a tenth of a second or so, five times over, and
+ * the median time per call is reported.
+ *
+ * Before anything is timed, everything which is read is written again and
+ * checked to come out the same (for files, after being written once, as
+ * files from older versions don't have everything the current one writes),
+ * so that the benchmarks can't quietly be measuring something broken. */
+
+#include "wgcore.h"
+#include <errno.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+#include <fmt/format.h>
+
+static const double RUNTIME = 0.1; /* seconds per run */
+static const int RUNS = 5;
+
+static const int CHAPTERS = 20;
+static const int PARAGRAPHS = 500; /* per chapter */
+static const int WORDS = 12;       /* per paragraph */
+
+/* Repeatedly calls body(n) for n iterations, growing n until a run takes long
+ * enough to time; returns the median nanoseconds per iteration. */
+
+static double measure(const std::function<void(int)>& body)
+{
+    int n = 1;
+    for (;;)
+    {
+        auto start = std::chrono::steady_clock::now();
+        body(n);
+        double t = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start)
+                       .count();
+        if (t >= (RUNTIME / 10))
+        {
+            n = std::max<int>(n, n * (RUNTIME / t));
+            break;
+        }
+        n *= 10;
+    }
+
+    std::vector<double> times;
+    for (int i = 0; i < RUNS; i++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        body(n);
+        double t = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start)
+                       .count();
+        times.push_back(t * 1e9 / n);
+    }
+    std::sort(times.begin(), times.end());
+    return times[RUNS / 2];
+}
+
+static const char* filter = nullptr;
+
+static void benchmark(const std::string& name,
+    const std::function<void(int)>& body)
+{
+    if (filter && !strstr(name.c_str(), filter))
+        return;
+
+    double ns = measure(body);
+    if (ns >= 1e6)
+        fmt::print("{:<36} {:10.2f} ms\n", name, ns / 1e6);
+    else
+        fmt::print("{:<36} {:10.1f} ns\n", name, ns);
+    fflush(stdout);
+}
+
+static void fail(const std::string& message)
+{
+    fmt::print(stderr, "corebench: {}\n", message);
+    exit(1);
+}
+
+/* --- Inputs ------------------------------------------------------------- */
+
+/* A word with a style change every two characters, cycling through the
+ * styles. */
+
+static std::string styled(const char* text)
+{
+    static const int styles[] = {
+        STYLE_ITALIC, STYLE_UNDERLINE, STYLE_BOLD, 0};
+    std::string s;
+    const char* p = text;
+    int n = 0;
+    while (*p)
+    {
+        int style = styles[(n / 2) % 4];
+        if ((n % 2) == 0)
+            s += (char)(STYLE_MARKER + style);
+        const char* start = p;
+        readu8(&p);
+        s.append(start, p - start);
+        n++;
+    }
+    s += (char)STYLE_MARKER;
+    return s;
+}
+
+static const char* const vocabulary[] = {"lorem",
+    "ipsum",
+    "dolor",
+    "sit",
+    "amet",
+    "consectetur",
+    "adipiscing",
+    "elit",
+    "sed",
+    "do",
+    "eiusmod",
+    "tempor",
+    "日本語の文章",
+    "“quoted”"};
+
+static CoreDocumentSet makedocumentset(void)
+{
+    CoreDocumentSet ds;
+    ds.properties.push_back({".addons.test.enabled", "true"});
+    ds.properties.push_back({".fileformat", "8"});
+    ds.properties.push_back({".name", "\"Benchmark\""});
+
+    const int vocabularysize = sizeof(vocabulary) / sizeof(*vocabulary);
+    int n = 0;
+    for (int c = 0; c < CHAPTERS; c++)
+    {
+        CoreDocument d;
+        d.name = fmt::format("Chapter {}", c + 1);
+        d.properties.push_back({"viewmode", "1"});
+        for (int p = 0; p < PARAGRAPHS; p++)
+        {
+            CoreParagraph para;
+            para.style = (p == 0) ? "H1" : "P";
+            for (int w = 0; w < WORDS; w++)
+            {
+                const char* word = vocabulary[n++ % vocabularysize];
+                para.words.push_back(((n % 17) == 0) ? styled(word) : word);
+            }
+            d.paragraphs.push_back(std::move(para));
+        }
+        ds.documents.push_back(std::move(d));
+    }
+    ds.current = 1;
+    return ds;
+}
+
+/* Reads data and writes it back in its own format. */
+
+static std::string rewrite(const std::string& name, const std::string& data)
+{
+    CoreDocumentSet ds;
+    std::string error;
+    if (!readcoredocumentset(data, ds, error))
+        fail(name + ": " + error);
+
+    bool compressed = (data.compare(0, strlen(CMAGIC), CMAGIC) == 0);
+    std::string out;
+    if (!writecoredocumentset(ds, compressed, out))
+        fail(name + ": couldn't be written");
+    return out;
+}
+
+static void checkroundtrip(const std::string& name, const std::string& data)
+{
+    if (rewrite(name, data) != data)
+        fail(name + ": isn't the same after being read and written again");
+}
+
+static std::string readfile(const char* filename)
+{
+    FILE* fp = fopen(filename, "rb");
+    if (!fp)
+        fail(fmt::format("{}: {}", filename, strerror(errno)));
+
+    std::string data;
+    char buffer[65536];
+    size_t len;
+    while ((len = fread(buffer, 1, sizeof(buffer), fp)) > 0)
+        data.append(buffer, len);
+    fclose(fp);
+    return data;
+}
+
+/* --- Benchmarks --------------------------------------------------------- */
+
+static void benchmarkdocumentset(const std::string& name,
+    const std::string& data)
+{
+    CoreDocumentSet ds;
+    std::string error;
+    if (!readcoredocumentset(data, ds, error))
+        fail(name + ": " + error);
+
+    benchmark("read/" + name,
+        [&](int n)
+        {
+            for (int i = 0; i < n; i++)
+            {
+                CoreDocumentSet r;
+                readcoredocumentset(data, r, error);
+            }
+        });
+
+    benchmark("write-text/" + name,
+        [&](int n)
+        {
+            for (int i = 0; i < n; i++)
+            {
+                std::string out;
+                writecoredocumentset(ds, false, out);
+            }
+        });
+
+    benchmark("write-compressed/" + name,
+        [&](int n)
+        {
+            for (int i = 0; i < n; i++)
+            {
+                std::string out;
+                writecoredocumentset(ds, true, out);
+            }
+        });
+}
+
+static void benchmarkparagraphs(const CoreDocumentSet& ds)
+{
+    const CoreParagraph& p = ds.documents[0].paragraphs[1];
+    std::string line;
+    formatcoreparagraph(p, line);
+    line.pop_back();
+
+    benchmark("parsecoreparagraph",
+        [&](int n)
+        {
+            CoreParagraph out;
+            for (int i = 0; i < n; i++)
+                parsecoreparagraph(line.data(), line.size(), out);
+        });
+
+    benchmark("formatcoreparagraph",
+        [&](int n)
+        {
+            std::string out;
+            for (int i = 0; i < n; i++)
+            {
+                out.clear();
+                formatcoreparagraph(p, out);
+            }
+        });
+
+    benchmark("styleruns",
+        [&](int n)
+        {
+            std::vector<WordMetrics> metrics(p.words.size());
+            for (size_t i = 0; i < p.words.size(); i++)
+                computewordmetrics(
+                    p.words[i].data(), p.words[i].size(), metrics[i]);
+
+            for (int i = 0; i < n; i++)
+            {
+                StyleRuns sr;
+                for (size_t j = 0; j < p.words.size(); j++)
+                    sr.addword(p.words[j].data(), metrics[j]);
+            }
+        });
+}
+
+static void benchmarkwords(void)
+{
+    struct Input
+    {
+        const char* name;
+        std::string word;
+    };
+    const Input inputs[] = {
+        {"ascii",  "consectetur"           },
+        {"styled", styled("consectetur")   },
+        {"cjk",    "日本語の文章を書くこと"},
+    };
+
+    for (const Input& input : inputs)
+    {
+        const std::string& w = input.word;
+        std::string suffix = std::string("/") + input.name;
+
+        benchmark("computewordmetrics" + suffix,
+            [&](int n)
+            {
+                for (int i = 0; i < n; i++)
+                {
+                    WordMetrics m;
+                    computewordmetrics(w.data(), w.size(), m);
+                }
+            });
+
+        benchmark("escapestring" + suffix,
+            [&](int n)
+            {
+                std::string s;
+                for (int i = 0; i < n; i++)
+                {
+                    s.clear();
+                    escapestring(s, w.c_str(), w.size());
+                }
+            });
+
+        benchmark("checksum" + suffix,
+            [&](int n)
+            {
+                uint32_t crc = 0;
+                for (int i = 0; i < n; i++)
+                    crc = checksum(w.data(), w.size(), crc);
+                /* Keep the loop from being optimised away. */
+                if (crc == 1)
+                    fmt::print("");
+            });
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<const char*> files;
+    for (int i = 1; i < argc; i++)
+    {
+        size_t len = strlen(argv[i]);
+        if ((len > 3) && !strcmp(argv[i] + len - 3, ".wg"))
+            files.push_back(argv[i]);
+        else
+            filter = argv[i];
+    }
+
+    CoreDocumentSet ds = makedocumentset();
+    std::string text;
+    std::string compressed;
+    if (!writecoredocumentset(ds, false, text) ||
+        !writecoredocumentset(ds, true, compressed))
+        fail("the generated document set couldn't be written");
+    checkroundtrip("generated text", text);
+    checkroundtrip("generated compressed", compressed);
+
+    std::vector<std::string> data;
+    for (const char* filename : files)
+    {
+        data.push_back(rewrite(filename, readfile(filename)));
+        checkroundtrip(filename, data.back());
+    }
+
+    benchmarkdocumentset("text", text);
+    benchmarkdocumentset("compressed", compressed);
+    for (size_t i = 0; i < files.size(); i++)
+        benchmarkdocumentset(files[i], data[i]);
+    benchmarkparagraphs(ds);
+    benchmarkwords();
+    return 0;
+}
+
+// vim: sw=4 ts=4 et
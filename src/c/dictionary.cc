@@ -0,0 +1,820 @@
+/* © 2026 David Given.
+ * WordGrinder is licensed under the MIT open source license. See the COPYING
+ * file in this distribution for the full text.
+ */
+
+#include "globals.h"
+#include <ctype.h>
+#include <limits.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/* Spellchecker dictionaries. A dictionary is a word list, one word per line,
+ * which can be hundreds of thousands of lines long; rather than reading it
+ * into a Lua table every time, it's compiled once into an image which can be
+ * mapped straight into memory and searched where it is. The image is an open
+ * addressed hash table of offsets into a pool of NUL-terminated words, headed
+ * by the size and modification time of the word list it was built from so
+ * that it can be rebuilt when that changes.
+ *
+ * For spelling suggestions, the image also has a deletion index (as in
+ * SymSpell): every string which can be made by deleting up to one byte from
+ * the start of each word maps to the words it came from. The strings made by
+ * deleting up to two bytes from a misspelt word then lead straight to the
+ * words within an edit distance of two of it, other than those which need
+ * two letters put back. Only the first PREFIX bytes of each word are used,
+ * with ASCII case folded, which keeps the index down to a few entries per
+ * word; the candidates are then checked properly. The index is stored as
+ * hashed buckets, each a run of word offsets, with no keys; colliding
+ * strings just share a bucket.
+ *
+ * Words can also be added to (and removed from) a dictionary as it runs,
+ * which is how the user dictionary works; these are kept in an ordinary
+ * hash table next to the image, if there is one, and counted, so a word added
+ * twice needs removing twice.
+ *
+ * Images are native-endian and only meant to be read by the machine which
+ * wrote them; anything which doesn't look right is just rebuilt. */
+
+static const char DICTIONARY[] = "wg.dictionary";
+static const char MAGIC[8] = {'W', 'G', 'D', 'I', 'C', 'T', 0, 2};
+static const uint32_t BYTEORDER = 0x01020304;
+
+static const size_t PREFIX = 7;
+static const int MAXDISTANCE = 2;
+static const size_t MAXWORD = 64; /* longer words get no suggestions */
+
+struct DictionaryHeader
+{
+    char magic[8];
+    uint32_t byteorder;
+    uint32_t slots; /* a power of two */
+    uint64_t sourcesize;
+    int64_t sourcetime;
+    uint32_t deleteslots; /* a power of two */
+    uint32_t deletes;     /* word offsets in the deletion index */
+    uint64_t poolsize;
+};
+
+/* Where everything is in an image. */
+
+struct Image
+{
+    DictionaryHeader h;
+    const char* table;    /* slots offsets into the pool, or 0 */
+    const char* buckets;  /* deleteslots+1 indices into postings */
+    const char* postings; /* deletes offsets into the pool */
+    const char* pool;
+};
+
+static size_t poolstart(const DictionaryHeader& h)
+{
+    return sizeof(h) + (size_t)h.slots * sizeof(uint32_t) +
+           ((size_t)h.deleteslots + 1) * sizeof(uint32_t) +
+           (size_t)h.deletes * sizeof(uint32_t);
+}
+
+static Image openimage(const char* data)
+{
+    Image i;
+    memcpy(&i.h, data, sizeof(i.h));
+    i.table = data + sizeof(i.h);
+    i.buckets = i.table + (size_t)i.h.slots * sizeof(uint32_t);
+    i.postings = i.buckets + ((size_t)i.h.deleteslots + 1) * sizeof(uint32_t);
+    i.pool = data + poolstart(i.h);
+    return i;
+}
+
+static uint32_t readu32(const char* p, size_t index)
+{
+    uint32_t v;
+    memcpy(&v, p + index * sizeof(uint32_t), sizeof(v));
+    return v;
+}
+
+/* Building an image can take a while, so it can be done on a worker thread;
+ * until that finishes, the dictionary is empty. */
+
+struct DictionaryLoad
+{
+    MappedFile source;
+    uint64_t size;
+    int64_t time;
+    std::vector<std::string> caches;
+    std::thread thread;
+    std::atomic<bool> finished = false;
+
+    /* Results. */
+    MappedFile mf = {};
+    char* built = nullptr;
+    size_t len = 0;
+};
+
+struct Dictionary
+{
+    MappedFile mf;   /* if the image is mapped */
+    char* built;     /* if the image is in memory */
+    const char* data;
+    size_t len;
+    DictionaryLoad* load; /* if the image is still being built */
+    std::unordered_map<std::string, int>* added; /* if words have been added */
+};
+
+static uint32_t hashword(std::string_view word)
+{
+    /* FNV-1a. */
+    uint32_t h = 2166136261u;
+    for (uint8_t c : word)
+        h = (h ^ c) * 16777619u;
+    return h;
+}
+
+/* Folds ASCII case and cuts a word down to the part the deletion index
+ * looks at. */
+
+static std::string foldprefix(std::string_view word)
+{
+    std::string s(word.substr(0, PREFIX));
+    for (char& c : s)
+        c = tolower((uint8_t)c);
+    return s;
+}
+
+/* Calls cb with every string which can be made by deleting up to distance
+ * bytes from s, including s itself. Deletions are made left to right, which
+ * avoids most (but not all) repeats. */
+
+template <class F>
+static void foreachdeletion(
+    const std::string& s, int distance, size_t from, const F& cb)
+{
+    cb(std::string_view(s));
+    if (distance == 0)
+        return;
+    for (size_t i = from; i < s.size(); i++)
+    {
+        std::string t = s;
+        t.erase(i, 1);
+        foreachdeletion(t, distance - 1, i, cb);
+    }
+}
+
+/* Returns the optimal string alignment distance between two strings (that
+ * is, counting transpositions as single edits), or limit+1 if it's more than
+ * limit. If fold is set, ASCII case is ignored. */
+
+static int editdistance(std::string_view a, std::string_view b, int limit,
+    bool fold)
+{
+    auto same = [&](char x, char y)
+    {
+        return fold ? (tolower((uint8_t)x) == tolower((uint8_t)y)) : (x == y);
+    };
+
+    if ((int)std::max(a.size(), b.size()) -
+            (int)std::min(a.size(), b.size()) >
+        limit)
+        return limit + 1;
+
+    size_t n = b.size();
+    std::vector<int> before(n + 1), previous(n + 1), current(n + 1);
+    for (size_t j = 0; j <= n; j++)
+        previous[j] = j;
+    for (size_t i = 1; i <= a.size(); i++)
+    {
+        current[0] = i;
+        int best = current[0];
+        for (size_t j = 1; j <= n; j++)
+        {
+            int cost = same(a[i - 1], b[j - 1]) ? 0 : 1;
+            int d = std::min({previous[j] + 1,
+                current[j - 1] + 1,
+                previous[j - 1] + cost});
+            if ((i > 1) && (j > 1) && same(a[i - 1], b[j - 2]) &&
+                same(a[i - 2], b[j - 1]))
+                d = std::min(d, before[j - 2] + 1);
+            current[j] = d;
+            best = std::min(best, d);
+        }
+        if (best > limit)
+            return limit + 1;
+        std::swap(before, previous);
+        std::swap(previous, current);
+    }
+    return std::min(previous[n], limit + 1);
+}
+
+/* Gets the size and modification time of the word list, returning false if
+ * it's not there. */
+
+static bool statsource(const char* filename, uint64_t* size, int64_t* time)
+{
+    std::error_code ec;
+    std::filesystem::path path = std::filesystem::u8path(filename);
+    *size = std::filesystem::file_size(path, ec);
+    if (ec)
+        return false;
+    *time = std::filesystem::last_write_time(path, ec)
+                .time_since_epoch()
+                .count();
+    return !ec;
+}
+
+/* Checks that an image is complete and was built from the given source. */
+
+static bool validimage(
+    const char* data, size_t len, uint64_t sourcesize, int64_t sourcetime)
+{
+    if (len < sizeof(DictionaryHeader))
+        return false;
+
+    DictionaryHeader h;
+    memcpy(&h, data, sizeof(h));
+    if ((memcmp(h.magic, MAGIC, sizeof(MAGIC)) != 0) ||
+        (h.byteorder != BYTEORDER) || (h.slots == 0) ||
+        ((h.slots & (h.slots - 1)) != 0) || (h.sourcesize != sourcesize) ||
+        (h.sourcetime != sourcetime))
+        return false;
+
+    if ((h.deleteslots == 0) || ((h.deleteslots & (h.deleteslots - 1)) != 0))
+        return false;
+
+    size_t pool = poolstart(h);
+    if ((pool > len) || (h.poolsize != (len - pool)))
+        return false;
+    if (readu32(openimage(data).buckets, h.deleteslots) != h.deletes)
+        return false;
+    return (h.poolsize == 0) || (data[len - 1] == 0);
+}
+
+/* Builds the image for a word list. Lines are trimmed of trailing carriage
+ * returns, and blank ones are ignored. */
+
+static std::string buildimage(
+    std::string_view source, uint64_t sourcesize, int64_t sourcetime)
+{
+    std::vector<std::string_view> words;
+    while (!source.empty())
+    {
+        size_t i = source.find('\n');
+        std::string_view line = source.substr(0, i);
+        source.remove_prefix(
+            (i == std::string_view::npos) ? source.size() : (i + 1));
+
+        while (!line.empty() && (line.back() == '\r'))
+            line.remove_suffix(1);
+        if (!line.empty() && (line.find('\0') == std::string_view::npos))
+            words.push_back(line);
+    }
+
+    uint32_t slots = 16;
+    while (slots < (words.size() * 2))
+        slots *= 2;
+
+    /* The deletion index is built as (hash, word) pairs, which are then
+     * sorted into buckets. */
+
+    std::string pool;
+    std::vector<uint32_t> table(slots, 0);
+    std::vector<std::pair<uint32_t, uint32_t>> deletes;
+    std::vector<uint32_t> hashes;
+    for (std::string_view word : words)
+    {
+        uint32_t i = hashword(word) & (slots - 1);
+        for (;;)
+        {
+            uint32_t o = table[i];
+            if (!o)
+            {
+                o = pool.size() + 1;
+                table[i] = o;
+                pool.append(word);
+                pool += '\0';
+
+                hashes.clear();
+                foreachdeletion(foldprefix(word),
+                    MAXDISTANCE - 1,
+                    0,
+                    [&](std::string_view d)
+                    {
+                        hashes.push_back(hashword(d));
+                    });
+                std::sort(hashes.begin(), hashes.end());
+                hashes.erase(
+                    std::unique(hashes.begin(), hashes.end()), hashes.end());
+                for (uint32_t hash : hashes)
+                    deletes.push_back({hash, o});
+                break;
+            }
+            if ((pool.compare(o - 1, word.size(), word) == 0) &&
+                (pool[o - 1 + word.size()] == '\0'))
+                break;
+            i = (i + 1) & (slots - 1);
+        }
+    }
+
+    uint32_t deleteslots = 16;
+    while (deleteslots < (deletes.size() / 2))
+        deleteslots *= 2;
+
+    std::vector<uint32_t> buckets(deleteslots + 1, 0);
+    for (auto& [hash, o] : deletes)
+        buckets[(hash & (deleteslots - 1)) + 1]++;
+    for (uint32_t i = 0; i < deleteslots; i++)
+        buckets[i + 1] += buckets[i];
+
+    std::vector<uint32_t> postings(deletes.size());
+    {
+        std::vector<uint32_t> next(buckets.begin(), buckets.end() - 1);
+        for (auto& [hash, o] : deletes)
+            postings[next[hash & (deleteslots - 1)]++] = o;
+    }
+
+    DictionaryHeader h = {};
+    memcpy(h.magic, MAGIC, sizeof(MAGIC));
+    h.byteorder = BYTEORDER;
+    h.slots = slots;
+    h.sourcesize = sourcesize;
+    h.sourcetime = sourcetime;
+    h.deleteslots = deleteslots;
+    h.deletes = postings.size();
+    h.poolsize = pool.size();
+
+    std::string image((const char*)&h, sizeof(h));
+    image.append((const char*)table.data(), slots * sizeof(uint32_t));
+    image.append((const char*)buckets.data(), buckets.size() * sizeof(uint32_t));
+    image.append(
+        (const char*)postings.data(), postings.size() * sizeof(uint32_t));
+    image.append(pool);
+    return image;
+}
+
+/* Builds the image for a load job, and puts it in the first cache which will
+ * take it (or, if none will, keeps it in memory). */
+
+static void builddictionary(DictionaryLoad* job)
+{
+    std::string image = buildimage(
+        std::string_view(
+            job->source.data ? job->source.data : "", job->source.len),
+        job->size,
+        job->time);
+    unmapfile(&job->source);
+
+    for (const std::string& cache : job->caches)
+    {
+        if ((writefileatomically(cache, {image}) == 0) &&
+            mapfile(cache.c_str(), &job->mf))
+        {
+            if (validimage(job->mf.data, job->mf.len, job->size, job->time))
+            {
+                job->finished = true;
+                return;
+            }
+            unmapfile(&job->mf);
+        }
+    }
+
+    job->built = (char*)malloc(image.size());
+    memcpy(job->built, image.data(), image.size());
+    job->len = image.size();
+    job->finished = true;
+}
+
+/* Waits for a dictionary's load job, if it has one, and takes the result. */
+
+static void finishload(Dictionary* d)
+{
+    DictionaryLoad* job = d->load;
+    if (!job)
+        return;
+
+    if (job->thread.joinable())
+        job->thread.join();
+    d->mf = job->mf;
+    d->built = job->built;
+    if (d->mf.data)
+    {
+        d->data = d->mf.data;
+        d->len = d->mf.len;
+    }
+    else
+    {
+        d->data = d->built;
+        d->len = job->len;
+    }
+    delete job;
+    d->load = nullptr;
+}
+
+/* Returns whether the dictionary's image is there to be searched; until its
+ * load finishes, it isn't. */
+
+static bool ready(Dictionary* d)
+{
+    if (d->load)
+    {
+        if (!d->load->finished)
+            return false;
+        finishload(d);
+    }
+    return d->data != nullptr;
+}
+
+static bool imagecontains(Dictionary* d, std::string_view word)
+{
+    if (!ready(d))
+        return false;
+
+    Image image = openimage(d->data);
+    const DictionaryHeader& h = image.h;
+    /* A damaged image might have no empty slots, so the probing stops after
+     * going all the way round. */
+
+    uint32_t i = hashword(word) & (h.slots - 1);
+    for (uint32_t probes = 0; probes < h.slots; probes++)
+    {
+        uint32_t o = readu32(image.table, i);
+        if (!o || (o > h.poolsize))
+            return false;
+
+        const char* w = image.pool + o - 1;
+        size_t remaining = h.poolsize - (o - 1);
+        if ((word.size() < remaining) &&
+            (memcmp(w, word.data(), word.size()) == 0) &&
+            (w[word.size()] == '\0'))
+            return true;
+        i = (i + 1) & (h.slots - 1);
+    }
+    return false;
+}
+
+static bool contains(Dictionary* d, std::string_view word)
+{
+    if (d->added && (d->added->find(std::string(word)) != d->added->end()))
+        return true;
+    return imagecontains(d, word);
+}
+
+struct Suggestion
+{
+    std::string_view word;
+    int distance;
+    bool samefirst;
+};
+
+/* Finds the words within MAXDISTANCE of the given one, best first: nearest,
+ * then those which start with the same letter, then those closest in
+ * length. The word itself isn't included. */
+
+static void suggestimage(
+    Dictionary* d, std::string_view word, std::vector<Suggestion>& results)
+{
+    if (!ready(d))
+        return;
+    Image image = openimage(d->data);
+    const DictionaryHeader& h = image.h;
+
+    std::vector<uint32_t> buckets;
+    foreachdeletion(foldprefix(word),
+        MAXDISTANCE,
+        0,
+        [&](std::string_view s)
+        {
+            buckets.push_back(hashword(s) & (h.deleteslots - 1));
+        });
+    std::sort(buckets.begin(), buckets.end());
+    buckets.erase(std::unique(buckets.begin(), buckets.end()), buckets.end());
+
+    std::vector<uint32_t> candidates;
+    for (uint32_t b : buckets)
+    {
+        uint32_t first = readu32(image.buckets, b);
+        uint32_t last = std::min(readu32(image.buckets, b + 1), h.deletes);
+        for (uint32_t i = first; i < last; i++)
+            candidates.push_back(readu32(image.postings, i));
+    }
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(
+        std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    for (uint32_t o : candidates)
+    {
+        if (!o || (o > h.poolsize))
+            continue;
+        std::string_view w(image.pool + o - 1);
+        if (w == word)
+            continue;
+        int distance = editdistance(word, w, MAXDISTANCE, true);
+        if (distance <= MAXDISTANCE)
+            results.push_back({w,
+                distance,
+                tolower((uint8_t)w[0]) == tolower((uint8_t)word[0])});
+    }
+}
+
+static std::vector<Suggestion> suggest(Dictionary* d, std::string_view word)
+{
+    std::vector<Suggestion> results;
+    if (word.empty() || (word.size() > MAXWORD))
+        return results;
+    suggestimage(d, word, results);
+
+    /* There are never many added words, so they're just looked through. */
+
+    if (d->added)
+    {
+        for (auto& [s, count] : *d->added)
+        {
+            std::string_view w(s);
+            if (w.empty() || (w == word) || imagecontains(d, w))
+                continue;
+            int distance = editdistance(word, w, MAXDISTANCE, true);
+            if (distance <= MAXDISTANCE)
+                results.push_back({w,
+                    distance,
+                    tolower((uint8_t)w[0]) == tolower((uint8_t)word[0])});
+        }
+    }
+
+    std::sort(results.begin(),
+        results.end(),
+        [&](const Suggestion& a, const Suggestion& b)
+        {
+            if (a.distance != b.distance)
+                return a.distance < b.distance;
+            if (a.samefirst != b.samefirst)
+                return a.samefirst;
+            size_t al = std::max(a.word.size(), word.size()) -
+                        std::min(a.word.size(), word.size());
+            size_t bl = std::max(b.word.size(), word.size()) -
+                        std::min(b.word.size(), word.size());
+            if (al != bl)
+                return al < bl;
+            return a.word < b.word;
+        });
+    return results;
+}
+
+static void dictionary_dtor(void* p)
+{
+    Dictionary* d = (Dictionary*)p;
+    finishload(d);
+    unmapfile(&d->mf);
+    free(d->built);
+    delete d->added;
+    d->built = nullptr;
+    d->data = nullptr;
+    d->added = nullptr;
+}
+
+static Dictionary* newdictionary(lua_State* L)
+{
+    Dictionary* d = (Dictionary*)lua_newuserdatadtor(
+        L, sizeof(Dictionary), dictionary_dtor);
+    *d = {};
+    luaL_getmetatable(L, DICTIONARY);
+    lua_setmetatable(L, -2);
+    return d;
+}
+
+/* Opens a word list. The remaining arguments are places where its compiled
+ * image might be kept: the first valid one is used, or if there isn't one
+ * the image is built and written to the first place which will take it (or,
+ * if none will, just kept in memory). If async is set, building is done in
+ * the background. Returns the dictionary, or nil and an error. */
+
+static int opendictionary(lua_State* L, bool async)
+{
+    const char* filename = luaL_checkstring(L, 1);
+    int caches = lua_gettop(L);
+    for (int i = 2; i <= caches; i++)
+        luaL_checkstring(L, i);
+
+    Dictionary* d = newdictionary(L);
+
+    uint64_t size;
+    int64_t time;
+    if (!statsource(filename, &size, &time))
+    {
+        lua_pushnil(L);
+        lua_pushfstring(L, "%s: no such file", filename);
+        return 2;
+    }
+
+    for (int i = 2; i <= caches; i++)
+    {
+        if (mapfile(lua_tostring(L, i), &d->mf))
+        {
+            if (validimage(d->mf.data, d->mf.len, size, time))
+            {
+                d->data = d->mf.data;
+                d->len = d->mf.len;
+                return 1;
+            }
+            unmapfile(&d->mf);
+        }
+    }
+
+    auto job = std::make_unique<DictionaryLoad>();
+    if (!mapfile(filename, &job->source))
+    {
+        lua_pushnil(L);
+        lua_pushfstring(L, "%s: %s", filename, strerror(errno));
+        return 2;
+    }
+    job->size = size;
+    job->time = time;
+    for (int i = 2; i <= caches; i++)
+        job->caches.push_back(lua_tostring(L, i));
+
+    d->load = job.release();
+    if (async)
+        d->load->thread = std::thread(builddictionary, d->load);
+    else
+    {
+        builddictionary(d->load);
+        finishload(d);
+    }
+    return 1;
+}
+
+/* Returns a new dictionary with no words in it, for adding them to. */
+
+static int createdictionary_cb(lua_State* L)
+{
+    newdictionary(L);
+    return 1;
+}
+
+static int dictionary_cb(lua_State* L)
+{
+    return opendictionary(L, false);
+}
+
+/* As dictionary(), but returns straight away; the dictionary is empty until
+ * poll() says it's ready. */
+
+static int loaddictionary_cb(lua_State* L)
+{
+    return opendictionary(L, true);
+}
+
+/* Returns whether the dictionary has finished loading. If wait is true,
+ * blocks until it has. */
+
+static int dictionary_poll_cb(lua_State* L)
+{
+    Dictionary* d = (Dictionary*)luaL_checkudata(L, 1, DICTIONARY);
+    if (d->load && (lua_toboolean(L, 2) || d->load->finished))
+        finishload(d);
+    lua_pushboolean(L, !d->load);
+    return 1;
+}
+
+static int dictionary_contains_cb(lua_State* L)
+{
+    Dictionary* d = (Dictionary*)luaL_checkudata(L, 1, DICTIONARY);
+    size_t len;
+    const char* s = luaL_checklstring(L, 2, &len);
+    lua_pushboolean(L, contains(d, std::string_view(s, len)));
+    return 1;
+}
+
+/* Adds a word to the dictionary. */
+
+static int dictionary_add_cb(lua_State* L)
+{
+    Dictionary* d = (Dictionary*)luaL_checkudata(L, 1, DICTIONARY);
+    size_t len;
+    const char* s = luaL_checklstring(L, 2, &len);
+    if (!d->added)
+        d->added = new std::unordered_map<std::string, int>();
+    (*d->added)[std::string(s, len)]++;
+    return 0;
+}
+
+/* Takes away a word added with add(); words from the word list can't be
+ * removed. Returns whether it was there to remove. */
+
+static int dictionary_remove_cb(lua_State* L)
+{
+    Dictionary* d = (Dictionary*)luaL_checkudata(L, 1, DICTIONARY);
+    size_t len;
+    const char* s = luaL_checklstring(L, 2, &len);
+    bool removed = false;
+    if (d->added)
+    {
+        auto i = d->added->find(std::string(s, len));
+        if (i != d->added->end())
+        {
+            if (--i->second == 0)
+                d->added->erase(i);
+            removed = true;
+        }
+    }
+    lua_pushboolean(L, removed);
+    return 1;
+}
+
+/* Returns the words which have been added to the dictionary, sorted. */
+
+static int dictionary_words_cb(lua_State* L)
+{
+    Dictionary* d = (Dictionary*)luaL_checkudata(L, 1, DICTIONARY);
+    std::vector<std::string_view> words;
+    if (d->added)
+    {
+        for (auto& [s, count] : *d->added)
+            words.push_back(s);
+    }
+    std::sort(words.begin(), words.end());
+
+    lua_createtable(L, words.size(), 0);
+    for (size_t i = 0; i < words.size(); i++)
+    {
+        lua_pushlstring(L, words[i].data(), words[i].size());
+        lua_rawseti(L, -2, i + 1);
+    }
+    return 1;
+}
+
+/* Returns up to max (default 10) words close to the given one, best
+ * first, and a matching list of their edit distances from it. Until the
+ * dictionary has loaded, there aren't any. */
+
+static int dictionary_suggest_cb(lua_State* L)
+{
+    Dictionary* d = (Dictionary*)luaL_checkudata(L, 1, DICTIONARY);
+    size_t len;
+    const char* s = luaL_checklstring(L, 2, &len);
+    size_t max = luaL_optinteger(L, 3, 10);
+
+    std::vector<Suggestion> results = suggest(d, std::string_view(s, len));
+    size_t n = std::min(results.size(), max);
+    lua_createtable(L, n, 0);
+    lua_createtable(L, n, 0);
+    for (size_t i = 0; i < n; i++)
+    {
+        lua_pushlstring(L, results[i].word.data(), results[i].word.size());
+        lua_rawseti(L, -3, i + 1);
+        lua_pushinteger(L, results[i].distance);
+        lua_rawseti(L, -2, i + 1);
+    }
+    return 2;
+}
+
+/* Returns the edit distance between two strings (counting a transposition
+ * as one edit), or limit+1 if it's more than limit. */
+
+static int editdistance_cb(lua_State* L)
+{
+    size_t alen, blen;
+    const char* a = luaL_checklstring(L, 1, &alen);
+    const char* b = luaL_checklstring(L, 2, &blen);
+    int limit = luaL_optinteger(L, 3, INT_MAX - 1);
+    lua_pushinteger(L,
+        editdistance(std::string_view(a, alen),
+            std::string_view(b, blen),
+            limit,
+            false));
+    return 1;
+}
+
+void dictionary_init(void)
+{
+    const static luaL_Reg funcs[] = {
+        {"createdictionary", createdictionary_cb},
+        {"dictionary",       dictionary_cb      },
+        {"editdistance",     editdistance_cb    },
+        {"loaddictionary",   loaddictionary_cb  },
+        {NULL,               NULL               }
+    };
+
+    const static luaL_Reg dictionarymethods[] = {
+        {"add",      dictionary_add_cb     },
+        {"contains", dictionary_contains_cb},
+        {"poll",     dictionary_poll_cb    },
+        {"remove",   dictionary_remove_cb  },
+        {"suggest",  dictionary_suggest_cb },
+        {"words",    dictionary_words_cb   },
+        {NULL,       NULL                  }
+    };
+
+    luaL_newmetatable(L, DICTIONARY);
+    lua_newtable(L);
+    luaL_register(L, NULL, dictionarymethods);
+    lua_setfield(L, -2, "__index");
+    lua_pop(L, 1);
+
+    luaL_register(L, "wg", funcs);
+}
+
+// vim: sw=4 ts=4 et
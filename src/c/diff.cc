@@ -0,0 +1,303 @@
+/* © 2026 David Given.
+ * WordGrinder is licensed under the MIT open source license. See the COPYING
+ * file in this distribution for the full text.
+ */
+
+#include "globals.h"
+#include <algorithm>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/* Sequence comparison, for comparing documents: a paragraph at a time (by
+ * their hashes) and then a word at a time. This is Myers' O(ND) algorithm,
+ * in the linear space form which bisects the edit path at its middle and
+ * recurses on each half, with the runs in common at the start and end of
+ * each part taken off first.
+ *
+ * Before that, everything which doesn't turn up at all in the other sequence
+ * is put aside, as it can't be part of a match. This is what keeps two
+ * mostly different documents quick to compare, as that's where Myers is
+ * slowest; and as the elements are turned into small integers (the same
+ * for equal strings) at the same time, comparing them is cheap too.
+ *
+ * What's left can still be very different (a document with its paragraphs
+ * shuffled, say), so once the search has taken MAXCOST steps without the two
+ * ends meeting it gives up looking for the middle, and splits at the
+ * furthest point it got to instead. The result is then still correct, but
+ * may not be the shortest. */
+
+static const int MAXCOST = 256;
+
+struct Differ
+{
+    const int* a;
+    const int* b;
+    std::vector<std::pair<int, int>>& matches;
+
+    /* Finds the matches between a[a0, a1) and b[b0, b1), in order. */
+
+    void compare(int a0, int a1, int b0, int b1)
+    {
+        while ((a0 < a1) && (b0 < b1) && (a[a0] == b[b0]))
+        {
+            matches.push_back({a0, b0});
+            a0++;
+            b0++;
+        }
+
+        int suffix = 0;
+        while ((a0 < a1) && (b0 < b1) && (a[a1 - 1] == b[b1 - 1]))
+        {
+            a1--;
+            b1--;
+            suffix++;
+        }
+
+        if ((a0 < a1) && (b0 < b1))
+            bisect(a0, a1, b0, b1);
+
+        for (int i = 0; i < suffix; i++)
+            matches.push_back({a1 + i, b1 + i});
+    }
+
+    /* Compares each side of the middle of the shortest edit path from
+     * a[a0, a1) to b[b0, b1). The search's working space is freed before
+     * either side is looked at, as otherwise every level of the recursion
+     * would be holding on to its own. */
+
+    void bisect(int a0, int a1, int b0, int b1)
+    {
+        int x, y;
+        if (findmiddle(a0, a1, b0, b1, x, y))
+            split(a0, a1, b0, b1, x, y);
+    }
+
+    /* Finds the middle of the edit path by searching forwards from the start
+     * and backwards from the end at the same time until they meet (or until
+     * the search gives up). Returns false if there's nothing in common. */
+
+    bool findmiddle(int a0, int a1, int b0, int b1, int& x, int& y)
+    {
+        int n = a1 - a0;
+        int m = b1 - b0;
+        int maxd = (n + m + 1) / 2;
+
+        /* The search never gets further than MAXCOST steps, so it never
+         * needs more space than that. */
+
+        int offset = std::min(maxd, MAXCOST);
+        int length = 2 * offset + 2;
+        std::vector<int> v1(length, -1);
+        std::vector<int> v2(length, -1);
+        v1[offset + 1] = 0;
+        v2[offset + 1] = 0;
+        int delta = n - m;
+        bool front = (delta % 2) != 0;
+
+        int k1start = 0, k1end = 0, k2start = 0, k2end = 0;
+        int bestx = 0, besty = 0;
+        for (int d = 0; d < maxd; d++)
+        {
+            if (d == MAXCOST)
+            {
+                x = bestx;
+                y = besty;
+                return true;
+            }
+
+            for (int k1 = -d + k1start; k1 <= d - k1end; k1 += 2)
+            {
+                int k1offset = offset + k1;
+                int x1;
+                if ((k1 == -d) ||
+                    ((k1 != d) && (v1[k1offset - 1] < v1[k1offset + 1])))
+                    x1 = v1[k1offset + 1];
+                else
+                    x1 = v1[k1offset - 1] + 1;
+                int y1 = x1 - k1;
+                while ((x1 < n) && (y1 < m) && (a[a0 + x1] == b[b0 + y1]))
+                {
+                    x1++;
+                    y1++;
+                }
+                v1[k1offset] = x1;
+                if ((x1 <= n) && (y1 <= m) && ((x1 + y1) > (bestx + besty)))
+                {
+                    bestx = x1;
+                    besty = y1;
+                }
+                if (x1 > n)
+                    k1end += 2;
+                else if (y1 > m)
+                    k1start += 2;
+                else if (front)
+                {
+                    int k2offset = offset + delta - k1;
+                    if ((k2offset >= 0) && (k2offset < length) &&
+                        (v2[k2offset] != -1) && (x1 >= (n - v2[k2offset])))
+                    {
+                        x = x1;
+                        y = y1;
+                        return true;
+                    }
+                }
+            }
+
+            for (int k2 = -d + k2start; k2 <= d - k2end; k2 += 2)
+            {
+                int k2offset = offset + k2;
+                int x2;
+                if ((k2 == -d) ||
+                    ((k2 != d) && (v2[k2offset - 1] < v2[k2offset + 1])))
+                    x2 = v2[k2offset + 1];
+                else
+                    x2 = v2[k2offset - 1] + 1;
+                int y2 = x2 - k2;
+                while ((x2 < n) && (y2 < m) &&
+                       (a[a1 - x2 - 1] == b[b1 - y2 - 1]))
+                {
+                    x2++;
+                    y2++;
+                }
+                v2[k2offset] = x2;
+                if (x2 > n)
+                    k2end += 2;
+                else if (y2 > m)
+                    k2start += 2;
+                else if (!front)
+                {
+                    int k1offset = offset + delta - k2;
+                    if ((k1offset >= 0) && (k1offset < length) &&
+                        (v1[k1offset] != -1))
+                    {
+                        int x1 = v1[k1offset];
+                        int y1 = offset + x1 - k1offset;
+                        if (x1 >= (n - x2))
+                        {
+                            x = x1;
+                            y = y1;
+                            return true;
+                        }
+                    }
+                }
+            }
+        }
+
+        /* Nothing in common. */
+        return false;
+    }
+
+    void split(int a0, int a1, int b0, int b1, int x, int y)
+    {
+        compare(a0, a0 + x, b0, b0 + y);
+        compare(a0 + x, a1, b0 + y, b1);
+    }
+};
+
+/* Reads an array of strings, turning each into a number which is the same
+ * for equal strings. */
+
+static std::vector<int> readsequence(lua_State* L,
+    int index,
+    std::unordered_map<std::string_view, int>& ids)
+{
+    luaL_checktype(L, index, LUA_TTABLE);
+    int n = lua_objlen(L, index);
+    std::vector<int> s(n);
+    for (int i = 0; i < n; i++)
+    {
+        lua_rawgeti(L, index, i + 1);
+        size_t len;
+        const char* p = luaL_checklstring(L, -1, &len);
+        /* The string stays alive as it's still in the table. */
+        lua_pop(L, 1);
+        auto [it, added] = ids.try_emplace(std::string_view(p, len), ids.size());
+        s[i] = it->second;
+    }
+    return s;
+}
+
+/* Compares two arrays of strings. Returns the runs where they differ, in
+ * order, as {afirst, acount, bfirst, bcount} (where a count of zero means
+ * something was only inserted or only removed, and its first is where that
+ * happened). */
+
+static int diff_cb(lua_State* L)
+{
+    std::unordered_map<std::string_view, int> ids;
+    std::vector<int> a = readsequence(L, 1, ids);
+    std::vector<int> b = readsequence(L, 2, ids);
+
+    /* Put aside anything in one which isn't in the other. */
+
+    std::vector<uint8_t> ina(ids.size(), 0);
+    std::vector<uint8_t> inb(ids.size(), 0);
+    for (int id : a)
+        ina[id] = 1;
+    for (int id : b)
+        inb[id] = 1;
+
+    std::vector<int> ra, rb, ka, kb;
+    for (int i = 0; i < (int)a.size(); i++)
+        if (inb[a[i]])
+        {
+            ka.push_back(a[i]);
+            ra.push_back(i);
+        }
+    for (int i = 0; i < (int)b.size(); i++)
+        if (ina[b[i]])
+        {
+            kb.push_back(b[i]);
+            rb.push_back(i);
+        }
+
+    std::vector<std::pair<int, int>> matches;
+    Differ differ = {ka.data(), kb.data(), matches};
+    differ.compare(0, ka.size(), 0, kb.size());
+
+    /* Everything between two matches is a difference. */
+
+    lua_newtable(L);
+    int count = 0;
+    int pa = 0;
+    int pb = 0;
+    auto hunk = [&](int qa, int qb)
+    {
+        if ((qa > pa) || (qb > pb))
+        {
+            lua_createtable(L, 4, 0);
+            lua_pushinteger(L, pa + 1);
+            lua_rawseti(L, -2, 1);
+            lua_pushinteger(L, qa - pa);
+            lua_rawseti(L, -2, 2);
+            lua_pushinteger(L, pb + 1);
+            lua_rawseti(L, -2, 3);
+            lua_pushinteger(L, qb - pb);
+            lua_rawseti(L, -2, 4);
+            lua_rawseti(L, -2, ++count);
+        }
+    };
+    for (auto [i, j] : matches)
+    {
+        int qa = ra[i];
+        int qb = rb[j];
+        hunk(qa, qb);
+        pa = qa + 1;
+        pb = qb + 1;
+    }
+    hunk(a.size(), b.size());
+    return 1;
+}
+
+void diff_init(void)
+{
+    const static luaL_Reg funcs[] = {
+        {"diff", diff_cb},
+        {NULL,   NULL   }
+    };
+
+    luaL_register(L, "wg", funcs);
+}
+
+// vim: sw=4 ts=4 et
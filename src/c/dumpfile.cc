@@ -0,0 +1,2685 @@
+/* © 2024 David Given.
+ * WordGrinder is licensed under the MIT open source license. See the COPYING
+ * file in this distribution for the full text.
+ */
+
+/* Native reader and writer for the v3 text dumpfile format, which is what
+ * .wg files (and the settings file, and the internal clipboard) use, and the
+ * v4 (compressed) and v5 (word table) formats derived from it. A v3 file
+ * consists of the magic line, followed by a set of property lines:
+ *
+ *     .documents.1.name: "main"
+ *
+ * ...followed by the text of each document:
+ *
+ *     #1
+ *     P word word word
+ *     .
+ */
+
+#include "globals.h"
+#include <string.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <filesystem>
+#include <map>
+#include <thread>
+#include <unordered_map>
+
+/* The magic lines, the checksums and the other format kernels are in
+ * core/fileformat.cc. */
+
+/* How a document set gets saved; from Lua, nil or false is text, true is
+ * compressed, or the format can be named. */
+
+enum
+{
+    FORMAT_TEXT,
+    FORMAT_COMPRESSED,
+    FORMAT_WORDTABLE
+};
+
+static int checkformat(lua_State* L, int index)
+{
+    if (lua_isnoneornil(L, index) || lua_isboolean(L, index))
+        return lua_toboolean(L, index) ? FORMAT_COMPRESSED : FORMAT_TEXT;
+
+    static const char* const names[] = {
+        "text", "compressed", "wordtable", nullptr};
+    return luaL_checkoption(L, index, nullptr, names);
+}
+
+static int pusherrno(lua_State* L)
+{
+    lua_pushnil(L);
+    lua_pushstring(L, strerror(errno));
+    lua_pushinteger(L, errno);
+    return 3;
+}
+
+/* As pusherrno(), for a failed save. */
+
+static int pusherror(lua_State* L, int e, bool renamefailed)
+{
+    std::string s = strerror(e);
+    if (renamefailed)
+        s += ": the filename of your document has changed";
+
+    lua_pushnil(L);
+    lua_pushstring(L, s.c_str());
+    lua_pushinteger(L, e);
+    return 3;
+}
+
+/* Documents other than the current one stay as text until they're first
+ * looked at; see the end of this file. */
+
+static bool islazy(lua_State* L, int doc);
+static void getlazytext(lua_State* L, int doc, std::string& text);
+
+/* --- Writer ------------------------------------------------------------- */
+
+/* This walks a DocumentSet (or any other plain table) and serialises it into
+ * the v3 text dumpfile format. Property keys are emitted as dotted paths,
+ * followed by the text of each document. The output must stay byte-for-byte
+ * identical to what the original Lua implementation produced, as people diff
+ * these files.
+ */
+
+struct DumpWriter
+{
+    lua_State* L;
+    int paragraphclass;
+    int documentsetclass;
+    std::string& out;
+};
+
+static bool isclass(lua_State* L, int index, int classindex)
+{
+    if (!lua_getmetatable(L, index))
+        return false;
+
+    lua_getfield(L, -1, "__index");
+    bool result = lua_rawequal(L, -1, classindex);
+    lua_pop(L, 2);
+    return result;
+}
+
+static void writeproperty(
+    DumpWriter& w, const std::string& key, const char* value, size_t len)
+{
+    w.out += key;
+    w.out += ": ";
+    w.out.append(value, len);
+    w.out += '\n';
+}
+
+static void savevalue(DumpWriter& w, const std::string& key, int index)
+{
+    lua_State* L = w.L;
+    luaL_checkstack(L, 4, "object too deeply nested");
+
+    switch (lua_type(L, index))
+    {
+        case LUA_TTABLE:
+        {
+            size_t packedlen;
+            if (isclass(L, index, w.paragraphclass) ||
+                getpackedwords(L, index, &packedlen) || (key == ".current"))
+                break;
+
+            for (int i = 1;; i++)
+            {
+                lua_rawgeti(L, index, i);
+                if (lua_isnil(L, -1))
+                {
+                    lua_pop(L, 1);
+                    break;
+                }
+
+                savevalue(w, key + "." + std::to_string(i), lua_gettop(L));
+                lua_pop(L, 1);
+            }
+
+            /* Save the keys in alphabetical order, so we get repeatable
+             * files. */
+
+            std::vector<std::string> keys;
+            lua_pushnil(L);
+            while (lua_next(L, index) != 0)
+            {
+                switch (lua_type(L, -2))
+                {
+                    case LUA_TNUMBER:
+                        break;
+
+                    case LUA_TSTRING:
+                    {
+                        size_t len;
+                        const char* k = lua_tolstring(L, -2, &len);
+                        if ((len == 0) || (k[0] != '_'))
+                            keys.emplace_back(k, len);
+                        break;
+                    }
+
+                    default:
+                        luaL_error(L,
+                            "unsupported key type %s for key %s",
+                            luaL_typename(L, -2),
+                            key.c_str());
+                }
+                lua_pop(L, 1);
+            }
+            std::sort(keys.begin(), keys.end());
+
+            for (const auto& k : keys)
+            {
+                lua_pushlstring(L, k.data(), k.size());
+                lua_rawget(L, index);
+                savevalue(w, key + "." + k, lua_gettop(L));
+                lua_pop(L, 1);
+            }
+            break;
+        }
+
+        case LUA_TBOOLEAN:
+            if (lua_toboolean(L, index))
+                writeproperty(w, key, "true", 4);
+            else
+                writeproperty(w, key, "false", 5);
+            break;
+
+        case LUA_TSTRING:
+        {
+            size_t len;
+            const char* s = lua_tolstring(L, index, &len);
+
+            w.out += key;
+            w.out += ": \"";
+            escapestring(w.out, s, len);
+            w.out += "\"\n";
+            break;
+        }
+
+        case LUA_TNUMBER:
+        {
+            /* Use the same conversion as tostring(). */
+            size_t len;
+            const char* s = luaL_tolstring(L, index, &len);
+            writeproperty(w, key, s, len);
+            lua_pop(L, 1);
+            break;
+        }
+
+        default:
+            luaL_error(L,
+                "unsupported type %s for key %s",
+                luaL_typename(L, index),
+                key.c_str());
+    }
+}
+
+/* Writes the paragraphs of the document at the given index, one per line. */
+
+static void saveparagraphs(DumpWriter& w, int index)
+{
+    lua_State* L = w.L;
+    luaL_checkstack(L, 4, "out of memory");
+
+    for (int pn = 1;; pn++)
+    {
+        lua_rawgeti(L, index, pn);
+        if (lua_isnil(L, -1))
+        {
+            lua_pop(L, 1);
+            break;
+        }
+        int p = lua_gettop(L);
+
+        lua_getfield(L, p, "style");
+        size_t len;
+        const char* style = luaL_checklstring(L, -1, &len);
+        w.out.append(style, len);
+        lua_pop(L, 1);
+
+        const char* packed = getpackedwords(L, p, &len);
+        if (packed)
+            w.out.append(packed, len);
+        else
+            foreachparagraphword(L,
+                p,
+                [&](const char* word, size_t wlen)
+                {
+                    w.out += ' ';
+                    w.out.append(word, wlen);
+                });
+
+        w.out += '\n';
+        lua_pop(L, 1);
+    }
+}
+
+/* Appends the paragraph lines of the document at the given index to text. */
+
+static void savedocumenttext(DumpWriter& w, int index, std::string& text)
+{
+    if (islazy(w.L, index))
+        getlazytext(w.L, index, text);
+    else
+    {
+        DumpWriter tw = {w.L, w.paragraphclass, w.documentsetclass, text};
+        saveparagraphs(tw, index);
+    }
+}
+
+/* Writes everything about the object at the given stack index apart from the
+ * document text. Returns true if it's a DocumentSet, in which case the
+ * documents need writing too. */
+
+static bool saveproperties(DumpWriter& w, int index)
+{
+    lua_State* L = w.L;
+    savevalue(w, "", index);
+
+    if (!isclass(L, index, w.documentsetclass))
+        return false;
+
+    lua_getfield(L, index, "documents");
+    int documents = lua_gettop(L);
+    luaL_checktype(L, documents, LUA_TTABLE);
+
+    lua_getfield(L, index, "current");
+    if (!lua_isnil(L, -1))
+    {
+        /* Store the current document as an index into the documents
+         * array. */
+
+        lua_getfield(L, -1, "name");
+        int currentname = lua_gettop(L);
+
+        int found = 0;
+        for (int i = 1;; i++)
+        {
+            lua_rawgeti(L, documents, i);
+            if (lua_isnil(L, -1))
+            {
+                lua_pop(L, 1);
+                break;
+            }
+
+            lua_getfield(L, -1, "name");
+            bool match = lua_equal(L, -1, currentname);
+            lua_pop(L, 2);
+            if (match)
+            {
+                found = i;
+                break;
+            }
+        }
+        if (!found)
+            luaL_error(L, "unsupported type nil for key .current");
+
+        std::string n = std::to_string(found);
+        writeproperty(w, ".current", n.data(), n.size());
+        lua_pop(L, 1);
+    }
+    lua_pop(L, 2);
+    return true;
+}
+
+/* Serialises the object at the given stack index onto the end of out. */
+
+static void saveobject(lua_State* L, int index, std::string& out)
+{
+    index = lua_absindex(L, index);
+    luaL_checktype(L, index, LUA_TTABLE);
+
+    lua_getglobal(L, "Paragraph");
+    lua_getglobal(L, "DocumentSet");
+    DumpWriter w = {L, lua_gettop(L) - 1, lua_gettop(L), out};
+
+    if (saveproperties(w, index))
+    {
+        /* The checksums are properties, so they have to be written before
+         * the text they're of. */
+
+        std::vector<std::string> texts;
+        lua_getfield(L, index, "documents");
+        int documents = lua_gettop(L);
+        for (int i = 1;; i++)
+        {
+            lua_rawgeti(L, documents, i);
+            if (lua_isnil(L, -1))
+            {
+                lua_pop(L, 1);
+                break;
+            }
+
+            texts.emplace_back();
+            savedocumenttext(w, lua_gettop(L), texts.back());
+            lua_pop(L, 1);
+        }
+        lua_pop(L, 1);
+
+        for (size_t i = 0; i < texts.size(); i++)
+        {
+            std::string crc =
+                std::to_string(checksum(texts[i].data(), texts[i].size()));
+            writeproperty(w,
+                ".documents." + std::to_string(i + 1) + "._checksum",
+                crc.data(),
+                crc.size());
+        }
+        for (size_t i = 0; i < texts.size(); i++)
+        {
+            out += '#';
+            out += std::to_string(i + 1);
+            out += '\n';
+            out += texts[i];
+            out += ".\n";
+        }
+    }
+
+    lua_pop(L, 2);
+}
+
+/* --- Compressed writer -------------------------------------------------- */
+
+/* The v4 format is the v3 format split into separately deflated frames: the
+ * first contains the property lines, and there's one more for the paragraph
+ * lines of each document, in order. After the magic line comes the number of
+ * frames and then a line per frame with its compressed and uncompressed
+ * sizes and the checksum of the uncompressed text (which older files don't
+ * have); the frames themselves follow back to back.
+ *
+ * So that saving a big document set only has to compress the documents which
+ * have changed, each document remembers its last frame (in _dumpframe) and
+ * the paragraph array it was made from (in _dumpsnapshot), along with the
+ * frame's size and checksum (in _dumpsize and _dumpchecksum). Paragraphs are
+ * immutable, so if every paragraph is the same object the frame is still
+ * good. Lazy documents haven't been touched at all, so their frame is always
+ * good. */
+
+static bool cachedframevalid(lua_State* L, int doc)
+{
+    luaL_checkstack(L, 4, "out of memory");
+
+    lua_pushstring(L, "_dumpframe");
+    lua_rawget(L, doc);
+    lua_pushstring(L, "_dumpchecksum");
+    lua_rawget(L, doc);
+    bool valid = lua_isstring(L, -2) && lua_isnumber(L, -1);
+    lua_pop(L, 2);
+    if (!valid)
+        return false;
+    if (islazy(L, doc))
+        return true;
+
+    lua_pushstring(L, "_dumpsnapshot");
+    lua_rawget(L, doc);
+    int snapshot = lua_gettop(L);
+    valid = lua_istable(L, snapshot) &&
+            (lua_objlen(L, snapshot) == lua_objlen(L, doc));
+    for (int i = 1; valid && (i <= lua_objlen(L, snapshot)); i++)
+    {
+        lua_rawgeti(L, snapshot, i);
+        lua_rawgeti(L, doc, i);
+        valid = lua_rawequal(L, -1, -2);
+        lua_pop(L, 2);
+    }
+    lua_pop(L, 1);
+    return valid;
+}
+
+/* A crc of -1 means the checksum isn't known. */
+
+static void setframe(lua_State* L,
+    int doc,
+    const char* frame,
+    size_t len,
+    size_t size,
+    int64_t crc)
+{
+    luaL_checkstack(L, 4, "out of memory");
+
+    lua_pushstring(L, "_dumpframe");
+    lua_pushlstring(L, frame, len);
+    lua_rawset(L, doc);
+
+    lua_pushstring(L, "_dumpsize");
+    lua_pushnumber(L, size);
+    lua_rawset(L, doc);
+
+    lua_pushstring(L, "_dumpchecksum");
+    if (crc < 0)
+        lua_pushnil(L);
+    else
+        lua_pushnumber(L, crc);
+    lua_rawset(L, doc);
+}
+
+static void setsnapshot(lua_State* L, int doc)
+{
+    luaL_checkstack(L, 4, "out of memory");
+
+    int n = lua_objlen(L, doc);
+    lua_pushstring(L, "_dumpsnapshot");
+    lua_createtable(L, n, 0);
+    for (int i = 1; i <= n; i++)
+    {
+        lua_rawgeti(L, doc, i);
+        lua_rawseti(L, -2, i);
+    }
+    lua_rawset(L, doc);
+}
+
+/* Records the frame for the document, with a snapshot of its paragraphs. */
+
+static void cacheframe(lua_State* L,
+    int doc,
+    const char* frame,
+    size_t len,
+    size_t size,
+    int64_t crc)
+{
+    setframe(L, doc, frame, len, size, crc);
+    setsnapshot(L, doc);
+}
+
+static void deflateframe(lua_State* L, const std::string& in, std::string& out)
+{
+    if (!compressframe(in, out))
+        luaL_error(L, "compression failed");
+}
+
+/* Serialises the DocumentSet at the given stack index, in v4 format (magic
+ * line included), onto the end of out. */
+
+static void saveobjectcompressed(lua_State* L, int index, std::string& out)
+{
+    index = lua_absindex(L, index);
+    luaL_checktype(L, index, LUA_TTABLE);
+
+    lua_getglobal(L, "Paragraph");
+    lua_getglobal(L, "DocumentSet");
+    int paragraphclass = lua_gettop(L) - 1;
+    int documentsetclass = lua_gettop(L);
+
+    std::string text;
+    DumpWriter w = {L, paragraphclass, documentsetclass, text};
+    if (!saveproperties(w, index))
+        luaL_error(L, "only document sets can be saved compressed");
+
+    std::vector<std::string> frames(1);
+    std::vector<size_t> sizes = {text.size()};
+    std::vector<uint32_t> crcs = {checksum(text.data(), text.size())};
+    deflateframe(L, text, frames[0]);
+
+    lua_getfield(L, index, "documents");
+    int documents = lua_gettop(L);
+    for (int i = 1;; i++)
+    {
+        lua_rawgeti(L, documents, i);
+        if (lua_isnil(L, -1))
+        {
+            lua_pop(L, 1);
+            break;
+        }
+        int doc = lua_gettop(L);
+
+        frames.emplace_back();
+        if (cachedframevalid(L, doc))
+        {
+            lua_getfield(L, doc, "_dumpframe");
+            size_t len;
+            const char* frame = lua_tolstring(L, -1, &len);
+            frames.back().assign(frame, len);
+            lua_getfield(L, doc, "_dumpsize");
+            sizes.push_back(lua_tointeger(L, -1));
+            lua_getfield(L, doc, "_dumpchecksum");
+            crcs.push_back(lua_tonumber(L, -1));
+            lua_pop(L, 3);
+        }
+        else
+        {
+            bool lazy = islazy(L, doc);
+            text.clear();
+            savedocumenttext(w, doc, text);
+            deflateframe(L, text, frames.back());
+            sizes.push_back(text.size());
+            crcs.push_back(checksum(text.data(), text.size()));
+
+            /* Lazy documents haven't changed, so don't need a snapshot; and
+             * mustn't get one, which would materialise them. */
+
+            if (lazy)
+                setframe(L, doc, frames.back().data(), frames.back().size(),
+                    text.size(), crcs.back());
+            else
+                cacheframe(L, doc, frames.back().data(), frames.back().size(),
+                    text.size(), crcs.back());
+        }
+        lua_pop(L, 1);
+    }
+    lua_pop(L, 3);
+
+    out += CMAGIC;
+    out += std::to_string(frames.size());
+    out += '\n';
+    for (size_t i = 0; i < frames.size(); i++)
+    {
+        out += std::to_string(frames[i].size());
+        out += ' ';
+        out += std::to_string(sizes[i]);
+        out += ' ';
+        out += std::to_string(crcs[i]);
+        out += '\n';
+    }
+    for (const auto& frame : frames)
+        out += frame;
+}
+
+/* --- Word table writer ------------------------------------------------- */
+
+/* The v5 format stores each distinct string in the paragraphs once, and the
+ * paragraphs as numbers referring to them; prose uses the same few thousand
+ * words over and over, so this is much smaller than the text and quick to
+ * turn back into paragraphs. After the magic line, everything is unsigned
+ * LEB128 varints and the strings they measure:
+ *
+ *     length, property lines (as in v3)
+ *     number of strings, then each one as length, bytes
+ *     number of documents, then for each:
+ *         number of paragraphs, then for each:
+ *             string id of the style, number of words, each word's id
+ *
+ * String ids count from zero in the order they appear in the table. */
+
+static void writevarint(std::string& out, size_t n)
+{
+    while (n >= 0x80)
+    {
+        out += (char)((n & 0x7f) | 0x80);
+        n >>= 7;
+    }
+    out += (char)n;
+}
+
+struct WordTable
+{
+    std::unordered_map<std::string, size_t> ids;
+    std::string strings;
+    std::string paragraphs;
+};
+
+static size_t intern(WordTable& t, const char* s, size_t len)
+{
+    auto [it, added] = t.ids.try_emplace(std::string(s, len), t.ids.size());
+    if (added)
+    {
+        writevarint(t.strings, len);
+        t.strings.append(s, len);
+    }
+    return it->second;
+}
+
+/* Adds a paragraph; s to e is its words, each preceded by a space (as in a
+ * v3 line, or packed words). */
+
+static void addparagraph(WordTable& t,
+    const char* style,
+    size_t stylelen,
+    const char* s,
+    const char* e)
+{
+    writevarint(t.paragraphs, intern(t, style, stylelen));
+    writevarint(t.paragraphs, std::count(s, e, ' '));
+    while (s != e)
+    {
+        const char* w = s + 1;
+        s = (const char*)memchr(w, ' ', e - w);
+        if (!s)
+            s = e;
+        writevarint(t.paragraphs, intern(t, w, s - w));
+    }
+}
+
+static void saveparagraphswordtable(lua_State* L, int index, WordTable& t)
+{
+    luaL_checkstack(L, 4, "out of memory");
+
+    if (islazy(L, index))
+    {
+        std::string text;
+        getlazytext(L, index, text);
+        size_t count = std::count(text.begin(), text.end(), '\n');
+        writevarint(t.paragraphs, count);
+
+        const char* s = text.data();
+        const char* end = s + text.size();
+        while (s != end)
+        {
+            const char* e = (const char*)memchr(s, '\n', end - s);
+            if (!e)
+                e = end;
+            const char* se = (const char*)memchr(s, ' ', e - s);
+            if (!se)
+                se = e;
+            addparagraph(t, s, se - s, se, e);
+            s = (e == end) ? e : e + 1;
+        }
+        return;
+    }
+
+    size_t count = lua_objlen(L, index);
+    writevarint(t.paragraphs, count);
+    for (size_t pn = 1; pn <= count; pn++)
+    {
+        lua_rawgeti(L, index, pn);
+        int p = lua_gettop(L);
+
+        lua_getfield(L, p, "style");
+        size_t stylelen;
+        const char* style = luaL_checklstring(L, -1, &stylelen);
+
+        size_t len;
+        const char* packed = getpackedwords(L, p, &len);
+        if (packed)
+            addparagraph(t, style, stylelen, packed, packed + len);
+        else
+        {
+            writevarint(t.paragraphs, intern(t, style, stylelen));
+            writevarint(t.paragraphs, lua_objlen(L, p));
+            foreachparagraphword(L,
+                p,
+                [&](const char* word, size_t wlen)
+                {
+                    writevarint(t.paragraphs, intern(t, word, wlen));
+                });
+        }
+        lua_pop(L, 2);
+    }
+}
+
+/* Serialises the DocumentSet at the given stack index, in v5 format (magic
+ * line included), onto the end of out. */
+
+static void saveobjectwordtable(lua_State* L, int index, std::string& out)
+{
+    index = lua_absindex(L, index);
+    luaL_checktype(L, index, LUA_TTABLE);
+
+    lua_getglobal(L, "Paragraph");
+    lua_getglobal(L, "DocumentSet");
+    int paragraphclass = lua_gettop(L) - 1;
+    int documentsetclass = lua_gettop(L);
+
+    std::string properties;
+    DumpWriter w = {L, paragraphclass, documentsetclass, properties};
+    if (!saveproperties(w, index))
+        luaL_error(L, "only document sets can be saved with a word table");
+
+    WordTable t;
+    lua_getfield(L, index, "documents");
+    int documents = lua_gettop(L);
+    size_t count = lua_objlen(L, documents);
+    for (size_t i = 1; i <= count; i++)
+    {
+        lua_rawgeti(L, documents, i);
+        saveparagraphswordtable(L, lua_gettop(L), t);
+        lua_pop(L, 1);
+    }
+    lua_pop(L, 3);
+
+    out += WMAGIC;
+    writevarint(out, properties.size());
+    out += properties;
+    writevarint(out, t.ids.size());
+    out += t.strings;
+    writevarint(out, count);
+    out += t.paragraphs;
+}
+
+static int savetostring_cb(lua_State* L)
+{
+    std::string out;
+    saveobject(L, 1, out);
+
+    lua_pushlstring(L, out.data(), out.size());
+    return 1;
+}
+
+/* Writes the object to filename, safely (see writefileatomically()). */
+
+/* Saving something which is exactly what was last saved to the same file
+ * doesn't need to write anything, as long as the file hasn't been touched
+ * since; this remembers the checksum and size of everything written, and
+ * the file's modification time afterwards. */
+
+struct SavedFile
+{
+    uint32_t crc;
+    size_t size;
+    std::filesystem::file_time_type mtime;
+};
+
+static std::map<std::string, SavedFile> savedfiles;
+
+static uint32_t checksumfile(const char* magic, const std::string& data)
+{
+    return checksum(data.data(), data.size(), checksum(magic, strlen(magic)));
+}
+
+static bool unchanged(const std::string& filename, uint32_t crc, size_t size)
+{
+    auto it = savedfiles.find(filename);
+    if ((it == savedfiles.end()) || (it->second.crc != crc) ||
+        (it->second.size != size))
+        return false;
+
+    std::error_code ec;
+    if (std::filesystem::file_size(filename, ec) != size)
+        return false;
+    auto mtime = std::filesystem::last_write_time(filename, ec);
+    return !ec && (mtime == it->second.mtime);
+}
+
+static void remembersave(const std::string& filename, uint32_t crc, size_t size)
+{
+    std::error_code ec;
+    auto mtime = std::filesystem::last_write_time(filename, ec);
+    if (ec)
+        savedfiles.erase(filename);
+    else
+        savedfiles[filename] = {crc, size, mtime};
+}
+
+static int savedocumentset_cb(lua_State* L)
+{
+    const char* filename = luaL_checklstring(L, 1, nullptr);
+    int format = checkformat(L, 3);
+
+    std::string out;
+    if (format == FORMAT_COMPRESSED)
+        saveobjectcompressed(L, 2, out);
+    else if (format == FORMAT_WORDTABLE)
+        saveobjectwordtable(L, 2, out);
+    else
+        saveobject(L, 2, out);
+
+    const char* magic = (format == FORMAT_TEXT) ? TMAGIC : "";
+    uint32_t crc = checksumfile(magic, out);
+    size_t size = strlen(magic) + out.size();
+    if (!unchanged(filename, crc, size))
+    {
+        bool renamefailed = false;
+        int e =
+            writefileatomically(filename, {magic, out}, nullptr, &renamefailed);
+        if (e)
+        {
+            savedfiles.erase(filename);
+            return pusherror(L, e, renamefailed);
+        }
+        remembersave(filename, crc, size);
+    }
+
+    lua_pushboolean(L, true);
+    return 1;
+}
+
+/* --- Background saving -------------------------------------------------- */
+
+/* Only the main thread may touch the Lua state, so serialisation happens there;
+ * but once the document set has been turned into a string it's isolated from
+ * any later edits, so the disk I/O (which can be slow, particularly on network
+ * filesystems) is done on a worker thread. Only one save may be in flight at
+ * once. */
+
+struct SaveJob
+{
+    std::string filename;
+    const char* magic;
+    std::string data;
+    std::thread thread;
+    std::atomic<size_t> written = 0;
+    std::atomic<bool> finished = false;
+    int error = 0;
+    bool renamefailed = false;
+    uint32_t crc = 0;
+    bool skipped = false; /* the file already had this in it */
+};
+
+static SaveJob* savejob = nullptr;
+
+static void waitforsave(void)
+{
+    if (savejob && savejob->thread.joinable())
+        savejob->thread.join();
+}
+
+static int startsave_cb(lua_State* L)
+{
+    const char* filename = luaL_checklstring(L, 1, nullptr);
+    if (savejob)
+        luaL_error(L, "a background save is already in progress");
+
+    auto job = std::make_unique<SaveJob>();
+    job->filename = filename;
+    int format = checkformat(L, 3);
+    job->magic = (format == FORMAT_TEXT) ? TMAGIC : "";
+    if (format == FORMAT_COMPRESSED)
+        saveobjectcompressed(L, 2, job->data);
+    else if (format == FORMAT_WORDTABLE)
+        saveobjectwordtable(L, 2, job->data);
+    else
+        saveobject(L, 2, job->data);
+
+    size_t size = job->data.size() + strlen(job->magic);
+    job->crc = checksumfile(job->magic, job->data);
+    job->skipped = unchanged(job->filename, job->crc, size);
+
+    savejob = job.release();
+    if (savejob->skipped)
+    {
+        savejob->written = size;
+        savejob->finished = true;
+    }
+    else
+        savejob->thread = std::thread(
+            [job = savejob]()
+            {
+                job->error = writefileatomically(job->filename,
+                    {job->magic, job->data},
+                    &job->written,
+                    &job->renamefailed);
+                job->finished = true;
+            });
+
+    lua_pushinteger(L, savejob->data.size() + strlen(savejob->magic));
+    return 1;
+}
+
+/* Returns nil if there's no save in progress; otherwise, whether it's
+ * finished, the number of bytes written so far, and the total. Once it's
+ * finished, the error (if any) is returned as well and the save is retired.
+ * If wait is true, blocks until the save finishes. */
+
+static int pollsave_cb(lua_State* L)
+{
+    if (!savejob)
+        return 0;
+
+    if (lua_toboolean(L, 1))
+        waitforsave();
+
+    lua_pushboolean(L, savejob->finished);
+    lua_pushinteger(L, savejob->written);
+    lua_pushinteger(L, savejob->data.size() + strlen(savejob->magic));
+    if (!savejob->finished)
+        return 3;
+
+    waitforsave();
+    std::unique_ptr<SaveJob> job(savejob);
+    savejob = nullptr;
+    if (!job->error)
+    {
+        if (!job->skipped)
+            remembersave(job->filename,
+                job->crc,
+                job->data.size() + strlen(job->magic));
+        return 3;
+    }
+
+    savedfiles.erase(job->filename);
+    pusherror(L, job->error, job->renamefailed);
+    lua_remove(L, -3);
+    return 5;
+}
+
+/* --- Reader ------------------------------------------------------------- */
+
+/* This is a straight port of the old Lua loadfromstreamt(), and accepts
+ * exactly the same input (including its quirks). It only builds the raw
+ * tables; fileio.lua does the remaining fixups. */
+
+struct DumpReader
+{
+    lua_State* L;
+    const char* p;
+    const char* end;
+    std::string line;
+};
+
+/* Reads the next line, minus the terminator and any carriage returns; returns
+ * false at the end of the data. */
+
+static bool readline(DumpReader& r)
+{
+    if (r.p == r.end)
+        return false;
+
+    const char* s = r.p;
+    const char* e = (const char*)memchr(s, '\n', r.end - s);
+    if (!e)
+        e = r.end;
+    r.p = (e == r.end) ? e : e + 1;
+
+    r.line.assign(s, e - s);
+    if (memchr(s, '\r', e - s))
+        r.line.erase(
+            std::remove(r.line.begin(), r.line.end(), '\r'), r.line.end());
+    return true;
+}
+
+static bool isdigits(const char* s, size_t len)
+{
+    if (len == 0)
+        return false;
+    for (size_t i = 0; i < len; i++)
+        if ((s[i] < '0') || (s[i] > '9'))
+            return false;
+    return true;
+}
+
+/* Pushes a path element, which is a number if it looks like one. */
+
+static void pushkey(lua_State* L, const char* s, size_t len)
+{
+    if (isdigits(s, len))
+        lua_pushnumber(L, strtod(std::string(s, len).c_str(), nullptr));
+    else
+        lua_pushlstring(L, s, len);
+}
+
+/* Matches ^-?[0-9][0-9.e+-]*$, which is what the file format considers to be
+ * a number. */
+
+static bool looksnumeric(const std::string& v)
+{
+    size_t i = 0;
+    if ((i < v.size()) && (v[i] == '-'))
+        i++;
+    if ((i == v.size()) || (v[i] < '0') || (v[i] > '9'))
+        return false;
+    for (i++; i < v.size(); i++)
+    {
+        char c = v[i];
+        if (!(((c >= '0') && (c <= '9')) || (c == '.') || (c == 'e') ||
+                (c == '+') || (c == '-')))
+            return false;
+    }
+    return true;
+}
+
+static void callconstructor(lua_State* L, const char* name)
+{
+    lua_getglobal(L, name);
+    lua_call(L, 0, 1);
+}
+
+/* Documents are made with CreateDocument(), unless plain is set, when
+ * everything is a plain table. */
+
+static void readproperty(DumpReader& r, int ds, bool plain)
+{
+    lua_State* L = r.L;
+    const std::string& line = r.line;
+    luaL_checkstack(L, 8, "out of memory");
+
+    /* Equivalent to ^(.*)%.([^.:]+): (.*)$; note that the key is greedy. */
+
+    size_t dot = std::string::npos;
+    size_t colon = 0;
+    for (size_t i = line.size(); i-- > 0;)
+    {
+        if (line[i] != '.')
+            continue;
+
+        size_t j = i + 1;
+        while ((j < line.size()) && (line[j] != '.') && (line[j] != ':'))
+            j++;
+        if ((j > (i + 1)) && ((j + 1) < line.size()) && (line[j] == ':') &&
+            (line[j + 1] == ' '))
+        {
+            dot = i;
+            colon = j;
+            break;
+        }
+    }
+    if (dot == std::string::npos)
+        luaL_error(L, "malformed line when reading file: '%s'", line.c_str());
+
+    /* Walk (and create) the path to the object being modified. */
+
+    lua_pushvalue(L, ds);
+    size_t i = 0;
+    while (i < dot)
+    {
+        if (line[i] == '.')
+        {
+            i++;
+            continue;
+        }
+        size_t j = i;
+        while ((j < dot) && (line[j] != '.'))
+            j++;
+
+        pushkey(L, &line[i], j - i);
+        lua_pushvalue(L, -1);
+        lua_gettable(L, -3);
+        if (lua_isnil(L, -1) || (lua_isboolean(L, -1) && !lua_toboolean(L, -1)))
+        {
+            lua_pop(L, 1);
+
+            lua_getfield(L, ds, "documents");
+            bool isdocuments = !plain && lua_rawequal(L, -1, -3);
+            lua_pop(L, 1);
+            if (isdocuments)
+                callconstructor(L, "CreateDocument");
+            else
+                lua_newtable(L);
+
+            lua_pushvalue(L, -2);
+            lua_pushvalue(L, -2);
+            lua_settable(L, -5);
+        }
+
+        /* Replace the parent and key with the child. */
+        lua_replace(L, -3);
+        lua_pop(L, 1);
+        i = j;
+    }
+
+    /* Now the key and value. */
+
+    pushkey(L, &line[dot + 1], colon - dot - 1);
+
+    std::string v = line.substr(colon + 2);
+    if (looksnumeric(v))
+    {
+        lua_pushlstring(L, v.data(), v.size());
+        int isnum;
+        double n = lua_tonumberx(L, -1, &isnum);
+        lua_pop(L, 1);
+        if (isnum)
+            lua_pushnumber(L, n);
+        else
+            lua_pushnil(L);
+    }
+    else if (v == "true")
+        lua_pushboolean(L, true);
+    else if (v == "false")
+        lua_pushboolean(L, false);
+    else if ((v.size() >= 2) && (v.front() == '"') && (v.back() == '"'))
+    {
+        const char* inner = v.data() + 1;
+        size_t innerlen = v.size() - 2;
+        if (unescapedspan(inner, innerlen) == innerlen)
+            lua_pushlstring(L, inner, innerlen);
+        else
+        {
+            std::string copy(inner, innerlen);
+            std::string s;
+            unescapestring(s, copy.c_str(), copy.size());
+            lua_pushlstring(L, s.data(), s.size());
+        }
+    }
+    else
+        luaL_error(L,
+            "malformed property %s.%s: %s",
+            line.substr(0, dot).c_str(),
+            line.substr(dot + 1, colon - dot - 1).c_str(),
+            v.c_str());
+
+    lua_settable(L, -3);
+    lua_pop(L, 1);
+}
+
+/* Pushes the metatable which readparagraph() will give new paragraphs. */
+
+static void pushparagraphclass(lua_State* L)
+{
+    lua_getglobal(L, packparagraphs ? "PackedParagraph" : "Paragraph");
+}
+
+/* Pushes a paragraph made from one line of a document's section. */
+
+static void pushparagraph(
+    lua_State* L, const char* s, size_t len, int paragraphclass)
+{
+    luaL_checkstack(L, 4, "out of memory");
+
+    /* The first field is the style; the rest are words. */
+
+    const char* e = s + len;
+    const char* se = (const char*)memchr(s, ' ', e - s);
+    if (!se)
+        se = e;
+
+    if (packparagraphs)
+    {
+        /* The rest of the line is already in packed form. */
+
+        lua_createtable(L, 0, 2);
+        lua_pushlstring(L, s, se - s);
+        lua_setfield(L, -2, "style");
+        pushpackedwords(L, se, e - se);
+        lua_setfield(L, -2, "_words");
+        lua_pushvalue(L, paragraphclass);
+        lua_setmetatable(L, -2);
+        return;
+    }
+
+    int words = std::count(se, e, ' ');
+    lua_createtable(L, words, 1);
+
+    lua_pushlstring(L, s, se - s);
+    lua_setfield(L, -2, "style");
+
+    int wn = 1;
+    while (se != e)
+    {
+        s = se + 1;
+        se = (const char*)memchr(s, ' ', e - s);
+        if (!se)
+            se = e;
+
+        lua_pushlstring(L, s, se - s);
+        lua_rawseti(L, -2, wn++);
+    }
+
+    lua_pushvalue(L, paragraphclass);
+    lua_setmetatable(L, -2);
+}
+
+static void readparagraph(DumpReader& r, int paragraphclass)
+{
+    pushparagraph(r.L, r.line.data(), r.line.size(), paragraphclass);
+}
+
+/* Is the document the current one? (If the file doesn't say, assume they all
+ * are.) Everything else gets loaded lazily. */
+
+static bool iscurrent(lua_State* L, int ds, int doc)
+{
+    luaL_checkstack(L, 4, "out of memory");
+
+    lua_getfield(L, ds, "current");
+    if (!lua_isnumber(L, -1))
+    {
+        lua_pop(L, 1);
+        return true;
+    }
+
+    lua_getfield(L, ds, "documents");
+    lua_pushvalue(L, -2);
+    lua_gettable(L, -2);
+    bool current = lua_rawequal(L, -1, doc);
+    lua_pop(L, 3);
+    return current;
+}
+
+static void makelazy(lua_State* L, int doc, const char* text, size_t len);
+
+/* Checks the text of a document against the checksum in its properties (if
+ * it has one; older files don't). Text files get edited by hand, so rather
+ * than failing the load, the names of any documents which don't match are
+ * added to the DocumentSet's _damaged list for the user to be told about. */
+
+static void checkdocument(
+    lua_State* L, int ds, int doc, const char* start, const char* end)
+{
+    luaL_checkstack(L, 4, "out of memory");
+
+    lua_pushstring(L, "_checksum");
+    lua_rawget(L, doc);
+    if (!lua_isnumber(L, -1))
+    {
+        lua_pop(L, 1);
+        return;
+    }
+    double want = lua_tonumber(L, -1);
+    lua_pop(L, 1);
+
+    lua_pushstring(L, "_checksum");
+    lua_pushnil(L);
+    lua_rawset(L, doc);
+
+    uint32_t crc;
+    if (memchr(start, '\r', end - start))
+    {
+        std::string s(start, end - start);
+        s.erase(std::remove(s.begin(), s.end(), '\r'), s.end());
+        crc = checksum(s.data(), s.size());
+    }
+    else
+        crc = checksum(start, end - start);
+    if (crc == want)
+        return;
+
+    lua_getfield(L, ds, "_damaged");
+    if (!lua_istable(L, -1))
+    {
+        lua_pop(L, 1);
+        lua_newtable(L);
+        lua_pushvalue(L, -1);
+        lua_setfield(L, ds, "_damaged");
+    }
+    lua_getfield(L, doc, "name");
+    lua_rawseti(L, -2, lua_objlen(L, -2) + 1);
+    lua_pop(L, 1);
+}
+
+static void readdocument(DumpReader& r, int ds, int paragraphclass)
+{
+    lua_State* L = r.L;
+    luaL_checkstack(L, 4, "out of memory");
+
+    std::string id = r.line.substr(1);
+    if (id == "clipboard")
+    {
+        lua_getfield(L, ds, "clipboard");
+        if (lua_isnil(L, -1))
+            luaL_error(L, "clipboard document is missing");
+    }
+    else
+    {
+        lua_getfield(L, ds, "documents");
+        lua_pushlstring(L, id.data(), id.size());
+        int isnum;
+        double n = lua_tonumberx(L, -1, &isnum);
+        lua_pop(L, 1);
+        if (!isnum)
+            luaL_error(L, "malformed document id '%s'", id.c_str());
+
+        lua_pushnumber(L, n);
+        lua_gettable(L, -2);
+        lua_remove(L, -2);
+        if (!lua_istable(L, -1))
+            luaL_error(L, "document %s is missing", id.c_str());
+    }
+    int doc = lua_gettop(L);
+
+    const char* start = r.p;
+    const char* end = r.p;
+    if ((id != "clipboard") && !iscurrent(L, ds, doc))
+    {
+        /* Just remember where the text is. */
+
+        end = findsectionend(r.p, r.end, &r.p);
+        makelazy(L, doc, start, end - start);
+    }
+    else
+    {
+        int index = 1;
+        while (readline(r) && (r.line != "."))
+        {
+            readparagraph(r, paragraphclass);
+            lua_rawseti(L, doc, index++);
+            end = r.p;
+        }
+    }
+
+    checkdocument(L, ds, doc, start, end);
+    lua_pop(L, 1);
+}
+
+/* Pushes a new, empty DocumentSet for the loader to fill in. */
+
+static int createdocumentset(lua_State* L)
+{
+    callconstructor(L, "CreateDocumentSet");
+    int ds = lua_gettop(L);
+    callconstructor(L, "CreateMenuTree");
+    lua_setfield(L, ds, "menu");
+    lua_newtable(L);
+    lua_setfield(L, ds, "documents");
+    return ds;
+}
+
+static int loadfromstring_cb(lua_State* L)
+{
+    size_t len;
+    const char* data = checkbuffer(L, 1, &len);
+    int offset = luaL_optinteger(L, 2, 1) - 1;
+    luaL_argcheck(L, (offset >= 0) && ((size_t)offset <= len), 2, "bad offset");
+
+    DumpReader r = {L, data + offset, data + len};
+
+    pushparagraphclass(L);
+    int paragraphclass = lua_gettop(L);
+    int ds = createdocumentset(L);
+
+    while (readline(r))
+    {
+        const std::string& line = r.line;
+        if (line.empty())
+        {
+            /* Just ignore these. */
+        }
+        else if (line[0] == '.')
+            readproperty(r, ds, false);
+        else if (line[0] == '#')
+            readdocument(r, ds, paragraphclass);
+        else
+            luaL_error(
+                L, "malformed line when reading file: '%s'", line.c_str());
+    }
+
+    return 1;
+}
+
+/* --- Compressed reader -------------------------------------------------- */
+
+struct Frame
+{
+    const char* data;
+    size_t compressedsize;
+    size_t size;
+    int64_t crc = -1; /* if known */
+    std::string text;
+    bool ok;
+};
+
+/* Inflates frames [first, last). They're independent, so this is spread
+ * across as many threads as the machine has. */
+
+static void inflateframes(
+    lua_State* L, std::vector<Frame>& frames, size_t first, size_t last)
+{
+    parallelfor(last - first,
+        [&](size_t i)
+        {
+            Frame& f = frames[first + i];
+            f.ok = decompressframe(std::string_view(f.data, f.compressedsize),
+                f.size,
+                f.crc,
+                f.text);
+        });
+
+    for (size_t i = first; i < last; i++)
+        if (!frames[i].ok)
+            luaL_error(L, "compressed file is corrupt");
+}
+
+static size_t readsize(DumpReader& r, const char*& p)
+{
+    char* e;
+    unsigned long long n = strtoull(p, &e, 10);
+    if (e == p)
+        luaL_error(r.L, "malformed frame index in compressed file");
+    p = e;
+    return n;
+}
+
+/* Reads the frame index, leaving each frame pointing at its data. */
+
+static void readframeindex(DumpReader& r, std::vector<Frame>& frames)
+{
+    lua_State* L = r.L;
+    if (!readline(r))
+        luaL_error(L, "compressed file is truncated");
+    const char* p = r.line.c_str();
+    size_t count = readsize(r, p);
+    if (count == 0)
+        luaL_error(L, "compressed file has no frames");
+    if (count > (size_t)(r.end - r.p))
+        luaL_error(L, "compressed file is truncated");
+    frames.resize(count);
+
+    for (auto& f : frames)
+    {
+        if (!readline(r))
+            luaL_error(L, "compressed file is truncated");
+        p = r.line.c_str();
+        f.compressedsize = readsize(r, p);
+        f.size = readsize(r, p);
+        while (*p == ' ')
+            p++;
+        if (*p)
+            f.crc = readsize(r, p);
+        if (!plausibleframe(f.compressedsize, f.size))
+            luaL_error(L, "malformed frame index in compressed file");
+    }
+    for (auto& f : frames)
+    {
+        if (f.compressedsize > (size_t)(r.end - r.p))
+            luaL_error(L, "compressed file is truncated");
+        f.data = r.p;
+        r.p += f.compressedsize;
+    }
+}
+
+static int loadfromcompressed_cb(lua_State* L)
+{
+    size_t len;
+    const char* data = checkbuffer(L, 1, &len);
+    int offset = luaL_optinteger(L, 2, 1) - 1;
+    luaL_argcheck(L, (offset >= 0) && ((size_t)offset <= len), 2, "bad offset");
+
+    DumpReader r = {L, data + offset, data + len};
+    std::vector<Frame> frames;
+    readframeindex(r, frames);
+
+    /* The properties are needed to find out which document is current; that
+     * one gets inflated now, and the rest are left until they're used. If
+     * there isn't a current document, they all get inflated. */
+
+    inflateframes(L, frames, 0, 1);
+
+    pushparagraphclass(L);
+    int paragraphclass = lua_gettop(L);
+    int ds = createdocumentset(L);
+
+    r = {L, frames[0].text.data(), frames[0].text.data() + frames[0].size};
+    while (readline(r))
+    {
+        if (r.line.empty())
+            continue;
+        if (r.line[0] != '.')
+            luaL_error(
+                L, "malformed line when reading file: '%s'", r.line.c_str());
+        readproperty(r, ds, false);
+    }
+
+    lua_getfield(L, ds, "current");
+    size_t current = lua_tointeger(L, -1);
+    lua_pop(L, 1);
+    if ((current > 0) && (current < frames.size()))
+        inflateframes(L, frames, current, current + 1);
+    else
+        inflateframes(L, frames, 1, frames.size());
+
+    lua_getfield(L, ds, "documents");
+    int documents = lua_gettop(L);
+    for (size_t i = 1; i < frames.size(); i++)
+    {
+        Frame& f = frames[i];
+        lua_rawgeti(L, documents, i);
+        if (!lua_istable(L, -1))
+            luaL_error(L, "document %d is missing", (int)i);
+        int doc = lua_gettop(L);
+
+        if (f.text.empty() && (f.size != 0))
+        {
+            setframe(L, doc, f.data, f.compressedsize, f.size, f.crc);
+            makelazy(L, doc, nullptr, 0);
+        }
+        else
+        {
+            r = {L, f.text.data(), f.text.data() + f.size};
+            int index = 1;
+            while (readline(r))
+            {
+                readparagraph(r, paragraphclass);
+                lua_rawseti(L, doc, index++);
+            }
+
+            /* The next save doesn't need to compress this document again
+             * unless it gets changed. */
+
+            cacheframe(L, doc, f.data, f.compressedsize, f.size, f.crc);
+        }
+        lua_pop(L, 1);
+    }
+    lua_pop(L, 1);
+
+    return 1;
+}
+
+/* --- Word table reader ------------------------------------------------- */
+
+static size_t readvarint(DumpReader& r)
+{
+    size_t n = 0;
+    for (int shift = 0;; shift += 7)
+    {
+        if ((r.p == r.end) || (shift > 56))
+            luaL_error(r.L, "file with word table is truncated");
+        uint8_t b = *r.p++;
+        n |= (size_t)(b & 0x7f) << shift;
+        if (!(b & 0x80))
+            return n;
+    }
+}
+
+/* Returns a pointer to the next len bytes, and skips them. */
+
+static const char* readbytes(DumpReader& r, size_t len)
+{
+    if (len > (size_t)(r.end - r.p))
+        luaL_error(r.L, "file with word table is truncated");
+    const char* s = r.p;
+    r.p += len;
+    return s;
+}
+
+/* Reads the property lines; the data after them is left in r. */
+
+static void readwordtableproperties(DumpReader& r, int ds, bool plain)
+{
+    size_t len = readvarint(r);
+    const char* s = readbytes(r, len);
+    DumpReader pr = {r.L, s, s + len};
+    while (readline(pr))
+    {
+        if (pr.line.empty())
+            continue;
+        if (pr.line[0] != '.')
+            luaL_error(r.L,
+                "malformed line when reading file: '%s'",
+                pr.line.c_str());
+        readproperty(pr, ds, plain);
+    }
+}
+
+static int loadfromwordtable_cb(lua_State* L)
+{
+    size_t len;
+    const char* data = checkbuffer(L, 1, &len);
+    int offset = luaL_optinteger(L, 2, 1) - 1;
+    luaL_argcheck(L, (offset >= 0) && ((size_t)offset <= len), 2, "bad offset");
+
+    DumpReader r = {L, data + offset, data + len};
+
+    pushparagraphclass(L);
+    int paragraphclass = lua_gettop(L);
+    int ds = createdocumentset(L);
+    readwordtableproperties(r, ds, false);
+
+    /* Every use of a string refers to the same Lua string, so each one is
+     * only made (and hashed) once. */
+
+    size_t count = readvarint(r);
+    lua_createtable(L, std::min<size_t>(count, len), 0);
+    int strings = lua_gettop(L);
+    for (size_t i = 0; i < count; i++)
+    {
+        size_t n = readvarint(r);
+        lua_pushlstring(L, readbytes(r, n), n);
+        lua_rawseti(L, strings, i + 1);
+    }
+
+    auto pushstring = [&](size_t id)
+    {
+        if (id >= count)
+            luaL_error(L, "bad string in file with word table");
+        lua_rawgeti(L, strings, id + 1);
+    };
+
+    lua_getfield(L, ds, "documents");
+    int documents = lua_gettop(L);
+    size_t doccount = readvarint(r);
+    std::string packed;
+    for (size_t i = 1; i <= doccount; i++)
+    {
+        lua_rawgeti(L, documents, i);
+        if (!lua_istable(L, -1))
+            luaL_error(L, "document %d is missing", (int)i);
+        int doc = lua_gettop(L);
+
+        size_t paragraphs = readvarint(r);
+        for (size_t pn = 1; pn <= paragraphs; pn++)
+        {
+            luaL_checkstack(L, 4, "out of memory");
+            size_t style = readvarint(r);
+            size_t words = readvarint(r);
+
+            if (packparagraphs)
+            {
+                packed.clear();
+                for (size_t wn = 0; wn < words; wn++)
+                {
+                    pushstring(readvarint(r));
+                    size_t wl;
+                    const char* w = lua_tolstring(L, -1, &wl);
+                    packed += ' ';
+                    packed.append(w, wl);
+                    lua_pop(L, 1);
+                }
+
+                lua_createtable(L, 0, 2);
+                pushstring(style);
+                lua_setfield(L, -2, "style");
+                pushpackedwords(L, packed.data(), packed.size());
+                lua_setfield(L, -2, "_words");
+            }
+            else
+            {
+                lua_createtable(L, std::min(words, len), 1);
+                pushstring(style);
+                lua_setfield(L, -2, "style");
+                for (size_t wn = 1; wn <= words; wn++)
+                {
+                    pushstring(readvarint(r));
+                    lua_rawseti(L, -2, wn);
+                }
+            }
+
+            lua_pushvalue(L, paragraphclass);
+            lua_setmetatable(L, -2);
+            lua_rawseti(L, doc, pn);
+        }
+        lua_pop(L, 1);
+    }
+    lua_pop(L, 2);
+
+    return 1;
+}
+
+/* --- Header reader ----------------------------------------------------- */
+
+/* Reads just the property lines of a v3, v4 or v5 file (everything before
+ * the first document's text) into plain tables; nothing is constructed, and
+ * for a compressed file only the first frame is inflated. As the data is
+ * usually a mapped file, only the pages at the front of it ever get read. */
+
+static int loadheader_cb(lua_State* L)
+{
+    size_t len;
+    const char* data = checkbuffer(L, 1, &len);
+    int offset = luaL_optinteger(L, 2, 1) - 1;
+    luaL_argcheck(L, (offset >= 0) && ((size_t)offset <= len), 2, "bad offset");
+    int format = checkformat(L, 3);
+
+    DumpReader r = {L, data + offset, data + len};
+    if (format == FORMAT_WORDTABLE)
+    {
+        lua_newtable(L);
+        readwordtableproperties(r, lua_gettop(L), true);
+        return 1;
+    }
+
+    std::vector<Frame> frames;
+    if (format == FORMAT_COMPRESSED)
+    {
+        readframeindex(r, frames);
+        inflateframes(L, frames, 0, 1);
+        r = {L, frames[0].text.data(), frames[0].text.data() + frames[0].size};
+    }
+
+    lua_newtable(L);
+    int ds = lua_gettop(L);
+    while (readline(r))
+    {
+        const std::string& line = r.line;
+        if (line.empty())
+            continue;
+        if (line[0] == '#')
+            break;
+        if (line[0] != '.')
+            luaL_error(
+                L, "malformed line when reading file: '%s'", line.c_str());
+        readproperty(r, ds, true);
+    }
+
+    return 1;
+}
+
+/* --- Concatenation ----------------------------------------------------- */
+
+/* wg.concatdocumentsets(filename, inputs) writes a document set made of all
+ * the documents of each of the input files in turn, without loading any of
+ * them. Only the property lines are looked at: the documents' are copied
+ * with their numbers moved up past the documents before them (and a number
+ * added to any name which has already been used), and the documents' text
+ * is copied across untouched, even still compressed. Everything else (the
+ * settings, the current document and so on) comes from the first file,
+ * which also decides whether the output is v3 or v4. The inputs must be v3
+ * or v4 files of the same file format version. */
+
+struct ConcatDocument
+{
+    std::string_view text;
+    Frame frame;
+    bool compressed = false;
+};
+
+struct ConcatInput
+{
+    MappedFile mf = {};
+    int format = FORMAT_TEXT;
+    Frame header; /* the properties, when compressed */
+    std::string fileformat;
+    std::vector<std::string> properties;
+    std::vector<ConcatDocument> documents;
+
+    ~ConcatInput()
+    {
+        unmapfile(&mf);
+    }
+};
+
+/* Parses the document number in a line starting .documents.; returns 0 for
+ * anything else (including the documents keyed by name which old files
+ * have, and which the loader throws away). Leaves p pointing after it. */
+
+static int documentnumber(const std::string& line, size_t& p)
+{
+    static const char prefix[] = ".documents.";
+    const size_t len = sizeof(prefix) - 1;
+    if (line.compare(0, len, prefix) != 0)
+        return 0;
+
+    p = len;
+    while ((p < line.size()) && (line[p] >= '0') && (line[p] <= '9'))
+        p++;
+    if ((p == len) || (p == line.size()) || (line[p] != '.'))
+        return 0;
+    return atoi(line.c_str() + len);
+}
+
+static void readconcatinput(lua_State* L, ConcatInput& in)
+{
+    DumpReader r = {L, in.mf.data, in.mf.data + in.mf.len};
+    readline(r);
+
+    if (in.format == FORMAT_COMPRESSED)
+    {
+        std::vector<Frame> frames;
+        readframeindex(r, frames);
+        inflateframes(L, frames, 0, 1);
+        in.header = std::move(frames[0]);
+        in.documents.resize(frames.size() - 1);
+        for (size_t i = 1; i < frames.size(); i++)
+        {
+            in.documents[i - 1].frame = frames[i];
+            in.documents[i - 1].compressed = true;
+        }
+        r = {L, in.header.text.data(), in.header.text.data() + in.header.size};
+    }
+
+    while (readline(r))
+    {
+        const std::string& line = r.line;
+        if (line.empty())
+            continue;
+        if (line[0] == '.')
+        {
+            size_t p;
+            int n = documentnumber(line, p);
+            if (n > (int)in.documents.size())
+                in.documents.resize(n);
+            if (line.compare(0, 13, ".fileformat: ") == 0)
+                in.fileformat = line.substr(13);
+            in.properties.push_back(line);
+        }
+        else if ((line[0] == '#') && (in.format == FORMAT_TEXT))
+        {
+            std::string id = line.substr(1);
+            const char* start = r.p;
+            const char* end = r.p;
+            while (readline(r) && (r.line != "."))
+                end = r.p;
+
+            if (id == "clipboard")
+                continue;
+            if (!isdigits(id.data(), id.size()) || (id[0] == '0'))
+                luaL_error(L, "malformed document id '%s'", id.c_str());
+            size_t n = atoi(id.c_str());
+            if (n > in.documents.size())
+                in.documents.resize(n);
+            in.documents[n - 1].text = std::string_view(start, end - start);
+        }
+        else
+            luaL_error(
+                L, "malformed line when reading file: '%s'", line.c_str());
+    }
+}
+
+/* Adds " (2)" (or the first number which works) to a quoted name if it's
+ * been used before. */
+
+static std::string uniquename(
+    std::unordered_map<std::string, bool>& names, const std::string& value)
+{
+    std::string name = value;
+    for (int i = 2; names.count(name); i++)
+        name = value.substr(0, value.size() - 1) + " (" + std::to_string(i) +
+               ")\"";
+    names[name] = true;
+    return name;
+}
+
+static int concatdocumentsets_cb(lua_State* L)
+{
+    std::string filename = luaL_checkstring(L, 1);
+    luaL_checktype(L, 2, LUA_TTABLE);
+    int count = lua_objlen(L, 2);
+    luaL_argcheck(L, count > 0, 2, "no input files");
+
+    const std::string_view tmagic(TMAGIC, strlen(TMAGIC) - 1);
+    const std::string_view cmagic(CMAGIC, strlen(CMAGIC) - 1);
+    std::vector<ConcatInput> inputs(count);
+    for (int i = 0; i < count; i++)
+    {
+        ConcatInput& in = inputs[i];
+        lua_rawgeti(L, 2, i + 1);
+        std::string name = luaL_checkstring(L, -1);
+        lua_pop(L, 1);
+
+        if (!mapfile(name.c_str(), &in.mf))
+        {
+            std::string e = "'" + name + "' could not be opened: " +
+                            strerror(errno);
+            lua_pushnil(L);
+            lua_pushstring(L, e.c_str());
+            return 2;
+        }
+
+        DumpReader r = {L, in.mf.data, in.mf.data + in.mf.len};
+        readline(r);
+        if (r.line == cmagic)
+            in.format = FORMAT_COMPRESSED;
+        else if (r.line != tmagic)
+        {
+            std::string e = "'" + name +
+                            "' is not a WordGrinder file which can be "
+                            "concatenated (only the text and compressed "
+                            "formats can be)";
+            lua_pushnil(L);
+            lua_pushstring(L, e.c_str());
+            return 2;
+        }
+
+        readconcatinput(L, in);
+        if (in.fileformat != inputs[0].fileformat)
+        {
+            std::string e = "'" + name +
+                            "' is from a different version of WordGrinder "
+                            "to the first file; load and save it first";
+            lua_pushnil(L);
+            lua_pushstring(L, e.c_str());
+            return 2;
+        }
+    }
+
+    /* Compressed documents going into a text file have to be inflated,
+     * which can be done all at once. */
+
+    int format = inputs[0].format;
+    if (format == FORMAT_TEXT)
+        for (auto& in : inputs)
+            if (in.format == FORMAT_COMPRESSED)
+            {
+                std::vector<Frame> frames;
+                for (auto& d : in.documents)
+                    frames.push_back(d.frame);
+                inflateframes(L, frames, 0, frames.size());
+                for (size_t i = 0; i < frames.size(); i++)
+                {
+                    ConcatDocument& d = in.documents[i];
+                    d.frame.text = std::move(frames[i].text);
+                    d.text = d.frame.text;
+                    d.compressed = false;
+                }
+            }
+
+    /* The properties, renumbered. The checksums of the documents' text are
+     * properties in text files, but the frame index has them in compressed
+     * ones. */
+
+    std::string properties;
+    std::unordered_map<std::string, bool> names;
+    std::vector<ConcatDocument*> documents;
+    for (int i = 0; i < count; i++)
+    {
+        ConcatInput& in = inputs[i];
+        int offset = documents.size();
+        for (const std::string& line : in.properties)
+        {
+            size_t p;
+            int n = documentnumber(line, p);
+            if (!n)
+            {
+                if ((i == 0) && (line.compare(0, 11, ".clipboard.") != 0) &&
+                    (line.compare(0, 11, ".documents.") != 0))
+                {
+                    properties += line;
+                    properties += '\n';
+                }
+                continue;
+            }
+
+            std::string rest = line.substr(p);
+            if (rest.compare(0, 11, "._checksum:") == 0)
+            {
+                if ((format == FORMAT_COMPRESSED) ||
+                    (in.format == FORMAT_COMPRESSED))
+                    continue;
+            }
+            else if (rest.compare(0, 8, ".name: \"") == 0)
+                rest = ".name: " + uniquename(names, rest.substr(7));
+
+            properties += ".documents." + std::to_string(n + offset) + rest;
+            properties += '\n';
+        }
+
+        for (auto& d : in.documents)
+        {
+            documents.push_back(&d);
+            if ((format == FORMAT_TEXT) && (in.format == FORMAT_COMPRESSED))
+                properties += ".documents." +
+                              std::to_string(documents.size()) +
+                              "._checksum: " +
+                              std::to_string(checksum(
+                                  d.text.data(), d.text.size())) +
+                              "\n";
+        }
+    }
+
+    /* The text is written from where it already is. */
+
+    std::deque<std::string> strings;
+    std::vector<std::string_view> chunks;
+    if (format == FORMAT_TEXT)
+    {
+        chunks.push_back(TMAGIC);
+        chunks.push_back(properties);
+        for (size_t i = 0; i < documents.size(); i++)
+        {
+            chunks.push_back(
+                strings.emplace_back("#" + std::to_string(i + 1) + "\n"));
+            chunks.push_back(documents[i]->text);
+            chunks.push_back(".\n");
+        }
+    }
+    else
+    {
+        std::string& index = strings.emplace_back();
+        std::string& frame = strings.emplace_back();
+        deflateframe(L, properties, frame);
+        index += std::to_string(documents.size() + 1) + "\n";
+        index += std::to_string(frame.size()) + " " +
+                 std::to_string(properties.size()) + " " +
+                 std::to_string(checksum(properties.data(), properties.size())) +
+                 "\n";
+
+        std::vector<std::string_view> frames;
+        for (ConcatDocument* d : documents)
+        {
+            Frame& f = d->frame;
+            if (!d->compressed)
+            {
+                std::string text(d->text);
+                std::string& data = strings.emplace_back();
+                deflateframe(L, text, data);
+                f.data = data.data();
+                f.compressedsize = data.size();
+                f.size = text.size();
+                f.crc = checksum(text.data(), text.size());
+            }
+
+            index += std::to_string(f.compressedsize) + " " +
+                     std::to_string(f.size);
+            if (f.crc >= 0)
+                index += " " + std::to_string(f.crc);
+            index += "\n";
+            frames.push_back(std::string_view(f.data, f.compressedsize));
+        }
+
+        chunks = {CMAGIC, index, frame};
+        chunks.insert(chunks.end(), frames.begin(), frames.end());
+    }
+
+    bool renamefailed = false;
+    int e = writefileatomically(filename, chunks, nullptr, &renamefailed);
+    savedfiles.erase(filename);
+    if (e)
+        return pusherror(L, e, renamefailed);
+
+    lua_pushboolean(L, true);
+    return 1;
+}
+
+/* --- Document model ----------------------------------------------------- */
+
+/* Reads a document set into the core's document model (see core/document.cc)
+ * and writes it out again in the given format, which is all a conversion
+ * between the text and compressed formats needs; and, as what comes out
+ * should be exactly what saving it here would give, it lets the two be
+ * checked against each other. Returns the new data, or nil and a message. */
+
+static int recodedocumentset_cb(lua_State* L)
+{
+    size_t len;
+    const char* data = checkbuffer(L, 1, &len);
+    int format = checkformat(L, 2);
+    luaL_argcheck(L, format != FORMAT_WORDTABLE, 2, "unsupported format");
+
+    CoreDocumentSet ds;
+    std::string error;
+    std::string out;
+    if (!readcoredocumentset(std::string_view(data, len), ds, error))
+    {
+        lua_pushnil(L);
+        lua_pushstring(L, error.c_str());
+        return 2;
+    }
+    if (!writecoredocumentset(ds, format == FORMAT_COMPRESSED, out))
+        luaL_error(L, "compression failed");
+
+    lua_pushlstring(L, out.data(), out.size());
+    return 1;
+}
+
+/* --- Lazy documents ----------------------------------------------------- */
+
+/* When a file is loaded, only the current document is turned into
+ * paragraphs; the others are given the LazyDocument metatable (see
+ * documentset.lua) and keep either the text of their section (as _lazytext)
+ * or, for compressed files, their frame. The first time anything looks inside
+ * one it calls wg.materialisedocument(), which does the rest of the load (or
+ * wg.materialisedocuments(), for many at once). The writers above can save a
+ * lazy document straight from its text. */
+
+static bool islazy(lua_State* L, int doc)
+{
+    if (!lua_getmetatable(L, doc))
+        return false;
+
+    lua_getglobal(L, "LazyDocument");
+    bool lazy = lua_rawequal(L, -1, -2);
+    lua_pop(L, 2);
+    return lazy;
+}
+
+static void makelazy(lua_State* L, int doc, const char* text, size_t len)
+{
+    luaL_checkstack(L, 4, "out of memory");
+
+    if (text)
+    {
+        std::string s(text, len);
+        if (memchr(text, '\r', len))
+            s.erase(std::remove(s.begin(), s.end(), '\r'), s.end());
+
+        lua_pushstring(L, "_lazytext");
+        lua_pushlstring(L, s.data(), s.size());
+        lua_rawset(L, doc);
+    }
+
+    /* Remove the placeholder paragraph CreateDocument() adds, so that any
+     * access to the paragraphs goes through the metatable. */
+
+    lua_pushnil(L);
+    lua_rawseti(L, doc, 1);
+
+    lua_getglobal(L, "LazyDocument");
+    lua_setmetatable(L, doc);
+}
+
+/* Fetches the paragraph lines of a lazy document. */
+
+static void getlazytext(lua_State* L, int doc, std::string& text)
+{
+    luaL_checkstack(L, 4, "out of memory");
+
+    lua_pushstring(L, "_lazytext");
+    lua_rawget(L, doc);
+    if (lua_isstring(L, -1))
+    {
+        size_t len;
+        const char* s = lua_tolstring(L, -1, &len);
+        text.assign(s, len);
+        lua_pop(L, 1);
+        return;
+    }
+    lua_pop(L, 1);
+
+    lua_pushstring(L, "_dumpframe");
+    lua_rawget(L, doc);
+    lua_pushstring(L, "_dumpsize");
+    lua_rawget(L, doc);
+    size_t len;
+    const char* frame = lua_tolstring(L, -2, &len);
+    if (!frame)
+        luaL_error(L, "lazy document has no text");
+
+    size_t size = lua_tointeger(L, -1);
+    lua_pushstring(L, "_dumpchecksum");
+    lua_rawget(L, doc);
+    int64_t crc = lua_isnumber(L, -1) ? (int64_t)lua_tonumber(L, -1) : -1;
+    bool ok = decompressframe(std::string_view(frame, len), size, crc, text);
+    lua_pop(L, 3);
+    if (!ok)
+        luaL_error(L, "compressed document is corrupt");
+}
+
+/* Finishes off a document whose paragraphs [1, count] have been filled in. */
+
+static void finishmaterialising(
+    lua_State* L, int doc, int count, int paragraphclass)
+{
+    if (count == 0)
+    {
+        /* Documents always have at least one paragraph. */
+
+        pushparagraph(L, "P ", 2, paragraphclass);
+        lua_rawseti(L, doc, 1);
+    }
+
+    lua_pushstring(L, "_lazytext");
+    lua_pushnil(L);
+    lua_rawset(L, doc);
+
+    /* This is the state the document was in on disk; the journal diffs
+     * against it. */
+
+    setsnapshot(L, doc);
+
+    lua_getglobal(L, "Document");
+    lua_setmetatable(L, doc);
+}
+
+static int materialisedocument_cb(lua_State* L)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+    if (!islazy(L, 1))
+        return 0;
+
+    std::string text;
+    getlazytext(L, 1, text);
+
+    pushparagraphclass(L);
+    int paragraphclass = lua_gettop(L);
+
+    DumpReader r = {L, text.data(), text.data() + text.size()};
+    int index = 1;
+    while (readline(r))
+    {
+        readparagraph(r, paragraphclass);
+        lua_rawseti(L, 1, index++);
+    }
+    finishmaterialising(L, 1, index - 1, paragraphclass);
+    lua_pop(L, 1);
+    return 0;
+}
+
+/* Materialises a whole list of documents at once. Inflating them, checking
+ * them and finding their lines is done for all of them together, spread
+ * across as many threads as the machine has, leaving only the making of the
+ * paragraphs themselves for the interpreter. */
+
+struct LazySection
+{
+    int index;
+    const char* data; /* the text, or the frame if compressed */
+    size_t len;
+    size_t size; /* when inflated */
+    int64_t crc = -1; /* if known */
+    bool compressed;
+    std::string text;
+    std::vector<std::pair<size_t, size_t>> lines;
+    bool ok;
+};
+
+static void splitsection(LazySection& s)
+{
+    const char* text = s.data;
+    size_t len = s.len;
+    if (s.compressed)
+    {
+        s.ok = decompressframe(
+            std::string_view(s.data, s.len), s.size, s.crc, s.text);
+        if (!s.ok)
+            return;
+        text = s.text.data();
+        len = s.text.size();
+    }
+
+    splitlines(text, len, s.lines);
+    s.ok = true;
+}
+
+static int materialisedocuments_cb(lua_State* L)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+    int count = lua_objlen(L, 1);
+
+    /* The text and frames stay put while this runs, as they're still
+     * referred to by their documents. */
+
+    std::vector<LazySection> sections;
+    for (int i = 1; i <= count; i++)
+    {
+        lua_rawgeti(L, 1, i);
+        if (lua_istable(L, -1) && islazy(L, -1))
+        {
+            LazySection s = {i};
+            lua_pushstring(L, "_lazytext");
+            lua_rawget(L, -2);
+            if (lua_isstring(L, -1))
+            {
+                s.data = lua_tolstring(L, -1, &s.len);
+                s.compressed = false;
+                lua_pop(L, 1);
+            }
+            else
+            {
+                lua_pop(L, 1);
+                lua_pushstring(L, "_dumpframe");
+                lua_rawget(L, -2);
+                s.data = lua_tolstring(L, -1, &s.len);
+                lua_pop(L, 1);
+                if (!s.data)
+                    luaL_error(L, "lazy document has no text");
+
+                lua_pushstring(L, "_dumpsize");
+                lua_rawget(L, -2);
+                s.size = lua_tointeger(L, -1);
+                lua_pop(L, 1);
+                lua_pushstring(L, "_dumpchecksum");
+                lua_rawget(L, -2);
+                if (lua_isnumber(L, -1))
+                    s.crc = (int64_t)lua_tonumber(L, -1);
+                lua_pop(L, 1);
+                s.compressed = true;
+            }
+            sections.push_back(std::move(s));
+        }
+        lua_pop(L, 1);
+    }
+    if (sections.empty())
+        return 0;
+
+    parallelfor(sections.size(), [&](size_t i) { splitsection(sections[i]); });
+
+    for (auto& s : sections)
+        if (!s.ok)
+            luaL_error(L, "compressed document is corrupt");
+
+    pushparagraphclass(L);
+    int paragraphclass = lua_gettop(L);
+    for (auto& s : sections)
+    {
+        lua_rawgeti(L, 1, s.index);
+        int doc = lua_gettop(L);
+        const char* text = s.compressed ? s.text.data() : s.data;
+        int index = 1;
+        for (auto [offset, len] : s.lines)
+        {
+            pushparagraph(L, text + offset, len, paragraphclass);
+            lua_rawseti(L, doc, index++);
+        }
+        finishmaterialising(L, doc, index - 1, paragraphclass);
+        lua_pop(L, 1);
+
+        /* The text isn't needed any more. */
+
+        std::string().swap(s.text);
+    }
+    lua_pop(L, 1);
+    return 0;
+}
+
+/* --- Legacy reader ---------------------------------------------------- */
+
+/* The v1 (text) and v2 (compressed binary) formats from before 0.6. Both are
+ * a stream of tagged values; every value except a back reference gets the
+ * next slot in a cache, so that later values can refer to it by number.
+ * Tables are an array part (a count, then that many values) followed by
+ * key/value pairs up to a terminator. These are straight ports of the old
+ * Lua loaders, quirks included, and build the same raw tables; fileio.lua
+ * and UpgradeDocument() do the rest. */
+
+enum
+{
+    LEGACY_STOP = 0,
+    LEGACY_TABLE = 1,
+    LEGACY_BOOLEANTRUE = 2,
+    LEGACY_BOOLEANFALSE = 3,
+    LEGACY_STRING = 4,
+    LEGACY_NUMBER = 5,
+    LEGACY_CACHE = 6,
+    LEGACY_NEGNUMBER = 7,
+    LEGACY_BRIEFWORD = 8,
+
+    LEGACY_DOCUMENTSET = 100,
+    LEGACY_DOCUMENT = 101,
+    LEGACY_PARAGRAPH = 102,
+    LEGACY_WORD = 103,
+    LEGACY_MENU = 104
+};
+
+struct LegacyReader
+{
+    lua_State* L;
+    const char* p;
+    const char* end;
+    bool binary;
+    int cache;
+    int cachesize;
+    std::string line;
+};
+
+static void loadlegacy(LegacyReader& r);
+
+/* Unlike readline(), this keeps any carriage returns, as the old loader
+ * did. */
+
+static bool readlegacyline(LegacyReader& r)
+{
+    if (r.p == r.end)
+        return false;
+
+    const char* e = (const char*)memchr(r.p, '\n', r.end - r.p);
+    if (!e)
+        e = r.end;
+    r.line.assign(r.p, e - r.p);
+    r.p = (e == r.end) ? e : e + 1;
+    return true;
+}
+
+static size_t readlegacynumber(LegacyReader& r)
+{
+    if (r.binary)
+    {
+        if (r.p >= r.end)
+            luaL_error(r.L, "unexpected EOF when reading file");
+        return readu8(&r.p);
+    }
+
+    if (!readlegacyline(r))
+        luaL_error(r.L, "unexpected EOF when reading file");
+    char* e;
+    double n = strtod(r.line.c_str(), &e);
+    if ((e == r.line.c_str()) || *e)
+        luaL_error(r.L, "malformed number when reading file");
+    return n;
+}
+
+/* Stores the value on top of the stack in the next cache slot, leaving it
+ * there. */
+
+static void cachelegacy(LegacyReader& r)
+{
+    lua_pushvalue(r.L, -1);
+    lua_rawseti(r.L, r.cache, ++r.cachesize);
+}
+
+/* Fills in the table on top of the stack. */
+
+static void populatelegacy(LegacyReader& r)
+{
+    lua_State* L = r.L;
+    luaL_checkstack(L, 4, "file is too deeply nested");
+    int t = lua_gettop(L);
+
+    size_t n = readlegacynumber(r);
+    for (size_t i = 1; i <= n; i++)
+    {
+        loadlegacy(r);
+        lua_rawseti(L, t, i);
+    }
+
+    for (;;)
+    {
+        loadlegacy(r);
+        if (!lua_toboolean(L, -1))
+        {
+            lua_pop(L, 1);
+            break;
+        }
+        loadlegacy(r);
+        lua_settable(L, t);
+    }
+}
+
+static void loadlegacyobject(LegacyReader& r, const char* classname)
+{
+    lua_State* L = r.L;
+    lua_newtable(L);
+    if (classname)
+    {
+        lua_getglobal(L, classname);
+        lua_setmetatable(L, -2);
+    }
+    cachelegacy(r);
+    populatelegacy(r);
+}
+
+/* Words used to be objects of their own; they've been replaced with simple
+ * strings. The cache slot has to be taken before the fields are read, or
+ * the numbers all go wrong. */
+
+static void loadlegacyword(LegacyReader& r)
+{
+    lua_State* L = r.L;
+    int slot = ++r.cachesize;
+    lua_newtable(L);
+    lua_pushvalue(L, -1);
+    lua_rawseti(L, r.cache, slot);
+
+    populatelegacy(r);
+    lua_getfield(L, -1, "text");
+    lua_remove(L, -2);
+    lua_pushvalue(L, -1);
+    lua_rawseti(L, r.cache, slot);
+}
+
+static void loadlegacytext(LegacyReader& r)
+{
+    lua_State* L = r.L;
+    if (!readlegacyline(r))
+        luaL_error(L, "unexpected EOF when reading file");
+    const std::string& s = r.line;
+
+    if (!s.empty())
+    {
+        char* e;
+        double n = strtod(s.c_str(), &e);
+        if (!*e)
+        {
+            lua_rawgeti(L, r.cache, (int)n);
+            return;
+        }
+    }
+
+    if (s == "DS")
+        loadlegacyobject(r, "DocumentSet");
+    else if (s == "D")
+        loadlegacyobject(r, "Document");
+    else if (s == "P")
+        loadlegacyobject(r, "Paragraph");
+    else if (s == "W")
+        loadlegacyword(r);
+    else if (s == "M")
+        loadlegacyobject(r, "MenuTree");
+    else if (s == "T")
+        loadlegacyobject(r, nullptr);
+    else if (s == "S")
+    {
+        if (readlegacyline(r))
+            lua_pushlstring(L, r.line.data(), r.line.size());
+        else
+            lua_pushnil(L);
+        cachelegacy(r);
+    }
+    else if (s == "N")
+    {
+        if (readlegacyline(r))
+        {
+            lua_pushlstring(L, r.line.data(), r.line.size());
+            if (lua_isnumber(L, -1))
+                lua_pushnumber(L, lua_tonumber(L, -1));
+            else
+                lua_pushnil(L);
+            lua_remove(L, -2);
+        }
+        else
+            lua_pushnil(L);
+        cachelegacy(r);
+    }
+    else if (s == "B")
+    {
+        lua_pushboolean(L, readlegacyline(r) && (r.line == "T"));
+        cachelegacy(r);
+    }
+    else if (s == ".")
+        lua_pushnil(L);
+    else
+        luaL_error(L, "can't load type %s", s.c_str());
+}
+
+static void loadlegacybinary(LegacyReader& r)
+{
+    lua_State* L = r.L;
+    size_t type = readlegacynumber(r);
+    switch (type)
+    {
+        case LEGACY_CACHE:
+            lua_rawgeti(L, r.cache, readlegacynumber(r));
+            break;
+
+        case LEGACY_DOCUMENTSET:
+            loadlegacyobject(r, "DocumentSet");
+            break;
+
+        case LEGACY_DOCUMENT:
+            loadlegacyobject(r, "Document");
+            break;
+
+        case LEGACY_PARAGRAPH:
+            loadlegacyobject(r, "Paragraph");
+            break;
+
+        case LEGACY_WORD:
+            loadlegacyword(r);
+            break;
+
+        case LEGACY_BRIEFWORD:
+            loadlegacy(r);
+            cachelegacy(r);
+            break;
+
+        case LEGACY_MENU:
+            loadlegacyobject(r, "MenuTree");
+            break;
+
+        case LEGACY_TABLE:
+            loadlegacyobject(r, nullptr);
+            break;
+
+        case LEGACY_STRING:
+        {
+            size_t len = readlegacynumber(r);
+            if (len > (size_t)(r.end - r.p))
+                luaL_error(L, "unexpected EOF when reading file");
+            lua_pushlstring(L, r.p, len);
+            r.p += len;
+            cachelegacy(r);
+            break;
+        }
+
+        case LEGACY_NUMBER:
+            lua_pushnumber(L, readlegacynumber(r));
+            cachelegacy(r);
+            break;
+
+        case LEGACY_NEGNUMBER:
+            lua_pushnumber(L, -(double)readlegacynumber(r));
+            cachelegacy(r);
+            break;
+
+        case LEGACY_BOOLEANTRUE:
+            lua_pushboolean(L, true);
+            cachelegacy(r);
+            break;
+
+        case LEGACY_BOOLEANFALSE:
+            lua_pushboolean(L, false);
+            cachelegacy(r);
+            break;
+
+        case LEGACY_STOP:
+            lua_pushnil(L);
+            break;
+
+        default:
+            luaL_error(L, "can't load type %d", (int)type);
+    }
+}
+
+/* Pushes the next value. */
+
+static void loadlegacy(LegacyReader& r)
+{
+    luaL_checkstack(r.L, 4, "file is too deeply nested");
+    if (r.binary)
+        loadlegacybinary(r);
+    else
+        loadlegacytext(r);
+}
+
+/* wg.loadfromlegacy(data, offset, compressed): the v2 format is the v1
+ * format's values in binary, the whole thing deflated. */
+
+static int loadfromlegacy_cb(lua_State* L)
+{
+    size_t len;
+    const char* data = checkbuffer(L, 1, &len);
+    int offset = luaL_optinteger(L, 2, 1) - 1;
+    luaL_argcheck(L, (offset >= 0) && ((size_t)offset <= len), 2, "bad offset");
+    bool compressed = lua_toboolean(L, 3);
+
+    if (compressed)
+    {
+        lua_getglobal(L, "wg");
+        lua_getfield(L, -1, "decompress");
+        lua_pushlstring(L, data + offset, len - offset);
+        lua_call(L, 1, 1);
+        if (!lua_isstring(L, -1))
+            luaL_error(L, "compressed file is corrupt");
+        data = lua_tolstring(L, -1, &len);
+        offset = 0;
+    }
+
+    lua_newtable(L);
+    LegacyReader r = {L, data + offset, data + len, compressed, lua_gettop(L), 0};
+    loadlegacy(r);
+    return 1;
+}
+
+/* Returns the CRC of a string or mapped file; used to recognise a file
+ * whose contents have been seen before. */
+
+static int checksum_cb(lua_State* L)
+{
+    size_t len;
+    const char* data = checkbuffer(L, 1, &len);
+    lua_pushnumber(L, checksum(data, len));
+    return 1;
+}
+
+void dumpfile_init(void)
+{
+    const static luaL_Reg funcs[] = {
+        {"checksum",             checksum_cb            },
+        {"concatdocumentsets",   concatdocumentsets_cb  },
+        {"loadfromcompressed",   loadfromcompressed_cb  },
+        {"loadfromlegacy",       loadfromlegacy_cb      },
+        {"loadheader",           loadheader_cb          },
+        {"loadfromstring",       loadfromstring_cb      },
+        {"loadfromwordtable",    loadfromwordtable_cb   },
+        {"materialisedocument",  materialisedocument_cb },
+        {"materialisedocuments", materialisedocuments_cb},
+        {"pollsave",             pollsave_cb            },
+        {"recodedocumentset",    recodedocumentset_cb   },
+        {"savedocumentset",      savedocumentset_cb     },
+        {"savetostring",         savetostring_cb        },
+        {"startsave",            startsave_cb           },
+        {NULL,                   NULL                   }
+    };
+
+    luaL_register(L, "wg", funcs);
+
+    /* Make sure an in-flight save reaches the disk before we go away. */
+
+    atexit(waitforsave);
+}
+
+// vim: sw=4 ts=4 et
@@ -0,0 +1,835 @@
+/* © 2026 David Given.
+ * WordGrinder is licensed under the MIT open source license. See the COPYING
+ * file in this distribution for the full text.
+ */
+
+#include "globals.h"
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/* Native versions of the commonest exporters. exportdocument() walks the
+ * document exactly as ExportFileUsingCallbacks() in export.lua does, calling
+ * the methods of an ExportFormat rather than Lua callbacks, and each format
+ * appends its output to one growing string. The Lua exporters remain the
+ * reference implementations; the tests check that both agree. */
+
+struct ExportParagraph
+{
+    std::string_view style;
+    int number;
+};
+
+struct ExportFormat
+{
+    std::string out;
+
+    virtual ~ExportFormat() {}
+
+    virtual void prologue() {}
+    virtual void epilogue() {}
+    virtual void paragraphstart(const ExportParagraph& p) {}
+    virtual void paragraphend(const ExportParagraph& p) {}
+    virtual void liststart(std::string_view name) {}
+    virtual void listend(std::string_view name) {}
+
+    virtual void text(std::string_view s)
+    {
+        out += s;
+    }
+
+    virtual void rawtext(std::string_view s)
+    {
+        out += s;
+    }
+
+    virtual void notext() {}
+    virtual void italicon() {}
+    virtual void italicoff() {}
+    virtual void boldon() {}
+    virtual void boldoff() {}
+    virtual void underlineon() {}
+    virtual void underlineoff() {}
+};
+
+/* Where exportdocument() gets the paragraphs from. The Lua document can
+ * only be read on the main thread, so for exports on other threads it's
+ * copied into a snapshot first. */
+
+struct ExportSource
+{
+    virtual ~ExportSource() {}
+
+    /* Moves to paragraph pn, returning false if there isn't one. */
+    virtual bool paragraph(int pn, std::string& style, int& number) = 0;
+    virtual void endparagraph() {}
+    virtual bool islist(std::string_view style) = 0;
+    virtual void foreachword(
+        const std::function<void(const char*, size_t)>& cb) = 0;
+    virtual const WordMetrics& metrics(const char* s, size_t len) = 0;
+};
+
+struct LuaSource : ExportSource
+{
+    lua_State* L;
+    int doc;
+    int index = 0;
+    std::map<std::string, bool, std::less<>> lists;
+
+    LuaSource(lua_State* L, int doc): L(L), doc(doc)
+    {
+        luaL_checkstack(L, 4, "out of memory");
+    }
+
+    bool paragraph(int pn, std::string& style, int& number) override
+    {
+        lua_rawgeti(L, doc, pn);
+        if (lua_isnil(L, -1))
+        {
+            lua_pop(L, 1);
+            return false;
+        }
+        index = lua_gettop(L);
+
+        lua_getfield(L, index, "style");
+        size_t len;
+        const char* s = luaL_checklstring(L, -1, &len);
+        style.assign(s, len);
+        lua_getfield(L, index, "number");
+        number = (int)lua_tointeger(L, -1);
+        lua_pop(L, 2);
+        return true;
+    }
+
+    void endparagraph() override
+    {
+        lua_pop(L, 1);
+    }
+
+    /* Returns whether the named paragraph style is a list style, according
+     * to documentStyles. */
+
+    bool islist(std::string_view name) override
+    {
+        auto i = lists.find(name);
+        if (i != lists.end())
+            return i->second;
+
+        lua_getglobal(L, "documentStyles");
+        lua_pushlstring(L, name.data(), name.size());
+        lua_gettable(L, -2);
+        if (!lua_istable(L, -1))
+            luaL_error(
+                L, "unknown paragraph style '%s'", std::string(name).c_str());
+        lua_getfield(L, -1, "list");
+        bool list = lua_toboolean(L, -1);
+        lua_pop(L, 3);
+
+        lists.emplace(name, list);
+        return list;
+    }
+
+    void foreachword(
+        const std::function<void(const char*, size_t)>& cb) override
+    {
+        foreachparagraphword(L, index, cb);
+    }
+
+    const WordMetrics& metrics(const char* s, size_t len) override
+    {
+        return getwordmetrics(s, len);
+    }
+};
+
+struct SnapshotSource : ExportSource
+{
+    struct Paragraph
+    {
+        std::string style;
+        int number;
+        std::vector<std::string> words;
+    };
+
+    std::vector<Paragraph> paragraphs;
+    std::map<std::string, bool, std::less<>> lists;
+    const Paragraph* current = nullptr;
+
+    /* The word cache isn't thread safe, so each snapshot keeps its own. */
+    std::unordered_map<std::string_view, std::unique_ptr<WordMetrics>> cache;
+
+    /* Copies the document at doc; must be called on the main thread. */
+    SnapshotSource(lua_State* L, int doc)
+    {
+        LuaSource src(L, doc);
+        std::string style;
+        int number;
+        for (int pn = 1; src.paragraph(pn, style, number); pn++)
+        {
+            Paragraph& p = paragraphs.emplace_back();
+            p.style = style;
+            p.number = number;
+            lists.emplace(style, src.islist(style));
+            src.foreachword(
+                [&](const char* w, size_t len)
+                {
+                    p.words.emplace_back(w, len);
+                });
+            src.endparagraph();
+        }
+    }
+
+    bool paragraph(int pn, std::string& style, int& number) override
+    {
+        if (pn > (int)paragraphs.size())
+            return false;
+        current = &paragraphs[pn - 1];
+        style = current->style;
+        number = current->number;
+        return true;
+    }
+
+    bool islist(std::string_view style) override
+    {
+        return lists.find(style)->second;
+    }
+
+    void foreachword(
+        const std::function<void(const char*, size_t)>& cb) override
+    {
+        for (const auto& w : current->words)
+            cb(w.data(), w.size());
+    }
+
+    const WordMetrics& metrics(const char* s, size_t len) override
+    {
+        auto i = cache.find(std::string_view(s, len));
+        if (i != cache.end())
+            return *i->second;
+
+        /* The key points into the snapshot, which outlives the cache. */
+        auto m = std::make_unique<WordMetrics>();
+        computewordmetrics(s, len, *m);
+        const WordMetrics& result = *m;
+        cache.emplace(std::string_view(s, len), std::move(m));
+        return result;
+    }
+};
+
+/* Styles are turned on in the order italic, bold, underline, and recorded
+ * as they are, so that they're always turned off in the reverse order; a
+ * change of style only turns off what it has to (and whatever was turned on
+ * after that). */
+
+struct StyleStack
+{
+    ExportFormat& f;
+    int open[3];
+    int depth = 0;
+
+    void on(int style)
+    {
+        switch (style)
+        {
+            case DPY_ITALIC:
+                f.italicon();
+                break;
+            case DPY_BOLD:
+                f.boldon();
+                break;
+            case DPY_UNDERLINE:
+                f.underlineon();
+                break;
+        }
+        open[depth++] = style;
+    }
+
+    void off()
+    {
+        switch (open[--depth])
+        {
+            case DPY_ITALIC:
+                f.italicoff();
+                break;
+            case DPY_BOLD:
+                f.boldoff();
+                break;
+            case DPY_UNDERLINE:
+                f.underlineoff();
+                break;
+        }
+    }
+
+    void set(int style)
+    {
+        int keep = 0;
+        while ((keep < depth) && (style & open[keep]))
+            keep++;
+        while (depth > keep)
+            off();
+
+        int current = 0;
+        for (int i = 0; i < depth; i++)
+            current |= open[i];
+        for (int s : {DPY_ITALIC, DPY_BOLD, DPY_UNDERLINE})
+            if ((style & s) && !(current & s))
+                on(s);
+    }
+};
+
+static void exportparagraph(ExportSource& src, ExportFormat& f, bool rawmode)
+{
+    StyleRuns sr;
+    src.foreachword(
+        [&](const char* w, size_t len)
+        {
+            sr.addword(w, src.metrics(w, len));
+        });
+
+    StyleStack styles = {f};
+    for (const auto& run : sr.runs)
+    {
+        styles.set(run.style);
+        std::string_view s(sr.text.data() + run.offset, run.length);
+        if (rawmode)
+            f.rawtext(s);
+        else
+            f.text(s);
+    }
+    styles.set(0);
+}
+
+/* Returns whether the current paragraph consists of a single empty word. */
+
+static bool isempty(ExportSource& src)
+{
+    int words = 0;
+    bool empty = true;
+    src.foreachword(
+        [&](const char* w, size_t len)
+        {
+            words++;
+            empty = empty && (len == 0);
+        });
+    return (words == 1) && empty;
+}
+
+/* Output is handed to the sink, if there is one, whenever this much has
+ * built up. */
+
+static const size_t EXPORTFLUSHSIZE = 64 * 1024;
+
+typedef std::function<void(std::string_view)> ExportSink;
+
+static void exportdocument(
+    ExportSource& src, ExportFormat& f, const ExportSink& sink)
+{
+    std::string listmode;
+    std::string style;
+    int number;
+
+    f.prologue();
+    for (int pn = 1; src.paragraph(pn, style, number); pn++)
+    {
+        ExportParagraph p = {style, number};
+
+        bool list = src.islist(style);
+        if (!listmode.empty() && !list)
+        {
+            f.listend(listmode);
+            listmode.clear();
+        }
+        if (listmode.empty() && list)
+        {
+            f.liststart(style);
+            listmode = style;
+        }
+
+        f.paragraphstart(p);
+        if (isempty(src))
+            f.notext();
+        else
+            exportparagraph(src, f, style == "RAW");
+        f.paragraphend(p);
+
+        src.endparagraph();
+
+        if (sink && (f.out.size() >= EXPORTFLUSHSIZE))
+        {
+            sink(f.out);
+            f.out.clear();
+        }
+    }
+    if (!listmode.empty())
+        f.listend(listmode);
+    f.epilogue();
+}
+
+/* --- Plain text -------------------------------------------------------- */
+
+struct TextFormat : ExportFormat
+{
+    void paragraphend(const ExportParagraph& p) override
+    {
+        out += '\n';
+    }
+};
+
+/* --- Markdown ---------------------------------------------------------- */
+
+struct MarkdownStyle
+{
+    const char* name;
+    bool pre;
+    const char* on;
+    const char* off;
+};
+
+static const MarkdownStyle markdownstyles[] = {
+    {"H1",  false, "# ",    "\n"},
+    {"H2",  false, "## ",   "\n"},
+    {"H3",  false, "### ",  "\n"},
+    {"H4",  false, "#### ", "\n"},
+    {"P",   false, "",      "\n"},
+    {"L",   false, "- ",    ""  },
+    {"LB",  false, "- ",    ""  },
+    {"LN",  false, "1. ",   ""  },
+    {"Q",   false, "> ",    "\n"},
+    {"V",   false, "> ",    "\n"},
+    {"RAW", false, "    ",  ""  },
+    {"PRE", true,  "`",     "`" },
+};
+
+struct MarkdownFormat : ExportFormat
+{
+    const MarkdownStyle* current = nullptr;
+
+    static const MarkdownStyle* find(std::string_view name)
+    {
+        for (const auto& s : markdownstyles)
+            if (name == s.name)
+                return &s;
+        return nullptr;
+    }
+
+    void changepara(const ExportParagraph* p)
+    {
+        const MarkdownStyle* next = p ? find(p->style) : nullptr;
+
+        if ((next != current) || !p || !current || !current->pre || !next->pre)
+        {
+            if (current)
+                out += current->off;
+            out += '\n';
+            if (next)
+                out += next->on;
+            current = next;
+        }
+        else
+            out += '\n';
+    }
+
+    void text(std::string_view s) override
+    {
+        for (size_t i = 0; i < s.size(); i++)
+        {
+            char c = s[i];
+            switch (c)
+            {
+                case '-':
+                    if ((i + 1 < s.size()) && (s[i + 1] == ' '))
+                        out += '\\';
+                    break;
+
+                case '#':
+                case '<':
+                case '>':
+                case '`':
+                case '_':
+                case '*':
+                    out += '\\';
+                    break;
+            }
+            out += c;
+        }
+    }
+
+    void italicon() override
+    {
+        out += "<i>";
+    }
+
+    void italicoff() override
+    {
+        out += "</i>";
+    }
+
+    void underlineon() override
+    {
+        out += "<u>";
+    }
+
+    void underlineoff() override
+    {
+        out += "</u>";
+    }
+
+    void boldon() override
+    {
+        out += "<b>";
+    }
+
+    void boldoff() override
+    {
+        out += "</b>";
+    }
+
+    void liststart(std::string_view name) override
+    {
+        out += '\n';
+    }
+
+    void listend(std::string_view name) override
+    {
+        out += '\n';
+    }
+
+    void paragraphstart(const ExportParagraph& p) override
+    {
+        changepara(&p);
+    }
+
+    void epilogue() override
+    {
+        changepara(nullptr);
+    }
+};
+
+/* --- HTML -------------------------------------------------------------- */
+
+struct HTMLStyle
+{
+    const char* name;
+    bool pre;
+    bool list;
+    const char* on; /* null for numbered list items */
+    const char* off;
+};
+
+static const HTMLStyle htmlstyles[] = {
+    {"H1",  false, false, "<h1>",                               "</h1>"        },
+    {"H2",  false, false, "<h2>",                               "</h2>"        },
+    {"H3",  false, false, "<h3>",                               "</h3>"        },
+    {"H4",  false, false, "<h4>",                               "</h4>"        },
+    {"P",   false, false, "<p>",                                "</p>"         },
+    {"L",   false, true,  "<li style=\"list-style-type: none;\">", "</li>"     },
+    {"LB",  false, true,  "<li>",                               "</li>"        },
+    {"LN",  false, true,  nullptr,                              "</li>"        },
+    {"Q",   false, false, "<blockquote>",                       "</blockquote>"},
+    {"V",   false, false, "<blockquote>",                       "</blockquote>"},
+    {"RAW", false, false, "",                                   ""             },
+    {"PRE", true,  false, "<pre>",                              "</pre>"       },
+};
+
+static void unhtml(std::string& out, std::string_view s)
+{
+    escapehtml(out, s.data(), s.size(), nullptr);
+}
+
+struct HTMLFormat : ExportFormat
+{
+    std::string title;
+    std::string version;
+    std::string italic_on, italic_off;
+    std::string underline_on, underline_off;
+    std::string bold_on, bold_off;
+
+    const HTMLStyle* current = nullptr;
+    bool inlist = false;
+
+    static const HTMLStyle* find(std::string_view name)
+    {
+        for (const auto& s : htmlstyles)
+            if (name == s.name)
+                return &s;
+        return nullptr;
+    }
+
+    void changepara(const ExportParagraph* p)
+    {
+        const HTMLStyle* next = p ? find(p->style) : nullptr;
+
+        if ((next != current) || !p || !current || !current->pre || !next->pre)
+        {
+            if (current)
+                out += current->off;
+            out += '\n';
+
+            if ((!next || !next->list) && inlist)
+            {
+                out += "</ul>\n";
+                inlist = false;
+            }
+            if ((next && next->list) && !inlist)
+            {
+                inlist = true;
+                out += "<ul>\n";
+            }
+
+            if (next)
+            {
+                if (!next->on)
+                {
+                    char buffer[80];
+                    snprintf(buffer,
+                        sizeof(buffer),
+                        "<li style=\"list-style-type: decimal;\" value=%d>",
+                        p->number);
+                    out += buffer;
+                }
+                else
+                    out += next->on;
+            }
+            current = next;
+        }
+        else
+            out += '\n';
+    }
+
+    void prologue() override
+    {
+        out += "<html xmlns=\"http://www.w3.org/1999/xhtml\"><head>\n";
+        out += "<meta http-equiv=\"Content-Type\" "
+               "content=\"text/html;charset=utf-8\"/>\n";
+        out += "<meta name=\"generator\" content=\"WordGrinder ";
+        out += version;
+        out += "\"/>\n";
+        out += "<title>";
+        unhtml(out, title);
+        out += "</title>\n";
+        out += "</head><body>\n";
+    }
+
+    void text(std::string_view s) override
+    {
+        unhtml(out, s);
+    }
+
+    void notext() override
+    {
+        if (!current || (strcmp(current->name, "PRE") != 0))
+            out += "<br/>";
+    }
+
+    void italicon() override
+    {
+        out += italic_on;
+    }
+
+    void italicoff() override
+    {
+        out += italic_off;
+    }
+
+    void underlineon() override
+    {
+        out += underline_on;
+    }
+
+    void underlineoff() override
+    {
+        out += underline_off;
+    }
+
+    void boldon() override
+    {
+        out += bold_on;
+    }
+
+    void boldoff() override
+    {
+        out += bold_off;
+    }
+
+    void paragraphstart(const ExportParagraph& p) override
+    {
+        changepara(&p);
+    }
+
+    void epilogue() override
+    {
+        changepara(nullptr);
+        out += "</body>\n";
+        out += "</html>\n";
+    }
+};
+
+static std::string getstringfield(lua_State* L, int index, const char* field)
+{
+    lua_getfield(L, index, field);
+    size_t len;
+    const char* s = lua_tolstring(L, -1, &len);
+    std::string result = s ? std::string(s, len) : "";
+    lua_pop(L, 1);
+    return result;
+}
+
+/* Creates the exporter for the named format ("text", "markdown" or
+ * "html") for the document at doc; the HTML exporter takes its style tags
+ * from the settings table. Returns null for an unknown format. */
+
+static std::unique_ptr<ExportFormat> createformat(
+    lua_State* L, int doc, const char* format, int settings)
+{
+    if (strcmp(format, "text") == 0)
+        return std::make_unique<TextFormat>();
+    if (strcmp(format, "markdown") == 0)
+        return std::make_unique<MarkdownFormat>();
+    if (strcmp(format, "html") == 0)
+    {
+        luaL_checktype(L, settings, LUA_TTABLE);
+        auto html = std::make_unique<HTMLFormat>();
+        html->title = getstringfield(L, doc, "name");
+        lua_getglobal(L, "VERSION");
+        const char* version = lua_tostring(L, -1);
+        html->version = version ? version : "";
+        lua_pop(L, 1);
+        html->italic_on = getstringfield(L, settings, "italic_on");
+        html->italic_off = getstringfield(L, settings, "italic_off");
+        html->underline_on = getstringfield(L, settings, "underline_on");
+        html->underline_off = getstringfield(L, settings, "underline_off");
+        html->bold_on = getstringfield(L, settings, "bold_on");
+        html->bold_off = getstringfield(L, settings, "bold_off");
+        return html;
+    }
+    return nullptr;
+}
+
+/* wg.exportdocument(document, format, settings, writer) renders the document
+ * in one of the formats above. The output is streamed to the writer (see
+ * wg.openwriter()) if one is given, and returned as a string otherwise. The
+ * caller must renumber and materialise the document first. */
+
+static int exportdocument_cb(lua_State* L)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+    const char* format = luaL_checkstring(L, 2);
+
+    std::unique_ptr<ExportFormat> f = createformat(L, 1, format, 3);
+    if (!f)
+        luaL_argerror(L, 2, "unknown export format");
+
+    Writer* sink = towriter(L, 4);
+    LuaSource src(L, 1);
+    if (sink)
+    {
+        auto write = [&](std::string_view s)
+        {
+            writetowriter(sink, s.data(), s.size());
+        };
+        exportdocument(src, *f, write);
+        write(f->out);
+        return 0;
+    }
+    exportdocument(src, *f, nullptr);
+    lua_pushlstring(L, f->out.data(), f->out.size());
+    return 1;
+}
+
+/* wg.exportdocuments(documents, filenames, format, settings) exports each
+ * document to the corresponding file, as wg.exportdocument() would, but
+ * concurrently, with one thread per core. The documents are copied first,
+ * so the caller gets control back with them unchanged; as before, they must
+ * have been renumbered and materialised. Returns an array with, for each
+ * document, true or an error message. */
+
+struct ExportJob
+{
+    std::unique_ptr<SnapshotSource> src;
+    std::unique_ptr<ExportFormat> format;
+    std::string filename;
+    int error = 0;
+};
+
+static int exportdocuments_cb(lua_State* L)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+    luaL_checktype(L, 2, LUA_TTABLE);
+    const char* format = luaL_checkstring(L, 3);
+
+    int count = lua_objlen(L, 1);
+    std::vector<ExportJob> jobs(count);
+    for (int i = 0; i < count; i++)
+    {
+        ExportJob& job = jobs[i];
+        lua_rawgeti(L, 2, i + 1);
+        job.filename = luaL_checkstring(L, -1);
+        lua_pop(L, 1);
+
+        lua_rawgeti(L, 1, i + 1);
+        int doc = lua_gettop(L);
+        luaL_checktype(L, doc, LUA_TTABLE);
+        job.format = createformat(L, doc, format, 4);
+        if (!job.format)
+            luaL_argerror(L, 3, "unknown export format");
+        job.src = std::make_unique<SnapshotSource>(L, doc);
+        lua_pop(L, 1);
+    }
+
+    std::atomic<int> next = 0;
+    auto worker = [&]
+    {
+        for (;;)
+        {
+            int i = next++;
+            if (i >= count)
+                break;
+
+            ExportJob& job = jobs[i];
+            exportdocument(*job.src, *job.format, nullptr);
+            job.src.reset();
+            job.error =
+                writefileatomically(job.filename, {job.format->out});
+            job.format.reset();
+        }
+    };
+
+    int threads = std::min<int>(
+        count, std::max(std::thread::hardware_concurrency(), 1U));
+    std::vector<std::thread> pool;
+    for (int i = 1; i < threads; i++)
+        pool.emplace_back(worker);
+    worker();
+    for (auto& t : pool)
+        t.join();
+
+    lua_createtable(L, count, 0);
+    for (int i = 0; i < count; i++)
+    {
+        if (jobs[i].error)
+            lua_pushstring(L, strerror(jobs[i].error));
+        else
+            lua_pushboolean(L, true);
+        lua_rawseti(L, -2, i + 1);
+    }
+    return 1;
+}
+
+void export_init(void)
+{
+    const static luaL_Reg funcs[] = {
+        {"exportdocument",  exportdocument_cb },
+        {"exportdocuments", exportdocuments_cb},
+        {NULL,              NULL              }
+    };
+
+    luaL_register(L, "wg", funcs);
+    lua_pop(L, 1);
+}
+
+// vim: sw=4 ts=4 et
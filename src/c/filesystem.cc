@@ -10,13 +10,25 @@
 #include <string.h>
 #include <unistd.h>
 #include <dirent.h>
+#include <fcntl.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <filesystem>
 #include <fmt/format.h>
 
 #ifdef WIN32
 #include <windows.h>
 #include <rpc.h>
+#include <io.h>
+#else
+#include <sys/mman.h>
+#include <sys/uio.h>
+#include <limits.h>
 #endif
 
 static int pusherrno(lua_State* L)
@@ -27,6 +39,28 @@ static int pusherrno(lua_State* L)
     return 3;
 }
 
+/* The filename "-" means stdin or stdout, for using WordGrinder in
+ * pipelines. */
+
+static bool isstdio(const char* filename)
+{
+    return strcmp(filename, "-") == 0;
+}
+
+static FILE* openstdio(FILE* fp)
+{
+#if defined WIN32
+    _setmode(_fileno(fp), _O_BINARY);
+#endif
+    return fp;
+}
+
+static void closeinput(FILE* fp)
+{
+    if (fp != stdin)
+        fclose(fp);
+}
+
 #ifdef WIN32
 static std::string createUuid()
 {
@@ -175,6 +209,17 @@ static int stat_cb(lua_State* L)
             lua_pushstring(L, "mode");
             lua_pushstring(L, "file");
             lua_settable(L, -3);
+
+            /* Only good for telling whether the file has changed; the epoch
+             * isn't anything in particular. */
+
+            lua_pushstring(L, "mtime");
+            lua_pushnumber(L,
+                std::chrono::duration<double>(
+                    std::filesystem::last_write_time(filename, ec)
+                        .time_since_epoch())
+                    .count());
+            lua_settable(L, -3);
             return 1;
     }
 }
@@ -264,9 +309,32 @@ static int readfile_cb(lua_State* L)
 {
     const char* filename = luaL_checklstring(L, 1, nullptr);
 
-    FILE* fp = fopen(filename, "rb");
+    FILE* fp = isstdio(filename) ? openstdio(stdin) : fopen(filename, "rb");
     if (!fp)
-        goto error;
+        return pusherrno(L);
+
+    /* Read straight into a buffer of the right size, if we can find out what
+     * it is; otherwise fall back to reading in chunks. */
+
+    struct stat st;
+    if ((fstat(fileno(fp), &st) == 0) && S_ISREG(st.st_mode))
+    {
+        size_t size = st.st_size;
+        luaL_Strbuf buffer;
+        char* p = luaL_buffinitsize(L, &buffer, size);
+
+        size_t i = fread(p, 1, size, fp);
+        if (ferror(fp))
+        {
+            pusherrno(L);
+            closeinput(fp);
+            return 3;
+        }
+
+        closeinput(fp);
+        luaL_pushresultsize(&buffer, i);
+        return 1;
+    }
 
     luaL_Buffer buffer;
     luaL_buffinit(L, &buffer);
@@ -277,30 +345,821 @@ static int readfile_cb(lua_State* L)
         size_t i = fread(b, 1, LUA_BUFFERSIZE, fp);
         if (i == 0)
             break;
-        if (i < 0)
-            goto error;
 
         luaL_addlstring(&buffer, b, i);
     }
 
-    fclose(fp);
+    if (ferror(fp))
+    {
+        pusherrno(L);
+        closeinput(fp);
+        return 3;
+    }
+
+    closeinput(fp);
     luaL_pushresult(&buffer);
     return 1;
+}
 
-error:
-    pusherrno(L);
-    if (fp)
+/* --- Directory scanning ------------------------------------------------- */
+
+/* The file browser lists directories, which on a stalled network mount can
+ * take forever; so it's done on a worker thread, and the browser can show
+ * what's arrived so far. Workers are detached and share the job with the
+ * scan object, so one stuck in the kernel just stays stuck, and nobody waits
+ * for it.
+ *
+ * Most filesystems say what each entry is as the directory's read, so only
+ * symlinks and the like need a stat, and that's relative to the directory
+ * rather than a fresh path lookup. Windows' directory iterator gets the
+ * attributes along with the names.
+ *
+ * Recent listings are remembered, keyed on the directory's canonical path,
+ * and reused for as long as its modification time doesn't change. */
+
+static const char SCAN[] = "wg.scan";
+static const size_t MAXCACHEDSCANS = 16;
+
+struct ScanEntry
+{
+    std::string name;
+    bool directory;
+};
+
+struct ScanJob
+{
+    std::string dirname;
+
+    /* Everything below is guarded by mutex. */
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<ScanEntry> entries;
+    bool finished = false;
+    int error = 0;
+    std::string message;
+};
+
+struct CachedScan
+{
+    std::filesystem::file_time_type mtime;
+    std::vector<ScanEntry> entries;
+    uint64_t used;
+};
+
+static std::mutex scancachemutex;
+static std::map<std::string, CachedScan> scancache;
+static uint64_t scanclock = 0;
+
+static void finishscan(ScanJob* job, int error, const std::string& message)
+{
+    std::lock_guard<std::mutex> lock(job->mutex);
+    job->error = error;
+    job->message = message;
+    job->finished = true;
+    job->cv.notify_all();
+}
+
+static void scandirectory(std::shared_ptr<ScanJob> job)
+{
+    std::error_code ec;
+    std::string key = std::filesystem::canonical(job->dirname, ec).string();
+    std::filesystem::file_time_type mtime;
+    if (!ec)
+        mtime = std::filesystem::last_write_time(key, ec);
+
+    /* Some filesystems only keep times to the second or so, and something
+     * could be added in the same tick as the listing was made; so these are
+     * only trusted once they're a little older. */
+    auto settled = std::filesystem::file_time_type::clock::now() -
+                   std::chrono::seconds(2);
+    bool cacheable = !ec && (mtime < settled);
+
+    if (cacheable)
+    {
+        std::vector<ScanEntry> cached;
+        bool hit = false;
+        {
+            std::lock_guard<std::mutex> lock(scancachemutex);
+            auto it = scancache.find(key);
+            if ((it != scancache.end()) && (it->second.mtime == mtime))
+            {
+                it->second.used = ++scanclock;
+                cached = it->second.entries;
+                hit = true;
+            }
+        }
+
+        if (hit)
+        {
+            {
+                std::lock_guard<std::mutex> lock(job->mutex);
+                job->entries = std::move(cached);
+            }
+            finishscan(job.get(), 0, "");
+            return;
+        }
+    }
+
+    auto add = [&](const std::string& name, bool directory)
+    {
+        std::lock_guard<std::mutex> lock(job->mutex);
+        job->entries.push_back({name, directory});
+    };
+
+#if defined WIN32
+    std::filesystem::directory_iterator it(job->dirname, ec);
+    if (ec)
+        return finishscan(job.get(), ec.value(), ec.message());
+
+    add("..", true);
+    for (; it != std::filesystem::directory_iterator(); it.increment(ec))
+        add(it->path().filename().string(), it->is_directory(ec));
+#else
+    DIR* dir = opendir(job->dirname.c_str());
+    if (!dir)
+        return finishscan(job.get(), errno, strerror(errno));
+
+    while (const struct dirent* de = readdir(dir))
+    {
+        if (strcmp(de->d_name, ".") == 0)
+            continue;
+
+        /* Not every platform has d_type. */
+        int directory = -1;
+#if defined DT_DIR
+        if (de->d_type == DT_DIR)
+            directory = 1;
+        else if (de->d_type == DT_REG)
+            directory = 0;
+#endif
+        if (directory == -1)
+        {
+            struct stat st;
+            if (fstatat(dirfd(dir), de->d_name, &st, 0) != 0)
+                continue;
+            directory = S_ISDIR(st.st_mode);
+        }
+        add(de->d_name, directory == 1);
+    }
+    closedir(dir);
+#endif
+
+    if (cacheable)
+    {
+        std::vector<ScanEntry> entries;
+        {
+            std::lock_guard<std::mutex> lock(job->mutex);
+            entries = job->entries;
+        }
+
+        std::lock_guard<std::mutex> lock(scancachemutex);
+        if ((scancache.size() >= MAXCACHEDSCANS) && !scancache.count(key))
+            scancache.erase(std::min_element(scancache.begin(),
+                scancache.end(),
+                [](const auto& a, const auto& b)
+                {
+                    return a.second.used < b.second.used;
+                }));
+        scancache[key] = {mtime, std::move(entries), ++scanclock};
+    }
+    finishscan(job.get(), 0, "");
+}
+
+static std::shared_ptr<ScanJob>& checkscan(lua_State* L, int index)
+{
+    return *(std::shared_ptr<ScanJob>*)luaL_checkudata(L, index, SCAN);
+}
+
+static void scan_dtor(void* p)
+{
+    ((std::shared_ptr<ScanJob>*)p)->~shared_ptr();
+}
+
+/* Starts listing a directory, returning a scan object. */
+
+static int startscandir_cb(lua_State* L)
+{
+    const char* dirname = luaL_checklstring(L, 1, NULL);
+
+    auto job = std::make_shared<ScanJob>();
+    job->dirname = dirname;
+    void* p = lua_newuserdatadtor(
+        L, sizeof(std::shared_ptr<ScanJob>), scan_dtor);
+    new (p) std::shared_ptr<ScanJob>(job);
+    luaL_getmetatable(L, SCAN);
+    lua_setmetatable(L, -2);
+
+    std::thread(scandirectory, job).detach();
+    return 1;
+}
+
+/* Returns whether the scan has finished, and how many entries it's found so
+ * far; or, if it couldn't read the directory, nil and an error. Waits for up
+ * to timeout seconds for it to finish first. */
+
+static int scan_poll_cb(lua_State* L)
+{
+    auto& job = checkscan(L, 1);
+    double timeout = luaL_optnumber(L, 2, 0);
+
+    std::unique_lock<std::mutex> lock(job->mutex);
+    if (timeout > 0)
+        job->cv.wait_for(lock,
+            std::chrono::duration<double>(timeout),
+            [&]
+            {
+                return job->finished;
+            });
+
+    if (job->finished && job->error)
+    {
+        lua_pushnil(L);
+        lua_pushstring(L, job->message.c_str());
+        lua_pushinteger(L, job->error);
+        return 3;
+    }
+
+    lua_pushboolean(L, job->finished);
+    lua_pushinteger(L, job->entries.size());
+    return 2;
+}
+
+/* Returns what the scan has found so far as an array of {name=, mode=},
+ * mode being "directory" or "file", with the directories first and each lot
+ * sorted by name. "." is left out but ".." isn't. If a prefix is given, only
+ * names starting with it are returned (ignoring case on Windows). Anything
+ * which can't be looked at, such as a dangling symlink, is skipped. */
+
+static void pushentries(lua_State* L, ScanJob* job, std::string_view prefix)
+{
+    std::vector<const ScanEntry*> entries;
+    std::lock_guard<std::mutex> lock(job->mutex);
+    for (const ScanEntry& e : job->entries)
+    {
+        if (e.name.size() < prefix.size())
+            continue;
+#if defined WIN32
+        if (_strnicmp(e.name.c_str(), prefix.data(), prefix.size()) != 0)
+            continue;
+#else
+        if (memcmp(e.name.c_str(), prefix.data(), prefix.size()) != 0)
+            continue;
+#endif
+        entries.push_back(&e);
+    }
+
+    std::sort(entries.begin(),
+        entries.end(),
+        [](const ScanEntry* a, const ScanEntry* b)
+        {
+            if (a->directory != b->directory)
+                return a->directory;
+            return a->name < b->name;
+        });
+
+    lua_createtable(L, entries.size(), 0);
+    int index = 1;
+    for (const ScanEntry* e : entries)
+    {
+        lua_createtable(L, 0, 2);
+        lua_pushlstring(L, e->name.data(), e->name.size());
+        lua_setfield(L, -2, "name");
+        lua_pushstring(L, e->directory ? "directory" : "file");
+        lua_setfield(L, -2, "mode");
+        lua_rawseti(L, -2, index++);
+    }
+}
+
+static int scan_entries_cb(lua_State* L)
+{
+    auto& job = checkscan(L, 1);
+    size_t len;
+    const char* prefix = luaL_optlstring(L, 2, "", &len);
+    pushentries(L, job.get(), std::string_view(prefix, len));
+    return 1;
+}
+
+/* Lists a directory in one go, as a scan's entries(); returns nil and an
+ * error if it can't be read. */
+
+static int scandir_cb(lua_State* L)
+{
+    const char* dirname = luaL_checklstring(L, 1, NULL);
+    size_t len;
+    const char* prefix = luaL_optlstring(L, 2, "", &len);
+
+    auto job = std::make_shared<ScanJob>();
+    job->dirname = dirname;
+    scandirectory(job);
+    if (job->error)
+    {
+        lua_pushnil(L);
+        lua_pushstring(L, job->message.c_str());
+        lua_pushinteger(L, job->error);
+        return 3;
+    }
+
+    pushentries(L, job.get(), std::string_view(prefix, len));
+    return 1;
+}
+
+/* --- Mapped files -------------------------------------------------------
+ *
+ * A mapped file is a read-only view of a file's contents, backed by mmap
+ * (or MapViewOfFile on Windows). It's a userdata with just enough string-like
+ * methods (len, sub, find, lines) that loaders and importers can scan it
+ * without ever having to create a single giant Lua string. Note that the data
+ * is not NUL terminated.
+ */
+
+static const char MAPPEDFILE[] = "wg.mappedfile";
+
+void unmapfile(MappedFile* mf)
+{
+    if (!mf->data)
+        return;
+
+    if (mf->owned)
+        free((void*)mf->data);
+    else
+    {
+#if defined WIN32
+        UnmapViewOfFile(mf->data);
+        CloseHandle(mf->mapping);
+#else
+        munmap((void*)mf->data, mf->len);
+#endif
+    }
+    mf->data = nullptr;
+    mf->len = 0;
+}
+
+static void mappedfile_dtor(void* p)
+{
+    unmapfile((MappedFile*)p);
+}
+
+/* Returns the data of either a string or a mapped file. */
+
+const char* checkbuffer(lua_State* L, int index, size_t* len)
+{
+    if (lua_type(L, index) == LUA_TUSERDATA)
+    {
+        MappedFile* mf = (MappedFile*)luaL_checkudata(L, index, MAPPEDFILE);
+        *len = mf->len;
+        return mf->data ? mf->data : "";
+    }
+
+    return luaL_checklstring(L, index, len);
+}
+
+/* Streams which can't be mapped (like stdin) are read into memory instead,
+ * a chunk at a time. */
+
+static bool readstream(FILE* fp, MappedFile* mf)
+{
+    size_t size = 0;
+    size_t capacity = 0;
+    char* data = nullptr;
+    for (;;)
+    {
+        if (size == capacity)
+        {
+            capacity = std::max<size_t>(capacity * 2, 64 * 1024);
+            char* p = (char*)realloc(data, capacity);
+            if (!p)
+            {
+                free(data);
+                errno = ENOMEM;
+                return false;
+            }
+            data = p;
+        }
+
+        size_t i = fread(data + size, 1, capacity - size, fp);
+        if (i == 0)
+            break;
+        size += i;
+    }
+
+    if (ferror(fp))
+    {
+        int e = errno ? errno : EIO;
+        free(data);
+        errno = e;
+        return false;
+    }
+
+    if (size == 0)
+        free(data);
+    else
+    {
+        mf->data = data;
+        mf->len = size;
+        mf->owned = true;
+    }
+    return true;
+}
+
+/* Maps a file (which must not be a directory) into memory, returning false
+ * and setting errno on failure. Empty files have no data. "-" is stdin. */
+
+bool mapfile(const char* filename, MappedFile* mf)
+{
+    *mf = {};
+
+    if (isstdio(filename))
+        return readstream(openstdio(stdin), mf);
+
+#if defined WIN32
+    wchar_t widepath[strlen(filename) + 1];
+    MultiByteToWideChar(
+        CP_UTF8, 0, filename, -1, widepath, strlen(filename) + 1);
+
+    HANDLE fh = CreateFileW(widepath,
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL,
+        nullptr);
+    if (fh == INVALID_HANDLE_VALUE)
+    {
+        errno = ENOENT;
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(fh, &size))
+    {
+        CloseHandle(fh);
+        errno = EIO;
+        return false;
+    }
+
+    if (size.QuadPart != 0)
+    {
+        HANDLE mapping =
+            CreateFileMappingW(fh, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        const void* data =
+            mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        CloseHandle(fh);
+        if (!data)
+        {
+            if (mapping)
+                CloseHandle(mapping);
+            errno = EIO;
+            return false;
+        }
+
+        mf->mapping = mapping;
+        mf->data = (const char*)data;
+        mf->len = size.QuadPart;
+    }
+    else
+        CloseHandle(fh);
+#else
+    int fd = open(filename, O_RDONLY);
+    if (fd == -1)
+        return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        int e = errno;
+        close(fd);
+        errno = e;
+        return false;
+    }
+    if (S_ISDIR(st.st_mode))
+    {
+        close(fd);
+        errno = EISDIR;
+        return false;
+    }
+    if (S_ISFIFO(st.st_mode) || S_ISCHR(st.st_mode))
+    {
+        FILE* fp = fdopen(fd, "rb");
+        if (!fp)
+        {
+            int e = errno;
+            close(fd);
+            errno = e;
+            return false;
+        }
+        bool ok = readstream(fp, mf);
+        int e = errno;
         fclose(fp);
-    return 3;
+        errno = e;
+        return ok;
+    }
+
+    if (st.st_size != 0)
+    {
+        void* data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        int e = errno;
+        close(fd);
+        if (data == MAP_FAILED)
+        {
+            errno = e;
+            return false;
+        }
+
+        mf->data = (const char*)data;
+        mf->len = st.st_size;
+    }
+    else
+        close(fd);
+#endif
+
+    return true;
 }
 
-static int writefile_cb(lua_State* L)
+static int mapfile_cb(lua_State* L)
+{
+    const char* filename = luaL_checklstring(L, 1, nullptr);
+
+    MappedFile* mf = (MappedFile*)lua_newuserdatadtor(
+        L, sizeof(MappedFile), mappedfile_dtor);
+    *mf = {};
+    luaL_getmetatable(L, MAPPEDFILE);
+    lua_setmetatable(L, -2);
+
+    if (!mapfile(filename, mf))
+        return pusherrno(L);
+    return 1;
+}
+
+static MappedFile* checkmappedfile(lua_State* L, int index)
+{
+    return (MappedFile*)luaL_checkudata(L, index, MAPPEDFILE);
+}
+
+/* Converts a Lua string index (1-based, negative counts from the end) into a
+ * 0-based offset, clamped to the data. */
+
+static size_t tooffset(int i, size_t len)
+{
+    if (i < 0)
+        i = (int)len + i + 1;
+    if (i < 1)
+        return 0;
+    if ((size_t)i > len)
+        return len;
+    return i - 1;
+}
+
+static int mappedfile_len_cb(lua_State* L)
+{
+    MappedFile* mf = checkmappedfile(L, 1);
+    lua_pushinteger(L, mf->len);
+    return 1;
+}
+
+static int mappedfile_sub_cb(lua_State* L)
+{
+    MappedFile* mf = checkmappedfile(L, 1);
+    long len = mf->len;
+    long i = luaL_optinteger(L, 2, 1);
+    long j = luaL_optinteger(L, 3, -1);
+
+    /* Same semantics as string.sub. */
+
+    if (i < 0)
+        i = std::max(len + i + 1, 1L);
+    else if (i == 0)
+        i = 1;
+    if (j < 0)
+        j = len + j + 1;
+    else if (j > len)
+        j = len;
+
+    if (i <= j)
+        lua_pushlstring(L, mf->data + i - 1, j - i + 1);
+    else
+        lua_pushstring(L, "");
+    return 1;
+}
+
+/* Always does a plain search; patterns are not supported. */
+
+static int mappedfile_find_cb(lua_State* L)
+{
+    MappedFile* mf = checkmappedfile(L, 1);
+    size_t needlelen;
+    const char* needle = luaL_checklstring(L, 2, &needlelen);
+    size_t init = tooffset(luaL_optinteger(L, 3, 1), mf->len);
+
+    std::string_view haystack(mf->data + init, mf->len - init);
+    size_t p = haystack.find(std::string_view(needle, needlelen));
+    if (p == std::string_view::npos)
+    {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    lua_pushinteger(L, 1 + init + p);
+    lua_pushinteger(L, init + p + needlelen);
+    return 2;
+}
+
+static int mappedfile_nextline_cb(lua_State* L)
+{
+    MappedFile* mf = checkmappedfile(L, lua_upvalueindex(1));
+    size_t offset = lua_tointeger(L, lua_upvalueindex(2));
+    if (offset >= mf->len)
+        return 0;
+
+    const char* s = mf->data + offset;
+    const char* e = (const char*)memchr(s, '\n', mf->len - offset);
+    size_t next;
+    if (e)
+        next = e + 1 - mf->data;
+    else
+    {
+        e = mf->data + mf->len;
+        next = mf->len;
+    }
+
+    lua_pushinteger(L, next);
+    lua_replace(L, lua_upvalueindex(2));
+    lua_pushlstring(L, s, e - s);
+    return 1;
+}
+
+static int mappedfile_lines_cb(lua_State* L)
+{
+    MappedFile* mf = checkmappedfile(L, 1);
+    size_t offset = tooffset(luaL_optinteger(L, 2, 1), mf->len);
+
+    lua_pushvalue(L, 1);
+    lua_pushinteger(L, offset);
+    lua_pushcclosure(L, mappedfile_nextline_cb, 2);
+    return 1;
+}
+
+static int mappedfile_close_cb(lua_State* L)
+{
+    unmapfile(checkmappedfile(L, 1));
+    return 0;
+}
+
+/* Durably replaces filename with the concatenation of chunks. The data is
+ * written to filename.new, synced, and renamed over the original, and then
+ * the directory is synced so the rename itself survives a crash; at no point
+ * is there no valid file on disk. written (if given) is updated as the data
+ * goes out so callers on other threads can report progress. Returns 0 or an
+ * errno; renamefailed is set if the data was written but couldn't be moved
+ * into place. Safe to call from any thread. */
+
+int writefileatomically(const std::string& filename,
+    const std::vector<std::string_view>& chunks,
+    std::atomic<size_t>* written,
+    bool* renamefailed)
+{
+    /* Small enough that progress updates are reasonably frequent. */
+    const size_t CHUNK = 256 * 1024;
+
+    std::string newfilename = filename + ".new";
+
+#if defined WIN32
+    FILE* fp = fopen(newfilename.c_str(), "wb");
+    if (!fp)
+        return errno;
+
+    for (std::string_view c : chunks)
+    {
+        while (!c.empty())
+        {
+            size_t len = std::min(c.size(), CHUNK);
+            if (fwrite(c.data(), 1, len, fp) != len)
+            {
+                int e = errno;
+                fclose(fp);
+                return e;
+            }
+            if (written)
+                *written += len;
+            c.remove_prefix(len);
+        }
+    }
+
+    if ((fflush(fp) != 0) || (_commit(_fileno(fp)) != 0))
+    {
+        int e = errno;
+        fclose(fp);
+        return e;
+    }
+    if (fclose(fp) != 0)
+        return errno;
+
+    /* Windows doesn't support clobbering renames. */
+
+    remove(filename.c_str());
+    if (rename(newfilename.c_str(), filename.c_str()) != 0)
+    {
+        if (renamefailed)
+            *renamefailed = true;
+        return errno;
+    }
+#else
+    int fd = open(newfilename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (fd == -1)
+        return errno;
+
+    auto fail = [&]()
+    {
+        int e = errno;
+        close(fd);
+        unlink(newfilename.c_str());
+        return e;
+    };
+
+    std::vector<iovec> iovs;
+    size_t total = 0;
+    for (std::string_view c : chunks)
+    {
+        total += c.size();
+        while (!c.empty())
+        {
+            size_t len = std::min(c.size(), CHUNK);
+            iovs.push_back({(void*)c.data(), len});
+            c.remove_prefix(len);
+        }
+    }
+
+#if defined __linux__
+    /* Reserve the space up front, so running out of disk fails early rather
+     * than after half the file's gone out. This is fallocate() rather than
+     * posix_fallocate() as glibc emulates the latter, very slowly, by
+     * writing to every block on filesystems which don't support it (such as
+     * NFSv3). */
+
+    if ((total != 0) && (fallocate(fd, 0, 0, total) != 0) && (errno == ENOSPC))
+        return fail();
+#endif
+
+    size_t i = 0;
+    while (i < iovs.size())
+    {
+        int count = std::min<size_t>(iovs.size() - i, 16);
+        ssize_t n = writev(fd, &iovs[i], count);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return fail();
+        }
+        if (written)
+            *written += n;
+
+        /* Skip whatever got written, which may end part way into an iovec. */
+
+        while ((i < iovs.size()) && ((size_t)n >= iovs[i].iov_len))
+        {
+            n -= iovs[i].iov_len;
+            i++;
+        }
+        if (n > 0)
+        {
+            iovs[i].iov_base = (char*)iovs[i].iov_base + n;
+            iovs[i].iov_len -= n;
+        }
+    }
+
+    if (fsync(fd) != 0)
+        return fail();
+    if (close(fd) != 0)
+        return errno;
+
+    if (rename(newfilename.c_str(), filename.c_str()) != 0)
+    {
+        if (renamefailed)
+            *renamefailed = true;
+        return errno;
+    }
+
+    /* Not all filesystems allow directories to be synced, so errors here are
+     * ignored. */
+
+    std::string dirname = std::filesystem::path(filename).parent_path();
+    int dfd = open(dirname.empty() ? "." : dirname.c_str(), O_RDONLY);
+    if (dfd != -1)
+    {
+        fsync(dfd);
+        close(dfd);
+    }
+#endif
+    return 0;
+}
+
+static int writefile(lua_State* L, const char* mode)
 {
     const char* filename = luaL_checklstring(L, 1, nullptr);
     size_t len;
     const char* data = luaL_checklstring(L, 2, &len);
 
-    FILE* fp = fopen(filename, "wb");
+    FILE* fp = fopen(filename, mode);
     if (!fp)
         goto error;
 
@@ -323,25 +1182,135 @@ error:
     return 3;
 }
 
+/* A buffered output file, for writing things (such as exports) which are
+ * produced a piece at a time, so they never need to be held in memory
+ * whole. Errors are remembered and reported by close(). */
+
+static const char WRITER[] = "wg.writer";
+static const size_t WRITERBUFFERSIZE = 64 * 1024;
+
+struct Writer
+{
+    FILE* fp;
+    int error;
+};
+
+/* Closes the writer's file (or just flushes it, for stdout). */
+
+static int closewriterfile(Writer* w)
+{
+    FILE* fp = w->fp;
+    w->fp = nullptr;
+    return (fp == stdout) ? fflush(fp) : fclose(fp);
+}
+
+static void writer_dtor(void* p)
+{
+    Writer* w = (Writer*)p;
+    if (w->fp)
+        closewriterfile(w);
+}
+
+Writer* towriter(lua_State* L, int index)
+{
+    if (lua_type(L, index) != LUA_TUSERDATA)
+        return nullptr;
+    Writer* w = (Writer*)luaL_checkudata(L, index, WRITER);
+    if (!w->fp)
+        luaL_error(L, "writer has already been closed");
+    return w;
+}
+
+void writetowriter(Writer* w, const char* data, size_t len)
+{
+    if (!w->error && len && (fwrite(data, 1, len, w->fp) != len))
+        w->error = errno ? errno : EIO;
+}
+
+static int openwriter_cb(lua_State* L)
+{
+    const char* filename = luaL_checkstring(L, 1);
+
+    Writer* w = (Writer*)lua_newuserdatadtor(L, sizeof(Writer), writer_dtor);
+    *w = {};
+    luaL_getmetatable(L, WRITER);
+    lua_setmetatable(L, -2);
+
+    if (isstdio(filename))
+    {
+        w->fp = openstdio(stdout);
+        return 1;
+    }
+
+    w->fp = fopen(filename, "wb");
+    if (!w->fp)
+        return pusherrno(L);
+    setvbuf(w->fp, nullptr, _IOFBF, WRITERBUFFERSIZE);
+    return 1;
+}
+
+static int writer_write_cb(lua_State* L)
+{
+    Writer* w = towriter(L, 1);
+    int n = lua_gettop(L);
+    for (int i = 2; i <= n; i++)
+    {
+        size_t len;
+        const char* s = luaL_checklstring(L, i, &len);
+        writetowriter(w, s, len);
+    }
+    return 0;
+}
+
+static int writer_close_cb(lua_State* L)
+{
+    Writer* w = towriter(L, 1);
+    if ((closewriterfile(w) != 0) && !w->error)
+        w->error = errno;
+
+    if (w->error)
+    {
+        errno = w->error;
+        return pusherrno(L);
+    }
+    lua_pushboolean(L, true);
+    return 1;
+}
+
+static int writefile_cb(lua_State* L)
+{
+    return writefile(L, "wb");
+}
+
+static int appendfile_cb(lua_State* L)
+{
+    return writefile(L, "ab");
+}
+
 void filesystem_init(void)
 {
     const static luaL_Reg funcs[] = {
-        {"access",    access_cb   },
-        {"chdir",     chdir_cb    },
-        {"getcwd",    getcwd_cb   },
-        {"getenv",    getenv_cb   },
-        {"mkdir",     mkdir_cb    },
-        {"mkdirs",    mkdirs_cb    },
-        {"mkdtemp",   mkdtemp_cb  },
-        {"printerr",  printerr_cb },
-        {"printout",  printout_cb },
-        {"readdir",   readdir_cb  },
-        {"readfile",  readfile_cb },
-        {"remove",    remove_cb   },
-        {"rename",    rename_cb   },
-        {"stat",      stat_cb     },
-        {"writefile", writefile_cb},
-        {NULL,        NULL        }
+        {"access",       access_cb      },
+        {"appendfile",   appendfile_cb  },
+        {"chdir",        chdir_cb       },
+        {"getcwd",       getcwd_cb      },
+        {"getenv",       getenv_cb      },
+        {"mapfile",      mapfile_cb     },
+        {"mkdir",        mkdir_cb       },
+        {"mkdirs",       mkdirs_cb      },
+        {"mkdtemp",      mkdtemp_cb     },
+        {"openwriter",   openwriter_cb  },
+        {"printerr",     printerr_cb    },
+        {"printout",     printout_cb    },
+        {"readdir",      readdir_cb     },
+        {"readfile",     readfile_cb    },
+        {"remove",       remove_cb      },
+        {"rename",       rename_cb      },
+        {"scandir",      scandir_cb     },
+        {"startscandir", startscandir_cb},
+        {"stat",         stat_cb        },
+        {"writefile",    writefile_cb   },
+        {NULL,           NULL           }
     };
 
     const static luaL_Constant consts[] = {
@@ -351,6 +1320,47 @@ void filesystem_init(void)
         {"EISDIR", EISDIR},
     };
 
+    const static luaL_Reg mappedfilemethods[] = {
+        {"len",   mappedfile_len_cb  },
+        {"sub",   mappedfile_sub_cb  },
+        {"find",  mappedfile_find_cb },
+        {"lines", mappedfile_lines_cb},
+        {"close", mappedfile_close_cb},
+        {NULL,    NULL               }
+    };
+
+    luaL_newmetatable(L, MAPPEDFILE);
+    lua_pushcfunction(L, mappedfile_len_cb);
+    lua_setfield(L, -2, "__len");
+    lua_newtable(L);
+    luaL_register(L, NULL, mappedfilemethods);
+    lua_setfield(L, -2, "__index");
+    lua_pop(L, 1);
+
+    const static luaL_Reg writermethods[] = {
+        {"write", writer_write_cb},
+        {"close", writer_close_cb},
+        {NULL,    NULL           }
+    };
+
+    const static luaL_Reg scanmethods[] = {
+        {"poll",    scan_poll_cb   },
+        {"entries", scan_entries_cb},
+        {NULL,      NULL           }
+    };
+
+    luaL_newmetatable(L, SCAN);
+    lua_newtable(L);
+    luaL_register(L, NULL, scanmethods);
+    lua_setfield(L, -2, "__index");
+    lua_pop(L, 1);
+
+    luaL_newmetatable(L, WRITER);
+    lua_newtable(L);
+    luaL_register(L, NULL, writermethods);
+    lua_setfield(L, -2, "__index");
+    lua_pop(L, 1);
+
     lua_getglobal(L, "wg");
     luaL_register(L, NULL, funcs);
     luaL_setconstants(L, consts, sizeof(consts) / sizeof(*consts));
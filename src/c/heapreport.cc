@@ -0,0 +1,308 @@
+/* © 2026 David Given.
+ * WordGrinder is licensed under the MIT open source license. See the COPYING
+ * file in this distribution for the full text.
+ */
+
+#include "globals.h"
+#include "lgc.h"
+#include "lstring.h"
+#include <string.h>
+#include <unordered_map>
+#include <vector>
+
+/* Works out where the interpreter's memory is going, by taking a snapshot
+ * of every object in the heap and the references between them and then
+ * walking outwards from each of a list of roots in turn. Each object is
+ * counted against the first root which reaches it, so the order matters:
+ * the things which should own shared data (documents own their words, even
+ * if the undo buffer refers to them too) come first.
+ *
+ * Metatables, function environments, code and threads are shared by
+ * everything, so the walks from the roots don't go into them (or into the
+ * globals or registry tables); they're found by a last walk from the
+ * globals and registry which follows everything, along with whatever else
+ * wasn't reached by a root. Only the interpreter's own objects are seen:
+ * memory allocated natively behind a userdata isn't. */
+
+struct HeapSnapshot
+{
+    std::unordered_map<const void*, int> ids;
+    std::vector<size_t> sizes;
+    std::vector<uint8_t> types;
+
+    struct Edge
+    {
+        const void* from;
+        const void* to;
+        bool shared; /* a metatable or environment */
+        bool underscore; /* a field whose name starts with _ */
+    };
+    std::vector<Edge> edges;
+
+    /* The resolved edges, as a list of targets for each object. */
+    std::vector<int> first;
+    std::vector<int> targets;
+    std::vector<uint8_t> flags;
+};
+
+enum
+{
+    EDGE_SHARED = 1,
+    EDGE_UNDERSCORE = 2,
+};
+
+static void node_cb(void* context,
+    void* ptr,
+    uint8_t tt,
+    uint8_t memcat,
+    size_t size,
+    const char* name)
+{
+    HeapSnapshot* s = (HeapSnapshot*)context;
+    /* Strings are reported by their length alone. */
+    if (tt == LUA_TSTRING)
+        size = sizestring(size);
+    s->ids.try_emplace(ptr, s->sizes.size());
+    s->sizes.push_back(size);
+    s->types.push_back(tt);
+}
+
+static void edge_cb(void* context, void* from, void* to, const char* name)
+{
+    HeapSnapshot* s = (HeapSnapshot*)context;
+    bool shared = name && (!strcmp(name, "metatable") || !strcmp(name, "env"));
+    bool underscore = name && (name[0] == '_');
+    s->edges.push_back({from, to, shared, underscore});
+}
+
+static void resolve(HeapSnapshot& s)
+{
+    int n = s.sizes.size();
+    std::vector<int> from;
+    std::vector<int> to;
+    from.reserve(s.edges.size());
+    to.reserve(s.edges.size());
+    std::vector<uint8_t> edgeflags;
+    edgeflags.reserve(s.edges.size());
+    for (auto& e : s.edges)
+    {
+        auto f = s.ids.find(e.from);
+        auto t = s.ids.find(e.to);
+        if ((f == s.ids.end()) || (t == s.ids.end()))
+            continue;
+        from.push_back(f->second);
+        to.push_back(t->second);
+        edgeflags.push_back((e.shared ? EDGE_SHARED : 0) |
+                            (e.underscore ? EDGE_UNDERSCORE : 0));
+    }
+    s.edges.clear();
+    s.edges.shrink_to_fit();
+
+    s.first.assign(n + 1, 0);
+    for (int f : from)
+        s.first[f + 1]++;
+    for (int i = 0; i < n; i++)
+        s.first[i + 1] += s.first[i];
+
+    std::vector<int> fill(s.first.begin(), s.first.end() - 1);
+    s.targets.resize(to.size());
+    s.flags.resize(to.size());
+    for (size_t i = 0; i < to.size(); i++)
+    {
+        int j = fill[from[i]]++;
+        s.targets[j] = to[i];
+        s.flags[j] = edgeflags[i];
+    }
+}
+
+/* Walks outwards from the objects on the stack, counting everything not
+ * yet visited. Anything which isn't followed because it's shared (or is a
+ * field starting with an underscore, when those are skipped) is put aside
+ * for the last walk, which follows everything. */
+
+struct Walker
+{
+    HeapSnapshot& s;
+    std::vector<uint8_t> visited;
+    std::vector<int> stack;
+    std::vector<int> deferred;
+    bool everything = false;
+    bool skipunderscore = false;
+    size_t bytes = 0;
+    size_t objects = 0;
+
+    void expand(int i)
+    {
+        for (int j = s.first[i]; j < s.first[i + 1]; j++)
+        {
+            int t = s.targets[j];
+            if (visited[t])
+                continue;
+            if (!everything)
+            {
+                uint8_t tt = s.types[t];
+                if ((s.flags[j] & EDGE_SHARED) ||
+                    (skipunderscore && (s.flags[j] & EDGE_UNDERSCORE)) ||
+                    (tt == LUA_TPROTO) || (tt == LUA_TTHREAD))
+                {
+                    deferred.push_back(t);
+                    continue;
+                }
+            }
+            visited[t] = 1;
+            stack.push_back(t);
+        }
+    }
+
+    /* A root which has already been counted (a document, after its text
+     * was) still has its other fields looked at. */
+
+    void root(const void* p)
+    {
+        auto it = s.ids.find(p);
+        if (it == s.ids.end())
+            return;
+        int i = it->second;
+        if (visited[i])
+            expand(i);
+        else
+        {
+            visited[i] = 1;
+            stack.push_back(i);
+        }
+    }
+
+    void walk()
+    {
+        bytes = 0;
+        objects = 0;
+        while (!stack.empty())
+        {
+            int i = stack.back();
+            stack.pop_back();
+            bytes += s.sizes[i];
+            objects++;
+            expand(i);
+        }
+    }
+};
+
+static void pushcounts(lua_State* L, size_t bytes, size_t objects)
+{
+    lua_createtable(L, 0, 2);
+    lua_pushnumber(L, bytes);
+    lua_setfield(L, -2, "bytes");
+    lua_pushnumber(L, objects);
+    lua_setfield(L, -2, "objects");
+}
+
+/* Takes a list of root sets, each a list of values (with skipunderscore set
+ * if the walk from it shouldn't follow fields whose names start with an
+ * underscore). Returns what was reached from each, then what was reached
+ * from the globals and registry after that, as {bytes, objects}; and then
+ * the whole heap (apart from the lists of roots), including anything
+ * unreachable. */
+
+static int heapreport_cb(lua_State* L)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+    int count = lua_objlen(L, 1);
+
+    lua_gc(L, LUA_GCCOLLECT, 0);
+
+    HeapSnapshot s;
+    luaC_enumheap(L, &s, node_cb, edge_cb);
+    resolve(s);
+
+    int n = s.sizes.size();
+    Walker w = {s, std::vector<uint8_t>(n, 0)};
+    auto mark = [&](const void* p)
+    {
+        auto it = s.ids.find(p);
+        if (it == s.ids.end())
+            return -1;
+        w.visited[it->second] = 1;
+        return it->second;
+    };
+
+    /* The lists of roots themselves don't count, and nothing goes into the
+     * tables everything refers to until the end. */
+
+    const void* everywhere[] = {lua_topointer(L, LUA_GLOBALSINDEX),
+        lua_topointer(L, LUA_REGISTRYINDEX),
+        lua_mainthread(L)};
+    std::vector<int> lists = {mark(lua_topointer(L, 1))};
+    for (int i = 1; i <= count; i++)
+    {
+        lua_rawgeti(L, 1, i);
+        lists.push_back(mark(lua_topointer(L, -1)));
+        lua_pop(L, 1);
+    }
+    for (const void* p : everywhere)
+        mark(p);
+
+    lua_createtable(L, count + 1, 0);
+    for (int i = 1; i <= count; i++)
+    {
+        lua_rawgeti(L, 1, i);
+        luaL_checktype(L, -1, LUA_TTABLE);
+        lua_getfield(L, -1, "skipunderscore");
+        w.skipunderscore = lua_toboolean(L, -1);
+        lua_pop(L, 1);
+
+        int len = lua_objlen(L, -1);
+        for (int j = 1; j <= len; j++)
+        {
+            lua_rawgeti(L, -1, j);
+            w.root(lua_topointer(L, -1));
+            lua_pop(L, 1);
+        }
+        lua_pop(L, 1);
+
+        w.walk();
+        pushcounts(L, w.bytes, w.objects);
+        lua_rawseti(L, -2, i);
+    }
+
+    w.everything = true;
+    for (const void* p : everywhere)
+    {
+        auto it = s.ids.find(p);
+        if (it != s.ids.end())
+            w.stack.push_back(it->second);
+    }
+    for (int i : w.deferred)
+    {
+        if (!w.visited[i])
+        {
+            w.visited[i] = 1;
+            w.stack.push_back(i);
+        }
+    }
+    w.walk();
+    pushcounts(L, w.bytes, w.objects);
+    lua_rawseti(L, -2, count + 1);
+
+    size_t total = 0;
+    for (size_t size : s.sizes)
+        total += size;
+    for (int i : lists)
+    {
+        total -= s.sizes[i];
+        n--;
+    }
+    pushcounts(L, total, n);
+    return 2;
+}
+
+void heapreport_init(void)
+{
+    const static luaL_Reg funcs[] = {
+        {"heapreport", heapreport_cb},
+        {NULL,         NULL         }
+    };
+
+    luaL_register(L, "wg", funcs);
+}
+
+// vim: sw=4 ts=4 et
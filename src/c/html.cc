@@ -0,0 +1,687 @@
+/* © 2026 David Given.
+ * WordGrinder is licensed under the MIT open source license. See the COPYING
+ * file in this distribution for the full text.
+ */
+
+#include "globals.h"
+#include <ctype.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <string_view>
+
+/* A tolerant HTML tokeniser for the HTML importer. It makes a single pass
+ * over the document and hands back a stream of (kind, value) pairs:
+ *
+ *   "tag", "<name>" / "</name>" / "<name/>"
+ *                      --- element names are lowercased and attributes
+ *                          thrown away, so callers can look tags up
+ *                          directly;
+ *   "space", " " or "\n"
+ *                      --- tabs and form feeds count as spaces, and CRLF as
+ *                          a single newline;
+ *   "entity", "&...;"  --- left for the caller to decode (see
+ *                          wg.decodeentities());
+ *   "text", word       --- always valid UTF-8; bytes which aren't part of a
+ *                          valid sequence are dropped.
+ *
+ * Other control characters, comments, doctypes and processing instructions
+ * are skipped. Anything which looks like markup but isn't (a '<' not
+ * followed by a name, say, or an '&' with no ';') is returned as text. */
+
+static const char HTMLTOKENS[] = "wg.htmltokens";
+static const size_t MAXENTITYLENGTH = 32;
+
+struct HTMLTokeniser
+{
+    size_t offset;
+};
+
+static bool ishtmlspace(char c)
+{
+    return (c == ' ') || (c == '\t') || (c == '\f') || (c == '\n') ||
+           (c == '\r');
+}
+
+static bool ishtmlnamechar(char c)
+{
+    return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) ||
+           ((c >= '0') && (c <= '9'));
+}
+
+static bool iswordchar(char c)
+{
+    uint8_t cc = c;
+    return (cc >= 0x80) || ((cc > 0x20) && (cc < 0x7f) && (c != '<') &&
+                               (c != '&'));
+}
+
+/* Finds the '>' which ends the tag starting at pos, skipping over quoted
+ * attribute values. Returns npos if there isn't one. */
+
+static size_t findtagend(std::string_view data, size_t pos)
+{
+    char quote = 0;
+    while (pos < data.size())
+    {
+        char c = data[pos];
+        if (quote)
+        {
+            if (c == quote)
+                quote = 0;
+        }
+        else if ((c == '"') || (c == '\''))
+            quote = c;
+        else if (c == '>')
+            return pos;
+        pos++;
+    }
+    return std::string_view::npos;
+}
+
+static int pushtoken(lua_State* L, const char* kind, std::string_view value)
+{
+    lua_pushstring(L, kind);
+    lua_pushlstring(L, value.data(), value.size());
+    return 2;
+}
+
+/* Reads markup starting at the '<' at data[t->offset]. Returns the number of
+ * values pushed, or -1 if it was skipped completely, or 0 if it isn't markup
+ * at all. */
+
+static int readmarkup(lua_State* L, HTMLTokeniser* t, std::string_view data)
+{
+    size_t pos = t->offset + 1;
+    std::string_view rest = data.substr(pos);
+
+    if (rest.substr(0, 3) == "!--")
+    {
+        size_t end = data.find("-->", pos + 3);
+        t->offset = (end == std::string_view::npos) ? data.size() : (end + 3);
+        return -1;
+    }
+    if (!rest.empty() && ((rest[0] == '!') || (rest[0] == '?')))
+    {
+        size_t end = data.find('>', pos);
+        t->offset = (end == std::string_view::npos) ? data.size() : (end + 1);
+        return -1;
+    }
+
+    while ((pos < data.size()) && ishtmlspace(data[pos]))
+        pos++;
+    bool closing = (pos < data.size()) && (data[pos] == '/');
+    if (closing)
+    {
+        pos++;
+        while ((pos < data.size()) && ishtmlspace(data[pos]))
+            pos++;
+    }
+
+    size_t namestart = pos;
+    if ((pos == data.size()) || !isalpha((uint8_t)data[pos]))
+        return 0;
+    while ((pos < data.size()) && ishtmlnamechar(data[pos]))
+        pos++;
+    size_t nameend = pos;
+
+    size_t end = findtagend(data, pos);
+    if (end == std::string_view::npos)
+    {
+        /* An unterminated tag swallows the rest of the document. */
+
+        t->offset = data.size();
+        return -1;
+    }
+    t->offset = end + 1;
+
+    bool selfclosing = !closing && (end > nameend) && (data[end - 1] == '/');
+
+    std::string tag = closing ? "</" : "<";
+    for (size_t i = namestart; i < nameend; i++)
+    {
+        char c = data[i];
+        if ((c >= 'A') && (c <= 'Z'))
+            c += 'a' - 'A';
+        tag += c;
+    }
+    tag += selfclosing ? "/>" : ">";
+    return pushtoken(L, "tag", tag);
+}
+
+static int htmltokens_next_cb(lua_State* L)
+{
+    size_t len;
+    const char* p = lua_tolstring(L, lua_upvalueindex(1), &len);
+    std::string_view data(p, len);
+    HTMLTokeniser* t =
+        (HTMLTokeniser*)luaL_checkudata(L, lua_upvalueindex(2), HTMLTOKENS);
+
+    while (t->offset < data.size())
+    {
+        size_t pos = t->offset;
+        char c = data[pos];
+
+        if ((c == ' ') || (c == '\t') || (c == '\f'))
+        {
+            t->offset++;
+            return pushtoken(L, "space", " ");
+        }
+        if (c == '\n')
+        {
+            t->offset++;
+            return pushtoken(L, "space", "\n");
+        }
+        if (c == '\r')
+        {
+            /* A bare CR is a control character like any other. */
+
+            t->offset++;
+            if ((t->offset < data.size()) && (data[t->offset] == '\n'))
+            {
+                t->offset++;
+                return pushtoken(L, "space", "\n");
+            }
+            continue;
+        }
+
+        if (c == '<')
+        {
+            int i = readmarkup(L, t, data);
+            if (i > 0)
+                return i;
+            if (i < 0)
+                continue;
+            t->offset++;
+            return pushtoken(L, "text", "<");
+        }
+
+        if (c == '&')
+        {
+            size_t end = pos + 1;
+            size_t limit = std::min(data.size(), pos + MAXENTITYLENGTH);
+            while ((end < limit) && iswordchar(data[end]))
+            {
+                if (data[end] == ';')
+                    break;
+                end++;
+            }
+            t->offset = pos + 1;
+            if ((end < limit) && (data[end] == ';'))
+            {
+                t->offset = end + 1;
+                return pushtoken(L, "entity", data.substr(pos, end + 1 - pos));
+            }
+            return pushtoken(L, "text", "&");
+        }
+
+        if (!iswordchar(c))
+        {
+            /* Some other control character; ignore it. */
+
+            t->offset++;
+            continue;
+        }
+
+        size_t end = pos;
+        while ((end < data.size()) && iswordchar(data[end]))
+            end++;
+        t->offset = end;
+
+        std::string_view word = data.substr(pos, end - pos);
+        if (printableasciispan(word.data(), word.size()) == word.size())
+            return pushtoken(L, "text", word);
+
+        std::string s;
+        appendvalidu8(s, word);
+        if (s.empty())
+            continue;
+        return pushtoken(L, "text", s);
+    }
+
+    return 0;
+}
+
+static int htmltokens_cb(lua_State* L)
+{
+    luaL_checkstring(L, 1);
+
+    lua_pushvalue(L, 1);
+    HTMLTokeniser* t =
+        (HTMLTokeniser*)lua_newuserdata(L, sizeof(HTMLTokeniser));
+    t->offset = 0;
+    luaL_getmetatable(L, HTMLTOKENS);
+    lua_setmetatable(L, -2);
+    lua_pushcclosure(L, htmltokens_next_cb, 2);
+    return 1;
+}
+
+/* --- Entities ----------------------------------------------------------- */
+
+/* The named entities the importer understands, and what they decode to. */
+
+struct HTMLEntity
+{
+    std::string_view name;
+    std::string_view value;
+};
+
+static constexpr HTMLEntity htmlentities[] = {
+    {"amp",      "&" },
+    {"gt",       ">" },
+    {"lt",       "<" },
+    {"quot",     "\""},
+    {"acute",    "´" },
+    {"cedil",    "¸" },
+    {"circ",     "ˆ" },
+    {"macr",     "¯" },
+    {"middot",   "·" },
+    {"tilde",    "˜" },
+    {"uml",      "¨" },
+    {"Aacute",   "Á" },
+    {"aacute",   "á" },
+    {"Acirc",    "Â" },
+    {"acirc",    "â" },
+    {"AElig",    "Æ" },
+    {"aelig",    "æ" },
+    {"Agrave",   "À" },
+    {"agrave",   "à" },
+    {"Aring",    "Å" },
+    {"aring",    "å" },
+    {"Atilde",   "Ã" },
+    {"atilde",   "ã" },
+    {"Auml",     "Ä" },
+    {"auml",     "ä" },
+    {"Ccedil",   "Ç" },
+    {"ccedil",   "ç" },
+    {"Eacute",   "É" },
+    {"eacute",   "é" },
+    {"Ecirc",    "Ê" },
+    {"ecirc",    "ê" },
+    {"Egrave",   "È" },
+    {"egrave",   "è" },
+    {"ETH",      "Ð" },
+    {"eth",      "ð" },
+    {"Euml",     "Ë" },
+    {"euml",     "ë" },
+    {"Iacute",   "Í" },
+    {"iacute",   "í" },
+    {"Icirc",    "Î" },
+    {"icirc",    "î" },
+    {"Igrave",   "Ì" },
+    {"igrave",   "ì" },
+    {"Iuml",     "Ï" },
+    {"iuml",     "ï" },
+    {"Ntilde",   "Ñ" },
+    {"ntilde",   "ñ" },
+    {"Oacute",   "Ó" },
+    {"oacute",   "ó" },
+    {"Ocirc",    "Ô" },
+    {"ocirc",    "ô" },
+    {"OElig",    "Œ" },
+    {"oelig",    "œ" },
+    {"Ograve",   "Ò" },
+    {"ograve",   "ò" },
+    {"Oslash",   "Ø" },
+    {"oslash",   "ø" },
+    {"Otilde",   "Õ" },
+    {"otilde",   "õ" },
+    {"Ouml",     "Ö" },
+    {"ouml",     "ö" },
+    {"Scaron",   "Š" },
+    {"scaron",   "š" },
+    {"szlig",    "ß" },
+    {"THORN",    "Þ" },
+    {"thorn",    "þ" },
+    {"Uacute",   "Ú" },
+    {"uacute",   "ú" },
+    {"Ucirc",    "Û" },
+    {"ucirc",    "û" },
+    {"Ugrave",   "Ù" },
+    {"ugrave",   "ù" },
+    {"Uuml",     "Ü" },
+    {"uuml",     "ü" },
+    {"Yacute",   "Ý" },
+    {"yacute",   "ý" },
+    {"yuml",     "ÿ" },
+    {"Yuml",     "Ÿ" },
+    {"cent",     "¢" },
+    {"curren",   "¤" },
+    {"euro",     "€" },
+    {"pound",    "£" },
+    {"yen",      "¥" },
+    {"brvbar",   "¦" },
+    {"bull",     "•" },
+    {"copy",     "©" },
+    {"dagger",   "†" },
+    {"Dagger",   "‡" },
+    {"frasl",    "⁄" },
+    {"hellip",   "…" },
+    {"iexcl",    "¡" },
+    {"image",    "ℑ" },
+    {"iquest",   "¿" },
+    {"lrm",      ""  },
+    {"mdash",    "—" },
+    {"ndash",    "–" },
+    {"not",      "¬" },
+    {"oline",    "‾" },
+    {"ordf",     "ª" },
+    {"ordm",     "º" },
+    {"para",     "¶" },
+    {"permil",   "‰" },
+    {"prime",    "′" },
+    {"Prime",    "″" },
+    {"real",     "ℜ" },
+    {"reg",      "®" },
+    {"rlm",      ""  },
+    {"sect",     "§" },
+    {"shy",      "­" },
+    {"sup1",     "¹" },
+    {"trade",    "™" },
+    {"weierp",   "℘" },
+    {"bdquo",    "„" },
+    {"laquo",    "«" },
+    {"ldquo",    "“" },
+    {"lsaquo",   "‹" },
+    {"lsquo",    "‘" },
+    {"raquo",    "»" },
+    {"rdquo",    "”" },
+    {"rsaquo",   "›" },
+    {"rsquo",    "’" },
+    {"sbquo",    "‚" },
+    {"emsp",     " " },
+    {"ensp",     " " },
+    {"nbsp",     " " },
+    {"thinsp",   " " },
+    {"zwj",      "‍" },
+    {"zwnj",     "‌" },
+    {"deg",      "°" },
+    {"divide",   "÷" },
+    {"frac12",   "½" },
+    {"frac14",   "¼" },
+    {"frac34",   "¾" },
+    {"ge",       "≥" },
+    {"le",       "≤" },
+    {"minus",    "−" },
+    {"sup2",     "²" },
+    {"sup3",     "³" },
+    {"times",    "×" },
+    {"alefsym",  "ℵ" },
+    {"and",      "∧" },
+    {"ang",      "∠" },
+    {"asymp",    "≈" },
+    {"cap",      "∩" },
+    {"cong",     "≅" },
+    {"cup",      "∪" },
+    {"empty",    "∅" },
+    {"equiv",    "≡" },
+    {"exist",    "∃" },
+    {"fnof",     "ƒ" },
+    {"forall",   "∀" },
+    {"infin",    "∞" },
+    {"int",      "∫" },
+    {"isin",     "∈" },
+    {"lang",     "〈" },
+    {"lceil",    "⌈" },
+    {"lfloor",   "⌊" },
+    {"lowast",   "∗" },
+    {"micro",    "µ" },
+    {"nabla",    "∇" },
+    {"ne",       "≠" },
+    {"ni",       "∋" },
+    {"notin",    "∉" },
+    {"nsub",     "⊄" },
+    {"oplus",    "⊕" },
+    {"or",       "∨" },
+    {"otimes",   "⊗" },
+    {"part",     "∂" },
+    {"perp",     "⊥" },
+    {"plusmn",   "±" },
+    {"prod",     "∏" },
+    {"prop",     "∝" },
+    {"radic",    "√" },
+    {"rang",     "〉" },
+    {"rceil",    "⌉" },
+    {"rfloor",   "⌋" },
+    {"sdot",     "⋅" },
+    {"sim",      "∼" },
+    {"sub",      "⊂" },
+    {"sube",     "⊆" },
+    {"sum",      "∑" },
+    {"sup",      "⊃" },
+    {"supe",     "⊇" },
+    {"there4",   "∴" },
+    {"Alpha",    "Α" },
+    {"alpha",    "α" },
+    {"Beta",     "Β" },
+    {"beta",     "β" },
+    {"Chi",      "Χ" },
+    {"chi",      "χ" },
+    {"Delta",    "Δ" },
+    {"delta",    "δ" },
+    {"Epsilon",  "Ε" },
+    {"epsilon",  "ε" },
+    {"Eta",      "Η" },
+    {"eta",      "η" },
+    {"Gamma",    "Γ" },
+    {"gamma",    "γ" },
+    {"Iota",     "Ι" },
+    {"iota",     "ι" },
+    {"Kappa",    "Κ" },
+    {"kappa",    "κ" },
+    {"Lambda",   "Λ" },
+    {"lambda",   "λ" },
+    {"Mu",       "Μ" },
+    {"mu",       "μ" },
+    {"Nu",       "Ν" },
+    {"nu",       "ν" },
+    {"Omega",    "Ω" },
+    {"omega",    "ω" },
+    {"Omicron",  "Ο" },
+    {"omicron",  "ο" },
+    {"Phi",      "Φ" },
+    {"phi",      "φ" },
+    {"Pi",       "Π" },
+    {"pi",       "π" },
+    {"piv",      "ϖ" },
+    {"Psi",      "Ψ" },
+    {"psi",      "ψ" },
+    {"Rho",      "Ρ" },
+    {"rho",      "ρ" },
+    {"Sigma",    "Σ" },
+    {"sigma",    "σ" },
+    {"sigmaf",   "ς" },
+    {"Tau",      "Τ" },
+    {"tau",      "τ" },
+    {"Theta",    "Θ" },
+    {"theta",    "θ" },
+    {"thetasym", "ϑ" },
+    {"upsih",    "ϒ" },
+    {"Upsilon",  "Υ" },
+    {"upsilon",  "υ" },
+    {"Xi",       "Ξ" },
+    {"xi",       "ξ" },
+    {"Zeta",     "Ζ" },
+    {"zeta",     "ζ" },
+    {"crarr",    "↵" },
+    {"darr",     "↓" },
+    {"dArr",     "⇓" },
+    {"harr",     "↔" },
+    {"hArr",     "⇔" },
+    {"larr",     "←" },
+    {"lArr",     "⇐" },
+    {"rarr",     "→" },
+    {"rArr",     "⇒" },
+    {"uarr",     "↑" },
+    {"uArr",     "⇑" },
+    {"clubs",    "♣" },
+    {"diams",    "♦" },
+    {"hearts",   "♥" },
+    {"spades",   "♠" },
+    {"loz",      "◊" },
+    {"apos",     "'" },
+};
+
+static constexpr size_t NUMENTITIES =
+    sizeof(htmlentities) / sizeof(*htmlentities);
+
+/* The lookup table is built by the compiler: an open-addressed hash table,
+ * sparse enough that a lookup probes at most a couple of slots, holding
+ * indices (plus one) into htmlentities. */
+
+static const size_t ENTITYSLOTS = 1024;
+
+static constexpr uint32_t hashentity(std::string_view s)
+{
+    uint32_t h = 2166136261u;
+    for (char c : s)
+        h = (h ^ (uint8_t)c) * 16777619u;
+    return h;
+}
+
+struct HTMLEntityTable
+{
+    uint16_t slots[ENTITYSLOTS];
+    size_t maxprobes;
+};
+
+static constexpr HTMLEntityTable makeentitytable()
+{
+    HTMLEntityTable t = {};
+    for (size_t i = 0; i < NUMENTITIES; i++)
+    {
+        size_t h = hashentity(htmlentities[i].name) & (ENTITYSLOTS - 1);
+        size_t probes = 1;
+        while (t.slots[h])
+        {
+            h = (h + 1) & (ENTITYSLOTS - 1);
+            probes++;
+        }
+        t.slots[h] = i + 1;
+        t.maxprobes = std::max(t.maxprobes, probes);
+    }
+    return t;
+}
+
+static constexpr HTMLEntityTable entitytable = makeentitytable();
+static_assert(entitytable.maxprobes <= 4, "entity table is too crowded");
+
+static const HTMLEntity* findentity(std::string_view name)
+{
+    size_t h = hashentity(name) & (ENTITYSLOTS - 1);
+    for (size_t i = 0; i < entitytable.maxprobes; i++)
+    {
+        int slot = entitytable.slots[h];
+        if (!slot)
+            break;
+        const HTMLEntity* e = &htmlentities[slot - 1];
+        if (e->name == name)
+            return e;
+        h = (h + 1) & (ENTITYSLOTS - 1);
+    }
+    return nullptr;
+}
+
+/* Decodes the entity "&...;" at the start of s, appending the result to out
+ * and returning its length; or returns 0 if there isn't a valid one. */
+
+static size_t decodeentity(std::string& out, std::string_view s)
+{
+    size_t semi = s.find(';', 1);
+    if ((semi == std::string_view::npos) || (semi > MAXENTITYLENGTH))
+        return 0;
+    std::string_view name = s.substr(1, semi - 1);
+
+    if ((name.size() > 1) && (name[0] == '#'))
+    {
+        bool hex = (name[1] == 'x') || (name[1] == 'X');
+        std::string_view digits = name.substr(hex ? 2 : 1);
+        if (digits.empty())
+            return 0;
+
+        uint32_t c = 0;
+        for (char d : digits)
+        {
+            int v;
+            if ((d >= '0') && (d <= '9'))
+                v = d - '0';
+            else if (hex && (d >= 'a') && (d <= 'f'))
+                v = d - 'a' + 10;
+            else if (hex && (d >= 'A') && (d <= 'F'))
+                v = d - 'A' + 10;
+            else
+                return 0;
+            c = c * (hex ? 16 : 10) + v;
+            if (c > 0x10ffff)
+                return 0;
+        }
+        if ((c == 0) || ((c >= 0xd800) && (c <= 0xdfff)))
+            return 0;
+
+        char buffer[8];
+        char* p = buffer;
+        writeu8(&p, c);
+        out.append(buffer, p - buffer);
+        return semi + 1;
+    }
+
+    const HTMLEntity* e = findentity(name);
+    if (!e)
+        return 0;
+    out += e->value;
+    return semi + 1;
+}
+
+/* Returns s with all the entities in it decoded, in one pass; unknown or
+ * malformed ones are left as they are. */
+
+static int decodeentities_cb(lua_State* L)
+{
+    size_t len;
+    const char* p = luaL_checklstring(L, 1, &len);
+    std::string_view s(p, len);
+
+    size_t amp = s.find('&');
+    if (amp == std::string_view::npos)
+    {
+        lua_settop(L, 1);
+        return 1;
+    }
+
+    std::string out;
+    out.reserve(len);
+    while (amp != std::string_view::npos)
+    {
+        out.append(s.substr(0, amp));
+        s.remove_prefix(amp);
+        size_t used = decodeentity(out, s);
+        if (!used)
+        {
+            out += '&';
+            used = 1;
+        }
+        s.remove_prefix(used);
+        amp = s.find('&');
+    }
+    out.append(s);
+
+    lua_pushlstring(L, out.data(), out.size());
+    return 1;
+}
+
+void html_init(void)
+{
+    const static luaL_Reg funcs[] = {
+        {"decodeentities", decodeentities_cb},
+        {"htmltokens",     htmltokens_cb    },
+        {NULL,             NULL             }
+    };
+
+    luaL_newmetatable(L, HTMLTOKENS);
+    lua_pop(L, 1);
+
+    luaL_register(L, "wg", funcs);
+    lua_pop(L, 1);
+}
+
+// vim: sw=4 ts=4 et
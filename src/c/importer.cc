@@ -0,0 +1,659 @@
+/* © 2026 David Given.
+ * WordGrinder is licensed under the MIT open source license. See the COPYING
+ * file in this distribution for the full text.
+ */
+
+#include "globals.h"
+#include <string.h>
+#include <algorithm>
+#include <functional>
+#include <thread>
+
+/* The paragraph builder which all the importers feed. Text accumulates into
+ * the current word, with a style control byte wherever the style changes;
+ * finished words are kept back to back in a single arena, so building a
+ * paragraph costs one Lua string per word and nothing else. */
+
+static const char IMPORTER[] = "wg.importer";
+
+void importreset(ParagraphBuilder& pb)
+{
+    pb.arena.clear();
+    pb.ends.clear();
+    pb.pending = false;
+    pb.oldattr = 0;
+    pb.attr = 0;
+}
+
+void importtext(ParagraphBuilder& pb, const char* s, size_t len)
+{
+    if (pb.oldattr != pb.attr)
+    {
+        pb.arena += (char)(16 + pb.attr);
+        pb.oldattr = pb.attr;
+    }
+    pb.arena.append(s, len);
+    pb.pending = true;
+}
+
+void importflushword(ParagraphBuilder& pb, bool force)
+{
+    if (pb.pending || force)
+    {
+        pb.ends.push_back(pb.arena.size());
+        pb.pending = false;
+        pb.oldattr = 0;
+    }
+}
+
+bool importparagraph(lua_State* L, ParagraphBuilder& pb)
+{
+    if (pb.pending)
+        importflushword(pb, false);
+    if (pb.ends.empty())
+        return false;
+
+    lua_createtable(L, pb.ends.size(), 1); /* room for a style field */
+    size_t start = 0;
+    for (size_t i = 0; i < pb.ends.size(); i++)
+    {
+        size_t end = pb.ends[i];
+        lua_pushlstring(L, pb.arena.data() + start, end - start);
+        lua_rawseti(L, -2, i + 1);
+        start = end;
+    }
+
+    pb.arena.clear();
+    pb.ends.clear();
+    return true;
+}
+
+/* The Lua interface: wg.createimporter(append) returns a table of methods
+ * matching the Importer type in import.lua, all sharing one builder.
+ * Whenever flushparagraph() produces a paragraph it calls append(style,
+ * words). */
+
+struct ImporterBox
+{
+    ParagraphBuilder* pb;
+};
+
+static void importer_dtor(void* p)
+{
+    ImporterBox* box = (ImporterBox*)p;
+    delete box->pb;
+    box->pb = nullptr;
+}
+
+static ParagraphBuilder& getbuilder(lua_State* L)
+{
+    return *((ImporterBox*)luaL_checkudata(L, lua_upvalueindex(1), IMPORTER))
+                ->pb;
+}
+
+static int reset_cb(lua_State* L)
+{
+    importreset(getbuilder(L));
+    return 0;
+}
+
+static int style_on_cb(lua_State* L)
+{
+    ParagraphBuilder& pb = getbuilder(L);
+    pb.attr |= luaL_checkinteger(L, 2);
+    return 0;
+}
+
+static int style_off_cb(lua_State* L)
+{
+    ParagraphBuilder& pb = getbuilder(L);
+    pb.attr &= ~luaL_checkinteger(L, 2);
+    return 0;
+}
+
+static int text_cb(lua_State* L)
+{
+    ParagraphBuilder& pb = getbuilder(L);
+    size_t len;
+    const char* s = luaL_checklstring(L, 2, &len);
+    importtext(pb, s, len);
+    return 0;
+}
+
+static int flushword_cb(lua_State* L)
+{
+    importflushword(getbuilder(L), lua_toboolean(L, 2));
+    return 0;
+}
+
+static int flushparagraph_cb(lua_State* L)
+{
+    ParagraphBuilder& pb = getbuilder(L);
+    const char* style = luaL_optstring(L, 2, "P");
+
+    lua_pushvalue(L, lua_upvalueindex(2));
+    lua_pushstring(L, style);
+    if (!importparagraph(L, pb))
+        return 0;
+    lua_call(L, 2, 0);
+    return 0;
+}
+
+static int createimporter_cb(lua_State* L)
+{
+    luaL_checktype(L, 1, LUA_TFUNCTION);
+
+    const static luaL_Reg methods[] = {
+        {"reset",          reset_cb         },
+        {"style_on",       style_on_cb      },
+        {"style_off",      style_off_cb     },
+        {"text",           text_cb          },
+        {"flushword",      flushword_cb     },
+        {"flushparagraph", flushparagraph_cb},
+        {NULL,             NULL             }
+    };
+
+    lua_createtable(L, 0, 6);
+
+    ImporterBox* box = (ImporterBox*)lua_newuserdatadtor(
+        L, sizeof(ImporterBox), importer_dtor);
+    box->pb = new ParagraphBuilder();
+    luaL_getmetatable(L, IMPORTER);
+    lua_setmetatable(L, -2);
+    int boxindex = lua_gettop(L);
+
+    for (const luaL_Reg* m = methods; m->name; m++)
+    {
+        lua_pushvalue(L, boxindex);
+        lua_pushvalue(L, 1);
+        lua_pushcclosure(L, m->func, 2);
+        lua_setfield(L, -3, m->name);
+    }
+
+    lua_pop(L, 1);
+    return 1;
+}
+
+/* The plain text importer: each line becomes a paragraph. Text is made
+ * valid UTF-8 as it goes (invalid bytes are dropped), control characters
+ * are removed, and the words are whatever lies between the spaces. Lines
+ * are independent, so big documents are cut into chunks at line boundaries
+ * and each chunk is split on its own thread. */
+
+static const size_t TEXTCHUNKSIZE = 1024 * 1024;
+
+struct TextChunk
+{
+    const char* start;
+    const char* end;
+
+    std::string arena;         /* the chunk's words, back to back */
+    std::vector<size_t> words; /* where each word ends in arena */
+    std::vector<size_t> lines; /* the number of words before each line end */
+};
+
+static void splittext(TextChunk& c)
+{
+    const char* p = c.start;
+    const char* linestart = p;
+    size_t wordstart = 0;
+
+    auto endword = [&]()
+    {
+        if (c.arena.size() != wordstart)
+        {
+            c.words.push_back(c.arena.size());
+            wordstart = c.arena.size();
+        }
+    };
+
+    while (p < c.end)
+    {
+        uint8_t b = *p;
+        if (b == '\n')
+        {
+            endword();
+            c.lines.push_back(c.words.size());
+            linestart = ++p;
+        }
+        else if (b == ' ')
+        {
+            endword();
+            p++;
+        }
+        else if ((b < 0x20) || (b == 0x7f))
+            p++;
+        else if (b < 0x80)
+            c.arena += *p++;
+        else
+        {
+            int n = validu8bytes(p, c.end);
+            if (n == 0)
+                p++;
+            else
+            {
+                char buffer[8];
+                char* out = buffer;
+                writeu8(&out, readu8(&p));
+                c.arena.append(buffer, out - buffer);
+            }
+        }
+    }
+
+    /* A last line with no newline. */
+
+    if (p != linestart)
+    {
+        endword();
+        c.lines.push_back(c.words.size());
+    }
+}
+
+/* Returns an array of paragraphs' worth of words, one per line of the
+ * text; a blank line has a single empty word. */
+
+static int importtext_cb(lua_State* L)
+{
+    size_t len;
+    const char* data = checkbuffer(L, 1, &len);
+    const char* end = data + len;
+
+    std::vector<TextChunk> chunks;
+    const char* p = data;
+    while (p < end)
+    {
+        const char* q = p + std::min<size_t>(TEXTCHUNKSIZE, end - p);
+        if (q < end)
+        {
+            q = (const char*)memchr(q, '\n', end - q);
+            q = q ? (q + 1) : end;
+        }
+        chunks.push_back({p, q});
+        p = q;
+    }
+
+    std::atomic<size_t> next = 0;
+    auto worker = [&]()
+    {
+        for (;;)
+        {
+            size_t i = next++;
+            if (i >= chunks.size())
+                break;
+            splittext(chunks[i]);
+        }
+    };
+
+    size_t threads = std::min<size_t>(
+        std::max(std::thread::hardware_concurrency(), 1U), chunks.size());
+    std::vector<std::thread> pool;
+    for (size_t i = 1; i < threads; i++)
+        pool.emplace_back(worker);
+    worker();
+    for (auto& t : pool)
+        t.join();
+
+    size_t count = 0;
+    for (const TextChunk& c : chunks)
+        count += c.lines.size();
+
+    lua_createtable(L, count, 0);
+    int index = 0;
+    for (const TextChunk& c : chunks)
+    {
+        size_t word = 0;
+        size_t start = 0;
+        for (size_t lineend : c.lines)
+        {
+            size_t n = lineend - word;
+            lua_createtable(L, std::max<size_t>(n, 1), 0);
+            if (n == 0)
+            {
+                lua_pushstring(L, "");
+                lua_rawseti(L, -2, 1);
+            }
+            for (size_t i = 0; i < n; i++)
+            {
+                size_t wordend = c.words[word++];
+                lua_pushlstring(L, c.arena.data() + start, wordend - start);
+                lua_rawseti(L, -2, i + 1);
+                start = wordend;
+            }
+            lua_rawseti(L, -2, ++index);
+        }
+    }
+    return 1;
+}
+
+/* --- Text views ---------------------------------------------------------
+ *
+ * A text view is a plain text file which is mapped and looked at, rather
+ * than imported, for files too big to be worth turning into a document.
+ * Only the start of every LINESTRIDE-th line is indexed, so opening one
+ * costs a single pass over the file to find the newlines and very little
+ * memory; the lines in between are found by skipping newlines from the
+ * nearest start. Each line is split into words by the text importer's rules
+ * only when it's asked for.
+ *
+ * Offsets in the file are 1-based, as for mapped files. */
+
+static const char TEXTVIEW[] = "wg.textview";
+static const size_t LINESTRIDE = 64;
+
+struct TextView
+{
+    MappedFile mf = {};
+    size_t lines = 0;
+    std::vector<size_t> starts; /* of lines 1, 1+LINESTRIDE, 1+2*LINESTRIDE... */
+};
+
+static void textview_dtor(void* p)
+{
+    TextView* tv = (TextView*)p;
+    unmapfile(&tv->mf);
+    tv->~TextView();
+}
+
+static TextView* checktextview(lua_State* L, int index)
+{
+    return (TextView*)luaL_checkudata(L, index, TEXTVIEW);
+}
+
+/* Returns the 0-based offset of the start of line ln. */
+
+static size_t linestart(const TextView* tv, size_t ln)
+{
+    size_t base = tv->starts[(ln - 1) / LINESTRIDE];
+    size_t n = (ln - 1) % LINESTRIDE;
+    return base + skiplines(tv->mf.data + base, tv->mf.len - base, &n);
+}
+
+static size_t lineend(const TextView* tv, size_t start)
+{
+    if (start >= tv->mf.len)
+        return tv->mf.len;
+    const char* e = (const char*)memchr(
+        tv->mf.data + start, '\n', tv->mf.len - start);
+    return e ? (e - tv->mf.data) : tv->mf.len;
+}
+
+/* Returns the line containing the 0-based offset pos, and the offset of
+ * its start in *start. */
+
+static size_t findline(const TextView* tv, size_t pos, size_t* start)
+{
+    size_t k =
+        std::upper_bound(tv->starts.begin(), tv->starts.end(), pos) -
+        tv->starts.begin() - 1;
+    size_t n = SIZE_MAX;
+    size_t base = tv->starts[k];
+    *start = base + skiplines(tv->mf.data + base, pos - base, &n);
+    return (k * LINESTRIDE) + 1 + (SIZE_MAX - n);
+}
+
+/* Finds the word, and the 1-based offset into it, at which the byte at
+ * offset o of a line ends up once the line is split into words; or, if end
+ * is set, the position just after the byte before it. */
+
+static void findword(std::string_view line, size_t o, bool end, int* word,
+    int* offset)
+{
+    TextChunk c = {line.data(), line.data() + o};
+    splittext(c);
+    size_t n = c.words.size();
+    size_t last = n ? (c.words[n - 1] - ((n > 1) ? c.words[n - 2] : 0)) : 0;
+    if ((n == 0) || (!end && (line[o - 1] == ' ')))
+    {
+        *word = n + 1;
+        *offset = 1;
+    }
+    else
+    {
+        *word = n;
+        *offset = last + 1;
+    }
+}
+
+/* The search text is folded as documents are (see paragraph.cc), except
+ * that only ASCII letters change, so the folded text is exactly as long as
+ * the original and offsets into one are offsets into the other. */
+
+static void foldinto(std::string& dest, const char* s, size_t len)
+{
+    dest.resize(len);
+    for (size_t i = 0; i < len; i++)
+    {
+        char c = s[i];
+        dest[i] = ((c >= 'A') && (c <= 'Z')) ? (c + 'a' - 'A') : c;
+    }
+}
+
+/* wg.viewtext(filename) returns a text view, or nil and an error. */
+
+static int viewtext_cb(lua_State* L)
+{
+    const char* filename = luaL_checkstring(L, 1);
+
+    TextView* tv = (TextView*)lua_newuserdatadtor(
+        L, sizeof(TextView), textview_dtor);
+    new (tv) TextView();
+    luaL_getmetatable(L, TEXTVIEW);
+    lua_setmetatable(L, -2);
+
+    if (!mapfile(filename, &tv->mf))
+    {
+        lua_pushnil(L);
+        lua_pushstring(L, strerror(errno));
+        return 2;
+    }
+
+    const char* data = tv->mf.data;
+    size_t len = tv->mf.len;
+    size_t pos = 0;
+    tv->starts.push_back(0);
+    for (;;)
+    {
+        size_t n = LINESTRIDE;
+        pos += skiplines(data + pos, len - pos, &n);
+        tv->lines += LINESTRIDE - n;
+        if ((n != 0) || (pos == len))
+            break;
+        tv->starts.push_back(pos);
+    }
+    if ((len == 0) || (data[len - 1] != '\n'))
+        tv->lines++; /* a last line with no newline, or an empty file */
+    return 1;
+}
+
+static int textview_lines_cb(lua_State* L)
+{
+    lua_pushinteger(L, checktextview(L, 1)->lines);
+    return 1;
+}
+
+static int textview_len_cb(lua_State* L)
+{
+    lua_pushinteger(L, checktextview(L, 1)->mf.len);
+    return 1;
+}
+
+/* Returns line ln's words, as wg.importtext() would; a blank line has a
+ * single empty word. */
+
+static int textview_words_cb(lua_State* L)
+{
+    TextView* tv = checktextview(L, 1);
+    size_t ln = luaL_checkinteger(L, 2);
+    luaL_argcheck(L, (ln >= 1) && (ln <= tv->lines), 2, "no such line");
+
+    size_t start = linestart(tv, ln);
+    size_t end = lineend(tv, start);
+    TextChunk c = {tv->mf.data + start, tv->mf.data + end};
+    splittext(c);
+
+    lua_createtable(L, std::max<size_t>(c.words.size(), 1), 0);
+    if (c.words.empty())
+    {
+        lua_pushstring(L, "");
+        lua_rawseti(L, -2, 1);
+    }
+    size_t wordstart = 0;
+    for (size_t i = 0; i < c.words.size(); i++)
+    {
+        lua_pushlstring(
+            L, c.arena.data() + wordstart, c.words[i] - wordstart);
+        lua_rawseti(L, -2, i + 1);
+        wordstart = c.words[i];
+    }
+    return 1;
+}
+
+/* Returns the offset of the start of line ln. */
+
+static int textview_offset_cb(lua_State* L)
+{
+    TextView* tv = checktextview(L, 1);
+    size_t ln = luaL_checkinteger(L, 2);
+    luaL_argcheck(L, (ln >= 1) && (ln <= tv->lines), 2, "no such line");
+    lua_pushinteger(L, linestart(tv, ln) + 1);
+    return 1;
+}
+
+/* view:find(text, isregex, from, to) looks for the first match which starts
+ * between offsets from and to (inclusive) directly in the mapped file. Lines
+ * are searched as paragraphs would be, so matches never span them, and
+ * regular expressions see each one on its own. Returns the line, the word
+ * and offset of the start of the match and of its end (as in findtext()),
+ * and the offset of the match, or nothing. Long searches should be done a
+ * range at a time, so they can be interrupted. */
+
+static int textview_find_cb(lua_State* L)
+{
+    TextView* tv = checktextview(L, 1);
+    size_t textlen;
+    const char* text = luaL_checklstring(L, 2, &textlen);
+    bool isregex = lua_toboolean(L, 3);
+    size_t len = tv->mf.len;
+    size_t from = std::max<lua_Integer>(luaL_checkinteger(L, 4), 1) - 1;
+    size_t to = std::min<lua_Integer>(luaL_checkinteger(L, 5), len);
+    if ((textlen == 0) || (from >= to))
+        return 0;
+
+    const char* data = tv->mf.data;
+    size_t found = SIZE_MAX;
+    size_t foundend = 0;
+    std::string folded;
+    if (isregex)
+    {
+        Regex regex;
+        std::string error;
+        if (!compileregex(regex, std::string_view(text, textlen), error))
+            luaL_error(L, "%s", error.c_str());
+
+        size_t start;
+        findline(tv, from, &start);
+        while (start < to)
+        {
+            size_t end = lineend(tv, start);
+            foldinto(folded, data + start, end - start);
+            size_t s, e;
+            if (searchregex(regex, folded,
+                    (from > start) ? (from - start) : 0, &s, &e))
+            {
+                if ((start + s) < to)
+                {
+                    found = start + s;
+                    foundend = start + e;
+                }
+                break;
+            }
+            start = end + 1;
+        }
+    }
+    else
+    {
+        std::string needle;
+        foldinto(needle, text, textlen);
+        size_t end = std::min(len, to + needle.size() - 1);
+        foldinto(folded, data + from, end - from);
+        std::boyer_moore_horspool_searcher searcher(
+            needle.begin(), needle.end());
+
+        auto i = folded.cbegin();
+        for (;;)
+        {
+            i = std::search(i, folded.cend(), searcher);
+            if ((i == folded.cend()) || ((from + (i - folded.cbegin())) >= to))
+                break;
+            auto e = i + needle.size();
+            if (std::find(i, e, '\n') == e)
+            {
+                found = from + (i - folded.cbegin());
+                foundend = found + needle.size();
+                break;
+            }
+            i++;
+        }
+    }
+    if (found == SIZE_MAX)
+        return 0;
+
+    size_t start;
+    size_t ln = findline(tv, found, &start);
+    std::string_view line(data + start, lineend(tv, start) - start);
+    int mw, mo, ew, eo;
+    findword(line, found - start, false, &mw, &mo);
+    findword(line, foundend - start, true, &ew, &eo);
+    lua_pushinteger(L, ln);
+    lua_pushinteger(L, mw);
+    lua_pushinteger(L, mo);
+    lua_pushinteger(L, ew);
+    lua_pushinteger(L, eo);
+    lua_pushinteger(L, found + 1);
+    return 6;
+}
+
+/* Afterwards the view is empty. */
+
+static int textview_close_cb(lua_State* L)
+{
+    TextView* tv = checktextview(L, 1);
+    unmapfile(&tv->mf);
+    tv->starts = {0};
+    tv->lines = 1;
+    return 0;
+}
+
+void importer_init(void)
+{
+    const static luaL_Reg funcs[] = {
+        {"createimporter", createimporter_cb},
+        {"importtext",     importtext_cb    },
+        {"viewtext",       viewtext_cb      },
+        {NULL,             NULL             }
+    };
+
+    const static luaL_Reg textviewmethods[] = {
+        {"close",  textview_close_cb },
+        {"find",   textview_find_cb  },
+        {"len",    textview_len_cb   },
+        {"lines",  textview_lines_cb },
+        {"offset", textview_offset_cb},
+        {"words",  textview_words_cb },
+        {NULL,     NULL              }
+    };
+
+    luaL_newmetatable(L, IMPORTER);
+    lua_pop(L, 1);
+
+    luaL_newmetatable(L, TEXTVIEW);
+    lua_newtable(L);
+    luaL_register(L, NULL, textviewmethods);
+    lua_setfield(L, -2, "__index");
+    lua_pop(L, 1);
+
+    luaL_register(L, "wg", funcs);
+    lua_pop(L, 1);
+}
+
+// vim: sw=4 ts=4 et
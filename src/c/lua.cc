@@ -4,12 +4,175 @@
  */
 
 #include "globals.h"
+#include <string.h>
+#include <algorithm>
+#include <chrono>
 #include <fstream>
 #include <string>
 #include "Luau/Compiler.h"
+#if defined WITH_CODEGEN
+#include "Luau/CodeGen.h"
+#endif
 
 lua_State* L;
 
+/* The built-in scripts run with Luau's safe environment flag set on the
+ * globals, which lets the VM call builtins like string.byte and math.floor
+ * directly. That's only sound if nobody can replace them, so the standard
+ * libraries are frozen once loaded. Anything loaded later with loadstring()
+ * --- user scripts, config files, --lua and --exec --- instead gets an
+ * environment of its own which passes reads and writes through to the
+ * globals, and which isn't safe, so it always takes the slow paths. */
+
+static int userenv = 0;
+
+static void freezebuiltins(lua_State* L)
+{
+    static const char* const libraries[] = {LUA_COLIBNAME,
+        LUA_TABLIBNAME,
+        LUA_OSLIBNAME,
+        LUA_STRLIBNAME,
+        LUA_MATHLIBNAME,
+        LUA_DBLIBNAME,
+        LUA_UTF8LIBNAME,
+        LUA_BITLIBNAME,
+        LUA_BUFFERLIBNAME,
+        nullptr};
+
+    for (const char* const* lib = libraries; *lib; lib++)
+    {
+        lua_getglobal(L, *lib);
+        if (lua_istable(L, -1))
+            lua_setreadonly(L, -1, true);
+        lua_pop(L, 1);
+    }
+
+    lua_pushliteral(L, "");
+    if (lua_getmetatable(L, -1))
+    {
+        lua_setreadonly(L, -1, true);
+        lua_pop(L, 1);
+    }
+    lua_pop(L, 1);
+}
+
+static void createuserenv(lua_State* L)
+{
+    lua_newtable(L);
+    lua_newtable(L);
+    lua_pushvalue(L, LUA_GLOBALSINDEX);
+    lua_setfield(L, -2, "__index");
+    lua_pushvalue(L, LUA_GLOBALSINDEX);
+    lua_setfield(L, -2, "__newindex");
+    lua_setreadonly(L, -1, true);
+    lua_setmetatable(L, -2);
+
+    userenv = lua_ref(L, -1);
+    lua_pop(L, 1);
+}
+
+/* Conversions are short-lived and allocate a lot, and nearly everything they
+ * allocate lives until they finish, so incremental collection during them is
+ * mostly wasted work. Batch mode lets the heap grow further between cycles
+ * and does the work in bigger, less frequent steps.
+ *
+ * Typing mode is for bursts of keystrokes: the heap may grow further before
+ * the collector wakes up, so that less of its work lands in the middle of a
+ * redraw, and the debt is paid off with wg.gcstep() once the user stops. */
+
+static int setgcmode_cb(lua_State* L)
+{
+    const char* mode = luaL_checkstring(L, 1);
+    if (strcmp(mode, "batch") == 0)
+    {
+        lua_gc(L, LUA_GCSETGOAL, 400);
+        lua_gc(L, LUA_GCSETSTEPMUL, 150);
+        lua_gc(L, LUA_GCSETSTEPSIZE, 64);
+    }
+    else if (strcmp(mode, "interactive") == 0)
+    {
+        lua_gc(L, LUA_GCSETGOAL, 200);
+        lua_gc(L, LUA_GCSETSTEPMUL, 200);
+        lua_gc(L, LUA_GCSETSTEPSIZE, 1);
+    }
+    else if (strcmp(mode, "typing") == 0)
+    {
+        lua_gc(L, LUA_GCSETGOAL, 400);
+        lua_gc(L, LUA_GCSETSTEPMUL, 200);
+        lua_gc(L, LUA_GCSETSTEPSIZE, 1);
+    }
+    else
+        luaL_argerror(L, 1, "unknown GC mode");
+    return 0;
+}
+
+/* Does a full collection; for the benchmarks, which want each run to start
+ * from the same place. */
+
+static int collectgarbage_cb(lua_State* L)
+{
+    lua_gc(L, LUA_GCCOLLECT, 0);
+    return 0;
+}
+
+/* Explicit GC work, done in small steps until either the current cycle
+ * finishes (in which case it returns true) or the time budget, in seconds,
+ * runs out. Each call's duration is kept for wg.gcstats(). */
+
+static const int GCSTEPKB = 16;
+
+static struct
+{
+    int steps;
+    int cycles;
+    double total;
+    double max;
+    double last;
+} gcstats;
+
+static int gcstep_cb(lua_State* L)
+{
+    double budget = luaL_checknumber(L, 1);
+    auto start = std::chrono::steady_clock::now();
+    double elapsed;
+    bool finished;
+    do
+    {
+        finished = lua_gc(L, LUA_GCSTEP, GCSTEPKB);
+        elapsed = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start)
+                      .count();
+    } while (!finished && (elapsed < budget));
+
+    gcstats.steps++;
+    gcstats.cycles += finished;
+    gcstats.total += elapsed;
+    gcstats.max = std::max(gcstats.max, elapsed);
+    gcstats.last = elapsed;
+
+    lua_pushboolean(L, finished);
+    return 1;
+}
+
+/* Returns how many wg.gcstep() calls there have been, how many finished a
+ * cycle, and their total, longest and most recent durations in seconds. */
+
+static int gcstats_cb(lua_State* L)
+{
+    lua_createtable(L, 0, 5);
+    lua_pushinteger(L, gcstats.steps);
+    lua_setfield(L, -2, "steps");
+    lua_pushinteger(L, gcstats.cycles);
+    lua_setfield(L, -2, "cycles");
+    lua_pushnumber(L, gcstats.total);
+    lua_setfield(L, -2, "total");
+    lua_pushnumber(L, gcstats.max);
+    lua_setfield(L, -2, "max");
+    lua_pushnumber(L, gcstats.last);
+    lua_setfield(L, -2, "last");
+    return 1;
+}
+
 static int report(lua_State* L, int status)
 {
     if (status && !lua_isnil(L, -1))
@@ -76,8 +239,10 @@ static int loadstring_cb(lua_State* L)
     const char* s = luaL_checklstring(L, 1, &len);
     const char* name = luaL_optlstring(L, 2, nullptr, nullptr);
 
-    lua_setsafeenv(L, LUA_ENVIRONINDEX, false);
-    if (luaL_loadstring(L, s, name) == 0)
+    lua_getref(L, userenv);
+    int status = luaL_loadstring(L, s, name, -1);
+    lua_remove(L, -2);
+    if (status == 0)
         return 1;
 
     lua_pushnil(L);
@@ -91,10 +256,53 @@ static int exit_cb(lua_State* L)
     exit(e);
 }
 
+/* Modules which aren't loaded at startup (see modules.lua). They're trusted
+ * code like the rest of the built-in scripts, so they run in the globals. */
+
+static const FileDescriptor* modules = nullptr;
+
+void script_register_modules(const FileDescriptor* table)
+{
+    modules = table;
+}
+
+static int loadmodule_cb(lua_State* L)
+{
+    const char* name = luaL_checkstring(L, 1);
+
+    const FileDescriptor* m = modules;
+    while (m && m->name && (strcmp(m->name, name) != 0))
+        m++;
+    if (!m || !m->name)
+        luaL_error(L, "no such module '%s'", name);
+
+    /* As in script_load_from_table(), globals mustn't be resolved at load
+     * time. */
+
+    lua_setsafeenv(L, LUA_GLOBALSINDEX, false);
+    int status = luaL_loadbytecode(L, m->data.data(), m->data.size(), m->name);
+#if defined WITH_CODEGEN
+    if ((status == 0) && Luau::CodeGen::isSupported())
+        Luau::CodeGen::compile(L, -1, Luau::CodeGen::CodeGen_OnlyNativeModules);
+#endif
+    lua_setsafeenv(L, LUA_GLOBALSINDEX, true);
+    if (status)
+        lua_error(L);
+
+    lua_call(L, 0, 0);
+    return 0;
+}
+
 void script_init(void)
 {
-    L = luaL_newstate();
+    L = lua_newstate(scriptalloc, nullptr);
+#if defined WITH_CODEGEN
+    if (Luau::CodeGen::isSupported())
+        Luau::CodeGen::create(L);
+#endif
     luaL_openlibs(L);
+    freezebuiltins(L);
+    createuserenv(L);
 
     atexit(script_deinit);
 
@@ -121,7 +329,12 @@ void script_init(void)
     luaL_register(L,
         "wg",
         (const luaL_Reg[]){
-            {"exit", exit_cb},
+            {"collectgarbage", collectgarbage_cb},
+            {"exit",           exit_cb          },
+            {"gcstats",        gcstats_cb       },
+            {"gcstep",         gcstep_cb        },
+            {"loadmodule",     loadmodule_cb    },
+            {"setgcmode",      setgcmode_cb     },
             {}
     });
 
@@ -137,34 +350,48 @@ void script_init(void)
 
 void script_load_from_table(const FileDescriptor* table)
 {
+    /* Globals are resolved at load time in a safe environment, but the
+     * built-in scripts define and redefine each other's globals as they go
+     * (and users can replace them later), so the safe flag only goes on once
+     * everything has loaded. */
+
+    lua_setsafeenv(L, LUA_GLOBALSINDEX, false);
     while (table->name)
     {
-        int status = luaL_dostring(L, table->data.c_str(), table->name);
+        int status = luaL_loadbytecode(
+            L, table->data.data(), table->data.size(), table->name);
+#if defined WITH_CODEGEN
+        /* Only the modules marked --!native are worth the compilation time. */
+        if ((status == 0) && Luau::CodeGen::isSupported())
+            Luau::CodeGen::compile(L, -1, Luau::CodeGen::CodeGen_OnlyNativeModules);
+#endif
+        if (status == 0)
+            status = lua_pcall(L, 0, LUA_MULTRET, 0);
         if (status)
         {
             (void)report(L, status);
             break;
         }
 
+        tracestartup(std::string("load ") + table->name);
         table++;
     }
+    lua_setsafeenv(L, LUA_GLOBALSINDEX, true);
 }
 
 void script_run(const char* argv[])
 {
-    lua_getglobal(L, "Main");
-
-    /* Push the arguments onto the stack. */
+    /* The stack needs room for Main, the arguments and docall()'s traceback
+     * handler; it isn't empty, as the init functions leave things on it. */
 
     int argc = 0;
-    for (;;)
-    {
-        const char* s = *argv++;
-        if (!s)
-            break;
-        lua_pushstring(L, s);
+    while (argv[argc])
         argc++;
-    }
+    luaL_checkstack(L, argc + 2, "too many arguments");
+
+    lua_getglobal(L, "Main");
+    for (int i = 0; i < argc; i++)
+        lua_pushstring(L, argv[i]);
 
     /* Call the main program. */
 
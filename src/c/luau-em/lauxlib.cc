@@ -17,16 +17,17 @@ static Luau::ParseOptions popts()
     return result;
 }
 
-int luaL_loadstring(lua_State* L, const char* str, const char* name)
-{
-    lua_setsafeenv(L, LUA_ENVIRONINDEX, false);
+/* Loads precompiled bytecode, such as the built-in scripts (which are
+ * compiled at build time by tools/luacompile.cc with the same options).
+ * env is the stack index of the chunk's environment, or 0 for the globals.
+ * It's up to the caller to decide whether that environment is safe. */
 
-    std::string bytecode = Luau::compile(std::string(str), copts(), popts());
-    if (luau_load(L,
-            name ? name : "(anonymous)",
-            bytecode.data(),
-            bytecode.size(),
-            0) == 0)
+int luaL_loadbytecode(
+    lua_State* L, const char* data, size_t size, const char* name, int env)
+{
+    if (env)
+        env = lua_absindex(L, env);
+    if (luau_load(L, name ? name : "(anonymous)", data, size, env) == 0)
         return 0;
 
     lua_pushnil(L);
@@ -34,6 +35,14 @@ int luaL_loadstring(lua_State* L, const char* str, const char* name)
     return LUA_ERRRUN;
 }
 
+int luaL_loadstring(lua_State* L, const char* str, const char* name, int env)
+{
+    if (env)
+        env = lua_absindex(L, env);
+    std::string bytecode = Luau::compile(std::string(str), copts(), popts());
+    return luaL_loadbytecode(L, bytecode.data(), bytecode.size(), name, env);
+}
+
 int luaL_dostring(lua_State* L, const char* str, const char* name)
 {
     int status = luaL_loadstring(L, str, name);
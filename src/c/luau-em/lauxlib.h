@@ -14,5 +14,11 @@
 
 #define lua_rawlen lua_objlen
 
-extern int luaL_loadstring(lua_State* L, const char* str, const char* name);
+extern int luaL_loadbytecode(lua_State* L,
+    const char* data,
+    size_t size,
+    const char* name,
+    int env = 0);
+extern int luaL_loadstring(
+    lua_State* L, const char* str, const char* name, int env = 0);
 extern int luaL_dostring(lua_State* L, const char* str, const char* name);
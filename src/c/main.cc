@@ -10,6 +10,7 @@
 #include "globals.h"
 
 #include "script_table.h"
+#include "lazy_script_table.h"
 
 #if !defined WIN32
 #include <langinfo.h>
@@ -30,6 +31,18 @@ static void find_exe(void)
 
 int main(int argc, char* argv[])
 {
+#if !defined WIN32
+    /* Jobs for a conversion server don't need anything else started. */
+    if ((argc >= 3) && (strcmp(argv[1], "--via") == 0))
+        return submitjob(argv[2], argc - 3, argv + 3);
+
+    /* Nor does attaching to an editing session. */
+    if ((argc == 3) && (strcmp(argv[1], "--attach") == 0))
+        return attachsession(argv[2]);
+#endif
+
+    tracestartup("main");
+
 #if defined WIN32
     find_exe();
 #endif
@@ -46,15 +59,32 @@ int main(int argc, char* argv[])
 #endif
 
     script_init();
+    tracestartup("script_init");
+    allocator_init();
+    profiler_init();
+    heapreport_init();
+    workers_init();
+    server_init();
     screen_init((const char**)argv);
     word_init();
+    paragraph_init();
     utils_init();
     filesystem_init();
+    dictionary_init();
+    diff_init();
+    dumpfile_init();
     zip_init();
+    xml_init();
+    html_init();
+    importer_init();
+    export_init();
     clipboard_init();
     cmark_init();
+    tracestartup("native modules");
 
+    script_register_modules(lazy_script_table);
     script_load_from_table(script_table);
+    tracestartup("script_load_from_table");
     script_run((const char**)argv);
 
     return 0;
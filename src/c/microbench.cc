@@ -0,0 +1,403 @@
+/* © 2026 David Given.
+ * WordGrinder is licensed under the MIT open source license. See the COPYING
+ * file in this distribution for the full text.
+ */
+
+/* Micro-benchmarks for the word and string primitives, which the scripts call
+ * millions of times. Run as:
+ *
+ *     microbench [filter]
+ *
+ * to run every benchmark whose name contains the filter. Each one is run for
+ * a tenth of a second or so, five times over, and the median time per call is
+ * reported. The wg.* functions are called the way the scripts call them,
+ * through the Lua stack, so their times include that (but not making the
+ * strings, which the scripts already have); readu8(), writeu8() and the
+ * escaping functions are called directly.
+ *
+ * Every benchmark runs on three kinds of word: plain ASCII, one with a style
+ * change every couple of characters, and CJK. parseword() and
+ * getstringwidth() normally find the word in the metrics cache; the uncached
+ * benchmarks cycle through more distinct words than it holds. */
+
+#include "globals.h"
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+#include <fmt/format.h>
+
+/* Normally set up by main.cc, which isn't linked in. */
+bool enable_unicode = true;
+
+static const double RUNTIME = 0.1; /* seconds per run */
+static const int RUNS = 5;
+
+struct Input
+{
+    const char* name;
+    std::string word;
+    int middle; /* byte offset (one based) of a character half way through */
+    int next;   /* ...and of the character after it */
+};
+
+static std::vector<Input> inputs;
+
+static std::string styled(const char* text)
+{
+    /* A style change every two characters, cycling through the styles. */
+    static const int styles[] = {1, 2, 8, 0};
+    std::string s;
+    const char* p = text;
+    int n = 0;
+    while (*p)
+    {
+        int style = styles[(n / 2) % 4];
+        if ((n % 2) == 0)
+            s += (char)(16 + style);
+        const char* start = p;
+        readu8(&p);
+        s.append(start, p - start);
+        n++;
+    }
+    s += (char)16;
+    return s;
+}
+
+static void addinput(const char* name, const std::string& word)
+{
+    /* Find the first character boundary past the middle which isn't a style
+     * byte. */
+    const char* s = word.c_str();
+    const char* p = s;
+    while (((p - s) < (int)(word.size() / 2)) || (*p && (*p < 32)))
+        readu8(&p);
+    const char* q = p;
+    readu8(&q);
+
+    inputs.push_back(Input{name, word, (int)(p - s) + 1, (int)(q - s) + 1});
+}
+
+/* Repeatedly calls body(n) for n iterations, growing n until a run takes long
+ * enough to time; returns the median nanoseconds per iteration. */
+
+static double measure(const std::function<void(int)>& body)
+{
+    int n = 1;
+    for (;;)
+    {
+        auto start = std::chrono::steady_clock::now();
+        body(n);
+        double t = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start)
+                       .count();
+        if (t >= (RUNTIME / 10))
+        {
+            n = std::max<int>(n, n * (RUNTIME / t));
+            break;
+        }
+        n *= 10;
+    }
+
+    std::vector<double> times;
+    for (int i = 0; i < RUNS; i++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        body(n);
+        double t = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start)
+                       .count();
+        times.push_back(t * 1e9 / n);
+
+        /* Don't let the garbage from one run be collected in the next. */
+        lua_gc(L, LUA_GCCOLLECT, 0);
+    }
+    std::sort(times.begin(), times.end());
+    return times[RUNS / 2];
+}
+
+static const char* filter = nullptr;
+
+static void benchmark(const std::string& name,
+    const std::function<void(int)>& body)
+{
+    if (filter && !strstr(name.c_str(), filter))
+        return;
+    fmt::print("{:<36} {:10.1f} ns\n", name, measure(body));
+    fflush(stdout);
+}
+
+/* Pushes wg[name] and leaves it on the stack. */
+
+static int getfunction(const char* name)
+{
+    lua_getglobal(L, "wg");
+    lua_getfield(L, -1, name);
+    lua_remove(L, -2);
+    if (!lua_isfunction(L, -1))
+    {
+        fmt::print(stderr, "microbench: wg.{} is missing\n", name);
+        exit(1);
+    }
+    return lua_gettop(L);
+}
+
+static int nothing_cb(lua_State* L)
+{
+    return 0;
+}
+
+static void benchmarkwords(void)
+{
+    int parseword = getfunction("parseword");
+    int insertintoword = getfunction("insertintoword");
+    int deletefromword = getfunction("deletefromword");
+    int applystyletoword = getfunction("applystyletoword");
+    int getstringwidth = getfunction("getstringwidth");
+    lua_pushcfunction(L, nothing_cb);
+    int nothing = lua_gettop(L);
+
+    for (const Input& input : inputs)
+    {
+        const char* w = input.word.data();
+        size_t len = input.word.size();
+        std::string suffix = std::string("/") + input.name;
+        lua_pushlstring(L, w, len);
+        int word = lua_gettop(L);
+
+        benchmark("parseword" + suffix,
+            [&](int n)
+            {
+                for (int i = 0; i < n; i++)
+                {
+                    lua_pushvalue(L, parseword);
+                    lua_pushvalue(L, word);
+                    lua_pushnumber(L, 0);
+                    lua_pushvalue(L, nothing);
+                    lua_call(L, 3, 0);
+                }
+            });
+
+        benchmark("insertintoword" + suffix,
+            [&](int n)
+            {
+                for (int i = 0; i < n; i++)
+                {
+                    lua_pushvalue(L, insertintoword);
+                    lua_pushvalue(L, word);
+                    lua_pushliteral(L, "x");
+                    lua_pushnumber(L, input.middle);
+                    lua_pushnumber(L, 0);
+                    lua_call(L, 4, 3);
+                    lua_pop(L, 3);
+                }
+            });
+
+        benchmark("deletefromword" + suffix,
+            [&](int n)
+            {
+                for (int i = 0; i < n; i++)
+                {
+                    lua_pushvalue(L, deletefromword);
+                    lua_pushvalue(L, word);
+                    lua_pushnumber(L, input.middle);
+                    lua_pushnumber(L, input.next);
+                    lua_call(L, 3, 1);
+                    lua_pop(L, 1);
+                }
+            });
+
+        benchmark("applystyletoword" + suffix,
+            [&](int n)
+            {
+                for (int i = 0; i < n; i++)
+                {
+                    lua_pushvalue(L, applystyletoword);
+                    lua_pushvalue(L, word);
+                    lua_pushnumber(L, 8); /* bold */
+                    lua_pushnumber(L, 15);
+                    lua_pushnumber(L, 1);
+                    lua_pushnumber(L, input.middle);
+                    lua_pushnumber(L, 1);
+                    lua_call(L, 6, 2);
+                    lua_pop(L, 2);
+                }
+            });
+
+        benchmark("getstringwidth" + suffix,
+            [&](int n)
+            {
+                for (int i = 0; i < n; i++)
+                {
+                    lua_pushvalue(L, getstringwidth);
+                    lua_pushvalue(L, word);
+                    lua_call(L, 1, 1);
+                    lua_pop(L, 1);
+                }
+            });
+
+        /* Distinct words, twice as many as the cache holds, so nearly every
+         * call misses. These do have to make their strings each time. */
+        std::vector<std::string> distinct;
+        for (int i = 0; i < (1 << 18); i++)
+            distinct.push_back(input.word + std::to_string(i));
+        benchmark("getstringwidth-uncached" + suffix,
+            [&](int n)
+            {
+                for (int i = 0; i < n; i++)
+                {
+                    const std::string& s = distinct[i & ((1 << 18) - 1)];
+                    lua_pushvalue(L, getstringwidth);
+                    lua_pushlstring(L, s.data(), s.size());
+                    lua_call(L, 1, 1);
+                    lua_pop(L, 1);
+                }
+            });
+
+        lua_settop(L, nothing);
+    }
+
+    lua_settop(L, 0);
+}
+
+static void benchmarkstrings(void)
+{
+    int escape = getfunction("escape");
+    int unescape = getfunction("unescape");
+    int transcode = getfunction("transcode");
+
+    for (const Input& input : inputs)
+    {
+        const char* w = input.word.data();
+        size_t len = input.word.size();
+        std::string suffix = std::string("/") + input.name;
+        lua_pushlstring(L, w, len);
+        int word = lua_gettop(L);
+
+        benchmark("readu8" + suffix,
+            [&](int n)
+            {
+                uni_t total = 0;
+                for (int i = 0; i < n; i++)
+                {
+                    const char* p = w;
+                    const char* e = w + len;
+                    while (p < e)
+                        total += readu8(&p);
+                }
+                /* Keep the loop from being optimised away. */
+                if (total == 1)
+                    fmt::print("");
+            });
+
+        std::vector<uni_t> chars;
+        {
+            const char* p = w;
+            while (p < (w + len))
+                chars.push_back(readu8(&p));
+        }
+        benchmark("writeu8" + suffix,
+            [&](int n)
+            {
+                char buffer[256];
+                for (int i = 0; i < n; i++)
+                {
+                    char* p = buffer;
+                    for (uni_t c : chars)
+                        writeu8(&p, c);
+                    if (p == buffer)
+                        fmt::print("");
+                }
+            });
+
+        benchmark("escapestring" + suffix,
+            [&](int n)
+            {
+                std::string s;
+                for (int i = 0; i < n; i++)
+                {
+                    s.clear();
+                    escapestring(s, w, len);
+                }
+            });
+
+        std::string escaped;
+        escapestring(escaped, w, len);
+        lua_pushlstring(L, escaped.data(), escaped.size());
+        int escapedword = lua_gettop(L);
+        benchmark("unescapestring" + suffix,
+            [&](int n)
+            {
+                std::string s;
+                for (int i = 0; i < n; i++)
+                {
+                    s.clear();
+                    unescapestring(s, escaped.c_str(), escaped.size());
+                }
+            });
+
+        benchmark("escape" + suffix,
+            [&](int n)
+            {
+                for (int i = 0; i < n; i++)
+                {
+                    lua_pushvalue(L, escape);
+                    lua_pushvalue(L, word);
+                    lua_call(L, 1, 1);
+                    lua_pop(L, 1);
+                }
+            });
+
+        benchmark("unescape" + suffix,
+            [&](int n)
+            {
+                for (int i = 0; i < n; i++)
+                {
+                    lua_pushvalue(L, unescape);
+                    lua_pushvalue(L, escapedword);
+                    lua_call(L, 1, 1);
+                    lua_pop(L, 1);
+                }
+            });
+
+        benchmark("transcode" + suffix,
+            [&](int n)
+            {
+                for (int i = 0; i < n; i++)
+                {
+                    lua_pushvalue(L, transcode);
+                    lua_pushvalue(L, word);
+                    lua_call(L, 1, 1);
+                    lua_pop(L, 1);
+                }
+            });
+
+        lua_settop(L, transcode);
+    }
+
+    lua_settop(L, 0);
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc > 1)
+        filter = argv[1];
+
+    script_init();
+    allocator_init();
+    screen_init((const char**)argv);
+    word_init();
+    utils_init();
+
+    addinput("ascii", "consectetur");
+    addinput("styled", styled("consectetur"));
+    addinput("cjk", "日本語の文章を書くこと");
+
+    benchmarkwords();
+    benchmarkstrings();
+    return 0;
+}
+
+// vim: sw=4 ts=4 et
@@ -0,0 +1,1761 @@
+/* © 2024 David Given.
+ * WordGrinder is licensed under the MIT open source license. See the COPYING
+ * file in this distribution for the full text.
+ */
+
+#include "globals.h"
+#include <string.h>
+#include <ctype.h>
+#include <limits.h>
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+/* Packed paragraph storage. Ordinarily a paragraph is a Lua table holding one
+ * string per word, which for a large document is a great many GC-tracked
+ * objects. A packed paragraph instead keeps all its words in a single
+ * userdata: a count, an offset table, and the words themselves, each
+ * preceded by a space (which is exactly how they appear after the style in
+ * a v3 dumpfile line, so saving and loading are straight copies).
+ *
+ * The Lua side (PackedParagraph in paragraph.lua) wraps this in a table
+ * holding the style and the cached wrap data, and uses metamethods to make
+ * it look like an ordinary paragraph.
+ */
+
+struct PackedWords
+{
+    uint32_t count;
+    uint32_t textlen;
+    /* Followed by count+1 uint32_t offsets, each pointing at the space before
+     * a word (the last pointing at the end of the text), followed by the
+     * text. */
+};
+
+static const char PACKEDWORDS[] = "wg.packedwords";
+
+bool packparagraphs = false;
+
+static uint32_t* offsetsof(PackedWords* pw)
+{
+    return (uint32_t*)(pw + 1);
+}
+
+static const char* textof(PackedWords* pw)
+{
+    return (const char*)(offsetsof(pw) + pw->count + 1);
+}
+
+static PackedWords* newpackedwords(lua_State* L, uint32_t count, size_t len)
+{
+    PackedWords* pw = (PackedWords*)lua_newuserdata(L,
+        sizeof(PackedWords) + sizeof(uint32_t) * (count + 1) + len);
+    pw->count = count;
+    pw->textlen = len;
+    luaL_getmetatable(L, PACKEDWORDS);
+    lua_setmetatable(L, -2);
+    return pw;
+}
+
+static PackedWords* checkpackedwords(lua_State* L, int index)
+{
+    return (PackedWords*)luaL_checkudata(L, index, PACKEDWORDS);
+}
+
+/* Pushes a PackedWords made from text of the form " word word word". */
+
+void pushpackedwords(lua_State* L, const char* text, size_t len)
+{
+    uint32_t count = std::count(text, text + len, ' ');
+    PackedWords* pw = newpackedwords(L, count, len);
+
+    uint32_t* offsets = offsetsof(pw);
+    uint32_t wn = 0;
+    for (size_t i = 0; i < len; i++)
+        if (text[i] == ' ')
+            offsets[wn++] = i;
+    offsets[count] = len;
+    memcpy((char*)textof(pw), text, len);
+}
+
+/* If the value at the given index is a packed paragraph, returns its
+ * PackedWords; otherwise returns nullptr. */
+
+static PackedWords* topackedwords(lua_State* L, int index)
+{
+    if (!lua_istable(L, index))
+        return nullptr;
+
+    index = lua_absindex(L, index);
+    luaL_checkstack(L, 3, "out of memory");
+    lua_pushstring(L, "_words");
+    lua_rawget(L, index);
+    PackedWords* pw = (PackedWords*)lua_touserdata(L, -1);
+    if (pw && lua_getmetatable(L, -1))
+    {
+        luaL_getmetatable(L, PACKEDWORDS);
+        if (!lua_rawequal(L, -1, -2))
+            pw = nullptr;
+        lua_pop(L, 2);
+    }
+    else
+        pw = nullptr;
+    lua_pop(L, 1);
+    return pw;
+}
+
+/* If the value at the given index is a packed paragraph, returns its words in
+ * " word word word" form; otherwise returns nullptr. */
+
+const char* getpackedwords(lua_State* L, int index, size_t* len)
+{
+    PackedWords* pw = topackedwords(L, index);
+    if (!pw)
+        return nullptr;
+
+    *len = pw->textlen;
+    return textof(pw);
+}
+
+static int packwords_cb(lua_State* L)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+    int count = lua_objlen(L, 1);
+
+    size_t len = 0;
+    for (int i = 1; i <= count; i++)
+    {
+        lua_rawgeti(L, 1, i);
+        size_t wlen;
+        luaL_checklstring(L, -1, &wlen);
+        len += wlen + 1;
+        lua_pop(L, 1);
+    }
+
+    PackedWords* pw = newpackedwords(L, count, len);
+    uint32_t* offsets = offsetsof(pw);
+    char* p = (char*)textof(pw);
+    for (int i = 1; i <= count; i++)
+    {
+        lua_rawgeti(L, 1, i);
+        size_t wlen;
+        const char* w = lua_tolstring(L, -1, &wlen);
+        offsets[i - 1] = p - textof(pw);
+        *p++ = ' ';
+        memcpy(p, w, wlen);
+        p += wlen;
+        lua_pop(L, 1);
+    }
+    offsets[count] = len;
+    return 1;
+}
+
+static int getpackedword_cb(lua_State* L)
+{
+    PackedWords* pw = checkpackedwords(L, 1);
+    int wn = forceinteger(L, 2);
+    if ((wn < 1) || ((uint32_t)wn > pw->count))
+        return 0;
+
+    uint32_t* offsets = offsetsof(pw);
+    uint32_t start = offsets[wn - 1] + 1;
+    lua_pushlstring(L, textof(pw) + start, offsets[wn] - start);
+    return 1;
+}
+
+static int packedwords_len_cb(lua_State* L)
+{
+    lua_pushnumber(L, checkpackedwords(L, 1)->count);
+    return 1;
+}
+
+/* Returns the words separated by spaces, as table.concat(words, " ") would. */
+
+static int packedwords_join_cb(lua_State* L)
+{
+    PackedWords* pw = checkpackedwords(L, 1);
+    if (pw->textlen == 0)
+        lua_pushstring(L, "");
+    else
+        lua_pushlstring(L, textof(pw) + 1, pw->textlen - 1);
+    return 1;
+}
+
+/* Calls cb with each word of the (packed or ordinary) paragraph at the given
+ * index, starting at word start. For ordinary paragraphs the word is on the
+ * top of the stack during the call; either way the text stays alive as long
+ * as the paragraph does. If cb returns a bool, returning false stops early.
+ * This is the only thing which walks both kinds of paragraph; everything
+ * else (outside this file, through foreachparagraphword()) uses it. */
+
+template <typename F>
+static void foreachword(lua_State* L, int index, F cb, int start = 1)
+{
+    index = lua_absindex(L, index);
+    auto call = [&](std::string_view w)
+    {
+        if constexpr (std::is_same_v<decltype(cb(w)), bool>)
+            return cb(w);
+        else
+        {
+            cb(w);
+            return true;
+        }
+    };
+
+    size_t len;
+    const char* packed = getpackedwords(L, index, &len);
+    if (packed)
+    {
+        const char* e = packed + len;
+        int wn = 1;
+        while (packed != e)
+        {
+            const char* s = packed + 1;
+            const char* se = (const char*)memchr(s, ' ', e - s);
+            if (!se)
+                se = e;
+            if ((wn++ >= start) && !call(std::string_view(s, se - s)))
+                break;
+            packed = se;
+        }
+    }
+    else
+    {
+        luaL_checkstack(L, 1, "out of memory");
+        int count = lua_objlen(L, index);
+        for (int wn = start; wn <= count; wn++)
+        {
+            lua_rawgeti(L, index, wn);
+            const char* w = luaL_checklstring(L, -1, &len);
+            bool more = call(std::string_view(w, len));
+            lua_pop(L, 1);
+            if (!more)
+                break;
+        }
+    }
+}
+
+void foreachparagraphword(lua_State* L, int index,
+    const std::function<void(const char*, size_t)>& cb)
+{
+    foreachword(L,
+        index,
+        [&](std::string_view w)
+        {
+            cb(w.data(), w.size());
+        });
+}
+
+/* Measures how much repetition there is among the words of a document.
+ * Returns the number of words, the number of distinct words, and the bytes
+ * used by each. (Luau interns every string, so for ordinary paragraphs the
+ * distinct figures are what is actually stored; packed paragraphs store
+ * every occurrence.) */
+
+static int wordstats_cb(lua_State* L)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+    luaL_checkstack(L, 4, "out of memory");
+
+    std::unordered_set<std::string_view> seen;
+    size_t words = 0;
+    size_t bytes = 0;
+    size_t distinctbytes = 0;
+    auto add = [&](std::string_view w)
+    {
+        words++;
+        bytes += w.size();
+        if (seen.insert(w).second)
+            distinctbytes += w.size();
+    };
+
+    for (int pn = 1;; pn++)
+    {
+        lua_rawgeti(L, 1, pn);
+        if (lua_isnil(L, -1))
+        {
+            lua_pop(L, 1);
+            break;
+        }
+
+        foreachword(L, -1, add);
+        lua_pop(L, 1);
+    }
+
+    lua_pushnumber(L, words);
+    lua_pushnumber(L, seen.size());
+    lua_pushnumber(L, bytes);
+    lua_pushnumber(L, distinctbytes);
+    return 4;
+}
+
+/* Does a word end a sentence? That is, is the last thing in it (ignoring
+ * style bytes, closing brackets and closing quotes) a full stop, question
+ * mark, exclamation mark or ellipsis. */
+
+static bool endssentence(std::string_view w)
+{
+    static const std::string_view closers[] = {
+        "’", /* right single quote */
+        "”", /* right double quote */
+        "»", /* right guillemet */
+    };
+
+    size_t e = w.size();
+    while (e > 0)
+    {
+        uint8_t c = w[e - 1];
+        if ((c < 32) || (c == 127) || strchr("\"')]}", c))
+        {
+            e--;
+            continue;
+        }
+
+        bool closer = false;
+        for (std::string_view q : closers)
+            if ((e >= q.size()) && (w.substr(e - q.size(), q.size()) == q))
+            {
+                e -= q.size();
+                closer = true;
+                break;
+            }
+        if (!closer)
+            break;
+    }
+
+    if (e == 0)
+        return false;
+    char c = w[e - 1];
+    if ((c == '.') || (c == '!') || (c == '?'))
+        return true;
+    return (e >= 3) && (w.substr(e - 3, 3) == "…");
+}
+
+/* Counts what's in a paragraph for the document statistics: returns the
+ * number of words (not counting empty ones, which is what an empty paragraph
+ * holds), the number of characters in them (not counting style bytes or the
+ * spaces between words) and the number of sentences, where a paragraph
+ * which doesn't end with a full stop still counts as one. */
+
+static int paragraphstats_cb(lua_State* L)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+
+    size_t words = 0;
+    size_t characters = 0;
+    size_t sentences = 0;
+    bool open = false;
+    foreachword(L, 1,
+        [&](std::string_view w)
+        {
+            size_t n = 0;
+            for (uint8_t c : w)
+                if ((c >= 32) && (c != 127) && ((c & 0xc0) != 0x80))
+                    n++;
+            if (n == 0)
+                return;
+            words++;
+            characters += n;
+
+            if (endssentence(w))
+            {
+                sentences++;
+                open = false;
+            }
+            else
+                open = true;
+        });
+    if (open)
+        sentences++;
+
+    lua_pushnumber(L, words);
+    lua_pushnumber(L, characters);
+    lua_pushnumber(L, sentences);
+    return 3;
+}
+
+/* Content hashes: MurmurHash64A, which is quick and spreads its bits well,
+ * though it's not meant to resist anyone trying to make collisions. Hashes
+ * are passed around as 16 hex digits, as a Lua number can't hold 64 bits. */
+
+static uint64_t hash64(const char* s, size_t len, uint64_t seed)
+{
+    const uint64_t m = 0xc6a4a7935bd1e995ULL;
+    const int r = 47;
+    uint64_t h = seed ^ (len * m);
+
+    const char* end = s + (len & ~7);
+    for (; s != end; s += 8)
+    {
+        uint64_t k;
+        memcpy(&k, s, 8);
+        k *= m;
+        k ^= k >> r;
+        k *= m;
+        h ^= k;
+        h *= m;
+    }
+
+    uint64_t k = 0;
+    switch (len & 7)
+    {
+        case 7:
+            k |= (uint64_t)(uint8_t)s[6] << 48;
+            [[fallthrough]];
+        case 6:
+            k |= (uint64_t)(uint8_t)s[5] << 40;
+            [[fallthrough]];
+        case 5:
+            k |= (uint64_t)(uint8_t)s[4] << 32;
+            [[fallthrough]];
+        case 4:
+            k |= (uint64_t)(uint8_t)s[3] << 24;
+            [[fallthrough]];
+        case 3:
+            k |= (uint64_t)(uint8_t)s[2] << 16;
+            [[fallthrough]];
+        case 2:
+            k |= (uint64_t)(uint8_t)s[1] << 8;
+            [[fallthrough]];
+        case 1:
+            k |= (uint64_t)(uint8_t)s[0];
+            h ^= k;
+            h *= m;
+    }
+
+    h ^= h >> r;
+    h *= m;
+    h ^= h >> r;
+    return h;
+}
+
+static void pushhash(lua_State* L, uint64_t h)
+{
+    static const char digits[] = "0123456789abcdef";
+    char buffer[16];
+    for (int i = 15; i >= 0; i--)
+    {
+        buffer[i] = digits[h & 15];
+        h >>= 4;
+    }
+    lua_pushlstring(L, buffer, sizeof(buffer));
+}
+
+/* Returns the hash of a paragraph's style and words. */
+
+static int paragraphhash_cb(lua_State* L)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+
+    lua_getfield(L, 1, "style");
+    size_t len;
+    const char* style = luaL_checklstring(L, -1, &len);
+    uint64_t h = hash64(style, len, 0);
+    lua_pop(L, 1);
+
+    foreachword(L, 1,
+        [&](std::string_view w)
+        {
+            h = hash64(w.data(), w.size(), h);
+        });
+
+    pushhash(L, h);
+    return 1;
+}
+
+/* Returns the hash of the hashes in t[first] to t[last], in order. */
+
+static int combinehashes_cb(lua_State* L)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+    int first = luaL_checkinteger(L, 2);
+    int last = luaL_checkinteger(L, 3);
+
+    uint64_t h = hash64(nullptr, 0, 0);
+    for (int i = first; i <= last; i++)
+    {
+        lua_rawgeti(L, 1, i);
+        size_t len;
+        const char* s = luaL_checklstring(L, -1, &len);
+        h = hash64(s, len, h);
+        lua_pop(L, 1);
+    }
+
+    pushhash(L, h);
+    return 1;
+}
+
+/* Returns a copy of a paragraph with count words starting at first replaced
+ * by the remaining arguments. This is what every keystroke does, so it's
+ * done here in a single pass rather than by slicing and reassembling word
+ * arrays in Lua. The copy has the same style and metatable as the original
+ * and nothing else (in particular, no wrap data). */
+
+static int replacewords_cb(lua_State* L)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+    int first = forceinteger(L, 2);
+    int count = forceinteger(L, 3);
+    luaL_argcheck(L, count >= 0, 3, "out of range");
+    int nargs = lua_gettop(L);
+    int nwords = nargs - 3;
+    for (int i = 4; i <= nargs; i++)
+        luaL_checkstring(L, i);
+    luaL_checkstack(L, 4, "out of memory");
+
+    size_t len;
+    const char* packed = getpackedwords(L, 1, &len);
+    if (packed)
+    {
+        lua_pushstring(L, "_words");
+        lua_rawget(L, 1);
+        PackedWords* pw = checkpackedwords(L, -1);
+        lua_pop(L, 1);
+        int n = pw->count;
+        luaL_argcheck(L, (first >= 1) && (first <= n + 1), 2, "out of range");
+        int last = std::min(first + count - 1, n);
+
+        uint32_t* offsets = offsetsof(pw);
+        std::string text(packed, offsets[first - 1]);
+        for (int i = 4; i <= nargs; i++)
+        {
+            size_t wlen;
+            const char* w = lua_tolstring(L, i, &wlen);
+            text += ' ';
+            text.append(w, wlen);
+        }
+        text.append(packed + offsets[last], len - offsets[last]);
+
+        lua_createtable(L, 0, 2);
+        pushpackedwords(L, text.data(), text.size());
+        lua_setfield(L, -2, "_words");
+    }
+    else
+    {
+        int n = lua_objlen(L, 1);
+        luaL_argcheck(L, (first >= 1) && (first <= n + 1), 2, "out of range");
+        int last = std::min(first + count - 1, n);
+
+        lua_createtable(L, n - (last - first + 1) + nwords, 2);
+        int wn = 1;
+        for (int i = 1; i < first; i++)
+        {
+            lua_rawgeti(L, 1, i);
+            lua_rawseti(L, -2, wn++);
+        }
+        for (int i = 4; i <= nargs; i++)
+        {
+            lua_pushvalue(L, i);
+            lua_rawseti(L, -2, wn++);
+        }
+        for (int i = last + 1; i <= n; i++)
+        {
+            lua_rawgeti(L, 1, i);
+            lua_rawseti(L, -2, wn++);
+        }
+    }
+
+    lua_getfield(L, 1, "style");
+    lua_setfield(L, -2, "style");
+    if (lua_getmetatable(L, 1))
+        lua_setmetatable(L, -2);
+    return 1;
+}
+
+/* Makes a new paragraph of the given style from the remaining arguments,
+ * which are strings, arrays of words, paragraphs, or slices of paragraphs (a
+ * table whose _of field is the paragraph, with the range in _first and
+ * _count; see Paragraph.slice()). Everything is measured first, so that the
+ * result is allocated once at the right size and then filled straight from
+ * the sources. As with ipairs(), a nil ends the arguments. The result is a
+ * PackedParagraph if packparagraphs is set and a Paragraph otherwise.
+ *
+ * If hashed is set, the paragraph's hash (as paragraphhash would return it)
+ * is worked out during the copy and pushed after it. */
+
+struct WordRun
+{
+    int index;       /* the source's stack slot */
+    PackedWords* pw; /* if the source is packed */
+    int first;
+    int count;
+    bool single;     /* the source is a single word */
+};
+
+static int createparagraph(lua_State* L, bool hashed)
+{
+    size_t stylelen;
+    const char* style = luaL_checklstring(L, 1, &stylelen);
+    uint64_t h = hash64(style, stylelen, 0);
+    auto hashword = [&](const char* w, size_t wlen)
+    {
+        if (hashed)
+            h = hash64(w, wlen, h);
+    };
+    int nargs = lua_gettop(L);
+
+    std::vector<WordRun> runs;
+    int total = 0;
+    for (int i = 2; i <= nargs; i++)
+    {
+        int type = lua_type(L, i);
+        if (type == LUA_TNIL)
+            break;
+        if (type == LUA_TSTRING)
+        {
+            runs.push_back({i, nullptr, 1, 1, true});
+            total++;
+            continue;
+        }
+        if (type != LUA_TTABLE)
+            continue;
+
+        luaL_checkstack(L, 2, "out of memory");
+        int src = i;
+        int first = 1;
+        int count = INT_MAX;
+        lua_pushstring(L, "_of");
+        lua_rawget(L, i);
+        if (lua_istable(L, -1))
+        {
+            src = lua_gettop(L);
+            lua_getfield(L, i, "_first");
+            first = forceinteger(L, -1);
+            lua_getfield(L, i, "_count");
+            count = forceinteger(L, -1);
+            lua_pop(L, 2);
+        }
+        else
+            lua_pop(L, 1);
+
+        PackedWords* pw = topackedwords(L, src);
+        int n = pw ? pw->count : lua_objlen(L, src);
+        first = std::max(first, 1);
+        count = std::min(count, n - first + 1);
+        if (count > 0)
+        {
+            runs.push_back({src, pw, first, count, false});
+            total += count;
+        }
+    }
+
+    luaL_checkstack(L, 4, "out of memory");
+    if (!packparagraphs)
+    {
+        lua_createtable(L, total, 1);
+        int wn = 1;
+        for (auto& run : runs)
+        {
+            if (run.single)
+            {
+                size_t wlen;
+                const char* w = lua_tolstring(L, run.index, &wlen);
+                hashword(w, wlen);
+                lua_pushvalue(L, run.index);
+                lua_rawseti(L, -2, wn++);
+            }
+            else if (run.pw)
+            {
+                uint32_t* offsets = offsetsof(run.pw);
+                for (int j = run.first; j < run.first + run.count; j++)
+                {
+                    uint32_t start = offsets[j - 1] + 1;
+                    const char* w = textof(run.pw) + start;
+                    hashword(w, offsets[j] - start);
+                    lua_pushlstring(L, w, offsets[j] - start);
+                    lua_rawseti(L, -2, wn++);
+                }
+            }
+            else
+                for (int j = run.first; j < run.first + run.count; j++)
+                {
+                    lua_rawgeti(L, run.index, j);
+                    if (hashed)
+                    {
+                        size_t wlen;
+                        const char* w = lua_tolstring(L, -1, &wlen);
+                        if (!w)
+                            luaL_error(L, "paragraph words must be strings");
+                        hashword(w, wlen);
+                    }
+                    lua_rawseti(L, -2, wn++);
+                }
+        }
+        lua_pushvalue(L, 1);
+        lua_setfield(L, -2, "style");
+        lua_getglobal(L, "Paragraph");
+        lua_setmetatable(L, -2);
+        if (!hashed)
+            return 1;
+        pushhash(L, h);
+        return 2;
+    }
+
+    size_t len = 0;
+    for (auto& run : runs)
+    {
+        if (run.single)
+            len += lua_objlen(L, run.index) + 1;
+        else if (run.pw)
+        {
+            uint32_t* offsets = offsetsof(run.pw);
+            len += offsets[run.first + run.count - 1] - offsets[run.first - 1];
+        }
+        else
+            for (int j = run.first; j < run.first + run.count; j++)
+            {
+                lua_rawgeti(L, run.index, j);
+                size_t wlen;
+                if (!lua_tolstring(L, -1, &wlen))
+                    luaL_error(L, "paragraph words must be strings");
+                len += wlen + 1;
+                lua_pop(L, 1);
+            }
+    }
+
+    lua_createtable(L, 0, 2);
+    lua_pushvalue(L, 1);
+    lua_setfield(L, -2, "style");
+    PackedWords* pw = newpackedwords(L, total, len);
+    uint32_t* offsets = offsetsof(pw);
+    char* base = (char*)textof(pw);
+    char* p = base;
+    int wn = 0;
+    auto append = [&](const char* w, size_t wlen)
+    {
+        hashword(w, wlen);
+        offsets[wn++] = p - base;
+        *p++ = ' ';
+        memcpy(p, w, wlen);
+        p += wlen;
+    };
+    for (auto& run : runs)
+    {
+        if (run.single)
+        {
+            size_t wlen;
+            const char* w = lua_tolstring(L, run.index, &wlen);
+            append(w, wlen);
+        }
+        else if (run.pw)
+        {
+            /* The words are already in the right form, so they can be
+             * copied in one go. */
+            uint32_t* srcoffsets = offsetsof(run.pw);
+            uint32_t start = srcoffsets[run.first - 1];
+            uint32_t end = srcoffsets[run.first + run.count - 1];
+            for (int j = run.first; j < run.first + run.count; j++)
+            {
+                offsets[wn++] = (p - base) + (srcoffsets[j - 1] - start);
+                uint32_t ws = srcoffsets[j - 1] + 1;
+                hashword(textof(run.pw) + ws, srcoffsets[j] - ws);
+            }
+            memcpy(p, textof(run.pw) + start, end - start);
+            p += end - start;
+        }
+        else
+            for (int j = run.first; j < run.first + run.count; j++)
+            {
+                lua_rawgeti(L, run.index, j);
+                size_t wlen;
+                const char* w = lua_tolstring(L, -1, &wlen);
+                append(w, wlen);
+                lua_pop(L, 1);
+            }
+    }
+    offsets[total] = len;
+    lua_setfield(L, -2, "_words");
+    lua_getglobal(L, "PackedParagraph");
+    lua_setmetatable(L, -2);
+    if (!hashed)
+        return 1;
+    pushhash(L, h);
+    return 2;
+}
+
+static int createparagraph_cb(lua_State* L)
+{
+    return createparagraph(L, false);
+}
+
+static int createhashedparagraph_cb(lua_State* L)
+{
+    return createparagraph(L, true);
+}
+
+/* Breaks a paragraph's words into lines of the given width, the first line
+ * being indented by indent1 and the rest by indent2. Calls cb(word, x,
+ * newline) for each word, where x is its offset within its line and newline
+ * is set if it doesn't fit on the line so far. (The first word can do that,
+ * leaving the first line empty.) If cb returns false, it stops there.
+ *
+ * Breaking can start at the beginning of any line other than the first, given
+ * the word which starts it and the number of lines before it, as the
+ * breaks only ever depend on the words before them. */
+
+template <typename F>
+static void breaklines(lua_State* L, int index, int width, int indent1,
+    int indent2, bool fullstopspaces, F cb, int startwn = 1, int startline = 1)
+{
+    int nlines = startline - 1;
+    int x = 0;
+    bool linestart = nlines > 0; /* the first word is already on a new line */
+    width -= linestart ? indent2 : indent1;
+    foreachword(
+        L,
+        index,
+        [&](std::string_view word)
+        {
+            /* The width includes the following space, and an extra one after
+             * full stops if the user asked for it. */
+            char last = word.empty() ? 'a' : word.back();
+            int ww = getwordmetrics(word.data(), word.size()).width + 1;
+            if (fullstopspaces && (last == '.'))
+                ww++;
+
+            int wx = x;
+            x += ww;
+            bool newline = false;
+            if (linestart)
+                linestart = false;
+            else if (x >= width)
+            {
+                if (++nlines == 1)
+                    width += indent1 - indent2;
+                newline = true;
+                x = ww;
+                wx = 0;
+            }
+            return cb(word, wx, newline);
+        },
+        startwn);
+}
+
+/* Wraps a paragraph into lines (see breaklines()). Returns the lines (each
+ * an array of word numbers, with the first in wn), the x offset of each
+ * word within its line, and the set of words which start sentences.
+ * Rewrapping happens for the entire document whenever the window changes
+ * size, so this is done here rather than in Lua.
+ *
+ * Giant paragraphs (from importing text with no line breaks, say) get
+ * edited a word at a time like any other, so the old layout can be passed
+ * in too (its lines, xs and sentences) along with which words were changed
+ * (removed words starting at first were replaced by inserted new ones).
+ * Then the result starts off as a copy of the old layout, and breaking starts
+ * at the line before the change; as soon as a line after the change starts
+ * at the same word as an old one did, the rest of the old layout is kept
+ * (moved along if the number of words or lines has changed). */
+
+static int getlinewn(lua_State* L, int lines, int ln)
+{
+    lua_rawgeti(L, lines, ln);
+    lua_getfield(L, -1, "wn");
+    int wn = lua_tointeger(L, -1);
+    lua_pop(L, 2);
+    return wn;
+}
+
+/* Pushes a shallow copy of a table, which table.clone() does much faster
+ * than copying it an element at a time. */
+
+static void clonetable(lua_State* L, int index)
+{
+    index = lua_absindex(L, index);
+    lua_getglobal(L, "table");
+    lua_getfield(L, -1, "clone");
+    lua_remove(L, -2);
+    lua_pushvalue(L, index);
+    lua_call(L, 1, 1);
+}
+
+/* Clears elements newlen+1 to oldlen of a table. */
+
+static void cleartail(lua_State* L, int index, int newlen, int oldlen)
+{
+    for (int i = newlen + 1; i <= oldlen; i++)
+    {
+        lua_pushnil(L);
+        lua_rawseti(L, index, i);
+    }
+}
+
+/* Copies elements first to last of src to dest, starting at to, and then
+ * clears anything in dest after newlen up to oldlen. */
+
+static void movetail(lua_State* L, int src, int first, int last, int dest,
+    int to, int newlen, int oldlen)
+{
+    if (to != first)
+        for (int i = first; i <= last; i++)
+        {
+            lua_rawgeti(L, src, i);
+            lua_rawseti(L, dest, i - first + to);
+        }
+    cleartail(L, dest, newlen, oldlen);
+}
+
+static int wrapparagraph_cb(lua_State* L)
+{
+    TraceSpan span("Paragraph.wrap");
+    luaL_checktype(L, 1, LUA_TTABLE);
+    int width = forceinteger(L, 2);
+    int indent1 = forceinteger(L, 3);
+    int indent2 = forceinteger(L, 4);
+    bool fullstopspaces = lua_toboolean(L, 5);
+    bool incremental = !lua_isnoneornil(L, 6);
+    int first = 0;
+    int removed = 0;
+    int inserted = 0;
+    if (incremental)
+    {
+        luaL_checktype(L, 6, LUA_TTABLE);
+        luaL_checktype(L, 7, LUA_TTABLE);
+        luaL_checktype(L, 8, LUA_TTABLE);
+        first = forceinteger(L, 9);
+        removed = forceinteger(L, 10);
+        inserted = forceinteger(L, 11);
+    }
+    lua_settop(L, 11);
+    luaL_checkstack(L, 8, "out of memory");
+    const int OLDLINES = 6;
+    const int OLDXS = 7;
+    const int OLDSENTENCES = 8;
+    const int LINES = 12;
+    const int XS = 13;
+    const int SENTENCES = 14;
+    const int LINE = 15; /* the line being built */
+
+    int nlines = 0;
+    int wn = 0;
+    bool issentence = true;
+    int oldnlines = 0;
+    int oldwords = 0;
+    int ol = 0; /* the old line which the next new one might match */
+    int delta = inserted - removed;
+    if (incremental)
+    {
+        oldnlines = lua_objlen(L, OLDLINES);
+        oldwords = lua_objlen(L, OLDXS);
+
+        /* Find the last line starting at or before the first change. Making
+         * the first word of that line shorter might let it fit on the line
+         * before, so start there. */
+        int lo = 1;
+        int hi = oldnlines;
+        while (lo < hi)
+        {
+            int mid = (lo + hi + 1) / 2;
+            if (getlinewn(L, OLDLINES, mid) <= first)
+                lo = mid;
+            else
+                hi = mid - 1;
+        }
+        int startline = lo - 1;
+        if (startline < 2)
+            incremental = false;
+        else
+        {
+            int startwn = getlinewn(L, OLDLINES, startline);
+            lua_rawgeti(L, OLDSENTENCES, startwn);
+            issentence = !lua_isnil(L, -1);
+            lua_pop(L, 1);
+
+            nlines = startline - 1;
+            wn = startwn - 1;
+            ol = startline + 1;
+        }
+    }
+
+    if (incremental)
+    {
+        clonetable(L, OLDLINES);
+        clonetable(L, OLDXS);
+        clonetable(L, OLDSENTENCES);
+    }
+    else
+    {
+        oldnlines = oldwords = 0;
+        lua_createtable(L, 0, 0);
+        lua_createtable(L, lua_objlen(L, 1), 0);
+        lua_createtable(L, 0, 0);
+    }
+    lua_createtable(L, 0, 1);
+    lua_pushnumber(L, wn + 1);
+    lua_setfield(L, LINE, "wn");
+
+    /* Keeps the old layout from old line ol, whose first word is now wn. */
+    auto useoldlayout = [&]()
+    {
+        int ow = wn - delta;
+        int newnlines = nlines + oldnlines - ol + 1;
+        if (delta == 0)
+            movetail(L, OLDLINES, ol, oldnlines, LINES, nlines + 1,
+                newnlines, oldnlines);
+        else
+        {
+            for (int ln = ol; ln <= oldnlines; ln++)
+            {
+                lua_rawgeti(L, OLDLINES, ln);
+                int n = lua_objlen(L, -1);
+                lua_createtable(L, n, 1);
+                for (int i = 1; i <= n; i++)
+                {
+                    lua_rawgeti(L, -2, i);
+                    lua_pushnumber(L, lua_tointeger(L, -1) + delta);
+                    lua_rawseti(L, -3, i);
+                    lua_pop(L, 1);
+                }
+                lua_getfield(L, -2, "wn");
+                lua_pushnumber(L, lua_tointeger(L, -1) + delta);
+                lua_setfield(L, -3, "wn");
+                lua_pop(L, 1);
+                lua_remove(L, -2);
+                lua_rawseti(L, LINES, ln - ol + nlines + 1);
+            }
+            cleartail(L, LINES, newnlines, oldnlines);
+        }
+
+        int newwords = oldwords + delta;
+        movetail(L, OLDXS, ow, oldwords, XS, wn, newwords, oldwords);
+        movetail(L, OLDSENTENCES, ow, oldwords, SENTENCES, wn, newwords,
+            oldwords);
+    };
+
+    int nwords = 0;
+    bool converged = false;
+    breaklines(
+        L,
+        1,
+        width,
+        indent1,
+        indent2,
+        fullstopspaces,
+        [&](std::string_view word, int wx, bool newline)
+        {
+            wn++;
+            bool wassentence = issentence;
+            if (issentence)
+            {
+                lua_pushboolean(L, true);
+                lua_rawseti(L, SENTENCES, wn);
+                issentence = false;
+            }
+            else if (incremental)
+            {
+                lua_pushnil(L);
+                lua_rawseti(L, SENTENCES, wn);
+            }
+
+            char last = word.empty() ? 'a' : word.back();
+            if (!isalpha((unsigned char)last))
+                issentence = true;
+
+            if (newline)
+            {
+                lua_pushvalue(L, LINE);
+                lua_rawseti(L, LINES, ++nlines);
+
+                if (incremental && (wn >= (first + inserted)))
+                {
+                    int ow = wn - delta;
+                    while ((ol <= oldnlines) &&
+                           (getlinewn(L, OLDLINES, ol) < ow))
+                        ol++;
+                    if ((ol <= oldnlines) &&
+                        (getlinewn(L, OLDLINES, ol) == ow))
+                    {
+                        lua_rawgeti(L, OLDSENTENCES, ow);
+                        bool oldsentence = !lua_isnil(L, -1);
+                        lua_pop(L, 1);
+                        if (oldsentence == wassentence)
+                        {
+                            useoldlayout();
+                            converged = true;
+                            return false;
+                        }
+                    }
+                }
+
+                lua_createtable(L, 8, 1);
+                lua_pushnumber(L, wn);
+                lua_setfield(L, -2, "wn");
+                lua_replace(L, LINE);
+                nwords = 0;
+            }
+
+            lua_pushnumber(L, wx);
+            lua_rawseti(L, XS, wn);
+            lua_pushnumber(L, wn);
+            lua_rawseti(L, LINE, ++nwords);
+            return true;
+        },
+        wn + 1,
+        nlines + 1);
+
+    if (!converged)
+    {
+        if (nwords > 0)
+            lua_rawseti(L, LINES, ++nlines);
+        else
+            lua_pop(L, 1);
+
+        lua_pushboolean(L, true);
+        lua_rawseti(L, SENTENCES, wn);
+
+        /* Anything left over from the old layout is past the end. */
+        cleartail(L, LINES, nlines, oldnlines);
+        cleartail(L, XS, wn, oldwords);
+        cleartail(L, SENTENCES, wn, oldwords);
+    }
+    lua_settop(L, SENTENCES);
+    return 3;
+}
+
+/* Returns the number of lines wrapparagraph() would wrap a paragraph into,
+ * without making them. */
+
+static int countlines_cb(lua_State* L)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+    int width = forceinteger(L, 2);
+    int indent1 = forceinteger(L, 3);
+    int indent2 = forceinteger(L, 4);
+    bool fullstopspaces = lua_toboolean(L, 5);
+
+    int nlines = 0;
+    bool any = false;
+    breaklines(L, 1, width, indent1, indent2, fullstopspaces,
+        [&](std::string_view, int, bool newline)
+        {
+            if (newline)
+                nlines++;
+            any = true;
+        });
+
+    lua_pushnumber(L, nlines + (any ? 1 : 0));
+    return 1;
+}
+
+/* Searching. Each paragraph is searched as a single folded string: its words
+ * joined by single spaces, with style bytes removed, ASCII letters in lower
+ * case and smart quotes turned back into plain ones, so the search itself is
+ * a straight substring match. As paragraphs are immutable the folded text is
+ * cached (in a weak table keyed by paragraph) and is only built once for
+ * each; a match is mapped back to words and byte offsets by refolding only
+ * the words it touches. */
+
+static const char FINDCACHE[] = "wg.findcache";
+
+/* Left and right single, then left and right double. */
+static std::string findquotes[4];
+
+/* Calls cb(folded, position, length) for each character of a word which
+ * appears in its folded form, where position and length are the bytes of
+ * the word it came from. */
+
+template <typename F>
+static void foldword(std::string_view word, F cb)
+{
+    size_t i = 0;
+    while (i < word.size())
+    {
+        uint8_t c = word[i];
+        if ((c < 32) || (c == 127))
+        {
+            i++;
+            continue;
+        }
+
+        int q = 0;
+        while ((q < 4) &&
+               (findquotes[q].empty() || ((uint8_t)findquotes[q][0] != c) ||
+                   (word.compare(i, findquotes[q].size(), findquotes[q]) != 0)))
+            q++;
+        if (q < 4)
+        {
+            cb((q < 2) ? '\'' : '"', i, findquotes[q].size());
+            i += findquotes[q].size();
+            continue;
+        }
+
+        if ((c >= 'A') && (c <= 'Z'))
+            c += 'a' - 'A';
+        cb((char)c, i, 1);
+        i++;
+    }
+}
+
+/* Returns the byte offset (1-based) in the word in which folded byte k
+ * starts; or, if end is set, the offset just after the one in which folded
+ * byte k-1 ends. */
+
+static int unfoldoffset(std::string_view word, size_t k, bool end)
+{
+    int result = (end && (k == 0)) ? 1 : (int)word.size() + 1;
+    size_t n = 0;
+    bool done = end && (k == 0);
+    foldword(word,
+        [&](char, size_t i, size_t len)
+        {
+            if (done)
+                return;
+            if (!end && (n == k))
+            {
+                result = i + 1;
+                done = true;
+            }
+            n++;
+            if (end && (n == k))
+            {
+                result = i + len + 1;
+                done = true;
+            }
+        });
+    return result;
+}
+
+/* Returns the number of folded bytes produced by the first co-1 bytes of a
+ * word. */
+
+static size_t foldedlength(std::string_view word, int co)
+{
+    size_t n = 0;
+    foldword(word,
+        [&](char, size_t i, size_t)
+        {
+            if ((int)i < (co - 1))
+                n++;
+        });
+    return n;
+}
+
+/* Pushes the folded text of the paragraph at the given index. */
+
+static void pushfolded(lua_State* L, int cache, int index)
+{
+    index = lua_absindex(L, index);
+    lua_pushvalue(L, index);
+    lua_rawget(L, cache);
+    if (lua_isstring(L, -1))
+        return;
+    lua_pop(L, 1);
+
+    std::string folded;
+    bool first = true;
+    foreachword(L, index,
+        [&](std::string_view word)
+        {
+            if (!first)
+                folded += ' ';
+            first = false;
+            foldword(word,
+                [&](char c, size_t, size_t)
+                {
+                    folded += c;
+                });
+        });
+
+    lua_pushlstring(L, folded.data(), folded.size());
+    lua_pushvalue(L, index);
+    lua_pushvalue(L, -2);
+    lua_rawset(L, cache);
+}
+
+/* Maps an offset into a paragraph's folded text back to a word number and
+ * a byte offset within that word. */
+
+static void unfold(lua_State* L, int paragraph, std::string_view folded,
+    size_t offset, bool end, int* wn, int* wo)
+{
+    size_t start = 0;
+    int n = 1;
+    size_t limit = end ? (offset - 1) : offset;
+    for (size_t i = 0; i < limit; i++)
+        if (folded[i] == ' ')
+        {
+            n++;
+            start = i + 1;
+        }
+
+    lua_pushnumber(L, n);
+    lua_gettable(L, paragraph);
+    size_t len;
+    const char* w = lua_tolstring(L, -1, &len);
+    std::string_view word(w ? w : "", w ? len : 0);
+    *wn = n;
+    *wo = unfoldoffset(word, offset - start, end);
+    lua_pop(L, 1);
+}
+
+/* The state of a search through a document, which is at stack index 1. The
+ * text is either literal words or, if isregex is set, a regular expression
+ * (see regex.cc); regular expressions only match within a paragraph. */
+
+struct Finder
+{
+    lua_State* L;
+    int cache;
+    int count;
+    std::string needle;
+    bool multiword;
+    std::boyer_moore_horspool_searcher<std::string::const_iterator> searcher;
+    bool isregex;
+    Regex regex;
+    std::string error;
+
+    Finder(lua_State* L, int cache, std::string_view text, bool isregex):
+        L(L),
+        cache(cache),
+        count(lua_objlen(L, 1)),
+        needle(isregex ? std::string() : fold(text)),
+        multiword(needle.find(' ') != std::string::npos),
+        searcher(needle.cbegin(), needle.cend()),
+        isregex(isregex)
+    {
+        if (isregex)
+            compileregex(regex, text, error);
+    }
+
+    /* Whether there's nothing which could match. */
+
+    bool empty() const
+    {
+        return isregex ? regex.program.empty() : needle.empty();
+    }
+
+    static std::string fold(std::string_view text)
+    {
+        std::string folded;
+        foldword(text,
+            [&](char c, size_t, size_t)
+            {
+                folded += c;
+            });
+        return folded;
+    }
+
+    /* Returns the offset of the first match at or after from, or npos, and
+     * sets *end to just after it. */
+
+    size_t search(std::string_view text, size_t from, size_t* end)
+    {
+        if (from > text.size())
+            return std::string::npos;
+        if (isregex)
+        {
+            size_t start;
+            if (!searchregex(regex, text, from, &start, end))
+                return std::string::npos;
+            return start;
+        }
+
+        auto i = std::search(text.begin() + from, text.end(), searcher);
+        if (i == text.end())
+            return std::string::npos;
+        *end = (i - text.begin()) + needle.size();
+        return i - text.begin();
+    }
+
+    /* Pushes paragraph pn and its folded text, returning the latter. */
+
+    std::string_view push(int pn)
+    {
+        lua_rawgeti(L, 1, pn);
+        pushfolded(L, cache, -1);
+        size_t len;
+        const char* f = lua_tolstring(L, -1, &len);
+        return std::string_view(f, len);
+    }
+
+    /* Looks for the first match which starts in paragraph pn between the
+     * given offsets of its folded text. On success the start of the match
+     * is at *start, and the end (just after it) at *end in paragraph *ep. */
+
+    bool find(int pn, size_t from, size_t to, size_t* start, int* ep,
+        size_t* end)
+    {
+        std::string_view folded = push(pn);
+        size_t found = search(folded, from, end);
+        *ep = pn;
+
+        /* Matches which start in this paragraph and finish in a later one
+         * are found by searching the end of this paragraph joined to the
+         * beginnings of the next ones. Matches can't wrap past the end of
+         * the document. */
+
+        if (multiword && (pn < count))
+        {
+            size_t tail = std::min(folded.size(), needle.size() - 1);
+            size_t base = folded.size() - tail;
+            std::string joined(folded.substr(base));
+            std::vector<std::pair<int, size_t>> segments;
+            for (int qn = pn + 1;
+                 (qn <= count) && ((joined.size() - tail) < needle.size());
+                 qn++)
+            {
+                joined += ' ';
+                segments.emplace_back(qn, joined.size());
+                joined.append(push(qn));
+                lua_pop(L, 2);
+            }
+
+            size_t e;
+            size_t i = search(joined, (from > base) ? (from - base) : 0, &e);
+            if ((i < tail) && ((base + i) < found))
+            {
+                found = base + i;
+                for (auto& seg : segments)
+                    if (e > seg.second)
+                    {
+                        *ep = seg.first;
+                        *end = e - seg.second;
+                    }
+            }
+        }
+        lua_pop(L, 2);
+
+        *start = found;
+        return (found != std::string::npos) && (found < to);
+    }
+
+    /* Pushes the paragraph, word and offset of both ends of a match. */
+
+    void pushmatch(int pn, size_t start, int ep, size_t end)
+    {
+        int mw, mo;
+        std::string_view folded = push(pn);
+        unfold(L, lua_gettop(L) - 1, folded, start, false, &mw, &mo);
+        lua_pop(L, 2);
+
+        int ew, eo;
+        folded = push(ep);
+        unfold(L, lua_gettop(L) - 1, folded, end, true, &ew, &eo);
+        lua_pop(L, 2);
+
+        lua_pushnumber(L, pn);
+        lua_pushnumber(L, mw);
+        lua_pushnumber(L, mo);
+        lua_pushnumber(L, ep);
+        lua_pushnumber(L, ew);
+        lua_pushnumber(L, eo);
+    }
+};
+
+/* Sets the smart quotes from the given stack slots and pushes the cache of
+ * folded paragraphs (which depends on them). */
+
+static int pushfindcache(lua_State* L, int quotes)
+{
+    bool changed = false;
+    for (int i = 0; i < 4; i++)
+    {
+        const char* q =
+            lua_isstring(L, quotes + i) ? lua_tostring(L, quotes + i) : "";
+        if (findquotes[i] != q)
+        {
+            findquotes[i] = q;
+            changed = true;
+        }
+    }
+
+    if (changed)
+    {
+        lua_pushnil(L);
+        lua_setfield(L, LUA_REGISTRYINDEX, FINDCACHE);
+    }
+    lua_getfield(L, LUA_REGISTRYINDEX, FINDCACHE);
+    if (lua_isnil(L, -1))
+    {
+        lua_pop(L, 1);
+        lua_newtable(L);
+        lua_createtable(L, 0, 1);
+        lua_pushstring(L, "k");
+        lua_setfield(L, -2, "__mode");
+        lua_setmetatable(L, -2);
+        lua_pushvalue(L, -1);
+        lua_setfield(L, LUA_REGISTRYINDEX, FINDCACHE);
+    }
+    return lua_gettop(L);
+}
+
+/* Finds the next occurrence of the text, starting at the given position in
+ * the document and wrapping around at the end; words in the text must match
+ * consecutive words in the document (possibly spanning paragraphs). The
+ * next four arguments are the smart quotes which also match ' and ", and
+ * the next says whether the text is a regular expression. Returns the
+ * paragraph, word and offset of the start of the match and of the end (just
+ * after the last character), or nothing.
+ *
+ * The search makes a pass over each paragraph in turn, from the starting
+ * one (pass 0) round to the starting one again (pass n, which stops before
+ * the starting word). The last two arguments, if given, limit it to that
+ * range of passes, so a long search can be done a piece at a time. */
+
+static int findtext_cb(lua_State* L)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+    size_t len;
+    const char* s = luaL_checklstring(L, 2, &len);
+    int cp = forceinteger(L, 3);
+    int cw = forceinteger(L, 4);
+    int co = forceinteger(L, 5);
+    lua_settop(L, 12);
+    luaL_checkstack(L, 8, "out of memory");
+    int firstpass = lua_isnil(L, 11) ? 0 : forceinteger(L, 11);
+    int lastpass = lua_isnil(L, 12) ? INT_MAX : forceinteger(L, 12);
+    lua_settop(L, 10);
+
+    Finder finder(L, pushfindcache(L, 6), std::string_view(s, len),
+        lua_toboolean(L, 10));
+    int n = finder.count;
+    if (finder.empty() || (cp < 1) || (cp > n))
+        return 0;
+    firstpass = std::max(firstpass, 0);
+    lastpass = std::min(lastpass, n);
+
+    /* Work out where in the starting paragraph to start, and (as the final
+     * pass after wrapping round needs to stop before the starting word) the
+     * start of that word. */
+
+    size_t startat = 0;
+    size_t stopat = 0;
+    {
+        std::string_view folded = finder.push(cp);
+        for (size_t i = 0, wn = 1; (i < folded.size()) && ((int)wn < cw); i++)
+            if (folded[i] == ' ')
+            {
+                wn++;
+                stopat = i + 1;
+            }
+
+        lua_pushnumber(L, cw);
+        lua_gettable(L, -3);
+        size_t wlen;
+        const char* w = lua_tolstring(L, -1, &wlen);
+        startat = stopat + (w ? foldedlength(std::string_view(w, wlen), co) : 0);
+        lua_pop(L, 3);
+    }
+
+    for (int pass = firstpass; pass <= lastpass; pass++)
+    {
+        int pn = ((cp - 1 + pass) % n) + 1;
+        size_t start, end;
+        int ep;
+        if (finder.find(pn, (pass == 0) ? startat : 0,
+                (pass == n) ? stopat : std::string::npos, &start, &ep, &end))
+        {
+            finder.pushmatch(pn, start, ep, end);
+            return 6;
+        }
+    }
+
+    return 0;
+}
+
+/* Given an array of paragraph numbers (or nil, for every paragraph in the
+ * document), returns the ones which contain the start of a match. As any
+ * match for a text also matches everything the text starts with, the
+ * result for one text is all that needs searching for a longer one (but
+ * that's not true of regular expressions). */
+
+static int findinparagraphs_cb(lua_State* L)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+    size_t len;
+    const char* s = luaL_checklstring(L, 2, &len);
+    lua_settop(L, 8);
+    luaL_checkstack(L, 12, "out of memory");
+    bool all = lua_isnil(L, 3);
+    if (!all)
+        luaL_checktype(L, 3, LUA_TTABLE);
+
+    Finder finder(L, pushfindcache(L, 4), std::string_view(s, len),
+        lua_toboolean(L, 8));
+    lua_newtable(L);
+    int results = lua_gettop(L);
+    if (finder.empty())
+        return 1;
+
+    int count = all ? finder.count : lua_objlen(L, 3);
+    int found = 0;
+    for (int i = 1; i <= count; i++)
+    {
+        int pn = i;
+        if (!all)
+        {
+            lua_rawgeti(L, 3, i);
+            pn = forceinteger(L, -1);
+            lua_pop(L, 1);
+        }
+        if ((pn < 1) || (pn > finder.count))
+            continue;
+
+        size_t start, end;
+        int ep;
+        if (finder.find(pn, 0, std::string::npos, &start, &ep, &end))
+        {
+            lua_pushnumber(L, pn);
+            lua_rawseti(L, results, ++found);
+        }
+    }
+
+    return 1;
+}
+
+/* Returns every (non-overlapping) match which starts in the paragraph, as a
+ * flat array of the word and offset of its start followed by the paragraph,
+ * word and offset of its end. */
+
+static int findinparagraph_cb(lua_State* L)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+    size_t len;
+    const char* s = luaL_checklstring(L, 2, &len);
+    int pn = forceinteger(L, 3);
+    lua_settop(L, 8);
+    luaL_checkstack(L, 12, "out of memory");
+
+    Finder finder(L, pushfindcache(L, 4), std::string_view(s, len),
+        lua_toboolean(L, 8));
+    lua_newtable(L);
+    int results = lua_gettop(L);
+    if (finder.empty() || (pn < 1) || (pn > finder.count))
+        return 1;
+
+    int count = 0;
+    size_t from = 0;
+    for (;;)
+    {
+        size_t start, end;
+        int ep;
+        if (!finder.find(pn, from, std::string::npos, &start, &ep, &end))
+            break;
+
+        finder.pushmatch(pn, start, ep, end);
+        lua_remove(L, -6);
+        for (int i = 5; i >= 1; i--)
+            lua_rawseti(L, results, count + i);
+        count += 5;
+
+        if (ep != pn)
+            break;
+        from = end;
+    }
+
+    return 1;
+}
+
+/* Finds every (non-overlapping) occurrence of the text in the document, from
+ * the beginning, and returns them as an array of {mp, mw, mo, cp, cw, co}
+ * in the same form as findtext(). */
+
+static int findalltext_cb(lua_State* L)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+    size_t len;
+    const char* s = luaL_checklstring(L, 2, &len);
+    lua_settop(L, 7);
+    luaL_checkstack(L, 12, "out of memory");
+
+    Finder finder(L, pushfindcache(L, 3), std::string_view(s, len),
+        lua_toboolean(L, 7));
+    lua_newtable(L);
+    int results = lua_gettop(L);
+    if (finder.empty())
+        return 1;
+
+    int count = 0;
+    int pn = 1;
+    size_t from = 0;
+    while (pn <= finder.count)
+    {
+        size_t start, end;
+        int ep;
+        if (!finder.find(pn, from, std::string::npos, &start, &ep, &end))
+        {
+            pn++;
+            from = 0;
+            continue;
+        }
+
+        lua_createtable(L, 6, 0);
+        finder.pushmatch(pn, start, ep, end);
+        for (int i = 6; i >= 1; i--)
+            lua_rawseti(L, -1 - i, i);
+        lua_rawseti(L, results, ++count);
+
+        pn = ep;
+        from = end;
+    }
+
+    return 1;
+}
+
+/* Returns nothing if the text is a valid regular expression, or a message
+ * saying what's wrong with it. */
+
+static int checkregex_cb(lua_State* L)
+{
+    size_t len;
+    const char* s = luaL_checklstring(L, 1, &len);
+    Regex regex;
+    std::string error;
+    if (compileregex(regex, std::string_view(s, len), error))
+        return 0;
+    lua_pushstring(L, error.c_str());
+    return 1;
+}
+
+static int packparagraphs_cb(lua_State* L)
+{
+    if (!lua_isnoneornil(L, 1))
+        packparagraphs = lua_toboolean(L, 1);
+    lua_pushboolean(L, packparagraphs);
+    return 1;
+}
+
+void paragraph_init(void)
+{
+    const static luaL_Reg funcs[] = {
+        {"checkregex",            checkregex_cb           },
+        {"combinehashes",         combinehashes_cb        },
+        {"countlines",            countlines_cb           },
+        {"createhashedparagraph", createhashedparagraph_cb},
+        {"createparagraph",       createparagraph_cb      },
+        {"findalltext",           findalltext_cb          },
+        {"findinparagraph",       findinparagraph_cb      },
+        {"findinparagraphs",      findinparagraphs_cb     },
+        {"findtext",              findtext_cb             },
+        {"getpackedword",         getpackedword_cb        },
+        {"packparagraphs",        packparagraphs_cb       },
+        {"packwords",             packwords_cb            },
+        {"paragraphhash",         paragraphhash_cb        },
+        {"paragraphstats",        paragraphstats_cb       },
+        {"replacewords",          replacewords_cb         },
+        {"wordstats",             wordstats_cb            },
+        {"wrapparagraph",         wrapparagraph_cb        },
+        {NULL,                    NULL                    }
+    };
+
+    const static luaL_Reg packedwordsmethods[] = {
+        {"join", packedwords_join_cb},
+        {NULL,   NULL               }
+    };
+
+    luaL_newmetatable(L, PACKEDWORDS);
+    lua_pushcfunction(L, packedwords_len_cb);
+    lua_setfield(L, -2, "__len");
+    lua_newtable(L);
+    luaL_register(L, NULL, packedwordsmethods);
+    lua_setfield(L, -2, "__index");
+    lua_pop(L, 1);
+
+    luaL_register(L, "wg", funcs);
+}
+
+// vim: sw=4 ts=4 et
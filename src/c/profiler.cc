@@ -0,0 +1,510 @@
+/* © 2026 David Given.
+ * WordGrinder is licensed under the MIT open source license. See the COPYING
+ * file in this distribution for the full text.
+ */
+
+#include "globals.h"
+#include <string.h>
+#include <errno.h>
+#include <atomic>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/* A sampling profiler for the scripts. A thread ticks once a millisecond and
+ * each tick asks the interpreter to call us back at its next safepoint (a
+ * call, return, loop or GC step), where we record the whole call stack,
+ * including any C functions on it. When the profiler isn't running there's
+ * no callback and so no cost at all.
+ *
+ * The results are folded stacks, one per line, outermost frame first, with
+ * the number of microseconds spent in each; this is what flamegraph.pl and
+ * friends eat. Time spent in a C function which doesn't call back into Lua
+ * is charged to its caller, as the interpreter can't stop until it returns.
+ */
+
+static const auto INTERVAL = std::chrono::milliseconds(1);
+
+static struct
+{
+    lua_Callbacks* callbacks;
+    std::thread thread;
+    std::atomic<bool> running;
+    std::atomic<uint64_t> ticks; /* microseconds */
+    uint64_t seen;
+
+    std::unordered_map<std::string, uint64_t> stacks;
+    std::vector<std::string> frames;
+    std::string scratch;
+    std::string filename; /* written on exit, if set */
+} profiler;
+
+static void appendframe(std::string& s, const lua_Debug& ar)
+{
+    s += ar.name ? ar.name : "(anonymous)";
+    if (ar.what && (strcmp(ar.what, "C") == 0))
+    {
+        s += " [C]";
+        return;
+    }
+
+    const char* source = ar.source ? ar.source : "?";
+    if ((*source == '=') || (*source == '@'))
+        source++;
+    s += " (";
+    s += source;
+    if (ar.linedefined > 0)
+    {
+        s += ':';
+        s += std::to_string(ar.linedefined);
+    }
+    s += ')';
+}
+
+static void sample(lua_State* L, int gc)
+{
+    if (profiler.callbacks->interrupt == sample)
+        profiler.callbacks->interrupt = nullptr;
+
+    uint64_t ticks = profiler.ticks.load();
+    uint64_t elapsed = ticks - profiler.seen;
+    profiler.seen = ticks;
+    if (!elapsed)
+        return;
+
+    profiler.frames.clear();
+    lua_Debug ar;
+    for (int level = 0; lua_getinfo(L, level, "sn", &ar); level++)
+    {
+        std::string frame;
+        appendframe(frame, ar);
+        profiler.frames.push_back(std::move(frame));
+    }
+
+    std::string& stack = profiler.scratch;
+    stack.clear();
+    for (auto i = profiler.frames.rbegin(); i != profiler.frames.rend(); i++)
+    {
+        if (!stack.empty())
+            stack += ';';
+        stack += *i;
+    }
+    if (gc > 0)
+        stack += stack.empty() ? "GC" : ";GC";
+
+    if (!stack.empty())
+        profiler.stacks[stack] += elapsed;
+}
+
+static void ticker()
+{
+    auto last = std::chrono::steady_clock::now();
+    while (profiler.running)
+    {
+        std::this_thread::sleep_for(INTERVAL);
+
+        auto now = std::chrono::steady_clock::now();
+        profiler.ticks +=
+            std::chrono::duration_cast<std::chrono::microseconds>(now - last)
+                .count();
+        last = now;
+
+        /* The interrupt may be shared (the GUI uses it to keep the window
+         * alive), so it's only taken when it's free. */
+        if (!profiler.callbacks->interrupt)
+            profiler.callbacks->interrupt = sample;
+    }
+}
+
+static std::string folded()
+{
+    std::string s;
+    for (const auto& [stack, us] : profiler.stacks)
+    {
+        s += stack;
+        s += ' ';
+        s += std::to_string(us);
+        s += '\n';
+    }
+    return s;
+}
+
+static void stopprofiler()
+{
+    if (!profiler.running)
+        return;
+
+    profiler.running = false;
+    profiler.thread.join();
+    if (profiler.callbacks->interrupt == sample)
+        profiler.callbacks->interrupt = nullptr;
+}
+
+static void profileratexit()
+{
+    stopprofiler();
+    if (!profiler.filename.empty())
+    {
+        std::string s = folded();
+        FILE* fp = fopen(profiler.filename.c_str(), "wb");
+        if (!fp || (fwrite(s.data(), 1, s.size(), fp) != s.size()))
+            fprintf(stderr,
+                "wordgrinder: can't write profile to '%s': %s\n",
+                profiler.filename.c_str(),
+                strerror(errno));
+        if (fp)
+            fclose(fp);
+    }
+}
+
+/* Starts collecting samples, returning false if the profiler's already
+ * running. If a filename is given, the results are written there on exit. */
+
+static int startprofiler_cb(lua_State* L)
+{
+    const char* filename = luaL_optstring(L, 1, nullptr);
+    if (profiler.running)
+    {
+        lua_pushboolean(L, false);
+        return 1;
+    }
+
+    static bool registered = false;
+    if (!registered)
+        atexit(profileratexit);
+    registered = true;
+
+    profiler.callbacks = lua_callbacks(L);
+    profiler.stacks.clear();
+    profiler.ticks = 0;
+    profiler.seen = 0;
+    profiler.filename = filename ? filename : "";
+    profiler.running = true;
+    profiler.thread = std::thread(ticker);
+
+    lua_pushboolean(L, true);
+    return 1;
+}
+
+/* Stops the profiler and returns the folded stacks collected so far. */
+
+static int stopprofiler_cb(lua_State* L)
+{
+    stopprofiler();
+    std::string s = folded();
+    lua_pushlstring(L, s.data(), s.size());
+    return 1;
+}
+
+static int isprofiling_cb(lua_State* L)
+{
+    lua_pushboolean(L, profiler.running);
+    return 1;
+}
+
+/* The startup timeline. Each stage of startup (from the start of main() to
+ * the event loop first waiting for the user) leaves a mark, with the time
+ * since the program started and the size of the script heap. There are only
+ * a few dozen, so they're always kept; once startup is finished they're
+ * written out if --trace-startup asked for them, and no more are taken. */
+
+static struct
+{
+    struct Mark
+    {
+        std::string name;
+        std::chrono::steady_clock::time_point time;
+        int heap; /* kB */
+    };
+
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    std::vector<Mark> marks;
+    bool finished = false;
+} startup;
+
+void tracestartup(std::string_view name)
+{
+    if (startup.finished)
+        return;
+    startup.marks.push_back({std::string(name),
+        std::chrono::steady_clock::now(),
+        L ? lua_gc(L, LUA_GCCOUNT, 0) : 0});
+}
+
+static int tracestartup_cb(lua_State* L)
+{
+    size_t len;
+    const char* name = luaL_checklstring(L, 1, &len);
+    tracestartup(std::string_view(name, len));
+    return 0;
+}
+
+/* Stops taking marks and, if given a filename, writes the timeline there:
+ * one line per mark, giving milliseconds since startup and since the mark
+ * before, and the script heap in kB. The file is written under another name
+ * and renamed into place, so anything waiting for it never sees half of it.
+ * Returns true, or nil and an error. */
+
+static int finishstartuptrace_cb(lua_State* L)
+{
+    const char* filename = luaL_optstring(L, 1, nullptr);
+    startup.finished = true;
+    if (!filename)
+    {
+        lua_pushboolean(L, true);
+        return 1;
+    }
+
+    std::string s = "#     total     delta      heap  stage\n";
+    auto last = startup.start;
+    char buffer[64];
+    for (auto& mark : startup.marks)
+    {
+        snprintf(buffer,
+            sizeof(buffer),
+            "%11.3f %9.3f %9d  ",
+            std::chrono::duration<double, std::milli>(mark.time - startup.start)
+                .count(),
+            std::chrono::duration<double, std::milli>(mark.time - last).count(),
+            mark.heap);
+        s += buffer;
+        s += mark.name;
+        s += '\n';
+        last = mark.time;
+    }
+
+    std::string temp = std::string(filename) + ".tmp";
+    FILE* fp = fopen(temp.c_str(), "wb");
+    bool ok = fp && (fwrite(s.data(), 1, s.size(), fp) == s.size());
+    if (fp && (fclose(fp) != 0))
+        ok = false;
+    if (!ok || (rename(temp.c_str(), filename) != 0))
+    {
+        lua_pushnil(L);
+        lua_pushstring(L, strerror(errno));
+        remove(temp.c_str());
+        return 2;
+    }
+
+    lua_pushboolean(L, true);
+    return 1;
+}
+
+/* Span tracing. Unlike the sampler, this records exactly when chosen bits
+ * of code (TraceSpan scopes in C, wg.tracebegin()/wg.traceend() pairs in
+ * the scripts) start and stop, so that a slow keystroke can be pinned on the
+ * listener or save which caused it. Finished spans go into a ring buffer of
+ * the most recent ones, which can be written out at any point as Chrome
+ * trace-event JSON (for chrome://tracing or Perfetto). When tracing is off a
+ * span costs a test of one flag.
+ *
+ * Any thread can finish a span. Each claims a slot in the ring with an
+ * atomic increment, and the slot's sequence number is only set once it's
+ * been filled in, so a dump running at the same time can tell whether to
+ * believe it. */
+
+struct TraceEvent
+{
+    std::atomic<uint64_t> sequence; /* of the event in it plus one, or 0 */
+    uint64_t start;                 /* microseconds since startup */
+    uint64_t duration;
+    uint32_t thread;
+    char name[68];
+};
+
+std::atomic<bool> tracing = false;
+
+static struct
+{
+    std::unique_ptr<TraceEvent[]> ring;
+    size_t size = 0;
+    std::atomic<uint64_t> next = 0;
+    std::atomic<uint32_t> threads = 0;
+
+    /* The scripts' open spans; they only run on the main thread. */
+    std::vector<std::pair<std::string, uint64_t>> stack;
+} tracer;
+
+uint64_t tracenow()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - startup.start)
+        .count();
+}
+
+void traceemit(std::string_view name, uint64_t start)
+{
+    if (!tracing.load(std::memory_order_acquire))
+        return;
+
+    thread_local uint32_t thread = ++tracer.threads;
+    uint64_t n = tracer.next.fetch_add(1, std::memory_order_relaxed);
+    TraceEvent& e = tracer.ring[n % tracer.size];
+    e.sequence.store(0, std::memory_order_release);
+    e.start = start;
+    e.duration = tracenow() - start;
+    e.thread = thread;
+    size_t len = std::min(name.size(), sizeof(e.name) - 1);
+    memcpy(e.name, name.data(), len);
+    e.name[len] = 0;
+    e.sequence.store(n + 1, std::memory_order_release);
+}
+
+/* Starts tracing, keeping the most recent count spans (by default 65536).
+ * Anything from an earlier trace is thrown away. */
+
+static int starttrace_cb(lua_State* L)
+{
+    size_t count = luaL_optinteger(L, 1, 65536);
+    luaL_argcheck(L, count > 0, 1, "must be positive");
+
+    tracing = false;
+    if (count != tracer.size)
+    {
+        tracer.ring.reset(new TraceEvent[count]);
+        tracer.size = count;
+    }
+    for (size_t i = 0; i < count; i++)
+        tracer.ring[i].sequence = 0;
+    tracer.next = 0;
+    tracer.stack.clear();
+    tracing = true;
+    return 0;
+}
+
+static int stoptrace_cb(lua_State* L)
+{
+    tracing = false;
+    return 0;
+}
+
+static int istracing_cb(lua_State* L)
+{
+    lua_pushboolean(L, tracing);
+    return 1;
+}
+
+/* Opens a span, returning a token for wg.traceend(). */
+
+static int tracebegin_cb(lua_State* L)
+{
+    size_t len;
+    const char* name = luaL_checklstring(L, 1, &len);
+    lua_pushinteger(L, tracer.stack.size());
+    if (tracing)
+        tracer.stack.push_back({std::string(name, len), tracenow()});
+    return 1;
+}
+
+/* Closes the span with the given token, and any inside it which were left
+ * open (an error having skipped their wg.traceend()). With no token, just
+ * closes the innermost span. */
+
+static int traceend_cb(lua_State* L)
+{
+    size_t depth = lua_isnoneornil(L, 1)
+                       ? (tracer.stack.empty() ? 0 : tracer.stack.size() - 1)
+                       : std::max(forceinteger(L, 1), 0);
+    while (tracer.stack.size() > depth)
+    {
+        auto& [name, start] = tracer.stack.back();
+        traceemit(name, start);
+        tracer.stack.pop_back();
+    }
+    return 0;
+}
+
+static void appendjsonstring(std::string& s, const char* p)
+{
+    s += '"';
+    for (; *p; p++)
+    {
+        unsigned char c = *p;
+        if ((c == '"') || (c == '\\'))
+        {
+            s += '\\';
+            s += c;
+        }
+        else if (c < 0x20)
+        {
+            char buffer[8];
+            snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+            s += buffer;
+        }
+        else
+            s += c;
+    }
+    s += '"';
+}
+
+/* Returns the spans in the ring buffer as Chrome trace-event JSON. Tracing
+ * carries on. */
+
+static int dumptrace_cb(lua_State* L)
+{
+    std::string s = "{\"traceEvents\":[";
+    bool first = true;
+    uint64_t last = tracer.next.load();
+    uint64_t from = (last > tracer.size) ? (last - tracer.size) : 0;
+    for (uint64_t n = from; n < last; n++)
+    {
+        TraceEvent& e = tracer.ring[n % tracer.size];
+        if (e.sequence.load(std::memory_order_acquire) != (n + 1))
+            continue;
+        TraceEvent copy;
+        copy.start = e.start;
+        copy.duration = e.duration;
+        copy.thread = e.thread;
+        memcpy(copy.name, e.name, sizeof(copy.name));
+        copy.name[sizeof(copy.name) - 1] = 0;
+        if (e.sequence.load(std::memory_order_acquire) != (n + 1))
+            continue;
+
+        if (!first)
+            s += ",\n";
+        first = false;
+        s += "{\"name\":";
+        appendjsonstring(s, copy.name);
+        char buffer[128];
+        snprintf(buffer,
+            sizeof(buffer),
+            ",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%llu,\"dur\":%llu}",
+            copy.thread,
+            (unsigned long long)copy.start,
+            (unsigned long long)copy.duration);
+        s += buffer;
+    }
+    s += "],\"displayTimeUnit\":\"ms\"}\n";
+
+    lua_pushlstring(L, s.data(), s.size());
+    return 1;
+}
+
+void profiler_init(void)
+{
+    const static luaL_Reg funcs[] = {
+        {"dumptrace",          dumptrace_cb         },
+        {"finishstartuptrace", finishstartuptrace_cb},
+        {"isprofiling",        isprofiling_cb       },
+        {"istracing",          istracing_cb         },
+        {"startprofiler",      startprofiler_cb     },
+        {"starttrace",         starttrace_cb        },
+        {"stopprofiler",       stopprofiler_cb      },
+        {"stoptrace",          stoptrace_cb         },
+        {"tracebegin",         tracebegin_cb        },
+        {"traceend",           traceend_cb          },
+        {"tracestartup",       tracestartup_cb      },
+        {NULL,                 NULL                 }
+    };
+
+    luaL_register(L, "wg", funcs);
+    lua_pop(L, 1);
+}
+
+// vim: sw=4 ts=4 et
@@ -0,0 +1,862 @@
+/* © 2026 David Given.
+ * WordGrinder is licensed under the MIT open source license. See the COPYING
+ * file in this distribution for the full text.
+ */
+
+#include "globals.h"
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/* Regular expressions for searching. A pattern is compiled into a program
+ * for a Pike VM (as described by Russ Cox, and used by RE2), which runs
+ * every way the pattern could match in lockstep, one character of the text
+ * at a time; each instruction is visited at most once per character, so a
+ * search takes time proportional to the length of the text times the size
+ * of the program and nothing ever backtracks. Matches are leftmost-first,
+ * as in Perl, and never empty.
+ *
+ * Everything works on UTF-8 characters. The text being searched is folded
+ * (see paragraph.cc), so is all in lower case as far as ASCII goes: the
+ * pattern is folded to match as it's compiled.
+ *
+ * The syntax is the usual subset: literals, ., [classes] (with ranges and
+ * ^), \d \w \s and their negations, \b \B, ^ and $ (the beginning and end
+ * of the paragraph), (groups), (?:groups), |, and * + ? {n} {n,} {n,m},
+ * all of which can be followed by ? to make them lazy. */
+
+enum
+{
+    OP_CHAR,   /* x is the character */
+    OP_ANY,
+    OP_CLASS,  /* x is the class; y is set if it's negated */
+    OP_SPLIT,  /* try x, then y */
+    OP_JMP,    /* x is the target */
+    OP_BOL,
+    OP_EOL,
+    OP_WORDB,
+    OP_NWORDB,
+    OP_MATCH,
+};
+
+static const int MAXPROGRAM = 10000;
+static const int MAXREPEAT = 1000;
+static const int MAXDEPTH = 100;
+
+/* Decodes the character at text[pos], returning its length in *len (or -1,
+ * and a length of 0, at the end of the text). Invalid bytes are returned as
+ * themselves. */
+
+static uni_t decode(std::string_view text, size_t pos, int* len)
+{
+    if (pos >= text.size())
+    {
+        *len = 0;
+        return -1;
+    }
+
+    uint8_t c = text[pos];
+    int n = getu8bytes(c);
+    if ((n < 2) || (n > 4) || ((pos + n) > text.size()))
+    {
+        *len = 1;
+        return c;
+    }
+
+    uni_t u = c & (0x7f >> n);
+    for (int i = 1; i < n; i++)
+    {
+        uint8_t cc = text[pos + i];
+        if ((cc & 0xc0) != 0x80)
+        {
+            *len = 1;
+            return c;
+        }
+        u = (u << 6) | (cc & 0x3f);
+    }
+    *len = n;
+    return u;
+}
+
+/* Returns the character before text[pos], or -1 at the start. */
+
+static uni_t decodebefore(std::string_view text, size_t pos)
+{
+    if (pos == 0)
+        return -1;
+    size_t i = pos - 1;
+    while ((i > 0) && (pos - i < 4) && (((uint8_t)text[i] & 0xc0) == 0x80))
+        i--;
+    int len;
+    uni_t c = decode(text, i, &len);
+    return ((i + len) == pos) ? c : (uint8_t)text[pos - 1];
+}
+
+/* Anything outside ASCII counts as a letter. */
+
+static bool isword(uni_t c)
+{
+    return (c >= 0x80) || ((c >= 'a') && (c <= 'z')) ||
+           ((c >= 'A') && (c <= 'Z')) || ((c >= '0') && (c <= '9')) ||
+           (c == '_');
+}
+
+static bool inclass(const Regex::Class& cls, uni_t c)
+{
+    for (auto& r : cls)
+        if ((c >= r.first) && (c <= r.second))
+            return true;
+    return false;
+}
+
+/* --- Parsing ----------------------------------------------------------- */
+
+namespace
+{
+    struct Node
+    {
+        enum
+        {
+            EMPTY,
+            CHAR,
+            ANY,
+            CLASS,
+            BOL,
+            EOL,
+            WORDB,
+            NWORDB,
+            CAT,
+            ALT,
+            REPEAT,
+        };
+
+        int kind = EMPTY;
+        uni_t c = 0;
+        int cls = 0;
+        bool negated = false;
+        int min = 0;
+        int max = 0; /* -1 for no limit */
+        bool greedy = true;
+        std::vector<Node> children;
+    };
+
+    struct Parser
+    {
+        std::string_view pattern;
+        size_t pos = 0;
+        int depth = 0;
+        Regex& regex;
+        std::string& error;
+
+        Parser(std::string_view pattern, Regex& regex, std::string& error):
+            pattern(pattern),
+            regex(regex),
+            error(error)
+        {
+        }
+
+        bool atend()
+        {
+            return pos >= pattern.size();
+        }
+
+        char peek()
+        {
+            return atend() ? 0 : pattern[pos];
+        }
+
+        uni_t next()
+        {
+            int len;
+            uni_t c = decode(pattern, pos, &len);
+            pos += len;
+            return c;
+        }
+
+        bool fail(const char* message)
+        {
+            if (error.empty())
+                error = message;
+            return false;
+        }
+
+        bool parsealt(Node& node)
+        {
+            if (++depth > MAXDEPTH)
+                return fail("too deeply nested");
+
+            node.kind = Node::ALT;
+            for (;;)
+            {
+                node.children.emplace_back();
+                if (!parsecat(node.children.back()))
+                    return false;
+                if (peek() != '|')
+                    break;
+                pos++;
+            }
+            if (node.children.size() == 1)
+            {
+                Node child = std::move(node.children[0]);
+                node = std::move(child);
+            }
+
+            depth--;
+            return true;
+        }
+
+        bool parsecat(Node& node)
+        {
+            node.kind = Node::CAT;
+            while (!atend() && (peek() != '|') && (peek() != ')'))
+            {
+                node.children.emplace_back();
+                if (!parserepeat(node.children.back()))
+                    return false;
+            }
+            return true;
+        }
+
+        bool parsenumber(int* n)
+        {
+            if (!isdigit((uint8_t)peek()))
+                return false;
+            *n = 0;
+            while (isdigit((uint8_t)peek()))
+            {
+                *n = (*n * 10) + (pattern[pos++] - '0');
+                if (*n > MAXREPEAT)
+                    return fail("repeat count too big");
+            }
+            return true;
+        }
+
+        bool parserepeat(Node& node)
+        {
+            if (!parseatom(node))
+                return false;
+
+            for (;;)
+            {
+                int min, max;
+                char c = peek();
+                if (c == '*')
+                {
+                    min = 0;
+                    max = -1;
+                    pos++;
+                }
+                else if (c == '+')
+                {
+                    min = 1;
+                    max = -1;
+                    pos++;
+                }
+                else if (c == '?')
+                {
+                    min = 0;
+                    max = 1;
+                    pos++;
+                }
+                else if (c == '{')
+                {
+                    pos++;
+                    if (!parsenumber(&min))
+                        return fail("bad repeat count");
+                    max = min;
+                    if (peek() == ',')
+                    {
+                        pos++;
+                        max = -1;
+                        if ((peek() != '}') && !parsenumber(&max))
+                            return fail("bad repeat count");
+                    }
+                    if (peek() != '}')
+                        return fail("bad repeat count");
+                    pos++;
+                    if ((max != -1) && (max < min))
+                        return fail("bad repeat count");
+                }
+                else
+                    return true;
+
+                switch (node.kind)
+                {
+                    case Node::EMPTY:
+                    case Node::BOL:
+                    case Node::EOL:
+                    case Node::WORDB:
+                    case Node::NWORDB:
+                        return fail("nothing to repeat");
+                }
+
+                Node repeat;
+                repeat.kind = Node::REPEAT;
+                repeat.min = min;
+                repeat.max = max;
+                if (peek() == '?')
+                {
+                    repeat.greedy = false;
+                    pos++;
+                }
+                repeat.children.push_back(std::move(node));
+                node = std::move(repeat);
+            }
+        }
+
+        /* Adds a predefined class (\d, \w or \s) to a class. */
+
+        void addpredefined(Regex::Class& cls, char c)
+        {
+            switch (c)
+            {
+                case 'd':
+                    cls.emplace_back('0', '9');
+                    break;
+
+                case 'w':
+                    cls.emplace_back('0', '9');
+                    cls.emplace_back('A', 'Z');
+                    cls.emplace_back('_', '_');
+                    cls.emplace_back('a', 'z');
+                    cls.emplace_back(0x80, 0x10ffff);
+                    break;
+
+                case 's':
+                    cls.emplace_back('\t', '\r');
+                    cls.emplace_back(' ', ' ');
+                    break;
+            }
+        }
+
+        int addclass(Regex::Class& cls)
+        {
+            /* Anything which matches an upper case letter should match the
+             * lower case one, as that's what will be in the text. */
+
+            size_t n = cls.size();
+            for (size_t i = 0; i < n; i++)
+            {
+                uni_t lo = std::max<uni_t>(cls[i].first, 'A');
+                uni_t hi = std::min<uni_t>(cls[i].second, 'Z');
+                if (lo <= hi)
+                    cls.emplace_back(lo + 'a' - 'A', hi + 'a' - 'A');
+            }
+
+            regex.classes.push_back(std::move(cls));
+            return regex.classes.size() - 1;
+        }
+
+        /* Reads a character in a class, which might be escaped. */
+
+        bool parseclasschar(uni_t* c)
+        {
+            if (atend())
+                return fail("unterminated class");
+            if (peek() == '\\')
+            {
+                pos++;
+                if (atend())
+                    return fail("bad escape");
+                char e = peek();
+                if (isalnum((uint8_t)e))
+                {
+                    pos++;
+                    if (e == 't')
+                        *c = '\t';
+                    else if (e == 'n')
+                        *c = '\n';
+                    else
+                        return fail("bad escape");
+                    return true;
+                }
+            }
+            *c = next();
+            return true;
+        }
+
+        bool parseclass(Node& node)
+        {
+            Regex::Class cls;
+            node.kind = Node::CLASS;
+            if (peek() == '^')
+            {
+                node.negated = true;
+                pos++;
+            }
+
+            bool first = true;
+            for (;;)
+            {
+                if (atend())
+                    return fail("unterminated class");
+                if ((peek() == ']') && !first)
+                {
+                    pos++;
+                    break;
+                }
+                first = false;
+
+                if ((peek() == '\\') && ((pos + 1) < pattern.size()))
+                {
+                    char e = pattern[pos + 1];
+                    if ((e == 'd') || (e == 'w') || (e == 's'))
+                    {
+                        pos += 2;
+                        addpredefined(cls, e);
+                        continue;
+                    }
+                    if ((e == 'D') || (e == 'W') || (e == 'S'))
+                        return fail("negated classes can't go in classes");
+                }
+
+                uni_t lo, hi;
+                if (!parseclasschar(&lo))
+                    return false;
+                hi = lo;
+                if ((peek() == '-') && ((pos + 1) < pattern.size()) &&
+                    (pattern[pos + 1] != ']'))
+                {
+                    pos++;
+                    if (!parseclasschar(&hi))
+                        return false;
+                    if (hi < lo)
+                        return fail("bad class range");
+                }
+                cls.emplace_back(lo, hi);
+            }
+
+            node.cls = addclass(cls);
+            return true;
+        }
+
+        bool parseescape(Node& node)
+        {
+            if (atend())
+                return fail("bad escape");
+
+            char e = peek();
+            if (!isalnum((uint8_t)e))
+            {
+                node.kind = Node::CHAR;
+                node.c = next();
+                return true;
+            }
+
+            pos++;
+            switch (e)
+            {
+                case 'd':
+                case 'w':
+                case 's':
+                case 'D':
+                case 'W':
+                case 'S':
+                {
+                    Regex::Class cls;
+                    addpredefined(cls, tolower(e));
+                    node.kind = Node::CLASS;
+                    node.negated = isupper(e);
+                    node.cls = addclass(cls);
+                    return true;
+                }
+
+                case 'b':
+                    node.kind = Node::WORDB;
+                    return true;
+
+                case 'B':
+                    node.kind = Node::NWORDB;
+                    return true;
+
+                case 't':
+                    node.kind = Node::CHAR;
+                    node.c = '\t';
+                    return true;
+
+                case 'n':
+                    node.kind = Node::CHAR;
+                    node.c = '\n';
+                    return true;
+            }
+
+            return fail("bad escape");
+        }
+
+        bool parseatom(Node& node)
+        {
+            char c = peek();
+            switch (c)
+            {
+                case '(':
+                    pos++;
+                    if ((peek() == '?') && ((pos + 1) < pattern.size()) &&
+                        (pattern[pos + 1] == ':'))
+                        pos += 2;
+                    if (!parsealt(node))
+                        return false;
+                    if (peek() != ')')
+                        return fail("missing )");
+                    pos++;
+                    return true;
+
+                case '[':
+                    pos++;
+                    return parseclass(node);
+
+                case '.':
+                    pos++;
+                    node.kind = Node::ANY;
+                    return true;
+
+                case '^':
+                    pos++;
+                    node.kind = Node::BOL;
+                    return true;
+
+                case '$':
+                    pos++;
+                    node.kind = Node::EOL;
+                    return true;
+
+                case '\\':
+                    pos++;
+                    return parseescape(node);
+
+                case '*':
+                case '+':
+                case '?':
+                case '{':
+                    return fail("nothing to repeat");
+            }
+
+            node.kind = Node::CHAR;
+            node.c = next();
+            if ((node.c >= 'A') && (node.c <= 'Z'))
+                node.c += 'a' - 'A';
+            return true;
+        }
+    };
+
+    /* --- Code generation ----------------------------------------------- */
+
+    struct Compiler
+    {
+        Regex& regex;
+        std::string& error;
+
+        Compiler(Regex& regex, std::string& error): regex(regex), error(error)
+        {
+        }
+
+        int emit(int op, int x = 0, int y = 0)
+        {
+            regex.program.push_back({op, x, y});
+            return regex.program.size() - 1;
+        }
+
+        bool compile(const Node& node)
+        {
+            if ((int)regex.program.size() > MAXPROGRAM)
+            {
+                if (error.empty())
+                    error = "pattern too big";
+                return false;
+            }
+
+            switch (node.kind)
+            {
+                case Node::EMPTY:
+                    return true;
+
+                case Node::CHAR:
+                    emit(OP_CHAR, node.c);
+                    return true;
+
+                case Node::ANY:
+                    emit(OP_ANY);
+                    return true;
+
+                case Node::CLASS:
+                    emit(OP_CLASS, node.cls, node.negated);
+                    return true;
+
+                case Node::BOL:
+                    emit(OP_BOL);
+                    return true;
+
+                case Node::EOL:
+                    emit(OP_EOL);
+                    return true;
+
+                case Node::WORDB:
+                    emit(OP_WORDB);
+                    return true;
+
+                case Node::NWORDB:
+                    emit(OP_NWORDB);
+                    return true;
+
+                case Node::CAT:
+                    for (auto& child : node.children)
+                        if (!compile(child))
+                            return false;
+                    return true;
+
+                case Node::ALT:
+                {
+                    std::vector<int> jumps;
+                    for (size_t i = 0; i < node.children.size(); i++)
+                    {
+                        int split = -1;
+                        if (i != (node.children.size() - 1))
+                            split = emit(OP_SPLIT, regex.program.size() + 1);
+                        if (!compile(node.children[i]))
+                            return false;
+                        if (split != -1)
+                        {
+                            jumps.push_back(emit(OP_JMP));
+                            regex.program[split].y = regex.program.size();
+                        }
+                    }
+                    for (int j : jumps)
+                        regex.program[j].x = regex.program.size();
+                    return true;
+                }
+
+                case Node::REPEAT:
+                {
+                    const Node& body = node.children[0];
+                    for (int i = 0; i < node.min; i++)
+                        if (!compile(body))
+                            return false;
+
+                    if (node.max == -1)
+                    {
+                        int split = emit(OP_SPLIT);
+                        if (!compile(body))
+                            return false;
+                        emit(OP_JMP, split);
+                        patch(split, split + 1, regex.program.size(),
+                            node.greedy);
+                        return true;
+                    }
+
+                    std::vector<int> splits;
+                    for (int i = node.min; i < node.max; i++)
+                    {
+                        splits.push_back(emit(OP_SPLIT));
+                        if (!compile(body))
+                            return false;
+                    }
+                    for (int split : splits)
+                        patch(split, split + 1, regex.program.size(),
+                            node.greedy);
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        void patch(int split, int body, int out, bool greedy)
+        {
+            regex.program[split].x = greedy ? body : out;
+            regex.program[split].y = greedy ? out : body;
+        }
+    };
+}
+
+bool compileregex(Regex& regex, std::string_view pattern, std::string& error)
+{
+    regex.program.clear();
+    regex.classes.clear();
+    error.clear();
+
+    Node root;
+    Parser parser(pattern, regex, error);
+    if (!parser.parsealt(root))
+        return false;
+    if (!parser.atend())
+    {
+        error = "unmatched )";
+        return false;
+    }
+
+    Compiler compiler(regex, error);
+    if (!compiler.compile(root))
+        return false;
+    if ((int)regex.program.size() > MAXPROGRAM)
+    {
+        error = "pattern too big";
+        return false;
+    }
+    compiler.emit(OP_MATCH);
+    return true;
+}
+
+/* --- Matching ---------------------------------------------------------- */
+
+namespace
+{
+    struct Thread
+    {
+        int pc;
+        size_t start;
+    };
+
+    struct VM
+    {
+        const Regex& regex;
+        std::string_view text;
+        std::vector<unsigned> marks;
+        std::vector<int> stack;
+        unsigned generation = 0;
+
+        VM(const Regex& regex, std::string_view text):
+            regex(regex),
+            text(text),
+            marks(regex.program.size(), 0)
+        {
+        }
+
+        /* Adds the thread at pc, and everything it leads to without
+         * consuming a character, to the list in priority order. prev and
+         * next are the characters either side of the position. */
+
+        void add(std::vector<Thread>& list, int pc, size_t start, size_t pos,
+            uni_t prev, uni_t next)
+        {
+            stack.push_back(pc);
+            while (!stack.empty())
+            {
+                pc = stack.back();
+                stack.pop_back();
+                if (marks[pc] == generation)
+                    continue;
+                marks[pc] = generation;
+
+                const Regex::Instruction& i = regex.program[pc];
+                switch (i.op)
+                {
+                    case OP_JMP:
+                        stack.push_back(i.x);
+                        break;
+
+                    case OP_SPLIT:
+                        stack.push_back(i.y);
+                        stack.push_back(i.x);
+                        break;
+
+                    case OP_BOL:
+                        if (pos == 0)
+                            stack.push_back(pc + 1);
+                        break;
+
+                    case OP_EOL:
+                        if (pos == text.size())
+                            stack.push_back(pc + 1);
+                        break;
+
+                    case OP_WORDB:
+                    case OP_NWORDB:
+                    {
+                        bool boundary = isword(prev) != isword(next);
+                        if (boundary == (i.op == OP_WORDB))
+                            stack.push_back(pc + 1);
+                        break;
+                    }
+
+                    default:
+                        list.push_back({pc, start});
+                        break;
+                }
+            }
+        }
+    };
+}
+
+bool searchregex(const Regex& regex, std::string_view text, size_t from,
+    size_t* start, size_t* end)
+{
+    if (regex.program.empty() || (from > text.size()))
+        return false;
+
+    VM vm(regex, text);
+    std::vector<Thread> current;
+    std::vector<Thread> next;
+    bool matched = false;
+
+    size_t pos = from;
+    uni_t prev = decodebefore(text, pos);
+    int len;
+    uni_t c = decode(text, pos, &len);
+    vm.generation++;
+    for (;;)
+    {
+        /* Until something's matched, a new attempt starts at every
+         * character, with a lower priority than the ones already going. */
+
+        if (!matched)
+            vm.add(current, 0, pos, pos, prev, c);
+        else if (current.empty())
+            break;
+
+        int nextlen;
+        uni_t nextc = decode(text, pos + len, &nextlen);
+        vm.generation++;
+        next.clear();
+        for (const Thread& t : current)
+        {
+            const Regex::Instruction& i = regex.program[t.pc];
+            bool step = false;
+            switch (i.op)
+            {
+                case OP_CHAR:
+                    step = (c == i.x);
+                    break;
+
+                case OP_ANY:
+                    step = (c != -1);
+                    break;
+
+                case OP_CLASS:
+                    step = (c != -1) &&
+                           (inclass(regex.classes[i.x], c) != (bool)i.y);
+                    break;
+
+                case OP_MATCH:
+                    if (t.start != pos)
+                    {
+                        matched = true;
+                        *start = t.start;
+                        *end = pos;
+                    }
+                    break;
+            }
+
+            if (step)
+                vm.add(next, t.pc + 1, t.start, pos + len, c, nextc);
+
+            /* Anything after a match has a lower priority, so can't
+             * replace it; but the threads before it might find a longer
+             * one. */
+
+            if ((i.op == OP_MATCH) && (t.start != pos))
+                break;
+        }
+
+        std::swap(current, next);
+        if (c == -1)
+            break;
+        pos += len;
+        prev = c;
+        c = nextc;
+        len = nextlen;
+    }
+
+    return matched;
+}
+
+// vim: sw=4 ts=4 et
@@ -5,12 +5,32 @@
 
 #include "globals.h"
 #include <string.h>
+#include <errno.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
 
 static bool running = false;
 static int cursorx = 0;
 static int cursory = 0;
 static bool cursorshown = true;
 
+/* Bumped by everything which changes the screen contents, so that the Lua
+ * side can tell whether anything else has drawn since it last did. */
+static unsigned drawcount = 0;
+
+/* Colour pairs registered with makecolour(), by handle, so that setting one
+ * doesn't mean reading six numbers out of two tables each time. The display
+ * is only told when the colour actually changes. */
+struct colourpair_t
+{
+    colour_t fg;
+    colour_t bg;
+};
+
+static std::vector<colourpair_t> colourhandles;
+static int currentcolour = -1;
+
 void screen_deinit(void)
 {
     if (running)
@@ -23,6 +43,8 @@ void screen_deinit(void)
 static int initscreen_cb(lua_State* L)
 {
     dpy_start();
+    drawcount++;
+    currentcolour = -1;
 
     running = true;
     atexit(screen_deinit);
@@ -38,11 +60,13 @@ static int deinitscreen_cb(lua_State* L)
 static int clearscreen_cb(lua_State* L)
 {
     dpy_clearscreen();
+    drawcount++;
     return 0;
 }
 
 static int sync_cb(lua_State* L)
 {
+    TraceSpan span("dpy_sync");
     dpy_setcursor(cursorx, cursory, cursorshown);
     dpy_sync();
     return 0;
@@ -92,21 +116,44 @@ static float getnumber(lua_State* L, int table, int index)
     return value;
 }
 
-static int setcolour_cb(lua_State* L)
+static colour_t getcolour(lua_State* L, int table)
 {
-    colour_t fg = {
-        getnumber(L, 1, 1),
-        getnumber(L, 1, 2),
-        getnumber(L, 1, 3),
+    return colour_t{
+        getnumber(L, table, 1),
+        getnumber(L, table, 2),
+        getnumber(L, table, 3),
     };
+}
 
-    colour_t bg = {
-        getnumber(L, 2, 1),
-        getnumber(L, 2, 2),
-        getnumber(L, 2, 3),
-    };
+static int setcolour_cb(lua_State* L)
+{
+    colour_t fg = getcolour(L, 1);
+    colour_t bg = getcolour(L, 2);
 
     dpy_setcolour(&fg, &bg);
+    currentcolour = -1;
+    return 0;
+}
+
+static int makecolour_cb(lua_State* L)
+{
+    colourhandles.push_back(colourpair_t{getcolour(L, 1), getcolour(L, 2)});
+    lua_pushinteger(L, colourhandles.size() - 1);
+    return 1;
+}
+
+static int usecolour_cb(lua_State* L)
+{
+    int handle = luaL_checkinteger(L, 1);
+    luaL_argcheck(L, (handle >= 0) && ((size_t)handle < colourhandles.size()), 1,
+        "no such colour");
+
+    if (handle != currentcolour)
+    {
+        const colourpair_t& pair = colourhandles[handle];
+        dpy_setcolour(&pair.fg, &pair.bg);
+        currentcolour = handle;
+    }
     return 0;
 }
 
@@ -121,6 +168,7 @@ void dpy_writeunichar(int x, int y, uni_t c)
     if (!enable_unicode && (c > 0xff))
         c = '?';
     dpy_writechar(x, y, c);
+    drawcount++;
 }
 
 static int write_cb(lua_State* L)
@@ -150,9 +198,30 @@ static int cleararea_cb(lua_State* L)
     int x2 = forceinteger(L, 3);
     int y2 = forceinteger(L, 4);
     dpy_cleararea(x1, y1, x2, y2);
+    drawcount++;
+    return 0;
+}
+
+/* Moves the contents of rows y1 to y2 up by delta rows (down, if negative);
+ * the rows which are exposed are cleared. Terminals can do this without
+ * resending anything but the new rows. */
+
+static int scrollarea_cb(lua_State* L)
+{
+    int y1 = forceinteger(L, 1);
+    int y2 = forceinteger(L, 2);
+    int delta = forceinteger(L, 3);
+    dpy_scrollarea(y1, y2, delta);
+    drawcount++;
     return 0;
 }
 
+static int getdrawcount_cb(lua_State* L)
+{
+    lua_pushnumber(L, drawcount);
+    return 1;
+}
+
 static int gotoxy_cb(lua_State* L)
 {
     cursorx = forceinteger(L, 1);
@@ -172,6 +241,12 @@ static int hidecursor_cb(lua_State* L)
     return 0;
 }
 
+static int setcursorblink_cb(lua_State* L)
+{
+    lua_pushboolean(L, dpy_setcursorblink(lua_toboolean(L, 1)));
+    return 1;
+}
+
 static int getscreensize_cb(lua_State* L)
 {
     int x, y;
@@ -185,11 +260,35 @@ static int getstringwidth_cb(lua_State* L)
 {
     size_t size;
     const char* s = luaL_checklstring(L, 1, &size);
-    const char* send = s + size;
+
+    lua_pushnumber(L, getwordmetrics(s, size).width);
+    return 1;
+}
+
+/* The cursor is positioned by byte offset, but the screen wants columns.
+ * These convert between the two within a single word, style bytes taking up
+ * no room. Offsets are one based, as in Lua. */
+
+static int getwidthfromoffset_cb(lua_State* L)
+{
+    size_t size;
+    const char* s = luaL_checklstring(L, 1, &size);
+    int o = forceinteger(L, 2);
+    const char* send = s + std::clamp<int>(o - 1, 0, size);
 
     int width = 0;
     while (s < send)
     {
+        size_t ascii = printableasciispan(s, send - s);
+        if (ascii)
+        {
+            width += ascii;
+            s += ascii;
+            continue;
+        }
+
+        if (getu8bytes(*s) > (send - s))
+            break;
         uni_t c = readu8(&s);
         if (!iswcntrl(c))
             width += emu_wcwidth(c);
@@ -199,6 +298,43 @@ static int getstringwidth_cb(lua_State* L)
     return 1;
 }
 
+/* Returns the offset of the first character which doesn't entirely fit in
+ * width columns, or one past the end of the word if everything does. */
+
+static int getoffsetfromwidth_cb(lua_State* L)
+{
+    size_t size;
+    const char* start = luaL_checklstring(L, 1, &size);
+    const char* send = start + size;
+    int width = forceinteger(L, 2);
+
+    const char* s = start;
+    while ((s < send) && (width > 0))
+    {
+        size_t ascii = printableasciispan(s, send - s);
+        if (ascii)
+        {
+            ascii = std::min<size_t>(ascii, width);
+            width -= ascii;
+            s += ascii;
+            continue;
+        }
+
+        const char* p = s;
+        uni_t c = readu8(&s);
+        int w = iswcntrl(c) ? 0 : emu_wcwidth(c);
+        if (w > width)
+        {
+            s = p;
+            break;
+        }
+        width -= w;
+    }
+
+    lua_pushnumber(L, (s - start) + 1);
+    return 1;
+}
+
 static int getboundedstring_cb(lua_State* L)
 {
     size_t size;
@@ -209,6 +345,19 @@ static int getboundedstring_cb(lua_State* L)
     const char* s = start;
     while (s < send)
     {
+        size_t ascii = printableasciispan(s, send - s);
+        if (ascii)
+        {
+            if ((int)ascii > width)
+            {
+                send = s + std::max(width, 0);
+                break;
+            }
+            width -= ascii;
+            s += ascii;
+            continue;
+        }
+
         const char* p = s;
         uni_t c = readu8(&s);
         if (!iswcntrl(c))
@@ -249,18 +398,68 @@ void decode_mouse_event(uni_t key, int* x, int* y, bool* b)
     *y = (key >> 8) & 0xff;
 }
 
-static int getchar_cb(lua_State* L)
+/* Dragging a window edge produces a storm of resizes, and each one costs a
+ * rewrap and a full redraw. So a resize is only passed on once no more have
+ * arrived for RESIZE_SETTLE seconds; until then the old layout stays on the
+ * screen, clipped to the new size. Anything else which turns up meanwhile
+ * is kept back for next time. */
+
+static const double RESIZE_SETTLE = 0.1;
+static bool haveheldkey = false;
+static uni_t heldkey;
+
+static bool isnamedkey(uni_t c, const char* name)
+{
+    if (c > 0)
+        return false;
+    int m = -c & KEYM_MOUSE;
+    if ((m == KEY_MOUSEDOWN) || (m == KEY_MOUSEUP))
+        return false;
+    return dpy_getkeyname(c) == name;
+}
+
+static uni_t nextkey(double t)
+{
+    uni_t c;
+    if (haveheldkey)
+    {
+        haveheldkey = false;
+        c = heldkey;
+    }
+    else
+        c = dpy_getchar(t);
+    if (!isnamedkey(c, "KEY_RESIZE"))
+        return c;
+
+    for (;;)
+    {
+        uni_t n = dpy_getchar(RESIZE_SETTLE);
+        if (isnamedkey(n, "KEY_RESIZE"))
+            continue;
+        if (!isnamedkey(n, "KEY_TIMEOUT"))
+        {
+            heldkey = n;
+            haveheldkey = true;
+        }
+        return c;
+    }
+}
+
+static int getkey(lua_State* L)
 {
     double t = -1.0;
     if (!lua_isnone(L, 1))
         t = forcedouble(L, 1);
 
-    dpy_setcursor(cursorx, cursory, cursorshown);
-    dpy_sync();
+    {
+        TraceSpan span("dpy_sync");
+        dpy_setcursor(cursorx, cursory, cursorshown);
+        dpy_sync();
+    }
 
     for (;;)
     {
-        uni_t c = dpy_getchar(t);
+        uni_t c = nextkey(t);
         if (c <= 0)
         {
             switch (-c & KEYM_MOUSE)
@@ -311,6 +510,95 @@ static int getchar_cb(lua_State* L)
     return 1;
 }
 
+/* The key recorder. While it's on, everything wg.getchar() returns (apart
+ * from timeouts) is appended to a file, one event per line, as the number of
+ * seconds since recording started, a tab, and the key the way the event loop
+ * sees it; mouse events are written as MOUSE followed by x, y and the button
+ * state. benchmarks/typing.lua replays these. */
+
+static FILE* keyfile = nullptr;
+static std::chrono::steady_clock::time_point keystart;
+
+static void recordkey(lua_State* L)
+{
+    double t = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - keystart)
+                   .count();
+
+    if (lua_istable(L, -1))
+    {
+        lua_getfield(L, -1, "x");
+        lua_getfield(L, -2, "y");
+        lua_getfield(L, -3, "b");
+        fprintf(keyfile,
+            "%.6f\tMOUSE %d %d %d\n",
+            t,
+            (int)lua_tointeger(L, -3),
+            (int)lua_tointeger(L, -2),
+            lua_toboolean(L, -1));
+        lua_pop(L, 3);
+    }
+    else
+    {
+        const char* s = lua_tostring(L, -1);
+        if (strcmp(s, "KEY_TIMEOUT") == 0)
+            return;
+        fprintf(keyfile, "%.6f\t%s\n", t, s);
+    }
+
+    /* Keep the file up to date in case we crash. */
+    fflush(keyfile);
+}
+
+static int getchar_cb(lua_State* L)
+{
+    getkey(L);
+    if (keyfile)
+        recordkey(L);
+    return 1;
+}
+
+/* Returns when the key wg.getchar() last returned arrived, on the same
+ * clock as wg.time(), or nil if the backend doesn't know. This can be well
+ * before it was asked for, if the scripts were busy. */
+
+static int getkeytime_cb(lua_State* L)
+{
+    double t = dpy_getkeytime();
+    if (t)
+        lua_pushnumber(L, t);
+    else
+        lua_pushnil(L);
+    return 1;
+}
+
+/* Starts recording keys to a file, replacing its contents; or, with no
+ * filename, stops. */
+
+static int recordkeys_cb(lua_State* L)
+{
+    const char* filename = luaL_optstring(L, 1, nullptr);
+    if (keyfile)
+        fclose(keyfile);
+    keyfile = nullptr;
+
+    if (filename)
+    {
+        keyfile = fopen(filename, "w");
+        if (!keyfile)
+        {
+            lua_pushnil(L);
+            lua_pushstring(L, strerror(errno));
+            lua_pushinteger(L, errno);
+            return 3;
+        }
+        keystart = std::chrono::steady_clock::now();
+    }
+
+    lua_pushboolean(L, true);
+    return 1;
+}
+
 static int useunicode_cb(lua_State* L)
 {
     lua_pushboolean(L, enable_unicode);
@@ -340,16 +628,25 @@ void screen_init(const char* argv[])
         {"setitalic",           setitalic_cb          },
         {"setnormal",           setnormal_cb          },
         {"setcolour",           setcolour_cb          },
+        {"makecolour",          makecolour_cb         },
+        {"usecolour",           usecolour_cb          },
         {"write",               write_cb              },
         {"cleararea",           cleararea_cb          },
+        {"scrollarea",          scrollarea_cb         },
+        {"getdrawcount",        getdrawcount_cb       },
         {"gotoxy",              gotoxy_cb             },
         {"showcursor",          showcursor_cb         },
         {"hidecursor",          hidecursor_cb         },
+        {"setcursorblink",      setcursorblink_cb     },
         {"getscreensize",       getscreensize_cb      },
         {"getstringwidth",      getstringwidth_cb     },
         {"getboundedstring",    getboundedstring_cb   },
+        {"getwidthfromoffset",  getwidthfromoffset_cb },
+        {"getoffsetfromwidth",  getoffsetfromwidth_cb },
         {"getbytesofcharacter", getbytesofcharacter_cb},
         {"getchar",             getchar_cb            },
+        {"getkeytime",          getkeytime_cb         },
+        {"recordkeys",          recordkeys_cb         },
         {"useunicode",          useunicode_cb         },
         {"setunicode",          setunicode_cb         },
         {NULL,                  NULL                  }
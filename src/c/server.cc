@@ -0,0 +1,632 @@
+/* © 2026 David Given.
+ * WordGrinder is licensed under the MIT open source license. See the COPYING
+ * file in this distribution for the full text.
+ */
+
+#include "globals.h"
+#include <errno.h>
+#include <string.h>
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+#if !defined WIN32
+#include <fcntl.h>
+#include <limits.h>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <termios.h>
+#endif
+
+/* A conversion server, for when lots of conversions need doing and starting
+ * up WordGrinder for each one would cost more than the conversion itself.
+ * wg.serve() listens on a Unix domain socket, and forks a child for each job
+ * which arrives; the child starts with the server's already warmed-up heap
+ * (shared copy-on-write), so has nothing to load. Jobs run in parallel.
+ *
+ * The client (submitjob(), run by `wordgrinder --via socket ...` before
+ * the interpreter is even started) sends its working directory and
+ * arguments, along with its stdin, stdout and stderr, so the child behaves
+ * exactly as though it had been run by the client directly. The server
+ * sends the child's exit status back once it's finished.
+ *
+ * A job is a 32-bit length followed by that many bytes of NUL-terminated
+ * strings: the working directory and then the arguments. The descriptors
+ * come with the first byte. The reply is the 32-bit exit status.
+ *
+ * Editing sessions (see the ncurses frontend) use the same socket code and
+ * the same request, with the arguments being "attach" and $TERM. */
+
+#if !defined WIN32
+
+static const uint32_t MAXJOBSIZE = 1024 * 1024;
+
+/* The whole of a request must arrive within this, so that a client which
+ * stops sending can't hold anything up for long. */
+static const int JOBTIMEOUT = 10; /* seconds */
+
+typedef std::chrono::steady_clock::time_point Deadline;
+
+static int childpipe[2] = {-1, -1};
+
+static void sigchld(int)
+{
+    int e = errno;
+    char c = 0;
+    (void)!write(childpipe[1], &c, 1);
+    errno = e;
+}
+
+static bool readall(int fd, void* buffer, size_t len)
+{
+    char* p = (char*)buffer;
+    while (len)
+    {
+        ssize_t n = read(fd, p, len);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        if (n == 0)
+            return false;
+        p += n;
+        len -= n;
+    }
+    return true;
+}
+
+/* Waits until there's something to read from fd, or the deadline passes. */
+
+static bool waitforinput(int fd, Deadline deadline)
+{
+    for (;;)
+    {
+        auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now())
+                        .count();
+        if (left <= 0)
+            return false;
+
+        pollfd p = {fd, POLLIN, 0};
+        int n = poll(&p, 1, left);
+        if (n > 0)
+            return true;
+        if ((n < 0) && (errno != EINTR))
+            return false;
+    }
+}
+
+/* Like readall(), but gives up at the deadline. */
+
+static bool readallby(int fd, void* buffer, size_t len, Deadline deadline)
+{
+    char* p = (char*)buffer;
+    while (len)
+    {
+        if (!waitforinput(fd, deadline))
+            return false;
+        ssize_t n = read(fd, p, len);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        if (n == 0)
+            return false;
+        p += n;
+        len -= n;
+    }
+    return true;
+}
+
+static bool writeall(int fd, const void* buffer, size_t len)
+{
+    const char* p = (const char*)buffer;
+    while (len)
+    {
+        ssize_t n = write(fd, p, len);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        p += n;
+        len -= n;
+    }
+    return true;
+}
+
+static bool socketaddress(const char* path, sockaddr_un& addr)
+{
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(addr.sun_path))
+    {
+        errno = ENAMETOOLONG;
+        return false;
+    }
+    strcpy(addr.sun_path, path);
+    return true;
+}
+
+struct ServerJob
+{
+    std::vector<std::string> strings; /* the directory, then the arguments */
+    int fds[3] = {-1, -1, -1};
+
+    ~ServerJob()
+    {
+        for (int fd : fds)
+            if (fd != -1)
+                close(fd);
+    }
+};
+
+/* Reads a request from a newly accepted connection, returning the strings
+ * and the three descriptors which came with it. If it fails (or doesn't
+ * all arrive within JOBTIMEOUT), any descriptors received are closed
+ * again. */
+
+static bool readrequest(int conn, std::vector<std::string>& strings, int* fds)
+{
+    Deadline deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(JOBTIMEOUT);
+    if (!waitforinput(conn, deadline))
+        return false;
+
+    uint32_t len;
+    char control[CMSG_SPACE(3 * sizeof(int))];
+    iovec iov = {&len, sizeof(len)};
+    msghdr msg = {};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    ssize_t n;
+    do
+        n = recvmsg(conn, &msg, 0);
+    while ((n < 0) && (errno == EINTR));
+    if (n <= 0)
+        return false;
+
+    for (cmsghdr* c = CMSG_FIRSTHDR(&msg); c; c = CMSG_NXTHDR(&msg, c))
+    {
+        if ((c->cmsg_level == SOL_SOCKET) && (c->cmsg_type == SCM_RIGHTS) &&
+            (c->cmsg_len == CMSG_LEN(3 * sizeof(int))))
+            memcpy(fds, CMSG_DATA(c), 3 * sizeof(int));
+    }
+    if ((fds[0] == -1) || (fds[1] == -1) || (fds[2] == -1))
+        return false;
+
+    if ((n < (ssize_t)sizeof(len)) &&
+        !readallby(conn, (char*)&len + n, sizeof(len) - n, deadline))
+        return false;
+    if (len > MAXJOBSIZE)
+        return false;
+
+    std::string data(len, '\0');
+    if (!readallby(conn, data.data(), len, deadline) || data.empty() ||
+        data.back())
+        return false;
+
+    size_t i = 0;
+    while (i < data.size())
+    {
+        size_t end = data.find('\0', i);
+        strings.emplace_back(data, i, end - i);
+        i = end + 1;
+    }
+    return true;
+}
+
+bool receiverequest(int conn, std::vector<std::string>& strings, int* fds)
+{
+    fds[0] = fds[1] = fds[2] = -1;
+    if (readrequest(conn, strings, fds))
+        return true;
+
+    for (int i = 0; i < 3; i++)
+        if (fds[i] != -1)
+            close(fds[i]);
+    return false;
+}
+
+void sendstatus(int conn, int32_t status)
+{
+    writeall(conn, &status, sizeof(status));
+    close(conn);
+}
+
+/* Sends the exit status of every finished child back to its client. */
+
+static void reapchildren(std::map<pid_t, int>& running)
+{
+    char buffer[64];
+    while (read(childpipe[0], buffer, sizeof(buffer)) > 0)
+        ;
+
+    for (;;)
+    {
+        int status;
+        pid_t pid = waitpid(-1, &status, WNOHANG);
+        if (pid <= 0)
+            break;
+
+        auto i = running.find(pid);
+        if (i == running.end())
+            continue;
+        int32_t result = 1;
+        if (WIFEXITED(status))
+            result = WEXITSTATUS(status);
+        else if (WIFSIGNALED(status))
+            result = 128 + WTERMSIG(status);
+        sendstatus(i->second, result);
+        running.erase(i);
+    }
+}
+
+/* In the child: becomes the client's process, as near as possible. */
+
+static void becomejob(ServerJob& job)
+{
+    for (int i = 0; i < 3; i++)
+    {
+        dup2(job.fds[i], i);
+        close(job.fds[i]);
+        job.fds[i] = -1;
+    }
+    if (chdir(job.strings[0].c_str()) != 0)
+    {
+        fprintf(stderr,
+            "wordgrinder: cannot change to %s: %s\n",
+            job.strings[0].c_str(),
+            strerror(errno));
+        _exit(1);
+    }
+    workers_afterfork();
+}
+
+/* Creates the listening socket. Something already at path is only replaced
+ * if it's a socket left behind by a server or session which has gone away;
+ * anything else (most likely a document, given as the socket by mistake)
+ * is left alone, and this fails with EEXIST. Whoever connects gets to do
+ * anything this process can, so the socket is only usable by its owner
+ * (and see ispeerowner()). */
+
+int listenonsocket(const char* path)
+{
+    sockaddr_un addr;
+    if (!socketaddress(path, addr))
+        return -1;
+
+    struct stat st;
+    if (lstat(path, &st) == 0)
+    {
+        if (!S_ISSOCK(st.st_mode) || issocketlive(path))
+        {
+            errno = EEXIST;
+            return -1;
+        }
+        unlink(path);
+    }
+
+    int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener == -1)
+        return -1;
+    mode_t mask = umask(077);
+    int r = bind(listener, (sockaddr*)&addr, sizeof(addr));
+    umask(mask);
+    if ((r != 0) || (chmod(path, 0600) != 0) ||
+        (listen(listener, SOMAXCONN) != 0))
+    {
+        int e = errno;
+        close(listener);
+        errno = e;
+        return -1;
+    }
+    fcntl(listener, F_SETFD, FD_CLOEXEC);
+    return listener;
+}
+
+/* Checks that a connection comes from a process run by the same user as
+ * this one. The socket's permissions should already ensure this, but they
+ * don't hold everywhere (and a directory above it might be shared). */
+
+bool ispeerowner(int conn)
+{
+#if defined __linux__
+    ucred cred;
+    socklen_t len = sizeof(cred);
+    if (getsockopt(conn, SOL_SOCKET, SO_PEERCRED, &cred, &len) != 0)
+        return false;
+    return cred.uid == geteuid();
+#else
+    uid_t uid;
+    gid_t gid;
+    if (getpeereid(conn, &uid, &gid) != 0)
+        return false;
+    return uid == geteuid();
+#endif
+}
+
+/* wg.serve(socket) listens for jobs forever; it returns only in the child
+ * processes, each with a table of its job's arguments. If the server can't
+ * be started it returns nil and an error.
+ *
+ * Each connection is forked off as soon as it's accepted, and its request
+ * is read in the child: so a client which is slow to send its request only
+ * holds up its own job, and the server goes straight back to accepting
+ * connections and reporting on finished children. */
+
+static int serve_cb(lua_State* L)
+{
+    const char* path = luaL_checkstring(L, 1);
+
+    int listener = listenonsocket(path);
+    if ((listener == -1) || (pipe(childpipe) != 0))
+    {
+        lua_pushnil(L);
+        lua_pushstring(L, strerror(errno));
+        return 2;
+    }
+    fcntl(childpipe[0], F_SETFL, O_NONBLOCK);
+    fcntl(childpipe[1], F_SETFL, O_NONBLOCK);
+
+    struct sigaction sa = {};
+    sa.sa_handler = sigchld;
+    sa.sa_flags = SA_RESTART | SA_NOCLDSTOP;
+    sigaction(SIGCHLD, &sa, nullptr);
+    signal(SIGPIPE, SIG_IGN);
+
+    std::map<pid_t, int> running;
+    for (;;)
+    {
+        pollfd fds[2] = {
+            {listener,     POLLIN, 0},
+            {childpipe[0], POLLIN, 0}
+        };
+        if (poll(fds, 2, -1) < 0)
+            continue;
+        if (fds[1].revents)
+            reapchildren(running);
+        if (!fds[0].revents)
+            continue;
+
+        int conn = accept(listener, nullptr, nullptr);
+        if (conn == -1)
+            continue;
+
+        /* Don't let anything buffered be written twice. */
+        fflush(nullptr);
+        pid_t pid = fork();
+        if (pid == 0)
+        {
+            signal(SIGCHLD, SIG_DFL);
+            signal(SIGPIPE, SIG_DFL);
+            close(listener);
+            close(childpipe[0]);
+            close(childpipe[1]);
+            for (auto& i : running)
+                close(i.second);
+
+            /* The server sends the client a failure once this exits. */
+            ServerJob job;
+            if (!ispeerowner(conn) ||
+                !receiverequest(conn, job.strings, job.fds))
+                _exit(1);
+            close(conn);
+            becomejob(job);
+
+            lua_createtable(L, job.strings.size() - 1, 0);
+            for (size_t i = 1; i < job.strings.size(); i++)
+            {
+                const std::string& s = job.strings[i];
+                lua_pushlstring(L, s.data(), s.size());
+                lua_rawseti(L, -2, i);
+            }
+            return 1;
+        }
+
+        if (pid == -1)
+            sendstatus(conn, 1);
+        else
+            running[pid] = conn;
+    }
+}
+
+/* Connects to the server at path and sends it a request, along with this
+ * process's stdin, stdout and stderr; returns the connection, or -1. */
+
+static int sendrequest(const char* path, const std::vector<std::string>& args)
+{
+    std::string data;
+    {
+        std::vector<char> cwd(PATH_MAX);
+        if (!getcwd(cwd.data(), cwd.size()))
+        {
+            perror("wordgrinder: cannot get the current directory");
+            return -1;
+        }
+        data += cwd.data();
+        data += '\0';
+    }
+    for (const auto& arg : args)
+    {
+        data += arg;
+        data += '\0';
+    }
+
+    sockaddr_un addr;
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (!socketaddress(path, addr) || (fd == -1) ||
+        (connect(fd, (sockaddr*)&addr, sizeof(addr)) != 0))
+    {
+        fprintf(stderr,
+            "wordgrinder: cannot connect to %s: %s\n",
+            path,
+            strerror(errno));
+        if (fd != -1)
+            close(fd);
+        return -1;
+    }
+    signal(SIGPIPE, SIG_IGN);
+
+    uint32_t len = data.size();
+    int fds[3] = {0, 1, 2};
+    char control[CMSG_SPACE(sizeof(fds))] = {};
+    iovec iov = {&len, sizeof(len)};
+    msghdr msg = {};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    cmsghdr* c = CMSG_FIRSTHDR(&msg);
+    c->cmsg_level = SOL_SOCKET;
+    c->cmsg_type = SCM_RIGHTS;
+    c->cmsg_len = CMSG_LEN(sizeof(fds));
+    memcpy(CMSG_DATA(c), fds, sizeof(fds));
+
+    if ((sendmsg(fd, &msg, 0) != sizeof(len)) ||
+        !writeall(fd, data.data(), data.size()))
+    {
+        fprintf(stderr, "wordgrinder: the server at %s failed\n", path);
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+int submitjob(const char* path, int argc, char* const* argv)
+{
+    int fd = sendrequest(path, std::vector<std::string>(argv, argv + argc));
+    if (fd == -1)
+        return 1;
+
+    int32_t status;
+    if (!readall(fd, &status, sizeof(status)))
+    {
+        fprintf(stderr, "wordgrinder: the server at %s failed\n", path);
+        return 1;
+    }
+    close(fd);
+    return status;
+}
+
+bool issocketlive(const char* path)
+{
+    sockaddr_un addr;
+    if (!socketaddress(path, addr))
+        return false;
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd == -1)
+        return false;
+    bool live = connect(fd, (sockaddr*)&addr, sizeof(addr)) == 0;
+    close(fd);
+    return live;
+}
+
+static int winchpipe[2] = {-1, -1};
+
+static void sigwinch(int)
+{
+    int e = errno;
+    char c = 0;
+    (void)!write(winchpipe[1], &c, 1);
+    errno = e;
+}
+
+/* The client for an editing session: hands this process's terminal over to
+ * the session, which draws on it directly, and then just tells the session
+ * whenever the terminal changes size until it's detached (in which case
+ * the session sends a status) or the session ends (when it just goes
+ * away). */
+
+int attachsession(const char* path)
+{
+    const char* term = getenv("TERM");
+    if (!isatty(STDIN_FILENO) || !isatty(STDOUT_FILENO) || !term)
+    {
+        fprintf(stderr, "wordgrinder: sessions need a terminal\n");
+        return 1;
+    }
+
+    /* If the session dies, the terminal mustn't be left in raw mode. */
+    termios saved;
+    tcgetattr(STDIN_FILENO, &saved);
+
+    if (pipe(winchpipe) != 0)
+        return 1;
+    struct sigaction sa = {};
+    sa.sa_handler = sigwinch;
+    sa.sa_flags = SA_RESTART;
+    sigaction(SIGWINCH, &sa, nullptr);
+
+    int fd = sendrequest(path, {"attach", term});
+    if (fd == -1)
+        return 1;
+
+    bool detached = false;
+    for (;;)
+    {
+        pollfd fds[2] = {
+            {fd,           POLLIN, 0},
+            {winchpipe[0], POLLIN, 0}
+        };
+        if (poll(fds, 2, -1) < 0)
+            continue;
+
+        if (fds[1].revents)
+        {
+            char c;
+            (void)!read(winchpipe[0], &c, 1);
+            writeall(fd, &c, 1);
+        }
+        if (fds[0].revents)
+        {
+            int32_t status;
+            detached = readall(fd, &status, sizeof(status));
+            break;
+        }
+    }
+    close(fd);
+
+    tcsetattr(STDIN_FILENO, TCSANOW, &saved);
+    if (detached)
+        fprintf(stderr, "wordgrinder: detached from %s\n", path);
+    return 0;
+}
+
+#else
+
+static int serve_cb(lua_State* L)
+{
+    lua_pushnil(L);
+    lua_pushstring(L, "not supported on this platform");
+    return 2;
+}
+
+#endif
+
+void server_init(void)
+{
+    const static luaL_Reg funcs[] = {
+        {"serve", serve_cb},
+        {NULL,    NULL    }
+    };
+
+    luaL_register(L, "wg", funcs);
+    lua_pop(L, 1);
+}
+
+// vim: sw=4 ts=4 et
@@ -5,152 +5,10 @@
 
 #include "globals.h"
 #include <sys/time.h>
+#include <string.h>
 #include <vector>
 
-int getu8bytes(char c)
-{
-    uint8_t cc = c;
-    if (cc < 0x80)
-        return 1;
-    else if (cc < 0xc0)
-        return 0;
-    else if (cc < 0xe0)
-        return 2;
-    else if (cc < 0xf0)
-        return 3;
-    else if (cc < 0xf8)
-        return 4;
-    else if (cc < 0xfc)
-        return 5;
-    return 6;
-}
-
-uni_t readu8(const char** srcp)
-{
-    const uint8_t* src = (const uint8_t*)*srcp;
-
-    uni_t c = *src++;
-    if (c < 0x80)
-    {
-        /* Do nothing! */
-        goto zero;
-    }
-    else if (c < 0xc0)
-    {
-        /* Invalid character */
-        c = -1;
-        goto zero;
-    }
-    else if (c < 0xe0)
-    {
-        /* One trailing byte */
-        c &= 0x1f;
-        goto one;
-    }
-    else if (c < 0xf0)
-    {
-        /* Two trailing bytes */
-        c &= 0x0f;
-        goto two;
-    }
-    else if (c < 0xf8)
-    {
-        /* Three trailing bytes */
-        c &= 0x07;
-        goto three;
-    }
-    else if (c < 0xfc)
-    {
-        /* Four trailing bytes */
-        c &= 0x03;
-        goto four;
-    }
-    else
-    {
-        /* Five trailing bytes */
-        c &= 0x01;
-        goto five;
-    }
-
-    uint8_t d;
-five:
-    d = *src;
-    src += (d != 0);
-    c <<= 6;
-    c += d & 0x3f;
-four:
-    d = *src;
-    src += (d != 0);
-    c <<= 6;
-    c += d & 0x3f;
-three:
-    d = *src;
-    src += (d != 0);
-    c <<= 6;
-    c += d & 0x3f;
-two:
-    d = *src;
-    src += (d != 0);
-    c <<= 6;
-    c += d & 0x3f;
-one:
-    d = *src;
-    src += (d != 0);
-    c <<= 6;
-    c += d & 0x3f;
-zero:
-    *srcp = (const char*)src;
-    return c;
-}
-
-void writeu8(char** destp, uni_t ch)
-{
-    char* dest = *destp;
-
-    if (ch < 0)
-        assert(false);
-    else if (ch < 0x80)
-    {
-        *dest++ = (char)ch;
-    }
-    else if (ch < 0x800)
-    {
-        *dest++ = (ch >> 6) | 0xC0;
-        *dest++ = (ch & 0x3F) | 0x80;
-    }
-    else if (ch < 0x10000)
-    {
-        *dest++ = (ch >> 12) | 0xE0;
-        *dest++ = ((ch >> 6) & 0x3F) | 0x80;
-        *dest++ = (ch & 0x3F) | 0x80;
-    }
-    else if (ch < 0x200000)
-    {
-        *dest++ = (ch >> 18) | 0xF0;
-        *dest++ = ((ch >> 12) & 0x3F) | 0x80;
-        *dest++ = ((ch >> 6) & 0x3F) | 0x80;
-        *dest++ = (ch & 0x3F) | 0x80;
-    }
-    else if (ch < 0x4000000)
-    {
-        *dest++ = (ch >> 24) | 0xF8;
-        *dest++ = ((ch >> 18) & 0x3F) | 0x80;
-        *dest++ = ((ch >> 12) & 0x3F) | 0x80;
-        *dest++ = ((ch >> 6) & 0x3F) | 0x80;
-        *dest++ = (ch & 0x3F) | 0x80;
-    }
-    else if (ch <= 0x7fffffff)
-    {
-        *dest++ = (ch >> 30) | 0xFC;
-        *dest++ = ((ch >> 24) & 0x3F) | 0x80;
-        *dest++ = ((ch >> 18) & 0x3F) | 0x80;
-        *dest++ = ((ch >> 12) & 0x3F) | 0x80;
-        *dest++ = ((ch >> 6) & 0x3F) | 0x80;
-        *dest++ = (ch & 0x3F) | 0x80;
-    }
-
-    *destp = dest;
-}
+/* The primitives themselves are in core/text.cc. */
 
 static int readu8_cb(lua_State* L)
 {
@@ -179,28 +37,23 @@ static int writeu8_cb(lua_State* L)
     return 1;
 }
 
+/* Nearly everything is already valid, and is returned as it is. */
+
 static int transcode_cb(lua_State* L)
 {
-    size_t inputbuffersize;
-    const char* inputbuffer = luaL_checklstring(L, 1, &inputbuffersize);
-
-    size_t outputbuffersize = inputbuffersize * 2 + 32;
-    std::vector<char> outputbuffer(
-        outputbuffersize); /* should fit everything */
-
-    const char* in = (char*)inputbuffer;
-    const char* inend = inputbuffer + inputbuffersize;
-
-    char* out = &outputbuffer[0];
-    // char* outend = outputbuffer + outputbuffersize - 4;
-
-    while (in < inend)
+    size_t len;
+    const char* s = luaL_checklstring(L, 1, &len);
+    size_t i = validu8span(s, len);
+    if (i == len)
     {
-        int c = readu8(&in);
-        writeu8(&out, c);
+        lua_settop(L, 1);
+        return 1;
     }
 
-    lua_pushlstring(L, &outputbuffer[0], out - &outputbuffer[0]);
+    std::string out(s, i);
+    out.reserve(len);
+    appendvalidu8(out, std::string_view(s + i, len - i));
+    lua_pushlstring(L, out.data(), out.size());
     return 1;
 }
 
@@ -215,101 +68,319 @@ static int time_cb(lua_State* L)
     return 1;
 }
 
+/* The escapers return the original string when there's nothing to do. */
+
 static int escape_cb(lua_State* L)
 {
-    size_t inputbuffersize;
-    const char* inputbuffer = luaL_checklstring(L, 1, &inputbuffersize);
+    size_t len;
+    const char* s = luaL_checklstring(L, 1, &len);
+
+    size_t i = escapedspan(s, len);
+    if (i == len)
+    {
+        lua_settop(L, 1);
+        return 1;
+    }
+
+    std::string out(s, i);
+    out.reserve(len + 16);
+    escapestring(out, s + i, len - i);
+    lua_pushlstring(L, out.data(), out.size());
+    return 1;
+}
+
+static int unescape_cb(lua_State* L)
+{
+    size_t len;
+    const char* s = luaL_checklstring(L, 1, &len);
 
-    const size_t outputbuffersize = inputbuffersize * 2; /* big enough to fit */
-    std::vector<char> outputbuffer(outputbuffersize);
+    size_t i = unescapedspan(s, len);
+    if (i == len)
+    {
+        lua_settop(L, 1);
+        return 1;
+    }
 
-    const char* in = (char*)inputbuffer;
-    const char* inend = inputbuffer + inputbuffersize;
+    std::string out(s, i);
+    unescapestring(out, s + i, len - i);
+    lua_pushlstring(L, out.data(), out.size());
+    return 1;
+}
+
+/* Appends s to dest with &, < and > turned into entities. If space is
+ * given then whitespace is replaced with that too (for OpenDocument, where
+ * every space must be explicit). */
 
-    char* out = &outputbuffer[0];
+static const char HTMLSPECIALS[] = "&<>";
+static const char HTMLSPACESPECIALS[] = "&<> \t\n\r\f\v";
 
-    while (in < inend)
+void escapehtml(
+    std::string& dest, const char* src, size_t len, const char* space)
+{
+    std::string_view specials = space ? HTMLSPACESPECIALS : HTMLSPECIALS;
+    size_t i = 0;
+    while (i < len)
     {
-        int c = readu8(&in);
-        switch (c)
+        size_t n = plainspan(src + i, len - i, specials, false);
+        dest.append(src + i, n);
+        i += n;
+        if (i == len)
+            break;
+
+        switch (src[i++])
         {
-            case '\n':
-                writeu8(&out, '\\');
-                writeu8(&out, 'n');
+            case '&':
+                dest += "&amp;";
                 break;
 
-            case '\r':
-                writeu8(&out, '\\');
-                writeu8(&out, 'r');
+            case '<':
+                dest += "&lt;";
+                break;
+
+            case '>':
+                dest += "&gt;";
                 break;
 
-            case '"':
-            case '\\':
-                writeu8(&out, '\\');
-                /* fall through */
             default:
-                writeu8(&out, c);
+                dest += space;
         }
     }
-
-    lua_pushlstring(L, &outputbuffer[0], out - &outputbuffer[0]);
-    return 1;
 }
 
-static int unescape_cb(lua_State* L)
+/* Like the others, these return the original string when there's nothing
+ * to escape, which is nearly always, so the common case allocates nothing. */
+
+static int escapehtml_cb(lua_State* L)
 {
-    size_t inputbuffersize;
-    const char* inputbuffer = luaL_checklstring(L, 1, &inputbuffersize);
+    size_t len;
+    const char* s = luaL_checklstring(L, 1, &len);
+    const char* space = luaL_optstring(L, 2, nullptr);
 
-    const size_t outputbuffersize = inputbuffersize; /* big enough to fit */
-    std::vector<char> outputbuffer(outputbuffersize);
+    if (plainspan(s, len, space ? HTMLSPACESPECIALS : HTMLSPECIALS, false) ==
+        len)
+    {
+        lua_settop(L, 1);
+        return 1;
+    }
 
-    const char* in = (char*)inputbuffer;
-    const char* inend = inputbuffer + inputbuffersize;
+    std::string out;
+    out.reserve(len + 16);
+    escapehtml(out, s, len, space);
+    lua_pushlstring(L, out.data(), out.size());
+    return 1;
+}
 
-    char* out = &outputbuffer[0];
+static int escapelatex_cb(lua_State* L)
+{
+    static const char specials[] = "#$&{}_^~%<>\\";
+
+    size_t len;
+    const char* s = luaL_checklstring(L, 1, &len);
+    size_t i = plainspan(s, len, specials, false);
+    if (i == len)
+    {
+        lua_settop(L, 1);
+        return 1;
+    }
 
-    while (in < inend)
+    std::string out(s, i);
+    out.reserve(len + 16);
+    while (i < len)
     {
-        int c = readu8(&in);
+        char c = s[i++];
         switch (c)
         {
+            case '_':
+            case '^':
+            case '~':
+                out += '\\';
+                out += c;
+                out += "{}";
+                break;
+
+            case '<':
+                out += "$\\langle$";
+                break;
+
+            case '>':
+                out += "$\\rangle$";
+                break;
+
             case '\\':
-                c = readu8(&in);
-                switch (c)
-                {
-                    case 'n':
-                        writeu8(&out, '\n');
-                        break;
-
-                    case 'r':
-                        writeu8(&out, '\r');
-                        break;
-
-                    default:
-                        writeu8(&out, c);
-                }
+                out += "$\\backslash$";
                 break;
 
             default:
-                writeu8(&out, c);
+                out += '\\';
+                out += c;
+        }
+
+        size_t n = plainspan(s + i, len - i, specials, false);
+        out.append(s + i, n);
+        i += n;
+    }
+
+    lua_pushlstring(L, out.data(), out.size());
+    return 1;
+}
+
+/* Backslashes are doubled and anything outside ASCII becomes a \[uXXXX]
+ * escape. In embedded text (inside a quoted macro argument) a double quote
+ * becomes \\" --- the troff exporter has always escaped the quote before
+ * doubling the backslashes. Invalid UTF-8 is dropped. */
+
+static int escapetroff_cb(lua_State* L)
+{
+    size_t len;
+    const char* s = luaL_checklstring(L, 1, &len);
+    bool embedded = lua_toboolean(L, 2);
+    std::string_view specials = embedded ? "\\\"\x7f" : "\\\x7f";
+
+    size_t i = plainspan(s, len, specials, true);
+    if (i == len)
+    {
+        lua_settop(L, 1);
+        return 1;
+    }
+
+    std::string out(s, i);
+    out.reserve(len + 16);
+    const char* p = s + i;
+    const char* end = s + len;
+    while (p < end)
+    {
+        if (*p == '\\')
+        {
+            out += "\\\\";
+            p++;
+        }
+        else if (*p == '"')
+        {
+            out += embedded ? "\\\\\"" : "\"";
+            p++;
+        }
+        else
+        {
+            uni_t c = readu8(&p);
+            if (c >= 0)
+            {
+                char buffer[16];
+                snprintf(buffer, sizeof(buffer), "\\[u%04X]", c);
+                out += buffer;
+            }
+        }
+
+        size_t n = plainspan(p, end - p, specials, true);
+        out.append(p, n);
+        p += n;
+    }
+
+    lua_pushlstring(L, out.data(), out.size());
+    return 1;
+}
+
+/* Splits a string at every occurrence of any of the single-byte delimiters,
+ * keeping empty fields, as SplitString() does. The fields are counted first
+ * so the result can be created at the right size. */
+
+static int splitstring_cb(lua_State* L)
+{
+    size_t len;
+    const char* s = luaL_checklstring(L, 1, &len);
+    size_t dlen;
+    const char* delims = luaL_checklstring(L, 2, &dlen);
+
+    bool isdelim[256] = {};
+    for (size_t i = 0; i < dlen; i++)
+        isdelim[(uint8_t)delims[i]] = true;
+
+    const char* end = s + len;
+    int count = 1;
+    for (const char* p = s; p != end; p++)
+        count += isdelim[(uint8_t)*p];
+
+    lua_createtable(L, count, 0);
+    int n = 0;
+    const char* start = s;
+    for (const char* p = s; p != end; p++)
+    {
+        if (isdelim[(uint8_t)*p])
+        {
+            lua_pushlstring(L, start, p - start);
+            lua_rawseti(L, -2, ++n);
+            start = p + 1;
         }
     }
+    lua_pushlstring(L, start, end - start);
+    lua_rawseti(L, -2, ++n);
+    return 1;
+}
+
+/* Splits a string into words at runs of whitespace, as
+ * ParseStringIntoWords() does: a string with no words gives a single empty
+ * one. */
+
+static int splitwords_cb(lua_State* L)
+{
+    size_t len;
+    const char* s = luaL_checklstring(L, 1, &len);
+    const char* end = s + len;
 
-    lua_pushlstring(L, &outputbuffer[0], out - &outputbuffer[0]);
+    auto isspace = [](char c)
+    {
+        return (c == ' ') || (c == '\t') || (c == '\r') || (c == '\n');
+    };
+
+    int count = 0;
+    bool inword = false;
+    for (const char* p = s; p != end; p++)
+    {
+        bool space = isspace(*p);
+        count += !space && !inword;
+        inword = !space;
+    }
+
+    if (count == 0)
+    {
+        lua_createtable(L, 1, 0);
+        lua_pushliteral(L, "");
+        lua_rawseti(L, -2, 1);
+        return 1;
+    }
+
+    lua_createtable(L, count, 0);
+    int n = 0;
+    const char* p = s;
+    for (;;)
+    {
+        while ((p != end) && isspace(*p))
+            p++;
+        if (p == end)
+            break;
+        const char* start = p;
+        while ((p != end) && !isspace(*p))
+            p++;
+        lua_pushlstring(L, start, p - start);
+        lua_rawseti(L, -2, ++n);
+    }
     return 1;
 }
 
 void utils_init(void)
 {
     const static luaL_Reg funcs[] = {
-        {"readu8",    readu8_cb   },
-        {"writeu8",   writeu8_cb  },
-        {"transcode", transcode_cb},
-        {"time",      time_cb     },
-        {"escape",    escape_cb   },
-        {"unescape",  unescape_cb },
-        {NULL,        NULL        }
+        {"readu8",      readu8_cb     },
+        {"writeu8",     writeu8_cb    },
+        {"transcode",   transcode_cb  },
+        {"time",        time_cb       },
+        {"escape",      escape_cb     },
+        {"unescape",    unescape_cb   },
+        {"escapehtml",  escapehtml_cb },
+        {"escapelatex", escapelatex_cb},
+        {"escapetroff", escapetroff_cb},
+        {"splitstring", splitstring_cb},
+        {"splitwords",  splitwords_cb },
+        {NULL,          NULL          }
     };
 
     luaL_register(L, "wg", funcs);
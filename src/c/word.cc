@@ -5,6 +5,8 @@
 
 #include "globals.h"
 #include <ctype.h>
+#include <string.h>
+#include <unordered_map>
 
 /* A 'word' is a string with embedded text style codes.
  *
@@ -16,12 +18,6 @@
  * constants, with STYLE_MARKER set to prevent nil characters.
  */
 
-enum
-{
-    STYLE_MARKER = (1 << 4), /* always set */
-    STYLE_ALL = 15
-};
-
 #define OVERHEAD (3 * 2 + 1)
 
 static bool iscontrolbyte(int c)
@@ -29,78 +25,116 @@ static bool iscontrolbyte(int c)
     return (c >= 0) && (c <= 31);
 }
 
+/* --- Word metrics cache ------------------------------------------------ */
+
+/* Words never change once created, but their widths, plain text and style
+ * runs get recomputed over and over by the wrapper, the exporters, and
+ * anything which searches. So we work them out once per distinct word and
+ * keep them here. The cache is keyed on the word's contents (Lua strings can
+ * be collected and their addresses reused) and is simply emptied when it
+ * gets too big. */
+
+static const size_t MAXCACHEDWORDS = 1 << 17;
+
+struct CachedWord
+{
+    std::string word;
+    WordMetrics metrics;
+};
+
+static std::unordered_map<std::string_view, std::unique_ptr<CachedWord>>
+    wordcache;
+
+/* (The metrics themselves are worked out by computewordmetrics(), in
+ * core/words.cc.) */
+
+const WordMetrics& getwordmetrics(const char* s, size_t size)
+{
+    auto i = wordcache.find(std::string_view(s, size));
+    if (i != wordcache.end())
+        return i->second->metrics;
+
+    if (wordcache.size() >= MAXCACHEDWORDS)
+        wordcache.clear();
+
+    auto cw = std::make_unique<CachedWord>();
+    cw->word.assign(s, size);
+    computewordmetrics(s, size, cw->metrics);
+    const WordMetrics& m = cw->metrics;
+    std::string_view key = cw->word;
+    wordcache.emplace(key, std::move(cw));
+    return m;
+}
+
 /* Parse a styled word. */
 
 static int parseword_cb(lua_State* L)
 {
     size_t size;
     const char* s = luaL_checklstring(L, 1, &size);
-    const char* send = s + size;
     int dstyle = forceinteger(L, 2);
     /* pos 3 contains the callback function */
 
-    int oldattr = 0;
-    int attr = 0;
-    const char* w = s;
-    const char* wend = NULL;
-    bool flush = false;
-
-    for (;;)
+    /* Copy the runs, as the callback may cause the cache to be flushed. */
+    std::vector<WordMetrics::Run> runs = getwordmetrics(s, size).runs;
+    for (const auto& run : runs)
     {
-        if (flush)
-        {
-            if (w != wend)
-            {
-                lua_pushvalue(L, 3);
-                lua_pushnumber(L, oldattr | dstyle);
-                lua_pushlstring(L, w, wend - w);
-                lua_call(L, 2, 0);
-            }
-            w = s;
-            oldattr = attr;
-            flush = false;
-        }
+        lua_pushvalue(L, 3);
+        lua_pushnumber(L, run.attr | dstyle);
+        lua_pushlstring(L, s + run.offset, run.length);
+        lua_call(L, 2, 0);
+    }
 
-        if (s == send)
-        {
-            if (w == s)
-                break;
+    return 0;
+}
 
-            flush = true;
-        }
-        else
+/* Parses every word of a paragraph in one go, returning a flat array of
+ * (style, text) pairs with the longest runs of the same style there are,
+ * spaces included (see StyleRuns). This saves the exporters a round trip
+ * through parseword() for every word, and the turning of styles off and on
+ * again between words in the same style. */
+
+static int parseparagraph_cb(lua_State* L)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+    luaL_checkstack(L, 2, "out of memory");
+
+    StyleRuns sr;
+    foreachparagraphword(L,
+        1,
+        [&](const char* w, size_t len)
         {
-            uni_t c = readu8(&s);
+            sr.addword(w, getwordmetrics(w, len));
+        });
 
-            if (iswcntrl(c))
-            {
-                oldattr = attr;
-                attr = c & STYLE_ALL;
-                flush = true;
-                wend = s - 1;
-            }
-            else
-                wend = s;
-        }
+    lua_createtable(L, sr.runs.size() * 2, 0);
+    int n = 0;
+    for (const auto& run : sr.runs)
+    {
+        lua_pushnumber(L, run.style);
+        lua_rawseti(L, -2, ++n);
+        lua_pushlstring(L, sr.text.data() + run.offset, run.length);
+        lua_rawseti(L, -2, ++n);
     }
-
-    return 0;
+    return 1;
 }
 
 /* Draw a styled word at a particular location. */
 
-static int writestyled_cb(lua_State* L)
+/* Draws a single word, starting in style oattr (the style the previous word
+ * finished in). revon and revoff are the byte offsets in the word where
+ * highlighting starts and stops; sor is the paragraph's own style, ORed into
+ * everything. Returns the style the word finishes in. */
+
+static int writestyled(int x,
+    int y,
+    const char* s,
+    const char* send,
+    int oattr,
+    const char* revon,
+    const char* revoff,
+    int sor)
 {
-    int x = forceinteger(L, 1);
-    int y = forceinteger(L, 2);
-    size_t size;
-    const char* s = luaL_checklstring(L, 3, &size);
-    const char* send = s + size;
-    int oattr = forceinteger(L, 4);
-    const char* revon = s + forceinteger(L, 5) - 1;
-    const char* revoff = s + forceinteger(L, 6) - 1;
-    int sor = forceinteger(L, 7);
-
     int attr = sor;
     int mark = 0;
 
@@ -140,30 +174,126 @@ static int writestyled_cb(lua_State* L)
     }
     dpy_setattr(0, 0);
 
-    lua_pushnumber(L, attr | mark);
-    return 1;
+    return attr | mark;
 }
 
-/* Returns the raw text of a word, with no styling. */
+static int writestyled_cb(lua_State* L)
+{
+    int x = forceinteger(L, 1);
+    int y = forceinteger(L, 2);
+    size_t size;
+    const char* s = luaL_checklstring(L, 3, &size);
+    int oattr = forceinteger(L, 4);
+    const char* revon = s + forceinteger(L, 5) - 1;
+    const char* revoff = s + forceinteger(L, 6) - 1;
+    int sor = forceinteger(L, 7);
 
-static int getwordtext_cb(lua_State* L)
+    lua_pushnumber(L, writestyled(x, y, s, s + size, oattr, revon, revoff, sor));
+    return 1;
+}
+
+static int getinteger(lua_State* L, int table, int index)
 {
-    size_t bytes;
-    const char* src = luaL_checklstring(L, 1, &bytes);
-    char dest[bytes + 1];
-    char* p = dest;
+    if (lua_isnoneornil(L, table))
+        return 0;
+    lua_rawgeti(L, table, index);
+    int value = forceinteger(L, -1);
+    lua_pop(L, 1);
+    return value;
+}
 
-    for (;;)
+/* Draws a whole line of words in one go: the same as calling writestyled on
+ * each word in turn, threading the finishing style of each into the next.
+ * The arguments are y, then parallel arrays of x positions, words and
+ * paragraph styles, and optionally of highlight start and stop offsets. */
+
+static int writestyledline_cb(lua_State* L)
+{
+    int y = forceinteger(L, 1);
+    luaL_checktype(L, 2, LUA_TTABLE);
+    luaL_checktype(L, 3, LUA_TTABLE);
+    luaL_checktype(L, 4, LUA_TTABLE);
+    int count = lua_objlen(L, 3);
+
+    int oattr = 0;
+    for (int i = 1; i <= count; i++)
     {
-        uni_t c = readu8(&src);
-        if (c == '\0')
-            break;
+        lua_rawgeti(L, 3, i);
+        size_t size;
+        const char* s = luaL_checklstring(L, -1, &size);
+
+        /* The string stays alive as it's still referenced by the table. */
+        lua_pop(L, 1);
+
+        oattr = writestyled(getinteger(L, 2, i),
+            y,
+            s,
+            s + size,
+            oattr,
+            s + getinteger(L, 5, i) - 1,
+            s + getinteger(L, 6, i) - 1,
+            getinteger(L, 4, i));
+    }
+
+    lua_pushnumber(L, oattr);
+    return 1;
+}
 
-        if (!iswcntrl(c))
-            writeu8(&p, c);
+/* As writestyledline, but draws words straight out of a paragraph, all in the
+ * paragraph's style; for when nothing wants to restyle individual words. The
+ * arguments are y, the paragraph, the line (an array of word numbers), the
+ * left margin, the paragraph's word x offsets, the style, and optionally
+ * arrays of highlight start and stop offsets indexed by position in the
+ * line. */
+
+static int writeparagraphline_cb(lua_State* L)
+{
+    /* Pad out the optional arguments, so that they don't get confused with
+     * the words pushed below. */
+    lua_settop(L, 8);
+
+    int y = forceinteger(L, 1);
+    luaL_checktype(L, 2, LUA_TTABLE);
+    luaL_checktype(L, 3, LUA_TTABLE);
+    int x = forceinteger(L, 4);
+    luaL_checktype(L, 5, LUA_TTABLE);
+    int sor = forceinteger(L, 6);
+    int count = lua_objlen(L, 3);
+
+    int oattr = 0;
+    for (int i = 1; i <= count; i++)
+    {
+        int wn = getinteger(L, 3, i);
+
+        /* Not raw, so that packed paragraphs work. */
+        lua_pushnumber(L, wn);
+        lua_gettable(L, 2);
+        size_t size;
+        const char* s = luaL_checklstring(L, -1, &size);
+
+        oattr = writestyled(x + getinteger(L, 5, wn),
+            y,
+            s,
+            s + size,
+            oattr,
+            s + getinteger(L, 7, i) - 1,
+            s + getinteger(L, 8, i) - 1,
+            sor);
+        lua_pop(L, 1);
     }
 
-    lua_pushlstring(L, dest, p - dest);
+    lua_pushnumber(L, oattr);
+    return 1;
+}
+
+/* Returns the raw text of a word, with no styling. */
+
+static int getwordtext_cb(lua_State* L)
+{
+    size_t bytes;
+    const char* src = luaL_checklstring(L, 1, &bytes);
+    const std::string& text = getwordmetrics(src, bytes).text;
+    lua_pushlstring(L, text.data(), text.size());
     return 1;
 }
 
@@ -379,23 +509,22 @@ finished:
     return 1;
 }
 
-/* Turns on or off a style to a particular range of a word. */
-
-static int applystyletoword_cb(lua_State* L)
+/* Copies the word src into dest, turning on or off a style between offset1
+ * and offset2 (either of which may be null). Adding a style adds at most two
+ * extra bytes to the word (on, and then off again), so dest needs that much
+ * room. If src reaches csoffset, *cdoffset is set to the corresponding point
+ * in dest so the cursor can move correctly. Returns the end of dest. */
+
+static char* applystyle(char* dest,
+    const char* src,
+    int targetsor,
+    int targetsand,
+    const char* offset1,
+    const char* offset2,
+    const char* csoffset,
+    char** cdoffset)
 {
-    size_t srcbytes;
-    const char* src = luaL_checklstring(L, 1, &srcbytes);
-    int targetsor = forceinteger(L, 2);
-    int targetsand = forceinteger(L, 3);
-    const char* offset1 = src + forceinteger(L, 4) - 1;
-    const char* offset2 = src + forceinteger(L, 5) - 1;
-    const char* csoffset = src + forceinteger(L, 6) - 1;
-
-    /* Adding a style will add at most two extra bytes to the string
-     * (on, and then off again). Probably less. */
-    char dest[srcbytes + 2];
     char* p = dest;
-    char* cdoffset = dest;
 
     int sand = STYLE_ALL;
     int sor = 0;
@@ -420,18 +549,131 @@ static int applystyletoword_cb(lua_State* L)
             sor = 0;
         }
 
-        /* If we reach csoffset in the src, remember where we were in the dest
-         * so we can move the cursor correctly. */
-
         if (src == csoffset)
-            cdoffset = p;
+            *cdoffset = p;
     } while (copy(&p, &dstate, &src, &sstate, sor, sand));
 
+    return p;
+}
+
+/* Turns on or off a style to a particular range of a word. */
+
+static int applystyletoword_cb(lua_State* L)
+{
+    size_t srcbytes;
+    const char* src = luaL_checklstring(L, 1, &srcbytes);
+    int targetsor = forceinteger(L, 2);
+    int targetsand = forceinteger(L, 3);
+    const char* offset1 = src + forceinteger(L, 4) - 1;
+    const char* offset2 = src + forceinteger(L, 5) - 1;
+    const char* csoffset = src + forceinteger(L, 6) - 1;
+
+    char dest[srcbytes + 2];
+    char* cdoffset = dest;
+    char* p = applystyle(dest,
+        src,
+        targetsor,
+        targetsand,
+        offset1,
+        offset2,
+        csoffset,
+        &cdoffset);
+
     lua_pushlstring(L, dest, p - dest);
     lua_pushnumber(L, 1 + cdoffset - dest);
     return 2;
 }
 
+/* Turns on or off a style over a range of a paragraph's words, from offset
+ * fo in word firstword to offset lo in word lastword (where a lo of 0 means
+ * the end of the word), all in one go. If cw is given, co is the cursor's
+ * offset into that word. Returns the paragraph's new words and the cursor's
+ * new offset, or nil if applying the style changes nothing; words which
+ * don't change are the same strings as before. */
+
+static int applystyletoparagraph_cb(lua_State* L)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+    int targetsor = forceinteger(L, 2);
+    int targetsand = forceinteger(L, 3);
+    int firstword = forceinteger(L, 4);
+    int fo = forceinteger(L, 5);
+    int lastword = forceinteger(L, 6);
+    int lo = forceinteger(L, 7);
+    int cw = luaL_optinteger(L, 8, 0);
+    int co = luaL_optinteger(L, 9, 0);
+    luaL_checkstack(L, 4, "out of memory");
+
+    size_t packedlen;
+    bool packed = getpackedwords(L, 1, &packedlen);
+
+    lua_createtable(L, packed ? 0 : lua_objlen(L, 1), 0);
+    int result = lua_gettop(L);
+    int wn = 0;
+    bool changed = false;
+    std::string copied;
+    std::vector<char> dest;
+
+    auto addword = [&](const char* w, size_t len)
+    {
+        wn++;
+        if ((wn < firstword) || (wn > lastword))
+        {
+            /* Ordinary paragraphs' words are on the top of the stack. */
+            if (packed)
+                lua_pushlstring(L, w, len);
+            else
+                lua_pushvalue(L, -1);
+            lua_rawseti(L, result, wn);
+            return;
+        }
+
+        const char* src = w;
+        if (packed)
+        {
+            /* The style code wants a terminated string. */
+            copied.assign(w, len);
+            src = copied.c_str();
+        }
+
+        dest.resize(len + 2);
+        char* cdoffset = &dest[0];
+        char* p = applystyle(&dest[0],
+            src,
+            targetsor,
+            targetsand,
+            (wn == firstword) ? (src + fo - 1) : src,
+            ((wn == lastword) && (lo > 0)) ? (src + lo - 1) : nullptr,
+            (wn == cw) ? (src + co - 1) : nullptr,
+            &cdoffset);
+        if (wn == cw)
+            co = 1 + cdoffset - &dest[0];
+
+        size_t newlen = p - &dest[0];
+        if ((newlen == len) && (memcmp(&dest[0], w, len) == 0))
+        {
+            if (packed)
+                lua_pushlstring(L, w, len);
+            else
+                lua_pushvalue(L, -1);
+        }
+        else
+        {
+            lua_pushlstring(L, &dest[0], newlen);
+            changed = true;
+        }
+        lua_rawseti(L, result, wn);
+    };
+    foreachparagraphword(L, 1, addword);
+
+    if (!changed)
+        lua_pushnil(L);
+    else
+        lua_pushvalue(L, result);
+    lua_pushnumber(L, co);
+    return 2;
+}
+
 /* Fetch the style at a particular offset into a word. */
 
 static int getstylefromword_cb(lua_State* L)
@@ -465,20 +707,133 @@ static int createstylebyte_cb(lua_State* L)
     return 1;
 }
 
+/* Replaces the straight quotes in a paragraph's words with the given left
+ * and right double and single quotes, all in one go. A quote's a left one
+ * if everything before it in the word is quotes (straight ones or left
+ * ones) or style bytes. Returns the new words, or nil if nothing changes;
+ * words which don't change are the same strings as before. */
+
+static int smartquoteparagraph_cb(lua_State* L)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+    std::string_view quotes[4]; /* left double, right double, left, right */
+    for (int i = 0; i < 4; i++)
+    {
+        size_t len;
+        const char* s = luaL_checklstring(L, i + 2, &len);
+        quotes[i] = std::string_view(s, len);
+    }
+    const std::string_view& leftdouble = quotes[0];
+    const std::string_view& leftsingle = quotes[2];
+    luaL_checkstack(L, 4, "out of memory");
+
+    size_t packedlen;
+    bool packed = getpackedwords(L, 1, &packedlen);
+
+    lua_createtable(L, packed ? 0 : lua_objlen(L, 1), 0);
+    int result = lua_gettop(L);
+    int wn = 0;
+    bool changed = false;
+    std::string dest;
+
+    auto startswith = [](std::string_view s, std::string_view prefix)
+    {
+        return !prefix.empty() && (s.substr(0, prefix.size()) == prefix);
+    };
+
+    auto addword = [&](const char* w, size_t len)
+    {
+        wn++;
+        if (!memchr(w, '"', len) && !memchr(w, '\'', len))
+        {
+            /* Ordinary paragraphs' words are on the top of the stack. */
+            if (packed)
+                lua_pushlstring(L, w, len);
+            else
+                lua_pushvalue(L, -1);
+            lua_rawseti(L, result, wn);
+            return;
+        }
+
+        dest.clear();
+        bool first = true;
+        size_t i = 0;
+        while (i < len)
+        {
+            char c = w[i];
+            if ((c == '"') || (c == '\''))
+            {
+                dest += quotes[((c == '"') ? 0 : 2) + (first ? 0 : 1)];
+                i++;
+                continue;
+            }
+
+            if (first)
+            {
+                std::string_view rest(w + i, len - i);
+                size_t n = 0;
+                if (((uint8_t)c < 32) || (c == 127))
+                    n = 1;
+                else if (startswith(rest, leftdouble))
+                    n = leftdouble.size();
+                else if (startswith(rest, leftsingle))
+                    n = leftsingle.size();
+
+                if (n)
+                {
+                    dest.append(w + i, n);
+                    i += n;
+                    continue;
+                }
+                first = false;
+            }
+
+            dest += c;
+            i++;
+        }
+
+        if (std::string_view(dest) == std::string_view(w, len))
+        {
+            if (packed)
+                lua_pushlstring(L, w, len);
+            else
+                lua_pushvalue(L, -1);
+        }
+        else
+        {
+            lua_pushlstring(L, dest.data(), dest.size());
+            changed = true;
+        }
+        lua_rawseti(L, result, wn);
+    };
+    foreachparagraphword(L, 1, addword);
+
+    if (!changed)
+        lua_pushnil(L);
+    else
+        lua_pushvalue(L, result);
+    return 1;
+}
+
 void word_init(void)
 {
     const static luaL_Reg funcs[] = {
-        {"parseword",        parseword_cb       },
-        {"writestyled",      writestyled_cb     },
-        {"getwordtext",      getwordtext_cb     },
-        {"nextcharinword",   nextcharinword_cb  },
-        {"prevcharinword",   prevcharinword_cb  },
-        {"insertintoword",   insertintoword_cb  },
-        {"deletefromword",   deletefromword_cb  },
-        {"applystyletoword", applystyletoword_cb},
-        {"getstylefromword", getstylefromword_cb},
-        {"createstylebyte",  createstylebyte_cb },
-        {NULL,               NULL               }
+        {"parseword",             parseword_cb            },
+        {"parseparagraph",        parseparagraph_cb       },
+        {"writestyled",           writestyled_cb          },
+        {"writestyledline",       writestyledline_cb      },
+        {"writeparagraphline",    writeparagraphline_cb   },
+        {"getwordtext",           getwordtext_cb          },
+        {"nextcharinword",        nextcharinword_cb       },
+        {"prevcharinword",        prevcharinword_cb       },
+        {"insertintoword",        insertintoword_cb       },
+        {"deletefromword",        deletefromword_cb       },
+        {"applystyletoword",      applystyletoword_cb     },
+        {"applystyletoparagraph", applystyletoparagraph_cb},
+        {"smartquoteparagraph",   smartquoteparagraph_cb  },
+        {"getstylefromword",      getstylefromword_cb     },
+        {"createstylebyte",       createstylebyte_cb      },
+        {NULL,                    NULL                    }
     };
 
     const static luaL_Constant consts[] = {
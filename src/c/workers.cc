@@ -0,0 +1,280 @@
+/* © 2026 David Given.
+ * WordGrinder is licensed under the MIT open source license. See the COPYING
+ * file in this distribution for the full text.
+ */
+
+#include "globals.h"
+#include <stdlib.h>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* Worker threads, for work which can be done by a pure function: one which
+ * takes a string and returns a string, and needs nothing else from the
+ * editor. Each worker has an interpreter state of its own, with only the
+ * standard (sandboxed) libraries, so the job's code and input go in as
+ * strings, and the result comes out as one; anything more structured has to
+ * be serialised by the caller. There's one worker per core, started when
+ * the first job is.
+ *
+ * A chunk of code is compiled once per worker and then kept, so spawning
+ * lots of jobs with the same code is cheap. The chunk must return the
+ * function to call. */
+
+static const char JOB[] = "wg.job";
+static const char CODECACHE[] = "wg.jobcode"; /* in each worker's registry */
+
+struct Job
+{
+    std::string code;
+    std::string input;
+
+    /* Everything below is guarded by mutex. */
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool finished = false;
+    bool failed = false;
+    std::string result; /* or the error message */
+};
+
+/* Never freed, so that the workers can't find it gone at exit. */
+
+static struct Pool
+{
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::shared_ptr<Job>> queue;
+    size_t workers = 0;
+}* pool = new Pool;
+
+/* A forked child has none of the workers, so it gets a pool of its own. */
+
+void workers_afterfork(void)
+{
+    pool = new Pool;
+}
+
+static void* workeralloc(void* ud, void* ptr, size_t osize, size_t nsize)
+{
+    if (nsize == 0)
+    {
+        free(ptr);
+        return nullptr;
+    }
+    return realloc(ptr, nsize);
+}
+
+static void finishjob(Job* job, bool failed, std::string result)
+{
+    std::lock_guard<std::mutex> lock(job->mutex);
+    job->failed = failed;
+    job->result = std::move(result);
+    job->finished = true;
+    job->cv.notify_all();
+}
+
+/* Pushes the function for a chunk of code, compiling it if this worker
+ * hasn't seen it before. Each chunk gets its own globals. */
+
+static int loadjobfunction(lua_State* W, const std::string& code)
+{
+    lua_getfield(W, LUA_REGISTRYINDEX, CODECACHE);
+    lua_pushlstring(W, code.data(), code.size());
+    lua_rawget(W, -2);
+    if (lua_isfunction(W, -1))
+    {
+        lua_remove(W, -2);
+        return 0;
+    }
+    lua_pop(W, 1);
+
+    lua_State* T = lua_newthread(W);
+    luaL_sandboxthread(T);
+    int status = luaL_loadstring(T, code.c_str(), "=worker");
+    if (status == 0)
+        status = lua_pcall(T, 0, 1, 0);
+    if ((status == 0) && !lua_isfunction(T, -1))
+    {
+        lua_pop(T, 1);
+        lua_pushliteral(T, "worker code must return a function");
+        status = LUA_ERRRUN;
+    }
+    lua_xmove(T, W, 1);
+    lua_remove(W, -2); /* the thread */
+    if (status)
+    {
+        lua_remove(W, -2); /* the cache */
+        return status;
+    }
+
+    lua_pushlstring(W, code.data(), code.size());
+    lua_pushvalue(W, -2);
+    lua_rawset(W, -4);
+    lua_remove(W, -2);
+    return 0;
+}
+
+static void runjob(lua_State* W, Job* job)
+{
+    int status = loadjobfunction(W, job->code);
+    if (status == 0)
+    {
+        lua_pushlstring(W, job->input.data(), job->input.size());
+        status = lua_pcall(W, 1, 1, 0);
+    }
+    if ((status == 0) && !lua_isstring(W, -1))
+    {
+        lua_pop(W, 1);
+        lua_pushliteral(W, "worker function must return a string");
+        status = LUA_ERRRUN;
+    }
+
+    size_t len;
+    const char* s = lua_tolstring(W, -1, &len);
+    std::string result = s ? std::string(s, len) : "unknown error";
+    lua_pop(W, 1);
+
+    /* Don't let the input hang around until the next job. */
+    job->input.clear();
+    job->input.shrink_to_fit();
+    lua_gc(W, LUA_GCCOLLECT, 0);
+
+    finishjob(job, status != 0, std::move(result));
+}
+
+static void workermain()
+{
+    lua_State* W = lua_newstate(workeralloc, nullptr);
+    luaL_openlibs(W);
+    lua_newtable(W);
+    lua_setfield(W, LUA_REGISTRYINDEX, CODECACHE);
+    luaL_sandbox(W);
+
+    for (;;)
+    {
+        std::shared_ptr<Job> job;
+        {
+            std::unique_lock<std::mutex> lock(pool->mutex);
+            pool->cv.wait(lock,
+                []
+                {
+                    return !pool->queue.empty();
+                });
+            job = std::move(pool->queue.front());
+            pool->queue.pop_front();
+        }
+        runjob(W, job.get());
+    }
+}
+
+static std::shared_ptr<Job>& checkjob(lua_State* L, int index)
+{
+    return *(std::shared_ptr<Job>*)luaL_checkudata(L, index, JOB);
+}
+
+static void job_dtor(void* p)
+{
+    ((std::shared_ptr<Job>*)p)->~shared_ptr();
+}
+
+/* Queues up a job, returning a job object. The input may be a string or a
+ * mapped file. */
+
+static int spawn_cb(lua_State* L)
+{
+    size_t codelen;
+    const char* code = luaL_checklstring(L, 1, &codelen);
+    size_t inputlen;
+    const char* input = checkbuffer(L, 2, &inputlen);
+
+    auto job = std::make_shared<Job>();
+    job->code = std::string(code, codelen);
+    job->input = std::string(input, inputlen);
+    void* p = lua_newuserdatadtor(L, sizeof(std::shared_ptr<Job>), job_dtor);
+    new (p) std::shared_ptr<Job>(job);
+    luaL_getmetatable(L, JOB);
+    lua_setmetatable(L, -2);
+
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        pool->queue.push_back(job);
+        if (pool->workers < std::max(std::thread::hardware_concurrency(), 1U))
+        {
+            std::thread(workermain).detach();
+            pool->workers++;
+        }
+    }
+    pool->cv.notify_one();
+    return 1;
+}
+
+/* Returns whether the job has finished and, if it has, its result; or, if
+ * its code failed, nil and the error. Waits for up to timeout seconds for it
+ * to finish first. */
+
+static int job_poll_cb(lua_State* L)
+{
+    auto& job = checkjob(L, 1);
+    double timeout = luaL_optnumber(L, 2, 0);
+
+    std::unique_lock<std::mutex> lock(job->mutex);
+    if (timeout > 0)
+        job->cv.wait_for(lock,
+            std::chrono::duration<double>(timeout),
+            [&]
+            {
+                return job->finished;
+            });
+
+    if (!job->finished)
+    {
+        lua_pushboolean(L, false);
+        return 1;
+    }
+    if (job->failed)
+    {
+        lua_pushnil(L);
+        lua_pushlstring(L, job->result.data(), job->result.size());
+        return 2;
+    }
+
+    lua_pushboolean(L, true);
+    lua_pushlstring(L, job->result.data(), job->result.size());
+    return 2;
+}
+
+static int workercount_cb(lua_State* L)
+{
+    lua_pushinteger(L, std::max(std::thread::hardware_concurrency(), 1U));
+    return 1;
+}
+
+void workers_init(void)
+{
+    const static luaL_Reg jobmethods[] = {
+        {"poll", job_poll_cb},
+        {NULL,   NULL       }
+    };
+
+    luaL_newmetatable(L, JOB);
+    lua_newtable(L);
+    luaL_register(L, NULL, jobmethods);
+    lua_setfield(L, -2, "__index");
+    lua_pop(L, 1);
+
+    const static luaL_Reg funcs[] = {
+        {"spawn",       spawn_cb      },
+        {"workercount", workercount_cb},
+        {NULL,          NULL          }
+    };
+
+    luaL_register(L, "wg", funcs);
+    lua_pop(L, 1);
+}
+
+// vim: sw=4 ts=4 et
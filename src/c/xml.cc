@@ -0,0 +1,621 @@
+/* © 2026 David Given.
+ * WordGrinder is licensed under the MIT open source license. See the COPYING
+ * file in this distribution for the full text.
+ */
+
+#include "globals.h"
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/* A streaming XML tokeniser. This isn't a validating parser; it understands
+ * just enough XML to read the documents WordGrinder imports, and is
+ * forgiving about what it doesn't understand. Namespace prefixes are
+ * resolved to URIs as it goes, so callers see each name as a (namespace,
+ * name) pair; unprefixed elements are in the default namespace and
+ * unprefixed attributes in no namespace.
+ *
+ * Whitespace in text is collapsed much as HTML does it: runs of whitespace
+ * become one space, line breaks (with the whitespace around them) vanish at
+ * the edges of a text run and become spaces inside one, and text which is
+ * only whitespace is dropped completely. */
+
+static const char XMLTOKENS[] = "wg.xmltokens";
+
+struct XMLBinding
+{
+    std::string prefix;
+    std::string uri;
+};
+
+struct XMLElement
+{
+    std::string ns;
+    std::string name;
+    size_t bindings; /* namespace bindings in scope outside the element */
+};
+
+struct XMLTokeniser
+{
+    size_t offset = 0;
+    std::vector<XMLBinding> bindings;
+    std::vector<XMLElement> open;
+    bool selfclosing = false; /* the last element opened has no contents */
+    bool finished = false;
+    std::string text;
+
+    /* For streamed documents. */
+    std::string buffer;
+    bool eof = false;
+};
+
+struct XMLTokensBox
+{
+    XMLTokeniser* t;
+};
+
+static void xmltokens_dtor(void* p)
+{
+    XMLTokensBox* box = (XMLTokensBox*)p;
+    delete box->t;
+    box->t = nullptr;
+}
+
+static bool isxmlspace(char c)
+{
+    return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\r');
+}
+
+static bool isnamechar(char c)
+{
+    return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) ||
+           ((c >= '0') && (c <= '9')) || (c == '_') || (c == '-') ||
+           (c == '.') || ((uint8_t)c >= 0x80);
+}
+
+static const std::string* lookupprefix(
+    const XMLTokeniser* t, std::string_view prefix)
+{
+    for (auto i = t->bindings.rbegin(); i != t->bindings.rend(); i++)
+        if (i->prefix == prefix)
+            return &i->uri;
+    return nullptr;
+}
+
+/* Appends text with any entities replaced. Unknown ones are left alone. */
+
+static void decodeentities(std::string& out, std::string_view s)
+{
+    while (!s.empty())
+    {
+        size_t amp = s.find('&');
+        out.append(s.substr(0, amp));
+        if (amp == std::string_view::npos)
+            return;
+        s.remove_prefix(amp);
+
+        size_t semi = s.find(';');
+        if ((semi == std::string_view::npos) || (semi > 10))
+        {
+            out += '&';
+            s.remove_prefix(1);
+            continue;
+        }
+
+        std::string_view entity = s.substr(1, semi - 1);
+        uni_t c = 0;
+        if ((entity.size() > 1) && (entity[0] == '#'))
+        {
+            /* Only characters which could be written as UTF-8 count; NUL,
+             * surrogates and anything past U+10FFFF are left alone. */
+
+            bool hex = (entity[1] == 'x') || (entity[1] == 'X');
+            std::string_view digits = entity.substr(hex ? 2 : 1);
+            for (char d : digits)
+            {
+                int v;
+                if ((d >= '0') && (d <= '9'))
+                    v = d - '0';
+                else if (hex && (d >= 'a') && (d <= 'f'))
+                    v = d - 'a' + 10;
+                else if (hex && (d >= 'A') && (d <= 'F'))
+                    v = d - 'A' + 10;
+                else
+                {
+                    c = 0;
+                    break;
+                }
+                c = c * (hex ? 16 : 10) + v;
+                if (c > 0x10ffff)
+                {
+                    c = 0;
+                    break;
+                }
+            }
+            if ((c >= 0xd800) && (c <= 0xdfff))
+                c = 0;
+        }
+        else if (entity == "amp")
+            c = '&';
+        else if (entity == "lt")
+            c = '<';
+        else if (entity == "gt")
+            c = '>';
+        else if (entity == "quot")
+            c = '"';
+        else if (entity == "apos")
+            c = '\'';
+
+        if (c)
+        {
+            char buffer[8];
+            char* p = buffer;
+            writeu8(&p, c);
+            out.append(buffer, p - buffer);
+        }
+        else
+            out.append(s.substr(0, semi + 1));
+        s.remove_prefix(semi + 1);
+    }
+}
+
+/* Collapses the whitespace in a run of text (see above); returns false if
+ * there's nothing left. */
+
+static bool collapsetext(std::string& out, std::string_view s)
+{
+    std::string collapsed;
+    bool first = true;
+    for (;;)
+    {
+        size_t nl = s.find('\n');
+        bool last = (nl == std::string_view::npos);
+        std::string_view line = s.substr(0, nl);
+
+        std::string l;
+        bool space = false;
+        for (char c : line)
+        {
+            if (c == '\r')
+                continue;
+            if ((c == ' ') || (c == '\t'))
+                space = true;
+            else
+            {
+                if (space && (first || !l.empty()))
+                    l += ' ';
+                space = false;
+                l += c;
+            }
+        }
+        if (space && last && (first || !l.empty()))
+            l += ' ';
+
+        if (!l.empty())
+        {
+            if (!collapsed.empty())
+                collapsed += ' ';
+            collapsed += l;
+        }
+        if (last)
+            break;
+        s.remove_prefix(nl + 1);
+        first = false;
+    }
+
+    if (collapsed.find_first_not_of(' ') == std::string::npos)
+        return false;
+    decodeentities(out, collapsed);
+    return true;
+}
+
+static void skipspace(std::string_view xml, size_t& p)
+{
+    while ((p < xml.size()) && isxmlspace(xml[p]))
+        p++;
+}
+
+/* Reads a possibly prefixed name. */
+
+static bool readname(std::string_view xml,
+    size_t& p,
+    std::string_view& prefix,
+    std::string_view& name)
+{
+    size_t s = p;
+    while ((p < xml.size()) && isnamechar(xml[p]))
+        p++;
+    if (p == s)
+        return false;
+    prefix = {};
+    name = xml.substr(s, p - s);
+
+    if ((p < xml.size()) && (xml[p] == ':'))
+    {
+        size_t l = ++p;
+        while ((p < xml.size()) && isnamechar(xml[p]))
+            p++;
+        prefix = name;
+        name = xml.substr(l, p - l);
+    }
+    return true;
+}
+
+struct XMLAttribute
+{
+    std::string_view prefix;
+    std::string_view name;
+    std::string value;
+};
+
+/* Reads the attributes of a tag, up to (but not including) the end. */
+
+static void readattributes(
+    std::string_view xml, size_t& p, std::vector<XMLAttribute>& attrs)
+{
+    for (;;)
+    {
+        skipspace(xml, p);
+        XMLAttribute a;
+        size_t s = p;
+        if (!readname(xml, p, a.prefix, a.name))
+            return;
+
+        skipspace(xml, p);
+        if ((p == xml.size()) || (xml[p] != '='))
+        {
+            p = s;
+            return;
+        }
+        p++;
+        skipspace(xml, p);
+        if ((p == xml.size()) || ((xml[p] != '"') && (xml[p] != '\'')))
+        {
+            p = s;
+            return;
+        }
+
+        char quote = xml[p++];
+        size_t e = xml.find(quote, p);
+        if (e == std::string_view::npos)
+        {
+            p = s;
+            return;
+        }
+
+        /* Attribute values have their whitespace normalised. */
+        std::string value(xml.substr(p, e - p));
+        for (char& c : value)
+            if (isxmlspace(c))
+                c = ' ';
+        decodeentities(a.value, value);
+        attrs.push_back(std::move(a));
+        p = e + 1;
+    }
+}
+
+static bool isdeclaration(const XMLAttribute& a)
+{
+    return (a.prefix == "xmlns") || (a.prefix.empty() && (a.name == "xmlns"));
+}
+
+/* Records the namespace declarations in a tag's attributes. */
+
+static void declarenamespaces(
+    XMLTokeniser* t, const std::vector<XMLAttribute>& attrs)
+{
+    for (const auto& a : attrs)
+        if (isdeclaration(a))
+            t->bindings.push_back(
+                {std::string(a.prefix.empty() ? "" : a.name), a.value});
+}
+
+/* Pushes a table of attributes, keyed by "namespace name" (or just "name"
+ * for attributes not in a namespace). Namespace declarations aren't
+ * included. */
+
+static void pushattributes(
+    lua_State* L, const XMLTokeniser* t, const std::vector<XMLAttribute>& attrs)
+{
+    lua_createtable(L, 0, attrs.size());
+    for (const auto& a : attrs)
+    {
+        if (isdeclaration(a))
+            continue;
+
+        std::string key;
+        if (!a.prefix.empty())
+        {
+            const std::string* uri = lookupprefix(t, a.prefix);
+            key = uri ? *uri : std::string(a.prefix);
+            key += ' ';
+        }
+        key += a.name;
+
+        lua_pushlstring(L, key.data(), key.size());
+        lua_pushlstring(L, a.value.data(), a.value.size());
+        lua_rawset(L, -3);
+    }
+}
+
+static int closeelement(lua_State* L, XMLTokeniser* t)
+{
+    XMLElement& e = t->open.back();
+    lua_pushstring(L, "closetag");
+    lua_pushlstring(L, e.ns.data(), e.ns.size());
+    lua_pushlstring(L, e.name.data(), e.name.size());
+    t->bindings.resize(e.bindings);
+    t->open.pop_back();
+    return 3;
+}
+
+static int xmlerror(lua_State* L, XMLTokeniser* t, std::string_view xml)
+{
+    t->finished = true;
+    std::string_view s = xml.substr(t->offset, 100);
+    lua_pushstring(L, "error");
+    lua_pushlstring(L, s.data(), s.size());
+    return 2;
+}
+
+static const int NEEDMORE = -1;
+static const size_t CHUNKSIZE = 64 * 1024;
+
+/* Called when a token can't be parsed. If there's more data to come, it may
+ * just not have arrived yet (which means that real errors in streamed data
+ * aren't reported until it's all been read). */
+
+static int incomplete(
+    lua_State* L, XMLTokeniser* t, std::string_view xml, bool eof)
+{
+    return eof ? xmlerror(L, t, xml) : NEEDMORE;
+}
+
+/* Parses the next token from xml (see below), or returns NEEDMORE if xml
+ * doesn't hold all of it yet and eof isn't set. */
+
+static int nexttoken(
+    lua_State* L, XMLTokeniser* t, std::string_view xml, bool eof)
+{
+    for (;;)
+    {
+        if (!t->finished && (t->offset >= xml.size()) && !eof)
+            return NEEDMORE;
+        if (t->finished || (t->offset >= xml.size()))
+        {
+            t->finished = true;
+            if (!t->open.empty())
+                return closeelement(L, t);
+            return 0;
+        }
+
+        size_t& p = t->offset;
+        if (xml[p] != '<')
+        {
+            size_t e = xml.find('<', p);
+            if (e == std::string_view::npos)
+            {
+                if (!eof)
+                    return NEEDMORE;
+                e = xml.size();
+            }
+            std::string_view raw = xml.substr(p, e - p);
+            p = e;
+
+            t->text.clear();
+            if (collapsetext(t->text, raw))
+            {
+                lua_pushstring(L, "text");
+                lua_pushlstring(L, t->text.data(), t->text.size());
+                return 2;
+            }
+            continue;
+        }
+
+        std::string_view rest = xml.substr(p);
+        if (rest.substr(0, 4) == "<!--")
+        {
+            size_t e = rest.find("-->");
+            if (e == std::string_view::npos)
+                return incomplete(L, t, xml, eof);
+            p += e + 3;
+            continue;
+        }
+
+        if (rest.substr(0, 9) == "<![CDATA[")
+        {
+            size_t e = rest.find("]]>");
+            if (e == std::string_view::npos)
+                return incomplete(L, t, xml, eof);
+            std::string_view s = rest.substr(9, e - 9);
+            p += e + 3;
+            if (s.empty())
+                continue;
+            lua_pushstring(L, "text");
+            lua_pushlstring(L, s.data(), s.size());
+            return 2;
+        }
+
+        if (rest.substr(0, 2) == "<!")
+        {
+            /* DOCTYPE and friends. */
+            size_t e = rest.find('>');
+            if (e == std::string_view::npos)
+                return incomplete(L, t, xml, eof);
+            p += e + 1;
+            continue;
+        }
+
+        if (rest.substr(0, 2) == "<?")
+        {
+            size_t q = p + 2;
+            std::string_view prefix, name;
+            if (!readname(xml, q, prefix, name))
+                return incomplete(L, t, xml, eof);
+
+            std::vector<XMLAttribute> attrs;
+            readattributes(xml, q, attrs);
+            size_t e = xml.find("?>", q);
+            if (e == std::string_view::npos)
+                return incomplete(L, t, xml, eof);
+            p = e + 2;
+
+            lua_pushstring(L, "processing");
+            lua_pushlstring(L, name.data(), name.size());
+            pushattributes(L, t, attrs);
+            return 3;
+        }
+
+        if (rest.substr(0, 2) == "</")
+        {
+            size_t e = rest.find('>');
+            if (e == std::string_view::npos)
+                return incomplete(L, t, xml, eof);
+            p += e + 1;
+
+            /* A stray close tag ends the document. */
+            if (t->open.empty())
+            {
+                t->finished = true;
+                return 0;
+            }
+            return closeelement(L, t);
+        }
+
+        size_t q = p + 1;
+        skipspace(xml, q);
+        std::string_view prefix, name;
+        if (!readname(xml, q, prefix, name))
+            return incomplete(L, t, xml, eof);
+
+        std::vector<XMLAttribute> attrs;
+        readattributes(xml, q, attrs);
+        skipspace(xml, q);
+        bool selfclosing = false;
+        if ((q < xml.size()) && (xml[q] == '/'))
+        {
+            selfclosing = true;
+            q++;
+        }
+        if ((q == xml.size()) || (xml[q] != '>'))
+            return incomplete(L, t, xml, eof);
+        p = q + 1;
+
+        XMLElement element;
+        element.bindings = t->bindings.size();
+        declarenamespaces(t, attrs);
+        const std::string* uri = lookupprefix(t, prefix);
+        element.ns = uri ? *uri : std::string(prefix);
+        element.name = name;
+
+        lua_pushstring(L, "opentag");
+        lua_pushlstring(L, element.ns.data(), element.ns.size());
+        lua_pushlstring(L, element.name.data(), element.name.size());
+        pushattributes(L, t, attrs);
+
+        t->open.push_back(std::move(element));
+        t->selfclosing = selfclosing;
+        return 4;
+    }
+}
+
+/* Reads the next chunk of a streamed document into the tokeniser's buffer,
+ * discarding what's already been parsed. */
+
+static bool refill(XMLTokeniser* t, ZipReader* zr)
+{
+    t->buffer.erase(0, t->offset);
+    t->offset = 0;
+
+    size_t used = t->buffer.size();
+    t->buffer.resize(used + CHUNKSIZE);
+    int i = readzipreader(zr, &t->buffer[used], CHUNKSIZE);
+    t->buffer.resize(used + std::max(i, 0));
+    if (i <= 0)
+        t->eof = true;
+    return i >= 0;
+}
+
+/* Returns the next token: one of
+ *
+ *   "opentag", namespace, name, attributes
+ *   "closetag", namespace, name
+ *   "text", text
+ *   "processing", name, attributes
+ *   "error", the text which couldn't be parsed
+ *
+ * or nothing at the end. Every opentag has a matching closetag, including
+ * self-closing ones and any left open at the end of the document. */
+
+static int xmltokens_next_cb(lua_State* L)
+{
+    XMLTokeniser* t =
+        ((XMLTokensBox*)luaL_checkudata(L, lua_upvalueindex(2), XMLTOKENS))
+            ->t;
+
+    if (t->selfclosing)
+    {
+        t->selfclosing = false;
+        return closeelement(L, t);
+    }
+
+    ZipReader* zr = tozipreader(L, lua_upvalueindex(1));
+    if (!zr)
+    {
+        size_t len;
+        const char* data = checkbuffer(L, lua_upvalueindex(1), &len);
+        return nexttoken(L, t, std::string_view(data, len), true);
+    }
+
+    for (;;)
+    {
+        int i = nexttoken(L, t, t->buffer, t->eof);
+        if (i != NEEDMORE)
+            return i;
+        if (!refill(t, zr))
+        {
+            t->finished = true;
+            lua_pushstring(L, "error");
+            lua_pushstring(L, "the compressed data could not be read");
+            return 2;
+        }
+    }
+}
+
+/* Returns an iterator over the tokens in a string or mapped file, or a zip
+ * member which is read a chunk at a time (see xmltokens_next_cb() above). */
+
+static int xmltokens_cb(lua_State* L)
+{
+    if (!tozipreader(L, 1))
+    {
+        size_t len;
+        checkbuffer(L, 1, &len);
+    }
+
+    lua_pushvalue(L, 1);
+    XMLTokensBox* box = (XMLTokensBox*)lua_newuserdatadtor(
+        L, sizeof(XMLTokensBox), xmltokens_dtor);
+    box->t = new XMLTokeniser();
+    luaL_getmetatable(L, XMLTOKENS);
+    lua_setmetatable(L, -2);
+    lua_pushcclosure(L, xmltokens_next_cb, 2);
+    return 1;
+}
+
+void xml_init(void)
+{
+    const static luaL_Reg funcs[] = {
+        {"xmltokens", xmltokens_cb},
+        {NULL,        NULL        }
+    };
+
+    luaL_newmetatable(L, XMLTOKENS);
+    lua_pop(L, 1);
+
+    luaL_register(L, "wg", funcs);
+}
+
+// vim: sw=4 ts=4 et
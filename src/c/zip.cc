@@ -5,103 +5,196 @@
 
 #include "globals.h"
 #include <zlib.h>
+#include <errno.h>
+#include <string.h>
 #include <vector>
+#include <string>
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <future>
+#include <memory>
+#include <thread>
+#include <unordered_map>
 #include "unzip.h"
 #include "zip.h"
 
-static const int STACKSIZE = 64;
+/* Inflates a zlib stream straight into a std::string. If the caller knows
+ * the uncompressed size (from a zip directory entry, say) it can pass it as
+ * the second parameter and we'll allocate exactly once; otherwise we guess
+ * and grow geometrically. */
 
 static int decompress_cb(lua_State* L)
 {
     size_t srcsize;
     const char* srcbuffer = luaL_checklstring(L, 1, &srcsize);
-
-    int outputchunks = 0;
-    uint8_t outputbuffer[64 * 1024];
+    size_t sizehint = luaL_optinteger(L, 2, 0);
 
     z_stream zs = {0};
     int i = inflateInit(&zs);
     if (i != Z_OK)
         return 0;
 
+    std::string output;
+    output.resize(sizehint ? sizehint : std::max<size_t>(srcsize * 4, 1024));
+
     zs.avail_in = srcsize;
     zs.next_in = (uint8_t*)srcbuffer;
-
-    luaL_checkstack(L, STACKSIZE, "out of memory");
+    size_t used = 0;
     do
     {
-        zs.avail_out = sizeof(outputbuffer);
-        zs.next_out = outputbuffer;
+        if (used == output.size())
+            output.resize(output.size() * 2);
+
+        zs.avail_out = output.size() - used;
+        zs.next_out = (uint8_t*)&output[used];
 
         i = inflate(&zs, Z_NO_FLUSH);
+        used = output.size() - zs.avail_out;
         switch (i)
         {
+            case Z_BUF_ERROR:
+                /* No progress possible: either the output buffer is full and
+                 * will be grown, or the input is truncated. */
+                if (zs.avail_out == 0)
+                    break;
+                /* fall through */
             case Z_NEED_DICT:
             case Z_DATA_ERROR:
             case Z_MEM_ERROR:
                 (void)inflateEnd(&zs);
                 return 0;
         }
-
-        int have = sizeof(outputbuffer) - zs.avail_out;
-        lua_pushlstring(L, (char*)outputbuffer, have);
-        outputchunks++;
-
-        if (outputchunks == (STACKSIZE - 1))
-        {
-            /* Stack full! Concatenate what we've got, to empty the stack, and
-             * keep going. This will only happen on very large input files. */
-            lua_concat(L, outputchunks);
-            outputchunks = 1;
-        }
     } while (i != Z_STREAM_END);
 
     (void)inflateEnd(&zs);
 
-    lua_concat(L, outputchunks);
+    lua_pushlstring(L, output.data(), used);
     return 1;
 }
 
+/* deflateBound() tells us the worst-case output size, so compression happens
+ * in a single call into a single buffer. */
+
 static int compress_cb(lua_State* L)
 {
     size_t srcsize;
     const char* srcbuffer = luaL_checklstring(L, 1, &srcsize);
 
-    int outputchunks = 0;
-    uint8_t outputbuffer[64 * 1024];
-
     z_stream zs = {0};
     int i = deflateInit(&zs, 1);
     if (i != Z_OK)
         return 0;
 
+    std::string output;
+    output.resize(deflateBound(&zs, srcsize));
+
     zs.avail_in = srcsize;
     zs.next_in = (uint8_t*)srcbuffer;
+    zs.avail_out = output.size();
+    zs.next_out = (uint8_t*)&output[0];
 
-    luaL_checkstack(L, STACKSIZE, "out of memory");
-    do
+    i = deflate(&zs, Z_FINISH);
+    size_t used = output.size() - zs.avail_out;
+    (void)deflateEnd(&zs);
+    if (i != Z_STREAM_END)
+        return 0;
+
+    lua_pushlstring(L, output.data(), used);
+    return 1;
+}
+
+/* A streaming compressor, for exporters which want to compress their output
+ * as they generate it rather than building one huge string first. Each
+ * write() returns whatever compressed data is ready (possibly nothing), and
+ * finish() returns the rest; concatenated, they form an ordinary zlib stream
+ * readable by wg.decompress(). */
+
+struct Deflater
+{
+    z_stream zs;
+    bool open;
+};
+
+static const char DEFLATER[] = "wg.deflater";
+
+static void deflater_dtor(void* p)
+{
+    Deflater* d = (Deflater*)p;
+    if (d->open)
+        (void)deflateEnd(&d->zs);
+    d->open = false;
+}
+
+static Deflater* checkdeflater(lua_State* L, int index)
+{
+    Deflater* d = (Deflater*)luaL_checkudata(L, index, DEFLATER);
+    if (!d->open)
+        luaL_error(L, "deflater has already been finished");
+    return d;
+}
+
+static void pushdeflated(
+    lua_State* L, Deflater* d, const char* data, size_t len, int flush)
+{
+    std::string output;
+    output.resize(deflateBound(&d->zs, len) + 64);
+    size_t used = 0;
+
+    d->zs.avail_in = len;
+    d->zs.next_in = (uint8_t*)data;
+    for (;;)
     {
-        zs.avail_out = sizeof(outputbuffer);
-        zs.next_out = outputbuffer;
+        d->zs.avail_out = output.size() - used;
+        d->zs.next_out = (uint8_t*)&output[used];
+
+        int i = deflate(&d->zs, flush);
+        used = output.size() - d->zs.avail_out;
+        if ((i == Z_STREAM_END) || ((flush == Z_NO_FLUSH) && !d->zs.avail_in))
+            break;
+        if ((i != Z_OK) && (i != Z_BUF_ERROR))
+            luaL_error(L, "compression failed: %s", zError(i));
+        if (d->zs.avail_out == 0)
+            output.resize(output.size() * 2);
+    }
 
-        i = deflate(&zs, Z_FINISH);
+    lua_pushlstring(L, output.data(), used);
+}
 
-        int have = sizeof(outputbuffer) - zs.avail_out;
-        lua_pushlstring(L, (char*)outputbuffer, have);
-        outputchunks++;
+static int deflater_cb(lua_State* L)
+{
+    int level = luaL_optinteger(L, 1, 1);
 
-        if (outputchunks == (STACKSIZE - 1))
-        {
-            /* Stack full! Concatenate what we've got, to empty the stack, and
-             * keep going. This will only happen on very large input files. */
-            lua_concat(L, outputchunks);
-            outputchunks = 1;
-        }
-    } while (i != Z_STREAM_END);
+    Deflater* d = (Deflater*)lua_newuserdatadtor(
+        L, sizeof(Deflater), deflater_dtor);
+    *d = {};
+    luaL_getmetatable(L, DEFLATER);
+    lua_setmetatable(L, -2);
 
-    (void)deflateEnd(&zs);
+    if (deflateInit(&d->zs, level) != Z_OK)
+        return 0;
+    d->open = true;
+    return 1;
+}
 
-    lua_concat(L, outputchunks);
+static int deflater_write_cb(lua_State* L)
+{
+    Deflater* d = checkdeflater(L, 1);
+    size_t len;
+    const char* data = luaL_checklstring(L, 2, &len);
+
+    pushdeflated(L, d, data, len, Z_NO_FLUSH);
+    return 1;
+}
+
+static int deflater_finish_cb(lua_State* L)
+{
+    Deflater* d = checkdeflater(L, 1);
+    size_t len = 0;
+    const char* data = luaL_optlstring(L, 2, "", &len);
+
+    pushdeflated(L, d, data, len, Z_FINISH);
+    deflater_dtor(d);
     return 1;
 }
 
@@ -136,61 +229,773 @@ static int readfromzip_cb(lua_State* L)
     return result;
 }
 
-static int writezip_cb(lua_State* L)
+/* A zip file mapped into memory, shared between an archive (see
+ * wg.openzip()) and any readers opened from it; minizip reads it through
+ * the functions below rather than with stdio. */
+
+struct ZipMapping
+{
+    MappedFile mf = {};
+
+    ~ZipMapping()
+    {
+        unmapfile(&mf);
+    }
+};
+
+struct ZipStream
+{
+    const ZipMapping* mapping;
+    ZPOS64_T pos;
+};
+
+static voidpf ZCALLBACK mapping_open(
+    voidpf opaque, const void* filename, int mode)
+{
+    if ((mode & ZLIB_FILEFUNC_MODE_READWRITEFILTER) != ZLIB_FILEFUNC_MODE_READ)
+        return NULL;
+    return new ZipStream{(const ZipMapping*)opaque, 0};
+}
+
+static uLong ZCALLBACK mapping_read(
+    voidpf opaque, voidpf stream, void* buf, uLong size)
+{
+    ZipStream* zs = (ZipStream*)stream;
+    const MappedFile& mf = zs->mapping->mf;
+    ZPOS64_T left = (zs->pos < mf.len) ? (mf.len - zs->pos) : 0;
+    uLong len = (uLong)std::min<ZPOS64_T>(size, left);
+    memcpy(buf, mf.data + zs->pos, len);
+    zs->pos += len;
+    return len;
+}
+
+static uLong ZCALLBACK mapping_write(
+    voidpf opaque, voidpf stream, const void* buf, uLong size)
+{
+    return 0;
+}
+
+static ZPOS64_T ZCALLBACK mapping_tell(voidpf opaque, voidpf stream)
+{
+    return ((ZipStream*)stream)->pos;
+}
+
+static long ZCALLBACK mapping_seek(
+    voidpf opaque, voidpf stream, ZPOS64_T offset, int origin)
+{
+    ZipStream* zs = (ZipStream*)stream;
+    ZPOS64_T len = zs->mapping->mf.len;
+    ZPOS64_T base;
+    switch (origin)
+    {
+        case ZLIB_FILEFUNC_SEEK_SET:
+            base = 0;
+            break;
+        case ZLIB_FILEFUNC_SEEK_CUR:
+            base = zs->pos;
+            break;
+        case ZLIB_FILEFUNC_SEEK_END:
+            base = len;
+            break;
+        default:
+            return -1;
+    }
+    if ((base + offset) > len)
+        return -1;
+    zs->pos = base + offset;
+    return 0;
+}
+
+static int ZCALLBACK mapping_close(voidpf opaque, voidpf stream)
+{
+    delete (ZipStream*)stream;
+    return 0;
+}
+
+static int ZCALLBACK mapping_error(voidpf opaque, voidpf stream)
+{
+    return 0;
+}
+
+static unzFile openmapping(const ZipMapping* mapping)
+{
+    zlib_filefunc64_def ff = {mapping_open,
+        mapping_read,
+        mapping_write,
+        mapping_tell,
+        mapping_seek,
+        mapping_close,
+        mapping_error,
+        (voidpf)mapping};
+    return unzOpen2_64("", &ff);
+}
+
+/* A single member of a zip file, inflated a chunk at a time as it's read, so
+ * that big members never have to be held in memory all at once. Readers
+ * opened from an archive keep its mapping alive. */
+
+struct ZipReader
+{
+    unzFile zf = NULL;
+    std::shared_ptr<ZipMapping> mapping;
+};
+
+static const char ZIPREADER[] = "wg.zipreader";
+
+static void closezipreader(ZipReader* zr)
+{
+    if (zr->zf)
+    {
+        unzCloseCurrentFile(zr->zf);
+        unzClose(zr->zf);
+    }
+    zr->zf = NULL;
+    zr->mapping.reset();
+}
+
+static void zipreader_dtor(void* p)
+{
+    ZipReader* zr = (ZipReader*)p;
+    closezipreader(zr);
+    zr->~ZipReader();
+}
+
+static ZipReader* newzipreader(lua_State* L)
+{
+    ZipReader* zr = (ZipReader*)lua_newuserdatadtor(
+        L, sizeof(ZipReader), zipreader_dtor);
+    new (zr) ZipReader();
+    luaL_getmetatable(L, ZIPREADER);
+    lua_setmetatable(L, -2);
+    return zr;
+}
+
+/* Returns the zip reader at index, or NULL if it's something else. */
+
+ZipReader* tozipreader(lua_State* L, int index)
+{
+    void* p = lua_touserdata(L, index);
+    if (!p || !lua_getmetatable(L, index))
+        return NULL;
+    luaL_getmetatable(L, ZIPREADER);
+    bool matches = lua_rawequal(L, -1, -2);
+    lua_pop(L, 2);
+    return matches ? (ZipReader*)p : NULL;
+}
+
+/* Reads up to len bytes; returns how many were read, 0 at the end (or if the
+ * reader's been closed), or -1 on error. */
+
+int readzipreader(ZipReader* zr, char* buffer, size_t len)
+{
+    if (!zr->zf)
+        return 0;
+    int i = unzReadCurrentFile(zr->zf, buffer, len);
+    return (i < 0) ? -1 : i;
+}
+
+static int zipreader_cb(lua_State* L)
 {
     const char* zipname = luaL_checkstring(L, 1);
-    luaL_checktype(L, 2, LUA_TTABLE);
-    int result = 0;
+    const char* subname = luaL_checkstring(L, 2);
 
-    zipFile zf = zipOpen(zipname, APPEND_STATUS_CREATE);
-    if (zf)
+    ZipReader* zr = newzipreader(L);
+    zr->zf = unzOpen(zipname);
+    if (!zr->zf)
+        return 0;
+    if ((unzLocateFile(zr->zf, subname, 0) != UNZ_OK) ||
+        (unzOpenCurrentFile(zr->zf) != UNZ_OK))
+    {
+        unzClose(zr->zf);
+        zr->zf = NULL;
+        return 0;
+    }
+    return 1;
+}
+
+/* Returns the next (up to) len bytes, or nil at the end. */
+
+static int zipreader_read_cb(lua_State* L)
+{
+    ZipReader* zr = (ZipReader*)luaL_checkudata(L, 1, ZIPREADER);
+    size_t len = luaL_optinteger(L, 2, 65536);
+
+    std::string buffer(len, '\0');
+    int i = readzipreader(zr, &buffer[0], len);
+    if (i < 0)
+        luaL_error(L, "zip member could not be read");
+    if (i == 0)
+        return 0;
+    lua_pushlstring(L, buffer.data(), i);
+    return 1;
+}
+
+static int zipreader_close_cb(lua_State* L)
+{
+    closezipreader((ZipReader*)luaL_checkudata(L, 1, ZIPREADER));
+    return 0;
+}
+
+/* A whole zip file, opened once: the file is mapped into memory and its
+ * directory read when it's opened, so finding a member afterwards is just a
+ * lookup, however many are read. */
+
+struct ZipArchive
+{
+    unzFile zf = NULL;
+    std::shared_ptr<ZipMapping> mapping;
+    std::vector<std::string> names; /* in directory order */
+    std::unordered_map<std::string, unz64_file_pos> entries;
+};
+
+static const char ZIPARCHIVE[] = "wg.ziparchive";
+
+static void closeziparchive(ZipArchive* za)
+{
+    if (za->zf)
+        unzClose(za->zf);
+    za->zf = NULL;
+    za->mapping.reset();
+}
+
+static void ziparchive_dtor(void* p)
+{
+    ZipArchive* za = (ZipArchive*)p;
+    closeziparchive(za);
+    za->~ZipArchive();
+}
+
+static ZipArchive* checkziparchive(lua_State* L, int index)
+{
+    ZipArchive* za = (ZipArchive*)luaL_checkudata(L, index, ZIPARCHIVE);
+    if (!za->zf)
+        luaL_error(L, "zip archive has been closed");
+    return za;
+}
+
+/* Returns where the named member is in the directory, or NULL if there
+ * isn't one. */
+
+static const unz64_file_pos* findzipentry(ZipArchive* za, const char* name)
+{
+    auto i = za->entries.find(name);
+    if (i == za->entries.end())
+        return NULL;
+    return &i->second;
+}
+
+/* Returns the archive, or nil and an error. */
+
+static int openzip_cb(lua_State* L)
+{
+    const char* zipname = luaL_checkstring(L, 1);
+
+    auto mapping = std::make_shared<ZipMapping>();
+    if (!mapfile(zipname, &mapping->mf))
     {
-        result = 1;
+        lua_pushnil(L);
+        lua_pushstring(L, strerror(errno));
+        return 2;
+    }
+
+    ZipArchive* za = (ZipArchive*)lua_newuserdatadtor(
+        L, sizeof(ZipArchive), ziparchive_dtor);
+    new (za) ZipArchive();
+    luaL_getmetatable(L, ZIPARCHIVE);
+    lua_setmetatable(L, -2);
 
+    za->zf = openmapping(mapping.get());
+    if (!za->zf)
+    {
         lua_pushnil(L);
-        while (lua_next(L, 2) != 0)
+        lua_pushliteral(L, "not a zip file");
+        return 2;
+    }
+    za->mapping = std::move(mapping);
+
+    for (int i = unzGoToFirstFile(za->zf); i == UNZ_OK;
+        i = unzGoToNextFile(za->zf))
+    {
+        unz_file_info64 fi;
+        char name[1024];
+        unz64_file_pos pos;
+        if ((unzGetCurrentFileInfo64(
+                 za->zf, &fi, name, sizeof(name), NULL, 0, NULL, 0) !=
+                UNZ_OK) ||
+            (unzGetFilePos64(za->zf, &pos) != UNZ_OK))
+            break;
+        if (za->entries.emplace(name, pos).second)
+            za->names.push_back(name);
+    }
+    return 1;
+}
+
+/* Returns the names of all the members, in the order they're stored. */
+
+static int ziparchive_list_cb(lua_State* L)
+{
+    ZipArchive* za = checkziparchive(L, 1);
+
+    lua_createtable(L, za->names.size(), 0);
+    for (size_t i = 0; i < za->names.size(); i++)
+    {
+        const std::string& name = za->names[i];
+        lua_pushlstring(L, name.data(), name.size());
+        lua_rawseti(L, -2, i + 1);
+    }
+    return 1;
+}
+
+/* Returns the whole of the named member, or nil if it isn't there or can't
+ * be read. */
+
+static int ziparchive_read_cb(lua_State* L)
+{
+    ZipArchive* za = checkziparchive(L, 1);
+    const char* name = luaL_checkstring(L, 2);
+
+    const unz64_file_pos* pos = findzipentry(za, name);
+    if (!pos || (unzGoToFilePos64(za->zf, pos) != UNZ_OK))
+        return 0;
+
+    unz_file_info64 fi;
+    if ((unzGetCurrentFileInfo64(za->zf, &fi, NULL, 0, NULL, 0, NULL, 0) !=
+            UNZ_OK) ||
+        (unzOpenCurrentFile(za->zf) != UNZ_OK))
+        return 0;
+
+    std::string buffer(fi.uncompressed_size, '\0');
+    int i = unzReadCurrentFile(za->zf, &buffer[0], buffer.size());
+    unzCloseCurrentFile(za->zf);
+    if ((i < 0) || ((size_t)i != buffer.size()))
+        return 0;
+
+    lua_pushlstring(L, buffer.data(), buffer.size());
+    return 1;
+}
+
+/* Returns a reader (as wg.zipreader() does) for the named member, or nil if
+ * it isn't there. Each reader has a handle of its own onto the mapping, so
+ * any number can be open at once, and they outlive the archive. */
+
+static int ziparchive_open_cb(lua_State* L)
+{
+    ZipArchive* za = checkziparchive(L, 1);
+    const char* name = luaL_checkstring(L, 2);
+
+    const unz64_file_pos* pos = findzipentry(za, name);
+    if (!pos)
+        return 0;
+
+    ZipReader* zr = newzipreader(L);
+    zr->zf = openmapping(za->mapping.get());
+    if (!zr->zf)
+        return 0;
+    zr->mapping = za->mapping;
+    if ((unzGoToFilePos64(zr->zf, pos) != UNZ_OK) ||
+        (unzOpenCurrentFile(zr->zf) != UNZ_OK))
+    {
+        closezipreader(zr);
+        return 0;
+    }
+    return 1;
+}
+
+static int ziparchive_close_cb(lua_State* L)
+{
+    closeziparchive((ZipArchive*)luaL_checkudata(L, 1, ZIPARCHIVE));
+    return 0;
+}
+
+/* Zip files are written with their members deflated in parallel, the way
+ * pigz does it: each member is cut into chunks, and each chunk is
+ * compressed as a raw deflate stream on a thread of its own, primed with
+ * the 32kB of data before it, and ended with a sync flush so that it stops
+ * on a byte boundary (the last one in a member is finished properly
+ * instead). Concatenated, the chunks are a single valid deflate stream. The
+ * result doesn't depend on how the threads are scheduled.
+ *
+ * The chunks are handed to minizip, as raw data, in the order they were
+ * submitted, along with the member headers; a bounded number are in flight
+ * at once, which keeps memory down and stops writing from getting too far
+ * behind. */
+
+static const size_t ZIPCHUNKSIZE = 128 * 1024;
+static const size_t ZIPWINDOWSIZE = 32 * 1024;
+
+struct DeflatedChunk
+{
+    std::string data;
+    uLong crc;
+    size_t len; /* uncompressed */
+    bool ok;
+};
+
+static DeflatedChunk deflatechunk(
+    std::string input, std::string dictionary, int level, bool last)
+{
+    DeflatedChunk c = {};
+    c.len = input.size();
+    c.crc = crc32(0, (const Bytef*)input.data(), input.size());
+
+    z_stream zs = {};
+    if (deflateInit2(&zs, level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) !=
+        Z_OK)
+        return c;
+    if (!dictionary.empty())
+        deflateSetDictionary(
+            &zs, (const Bytef*)dictionary.data(), dictionary.size());
+
+    c.data.resize(deflateBound(&zs, input.size()) + 16);
+    zs.avail_in = input.size();
+    zs.next_in = (Bytef*)input.data();
+    zs.avail_out = c.data.size();
+    zs.next_out = (Bytef*)&c.data[0];
+    int i = deflate(&zs, last ? Z_FINISH : Z_SYNC_FLUSH);
+    c.ok = last ? (i == Z_STREAM_END) : ((i == Z_OK) && !zs.avail_in);
+    c.data.resize(c.data.size() - zs.avail_out);
+    (void)deflateEnd(&zs);
+    return c;
+}
+
+struct ZipItem
+{
+    enum
+    {
+        BEGIN, /* opens a member */
+        DATA,  /* data for a stored member, written as is */
+        CHUNK, /* a compressed chunk */
+        END    /* closes a member */
+    } type;
+    std::string data; /* BEGIN: the name; DATA: the data */
+    int method;
+    int level;
+    std::future<DeflatedChunk> chunk;
+};
+
+struct ZipWriter
+{
+    zipFile zf = NULL;
+    bool failed = false;
+
+    /* The member being submitted. */
+    bool inmember = false;
+    bool deflated = false;
+    int level = 0;
+    std::string pending;
+    std::string window;
+
+    /* The member being written. */
+    uLong crc = 0;
+    ZPOS64_T size = 0;
+
+    std::deque<ZipItem> queue;
+};
+
+static size_t maxinflightchunks()
+{
+    return 2 * std::max(std::thread::hardware_concurrency(), 1U);
+}
+
+/* Hands the oldest queued item to minizip, waiting for it if need be. */
+
+static void writezipitem(ZipWriter* zw)
+{
+    ZipItem item = std::move(zw->queue.front());
+    zw->queue.pop_front();
+
+    switch (item.type)
+    {
+        case ZipItem::BEGIN:
+            zw->crc = 0;
+            zw->size = 0;
+            if (!zw->failed &&
+                (zipOpenNewFileInZip2(zw->zf,
+                     item.data.c_str(),
+                     NULL,
+                     NULL,
+                     0,
+                     NULL,
+                     0,
+                     NULL,
+                     item.method,
+                     item.level,
+                     item.method == Z_DEFLATED) != ZIP_OK))
+                zw->failed = true;
+            break;
+
+        case ZipItem::DATA:
+            if (!zw->failed &&
+                (zipWriteInFileInZip(
+                     zw->zf, item.data.data(), item.data.size()) != ZIP_OK))
+                zw->failed = true;
+            break;
+
+        case ZipItem::CHUNK:
         {
-            const char* key = lua_tostring(L, -2);
-            size_t valuelen;
-            const char* value = lua_tolstring(L, -1, &valuelen);
-
-            int i = zipOpenNewFileInZip(zf,
-                key,
-                NULL,
-                NULL,
-                0,
-                NULL,
-                0,
-                NULL,
-                Z_DEFLATED,
-                Z_DEFAULT_COMPRESSION);
-            if (i != ZIP_OK)
-            {
-                result = 0;
-                break;
-            }
+            DeflatedChunk c = item.chunk.get();
+            zw->crc = crc32_combine(zw->crc, c.crc, c.len);
+            zw->size += c.len;
+            if (!c.ok ||
+                (!zw->failed &&
+                    (zipWriteInFileInZip(zw->zf, c.data.data(), c.data.size()) !=
+                        ZIP_OK)))
+                zw->failed = true;
+            break;
+        }
 
-            i = zipWriteInFileInZip(zf, value, valuelen);
-            if (i != ZIP_OK)
-            {
-                result = 0;
+        case ZipItem::END:
+            if (zw->failed)
                 break;
+            if (item.method == Z_DEFLATED)
+            {
+                if (zipCloseFileInZipRaw64(zw->zf, zw->size, zw->crc) != ZIP_OK)
+                    zw->failed = true;
             }
+            else if (zipCloseFileInZip(zw->zf) != ZIP_OK)
+                zw->failed = true;
+            break;
+    }
+}
 
-            i = zipCloseFileInZip(zf);
-            if (i != ZIP_OK)
-            {
-                result = 0;
+static void queuezipitem(ZipWriter* zw, ZipItem item)
+{
+    zw->queue.push_back(std::move(item));
+
+    /* Write out whatever has finished, and wait for the oldest chunk if too
+     * many are in flight. */
+    size_t chunks = 0;
+    for (auto& i : zw->queue)
+        chunks += (i.type == ZipItem::CHUNK);
+    while (!zw->queue.empty())
+    {
+        ZipItem& front = zw->queue.front();
+        if (front.type == ZipItem::CHUNK)
+        {
+            bool ready = front.chunk.wait_for(std::chrono::seconds(0)) !=
+                         std::future_status::timeout;
+            if (!ready && (chunks <= maxinflightchunks()))
                 break;
-            }
+            chunks--;
+        }
+        writezipitem(zw);
+    }
+}
+
+static void submitzipchunk(ZipWriter* zw, std::string input, bool last)
+{
+    std::string dictionary = zw->window;
+    if (input.size() >= ZIPWINDOWSIZE)
+        zw->window.assign(input, input.size() - ZIPWINDOWSIZE, ZIPWINDOWSIZE);
+    else
+    {
+        zw->window += input;
+        if (zw->window.size() > ZIPWINDOWSIZE)
+            zw->window.erase(0, zw->window.size() - ZIPWINDOWSIZE);
+    }
+
+    ZipItem item = {ZipItem::CHUNK};
+    /* With only one core, threads would just get in the way. */
+    auto policy = (std::thread::hardware_concurrency() > 1)
+                      ? std::launch::async
+                      : std::launch::deferred;
+    item.chunk = std::async(policy,
+        deflatechunk,
+        std::move(input),
+        std::move(dictionary),
+        zw->level,
+        last);
+    queuezipitem(zw, std::move(item));
+}
+
+static void beginzipmember(
+    ZipWriter* zw, const char* name, int method, int level)
+{
+    ZipItem item = {ZipItem::BEGIN};
+    item.data = name;
+    item.method = method;
+    item.level = level;
+    queuezipitem(zw, std::move(item));
+
+    zw->inmember = true;
+    zw->deflated = (method == Z_DEFLATED);
+    zw->level = level;
+    zw->pending.clear();
+    zw->window.clear();
+}
 
-            lua_pop(L, 1); /* leave key on stack */
+static void writezipmember(ZipWriter* zw, const char* data, size_t len)
+{
+    if (!zw->deflated)
+    {
+        ZipItem item = {ZipItem::DATA};
+        item.data.assign(data, len);
+        queuezipitem(zw, std::move(item));
+        return;
+    }
+
+    zw->pending.append(data, len);
+    if (zw->pending.size() >= ZIPCHUNKSIZE)
+    {
+        size_t used = 0;
+        while ((zw->pending.size() - used) >= ZIPCHUNKSIZE)
+        {
+            submitzipchunk(
+                zw, zw->pending.substr(used, ZIPCHUNKSIZE), false);
+            used += ZIPCHUNKSIZE;
         }
+        zw->pending.erase(0, used);
+    }
+}
+
+static void endzipmember(ZipWriter* zw)
+{
+    if (!zw->inmember)
+        return;
+    if (zw->deflated)
+        submitzipchunk(zw, std::move(zw->pending), true);
+    zw->pending.clear();
+    zw->window.clear();
+
+    ZipItem item = {ZipItem::END};
+    item.method = zw->deflated ? Z_DEFLATED : 0;
+    queuezipitem(zw, std::move(item));
+    zw->inmember = false;
+}
+
+/* Finishes everything off and closes the file, returning whether it all
+ * worked. */
+
+static bool closezipwriter(ZipWriter* zw)
+{
+    if (!zw->zf)
+        return false;
+    endzipmember(zw);
+    while (!zw->queue.empty())
+        writezipitem(zw);
+    bool ok = (zipClose(zw->zf, NULL) == ZIP_OK) && !zw->failed;
+    zw->zf = NULL;
+    return ok;
+}
+
+static int writezip_cb(lua_State* L)
+{
+    const char* zipname = luaL_checkstring(L, 1);
+    luaL_checktype(L, 2, LUA_TTABLE);
+
+    ZipWriter zw;
+    zw.zf = zipOpen(zipname, APPEND_STATUS_CREATE);
+    if (!zw.zf)
+        return 0;
+
+    lua_pushnil(L);
+    while (lua_next(L, 2) != 0)
+    {
+        const char* key = lua_tostring(L, -2);
+        size_t valuelen;
+        const char* value = lua_tolstring(L, -1, &valuelen);
+
+        beginzipmember(&zw, key, Z_DEFLATED, Z_DEFAULT_COMPRESSION);
+        writezipmember(&zw, value, valuelen);
+        endzipmember(&zw);
+
+        lua_pop(L, 1); /* leave key on stack */
+    }
+
+    if (!closezipwriter(&zw))
+        return 0;
+    lua_pushboolean(L, true);
+    return 1;
+}
+
+/* A zip file which is written one member at a time, with each member's data
+ * supplied in chunks; this lets exporters stream large members straight into
+ * the compressor. Members may be stored ("store"), quickly compressed
+ * ("fast"), or compressed at zlib's default level (the default). As the
+ * compression happens on other threads, failures may not be reported until
+ * later calls, or close(). */
+
+static const char ZIPWRITER[] = "wg.zipwriter";
+
+static void zipwriter_dtor(void* p)
+{
+    ZipWriter* zw = (ZipWriter*)p;
+    closezipwriter(zw);
+    zw->~ZipWriter();
+}
 
-        zipClose(zf, NULL);
+static ZipWriter* checkzipwriter(lua_State* L, int index)
+{
+    ZipWriter* zw = (ZipWriter*)luaL_checkudata(L, index, ZIPWRITER);
+    if (!zw->zf)
+        luaL_error(L, "zip writer has already been closed");
+    return zw;
+}
+
+static int zipwriter_cb(lua_State* L)
+{
+    const char* zipname = luaL_checkstring(L, 1);
+
+    ZipWriter* zw = (ZipWriter*)lua_newuserdatadtor(
+        L, sizeof(ZipWriter), zipwriter_dtor);
+    new (zw) ZipWriter();
+    luaL_getmetatable(L, ZIPWRITER);
+    lua_setmetatable(L, -2);
+
+    zw->zf = zipOpen(zipname, APPEND_STATUS_CREATE);
+    if (!zw->zf)
+        return 0;
+    return 1;
+}
+
+static int zipwriter_begin_cb(lua_State* L)
+{
+    static const char* const methods[] = {"default", "fast", "store", NULL};
+
+    ZipWriter* zw = checkzipwriter(L, 1);
+    const char* name = luaL_checkstring(L, 2);
+    int zmethod = Z_DEFLATED;
+    int level = Z_DEFAULT_COMPRESSION;
+    switch (luaL_checkoption(L, 3, "default", methods))
+    {
+        case 1:
+            level = 1;
+            break;
+
+        case 2:
+            zmethod = 0;
+            level = 0;
+            break;
     }
 
-    if (!result)
+    endzipmember(zw);
+    beginzipmember(zw, name, zmethod, level);
+    if (zw->failed)
+        return 0;
+    lua_pushboolean(L, true);
+    return 1;
+}
+
+static int zipwriter_write_cb(lua_State* L)
+{
+    ZipWriter* zw = checkzipwriter(L, 1);
+    size_t len;
+    const char* data = luaL_checklstring(L, 2, &len);
+    if (!zw->inmember)
+        luaL_error(L, "no zip member has been begun");
+
+    writezipmember(zw, data, len);
+    if (zw->failed)
+        return 0;
+    lua_pushboolean(L, true);
+    return 1;
+}
+
+static int zipwriter_close_cb(lua_State* L)
+{
+    ZipWriter* zw = checkzipwriter(L, 1);
+
+    if (!closezipwriter(zw))
         return 0;
     lua_pushboolean(L, true);
     return 1;
@@ -201,10 +1006,65 @@ void zip_init(void)
     const static luaL_Reg funcs[] = {
         {"compress",    compress_cb   },
         {"decompress",  decompress_cb },
+        {"deflater",    deflater_cb   },
+        {"openzip",     openzip_cb    },
         {"readfromzip", readfromzip_cb},
         {"writezip",    writezip_cb   },
+        {"zipreader",   zipreader_cb  },
+        {"zipwriter",   zipwriter_cb  },
         {NULL,          NULL          }
     };
 
+    const static luaL_Reg deflatermethods[] = {
+        {"write",  deflater_write_cb },
+        {"finish", deflater_finish_cb},
+        {NULL,     NULL              }
+    };
+
+    luaL_newmetatable(L, DEFLATER);
+    lua_newtable(L);
+    luaL_register(L, NULL, deflatermethods);
+    lua_setfield(L, -2, "__index");
+    lua_pop(L, 1);
+
+    const static luaL_Reg zipreadermethods[] = {
+        {"read",  zipreader_read_cb },
+        {"close", zipreader_close_cb},
+        {NULL,    NULL              }
+    };
+
+    luaL_newmetatable(L, ZIPREADER);
+    lua_newtable(L);
+    luaL_register(L, NULL, zipreadermethods);
+    lua_setfield(L, -2, "__index");
+    lua_pop(L, 1);
+
+    const static luaL_Reg ziparchivemethods[] = {
+        {"list",  ziparchive_list_cb },
+        {"read",  ziparchive_read_cb },
+        {"open",  ziparchive_open_cb },
+        {"close", ziparchive_close_cb},
+        {NULL,    NULL               }
+    };
+
+    luaL_newmetatable(L, ZIPARCHIVE);
+    lua_newtable(L);
+    luaL_register(L, NULL, ziparchivemethods);
+    lua_setfield(L, -2, "__index");
+    lua_pop(L, 1);
+
+    const static luaL_Reg zipwritermethods[] = {
+        {"begin", zipwriter_begin_cb},
+        {"write", zipwriter_write_cb},
+        {"close", zipwriter_close_cb},
+        {NULL,    NULL              }
+    };
+
+    luaL_newmetatable(L, ZIPWRITER);
+    lua_newtable(L);
+    luaL_register(L, NULL, zipwritermethods);
+    lua_setfield(L, -2, "__index");
+    lua_pop(L, 1);
+
     luaL_register(L, "wg", funcs);
 }
@@ -5,34 +5,56 @@
 
 -- Global definitions that the various source files need.
 
-declare function AddEventListener(event: Event, callback: EventCallback)
+declare function AddEventListener(event: Event, callback: EventCallback, active: (() -> boolean)?, priority: number?)
 declare function CLIError(...: string)
 declare function CentreInField(x: number, y: number, w: number, s: string)
+declare function CliConcat(outputfile: string, ...: string): never
 declare function CliConvert(opt1: string, opt2: string): never
+declare function CliConvertBatch(manifest: string): never
+declare function CliExportAll(inputfile: string, template: string): never
+declare function CliServe(socket: string): {string}
 declare function CreateDocument(): Document
 declare function CreateDocumentSet(): DocumentSet
 declare function CreateMenuTree(): MenuTree
+declare function DiscardUndoSpill()
 declare function EngageCLI()
+declare function FlushDerivedData()
+declare function GetIndexedParagraphs(document: Document, match: (string) -> boolean): {number}?
+declare function GetIncrementalFindHighlights(pn: number): {{number}}?
 declare function GetMaximumAllowedWidth(w: number): number
+declare function GetOutlineFolds(document: Document, cp: number?): ((number) -> (number?, number?))?
 declare function GetScrollMode(): string
+declare function GetSpellcheckerGeneration(): number
+declare function ImmediateMessage(text: string)
+declare function IsRecordingLatencies(): boolean
 declare function LAlignInField(x: number, y: number, w: number, s: string)
 declare function LoadFromFile(filename: string): any?
+declare function LoadHeaderFromFile(filename: string): (any?, string?)
+declare function LookupDerivedData(kind: string, p: Paragraph): {number}?
 declare function ModalMessage(title: string?, message: string)
+declare function PollWorkers(timeout: number?)
 declare function RAlignInField(x: number, y: number, w: number, s: string)
 declare function RebuildParagraphStylesMenu(styles: DocumentStyles)
 declare function RebuildDocumentsMenu(s: {Document})
+declare function RecordLatency(name: string, dispatch: number, screen: number)
 declare function ResizeScreen()
 declare function SaveToFile(filename: string, object: any): (boolean, string?)
 declare function SetColour(fg: Colour?, bg: Colour?)
+declare function SetParagraphColour(style: string)
 declare function SetTheme(theme: string)
+declare function GetCurrentStyleHint(): number
 declare function SetCurrentStyleHint(sor: number, sand: number)
 declare function SpellcheckerOff(): boolean
 declare function SpellcheckerRestore(state: boolean)
+declare function StoreDerivedData(kind: string, p: Paragraph, values: {number})
 declare function UnSmartquotify(s: string): string
+declare function UpgradeDocumentContents(document: Document, oldversion: number)
 declare function UpdateDocumentStyles()
 declare function WantDenseParagraphLayout(): boolean
 declare function WantFullStopSpaces(): boolean
 declare function WantTerminators(): boolean
+declare function WantBlinkingCursor(): boolean
+declare function RequestIdle(delay: number)
 declare function NonmodalMessage(s: string)
 declare function QueueRedraw()
 
@@ -44,6 +66,7 @@ declare Form: {[string]: any}
 declare MenuTree: {[string]: any}
 declare M: {[string]: any}
 declare GlobalSettings: {[string]: {[any]: any}}
+declare LuaExporters: {[string]: (writer: (...string) -> (), document: Document) -> ()}
 
 type Colour = {number}
 type ColourMap = {[string]: Colour}
@@ -63,21 +86,56 @@ declare ESCAPE_KEY: string
 declare BLINK_ON_TIME: number
 declare BLINK_OFF_TIME: number
 declare IDLE_TIME: number
+declare PREWRAP_SLICE: number
+declare PREWRAP_POLL: number
+declare MAX_REDRAW_DELAY: number
+declare TASK_SLICE: number
+declare GC_IDLE_DELAY: number
+declare GC_IDLE_SLICE: number
+declare GC_FRAME_SLICE: number
 
 BLINK_ON_TIME = 0.8
 BLINK_OFF_TIME = 0.53
 IDLE_TIME = (BLINK_ON_TIME + BLINK_OFF_TIME) * 5
+PREWRAP_SLICE = 0.002
+PREWRAP_POLL = 0.001
+MAX_REDRAW_DELAY = 0.1
+TASK_SLICE = 0.05
+GC_IDLE_DELAY = 0.25
+GC_IDLE_SLICE = 0.004
+GC_FRAME_SLICE = 0.0005
 
 type StatusbarField = {
 	priority: number,
 	value: string
 }
 
+-- Passed to BuildStatusBar listeners, which call add() for each field they
+-- want shown; the fields are shown in order of priority.
+type StatusBar = {
+	add: (StatusBar, priority: number, value: string) -> (),
+	[number]: StatusbarField,
+}
+
+-- A statusbar field made with AddStatusBarField(), whose value is kept
+-- until something it shows changes.
+type CachedStatusbarField = {
+	priority: number,
+	build: () -> string?,
+	interval: number?,
+	value: string?,
+	dirty: boolean,
+	expires: number,
+}
+
 -- Polyfills for Luau.
 
 function loadfile(filename: string)
 	local data, e = wg.readfile(filename)
 	if data then
+		-- Allow #! lines, so scripts can be run directly; the line is
+		-- blanked rather than removed to keep the line numbers right.
+		data = data:gsub("^#![^\n]*", "")
 		return loadstring(data, filename)
 	end
 	return nil, e
@@ -9,75 +9,275 @@ export type InputEvent = KeyboardEvent | MouseEvent
 
 export type Stat = {
 	size: number,
+	mode: string,
+	mtime: number?, -- files only
+}
+
+export type DirectoryEntry = {
+	name: string,
 	mode: string
 }
 
+export type AllocStats = {
+	total: number,
+	allocations: number,
+	reused: number,
+	live: number,
+	peak: number,
+	cached: number,
+	objects: number,
+	maxrss: number?,
+	classes: {[number]: number},
+}
+
+export type HeapCounts = {
+	bytes: number,
+	objects: number,
+}
+
+-- How a document set is saved: v3, v4 or v5 respectively.
+export type SaveFormat = "text" | "compressed" | "wordtable"
+
+export type MappedFile = {
+	len: (MappedFile) -> number,
+	sub: (MappedFile, number?, number?) -> string,
+	find: (MappedFile, string, number?, boolean?) -> (number?, number?),
+	lines: (MappedFile, number?) -> (() -> string?),
+	close: (MappedFile) -> (),
+}
+
+export type TextView = {
+	lines: (TextView) -> number,
+	len: (TextView) -> number,
+	words: (TextView, number) -> {string},
+	offset: (TextView, number) -> number,
+	find: (TextView, string, boolean, number, number)
+		-> (number?, number, number, number, number, number),
+	close: (TextView) -> (),
+}
+
+export type Dictionary = {
+	add: (Dictionary, string) -> (),
+	contains: (Dictionary, string) -> boolean,
+	poll: (Dictionary, boolean?) -> boolean,
+	remove: (Dictionary, string) -> boolean,
+	suggest: (Dictionary, string, number?) -> ({string}, {number}),
+	words: (Dictionary) -> {string},
+}
+
+export type Scan = {
+	poll: (Scan, number?) -> (boolean?, number | string, number?),
+	entries: (Scan, string?) -> {DirectoryEntry},
+}
+
+export type Job = {
+	poll: (Job, number?) -> (boolean?, string?),
+}
+
+export type Deflater = {
+	write: (Deflater, string) -> string,
+	finish: (Deflater, string?) -> string,
+}
+
+export type ZipReader = {
+	read: (ZipReader, number?) -> string?,
+	close: (ZipReader) -> (),
+}
+
+export type ZipArchive = {
+	list: (ZipArchive) -> {string},
+	read: (ZipArchive, string) -> string?,
+	open: (ZipArchive, string) -> ZipReader?,
+	close: (ZipArchive) -> (),
+}
+
+export type Writer = {
+	write: (Writer, ...string) -> (),
+	close: (Writer) -> (boolean?, string?, number?),
+}
+
+export type ZipWriter = {
+	begin: (ZipWriter, string, string?) -> boolean?,
+	write: (ZipWriter, string) -> boolean?,
+	close: (ZipWriter) -> boolean?,
+}
+
+export type PackedWords = {
+	join: (PackedWords) -> string,
+}
+
 export type Markdown = any
 export type MarkdownIterator = any
+export type MarkdownParagraph = {[number]: string, style: string}
 
 declare wg: {
 	access: (string, number) -> (boolean, string?, number?),
+	allocstats: () -> AllocStats,
+	appendfile: (string, string) -> (boolean, string?, number?),
+	applystyletoparagraph: (any, number, number, number, number, number, number, number?, number?) -> ({string}?, number),
 	applystyletoword: (string, number, number, number, number, number) -> (string, number),
 	chdir: (string) -> (boolean, string?, number?),
+	checksum: (string | MappedFile) -> number,
+	checkregex: (string) -> string?,
 	cleararea: (number, number, number, number) -> (),
 	clearscreen: () -> (),
 	cleartoeol: () -> (),
 	clipboard_get: () -> (string?, string?),
 	clipboard_set: (string?, string?) -> (),
+	concatdocumentsets: (string, {string}) -> (boolean?, string?, number?),
+	collectgarbage: () -> (),
+	combinehashes: ({string}, number, number) -> string,
 	compress: (string) -> string,
+	countlines: (any, number, number, number, boolean) -> number,
+	createdictionary: () -> Dictionary,
+	createhashedparagraph: (string, ...any) -> (any, string),
+	createparagraph: (string, ...any) -> any,
+	createimporter: ((string, {string}) -> ()) -> any,
 	createstylebyte: (number) -> string,
-	decompress: (string) -> string,
+	decodeentities: (string) -> string,
+	decompress: (string, number?) -> string,
+	deflater: (number?) -> Deflater?,
 	deinitscreen: () -> (),
+	detachsession: (() -> boolean)?, -- terminal only
 	deletefromword: (string, number, number) -> string,
+	dictionary: (string, ...string) -> (Dictionary?, string?),
+	diff: ({string}, {string}) -> {{number}},
+	dumptrace: () -> string,
+	editdistance: (string, string, number?) -> number,
 	escape: (string) -> string,
+	escapehtml: (string, string?) -> string,
+	escapelatex: (string) -> string,
+	escapetroff: (string, boolean?) -> string,
 	exit: (number) -> (),
+	exportdocument: (any, string, any?, Writer?) -> string?,
+	exportdocuments: ({any}, {string}, string, any?) -> {true | string},
+	finishstartuptrace: (string?) -> (boolean?, string?),
+	findalltext: (any, string, string?, string?, string?, string?, boolean?)
+		-> {{number}},
+	findinparagraph: (any, string, number, string?, string?, string?, string?, boolean?)
+		-> {number},
+	findinparagraphs: (any, string, {number}?, string?, string?, string?, string?, boolean?)
+		-> {number},
+	findtext: (any, string, number, number, number, string?, string?, string?, string?, boolean?, number?, number?)
+		-> (number?, number?, number?, number?, number?, number?),
+	gcstats: () -> {steps: number, cycles: number, total: number, max: number, last: number},
+	gcstep: (number) -> boolean,
 	getboundedstring: (string, number) -> string,
 	getbytesofcharacter: (number) -> number,
 	getchar: (number?) -> InputEvent,
 	getcwd: () -> string,
+	getdrawcount: () -> number,
 	getenv: (string) -> string?,
+	getkeytime: () -> number?,
+	getoffsetfromwidth: (string, number) -> number,
+	getpackedword: (PackedWords, number) -> string?,
 	getscreensize: () -> (number, number),
 	getstringwidth: (string) -> number,
 	getstylefromword: (string, number) -> number,
+	getwidthfromoffset: (string, number) -> number,
 	getwordtext: (string) -> string,
 	getwordtext: (string) -> string,
 	gotoxy: (number, number) -> (),
+	heapreport: ({{any}}) -> ({HeapCounts}, HeapCounts),
 	hidecursor: () -> (),
+	htmltokens: (string) -> (() -> (string?, string)),
+	importtext: (string | MappedFile) -> {{string}},
 	initscreen: () -> (),
 	insertintoword: (string, string, number, number) -> (string, number?, number?),
+	isprofiling: () -> boolean,
+	istracing: () -> boolean,
+	loaddictionary: (string, ...string) -> (Dictionary?, string?),
+	loadfromcompressed: (string | MappedFile, number?) -> any,
+	loadfromlegacy: (string | MappedFile, number, boolean) -> any,
+	loadfromstring: (string | MappedFile, number?) -> any,
+	loadfromwordtable: (string | MappedFile, number?) -> any,
+	loadheader: (string | MappedFile, number?, (boolean | SaveFormat)?) -> any,
+	loadmodule: (string) -> (),
+	makecolour: (Colour, Colour) -> number,
+	mapfile: (string) -> (MappedFile?, string?, number?),
+	materialisedocument: (any) -> (),
+	materialisedocuments: ({any}) -> (),
 	mkdir: (string) -> (boolean, string?, number?),
 	mkdirs: (string) -> (boolean, string?, number?),
 	nextcharinword: (string, number) -> number?,
+	openwriter: (string) -> (Writer?, string?, number?),
+	openzip: (string) -> (ZipArchive?, string?),
+	packparagraphs: (boolean?) -> boolean,
+	packwords: ({string}) -> PackedWords,
+	paragraphhash: (any) -> string,
+	paragraphstats: (any) -> (number, number, number),
+	parseparagraph: (any) -> {any},
 	parseword: (string, number, (number, string) -> ()) -> (),
 	prevcharinword: (string, number) -> number?,
+	pollsave: (boolean?) -> (boolean?, number, number, string?, number?),
 	printerr: (...string) -> (),
 	printout: (...string) -> (),
 	readdir: (string) -> ({string}?, string?, number?),
 	readfile: (string) -> (string?, string?, number?),
 	readfromzip: (string, string) -> string?,
 	readu8: (string, number) -> (number, number),
+	recodedocumentset: (string | MappedFile, (boolean | SaveFormat)?)
+		-> (string?, string?),
+	recordkeys: (string?) -> (boolean?, string?, number?),
 	remove: (string) -> (boolean, string?, number?),
 	rename: (string, string) -> (boolean, string?, number?),
+	reportallocations: () -> (),
+	replacewords: (any, number, number, ...string) -> any,
+	savedocumentset: (string, any, (boolean | SaveFormat)?)
+		-> (boolean?, string?, number?),
+	savetostring: (any) -> string,
+	scandir: (string, string?) -> ({DirectoryEntry}?, string?, number?),
+	scrollarea: (number, number, number) -> (),
+	serve: (string) -> ({string}?, string?),
 	setbold: () -> (),
 	setbright: () -> (),
 	setcolour: (Colour, Colour) -> (),
+	setcursorblink: (boolean) -> boolean,
 	setdim: () -> (),
+	setgcmode: ("batch" | "interactive" | "typing") -> (),
 	setnormal: () -> (),
 	setreverse: () -> (),
 	setunderline: () -> (),
 	setunicode: (boolean) -> (),
 	showcursor: () -> (),
+	smartquoteparagraph: (any, string, string, string, string) -> {string}?,
+	spawn: (string, any) -> Job,
+	splitstring: (string, string) -> {string},
+	splitwords: (string) -> {string},
+	startprofiler: (string?) -> boolean,
+	startsession: ((string) -> (boolean?, string?))?, -- terminal only
+	startsave: (string, any, (boolean | SaveFormat)?) -> number,
+	startscandir: (string) -> Scan,
+	starttrace: (number?) -> (),
 	stat: (string) -> (Stat?, string?, number?),
+	stopprofiler: () -> string,
+	stoptrace: () -> (),
 	sync: () -> (),
 	time: () -> number,
+	tracebegin: (string) -> number,
+	traceend: (number?) -> (),
+	tracestartup: (string) -> (),
 	transcode: (string) -> string,
 	unescape: (string) -> string,
+	usecolour: (number) -> (),
 	useunicode: () -> boolean,
+	viewtext: (string) -> (TextView?, string?),
+	workercount: () -> number,
+	wordstats: (any) -> (number, number, number, number),
+	wrapparagraph: (any, number, number, number, boolean,
+		{{[number]: number, wn: number}}?, {number}?, {[number]: boolean}?,
+		number?, number?, number?) ->
+		({{[number]: number, wn: number}}, {number}, {[number]: boolean}),
 	write: (number, number, string) -> (),
 	writefile: (string, string) -> (boolean, string?, number?),
+	writeparagraphline: (number, any, {number}, number, {number}, number, {number}?, {number}?) -> number,
 	writestyled: (number, number, string, number, number, number, number) -> number,
+	writestyledline: (number, {number}, {string}, {number}, {number}?, {number}?) -> number,
 	writeu8: (number) -> string,
 	writezip: (string, {[string]: string}) -> boolean?,
+	xmltokens: (string | MappedFile | ZipReader) -> (() -> (string?, any, any, any)),
+	zipreader: (string, string) -> ZipReader?,
+	zipwriter: (string) -> ZipWriter?,
 
 	BOLD: number,
 	BRIGHT: number,
@@ -100,6 +300,7 @@ declare function CMarkIterate(node: Markdown): MarkdownIterator
 declare function CMarkNext(iter: MarkdownIterator): (number, number, Markdown, string?)
 declare function CMarkGetHeading(node: Markdown): number
 declare function CMarkGetList(node: Markdown): number
+declare function CMarkImport(data: string | MappedFile): {MarkdownParagraph}
 
 declare CMARK_EVENT_NONE: number
 declare CMARK_EVENT_DONE: number
@@ -17,13 +17,20 @@ local function announce()
 	end	
 end
 
+local TIMESTAMP = "%Y-%m-%d.%H%M"
+local TIMESTAMP_PATTERN = "%d%d%d%d%-%d%d%-%d%d%.%d%d%d%d"
+
+local function autosavedir(): string
+	return GlobalSettings.directories.autosaves or Dirname(documentSet.name)
+end
+
 local function makefilename(pattern: string)
 	local leafname = Leafname(documentSet.name)
-	local dirname = GlobalSettings.directories.autosaves or Dirname(documentSet.name)
+	local dirname = autosavedir()
 	leafname = leafname:gsub("%.wg$", "")
 	leafname = leafname:gsub("%%", "%%%%")
 	
-	local timestamp = os.date("%Y-%m-%d.%H%M")::string
+	local timestamp = os.date(TIMESTAMP)::string
 	timestamp = timestamp:gsub("%%", "%%%%")
 	
 	pattern = pattern:gsub("%%[fF]", leafname)
@@ -32,8 +39,102 @@ local function makefilename(pattern: string)
 	return dirname.."/"..pattern
 end
 
+-- Returns a Lua pattern matching the leafnames of all the autosaves which
+-- the filename pattern makes for this document set, whatever their time.
+local function matchfilename(pattern: string): string
+	local leafname = (Leafname(documentSet.name):gsub("%.wg$", ""))
+	local function escape(s: string): string
+		return (s:gsub("%W", "%%%0"))
+	end
+
+	local out = {"^"}
+	local i = 1
+	while i <= #pattern do
+		local c = pattern:sub(i, i)
+		if c == "%" then
+			local f = pattern:sub(i+1, i+1):lower()
+			if f == "f" then
+				out[#out+1] = escape(leafname)
+			elseif f == "t" then
+				out[#out+1] = TIMESTAMP_PATTERN
+			else
+				out[#out+1] = "%%"
+			end
+			i = i + 2
+		else
+			out[#out+1] = escape(c)
+			i = i + 1
+		end
+	end
+	out[#out+1] = "$"
+	return table.concat(out)
+end
+
+-- Returns the filenames of all the autosaves which the filename pattern has
+-- made for this document set, oldest first. As the only thing which differs
+-- between their names is the timestamp, sorting the names sorts them by age.
+local function listautosaves(pattern: string): {string}
+	local dirname = autosavedir()
+	local files = wg.readdir(dirname)
+	if not files then
+		return {}
+	end
+
+	local leafpattern = matchfilename(pattern)
+	local autosaves = {}
+	for _, f in files do
+		if f:find(leafpattern) then
+			autosaves[#autosaves+1] = dirname.."/"..f
+		end
+	end
+	table.sort(autosaves)
+	return autosaves
+end
+
+-- Deletes all but the newest few timestamped autosaves; returns true if
+-- there were any to delete.
+local function prune(settings: any): boolean
+	local keep = settings.keep or 0
+	local pattern = settings.pattern
+	if (keep <= 0) or not pattern:find("%%[tT]") or pattern:find("/") then
+		return false
+	end
+
+	local autosaves = listautosaves(pattern)
+	for i = 1, #autosaves - keep do
+		wg.remove(autosaves[i])
+	end
+	return #autosaves > keep
+end
+
+-- In store mode, the paragraphs of all of a document set's autosaves live
+-- in one pack file (see SaveToStore()).
+local function packfilename(): string
+	local leafname = Leafname(documentSet.name):gsub("%.wg$", "")
+	return autosavedir().."/"..leafname..".autosave.pack"
+end
+
+-- Identifies what's in the document set, cheaply: each document's name and
+-- generation (see Document.sync()). If this hasn't changed since the last
+-- autosave, there's no point writing the same thing out again. Documents
+-- which were never looked at since the load can't have changed.
+local function contentsignature(): string
+	local s = {}
+	for _, d in documentSet:getDocumentList() do
+		s[#s+1] = d.name
+		s[#s+1] = IsLazyDocument(d) and "-" or tostring(d:sync())
+	end
+	return table.concat(s, "\0")
+end
+
+local lastsignature: string? = nil
+
 -----------------------------------------------------------------------------
--- Idle handler. This actually does the work of autosaving.
+-- The autosave timer. This goes off when the next autosave is due, and
+-- actually does the work of autosaving.
+
+local timer: Timer? = nil
+local schedule: () -> ()
 
 do
 	local function cb()
@@ -46,25 +147,104 @@ do
 			settings.lastsaved = os.time()
 		end
 		
-		if ((os.time() - settings.lastsaved) > (settings.period * 60)) then
+		local due = settings.lastsaved + (settings.period * 60)
+		if os.time() <= due then
+			-- Not yet; the timer will be set for when it is.
+			return
+		else
+			local signature = contentsignature()
+			if signature == lastsignature then
+				settings.lastsaved = os.time()
+				return
+			end
+
 			ImmediateMessage("Autosaving...")
+
+			-- In journal mode, only the changes get written; but if the
+			-- document set has changed shape, fall back to a full copy.
+
+			if settings.journal then
+				local r, e = AppendToJournal()
+				if r then
+					NonmodalMessage("Journalled changes to "..documentSet.name)
+					QueueRedraw()
+					settings.lastsaved = os.time()
+					lastsignature = signature
+					return
+				elseif e then
+					ModalMessage("Autosave failed", "The journal could not be written: "..e)
+				end
+			end
 			
+			-- In store mode, only the paragraphs which haven't been saved
+			-- before get written, plus a manifest. That's small enough to
+			-- do here.
+
 			local filename = makefilename(settings.pattern)
-			local r, e = SaveDocumentSetRaw(filename)
-			
-			if not r then
-				assert(e)
-				ModalMessage("Autosave failed", "The document could not be autosaved: "..e)
-			else
-				NonmodalMessage("Autosaved as "..filename) 
-				QueueRedraw()
+			if settings.store then
+				local packname = packfilename()
+				local r, e = SaveToStore(filename, packname, documentSet)
+				if r and prune(settings) then
+					r, e = CompactStore(packname, listautosaves(settings.pattern))
+				end
+				if not r then
+					ModalMessage("Autosave failed", "The document could not be autosaved: "..
+						assert(e))
+				else
+					NonmodalMessage("Autosaved as "..filename)
+					QueueRedraw()
+					lastsignature = signature
+				end
+				settings.lastsaved = os.time()
+				return
 			end
+
+			-- The document set is serialised straight away and written on
+			-- the background saver's thread.
+
+			local ds = documentSet
+			SaveToFileInBackground(filename, documentSet,
+				function(r: boolean, e: string?)
+					if not r then
+						if lastsignature == signature then
+							lastsignature = nil
+						end
+						ModalMessage("Autosave failed", "The document could not be autosaved: "..
+							assert(e))
+					else
+						if ds == documentSet then
+							prune(settings)
+						end
+						NonmodalMessage("Autosaved as "..filename) 
+						QueueRedraw()
+					end
+				end, GetSaveFormat())
 			
 			settings.lastsaved = os.time()
+			lastsignature = signature
 		end
 	end
 	
-	AddEventListener("Idle", cb)
+	-- (Re)sets the timer for when the next autosave is due, or stops it if
+	-- autosave is off.
+	schedule = function()
+		if timer then
+			RemoveTimer(timer)
+			timer = nil
+		end
+		local settings = documentSet.addons.autosave
+		if not settings.enabled then
+			return
+		end
+		local lastsaved = settings.lastsaved or os.time()
+		local delay = math.max(0, lastsaved + (settings.period * 60) - os.time())
+		timer = AddTimer(delay + 1,
+			function()
+				timer = nil
+				cb()
+				schedule()
+			end)
+	end
 end
 
 -----------------------------------------------------------------------------
@@ -74,6 +254,8 @@ do
 	local function cb()
 		documentSet.addons.autosave = documentSet.addons.autosave or {}
 		documentSet.addons.autosave.lastsaved = nil
+		lastsignature = nil
+		schedule()
 		announce()
 	end
 	
@@ -87,9 +269,13 @@ do
 	local function cb()
 		documentSet.addons.autosave = documentSet.addons.autosave or {
 			enabled = false,
+			journal = false,
+			store = false,
 			period = 10,
 			pattern = "%F.autosave.%T.wg",
+			keep = 10,
 		}
+		schedule()
 	end
 	
 	AddEventListener("RegisterAddons", cb)
@@ -116,6 +302,22 @@ function Cmd.ConfigureAutosave()
 			value = settings.enabled
 		}
 
+	local journal_checkbox =
+		Form.Checkbox {
+			x1 = 1, y1 = 9,
+			x2 = -1, y2 = 9,
+			label = "Only journal changes to the document between saves",
+			value = settings.journal or false
+		}
+
+	local store_checkbox =
+		Form.Checkbox {
+			x1 = 1, y1 = 13,
+			x2 = -1, y2 = 13,
+			label = "Only store paragraphs which changed since the last autosave",
+			value = settings.store or false
+		}
+
 	local period_textfield =
 		Form.TextField {
 			x1 = 33, y1 = 3,
@@ -123,6 +325,13 @@ function Cmd.ConfigureAutosave()
 			value = tostring(settings.period)
 		}
 		
+	local keep_textfield =
+		Form.TextField {
+			x1 = 33, y1 = 11,
+			x2 = -1, y2 = 11,
+			value = tostring(settings.keep or 0)
+		}
+
 	local example_label =
 		Form.Label {
 			x1 = 1, y1 = 7,
@@ -153,7 +362,7 @@ function Cmd.ConfigureAutosave()
 	{
 		title = "Configure Autosave",
 		width = "large",
-		height = 9,
+		height = 15,
 		stretchy = false,
 
 		actions = {
@@ -181,6 +390,18 @@ function Cmd.ConfigureAutosave()
 			pattern_textfield,
 
 			example_label,
+
+			journal_checkbox,
+
+			Form.Label {
+				x1 = 1, y1 = 11,
+				x2 = 32, y2 = 11,
+				align = "left",
+				value = "Autosaves to keep (0 for all):"
+			},
+			keep_textfield,
+
+			store_checkbox,
 		}
 	}
 	
@@ -194,9 +415,13 @@ function Cmd.ConfigureAutosave()
 		local enabled = enabled_checkbox.value
 		local period = tonumber(period_textfield.value)
 		local pattern = pattern_textfield.value
+		local keep = tonumber(keep_textfield.value)
 		
 		if not period then
 			ModalMessage("Parameter error", "The period field must be a valid number.")
+		elseif not keep or (keep < 0) or (keep ~= math.floor(keep)) then
+			ModalMessage("Parameter error", "The number of autosaves to keep must "..
+				"be a whole number, or 0 to keep them all.")
 		elseif (pattern:len() == 0) then
 			ModalMessage("Parameter error", "The filename pattern cannot be empty.")
 		elseif pattern:find("%%[^%%ftFT]") then
@@ -204,10 +429,14 @@ function Cmd.ConfigureAutosave()
 				"%%, %F or %T fields.")
 		else
 			settings.enabled = enabled
+			settings.journal = journal_checkbox.value
+			settings.store = store_checkbox.value
 			settings.period = period
 			settings.pattern = pattern
+			settings.keep = keep
 			settings.lastsaved = nil
 			documentSet:touch()
+			schedule()
 
 			announce()			
 			return true
@@ -0,0 +1,219 @@
+--!nonstrict
+-- © 2026 David Given.
+-- WordGrinder is licensed under the MIT open source license. See the COPYING
+-- file in this distribution for the full text.
+
+-----------------------------------------------------------------------------
+-- Comparing the current document with another version of it, from a file.
+-- The documents are compared a paragraph at a time using the paragraphs'
+-- hashes, so the paragraphs themselves are only looked at where they differ;
+-- each changed paragraph is then compared with the one it replaced a word at
+-- a time. See diff.cc.
+
+local Diff = wg.diff
+local GetWordText = wg.getwordtext
+local table_concat = table.concat
+
+-- How much of each side of a change to show in the list.
+local MAXWORDS = 8
+
+type Difference = {
+	kind: "added" | "removed" | "changed",
+	pn: number, -- in the current document
+	wn: number, -- the first word which differs
+	label: string,
+}
+
+local function hashes(paragraphs: {Paragraph}): {string}
+	local h = {}
+	for i = 1, #paragraphs do
+		h[i] = paragraphs[i]:hash()
+	end
+	return h
+end
+
+local function words(p: Paragraph): {string}
+	local w = {}
+	for i = 1, #p do
+		w[i] = p[i]
+	end
+	return w
+end
+
+local function excerpt(p: Paragraph, first: number, count: number): string
+	local s = {}
+	for wn = first, math.min(first + count - 1, first + MAXWORDS - 1) do
+		s[#s+1] = GetWordText(p[wn])
+	end
+	if (count > MAXWORDS) then
+		s[#s+1] = "..."
+	end
+	return table_concat(s, " ")
+end
+
+-- Describes what changed between two versions of a paragraph, word by word.
+-- Returns the description and the first word which differs.
+local function describechange(old: Paragraph, new: Paragraph): (string, number)
+	local runs = Diff(words(old), words(new))
+	if (#runs == 0) then
+		return "style changed to "..new.style, 1
+	end
+
+	local s = {}
+	for i, r in runs do
+		local af, ac, bf, bc = r[1], r[2], r[3], r[4]
+		if (ac == 0) then
+			s[#s+1] = "+\""..excerpt(new, bf, bc).."\""
+		elseif (bc == 0) then
+			s[#s+1] = "-\""..excerpt(old, af, ac).."\""
+		else
+			s[#s+1] = "\""..excerpt(old, af, ac).."\" → \""
+				..excerpt(new, bf, bc).."\""
+		end
+		if (i == 3) and (#runs > 3) then
+			s[#s+1] = "..."
+			break
+		end
+	end
+	return table_concat(s, ", "), math.min(runs[1][3], #new)
+end
+
+--- Compares two versions of a document.
+--
+-- @param old                the paragraphs of the other version
+-- @param new                the paragraphs of the current version
+-- @return                   the differences, in order
+
+function CompareDocuments(old: {Paragraph}, new: {Paragraph}): {Difference}
+	local differences: {Difference} = {}
+	local function add(kind, pn: number, wn: number, label: string)
+		differences[#differences+1] = {
+			kind = kind,
+			pn = math.max(math.min(pn, #new), 1),
+			wn = wn,
+			label = label,
+		}
+	end
+
+	for _, r in Diff(hashes(old), hashes(new)) do
+		local af, ac, bf, bc = r[1], r[2], r[3], r[4]
+
+		-- Paragraphs which replaced others are paired up with them in order;
+		-- anything left over was added or removed.
+		local paired = math.min(ac, bc)
+		for i = 0, paired-1 do
+			local label, wn = describechange(old[af+i], new[bf+i])
+			add("changed", bf+i, wn, string.format("%d: %s", bf+i, label))
+		end
+		for i = paired, bc-1 do
+			local p = new[bf+i]
+			add("added", bf+i, 1, string.format("%d: added \"%s\"", bf+i,
+				excerpt(p, 1, #p)))
+		end
+		if (ac > paired) then
+			local p = old[af+paired]
+			local n = ac - paired
+			add("removed", bf+paired, 1, string.format("%d: removed %s \"%s\"",
+				bf+paired, n.." "..Pluralise(n, "paragraph", "paragraphs"),
+				excerpt(p, 1, #p)))
+		end
+	end
+	return differences
+end
+
+local function differencesbrowser(filename: string, data): number?
+	local browser = Form.Browser {
+		focusable = true,
+		type = Form.Browser,
+		x1 = 1, y1 = 2,
+		x2 = -1, y2 = -1,
+		data = data,
+		cursor = 1
+	}
+
+	local dialogue: Form =
+	{
+		title = "Differences",
+		width = "large",
+		height = "large",
+		stretchy = false,
+
+		actions = {
+			["KEY_RETURN"] = "confirm",
+			["KEY_ENTER"] = "confirm",
+		},
+
+		widgets = {
+			Form.Label {
+				x1 = 1, y1 = 1,
+				x2 = -1, y2 = 1,
+				value = "Changes since "..Leafname(filename)..":"
+			},
+
+			browser,
+		}
+	}
+
+	local result = Form.Run(dialogue, RedrawScreen,
+		"RETURN to go to change, "..ESCAPE_KEY.." to cancel")
+	QueueRedraw()
+	if result then
+		return browser.cursor
+	end
+	return nil
+end
+
+--- Compares the current document with the one of the same name in another
+-- file (or that file's current document, if there isn't one), and shows
+-- what's changed.
+--
+-- @param filename           the file to compare with, or nil to ask
+-- @return                   true if a change was picked to go to
+
+function Cmd.CompareWithFile(filename: string?): boolean
+	if not filename then
+		filename = FileBrowser("Compare With File", "Compare with:", false)
+		if not filename then
+			return false
+		end
+	end
+	assert(filename)
+
+	ImmediateMessage("Loading "..filename.."...")
+	local ds, e = LoadFromFile(filename)
+	if not ds then
+		ModalMessage("Load failed", e or
+			"The load failed, probably because the file could not be opened.")
+		QueueRedraw()
+		return false
+	end
+	assert(ds)
+
+	local other = ds:findDocument(currentDocument.name or "") or ds.current
+	MaterialiseDocument(other)
+
+	ImmediateMessage("Comparing...")
+	local differences = CompareDocuments(other :: any, currentDocument :: any)
+	if (#differences == 0) then
+		NonmodalMessage("No differences from "..Leafname(filename)..".")
+		QueueRedraw()
+		return false
+	end
+
+	local data = {}
+	for _, d in differences do
+		data[#data+1] = { label = d.label, data = d }
+	end
+
+	local result = differencesbrowser(filename, data)
+	if not result then
+		return false
+	end
+
+	local d: Difference = data[result].data
+	currentDocument.cp = d.pn
+	currentDocument.cw = math.min(d.wn, #currentDocument[d.pn])
+	currentDocument.co = 1
+	QueueRedraw()
+	return true
+end
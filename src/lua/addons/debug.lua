@@ -5,44 +5,391 @@
 
 local string_format = string.format
 local floor = math.floor
+local WordStats = wg.wordstats
+local AllocStats = wg.allocstats
+local GCStats = wg.gcstats
+local StartProfiler = wg.startprofiler
+local StopProfiler = wg.stopprofiler
+local IsProfiling = wg.isprofiling
+local StartTrace = wg.starttrace
+local StopTrace = wg.stoptrace
+local IsTracing = wg.istracing
+local DumpTrace = wg.dumptrace
+local WriteFile = wg.writefile
 
 -----------------------------------------------------------------------------
 -- Build the status bar.
 
-do
-	local function cb(event, token, terms)
-		local settings = GlobalSettings.debug
-		if settings.memory then
+-- The memory figures change all the time, so are just refreshed every so
+-- often.
+AddStatusBarField(50, {},
+	function()
+		if GlobalSettings.debug.memory then
 			local mem = floor(gcinfo())
-			terms[#terms+1] = 
-				{
-					priority=50,
-					value=string_format("%dkB", mem)
-				}
+			local stats = AllocStats()
+			local gc = GCStats()
+			return string_format("%dkB (heap %dkB, peak %dkB, layouts %dkw, gc step %.1fms max %.1fms)",
+				mem, floor(stats.live / 1024), floor(stats.peak / 1024),
+				floor(GetParagraphLayoutCost() / 1000),
+				gc.last * 1000, gc.max * 1000)
 		end
-		if settings.location then
-			terms[#terms+1] = 
-				{
-					priority=50,
-					value=string_format("%d.%d.%d / %d.%d.%d",
-						currentDocument.cp,
-						currentDocument.cw,
-						currentDocument.co,
-						#currentDocument,
-						#currentDocument[currentDocument.cp],
-						#currentDocument[currentDocument.cp][currentDocument.cw])
-				}
+		return nil
+	end, 1)
+
+AddStatusBarField(50, {"Moved", "Changed"},
+	function()
+		if GlobalSettings.debug.location then
+			return string_format("%d.%d.%d / %d.%d.%d",
+				currentDocument.cp,
+				currentDocument.cw,
+				currentDocument.co,
+				#currentDocument,
+				#currentDocument[currentDocument.cp],
+				#currentDocument[currentDocument.cp][currentDocument.cw])
 		end
-		if settings.currentword then
-			terms[#terms+1] = 
-				{
-					priority=50,
-					value=Format(currentDocument[currentDocument.cp][currentDocument.cw])
-				}
+		return nil
+	end)
+
+-- Counting shared words looks at the whole document, which is too slow to
+-- do on every keystroke, so waits until the typing stops.
+local wordsharing = AddStatusBarField(50, {},
+	function()
+		if GlobalSettings.debug.wordsharing then
+			local words, distinct, bytes, distinctbytes = WordStats(currentDocument)
+			return string_format("%d/%d words, %dkB/%dkB",
+				distinct, words,
+				floor(distinctbytes / 1024), floor(bytes / 1024))
+		end
+		return nil
+	end)
+AddDeferredEventListener("Changed",
+	function()
+		InvalidateStatusBarField(wordsharing)
+		QueueRedraw()
+	end, 0.5)
+
+AddStatusBarField(50, {"Moved", "Changed"},
+	function()
+		if GlobalSettings.debug.currentword then
+			return Format(currentDocument[currentDocument.cp][currentDocument.cw])
 		end
+		return nil
+	end)
+
+-----------------------------------------------------------------------------
+-- Latency recording. The event loop reports, for each command (named after
+-- the key which invoked it), how long the command took and how long it was
+-- until the result was on the screen; redraws themselves are reported as
+-- "(redraw)". Only the last few samples of each are kept, for working out
+-- percentiles.
+
+local LATENCYSAMPLES = 1000
+
+type LatencyRecord = {
+	count: number,
+	dispatch: {number},
+	screen: {number},
+	maxdispatch: number,
+	maxscreen: number,
+}
+
+local latencies: {[string]: LatencyRecord} = {}
+local recordinglatencies = false
+
+function IsRecordingLatencies(): boolean
+	return recordinglatencies
+end
+
+function RecordLatency(name: string, dispatch: number, screen: number)
+	local r = latencies[name]
+	if not r then
+		r = {count=0, dispatch={}, screen={}, maxdispatch=0, maxscreen=0}
+		latencies[name] = r
 	end
-	
-	AddEventListener("BuildStatusBar", cb)
+
+	local index = (r.count % LATENCYSAMPLES) + 1
+	r.count = r.count + 1
+	r.dispatch[index] = dispatch
+	r.screen[index] = screen
+	r.maxdispatch = math.max(r.maxdispatch, dispatch)
+	r.maxscreen = math.max(r.maxscreen, screen)
+end
+
+function ResetLatencies()
+	latencies = {}
+end
+
+local function percentile(samples: {number}, p: number): number
+	local sorted = table.clone(samples)
+	table.sort(sorted)
+	return sorted[math.max(1, math.ceil(#sorted * p))] or 0
+end
+
+-- Returns one summary per command, slowest (by p99 latency to the screen)
+-- first. Times are in seconds.
+
+export type LatencySummary = {
+	name: string,
+	count: number,
+	dispatch50: number,
+	dispatch99: number,
+	dispatchmax: number,
+	screen50: number,
+	screen99: number,
+	screenmax: number,
+}
+
+function GetLatencySummaries(): {LatencySummary}
+	local summaries: {LatencySummary} = {}
+	for name, r in latencies do
+		summaries[#summaries+1] = {
+			name = name,
+			count = r.count,
+			dispatch50 = percentile(r.dispatch, 0.5),
+			dispatch99 = percentile(r.dispatch, 0.99),
+			dispatchmax = r.maxdispatch,
+			screen50 = percentile(r.screen, 0.5),
+			screen99 = percentile(r.screen, 0.99),
+			screenmax = r.maxscreen,
+		}
+	end
+	table.sort(summaries,
+		function(a, b)
+			if a.screen99 ~= b.screen99 then
+				return a.screen99 > b.screen99
+			end
+			return a.name < b.name
+		end)
+	return summaries
+end
+
+local function formatsummary(s: LatencySummary): string
+	local function ms(t: number): number
+		return t * 1000
+	end
+	return string_format("%-16s %7d %8.1f %8.1f %8.1f %8.1f %8.1f %8.1f",
+		s.name, s.count,
+		ms(s.dispatch50), ms(s.dispatch99), ms(s.dispatchmax),
+		ms(s.screen50), ms(s.screen99), ms(s.screenmax))
+end
+
+local LATENCYHEADER = string_format("%-16s %7s %8s %8s %8s %8s %8s %8s",
+	"command", "count", "cmd p50", "cmd p99", "cmd max",
+	"scr p50", "scr p99", "scr max")
+
+-- Writes the summaries as a table (times in milliseconds), returning an
+-- error message on failure.
+
+function DumpLatencies(filename: string): string?
+	local lines = {LATENCYHEADER}
+	for _, s in GetLatencySummaries() do
+		lines[#lines+1] = formatsummary(s)
+	end
+	lines[#lines+1] = ""
+
+	local _, e = WriteFile(filename, table.concat(lines, "\n"))
+	return e
+end
+
+function Cmd.ShowLatencies()
+	local data: {BrowserItem} = {}
+	for _, s in GetLatencySummaries() do
+		local label = formatsummary(s)
+		data[#data+1] = {data=label, label=label}
+	end
+	if #data == 0 then
+		local message = recordinglatencies
+			and "No latencies have been recorded yet."
+			or "Latency recording is off; turn it on in the debugging options."
+		NonmodalMessage(message)
+		return false
+	end
+
+	local filename = CONFIGDIR.."/latency.txt"
+	local function dump_cb(self: Form): ActionResult
+		local e = DumpLatencies(filename)
+		if e then
+			ModalMessage("Write failed", "The latencies could not be written: "..e)
+		else
+			NonmodalMessage("Latencies written to "..filename..".")
+		end
+		return "confirm"
+	end
+
+	local function reset_cb(self: Form): ActionResult
+		ResetLatencies()
+		NonmodalMessage("Latencies reset.")
+		return "confirm"
+	end
+
+	local dialogue: Form =
+	{
+		title = "Command Latencies",
+		width = "large",
+		height = "large",
+		stretchy = false,
+
+		actions = {
+			["KEY_RETURN"] = "confirm",
+			["KEY_ENTER"] = "confirm",
+			["KEY_^W"] = dump_cb,
+			["KEY_^R"] = reset_cb,
+		},
+
+		widgets = {
+			Form.Label {
+				x1 = 1, y1 = 1,
+				x2 = -1, y2 = 1,
+				align = "left",
+				value = LATENCYHEADER.." (ms)"
+			},
+
+			Form.Browser {
+				focusable = true,
+				type = Form.Browser,
+				x1 = 1, y1 = 2,
+				x2 = -1, y2 = -1,
+				data = data,
+				cursor = 1
+			},
+		}
+	}
+
+	Form.Run(dialogue, RedrawScreen,
+		"RETURN to close, ^W to write to "..filename..", ^R to reset")
+	QueueRedraw()
+	return true
+end
+
+-----------------------------------------------------------------------------
+-- The memory report: how much of the heap each part of the program is
+-- keeping alive. Everything is counted against the first part which reaches
+-- it (see heapreport.cc), so the documents come first, as they own the words
+-- which everything else refers to; they're walked without their transient
+-- fields (the ones starting with an underscore), which are counted as the
+-- layout, undo and caches they are after that. Addons add their own caches
+-- when the MemoryReport event is fired, by calling the payload's add().
+
+export type MemoryReportLine = {
+	name: string,
+	bytes: number,
+	objects: number,
+}
+
+function GetMemoryReport(): ({MemoryReportLine}, HeapCounts)
+	local names: {string} = {}
+	local rootsets: {any} = {}
+	local byname: {[string]: any} = {}
+	local function add(name: string, ...)
+		local set = byname[name]
+		if not set then
+			set = {}
+			byname[name] = set
+			names[#names+1] = name
+			rootsets[#rootsets+1] = set
+		end
+		for i = 1, select("#", ...) do
+			local v = select(i, ...)
+			if v ~= nil then
+				set[#set+1] = v
+			end
+		end
+		return set
+	end
+
+	local documents = {}
+	for _, d in documentSet.documents do
+		add("Document "..d.name, d).skipunderscore = true
+		if not IsLazyDocument(d) then
+			documents[#documents+1] = d
+		end
+	end
+	add("Clipboard", documentSet.clipboard)
+
+	for _, d in documents do
+		for i = 1, #d do
+			local p = d[i]
+			add("Document "..d.name, p._words)
+			add("Layout", p._wrapdata, p._wrapcache, p._wrapbase)
+		end
+		add("Layout", d._pagelayout)
+		add("Undo and redo", d._undostack, d._redostack)
+	end
+
+	FireEvent("MemoryReport", { add = add })
+
+	-- Whatever else the documents have hung on to.
+	add("Other document data", documentSet, table.unpack(documents))
+
+	local counts, total = wg.heapreport(rootsets)
+	local lines: {MemoryReportLine} = {}
+	for i, name in names do
+		lines[i] = { name = name, bytes = counts[i].bytes,
+			objects = counts[i].objects }
+	end
+	local rest = counts[#names+1]
+	lines[#lines+1] = { name = "Everything else", bytes = rest.bytes,
+		objects = rest.objects }
+	return lines, total
+end
+
+local function formatmemoryline(name: string, bytes: number,
+		objects: number, total: number): string
+	return string_format("%-32s %10d %10d %5.1f%%",
+		name, floor(bytes / 1024), objects,
+		(total > 0) and (bytes * 100 / total) or 0)
+end
+
+local MEMORYHEADER = string_format("%-32s %10s %10s %6s",
+	"", "kB", "objects", "")
+
+function Cmd.MemoryReport()
+	ImmediateMessage("Walking the heap...")
+	local lines, total = GetMemoryReport()
+
+	local data: {BrowserItem} = {}
+	for _, l in lines do
+		local label = formatmemoryline(l.name, l.bytes, l.objects, total.bytes)
+		data[#data+1] = {data=label, label=label}
+	end
+	local label = formatmemoryline("Total", total.bytes, total.objects,
+		total.bytes)
+	data[#data+1] = {data=label, label=label}
+
+	local dialogue: Form =
+	{
+		title = "Memory Report",
+		width = "large",
+		height = "large",
+		stretchy = false,
+
+		actions = {
+			["KEY_RETURN"] = "confirm",
+			["KEY_ENTER"] = "confirm",
+		},
+
+		widgets = {
+			Form.Label {
+				x1 = 1, y1 = 1,
+				x2 = -1, y2 = 1,
+				align = "left",
+				value = MEMORYHEADER
+			},
+
+			Form.Browser {
+				focusable = true,
+				type = Form.Browser,
+				x1 = 1, y1 = 2,
+				x2 = -1, y2 = -1,
+				data = data,
+				cursor = 1
+			},
+		}
+	}
+
+	Form.Run(dialogue, RedrawScreen, "RETURN to close")
+	QueueRedraw()
+	return true
 end
 
 -----------------------------------------------------------------------------
@@ -53,8 +400,15 @@ do
 		GlobalSettings.debug = GlobalSettings.debug or {
 			memory = false,
 			location = false,
-			currentword = false
+			currentword = false,
+			wordsharing = false,
+			packparagraphs = false,
+			latency = false,
+			layoutcache = 500,
 		}
+		SetParagraphPacking(GlobalSettings.debug.packparagraphs or false)
+		SetParagraphLayoutBudget((GlobalSettings.debug.layoutcache or 500) * 1000)
+		recordinglatencies = GlobalSettings.debug.latency or false
 	end
 	
 	AddEventListener("RegisterAddons", cb)
@@ -89,11 +443,42 @@ function Cmd.ConfigureDebug()
 			value = settings.currentword
 		}
 
+	local wordsharing_checkbox =
+		Form.Checkbox {
+			x1 = 1, y1 = 9,
+			x2 = -1, y2 = 10,
+			label = "Show distinct/total words and bytes on status bar",
+			value = settings.wordsharing
+		}
+
+	local packparagraphs_checkbox =
+		Form.Checkbox {
+			x1 = 1, y1 = 11,
+			x2 = -1, y2 = 12,
+			label = "Store paragraphs in packed form (experimental)",
+			value = settings.packparagraphs
+		}
+
+	local latency_checkbox =
+		Form.Checkbox {
+			x1 = 1, y1 = 13,
+			x2 = -1, y2 = 14,
+			label = "Record keystroke latencies",
+			value = settings.latency or false
+		}
+
+	local layoutcache_textfield =
+		Form.TextField {
+			x1 = 56, y1 = 15,
+			x2 = -1, y2 = 15,
+			value = tostring(settings.layoutcache or 500)
+		}
+
 	local dialogue: Form =
 	{
 		title = "Configure Debugging Options",
 		width = "large",
-		height = 9,
+		height = 17,
 		stretchy = false,
 
 		actions = {
@@ -105,6 +490,17 @@ function Cmd.ConfigureDebug()
 			memory_checkbox,
 			location_checkbox,
 			currentword_checkbox,
+			wordsharing_checkbox,
+			packparagraphs_checkbox,
+			latency_checkbox,
+
+			Form.Label {
+				x1 = 1, y1 = 15,
+				x2 = 55, y2 = 15,
+				align = "left",
+				value = "Layouts to cache (thousands of words, 0 for no limit):"
+			},
+			layoutcache_textfield,
 			
 			Form.Label {
 				x1 = 1, y1 = 1,
@@ -115,17 +511,78 @@ function Cmd.ConfigureDebug()
 		}
 	}
 	
-	local result = Form.Run(dialogue, RedrawScreen,
-		"SPACE to toggle, RETURN to confirm, "..ESCAPE_KEY.." to cancel")
-	if not result then
-		return false
+	local layoutcache: number
+	while true do
+		local result = Form.Run(dialogue, RedrawScreen,
+			"SPACE to toggle, RETURN to confirm, "..ESCAPE_KEY.." to cancel")
+		if not result then
+			return false
+		end
+
+		local n = tonumber(layoutcache_textfield.value)
+		if n and (n >= 0) then
+			layoutcache = n
+			break
+		end
+		ModalMessage("Parameter error", "The layout cache size must be a "..
+			"number, or 0 for no limit.")
 	end
 	
 	settings.memory = memory_checkbox.value
 	settings.location = location_checkbox.value
 	settings.currentword = currentword_checkbox.value
+	settings.wordsharing = wordsharing_checkbox.value
+	settings.packparagraphs = packparagraphs_checkbox.value
+	settings.latency = latency_checkbox.value
+	settings.layoutcache = layoutcache
+	SetParagraphPacking(settings.packparagraphs)
+	SetParagraphLayoutBudget(layoutcache * 1000)
+	recordinglatencies = settings.latency
 	SaveGlobalSettings()
+	InvalidateStatusBar()
 
 	return true
 end
 
+-----------------------------------------------------------------------------
+-- The profiler. Results go to a file of folded stacks, for flamegraph.pl
+-- and similar tools.
+
+function Cmd.ToggleProfiler()
+	if not IsProfiling() then
+		StartProfiler()
+		NonmodalMessage("Profiling; use the same command again to stop.")
+		return true
+	end
+
+	local filename = CONFIGDIR.."/profile.txt"
+	local _, e = WriteFile(filename, StopProfiler())
+	if e then
+		ModalMessage("Profiling failed", "The profile could not be written: "..e)
+		return false
+	end
+	NonmodalMessage("Profile written to "..filename..".")
+	return true
+end
+
+-----------------------------------------------------------------------------
+-- Span tracing. Results go to a Chrome trace-event file, for Perfetto or
+-- chrome://tracing.
+
+function Cmd.ToggleTrace()
+	if not IsTracing() then
+		StartTrace()
+		NonmodalMessage("Tracing; use the same command again to stop.")
+		return true
+	end
+
+	local filename = CONFIGDIR.."/trace.json"
+	StopTrace()
+	local _, e = WriteFile(filename, DumpTrace())
+	if e then
+		ModalMessage("Tracing failed", "The trace could not be written: "..e)
+		return false
+	end
+	NonmodalMessage("Trace written to "..filename..".")
+	return true
+end
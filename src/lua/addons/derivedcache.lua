@@ -0,0 +1,375 @@
+--!nonstrict
+-- © 2026 David Given.
+-- WordGrinder is licensed under the MIT open source license. See the COPYING
+-- file in this distribution for the full text.
+
+-- An optional cache of the things worked out from each paragraph which are
+-- slow to get for a whole document (word statistics, page layout line
+-- counts, misspellings), kept in the cache directory from one session to
+-- the next. Entries are keyed by the paragraph's hash, so they're right for
+-- any paragraph with the same content wherever it turns up; each is a list
+-- of integers. The cache file is named after the checksum of the document
+-- set it was made from, so reopening an unchanged file finds it again, and
+-- a file written by a different version of WordGrinder is ignored.
+--
+-- Entries which aren't looked at for MAXAGE sessions in a row are dropped,
+-- and only the MAXFILES most recently used cache files are kept.
+
+local Checksum = wg.checksum
+local Compress = wg.compress
+local Decompress = wg.decompress
+local MapFile = wg.mapfile
+local ReadFile = wg.readfile
+local WriteFile = wg.writefile
+local ReadDir = wg.readdir
+local Stat = wg.stat
+local Mkdirs = wg.mkdirs
+local Remove = wg.remove
+local string_pack = string.pack
+local string_unpack = string.unpack
+local table_concat = table.concat
+
+local MAGIC = "WGDERIV1"
+local SUFFIX = ".wgcache"
+local MAXAGE = 8
+local MAXFILES = 32
+
+type DerivedCache = {
+	filename: string?, -- nil until the document set has a file
+
+	-- What was in the file (packed, with its age), and what's been looked
+	-- up or stored since; entries in fresh override those in loaded.
+	loaded: {[string]: {[string]: string}},
+	ages: {[string]: {[string]: number}},
+	fresh: {[string]: {[string]: string}},
+	dirty: boolean,
+}
+
+local cache: DerivedCache? = nil
+
+local function getsettings()
+	return GlobalSettings.derivedcache
+end
+
+local function packvalues(values: {number}): string
+	local s = {}
+	for i, v in ipairs(values) do
+		s[i] = string_pack("<I4", v)
+	end
+	return table_concat(s)
+end
+
+local function unpackvalues(packed: string): {number}
+	local values = {}
+	for i = 1, #packed, 4 do
+		values[#values+1] = (string_unpack("<I4", packed, i))
+	end
+	return values
+end
+
+local function cachefilename(filename: string): string?
+	local mf = MapFile(filename)
+	if not mf then
+		return nil
+	end
+	local name = string.format("%s/%08x-%x%s", getsettings().directory,
+		Checksum(mf), mf:len(), SUFFIX)
+	mf:close()
+	return name
+end
+
+local function readcache(filename: string?): DerivedCache
+	local c: DerivedCache = {
+		filename = filename,
+		loaded = {},
+		ages = {},
+		fresh = {},
+		dirty = false,
+	}
+
+	local data = filename and ReadFile(filename)
+	if not data or (data:sub(1, #MAGIC) ~= MAGIC) then
+		return c
+	end
+	local ok, version, pos = pcall(string_unpack, "<s1", data, #MAGIC + 1)
+	if not ok or (version ~= VERSION) then
+		return c
+	end
+	local body = Decompress(data:sub(pos))
+	if not body then
+		return c
+	end
+
+	ok = pcall(
+		function()
+			local pos = 1
+			while (pos <= #body) do
+				local kind, count
+				kind, count, pos = string_unpack("<s2I4", body, pos)
+				local loaded = {}
+				local ages = {}
+				for i = 1, count do
+					local hash, age, packed
+					hash, age, packed, pos = string_unpack("<c16Bs4", body, pos)
+					loaded[hash] = packed
+					ages[hash] = age
+				end
+				c.loaded[kind] = loaded
+				c.ages[kind] = ages
+			end
+		end)
+	if not ok then
+		c.loaded = {}
+		c.ages = {}
+	end
+	return c
+end
+
+-- Throws away all but the most recently used cache files.
+local function prune(directory: string)
+	local files = ReadDir(directory)
+	if not files then
+		return
+	end
+
+	local found = {}
+	for _, f in files do
+		if (f:sub(-#SUFFIX) == SUFFIX) then
+			local st = Stat(directory.."/"..f)
+			if st then
+				found[#found+1] = { name = directory.."/"..f, mtime = st.mtime }
+			end
+		end
+	end
+	table.sort(found,
+		function(a, b)
+			return (a.mtime or 0) > (b.mtime or 0)
+		end)
+	for i = MAXFILES+1, #found do
+		Remove(found[i].name)
+	end
+end
+
+local function writecache(c: DerivedCache, filename: string)
+	local s = {}
+	local function addkind(kind: string)
+		local loaded: {[string]: string} = c.loaded[kind] or {}
+		local ages: {[string]: number} = c.ages[kind] or {}
+		local fresh: {[string]: string} = c.fresh[kind] or {}
+		local records = {}
+		for hash, packed in fresh do
+			records[#records+1] = string_pack("<c16Bs4", hash, 0, packed)
+		end
+		for hash, packed in loaded do
+			local age = ages[hash] + 1
+			if not fresh[hash] and (age <= MAXAGE) then
+				records[#records+1] = string_pack("<c16Bs4", hash, age, packed)
+			end
+		end
+		if (#records > 0) then
+			s[#s+1] = string_pack("<s2I4", kind, #records)
+			s[#s+1] = table_concat(records)
+		end
+	end
+
+	local kinds = {}
+	for kind in c.loaded do
+		kinds[kind] = true
+	end
+	for kind in c.fresh do
+		kinds[kind] = true
+	end
+	for kind in kinds do
+		addkind(kind)
+	end
+
+	local directory = getsettings().directory
+	Mkdirs(directory)
+	WriteFile(filename, MAGIC..string_pack("<s1", VERSION)
+		..Compress(table_concat(s)))
+	prune(directory)
+end
+
+--- Returns what was remembered for a paragraph, or nil if there's nothing
+-- (or the cache isn't turned on).
+--
+-- @param kind               what the data is, including anything it depends on
+-- @param p                  the paragraph
+-- @return                   the list of integers stored for it, or nil
+
+function LookupDerivedData(kind: string, p: Paragraph): {number}?
+	local c = cache
+	if not c then
+		return nil
+	end
+
+	local hash = p:hash()
+	local fresh = c.fresh[kind]
+	local packed = fresh and fresh[hash]
+	if packed then
+		return unpackvalues(packed)
+	end
+
+	local loaded = c.loaded[kind]
+	packed = loaded and loaded[hash]
+	if not packed then
+		return nil
+	end
+
+	-- Anything which has been used is kept for another MAXAGE sessions.
+	if not fresh then
+		fresh = {}
+		c.fresh[kind] = fresh
+	end
+	fresh[hash] = packed
+	c.dirty = true
+	return unpackvalues(packed)
+end
+
+--- Remembers something worked out for a paragraph.
+--
+-- @param kind               what the data is, including anything it depends on
+-- @param p                  the paragraph
+-- @param values             a list of non-negative integers
+
+function StoreDerivedData(kind: string, p: Paragraph, values: {number})
+	local c = cache
+	if not c then
+		return
+	end
+
+	local fresh = c.fresh[kind]
+	if not fresh then
+		fresh = {}
+		c.fresh[kind] = fresh
+	end
+	fresh[p:hash()] = packvalues(values)
+	c.dirty = true
+end
+
+--- Writes out anything new in the cache. This happens when the document set
+-- is saved, and should happen before the program exits.
+
+function FlushDerivedData()
+	local c = cache
+	if c and c.dirty and c.filename then
+		writecache(c, c.filename)
+		c.dirty = false
+	end
+end
+
+-- Starts a new cache for the current document set, picking up where the
+-- last session with the same file left off.
+local function opencache()
+	FlushDerivedData()
+	cache = nil
+
+	-- (When a blank document set is created, the settings aren't loaded yet.)
+	local settings = getsettings()
+	if settings and settings.enabled then
+		local filename = documentSet.name
+		cache = readcache(filename and cachefilename(filename))
+	end
+end
+
+-----------------------------------------------------------------------------
+-- Addon registration. Load the cache for each document set loaded, and move
+-- it to the new file name when the document set is saved.
+
+do
+	local function cb()
+		GlobalSettings.derivedcache = MergeTables(GlobalSettings.derivedcache,
+			{
+				enabled = false,
+				directory = CONFIGDIR.."/cache",
+			}
+		)
+	end
+
+	AddEventListener("RegisterAddons", cb)
+end
+
+AddEventListener("DocumentCreated", opencache)
+AddEventListener("DocumentLoaded", opencache)
+
+do
+	local function cb(event, token, filename)
+		local c = cache
+		local name = c and cachefilename(filename)
+		if not c or not name then
+			return
+		end
+
+		-- The old file's cache is moved, not copied, as it's unlikely to be
+		-- wanted again.
+		if (name ~= c.filename) then
+			if c.filename then
+				Remove(c.filename)
+			end
+			c.filename = name
+			c.dirty = true
+		end
+		FlushDerivedData()
+	end
+
+	AddEventListener("DocumentSaved", cb)
+end
+
+-----------------------------------------------------------------------------
+-- Configuration user interface.
+
+function Cmd.ConfigureDerivedCache()
+	local settings = getsettings()
+
+	local enabled_checkbox =
+		Form.Checkbox {
+			x1 = 1, y1 = 1,
+			x2 = -1, y2 = 1,
+			label = "",
+			value = settings.enabled
+		}
+
+	local dialogue: Form =
+	{
+		title = "Configure Session Cache",
+		width = "large",
+		height = 5,
+		stretchy = false,
+
+		actions = {
+			["KEY_RETURN"] = "confirm",
+			["KEY_ENTER"] = "confirm",
+		},
+
+		widgets = {
+			enabled_checkbox,
+
+			Form.Label {
+				x1 = 1, y1 = 1,
+				x2 = 32, y2 = 1,
+				align = "left",
+				value = "Keep a session cache:"
+			},
+
+			Form.WrappedLabel {
+				x1 = 1, y1 = 3,
+				x2 = -1, y2 = 4,
+				value = "This makes large documents quicker to start working "
+					.. "on again, and is kept in "..settings.directory.."."
+			},
+		}
+	}
+
+	local result = Form.Run(dialogue, RedrawScreen,
+		"SPACE to toggle, RETURN to confirm, "..ESCAPE_KEY.." to cancel")
+	if not result then
+		return false
+	end
+
+	if (enabled_checkbox.value ~= settings.enabled) then
+		settings.enabled = enabled_checkbox.value
+		opencache()
+		SaveGlobalSettings()
+	end
+	return true
+end
@@ -0,0 +1,77 @@
+--!nonstrict
+-- © 2024 David Given.
+-- WordGrinder is licensed under the MIT open source license. See the COPYING
+-- file in this distribution for the full text.
+
+-----------------------------------------------------------------------------
+-- Addon registration. Create the default settings in the documentSet.
+
+do
+	local function cb()
+		documentSet.addons.fileformat = documentSet.addons.fileformat or {
+			compressed = false,
+			wordtable = false,
+		}
+	end
+	
+	AddEventListener("RegisterAddons", cb)
+end
+
+-----------------------------------------------------------------------------
+-- Configuration user interface.
+
+function Cmd.ConfigureFileFormat()
+	local settings = documentSet.addons.fileformat
+
+	local compressed_checkbox =
+		Form.Checkbox {
+			x1 = 1, y1 = 1,
+			x2 = -1, y2 = 1,
+			label = "Save compressed files",
+			value = settings.compressed
+		}
+
+	local wordtable_checkbox =
+		Form.Checkbox {
+			x1 = 1, y1 = 2,
+			x2 = -1, y2 = 2,
+			label = "Save with a word table (smaller; overrides compression)",
+			value = settings.wordtable or false
+		}
+
+	local dialogue: Form =
+	{
+		title = "Configure File Format",
+		width = "large",
+		height = 6,
+		stretchy = false,
+
+		actions = {
+			["KEY_RETURN"] = "confirm",
+			["KEY_ENTER"] = "confirm",
+		},
+		
+		widgets = {
+			compressed_checkbox,
+			wordtable_checkbox,
+			
+			Form.Label {
+				x1 = 1, y1 = 4,
+				x2 = -1, y2 = 4,
+				align = "left",
+				value = "(Older versions of WordGrinder can't load these.)"
+			},
+		}
+	}
+	
+	local result = Form.Run(dialogue, RedrawScreen,
+		"SPACE to toggle, RETURN to confirm, "..ESCAPE_KEY.." to cancel")
+	if not result then
+		return false
+	end
+	
+	settings.compressed = compressed_checkbox.value
+	settings.wordtable = wordtable_checkbox.value
+	documentSet:touch()
+	return true
+end
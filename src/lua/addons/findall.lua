@@ -0,0 +1,138 @@
+--!nonstrict
+-- © 2026 David Given.
+-- WordGrinder is licensed under the MIT open source license. See the COPYING
+-- file in this distribution for the full text.
+
+local FindAllText = wg.findalltext
+local GetWordText = wg.getwordtext
+local table_concat = table.concat
+
+-- How many words either side of a match are shown in the list of results.
+local CONTEXTWORDS = 4
+
+local function findallbrowser(data, count)
+	local browser = Form.Browser {
+		focusable = true,
+		type = Form.Browser,
+		x1 = 1, y1 = 2,
+		x2 = -1, y2 = -1,
+		data = data,
+		cursor = 1
+	}
+
+	local dialogue: Form =
+	{
+		title = "Find in All Documents",
+		width = "large",
+		height = "large",
+		stretchy = false,
+
+		actions = {
+			["KEY_RETURN"] = "confirm",
+			["KEY_ENTER"] = "confirm",
+		},
+
+		widgets = {
+			Form.Label {
+				x1 = 1, y1 = 1,
+				x2 = -1, y2 = 1,
+				value = string.format("Found %d %s; select one to jump to:",
+					count, (count == 1) and "match" or "matches")
+			},
+
+			browser,
+		}
+	}
+
+	local result = Form.Run(dialogue, RedrawScreen,
+		"RETURN to select item, "..ESCAPE_KEY.." to cancel")
+	QueueRedraw()
+	if result then
+		return browser.cursor
+	else
+		return nil
+	end
+end
+
+-- Returns the words around a match, for showing in the list.
+local function getcontext(paragraph: Paragraph, mw: number): string
+	local s = {}
+	for wn = math.max(1, mw - CONTEXTWORDS),
+			math.min(#paragraph, mw + CONTEXTWORDS) do
+		s[#s+1] = GetWordText(paragraph[wn])
+	end
+	return table_concat(s, " ")
+end
+
+function Cmd.FindInAllDocuments(findtext: string?)
+	if not findtext then
+		findtext = PromptForString("Find in all documents", "Search for:",
+			documentSet.findtext)
+		if not findtext then
+			return false
+		end
+	end
+	assert(findtext)
+
+	local regex = documentSet.findregex
+	local text, e = GetSearchText(findtext, regex)
+	if not text then
+		NonmodalMessage(assert(e))
+		return false
+	end
+	assert(text)
+	documentSet.findtext = findtext
+
+	ImmediateMessage("Searching all documents...")
+
+	-- Documents which haven't been looked at since the file was loaded are
+	-- turned into paragraphs here, all together as that's quicker; their
+	-- folded text then stays cached for the next search, as for the current
+	-- document.
+
+	local smartquotes = documentSet.addons.smartquotes or {}
+	local data = {}
+	local documents = documentSet:getDocumentList()
+	local ok = RunTask("Searching all documents...", function()
+		MaterialiseDocuments(documents)
+		for i, document in documents do
+			TaskCheckpoint((i - 1) / #documents)
+
+			local matches = FindAllText(document, text,
+				smartquotes.leftsingle, smartquotes.rightsingle,
+				smartquotes.leftdouble, smartquotes.rightdouble, regex)
+			for _, m in matches do
+				data[#data+1] =
+				{
+					label = document.name..": "..getcontext(document[m[1]], m[2]),
+					document = document.name,
+					match = m,
+				}
+			end
+		end
+	end)
+
+	QueueRedraw()
+	if not ok then
+		return false
+	end
+	if (#data == 0) then
+		NonmodalMessage("Not found.")
+		return false
+	end
+
+	local result = findallbrowser(data, #data)
+	if not result then
+		return false
+	end
+
+	local item = data[result]
+	Cmd.ChangeDocument(item.document)
+	local m = item.match
+	currentDocument.mp, currentDocument.mw, currentDocument.mo =
+		m[1], m[2], m[3]
+	currentDocument.cp, currentDocument.cw, currentDocument.co =
+		m[4], m[5], m[6]
+	NonmodalMessage("Found.")
+	return true
+end
@@ -6,6 +6,19 @@
 local string_rep = string.rep
 local table_concat = table.concat
 
+type OutlineEntry = {
+	pn: number,
+	level: number,
+	text: string,
+	number: string, -- such as "2.1."
+}
+
+type Outline = {
+	generation: number,
+	paragraphs: {Paragraph},
+	headings: {OutlineEntry},
+}
+
 local function gotobrowser(data, index)
 	local browser = Form.Browser {
 		focusable = true,
@@ -49,43 +62,144 @@ local function gotobrowser(data, index)
 	end
 end
 
-function Cmd.Goto()
-	ImmediateMessage("Scanning document...")
+-----------------------------------------------------------------------------
+-- The outline of a document: its headings, kept with the document and
+-- brought up to date after an edit rather than rebuilt. As paragraphs are
+-- immutable, the document's change tracking says which ones to look at;
+-- headings outside that run just move. Only the numbering has to be worked
+-- out again from scratch, and that only looks at the headings.
 
-	local data = {}
+local function getheading(pn: number, p: Paragraph): OutlineEntry?
+	local _, _, level = p.style:find("^H(%d)$")
+	if not level then
+		return nil
+	end
+	return {
+		pn = pn,
+		level = assert(tonumber(level)),
+		text = p:asString(),
+		number = "",
+	}
+end
+
+local function scanheadings(document: Document, first: number, last: number,
+		headings: {OutlineEntry})
+	for pn = first, last do
+		local h = getheading(pn, document[pn])
+		if h then
+			headings[#headings+1] = h
+		end
+	end
+end
+
+-- Entries which have already been handed out are never changed (callers may
+-- be holding on to an old outline); one which needs to be different is
+-- replaced with a copy instead.
+local function changedheading(h: OutlineEntry, pn: number,
+		number: string): OutlineEntry
+	if (h.pn == pn) and (h.number == number) then
+		return h
+	end
+	return {
+		pn = pn,
+		level = h.level,
+		text = h.text,
+		number = number,
+	}
+end
+
+local function numberheadings(headings: {OutlineEntry})
 	local levelcount: {number} = {0, 0, 0, 0}
-	local currentheading = 1
-	for paran, para in ipairs(currentDocument) do
-		local _, _, level = para.style:find("^H(%d)$")
-		if level then
-			local level = assert(tonumber(level))
-
-			-- Update the array of section counts. Remember that subsections
-			-- are local to their section, so make sure to zero out the
-			-- level count for subsections contained within this section.
-			levelcount[level] = levelcount[level] + 1
-			for i = level+1, 4 do
-				levelcount[i] = 0
-			end
+	for hi, h in headings do
+		-- Update the array of section counts. Remember that subsections
+		-- are local to their section, so make sure to zero out the
+		-- level count for subsections contained within this section.
+		local level = h.level
+		levelcount[level] = levelcount[level] + 1
+		for i = level+1, 4 do
+			levelcount[i] = 0
+		end
 
-			local s = {}
-			for i = 1, level do
-				s[#s+1] = levelcount[i] .. "."
-			end
-			s[#s+1] = " "
-			s[#s+1] = para:asString()
+		local s = {}
+		for i = 1, level do
+			s[#s+1] = levelcount[i] .. "."
+		end
+		headings[hi] = changedheading(h, h.pn, table_concat(s))
+	end
+end
 
-			data[#data+1] =
-			{
-				label = table_concat(s),
-				paran = paran
-			}
+-- Returns the headings of the document, in order. The result is a snapshot:
+-- it doesn't change when the document does.
+function GetDocumentOutline(document: Document): {OutlineEntry}
+	local outline: Outline? = document._outline
+	local gen = document:sync()
+	if outline and (outline.generation == gen) then
+		return outline.headings
+	end
 
-			if (paran <= currentDocument.cp) then
-				currentheading = #data
+	local headings = {}
+	if not outline then
+		scanheadings(document, 1, #document, headings)
+	else
+		local s, removed, inserted = DiffParagraphs(outline.paragraphs,
+			document :: any, document:changedSpan(outline.generation))
+		local delta = inserted - removed
+		local old = outline.headings
+		local i = 1
+		while (i <= #old) and (old[i].pn < s) do
+			headings[#headings+1] = old[i]
+			i = i + 1
+		end
+		scanheadings(document, s, s+inserted-1, headings)
+		for j = i, #old do
+			local h = old[j]
+			if (h.pn >= s+removed) then
+				headings[#headings+1] = changedheading(h, h.pn + delta, h.number)
 			end
 		end
 	end
+	numberheadings(headings)
+
+	document._outline = {
+		generation = gen,
+		paragraphs = table.move(document :: any, 1, #document, 1, {}),
+		headings = headings,
+	}
+	return headings
+end
+
+-- Returns the index in the outline of the heading of the section which the
+-- given paragraph is in, or nil if it's before the first heading.
+function GetOutlineSection(headings: {OutlineEntry}, pn: number): number?
+	local lo, hi = 1, #headings
+	local found = nil
+	while (lo <= hi) do
+		local mid = (lo + hi) // 2
+		if (headings[mid].pn <= pn) then
+			found = mid
+			lo = mid + 1
+		else
+			hi = mid - 1
+		end
+	end
+	return found
+end
+
+-----------------------------------------------------------------------------
+-- The table of contents.
+
+function Cmd.Goto()
+	local headings = GetDocumentOutline(currentDocument)
+
+	local data = {}
+	for _, h in headings do
+		data[#data+1] =
+		{
+			label = h.number .. " " .. h.text,
+			paran = h.pn
+		}
+	end
+	local currentheading = GetOutlineSection(headings, currentDocument.cp) or 1
 
 	if (#data == 0) then
 		ModalMessage("No contents available", "You must have some heading paragraphs in your document to use the table of contents.")
@@ -104,3 +218,100 @@ function Cmd.Goto()
 
 	return false
 end
+
+-----------------------------------------------------------------------------
+-- The outline view. Each heading's section (the paragraphs up to the next
+-- heading) is folded away, leaving just the headings, until it's expanded;
+-- a folded section is drawn as its heading, and the paragraphs in it aren't
+-- wrapped or looked at at all, so moving around the outline of even a very
+-- big document is quick. The section the cursor is in (other than on its
+-- heading) is always shown, so jumping into one opens it up.
+
+type OutlineView = {
+	-- Which sections have been expanded, by their heading paragraph; editing
+	-- a heading folds its section up again.
+	expanded: {[Paragraph]: boolean},
+}
+
+--- Returns a function which finds the folded section a paragraph is in, or
+-- nil if the document isn't in the outline view. The function returns the
+-- first and last paragraph numbers of the section (the first being its
+-- heading), or nil if the paragraph isn't in a folded section; it's only
+-- good until the document next changes.
+--
+-- @param document           the document
+-- @param cp                 the cursor paragraph (default the document's)
+-- @return                   function(pn) -> (first, last)
+
+function GetOutlineFolds(document: Document, cp: number?)
+		: ((number) -> (number?, number?))?
+	local view: OutlineView? = document._folding
+	if not view then
+		return nil
+	end
+	assert(view)
+
+	local headings = GetDocumentOutline(document)
+	local expanded = view.expanded
+	local cursor = cp or document.cp
+	return function(pn: number): (number?, number?)
+		local i = GetOutlineSection(headings, pn)
+		if not i then
+			return nil, nil
+		end
+
+		local first = headings[i].pn
+		local last = headings[i+1] and (headings[i+1].pn - 1) or #document
+		if expanded[document[first]]
+				or ((cursor > first) and (cursor <= last)) then
+			return nil, nil
+		end
+		return first, last
+	end
+end
+
+function Cmd.ToggleOutlineView()
+	if currentDocument._folding then
+		currentDocument._folding = nil
+		NonmodalMessage("Outline view off.")
+	else
+		local view: OutlineView = {
+			expanded = setmetatable({}, {__mode = "k"}) :: any,
+		}
+		currentDocument._folding = view
+		NonmodalMessage("Outline view on; sections are folded.")
+	end
+	QueueRedraw()
+	return true
+end
+
+-- Folds or unfolds the section the cursor is in.
+function Cmd.ToggleOutlineSection()
+	local view: OutlineView? = currentDocument._folding
+	if not view then
+		NonmodalMessage("Outline view is not on.")
+		return false
+	end
+
+	local headings = GetDocumentOutline(currentDocument)
+	local i = GetOutlineSection(headings, currentDocument.cp)
+	if not i then
+		NonmodalMessage("There's no section here to fold.")
+		return false
+	end
+
+	local pn = headings[i].pn
+	local heading = currentDocument[pn]
+	if view.expanded[heading] then
+		view.expanded[heading] = nil
+	else
+		view.expanded[heading] = true
+	end
+
+	-- Folding a section hides the cursor, so put it on the heading.
+	currentDocument.cp = pn
+	currentDocument.cw = 1
+	currentDocument.co = 1
+	QueueRedraw()
+	return true
+end
@@ -10,10 +10,13 @@ local DEFAULT_GUI_SETTINGS = {
 	font_size = 20,
 	window_width = 800,
 	window_height = 600,
+	max_fps = 60,
 	font_regular = "extras/fonts/FantasqueSansMono-Regular.ttf",
 	font_italic = "extras/fonts/FantasqueSansMono-Italic.ttf",
 	font_bold = "extras/fonts/FantasqueSansMono-Bold.ttf",
 	font_bolditalic = "extras/fonts/FantasqueSansMono-BoldItalic.ttf",
+	font_fallbacks = "",
+	sdf_glyphs = false,
 }
 
 do
@@ -57,6 +60,13 @@ function Cmd.ConfigureGui()
 			value = tostring(settings.font_size)
 		}
 
+	local maxfps_textfield =
+		Form.TextField {
+			x1 = L, y1 = 15,
+			x2 = L+10, y2 = 15,
+			value = tostring(settings.max_fps)
+		}
+
 	local fontregular_textfield =
 		Form.TextField {
 			x1 = L, y1 = 7,
@@ -85,11 +95,26 @@ function Cmd.ConfigureGui()
 			value = settings.font_bolditalic
 		}
 
+	local fontfallbacks_textfield =
+		Form.TextField {
+			x1 = L, y1 = 17,
+			x2 = R, y2 = 17,
+			value = settings.font_fallbacks or ""
+		}
+
+	local sdfglyphs_checkbox =
+		Form.Checkbox {
+			x1 = 1, y1 = 19,
+			x2 = -1, y2 = 19,
+			label = "Draw scalable (distance field) glyphs",
+			value = settings.sdf_glyphs or false
+		}
+
 	local dialogue: Form =
 	{
 		title = "Configure GUI",
 		width = "large",
-		height = 16,
+		height = 22,
 		stretchy = false,
 
 		actions = {
@@ -104,7 +129,10 @@ function Cmd.ConfigureGui()
 				fontitalic_textfield.value = DEFAULT_GUI_SETTINGS.font_italic
 				fontbold_textfield.value = DEFAULT_GUI_SETTINGS.font_bold
 				fontbolditalic_textfield.value = DEFAULT_GUI_SETTINGS.font_bolditalic
-				return "redraw"
+				maxfps_textfield.value = tostring(DEFAULT_GUI_SETTINGS.max_fps)
+				fontfallbacks_textfield.value = DEFAULT_GUI_SETTINGS.font_fallbacks
+				sdfglyphs_checkbox.value = DEFAULT_GUI_SETTINGS.sdf_glyphs
+				return "repaint"
 			end,
 		},
 
@@ -116,6 +144,9 @@ function Cmd.ConfigureGui()
 			fontitalic_textfield,
 			fontbold_textfield,
 			fontbolditalic_textfield,
+			maxfps_textfield,
+			fontfallbacks_textfield,
+			sdfglyphs_checkbox,
 
 			Form.Label {
 				x1 = 1, y1 = 1,
@@ -167,6 +198,20 @@ function Cmd.ConfigureGui()
 				value = "Bold/italic font:"
 			},
 
+			Form.Label {
+				x1 = 1, y1 = 15,
+				x2 = L-1, y2 = 15,
+				align = "left",
+				value = "Maximum frame rate:"
+			},
+
+			Form.Label {
+				x1 = 1, y1 = 17,
+				x2 = L-1, y2 = 17,
+				align = "left",
+				value = "Fallback fonts (a;b;c):"
+			},
+
 			Form.Label {
 				x1 = 1, y1 = -1,
 				x2 = -1, y2 = -1,
@@ -186,20 +231,27 @@ function Cmd.ConfigureGui()
 		local window_width = tonumber(windowwidth_textfield.value)
 		local window_height = tonumber(windowheight_textfield.value)
 		local font_size = tonumber(fontsize_textfield.value)
+		local max_fps = tonumber(maxfps_textfield.value)
 		if not window_width or (window_width < 50) then
 			ModalMessage("Invalid parameter", "Invalid window width")
 		elseif not window_height or (window_height < 50) then
 			ModalMessage("Invalid parameter", "Invalid window height")
 		elseif not font_size or (font_size < 1) then
 			ModalMessage("Invalid parameter", "Invalid font size")
+		elseif not max_fps or (max_fps < 0) then
+			ModalMessage("Invalid parameter",
+				"Invalid frame rate (use 0 for no limit)")
 		else
 			settings.window_width = window_width
 			settings.window_height = window_height
 			settings.font_size = font_size
+			settings.max_fps = max_fps
 			settings.font_regular = fontregular_textfield.value
 			settings.font_italic = fontitalic_textfield.value
 			settings.font_bold = fontbold_textfield.value
 			settings.font_bolditalic = fontbolditalic_textfield.value
+			settings.font_fallbacks = fontfallbacks_textfield.value
+			settings.sdf_glyphs = sdfglyphs_checkbox.value
 			break
 		end
 	end
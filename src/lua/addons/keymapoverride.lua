@@ -10,6 +10,7 @@ function OverrideKey(key, binding)
 		error("you tried to map something I don't recognise to "..key)
 	end
 	keyoverrides[key] = binding
+	ForgetKeyCallbacks()
 end
 
 function CheckOverrideTable(key)
@@ -49,6 +49,17 @@ function WantFullStopSpaces()
 	return false
 end
 
+-----------------------------------------------------------------------------
+-- Blink the cursor? (Turning this off lets an idle WordGrinder sleep.)
+
+function WantBlinkingCursor()
+	local settings = GlobalSettings.lookandfeel
+	if settings then
+		return settings.blinkcursor ~= false
+	end
+	return true
+end
+
 -----------------------------------------------------------------------------
 -- Get the scroll mode.
 
@@ -74,6 +85,7 @@ do
 				palette = "Light",
 				scrollmode = "Fixed",
 				fullstopspaces = false,
+				blinkcursor = true,
 			}
 		)
 		SetTheme(GlobalSettings.lookandfeel.palette)
@@ -155,11 +167,19 @@ function Cmd.ConfigureLookAndFeel()
 			value = find(SCROLLMODES, settings.scrollmode)
 		}
 
+	local blinkcursor_checkbox =
+		Form.Checkbox {
+			x1 = 1, y1 = 15,
+			x2 = -1, y2 = 15,
+			label = "Blink the cursor",
+			value = settings.blinkcursor
+		}
+
 	local dialogue: Form =
 	{
 		title = "Configure Look and Feel",
 		width = "large",
-		height = 15,
+		height = 17,
 		stretchy = false,
 
 		actions = {
@@ -183,6 +203,7 @@ function Cmd.ConfigureLookAndFeel()
 			fullstopspaces_checkbox,
 			palette_toggle,
 			scrollmode_toggle,
+			blinkcursor_checkbox,
 		}
 	}
 
@@ -204,6 +225,7 @@ function Cmd.ConfigureLookAndFeel()
 			settings.fullstopspaces = fullstopspaces_checkbox.value
 			settings.palette = themes[palette_toggle.value]
 			settings.scrollmode = SCROLLMODES[scrollmode_toggle.value]
+			settings.blinkcursor = blinkcursor_checkbox.value
 			SetTheme(settings.palette)
 			SaveGlobalSettings()
 			UpdateDocumentStyles()
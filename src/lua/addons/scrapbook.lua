@@ -42,34 +42,43 @@ function Cmd.CopyToScrapbook()
 end
 
 function Cmd.PasteToScrapbook()
-	local buffer = documentSet:getClipboard()
-	if not buffer then
+	local buffer = GetClipboard()
+	if (#buffer == 1) and (#buffer[1] == 1) and (buffer[1][1] == "") then
 		NonmodalMessage("There's nothing on the clipboard.")
 		return false
 	end
 	
 	local settings = documentSet.addons.scrapbook
 	
-	local currentdocument = currentDocument.name
-	
-	if not documentSet:findDocument(settings.document) then
-		documentSet:addDocument(CreateDocument(), settings.document)
+	local scrapbook: Document? = documentSet:findDocument(settings.document)
+	if not scrapbook then
+		local new = CreateDocument()
+		documentSet:addDocument(new, settings.document)
 		NonmodalMessage("Creating scrapbook in document '"..settings.document.."'.")
+		scrapbook = new
 	end
-	documentSet:setCurrent(settings.document)
+	assert(scrapbook)
 
-	Cmd.GotoEndOfDocument()
-	Cmd.UnsetMark()
-	Cmd.SplitCurrentParagraph()
+	-- The clipping is added straight on to the end of the scrapbook, without
+	-- switching to it, so the cost depends only on the size of the clipping.
+	-- The paragraphs are copied, as they may be the current document's own
+	-- (see Cmd.Paste()).
+	local paragraphs = table.create(#buffer + 1)
 	if settings.timestamp then
-		Cmd.InsertStringIntoParagraph(maketimestamp(settings.pattern, currentdocument))
-		Cmd.ChangeParagraphStyle("H1")
-		Cmd.SplitCurrentParagraph()
+		local heading = maketimestamp(settings.pattern, currentDocument.name)
+		paragraphs[1] = CreateParagraph("H1", ParseStringIntoWords(heading))
 	end
-	Cmd.ChangeParagraphStyle("P")
-	Cmd.Paste()
-	
-	documentSet:setCurrent(currentdocument)
+	for i = 1, #buffer do
+		local paragraph = buffer[i]
+		paragraphs[#paragraphs+1] = CreateParagraph(paragraph.style, paragraph)
+	end
+
+	-- A new scrapbook's single empty paragraph is just replaced.
+	if (#scrapbook == 1) and (#scrapbook[1] == 1) and (scrapbook[1][1] == "") then
+		scrapbook:deleteParagraphAt(1)
+	end
+	scrapbook:appendParagraphs(paragraphs)
+	documentSet:touch()
 	NonmodalMessage("Fragment added to scrapbook.")
 	
 	return false
@@ -4,6 +4,7 @@
 -- file in this distribution for the full text.
 
 local GetStringWidth = wg.getstringwidth
+local SmartquoteParagraph = wg.smartquoteparagraph
 local P = M.P
 
 local function escape(s)
@@ -14,7 +15,7 @@ end
 -- Process incoming key events.
 
 do
-	local function cb(event, token, payload)
+	local function cb(event, token, value)
 		local settings = documentSet.addons.smartquotes or {}
 		local start_of_word_pattern =
 			(P("^") *
@@ -28,7 +29,6 @@ do
 
 		if settings.notinraw
 				and (currentDocument[currentDocument.cp].style ~= "RAW") then
-			local value = payload.value
 			local word = currentDocument[currentDocument.cp][currentDocument.cw]
 			local prefix = word:sub(1, currentDocument.co-1)
 			local first = start_of_word_pattern(prefix) ~= nil
@@ -39,11 +39,11 @@ do
 			if settings.singlequotes and (value == "'") then
 				value = first and settings.leftsingle or settings.rightsingle
 			end
-			payload.value = value
 		end
+		return value
 	end
 
-	AddEventListener("KeyTyped", cb)
+	AddEventFilter("KeyTyped", cb)
 end
 
 -----------------------------------------------------------------------------
@@ -84,50 +84,17 @@ local function convert_clipboard()
 	local settings = documentSet.addons.smartquotes or {}
 	local doc = GetClipboard()
 
-	local ld = escape(settings.leftdouble)
-	local rd = escape(settings.rightdouble)
-	local ls = escape(settings.leftsingle)
-	local rs = escape(settings.rightsingle)
-
-	local start_of_word_pattern =
-		(P("^") *
-		 (P("[\"']") +
-		  P(ld) +
-		  P(ls) +
-		  P("%c")
-		 )^0 *
-		 P("$")
-		):compile()
-
+	-- This is done natively, as it's run over entire documents. Note that the
+	-- quotes aren't patterns here.
 	for pn = 1, #doc do
 		local para = doc[pn]
 		if settings.notinraw and (para.style ~= "RAW") then
-			local newwords = {}
-			for _, w in ipairs(para) do
-				w = w:gsub('()(["\'])',
-					function(pos: number, s: string): string?
-						local prefix = w:sub(1, pos-1)
-						local first = start_of_word_pattern(prefix) ~= nil
-						if first then
-							if (s == "'") then
-								return ls
-							elseif (s == '"') then
-								return ld
-							end
-						else
-							if (s == "'") then
-								return rs
-							elseif (s == '"') then
-								return rd
-							end
-						end
-						return nil
-					end::any)
-
-				newwords[#newwords+1] = w
+			local newwords = SmartquoteParagraph(para,
+				settings.leftdouble, settings.rightdouble,
+				settings.leftsingle, settings.rightsingle)
+			if newwords then
+				doc[pn] = CreateParagraph(para.style, newwords)
 			end
-
-			doc[pn] = CreateParagraph(para.style, newwords)
 		end
 	end
 
@@ -149,7 +116,7 @@ local function unconvert_clipboard()
 		local para = clipboard[pn]
 		if settings.notinraw and (para.style ~= "RAW") then
 			local newwords = {}
-			for _, w in ipairs(para) do
+			for _, w in para do
 				w = w:gsub(ld, '"')
 				w = w:gsub(rd, '"')
 				w = w:gsub(ls, "'")
@@ -6,9 +6,11 @@
 local GetWordText = wg.getwordtext
 local GetCwd = wg.getcwd
 local ChDir = wg.chdir
-local ReadFile = wg.readfile
 
 local USER_DICTIONARY_NAME = "User dictionary"
+local DICTIONARY_POLL_TIME = 0.25
+local SCAN_BUDGET = 0.02
+local SCAN_POLL_TIME = 0.05
 
 -----------------------------------------------------------------------------
 -- Addon registration. Create the default settings in the documentSet.
@@ -56,8 +58,9 @@ end
 -----------------------------------------------------------------------------
 -- Utilities.
 
-local user_dictionary_cache: {[string]: string}?
-local system_dictionary_cache: {[string]: string}?
+local system_dictionary_cache: Dictionary?
+local system_dictionary_loading = false
+local system_dictionary_file: string? -- what it was loaded from, if anything
 
 local function get_user_dictionary_document(): Document
 	local d = documentSet:findDocument(USER_DICTIONARY_NAME)
@@ -75,50 +78,156 @@ local function get_user_dictionary_document(): Document
 						.. "one at a time, in V paragraphs and they will be "
 						.. "considered valid in your document.", "%s")
 			)
-
-		AddEventListener("DocumentModified",
-			function(self, token, document)
-				if (document == d) then
-					user_dictionary_cache = nil
-				end
-			end
-		)
 	end
 	assert(d)
 	return d
 end
 
-function GetUserDictionary(): {[string]: string}
-	if not user_dictionary_cache then
-		local d = get_user_dictionary_document()
+-- The user dictionary is a dictionary object like the system one (see
+-- dictionary.cc), with the word from each V paragraph of the dictionary
+-- document added to it. It's kept up to date with the document by looking
+-- at only the paragraphs which have changed, and counts how many words have
+-- come and gone, so the spellchecker can tell what it needs to forget.
+type UserDictionary = {
+	documentset: DocumentSet,
+	document: Document,
+	dictionary: Dictionary,
+	edits: number?, -- the documentSet._edits it was last looked at with
+	generation: number,
+	paragraphs: {Paragraph},
+}
 
-		local c = {}
+local user_dictionary: UserDictionary? = nil
+local user_additions = 0
+local user_removals = 0
+
+local function userword(p: Paragraph): string?
+	if (p.style == "V") and p[1] then
+		local w = GetWordSimpleText(p[1])
+		if (w ~= "") then
+			return w
+		end
+	end
+	return nil
+end
+
+function GetUserDictionary(): Dictionary
+	local u = user_dictionary
+	if u and (u.documentset == documentSet)
+			and (u.edits == documentSet._edits) then
+		return u.dictionary
+	end
+
+	local d = get_user_dictionary_document()
+	if not u or (u.documentset ~= documentSet) or (u.document ~= d) then
+		local c = wg.createdictionary()
 		for _, p in ipairs(d) do
-			if (p.style == "V") then
-				local w = GetWordSimpleText(p[1])
-				c[w:lower()] = w
+			local w = userword(p)
+			if w then
+				c:add(w)
+			end
+		end
+		user_dictionary = {
+			documentset = documentSet,
+			document = d,
+			dictionary = c,
+			edits = documentSet._edits,
+			generation = d:sync(),
+			paragraphs = table.move(d :: any, 1, #d, 1, {}),
+		}
+		return c
+	end
+
+	u.edits = documentSet._edits
+	local gen = d:sync()
+	if (gen ~= u.generation) then
+		local old = u.paragraphs
+		local s, removed, inserted = DiffParagraphs(old, d :: any,
+			d:changedSpan(u.generation))
+		for pn = s, s+removed-1 do
+			local w = userword(old[pn])
+			if w then
+				u.dictionary:remove(w)
+				user_removals = user_removals + 1
+			end
+		end
+		for pn = s, s+inserted-1 do
+			local w = userword(d[pn])
+			if w then
+				u.dictionary:add(w)
+				user_additions = user_additions + 1
 			end
 		end
-		user_dictionary_cache = c
+		u.generation = gen
+		u.paragraphs = table.move(d :: any, 1, #d, 1, {})
 	end
-	assert(user_dictionary_cache)
-	return user_dictionary_cache
+	return u.dictionary
 end
 
-function GetSystemDictionary(): {[string]: string}
+-- The system dictionary can be very big, so it's compiled into a hash table
+-- the first time it's used and the result kept in the config directory to be
+-- mapped straight in next time; see dictionary.cc. (Not next to the word
+-- list, which is often somewhere shared, where anyone who could write the
+-- cache could decide what everyone's spellchecker thinks.) Compiling it
+-- happens in the background, and until it's done the live checker doesn't
+-- mark anything.
+local function get_dictionary_caches(filename: string): {string}
+	return {
+		CONFIGDIR .. "/" .. (filename:gsub("[/\\:]", "_")) .. ".wgdict",
+	}
+end
+
+local empty_dictionary: Dictionary = {
+	add = function(self, word)
+		error("the empty dictionary can't be added to")
+	end,
+
+	contains = function(self, word)
+		return false
+	end,
+
+	remove = function(self, word)
+		return false
+	end,
+
+	words = function(self)
+		return {}
+	end,
+
+	suggest = function(self, word, max)
+		return {}, {}
+	end,
+
+	poll = function(self, wait)
+		return true
+	end,
+}
+
+local function reset_system_dictionary()
+	system_dictionary_cache = nil
+	system_dictionary_loading = false
+	system_dictionary_file = nil
+end
+
+-- Starts loading the system dictionary, if it isn't already loaded.
+local function load_system_dictionary(): Dictionary
 	local settings = GlobalSettings.systemdictionary
 	if not system_dictionary_cache then
-		local c = {}
-		system_dictionary_cache = c
-
-		if settings.filename then
-			NonmodalMessage("Loading system dictionary '"
-				.. settings.filename .. "'")
-			local data, e = ReadFile(settings.filename)
-			if data then
-				local fp = CreateIStream(data)
-				for s in fp:lines() do
-					c[s:lower()] = s
+		system_dictionary_cache = empty_dictionary
+
+		local filename = settings.filename
+		if filename then
+			local d, e = wg.loaddictionary(filename,
+				table.unpack(get_dictionary_caches(filename)))
+			wg.tracestartup("loaddictionary")
+			if d then
+				system_dictionary_cache = d
+				system_dictionary_file = filename
+				if not d:poll() then
+					system_dictionary_loading = true
+					NonmodalMessage("Loading system dictionary '"
+						.. filename .. "'")
+					RequestIdle(DICTIONARY_POLL_TIME)
 				end
 			else
 				NonmodalMessage("Failed to load system dictionary: "
@@ -131,45 +240,258 @@ function GetSystemDictionary(): {[string]: string}
 	return system_dictionary_cache
 end
 
+-- Returns the system dictionary, waiting for it to load if necessary.
+function GetSystemDictionary(): Dictionary
+	local d = load_system_dictionary()
+	if system_dictionary_loading then
+		d:poll(true)
+		system_dictionary_loading = false
+		QueueRedraw()
+	end
+	return d
+end
+
 function SetSystemDictionaryForTesting(array)
 	local c = {}
-	system_dictionary_cache = c
-
 	for _, w in ipairs(array) do
-		c[w:lower()] = w
+		c[w] = true
+	end
+
+	reset_system_dictionary()
+	system_dictionary_cache = {
+		add = function(self, word)
+			error("the test dictionary can't be added to")
+		end,
+
+		contains = function(self, word)
+			return c[word] or false
+		end,
+
+		remove = function(self, word)
+			return false
+		end,
+
+		words = function(self)
+			return {}
+		end,
+
+		suggest = function(self, word, max)
+			local found = {}
+			for _, w in ipairs(array) do
+				local d = wg.editdistance(word:lower(), w:lower(), 2)
+				if (d <= 2) and (w ~= word) then
+					found[#found+1] = { word = w, distance = d }
+				end
+			end
+			table.sort(found,
+				function(a, b)
+					if (a.distance ~= b.distance) then
+						return a.distance < b.distance
+					end
+					return a.word < b.word
+				end)
+			local words: {string} = {}
+			local distances: {number} = {}
+			for i = 1, math.min(#found, max or 10) do
+				words[i] = found[i].word
+				distances[i] = found[i].distance
+			end
+			return words, distances
+		end,
+
+		poll = function(self, wait)
+			return true
+		end,
+	}
+end
+
+do
+	local function cb()
+		if system_dictionary_loading then
+			if assert(system_dictionary_cache):poll() then
+				system_dictionary_loading = false
+				QueueRedraw()
+			else
+				RequestIdle(DICTIONARY_POLL_TIME)
+			end
+		end
+	end
+
+	AddEventListener("WaitingForUser", cb)
+	AddEventListener("Idle", cb)
+end
+
+local function checkword(word: string, firstword: boolean?,
+		systemdict: Dictionary, userdict: Dictionary): boolean
+	local scs = GetWordSimpleText(word)
+	local sci = scs:lower()
+	return not ((sci == "")
+		or (not sci:find("[a-zA-Z]"))
+		or (#sci < 3)
+		or systemdict:contains(scs)
+		or userdict:contains(scs)
+		or (firstword and OnlyFirstCharIsUppercase(scs) and systemdict:contains(sci))
+		or (firstword and OnlyFirstCharIsUppercase(scs) and userdict:contains(sci)))
+end
+
+-- Every visible word is checked on every redraw, so the verdict for each word
+-- is remembered. Replacing either dictionary, or taking a word out of the
+-- user dictionary, forgets them all; adding a word to the user dictionary
+-- can only make misspelt words right, so that forgets just those, and
+-- each paragraph's list of misspellings is put aside to have only the words
+-- on it checked again.
+local verdicts: {[string]: boolean} = {}
+local paragraph_misspellings: {[Paragraph]: {number}} =
+	setmetatable({}, {__mode = "k"}) :: any
+local stale_misspellings: {[Paragraph]: {number}} =
+	setmetatable({}, {__mode = "k"}) :: any
+local firstverdicts: {[string]: boolean} = {}
+local verdict_system_dictionary: Dictionary? = nil
+local verdict_user_dictionary: Dictionary? = nil
+local verdict_additions = 0
+local verdict_removals = 0
+local verdict_generation = 0
+local verdict_cachekind: (string | boolean)? = nil
+local no_user_dictionary: Dictionary = wg.createdictionary()
+
+local function forgetmisspelt(cache: {[string]: boolean})
+	for w, misspelt in cache do
+		if misspelt then
+			cache[w] = nil
+		end
 	end
 end
 
-function IsWordMisspelt(word, firstword)
+-- Returns the dictionaries to check words against (forgetting the verdicts if
+-- they've changed), or nil if the system dictionary is still loading.
+local function getdictionaries(settings): (Dictionary?, Dictionary)
+	local systemdict = empty_dictionary
+	if settings.usesystemdictionary then
+		systemdict = load_system_dictionary()
+		if system_dictionary_loading then
+			return nil, no_user_dictionary
+		end
+	end
+	local userdict = no_user_dictionary
+	if settings.useuserdictionary then
+		userdict = GetUserDictionary()
+	end
+
+	if (systemdict ~= verdict_system_dictionary)
+			or (userdict ~= verdict_user_dictionary)
+			or (user_removals ~= verdict_removals) then
+		verdicts = {}
+		firstverdicts = {}
+		verdict_system_dictionary = systemdict
+		verdict_user_dictionary = userdict
+		verdict_additions = user_additions
+		verdict_removals = user_removals
+		verdict_generation = verdict_generation + 1
+		verdict_cachekind = nil
+		paragraph_misspellings = setmetatable({}, {__mode = "k"}) :: any
+		stale_misspellings = setmetatable({}, {__mode = "k"}) :: any
+	elseif (user_additions ~= verdict_additions) then
+		forgetmisspelt(verdicts)
+		forgetmisspelt(firstverdicts)
+		for p, m in paragraph_misspellings do
+			if (#m > 0) then
+				paragraph_misspellings[p] = nil
+				stale_misspellings[p] = m
+			end
+		end
+		verdict_additions = user_additions
+		verdict_generation = verdict_generation + 1
+		verdict_cachekind = nil
+	end
+	return systemdict, userdict
+end
+
+-- Misspellings kept in the derived data cache (see derivedcache.lua) are
+-- only right for the dictionaries they were found with, so those are part
+-- of the kind they're stored as. Returns nil if misspellings shouldn't be
+-- cached (as the spellchecker is off, or the system dictionary didn't come
+-- from a file).
+local function getcachekind(): string?
 	local settings = documentSet.addons.spellchecker or {}
-	if settings.enabled then
-		local misspelt = true
-		local systemdict = {}
-		if settings.usesystemdictionary then
-			systemdict = GetSystemDictionary()
-		end
-		local userdict = {}
-		if settings.useuserdictionary then
-			userdict = GetUserDictionary()
-		end
-		local scs = GetWordSimpleText(word)
-		local sci = scs:lower()
-		if (sci == "")
-			or (not sci:find("[a-zA-Z]"))
-			or (#sci < 3)
-			or (systemdict[sci] == scs)
-			or (userdict[sci] == scs)
-			or (firstword and OnlyFirstCharIsUppercase(scs) and (systemdict[sci] == sci))
-			or (firstword and OnlyFirstCharIsUppercase(scs) and (userdict[sci] == sci))
-		then
-			misspelt = false
-		end
-		return misspelt
-	else
+	if not settings.enabled or not getdictionaries(settings) then
+		return nil
+	end
+
+	if (verdict_cachekind == nil) then
+		local system: string? = "-"
+		if (verdict_system_dictionary ~= empty_dictionary) then
+			system = nil
+			local filename = system_dictionary_file
+			local st = filename and wg.stat(filename)
+			if filename and st then
+				system = string.format("%s:%d:%d", filename, st.size,
+					st.mtime or 0)
+			end
+		end
+
+		local words = (verdict_user_dictionary or no_user_dictionary):words()
+
+		verdict_cachekind = system and ("misspellings:"..wg.combinehashes(
+			{ system, wg.combinehashes(words, 1, #words) }, 1, 2)) or false
+	end
+	return (verdict_cachekind :: any) or nil
+end
+
+function IsWordMisspelt(word: string, firstword: boolean?): boolean
+	local settings = documentSet.addons.spellchecker or {}
+	if not settings.enabled then
+		return false
+	end
+
+	local systemdict, userdict = getdictionaries(settings)
+	if not systemdict then
 		return false
 	end
+
+	local cache = firstword and firstverdicts or verdicts
+	local misspelt = cache[word]
+	if misspelt == nil then
+		misspelt = checkword(word, firstword, systemdict, userdict)
+		cache[word] = misspelt
+	end
+	return misspelt
+end
+
+-- Returns a number which changes whenever any word's highlighting might have
+-- (because the dictionaries have changed, or the checker has been turned on
+-- or off), so that the screen knows to draw everything again.
+function GetSpellcheckerGeneration(): number
+	local settings = documentSet.addons.spellchecker or {}
+	if not settings.enabled then
+		return -1
+	end
+	getdictionaries(settings)
+	return verdict_generation
+end
+
+-- Throws away the remembered verdicts and every document's misspelling
+-- index; they're rebuilt as they're needed. The memory benchmarks use this to
+-- see how much they hold.
+function ForgetSpellcheckerCaches()
+	verdicts = {}
+	firstverdicts = {}
+	paragraph_misspellings = setmetatable({}, {__mode = "k"}) :: any
+	stale_misspellings = setmetatable({}, {__mode = "k"}) :: any
+	verdict_generation = verdict_generation + 1
+	for _, d in documentSet.documents do
+		if not IsLazyDocument(d) then
+			d._misspellings = nil
+		end
+	end
 end
 
+AddEventListener("MemoryReport",
+	function(event, token, report)
+		report.add("Spelling dictionaries", system_dictionary_cache,
+			user_dictionary, verdicts, firstverdicts, paragraph_misspellings,
+			stale_misspellings)
+	end)
+
 -----------------------------------------------------------------------------
 -- Add the current word to the user dictionary.
 
@@ -177,12 +499,11 @@ function Cmd.AddToUserDictionary()
 	local word = GetWordSimpleText(currentDocument[currentDocument.cp][currentDocument.cw])
 
 	if (word ~= "") then
-		if (not GetUserDictionary()[word]) and
-				(not GetSystemDictionary()[word]) then
+		if (not GetUserDictionary():contains(word)) and
+				(not GetSystemDictionary():contains(word)) then
 			local d = get_user_dictionary_document()
 			d:appendParagraph(CreateParagraph("V", word))
 			documentSet:touch()
-			user_dictionary_cache = nil
 			NonmodalMessage("Word '"..word.."' added to user dictionary")
 		else
 			NonmodalMessage("Word '"..word.."' already in user dictionary")
@@ -195,22 +516,439 @@ function Cmd.AddToUserDictionary()
 	return true
 end
 
+-----------------------------------------------------------------------------
+-- Spelling suggestions. The system dictionary has an index for finding words
+-- near a given one (see dictionary.cc); the user dictionary's words are just
+-- looked through.
+
+--- Returns the words in whichever dictionaries are turned on which are
+-- closest to the given one, best first. A word with only its first letter
+-- capitalised, as at the start of a sentence, gets capitalised suggestions.
+--
+-- @param word               the simple text of the word
+-- @param max                the most to return (default 10)
+-- @return                   a list of words
+
+function GetSpellingSuggestions(word: string, max: number?): {string}
+	local settings = documentSet.addons.spellchecker or {}
+	local n = max or 10
+	local found: {{any}} = {}
+
+	if settings.usesystemdictionary then
+		local words, distances = GetSystemDictionary():suggest(word, n)
+		for i, w in words do
+			found[#found+1] = { w, distances[i], #found }
+		end
+	end
+
+	if settings.useuserdictionary then
+		local words, distances = GetUserDictionary():suggest(word, n)
+		for i, w in words do
+			found[#found+1] = { w, distances[i], #found }
+		end
+	end
+
+	table.sort(found,
+		function(a, b)
+			if (a[2] ~= b[2]) then
+				return a[2] < b[2]
+			end
+			return a[3] < b[3]
+		end)
+
+	local capitalise = OnlyFirstCharIsUppercase(word)
+	local results = {}
+	local seen = {}
+	for _, f in found do
+		local w = f[1]
+		if capitalise then
+			w = w:sub(1, 1):upper()..w:sub(2)
+		end
+		if not seen[w] and (w ~= word) and (#results < n) then
+			seen[w] = true
+			results[#results+1] = w
+		end
+	end
+	return results
+end
+
+-- Replaces the simple text of a word with something else, keeping its
+-- styling and punctuation if that's possible.
+local function replacesimpletext(word: string, simple: string,
+		replacement: string): string
+	local s, e = word:find(simple, 1, true)
+	if s then
+		return word:sub(1, s-1)..replacement..word:sub(assert(e)+1)
+	end
+	return replacement
+end
+
+function Cmd.SuggestSpelling()
+	local cp, cw = currentDocument.cp, currentDocument.cw
+	local paragraph = currentDocument[cp]
+	local word = paragraph[cw]
+	local simple = GetWordSimpleText(word)
+	if (simple == "") then
+		NonmodalMessage("There's no word here to suggest spellings for.")
+		return false
+	end
+
+	local suggestions = GetSpellingSuggestions(simple)
+	if (#suggestions == 0) then
+		NonmodalMessage("No suggestions for '"..simple.."'.")
+		return false
+	end
+
+	local data = {}
+	for _, w in suggestions do
+		data[#data+1] = { label = w, data = w }
+	end
+
+	local browser = Form.Browser {
+		focusable = true,
+		type = Form.Browser,
+		x1 = 1, y1 = 2,
+		x2 = -1, y2 = -1,
+		data = data,
+		cursor = 1
+	}
+
+	local dialogue: Form =
+	{
+		title = "Spelling Suggestions",
+		width = "large",
+		height = math.min(#data + 3, 15),
+		stretchy = false,
+
+		actions = {
+			["KEY_RETURN"] = "confirm",
+			["KEY_ENTER"] = "confirm",
+		},
+
+		widgets = {
+			Form.Label {
+				x1 = 1, y1 = 1,
+				x2 = -1, y2 = 1,
+				value = "Replace '"..simple.."' with:"
+			},
+
+			browser,
+		}
+	}
+
+	local result = Form.Run(dialogue, RedrawScreen,
+		"RETURN to replace, "..ESCAPE_KEY.." to cancel")
+	QueueRedraw()
+	if not result then
+		return false
+	end
+
+	local newword = replacesimpletext(word, simple,
+		data[browser.cursor].data)
+	currentDocument[cp] = paragraph:replaceWords(cw, 1, newword)
+	currentDocument.co = math.min(currentDocument.co, #newword + 1)
+	documentSet:touch()
+	return true
+end
+
 -----------------------------------------------------------------------------
 -- The core of the live checker: looks up a word and determines whether
 -- it's misspelt or not.
 
 do
-	local function cb(self, token, payload)
-		if IsWordMisspelt(payload.word, payload.firstword) then
-			payload.cstyle = bit32.bor(payload.cstyle, wg.DIM)
+	local function cb(self, token, cstyle, word, firstword)
+		if IsWordMisspelt(word, firstword) then
+			return bit32.bor(cstyle, wg.DIM)
 		end
+		return cstyle
+	end
+
+	-- Only highlighting words needs the listener; when that's off, the
+	-- paragraph renderer is free to skip DrawWord completely.
+	local function active()
+		local settings = documentSet.addons.spellchecker or {}
+		return settings.enabled == true
 	end
 
-	AddEventListener("DrawWord", cb)
+	AddEventFilter("DrawWord", cb, active)
 end
 
 -----------------------------------------------------------------------------
--- The core of the offline checker: scan forward looking for misspelt words.
+-- The background checker: keeps track of which paragraphs of the current
+-- document have misspelt words in them, so that finding the next one (or
+-- counting them) doesn't mean checking every word. As paragraphs are
+-- immutable, each one is only checked once for each set of dictionaries;
+-- after an edit, only the paragraphs which have changed need looking at.
+--
+-- Until the whole document has been checked (which happens a bit at a time
+-- when the user isn't doing anything) the index just has a scan position.
+
+type MisspellingIndex = {
+	verdicts: number, -- the verdict_generation it was built with
+	scanned: number, -- paragraphs checked so far, until complete
+	generation: number?, -- the following are set once it's complete
+	paragraphs: {Paragraph}?,
+	pns: {number}?, -- paragraphs with misspelt words, in order
+	count: number?, -- the number of misspelt words
+}
+
+-- Whether words can be checked right now.
+local function checkerready(): boolean
+	local settings = documentSet.addons.spellchecker or {}
+	return settings.enabled and (getdictionaries(settings) ~= nil)
+end
+
+-- Returns the numbers of the misspelt words in a paragraph.
+local function getmisspellings(p: Paragraph): {number}
+	local cached = paragraph_misspellings[p]
+	if cached then
+		return cached
+	end
+
+	local kind = getcachekind()
+	local m = kind and LookupDerivedData(kind, p)
+	local stale = stale_misspellings[p]
+	if not m and stale then
+		-- Only words which were misspelt before can be now.
+		local found = {}
+		local sentences = p:wrap().sentences
+		for _, wn in stale do
+			if IsWordMisspelt(p[wn], sentences[wn]) then
+				found[#found+1] = wn
+			end
+		end
+		if kind then
+			StoreDerivedData(kind, p, found)
+		end
+		m = found
+	end
+	stale_misspellings[p] = nil
+	if not m then
+		local found = {}
+		local sentences = p:wrap().sentences
+		for wn, w in ipairs(p) do
+			if IsWordMisspelt(w, sentences[wn]) then
+				found[#found+1] = wn
+			end
+		end
+		if kind then
+			StoreDerivedData(kind, p, found)
+		end
+		m = found
+	end
+	assert(m)
+	paragraph_misspellings[p] = m
+	return m
+end
+
+local function startscan(document: Document): MisspellingIndex
+	-- With the word index turned on, paragraphs with no misspelt words in
+	-- them can be found without looking at them. (Any word misspelt at the
+	-- start of a sentence is misspelt anywhere else, too.)
+
+	local pns = GetIndexedParagraphs(document,
+		function(w)
+			return IsWordMisspelt(w, false)
+		end)
+	if pns then
+		local wanted = {}
+		for _, pn in pns do
+			wanted[document[pn]] = true
+		end
+		for _, p in ipairs(document) do
+			if not wanted[p] and not paragraph_misspellings[p] then
+				paragraph_misspellings[p] = {}
+			end
+		end
+	end
+
+	local index = { verdicts = verdict_generation, scanned = 0 }
+	document._misspellings = index
+	return index
+end
+
+local function finishscan(document: Document, index: MisspellingIndex)
+	-- Everything's been checked apart from anything edited since.
+	local pns = {}
+	local count = 0
+	for pn, p in ipairs(document) do
+		local n = #getmisspellings(p)
+		if (n > 0) then
+			pns[#pns+1] = pn
+			count = count + n
+		end
+	end
+
+	index.generation = document:sync()
+	index.paragraphs = table.move(document :: any, 1, #document, 1, {})
+	index.pns = pns
+	index.count = count
+end
+
+-- Brings a complete index up to date with the document.
+local function syncindex(document: Document, index: MisspellingIndex)
+	local gen = document:sync()
+	local igen = assert(index.generation)
+	if (gen == igen) then
+		return
+	end
+
+	local old = assert(index.paragraphs)
+	local s, removed, inserted = DiffParagraphs(old, document :: any,
+		document:changedSpan(igen))
+	local delta = inserted - removed
+	local count = assert(index.count)
+	local pns = {}
+	for _, pn in assert(index.pns) do
+		if (pn < s) then
+			pns[#pns+1] = pn
+		elseif (pn < (s + removed)) then
+			count = count - #getmisspellings(old[pn])
+		end
+	end
+	for pn = s, s+inserted-1 do
+		local n = #getmisspellings(document[pn])
+		if (n > 0) then
+			pns[#pns+1] = pn
+			count = count + n
+		end
+	end
+	for _, pn in assert(index.pns) do
+		if (pn >= (s + removed)) then
+			pns[#pns+1] = pn + delta
+		end
+	end
+
+	index.generation = gen
+	index.paragraphs = table.move(document :: any, 1, #document, 1, {})
+	index.pns = pns
+	index.count = count
+end
+
+-- Returns a document's misspelling index, brought up to date. With a budget
+-- (in seconds), gives up and returns nil if checking the whole document
+-- takes longer than that; it carries on from where it left off next time.
+-- The checker must be ready.
+local function updateindex(document: Document, budget: number?)
+		: MisspellingIndex?
+	local index: MisspellingIndex? = document._misspellings
+	if not index or (index.verdicts ~= verdict_generation) then
+		index = startscan(document)
+	end
+	assert(index)
+
+	if not index.paragraphs then
+		local deadline = budget and (wg.time() + budget)
+		local pn = index.scanned
+		while (pn < #document) do
+			-- Most paragraphs are quicker to check than reading the clock,
+			-- so do a batch at a time.
+			for i = 1, 16 do
+				pn = pn + 1
+				local p = document[pn]
+				if not p then
+					break
+				end
+				getmisspellings(p)
+			end
+			index.scanned = pn
+			if deadline and (wg.time() >= deadline) then
+				return nil
+			end
+			TaskCheckpoint(pn / #document)
+		end
+		finishscan(document, index)
+	end
+
+	syncindex(document, index)
+	return index
+end
+
+-- Returns the first misspelt word at or after pn, wn (wrapping round at the
+-- end of the document), or nil if there aren't any.
+local function findmisspelling(document: Document, index: MisspellingIndex,
+		pn: number, wn: number): (number?, number?)
+	for _, w in getmisspellings(document[pn]) do
+		if (w >= wn) then
+			return pn, w
+		end
+	end
+
+	local pns = assert(index.pns)
+	local lo, hi = 1, #pns + 1
+	while (lo < hi) do
+		local mid = (lo + hi) // 2
+		if (pns[mid] <= pn) then
+			lo = mid + 1
+		else
+			hi = mid
+		end
+	end
+
+	local n = pns[lo] or pns[1]
+	if n then
+		return n, getmisspellings(document[n])[1]
+	end
+	return nil, nil
+end
+
+-- Returns the number of misspelt words in the current document, or nil if
+-- that's not known yet.
+function GetMisspeltWordCount(): number?
+	local ready = checkerready()
+	local index: MisspellingIndex? = currentDocument._misspellings
+	if not index or (index.verdicts ~= verdict_generation)
+			or not index.paragraphs then
+		return nil
+	end
+	assert(index)
+
+	if ready then
+		syncindex(currentDocument, index)
+	end
+	return index.count
+end
+
+do
+	local lastcount: number? = nil
+
+	local function cb()
+		if not checkerready() then
+			return
+		end
+
+		local index = updateindex(currentDocument, SCAN_BUDGET)
+		if not index then
+			-- Keep going until it's finished.
+			RequestIdle(SCAN_POLL_TIME)
+		elseif (index.count ~= lastcount) then
+			-- Update the status bar.
+			lastcount = index.count
+			QueueRedraw()
+		end
+	end
+
+	AddEventListener("Idle", cb)
+end
+
+-- The count changes as the background check progresses, on Idle.
+AddStatusBarField(95, {"Changed", "Idle"},
+	function()
+		local settings = documentSet.addons.spellchecker or {}
+		if not settings.enabled then
+			return nil
+		end
+
+		local count = GetMisspeltWordCount()
+		if count then
+			return string.format("%d %s", count,
+				Pluralise(count, "misspelling", "misspellings"))
+		end
+		return nil
+	end)
+
+-----------------------------------------------------------------------------
+-- The core of the offline checker: find the next misspelt word.
 
 function Cmd.FindNextMisspeltWord()
 	ImmediateMessage("Searching...")
@@ -218,9 +956,9 @@ function Cmd.FindNextMisspeltWord()
 	-- If we have a selection, start checking from immediately
 	-- afterwards. Otherwise, start at the current cursor position.
 
-	local sp, sw, so
+	local sp, sw
 	if currentDocument.mp then
-		sp, sw, so = assert(currentDocument.mp), assert(currentDocument.mw) + 1, 1
+		sp, sw = assert(currentDocument.mp), assert(currentDocument.mw) + 1
 		if sw > #currentDocument[sp] then
 			sw = 1
 			sp = sp + 1
@@ -229,52 +967,45 @@ function Cmd.FindNextMisspeltWord()
 			end
 		end
 	else
-		sp, sw, so = currentDocument.cp, currentDocument.cw, 1
-	end
-	local cp, cw, co = sp, sw, so
-
-	-- Keep looping until we reach the starting point again.
-
-	currentDocument[1]:wrap()
-	while true do
-		local paragraph = currentDocument[cp]
-		local word = paragraph[cw]
-		local wrapdata = paragraph:wrap()
-		if IsWordMisspelt(word, wrapdata.sentences[cw]) then
-			currentDocument.cp = cp
-			currentDocument.cw = cw
-			currentDocument.co = #word + 1
-			currentDocument.mp = cp
-			currentDocument.mw = cw
-			currentDocument.mo = 1
-			NonmodalMessage("Misspelt word found.")
-			QueueRedraw()
-			return true
-		end
-
-		-- Nothing. Move on to the next word.
+		sp, sw = currentDocument.cp, currentDocument.cw
+	end
 
-		co = 1
-		cw = cw + 1
-		if (cw > #currentDocument[cp]) then
-			cw = 1
-			cp = cp + 1
-			if (cp > #currentDocument) then
-				cp = 1
-			end
-			currentDocument[cp]:wrap()
-		end
+	-- Unlike the live checker, this can't just pass over words while the
+	-- system dictionary is loading.
 
-		-- Check to see if we've scanned everything.
+	local settings = documentSet.addons.spellchecker or {}
+	if settings.enabled and settings.usesystemdictionary then
+		GetSystemDictionary()
+	end
 
-		if (cp == sp) and (cw == sw) and (co == 1) then
-			break
-		end
+	local ok, cp, cw = true, nil, nil
+	if checkerready() then
+		ok, cp, cw = RunTask("Searching...",
+			function()
+				return findmisspelling(currentDocument,
+					assert(updateindex(currentDocument)), sp, sw)
+			end)
 	end
 
 	QueueRedraw()
-	NonmodalMessage("No misspelt words found.")
-	return false
+	if not ok then
+		return false
+	end
+	if not cp then
+		NonmodalMessage("No misspelt words found.")
+		return false
+	end
+	assert(cw)
+
+	local word = currentDocument[cp][cw]
+	currentDocument.cp = cp
+	currentDocument.cw = cw
+	currentDocument.co = #word + 1
+	currentDocument.mp = cp
+	currentDocument.mw = cw
+	currentDocument.mo = 1
+	NonmodalMessage("Misspelt word found.")
+	return true
 end
 
 -----------------------------------------------------------------------------
@@ -355,7 +1086,7 @@ function Cmd.ConfigureSpellchecker()
 
 	settings.enabled = highlight_checkbox.value
 	settings.usesystemdictionary = systemdictionary_checkbox.value
-	system_dictionary_cache = nil
+	reset_system_dictionary()
 	settings.useuserdictionary = userdictionary_checkbox.value
 	documentSet:touch()
 	return true
@@ -375,7 +1106,7 @@ function Cmd.ConfigureSystemDictionary()
 	ChDir(oldcwd)
 
 	if filename then
-		system_dictionary_cache = nil
+		reset_system_dictionary()
 		settings.filename = filename
 		SaveGlobalSettings()
 	end
@@ -0,0 +1,247 @@
+--!nonstrict
+-- © 2026 David Given.
+-- WordGrinder is licensed under the MIT open source license. See the COPYING
+-- file in this distribution for the full text.
+
+-- Document statistics: how many words, characters, sentences and paragraphs
+-- there are, and (when asked for) how often each word appears. Paragraphs
+-- are immutable, so what's in each one is only counted once; a document's
+-- totals are kept up to date by taking away the paragraphs which have gone
+-- since last time and adding the ones which have appeared, which the
+-- document's change tracking finds. Asking for the statistics therefore
+-- only costs as much as what's been edited since the last time.
+
+local ParagraphStats = wg.paragraphstats
+
+type ParagraphSummary = {
+	words: number,
+	characters: number,
+	sentences: number,
+}
+
+type DocumentStatistics = {
+	generation: number,
+	snapshot: {Paragraph},
+
+	words: number,
+	characters: number, -- not counting the spaces between words
+	spaces: number,
+	sentences: number,
+	paragraphcount: number, -- only those with words in
+
+	-- How many times each word appears, by simple text, and how many
+	-- different words there are; only kept once something has asked.
+	counts: {[string]: number}?,
+	distinct: number,
+}
+
+local summaries: {[Paragraph]: ParagraphSummary} =
+	setmetatable({}, {__mode = "k"}) :: any
+
+local function summarise(p: Paragraph): ParagraphSummary
+	local s = summaries[p]
+	if not s then
+		local words, characters, sentences
+		local c = LookupDerivedData("stats", p)
+		if c then
+			words, characters, sentences = c[1], c[2], c[3]
+		else
+			words, characters, sentences = ParagraphStats(p)
+			StoreDerivedData("stats", p, { words, characters, sentences })
+		end
+		s = { words = words, characters = characters, sentences = sentences }
+		summaries[p] = s
+	end
+	return s
+end
+
+-- Adds a paragraph to the statistics, or with a sign of -1 takes it away.
+local function addparagraph(stats: DocumentStatistics, p: Paragraph,
+		sign: number)
+	local s = summarise(p)
+	local n = s.words
+	if (n == 0) then
+		return
+	end
+
+	stats.words = stats.words + sign*n
+	stats.characters = stats.characters + sign*s.characters
+	stats.spaces = stats.spaces + sign*(n - 1)
+	stats.sentences = stats.sentences + sign*s.sentences
+	stats.paragraphcount = stats.paragraphcount + sign
+
+	local counts = stats.counts
+	if counts then
+		for w, c in GetParagraphWords(p) do
+			local old = counts[w]
+			local new = (old or 0) + sign*c
+			if (new > 0) then
+				if not old then
+					stats.distinct = stats.distinct + 1
+				end
+				counts[w] = new
+			else
+				if old then
+					stats.distinct = stats.distinct - 1
+				end
+				counts[w] = nil
+			end
+		end
+	end
+end
+
+local function buildstatistics(document: Document, wantcounts: boolean?)
+		: DocumentStatistics
+	local stats = {
+		generation = document:sync(),
+		snapshot = table.move(document :: any, 1, #document, 1, {}),
+		words = 0,
+		characters = 0,
+		spaces = 0,
+		sentences = 0,
+		paragraphcount = 0,
+		counts = if wantcounts then {} else nil,
+		distinct = 0,
+	}
+	for _, p in ipairs(document) do
+		addparagraph(stats, p, 1)
+	end
+	return stats
+end
+
+-- Returns the statistics of a document, brought up to date. Word counts
+-- are only kept if wantcounts is set (now or on an earlier call), as they
+-- cost more than everything else together. The result belongs to the
+-- document and mustn't be changed.
+function GetDocumentStatistics(document: Document, wantcounts: boolean?)
+		: DocumentStatistics
+	local stats = document._statistics
+	if not stats or (wantcounts and not stats.counts) then
+		stats = buildstatistics(document, wantcounts)
+		document._statistics = stats
+		return stats
+	end
+
+	local gen = document:sync()
+	if (gen ~= stats.generation) then
+		local s, removed, inserted = DiffParagraphs(stats.snapshot,
+			document :: any, document:changedSpan(stats.generation))
+		local old = stats.snapshot
+		for i = s, s+removed-1 do
+			addparagraph(stats, old[i], -1)
+		end
+		for i = s, s+inserted-1 do
+			addparagraph(stats, document[i], 1)
+		end
+		stats.snapshot = table.move(document :: any, 1, #document, 1, {})
+		stats.generation = gen
+	end
+	return stats
+end
+
+-- Returns the n most common words in a document, ignoring case, as a list
+-- of {word, count} pairs, most common first.
+function GetMostFrequentWords(document: Document, n: number)
+		: {{string | number}}
+	local stats = GetDocumentStatistics(document, true)
+
+	local counts = {}
+	for w, c in assert(stats.counts) do
+		local l = w:lower()
+		counts[l] = (counts[l] or 0) + c
+	end
+
+	local words = {}
+	for w in counts do
+		words[#words+1] = w
+	end
+	table.sort(words,
+		function(a, b)
+			if (counts[a] ~= counts[b]) then
+				return counts[a] > counts[b]
+			end
+			return a < b
+		end)
+
+	local result: {{string | number}} = {}
+	for i = 1, math.min(n, #words) do
+		result[i] = { words[i], counts[words[i]] }
+	end
+	return result
+end
+
+-----------------------------------------------------------------------------
+-- Statistics dialogue.
+
+local MOST_FREQUENT = 5
+
+function Cmd.ShowDocumentStatistics()
+	ImmediateMessage("Counting...")
+	local stats = GetDocumentStatistics(currentDocument, true)
+	local frequent = GetMostFrequentWords(currentDocument, MOST_FREQUENT)
+	QueueRedraw()
+
+	local rows: {{any}} = {
+		{ "Words:", stats.words },
+		{ "Different words:", stats.distinct },
+		{ "Characters:", stats.characters + stats.spaces },
+		{ "Characters, not counting spaces:", stats.characters },
+		{ "Sentences:", stats.sentences },
+		{ "Paragraphs:", stats.paragraphcount },
+	}
+
+	local widgets = {}
+	local y = 1
+	local function addrow(label: string, value: string)
+		widgets[#widgets+1] = Form.Label {
+			x1 = 1, y1 = y,
+			x2 = -12, y2 = y,
+			align = "left",
+			value = label
+		}
+		widgets[#widgets+1] = Form.Label {
+			x1 = -11, y1 = y,
+			x2 = -1, y2 = y,
+			align = "right",
+			value = value
+		}
+		y = y + 1
+	end
+
+	for _, row in rows do
+		addrow(row[1], tostring(row[2]))
+	end
+	if (#frequent > 0) then
+		y = y + 1
+		widgets[#widgets+1] = Form.Label {
+			x1 = 1, y1 = y,
+			x2 = -1, y2 = y,
+			align = "left",
+			value = "Most frequent words:"
+		}
+		y = y + 1
+		for _, f in frequent do
+			addrow("  "..tostring(f[1]), tostring(f[2]))
+		end
+	end
+
+	local dialogue: Form =
+	{
+		title = "Document Statistics",
+		width = "large",
+		height = y,
+		stretchy = false,
+
+		actions = {
+			["KEY_RETURN"] = "confirm",
+			["KEY_ENTER"] = "confirm",
+		},
+
+		widgets = widgets
+	}
+
+	Form.Run(dialogue, RedrawScreen,
+		"RETURN or "..ESCAPE_KEY.." to close")
+	QueueRedraw()
+	return true
+end
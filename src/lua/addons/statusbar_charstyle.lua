@@ -8,24 +8,12 @@ local style = 0
 -----------------------------------------------------------------------------
 -- Build the status bar.
 
-do
-	local function cb(event, token, terms)
-		local s =
-		{
-			bit32.btest(style, wg.ITALIC) and "I" or ".",
-			bit32.btest(style, wg.BOLD) and "B" or ".",
-			bit32.btest(style, wg.UNDERLINE) and "U" or "."
-		}
-
-		terms[#terms+1] =
-			{
-				priority=110,
-				value=table.concat(s)
-			}
-	end
-	
-	AddEventListener("BuildStatusBar", cb)
-end
+local field = AddStatusBarField(110, {"Moved"},
+	function()
+		return (bit32.btest(style, wg.ITALIC) and "I" or ".")..
+			(bit32.btest(style, wg.BOLD) and "B" or ".")..
+			(bit32.btest(style, wg.UNDERLINE) and "U" or ".")
+	end)
 
 -----------------------------------------------------------------------------
 -- Update the style whenever the cursor moves.
@@ -44,6 +32,7 @@ end
 function SetCurrentStyleHint(sxor, sand)
 	style = bit32.bxor(style, sxor)
 	style = bit32.band(style, sand)
+	InvalidateStatusBarField(field)
 end
 
 function GetCurrentStyleHint()
@@ -3,34 +3,232 @@
 -- WordGrinder is licensed under the MIT open source license. See the COPYING
 -- file in this distribution for the full text.
 
+local CountLines = wg.countlines
+
+-----------------------------------------------------------------------------
+-- Page layout. Rather than guessing from the word count, each paragraph's
+-- lines are counted at the page width, and the blank lines between
+-- paragraphs are added in, which is what a printout would have. Paragraphs
+-- are immutable, so each is only counted once (for a given width and
+-- style); the document's total is kept up to date by taking away the
+-- paragraphs which have gone since last time, and the gaps either side of
+-- them, and adding the ones which have appeared.
+
+type PageLayout = {
+	width: number,
+	fullstopspaces: boolean,
+	styles: DocumentStyles,
+	generation: number,
+	snapshot: {Paragraph},
+	lines: number,
+}
+
+-- Each paragraph's line count, and what it was counted with.
+local paragraphlines: {[Paragraph]: {any}} =
+	setmetatable({}, {__mode = "k"}) :: any
+
+local function getsettings()
+	local settings = documentSet.addons.pagecount or {}
+	return settings.linewidth or 65, settings.linesperpage or 50
+end
+
+local function linesof(p: Paragraph, width: number, fullstopspaces: boolean)
+		: number
+	local indent1 = p:getIndentOfLine(1)
+	local indent2 = p:getIndentOfLine(2)
+	local c = paragraphlines[p]
+	if not c or (c[1] ~= width) or (c[2] ~= indent1) or (c[3] ~= indent2)
+			or (c[4] ~= fullstopspaces) then
+		-- The layout a paragraph had last session is probably the one it
+		-- has now.
+		local fss = fullstopspaces and 1 or 0
+		local d = LookupDerivedData("lines", p)
+		local n
+		if d and (d[1] == width) and (d[2] == indent1) and (d[3] == indent2)
+				and (d[4] == fss) then
+			n = d[5]
+		else
+			n = CountLines(p, width, indent1, indent2, fullstopspaces)
+			StoreDerivedData("lines", p, { width, indent1, indent2, fss, n })
+		end
+		paragraphlines[p] = { width, indent1, indent2, fullstopspaces, n }
+		return n
+	end
+	return c[5]
+end
+
+-- The blank lines between two paragraphs.
+local function gap(a: Paragraph, b: Paragraph): number
+	return math.max(documentStyles[a.style].below or 0,
+		documentStyles[b.style].above or 0)
+end
+
+-- Returns the number of lines a document takes up, at the page width.
+function GetDocumentLayoutLines(document: Document): number
+	local width = getsettings()
+	local fullstopspaces = WantFullStopSpaces()
+	local gen = document:sync()
+
+	local layout: PageLayout? = document._pagelayout
+	if not layout or (layout.width ~= width)
+			or (layout.fullstopspaces ~= fullstopspaces)
+			or (layout.styles ~= documentStyles) then
+		local lines = 0
+		for pn, p in ipairs(document) do
+			lines = lines + linesof(p, width, fullstopspaces)
+			if (pn > 1) then
+				lines = lines + gap(document[pn-1], p)
+			end
+		end
+
+		document._pagelayout = {
+			width = width,
+			fullstopspaces = fullstopspaces,
+			styles = documentStyles,
+			generation = gen,
+			snapshot = table.move(document :: any, 1, #document, 1, {}),
+			lines = lines,
+		}
+		return lines
+	end
+	assert(layout)
+
+	if (gen ~= layout.generation) then
+		local old = layout.snapshot
+		local s, removed, inserted = DiffParagraphs(old, document :: any,
+			document:changedSpan(layout.generation))
+		local lines = layout.lines
+
+		-- The gaps which change are those between the changed paragraphs
+		-- and either side of them.
+		for i = s, s+removed-1 do
+			lines = lines - linesof(old[i], width, fullstopspaces)
+		end
+		for i = math.max(s, 2), math.min(s+removed, #old) do
+			lines = lines - gap(old[i-1], old[i])
+		end
+		for i = s, s+inserted-1 do
+			lines = lines + linesof(document[i], width, fullstopspaces)
+		end
+		for i = math.max(s, 2), math.min(s+inserted, #document) do
+			lines = lines + gap(document[i-1], document[i])
+		end
+
+		layout.lines = lines
+		layout.generation = gen
+		layout.snapshot = table.move(document :: any, 1, #document, 1, {})
+	end
+	return layout.lines
+end
+
+-- Returns the number of pages in the document, counted the way the user
+-- asked for.
+function GetDocumentPageCount(document: Document): number
+	local settings = documentSet.addons.pagecount or {}
+	if settings.bylayout then
+		local _, linesperpage = getsettings()
+		return math.max(1,
+			math.ceil(GetDocumentLayoutLines(document) / linesperpage))
+	end
+	return math.floor((document.wordcount or 0) / (settings.wordsperpage or 250))
+end
+
+-- Finds where a page of the document starts, as a paragraph and word
+-- number. Pages past the end give the last paragraph.
+function FindPage(document: Document, page: number): (number, number)
+	local width, linesperpage = getsettings()
+	local fullstopspaces = WantFullStopSpaces()
+	local target = (page - 1) * linesperpage
+
+	local line = 0
+	for pn, p in ipairs(document) do
+		if (pn > 1) then
+			line = line + gap(document[pn-1], p)
+		end
+		local n = linesof(p, width, fullstopspaces)
+		if ((line + n) > target) then
+			-- It's in this paragraph, so find out where its lines start.
+			local ln = math.max(1, target - line + 1)
+			local lines = wg.wrapparagraph(p, width, p:getIndentOfLine(1),
+				p:getIndentOfLine(2), fullstopspaces)
+			local l = lines[math.min(ln, #lines)]
+			return pn, l and (l.wn :: number) or 1
+		end
+		line = line + n
+	end
+	return #document, 1
+end
+
+function Cmd.GotoPage(page: number?)
+	if not page then
+		local pages = GetDocumentPageCount(currentDocument)
+		local s = PromptForString("Go to page",
+			string.format("Which page (1 to %d)?", pages))
+		if not s then
+			return false
+		end
+		page = tonumber(s)
+		if not page or (page < 1) then
+			ModalMessage("Parameter error", "That's not a page number.")
+			return false
+		end
+	end
+	assert(page)
+
+	local pn, wn
+	local settings = documentSet.addons.pagecount or {}
+	if settings.bylayout then
+		pn, wn = FindPage(currentDocument, page)
+	else
+		-- Without a layout, pages are a number of words long.
+		local target = (page - 1) * (settings.wordsperpage or 250)
+		pn, wn = #currentDocument, 1
+		local words = 0
+		for i, p in ipairs(currentDocument) do
+			if ((words + #p) > target) then
+				pn, wn = i, target - words + 1
+				break
+			end
+			words = words + #p
+		end
+	end
+
+	currentDocument.cp = pn
+	currentDocument.cw = wn
+	currentDocument.co = 1
+	QueueRedraw()
+	return true
+end
+
 -----------------------------------------------------------------------------
 -- Build the status bar.
 
-do
-	local function cb(event, token, terms)
+AddStatusBarField(80, {"Changed"},
+	function()
 		local settings = documentSet.addons.pagecount or {}
 		if settings.enabled then
-			local pages = math.floor((currentDocument.wordcount or 0) / settings.wordsperpage)
-			terms[#terms+1] = {
-				priority=80,
-				value=string.format("%d %s", pages,
-					Pluralise(pages, "page", "pages"))
-			}
+			local pages = GetDocumentPageCount(currentDocument)
+			return string.format("%d %s", pages,
+				Pluralise(pages, "page", "pages"))
 		end
-	end
-	
-	AddEventListener("BuildStatusBar", cb)
-end
+		return nil
+	end)
 
 -----------------------------------------------------------------------------
 -- Addon registration. Create the default settings in the documentSet.
 
 do
 	local function cb()
-		documentSet.addons.pagecount = documentSet.addons.pagecount or {
+		local settings = documentSet.addons.pagecount or {
 			enabled = false,
 			wordsperpage = 250,
 		}
+		if (settings.bylayout == nil) then
+			settings.bylayout = false
+			settings.linewidth = 65
+			settings.linesperpage = 50
+		end
+		documentSet.addons.pagecount = settings
 	end
 	
 	AddEventListener("RegisterAddons", cb)
@@ -56,12 +254,34 @@ function Cmd.ConfigurePageCount()
 			x2 = -1, y2 = 3,
 			value = tostring(settings.wordsperpage)
 		}
+
+	local layout_checkbox =
+		Form.Checkbox {
+			x1 = 1, y1 = 5,
+			x2 = -1, y2 = 5,
+			label = "Count pages by laying out the text",
+			value = settings.bylayout
+		}
+
+	local width_textfield =
+		Form.TextField {
+			x1 = -11, y1 = 7,
+			x2 = -1, y2 = 7,
+			value = tostring(settings.linewidth)
+		}
+
+	local lines_textfield =
+		Form.TextField {
+			x1 = -11, y1 = 9,
+			x2 = -1, y2 = 9,
+			value = tostring(settings.linesperpage)
+		}
 		
 	local dialogue: Form =
 	{
 		title = "Configure Page Count",
 		width = "large",
-		height = 5,
+		height = 11,
 		stretchy = false,
 
 		actions = {
@@ -79,6 +299,24 @@ function Cmd.ConfigurePageCount()
 				value = "Number of words per page:"
 			},
 			count_textfield,
+
+			layout_checkbox,
+
+			Form.Label {
+				x1 = 1, y1 = 7,
+				x2 = 32, y2 = 7,
+				align = "left",
+				value = "Characters per line:"
+			},
+			width_textfield,
+
+			Form.Label {
+				x1 = 1, y1 = 9,
+				x2 = 32, y2 = 9,
+				align = "left",
+				value = "Lines per page:"
+			},
+			lines_textfield,
 		}
 	}
 	
@@ -91,12 +329,21 @@ function Cmd.ConfigurePageCount()
 		
 		local enabled = enabled_checkbox.value
 		local wordsperpage = tonumber(count_textfield.value)
+		local linewidth = tonumber(width_textfield.value)
+		local linesperpage = tonumber(lines_textfield.value)
 		
 		if not wordsperpage then
 			ModalMessage("Parameter error", "The number of words per page must be a valid number.")
+		elseif not linewidth or (linewidth < 1) then
+			ModalMessage("Parameter error", "The number of characters per line must be a valid number.")
+		elseif not linesperpage or (linesperpage < 1) then
+			ModalMessage("Parameter error", "The number of lines per page must be a valid number.")
 		else
 			settings.enabled = enabled
 			settings.wordsperpage = wordsperpage
+			settings.bylayout = layout_checkbox.value
+			settings.linewidth = linewidth
+			settings.linesperpage = linesperpage
 			documentSet:touch()
 
 			return true
@@ -8,18 +8,11 @@ local string_format = string.format
 -----------------------------------------------------------------------------
 -- Build the status bar.
 
-do
-	local function cb(event, token, terms)
-		terms[#terms+1] = 
-			{
-				priority=100,
-				value=string_format("%s: %d/%d",
-					currentDocument[currentDocument.cp].style,
-					currentDocument.cp,
-					#currentDocument)
-			}
-	end
-	
-	AddEventListener("BuildStatusBar", cb)
-end
+AddStatusBarField(100, {"Moved", "Changed"},
+	function()
+		return string_format("%s: %d/%d",
+			currentDocument[currentDocument.cp].style,
+			currentDocument.cp,
+			#currentDocument)
+	end)
 
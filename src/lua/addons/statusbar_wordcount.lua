@@ -8,17 +8,10 @@ local string_format = string.format
 -----------------------------------------------------------------------------
 -- Build the status bar.
 
-do
-	local function cb(event, token, terms)
-		terms[#terms+1] = 
-			{
-				priority=90,
-				value=string_format("%d %s", currentDocument.wordcount or 0,
-					Pluralise(currentDocument.wordcount or 0, "word", "words"))
-			}
-	end
-	
-	AddEventListener("BuildStatusBar", cb)
-end
+AddStatusBarField(90, {"Changed"},
+	function()
+		return string_format("%d %s", currentDocument.wordcount or 0,
+			Pluralise(currentDocument.wordcount or 0, "word", "words"))
+	end)
 
 
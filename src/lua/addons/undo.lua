@@ -3,79 +3,525 @@
 -- WordGrinder is licensed under the MIT open source license. See the COPYING
 -- file in this distribution for the full text.
 
-local STACKSIZE = 500
+-- The undo and redo stacks only keep one full copy of the document each:
+-- the newest state on the stack. Every entry records the paragraphs which
+-- differ between it and the next older state, so stepping backwards is a
+-- matter of splicing those in. As paragraphs are immutable, a typical entry
+-- holds one or two of them. The stacks are limited by the (estimated)
+-- memory they hold, not by how many entries they have.
+--
+-- Once a stack is over its limit, the oldest entries' paragraphs are paged
+-- out to a spill file (shared by every stack), leaving just a manifest of
+-- their hashes behind; they're only read back if the user undoes that far.
+-- The spill file has its own, much larger, limit on how much history it
+-- holds. When it's reached, the file is compacted to just the paragraphs
+-- which are still referred to, if those are now a small part of it; if
+-- they're not, the oldest entries are discarded altogether.
 
-local function shallowequals(t1, t2)
-	if (#t1 ~= #t2) then
+local AppendFile = wg.appendfile
+local Mkdirs = wg.mkdirs
+local ReadDir = wg.readdir
+local Stat = wg.stat
+
+local ENTRYSIZE = 64
+local PARAGRAPHSIZE = 40
+local WORDSIZE = 24
+local GROUPWORDS = 20
+local HASHSIZE = 24
+
+-- The group each kind of checkpoint belongs to. A checkpoint of a kind in the
+-- same group as the one before, and soon enough after it, is merged into it;
+-- anything else (including paste, styling and new paragraphs) is always an
+-- undo step of its own.
+local GROUPS = {
+	typing = "typing",
+	word = "typing",
+	delete = "delete",
+}
+
+local function getlimit(): number
+	local settings = GlobalSettings.undo
+	return (settings and settings.limit or 16384) * 1024
+end
+
+local function getspilllimit(): number
+	local settings = GlobalSettings.undo
+	return (settings and settings.spill or 262144) * 1024
+end
+
+local function getgrouptime(): number
+	local settings = GlobalSettings.undo
+	return settings and settings.grouptime or 2
+end
+
+local function newstack(): UndoStack
+	return { size = 0 }
+end
+
+local function paragraphsize(p: Paragraph): number
+	local size = PARAGRAPHSIZE
+	for i = 1, #p do
+		size = size + WORDSIZE + #p[i]
+	end
+	return size
+end
+
+-- The spill file is in the same format as an autosave pack: one line per
+-- paragraph, each being its hash, style and words. Each paragraph is written
+-- once however many entries refer to it.
+
+type Spill = {
+	filename: string,
+	size: number,
+	records: {[string]: {number}}, -- offset and length of each paragraph
+}
+
+local spill: Spill? = nil
+
+-- Every stack which has paged anything out, so that compacting the spill
+-- file can find the entries which still need it. Stacks which are thrown
+-- away (like a replaced redo stack) drop out of this on their own.
+local spillstacks: {[UndoStack]: boolean} =
+	setmetatable({}, {__mode = "k"}) :: any
+
+-- Paging out doesn't free a paragraph which something else (like the
+-- document) is still using, so when reading one back in, the original is
+-- used if it's still around; that keeps paragraphs shared.
+local spilledparagraphs: {[string]: Paragraph} =
+	setmetatable({}, {__mode = "v"}) :: any
+
+local function spillfilename(): string
+	return string.format("%s/undo/%d-%04x.pack", CONFIGDIR, os.time(),
+		math.random(0, 0xffff))
+end
+
+local function openspill(): Spill?
+	if spill then
+		return spill
+	end
+
+	local dir = CONFIGDIR.."/undo"
+	local _, e = Mkdirs(dir)
+	if e then
+		return nil
+	end
+
+	-- Anything old here was left behind by a crash.
+	local now = os.time()
+	local names = ReadDir(dir)
+	if names then
+		for _, name in names do
+			local filename = dir.."/"..name
+			local st = Stat(filename)
+			if st and st.mtime and ((now - st.mtime) > 7*24*60*60) then
+				wg.remove(filename)
+			end
+		end
+	end
+
+	local new: Spill = {
+		filename = spillfilename(),
+		size = 0,
+		records = {},
+	}
+	spill = new
+	return new
+end
+
+-- Once the spill file is full, rewrites it with just the paragraphs which a
+-- spilled entry still refers to, provided that's no more than half of it
+-- (so that compacting always frees enough space to be worth it). Returns
+-- true if it was compacted.
+local function compactspill(s: Spill): boolean
+	local live: {[string]: {number}} = {}
+	local livesize = 0
+	for stack in spillstacks do
+		for _, entry in ipairs(stack) do
+			local manifest = entry.manifest
+			if manifest then
+				for _, h in manifest do
+					local r = s.records[h]
+					if r and not live[h] then
+						live[h] = r
+						livesize = livesize + r[2]
+					end
+				end
+			end
+		end
+	end
+	if livesize > (s.size / 2) then
 		return false
 	end
 
-	for i = 1, #t1 do
-		if (t1[i] ~= t2[i]) then
-			return false
+	local data = wg.mapfile(s.filename)
+	if not data then
+		return false
+	end
+
+	-- The new file is written a piece at a time, so that it's never all in
+	-- memory at once.
+	local filename = spillfilename()
+	local records: {[string]: {number}} = {}
+	local size = 0
+	local pending = {}
+	local pendingsize = 0
+	local function flush(): boolean
+		local _, e = AppendFile(filename, table.concat(pending))
+		table.clear(pending)
+		pendingsize = 0
+		return not e
+	end
+	local ok = true
+	for h, r in live do
+		local record = data:sub(r[1], r[1]+r[2]-1)
+		records[h] = {size + 1, r[2]}
+		size = size + r[2]
+		pending[#pending+1] = record
+		pendingsize = pendingsize + r[2]
+		if (pendingsize > 65536) and not flush() then
+			ok = false
+			break
 		end
 	end
+	data:close()
+	if not ok or ((pendingsize > 0) and not flush()) then
+		wg.remove(filename)
+		return false
+	end
 
+	wg.remove(s.filename)
+	s.filename = filename
+	s.records = records
+	s.size = size
 	return true
 end
 
-local function shallowcopy(t1: Document): ShadowDocument
-	local t2  = {}
-	for k, v in ipairs(t1) do
-		t2[k] = v
+-- Pages an entry's paragraphs out to the spill file, returning the number of
+-- bytes this saves, or nil if it can't be done.
+local function spillentry(stack: UndoStack, entry: UndoEntry): number?
+	local paragraphs = assert(entry.paragraphs)
+	local s = openspill()
+	if not s then
+		return nil
+	end
+	spillstacks[stack] = true
+
+	local hashes = table.create(#paragraphs)
+	for i, p in paragraphs do
+		local h = p:hash()
+		hashes[i] = h
+		spilledparagraphs[h] = p
+	end
+
+	-- Works out the records to add for the paragraphs the file doesn't
+	-- already have.
+	local function gather(): ({string}, {[string]: {number}}, number)
+		local added = {}
+		local offsets: {[string]: {number}} = {}
+		local addedsize = 0
+		for i, p in paragraphs do
+			local h = hashes[i]
+			if not s.records[h] and not offsets[h] then
+				local r = h.." "..p.style.." "..p:join().."\n"
+				offsets[h] = {s.size + addedsize + 1, #r}
+				added[#added+1] = r
+				addedsize = addedsize + #r
+			end
+		end
+		return added, offsets, addedsize
+	end
+
+	local added, offsets, addedsize = gather()
+	if (s.size + addedsize) > getspilllimit() then
+		-- Compacting can drop paragraphs this entry shares with discarded
+		-- ones, so what to add is worked out again afterwards.
+		if not compactspill(s) then
+			return nil
+		end
+		added, offsets, addedsize = gather()
+		if (s.size + addedsize) > getspilllimit() then
+			return nil
+		end
 	end
-	t2.cp, t2.cw, t2.co = t1.cp, t1.cw, t1.co
-	return t2
+	if (addedsize > 0) then
+		local _, e = AppendFile(s.filename, table.concat(added))
+		if e then
+			return nil
+		end
+		for h, r in offsets do
+			s.records[h] = r
+		end
+		s.size = s.size + addedsize
+	end
+
+	local size = ENTRYSIZE + HASHSIZE*#hashes
+	local saved = entry.size - size
+	entry.paragraphs = nil
+	entry.manifest = hashes
+	entry.size = size
+	return saved
 end
 
-local function savedocument(): ShadowDocument
-	return shallowcopy(currentDocument)
+-- Reads a spilled entry's paragraphs back in.
+local function unspill(hashes: {string}): {Paragraph}?
+	local s = spill
+	local data = s and wg.mapfile(s.filename)
+	if not s or not data then
+		return nil
+	end
+
+	local paragraphs = table.create(#hashes)
+	for i, h in hashes do
+		local p = spilledparagraphs[h]
+		if p then
+			paragraphs[i] = p
+			continue
+		end
+
+		local r = s.records[h]
+		local style, words
+		if r then
+			style, words = data:sub(r[1], r[1]+r[2]-2)
+				:match("^[^ ]+ ([^ ]+) (.*)$")
+		end
+		if not style or not words then
+			data:close()
+			return nil
+		end
+		p = CreateParagraph(style, SplitString(words, " "))
+		spilledparagraphs[h] = p
+		paragraphs[i] = p
+	end
+	data:close()
+	return paragraphs
 end
 
-local function loaddocument(copy: ShadowDocument)
-	local oldlen = #currentDocument
-	for i = 1, #copy do
-		currentDocument[i] = copy[i]
+-- Throws away the spill file, when exiting.
+function DiscardUndoSpill()
+	if spill then
+		wg.remove(spill.filename)
+		spill = nil
 	end
-	for i = #copy+1, oldlen do
-		currentDocument[i] = nil
+end
+
+-- Replaces count paragraphs of t starting at first with n paragraphs of src
+-- starting at srcfirst.
+local function splice(t: {Paragraph}, first: number, count: number,
+		src: {Paragraph}, srcfirst: number, n: number)
+	local len = #t
+	if n ~= count then
+		-- Growing t with table.move() would reallocate the whole array
+		-- every time, so it's appended to first; the move overwrites this.
+		for i = len+1, len+n-count do
+			t[i] = src[srcfirst]
+		end
+		table.move(t, first+count, len, first+n)
+		for i = len+n-count+1, len do
+			t[i] = nil
+		end
 	end
-	currentDocument.cp, currentDocument.cw, currentDocument.co = copy.cp, copy.cw, copy.co
+	table.move(src, srcfirst, srcfirst+n-1, first, t)
+end
+
+-- Returns the part of the current document which might differ from the
+-- stack's mirror.
+local function changedrange(stack: UndoStack): (number, number)
+	return currentDocument:changedSpan(stack.generation)
+end
+
+local function trim(stack: UndoStack)
+	local limit = getlimit()
+
+	-- Page out the oldest patches first, but never the newest, as that's
+	-- what the next undo will want. A zero limit means no history at all.
+	if (limit > 0) and (getspilllimit() > 0) then
+		while (stack.size > limit) and ((stack.spilled or 0) < (#stack - 1)) do
+			local i = (stack.spilled or 0) + 1
+			local entry = stack[i]
+			if entry.paragraphs then
+				local saved = spillentry(stack, entry)
+				if not saved then
+					break
+				end
+				stack.size = stack.size - saved
+			end
+			stack.spilled = i
+		end
+	end
+
+	while (stack.size > limit) and (#stack > 1) do
+		local oldest = assert(table.remove(stack, 1))
+		stack.size = stack.size - oldest.size
+		stack.spilled = math.max((stack.spilled or 0) - 1, 0)
+
+		-- The new oldest entry has nothing older to patch to.
+		local entry = stack[1]
+		stack.size = stack.size - entry.size + ENTRYSIZE
+		entry.first = nil
+		entry.count = nil
+		entry.paragraphs = nil
+		entry.manifest = nil
+		entry.size = ENTRYSIZE
+	end
+end
+
+-- Pushes the current state of the document (which is generation gen).
+local function push(stack: UndoStack, gen: number)
+	local doc = currentDocument
+	local entry: UndoEntry = {
+		cp = doc.cp,
+		cw = doc.cw,
+		co = doc.co,
+		size = ENTRYSIZE,
+	}
+
+	local mirror = stack.mirror
+	if not mirror then
+		stack.mirror = table.move(doc :: any, 1, #doc, 1, {})
+	else
+		local s, removed, inserted =
+			DiffParagraphs(mirror, doc, changedrange(stack))
+		local paragraphs = table.move(mirror, s, s+removed-1, 1, {})
+		for _, p in paragraphs do
+			entry.size = entry.size + paragraphsize(p)
+		end
+		entry.first = s
+		entry.count = inserted
+		entry.paragraphs = paragraphs
+		splice(mirror, s, removed, doc :: any, s, inserted)
+	end
+
+	stack.generation = gen
+	stack.edits = documentSet._edits
+	stack.group = nil
+	stack[#stack+1] = entry
+	stack.size = stack.size + entry.size
+	trim(stack)
+end
+
+-- Discards the newest entry, turning the mirror into the next older state.
+local function pop(stack: UndoStack)
+	local entry = stack[#stack]
+	stack[#stack] = nil
+	stack.size = stack.size - entry.size
+	stack.spilled = math.min(stack.spilled or 0, #stack)
+	stack.generation = nil
+	stack.edits = nil
+	stack.group = nil
+
+	local paragraphs = entry.paragraphs
+	local manifest = entry.manifest
+	if manifest then
+		paragraphs = unspill(manifest)
+		if not paragraphs then
+			-- The older history is lost, so this is now the oldest state.
+			for i = #stack, 1, -1 do
+				stack[i] = nil
+			end
+			stack.size = 0
+			stack.spilled = 0
+			stack.mirror = nil
+			ModalMessage("Undo failed",
+				"The older undo history could not be read back in.")
+			return
+		end
+	end
+	if paragraphs then
+		splice(assert(stack.mirror), assert(entry.first), assert(entry.count),
+			paragraphs, 1, #paragraphs)
+	else
+		stack.mirror = nil
+	end
+end
+
+local function loaddocument(stack: UndoStack)
+	local mirror = assert(stack.mirror)
+	local entry = stack[#stack]
+	local doc = currentDocument :: any
+	local s, removed, inserted = DiffParagraphs(doc, mirror, 1, #mirror)
+	splice(doc, s, removed, mirror, s, inserted)
+	currentDocument.cp, currentDocument.cw, currentDocument.co =
+		entry.cp, entry.cw, entry.co
 	currentDocument.mp = nil
+	documentSet:touch()
 	QueueRedraw()
 end
 
-local function movechange(srcstack: {ShadowDocument},
-		deststack: {ShadowDocument})
-	local top = srcstack[1]
-	if not top then
+local function movechange(srcstack: UndoStack, deststack: UndoStack)
+	if #srcstack == 0 then
 		return false
 	end
-	table.remove(srcstack, 1)
-
-	table.insert(deststack, 1, savedocument())
 
-	loaddocument(top)
+	push(deststack, currentDocument:sync())
+	loaddocument(srcstack)
+	pop(srcstack)
 	return true
 end
 
+local function describe(stack: UndoStack): string
+	return string.format("%d left, %dkB", #stack, math.ceil(stack.size / 1024))
+end
+
 -----------------------------------------------------------------------------
--- Commit an undo checkpoint
+-- Commit an undo checkpoint. kind, if given, says what the command about to
+-- run is going to do, so that runs of the same thing share one undo step.
 
-function Cmd.Checkpoint()
-	local undostack: {ShadowDocument} = currentDocument._undostack or {}
+function Cmd.Checkpoint(kind: string?)
+	local undostack: UndoStack = currentDocument._undostack or newstack()
 	currentDocument._undostack = undostack
 
-	local top = undostack[1]
-	if not top or not shallowequals(currentDocument, top) then
-		local copy = savedocument()
-		table.insert(undostack, 1, copy)
-		undostack[STACKSIZE] = nil
+	-- Every edit touches the document set, so if it hasn't been touched
+	-- since the last checkpoint there's nothing to do; this is checked on
+	-- every keystroke, so needs to be cheap. (An edit which forgets to touch
+	-- just gets folded into the next one.) A checkpoint of some other kind
+	-- still ends the current group, though.
+	local group = kind and GROUPS[kind]
+	local last = undostack.group
+	local mirror = undostack.mirror
+	if mirror and undostack.generation
+			and (undostack.edits == documentSet._edits) then
+		if last and (last.name ~= group) then
+			undostack.group = nil
+		end
+		return true
+	end
+
+	-- If this continues the current group, the newest entry keeps the state
+	-- from before the group started and there's nothing to save.
+	local now = wg.time()
+	if last and (last.name == group) and (last.words < GROUPWORDS)
+			and ((now - last.time) <= getgrouptime()) then
+		last.time = now
+		if kind == "word" then
+			last.words = last.words + 1
+		end
+		undostack.edits = documentSet._edits
+		return true
+	end
+
+	-- If the document hasn't changed since the checkpoint was taken then
+	-- it's certainly the same; otherwise it might have changed back.
+	local gen = currentDocument:sync()
+	local changed = not mirror
+	if mirror and (undostack.generation ~= gen) then
+		local _, removed, inserted =
+			DiffParagraphs(mirror, currentDocument :: any,
+				changedrange(undostack))
+		changed = (removed ~= 0) or (inserted ~= 0)
+	end
+	undostack.edits = documentSet._edits
+	undostack.group = nil
+
+	if changed then
+		push(undostack, gen)
+		if group then
+			undostack.group = { name = group, time = now, words = 0 }
+		end
 
 		-- Nuke the redo stack.
-		currentDocument._redostack = {}
+		currentDocument._redostack = newstack()
 	end
-	
+
 	return true
 end
 
@@ -83,13 +529,15 @@ end
 -- Undo a change.
 
 function Cmd.Undo()
-	local undostack = currentDocument._undostack or {}
-	local redostack = currentDocument._redostack or {}
+	local undostack = currentDocument._undostack or newstack()
+	local redostack = currentDocument._redostack or newstack()
+	currentDocument._undostack = undostack
+	currentDocument._redostack = redostack
 	if not movechange(undostack, redostack) then
 		NonmodalMessage("Nothing left to undo")
 		return false
 	end
-	NonmodalMessage("Undone ("..#undostack.." left in undo buffer)")
+	NonmodalMessage("Undone ("..describe(undostack).." in undo buffer)")
 	return true
 end
 
@@ -97,13 +545,140 @@ end
 -- Redo an undone change.
 
 function Cmd.Redo()
-	local undostack: {ShadowDocument} = currentDocument._undostack or {}
-	local redostack: {ShadowDocument} = currentDocument._redostack or {}
+	local undostack = currentDocument._undostack or newstack()
+	local redostack = currentDocument._redostack or newstack()
+	currentDocument._undostack = undostack
+	currentDocument._redostack = redostack
 	if not movechange(redostack, undostack) then
 		NonmodalMessage("Nothing left to redo")
 		return false
 	end
-	NonmodalMessage("Redone ("..#redostack.." left in redo buffer)")
+	NonmodalMessage("Redone ("..describe(redostack).." in redo buffer)")
 	return true
 end
 
+-----------------------------------------------------------------------------
+-- Addon registration. Create the default global settings.
+
+do
+	local function cb()
+		GlobalSettings.undo = MergeTables(GlobalSettings.undo,
+			{
+				limit = 16384,
+				spill = 262144,
+				grouptime = 2,
+			}
+		)
+	end
+
+	AddEventListener("RegisterAddons", cb)
+end
+
+-----------------------------------------------------------------------------
+-- Configuration user interface.
+
+function Cmd.ConfigureUndo()
+	local settings = GlobalSettings.undo
+	local undostack = currentDocument._undostack or newstack()
+	local redostack = currentDocument._redostack or newstack()
+
+	local limit_textfield =
+		Form.TextField {
+			x1 = -11, y1 = 1,
+			x2 = -1, y2 = 1,
+			value = tostring(settings.limit)
+		}
+
+	local spill_textfield =
+		Form.TextField {
+			x1 = -11, y1 = 3,
+			x2 = -1, y2 = 3,
+			value = tostring(settings.spill)
+		}
+
+	local grouptime_textfield =
+		Form.TextField {
+			x1 = -11, y1 = 5,
+			x2 = -1, y2 = 5,
+			value = tostring(settings.grouptime)
+		}
+
+	local dialogue: Form =
+	{
+		title = "Configure Undo",
+		width = "large",
+		height = 9,
+		stretchy = false,
+
+		actions = {
+			["KEY_RETURN"] = "confirm",
+			["KEY_ENTER"] = "confirm",
+		},
+
+		widgets = {
+			Form.Label {
+				x1 = 1, y1 = 1,
+				x2 = -12, y2 = 1,
+				align = "left",
+				value = "Maximum undo buffer size (kB):",
+			},
+			limit_textfield,
+
+			Form.Label {
+				x1 = 1, y1 = 3,
+				x2 = -12, y2 = 3,
+				align = "left",
+				value = "Maximum undo history paged out to disk (kB):",
+			},
+			spill_textfield,
+
+			Form.Label {
+				x1 = 1, y1 = 5,
+				x2 = -12, y2 = 5,
+				align = "left",
+				value = "Merge typing with pauses shorter than (seconds):",
+			},
+			grouptime_textfield,
+
+			Form.Label {
+				x1 = 1, y1 = 7,
+				x2 = -1, y2 = 7,
+				align = "left",
+				value = string.format(
+					"This document is using %dkB for undo and %dkB for redo; %dkB is on disk.",
+					math.ceil(undostack.size / 1024),
+					math.ceil(redostack.size / 1024),
+					math.ceil((spill and spill.size or 0) / 1024)),
+			},
+		}
+	}
+
+	while true do
+		local result = Form.Run(dialogue, RedrawScreen,
+			"RETURN to confirm, "..ESCAPE_KEY.." to cancel")
+		if not result then
+			return false
+		end
+
+		local limit = tonumber(limit_textfield.value)
+		local spilllimit = tonumber(spill_textfield.value)
+		local grouptime = tonumber(grouptime_textfield.value)
+		if not limit or (limit < 0) then
+			ModalMessage("Parameter error", "The undo buffer size must be a valid number that's at least 0.")
+		elseif not spilllimit or (spilllimit < 0) then
+			ModalMessage("Parameter error", "The amount of undo history on disk must be a valid number that's at least 0.")
+		elseif not grouptime or (grouptime < 0) then
+			ModalMessage("Parameter error", "The typing pause must be a valid number that's at least 0.")
+		else
+			settings.limit = limit
+			settings.spill = spilllimit
+			settings.grouptime = grouptime
+			SaveGlobalSettings()
+			trim(undostack)
+			trim(redostack)
+			return true
+		end
+	end
+
+	return false
+end
@@ -0,0 +1,448 @@
+--!nonstrict
+-- © 2026 David Given.
+-- WordGrinder is licensed under the MIT open source license. See the COPYING
+-- file in this distribution for the full text.
+
+-- An optional inverted index of the words in each document, for document
+-- sets too big to scan on every search. Words are indexed by their simple
+-- text (see GetWordSimpleText()), and each one maps to the set of
+-- paragraphs it appears in. As paragraphs are immutable, what words a
+-- paragraph contains never changes, so it's only worked out once; keeping
+-- the index up to date after an edit just means adding the paragraphs
+-- which have appeared and removing the ones which have gone, which the
+-- document's change tracking finds.
+--
+-- The index is saved next to the document set (in the same file name,
+-- plus INDEXSUFFIX) so that it doesn't have to be rebuilt after a load.
+
+local INDEXSUFFIX = ".index"
+local INDEXVERSION = 2
+
+type WordIndex = {
+	generation: number,
+	paragraphs: {Paragraph},
+	postings: {[string]: {[Paragraph]: number}},
+	counts: {[string]: number},
+}
+
+-- The saved form of one document's index: paragraph numbers rather than
+-- paragraphs, plus the hash of the document's content (see Document.hash())
+-- to check that the document is still the one which was indexed.
+type SavedWordIndex = {
+	postings: {[string]: {number}},
+	hash: string,
+}
+
+-- The words in each paragraph, and how many times each appears.
+local paragraphwords: {[Paragraph]: {[string]: number}} =
+	setmetatable({}, {__mode = "k"}) :: any
+
+-- Indices loaded from disk which haven't been needed yet, by document name.
+local saved: {[string]: SavedWordIndex} = {}
+
+local function isenabled(): boolean
+	local settings = documentSet.addons.wordindex
+	return settings and settings.enabled or false
+end
+
+-- Returns the words in a paragraph, by simple text, and how many times each
+-- appears. This is remembered for as long as the paragraph lives.
+function GetParagraphWords(p: Paragraph): {[string]: number}
+	local cached = paragraphwords[p]
+	if cached then
+		return cached
+	end
+
+	local words: {[string]: number} = {}
+	for _, w in ipairs(p) do
+		local s = GetWordSimpleText(w)
+		if (s ~= "") then
+			words[s] = (words[s] or 0) + 1
+		end
+	end
+	paragraphwords[p] = words
+	return words
+end
+local getwords = GetParagraphWords
+
+local function addparagraph(index: WordIndex, p: Paragraph)
+	local postings = index.postings
+	local counts = index.counts
+	for w, n in getwords(p) do
+		local set = postings[w]
+		if not set then
+			set = {}
+			postings[w] = set
+		end
+		set[p] = (set[p] or 0) + 1
+		counts[w] = (counts[w] or 0) + n
+	end
+end
+
+local function removeparagraph(index: WordIndex, p: Paragraph)
+	local postings = index.postings
+	local counts = index.counts
+	for w, n in getwords(p) do
+		local set = postings[w]
+		local c = set[p] - 1
+		if (c > 0) then
+			set[p] = c
+		else
+			set[p] = nil
+			if not next(set) then
+				postings[w] = nil
+			end
+		end
+
+		c = counts[w] - n
+		if (c > 0) then
+			counts[w] = c
+		else
+			counts[w] = nil
+		end
+	end
+end
+
+local function buildindex(document: Document): WordIndex
+	local index: WordIndex = {
+		generation = document:sync(),
+		paragraphs = table.move(document :: any, 1, #document, 1, {}),
+		postings = {},
+		counts = {},
+	}
+	for _, p in ipairs(document) do
+		addparagraph(index, p)
+	end
+	return index
+end
+
+-- Turns a saved index back into a live one, if it still matches the
+-- document. Anything could have happened to the file since the index was
+-- saved (or to the document since it was loaded), so only the document's
+-- content hash is trusted; if that differs, the index is rebuilt.
+local function restoreindex(document: Document, s: SavedWordIndex): WordIndex?
+	if (type(s) ~= "table") or (s.hash ~= document:hash()) then
+		return nil
+	end
+
+	local postings = {}
+	local counts = {}
+	for w, pns in s.postings do
+		local set = {}
+		local count = 0
+		for i = 1, #pns, 2 do
+			local p = document[pns[i]]
+			local n = pns[i+1]
+			if not p or (type(n) ~= "number") then
+				return nil
+			end
+			set[p] = (set[p] or 0) + 1
+			count = count + n
+		end
+		postings[w] = set
+		counts[w] = count
+	end
+
+	return {
+		generation = document:sync(),
+		paragraphs = table.move(document :: any, 1, #document, 1, {}),
+		postings = postings,
+		counts = counts,
+	}
+end
+
+local function saveindex(document: Document, index: WordIndex): SavedWordIndex
+	local postings = {}
+	for pn, p in ipairs(document) do
+		for w, n in getwords(p) do
+			local pns = postings[w]
+			if not pns then
+				pns = {}
+				postings[w] = pns
+			end
+			pns[#pns+1] = pn
+			pns[#pns+1] = n
+		end
+	end
+	return { postings = postings, hash = document:hash() }
+end
+
+-- Returns the index of a document, brought up to date, or nil if the word
+-- index isn't turned on.
+function GetWordIndex(document: Document): WordIndex?
+	if not isenabled() then
+		return nil
+	end
+
+	local index: WordIndex? = document._wordindex
+	if not index then
+		local s = saved[document.name]
+		saved[document.name] = nil
+		index = s and restoreindex(document, s) or buildindex(document)
+		document._wordindex = index
+		return index
+	end
+	assert(index)
+
+	local gen = document:sync()
+	if (gen ~= index.generation) then
+		local s, removed, inserted = DiffParagraphs(index.paragraphs,
+			document :: any, document:changedSpan(index.generation))
+		local old = index.paragraphs
+		for i = s, s+removed-1 do
+			removeparagraph(index, old[i])
+		end
+		for i = s, s+inserted-1 do
+			addparagraph(index, document[i])
+		end
+		index.paragraphs = table.move(document :: any, 1, #document, 1, {})
+		index.generation = gen
+	end
+	return index
+end
+
+-- Returns the numbers of the paragraphs in the document which contain a
+-- word for which match() returns true, in order, or nil if the word index
+-- isn't turned on. match() is called once for each different word in the
+-- document, not for every word.
+function GetIndexedParagraphs(document: Document, match: (string) -> boolean)
+		: {number}?
+	local index = GetWordIndex(document)
+	if not index then
+		return nil
+	end
+
+	local wanted = {}
+	for w, set in index.postings do
+		if match(w) then
+			for p in set do
+				wanted[p] = true
+			end
+		end
+	end
+
+	local pns = {}
+	if next(wanted) then
+		for pn, p in ipairs(document) do
+			if wanted[p] then
+				pns[#pns+1] = pn
+			end
+		end
+	end
+	return pns
+end
+
+-----------------------------------------------------------------------------
+-- Addon registration. Create the default settings in the documentSet, and
+-- load and save the index along with it.
+
+do
+	local function cb()
+		documentSet.addons.wordindex = documentSet.addons.wordindex or {
+			enabled = false,
+		}
+	end
+
+	AddEventListener("RegisterAddons", cb)
+end
+
+do
+	local function cb()
+		saved = {}
+		local filename = documentSet.name
+		if not isenabled() or not filename then
+			return
+		end
+
+		-- The index is only a cache, so a damaged one is just ignored.
+		local s: any
+		pcall(function()
+			s = LoadFromFile(filename..INDEXSUFFIX)
+		end)
+		local st = wg.stat(filename)
+		if (type(s) == "table") and st
+				and (s.version == INDEXVERSION) and (s.size == st.size)
+				and (type(s.indices) == "table") then
+			saved = s.indices
+
+			-- The current document has been loaded anyway, so it might as
+			-- well have its index now.
+			GetWordIndex(currentDocument)
+		end
+	end
+
+	AddEventListener("DocumentLoaded", cb)
+end
+
+do
+	local function cb(event, token, filename)
+		-- If anything was edited while the save was going on, the index
+		-- wouldn't match what was saved; the old one (if any) won't match the
+		-- new file's size, so it gets ignored on the next load.
+		if not isenabled() or documentSet._changed then
+			return
+		end
+
+		local indices = {}
+		for _, document in documentSet:getDocumentList() do
+			local s = saved[document.name]
+			if s and IsLazyDocument(document) then
+				indices[document.name] = s
+			else
+				local index = assert(GetWordIndex(document))
+				indices[document.name] = saveindex(document, index)
+			end
+		end
+
+		local st = wg.stat(filename)
+		SaveToFile(filename..INDEXSUFFIX, {
+			version = INDEXVERSION,
+			size = st and st.size or 0,
+			indices = indices,
+		})
+	end
+
+	AddEventListener("DocumentSaved", cb)
+end
+
+-----------------------------------------------------------------------------
+-- Word frequency report.
+
+function Cmd.ShowWordFrequencies()
+	ImmediateMessage("Counting words...")
+
+	-- Without the index turned on, build a throwaway one.
+	local index = GetWordIndex(currentDocument) or buildindex(currentDocument)
+
+	local counts = {}
+	for w, n in index.counts do
+		local l = w:lower()
+		counts[l] = (counts[l] or 0) + n
+	end
+
+	local words = {}
+	for w in counts do
+		words[#words+1] = w
+	end
+	table.sort(words,
+		function(a, b)
+			if (counts[a] ~= counts[b]) then
+				return counts[a] > counts[b]
+			end
+			return a < b
+		end)
+
+	local data = {}
+	for _, w in words do
+		data[#data+1] = {
+			label = string.format("%8d  %s", counts[w], w),
+			data = w,
+		}
+	end
+	QueueRedraw()
+
+	if (#data == 0) then
+		NonmodalMessage("There are no words to count.")
+		return false
+	end
+
+	local browser = Form.Browser {
+		focusable = true,
+		type = Form.Browser,
+		x1 = 1, y1 = 2,
+		x2 = -1, y2 = -1,
+		data = data,
+		cursor = 1
+	}
+
+	local dialogue: Form =
+	{
+		title = "Word Frequencies",
+		width = "large",
+		height = "large",
+		stretchy = false,
+
+		actions = {
+			["KEY_RETURN"] = "confirm",
+			["KEY_ENTER"] = "confirm",
+		},
+
+		widgets = {
+			Form.Label {
+				x1 = 1, y1 = 1,
+				x2 = -1, y2 = 1,
+				value = string.format("%d different words:", #data)
+			},
+
+			browser,
+		}
+	}
+
+	Form.Run(dialogue, RedrawScreen,
+		"RETURN or "..ESCAPE_KEY.." to close")
+	QueueRedraw()
+	return true
+end
+
+-----------------------------------------------------------------------------
+-- Configuration user interface.
+
+function Cmd.ConfigureWordIndex()
+	local settings = documentSet.addons.wordindex
+
+	local enabled_checkbox =
+		Form.Checkbox {
+			x1 = 1, y1 = 1,
+			x2 = -1, y2 = 1,
+			label = "",
+			value = settings.enabled
+		}
+
+	local dialogue: Form =
+	{
+		title = "Configure Word Index",
+		width = "large",
+		height = 5,
+		stretchy = false,
+
+		actions = {
+			["KEY_RETURN"] = "confirm",
+			["KEY_ENTER"] = "confirm",
+		},
+
+		widgets = {
+			enabled_checkbox,
+
+			Form.Label {
+				x1 = 1, y1 = 1,
+				x2 = 32, y2 = 1,
+				align = "left",
+				value = "Keep a word index:"
+			},
+
+			Form.WrappedLabel {
+				x1 = 1, y1 = 3,
+				x2 = -1, y2 = 4,
+				value = "This speeds up searches in very large documents, "
+					.. "and is saved alongside the document set."
+			},
+		}
+	}
+
+	local result = Form.Run(dialogue, RedrawScreen,
+		"SPACE to toggle, RETURN to confirm, "..ESCAPE_KEY.." to cancel")
+	if not result then
+		return false
+	end
+
+	settings.enabled = enabled_checkbox.value
+	if not settings.enabled then
+		for _, document in documentSet:getDocumentList() do
+			if not IsLazyDocument(document) then
+				document._wordindex = nil
+			end
+		end
+	end
+	documentSet:touch()
+	return true
+end
@@ -17,16 +17,10 @@ local GetStringWidth = wg.getstringwidth
 local GetBytesOfCharacter = wg.getbytesofcharacter
 local GetCwd = wg.getcwd
 local ChDir = wg.chdir
-local ReadDir = wg.readdir
+local StartScanDir = wg.startscandir
 local Stat = wg.stat
 local UseUnicode = wg.useunicode
 
-type BrowserFileData = {
-	size: number,
-	mode: string,
-	name: string
-}
-	
 local function compare_filenames(f1: string, f2: string)
 	if (ARCH == "windows") then
 		return f1:lower() == f2:lower()
@@ -35,60 +29,81 @@ local function compare_filenames(f1: string, f2: string)
 	end
 end
 
+-- How long to wait for a directory listing before showing the browser with
+-- what's arrived so far; and, while waiting for one which has to be complete,
+-- how often to look at the keyboard.
+local SCAN_WAIT = 0.2
+
+-- Waits for a scan to finish. ESCAPE gives up, returning nil; so does the
+-- directory not being readable.
+local function waitforscan(scan: Scan): Scan?
+	local ok, finished = RunTask("Reading directory...",
+		function()
+			while true do
+				local finished = scan:poll(SCAN_WAIT)
+				if finished ~= false then
+					return finished
+				end
+				TaskCheckpoint()
+			end
+		end)
+	return if ok and finished then scan else nil
+end
+
 function FileBrowser(title: string, message: string, saving: boolean,
 		default: string?): string?
-	local files = {}
-	local f, e, errno = ReadDir(".")
-	if e then
+	local scan = StartScanDir(".")
+	local finished, e = scan:poll(SCAN_WAIT)
+	if finished == nil then
 		ModalMessage("Directory inaccessible",
 			"The current directory could not be accessed: "..e)
 		return nil
 	end
 
-	for _, filename in assert(f) do
-		if (filename ~= ".") and ((filename == "..") or not filename:match("^%.")) then
-			local attr = Stat(filename) :: BrowserFileData?
-			if attr then
-				attr.name = filename
-				files[#files+1] = attr
-			end
-		end
-	end
-	table.sort(files, function(a, b)
-		if (a.mode == b.mode) then
-			return a.name < b.name
+	-- Fills in the labels with whatever the scan has found so far, which
+	-- come sorted, directories first. Returns whether there's more to come,
+	-- and whether the labels changed.
+	local labels: {BrowserItem} = {}
+	local count = -1
+	local function update(): (boolean, boolean)
+		local finished, n = scan:poll()
+		if (finished == nil) or (n == count) then
+			return finished == false, false
 		end
-		if (a.mode == "directory") then
-			return true
+		count = n :: number
+
+		table.clear(labels)
+		for _, attr in scan:entries() do
+			if (attr.name ~= "..") and attr.name:match("^%.") then
+				continue
+			end
+
+			local dmarker = "  "
+			if (attr.mode == "directory") then
+				dmarker = UseUnicode() and "◇ " or "* "
+			end
+			labels[#labels+1] = {
+				data = attr.name,
+				key = attr.name,
+				label = dmarker..attr.name
+			}
 		end
-		return false
-	end)
-	
-	local labels: {BrowserItem} = {}
-	for _, attr in ipairs(files) do
-		local dmarker = "  "
-		if (attr.mode == "directory") then
-			dmarker = UseUnicode() and "◇ " or "* "
+
+		-- Windows will sometimes give you a directory with no entries
+		-- in it at all (e.g. Documents and Settings on Win7). This is
+		-- annoying.
+
+		if (#labels == 0) then
+			labels[#labels+1] = {
+				data = "..",
+				label = UseUnicode() and "◇ .." or "* .."
+			}
 		end
-		labels[#labels+1] = {
-			data = attr.name,
-			key = attr.name,
-			label = dmarker..attr.name
-		}
-	end
-	
-	-- Windows will sometimes give you a directory with no entries
-	-- in it at all (e.g. Documents and Settings on Win7). This is
-	-- annoying.
-
-	if (#labels == 0) then
-		labels[#labels+1] = {
-			data = "..",
-			label = UseUnicode() and "◇ .." or "* .."
-		}
+		return finished == false, true
 	end
+	update()
 
-	local f = BrowserForm(title, GetCwd(), message, labels)
+	local f = BrowserForm(title, GetCwd(), message, labels, update)
 	if not f then
 		return nil
 	end
@@ -140,11 +155,11 @@ function Autocomplete(filename: string, x1: number, x2: number, y: number)
 		dirname = dirname.."/"
 	end
 
-	local files = ReadDir(dirname)
-	if not files then
+	local scan = waitforscan(StartScanDir(dirname))
+	if not scan then
 		return filename
 	end
-	assert(files)
+	local files = scan:entries(leafname)
 
 	if (dirname == "./") then
 		dirname = ""
@@ -152,13 +167,8 @@ function Autocomplete(filename: string, x1: number, x2: number, y: number)
 
 	local candidates = {}
 	for _, f in files do
-		if (compare_filenames(f:sub(1, #leafname), leafname)) then
-			local st = Stat(dirname.."/"..f)
-			if st and (st.mode == "directory") then
-				f = f.."/"
-			end
-			candidates[#candidates+1] = f
-		end
+		candidates[#candidates+1] =
+			(f.mode == "directory") and (f.name.."/") or f.name
 	end
 
 	-- Only one candidate --- match it.
@@ -188,7 +198,10 @@ function Autocomplete(filename: string, x1: number, x2: number, y: number)
 	return filename
 end
 
-function BrowserForm(title, topmessage, bottommessage, data: {BrowserItem})
+-- If given, update is polled while the browser's open; it may change data,
+-- returning whether there's more to come and whether it's changed anything.
+function BrowserForm(title, topmessage, bottommessage, data: {BrowserItem},
+		update: (() -> (boolean, boolean))?)
 	local dialogue: Form
 
 	local browser = Form.Browser {
@@ -200,6 +213,54 @@ function BrowserForm(title, topmessage, bottommessage, data: {BrowserItem})
 		cursor = 1
 	}
 	
+	-- The items with keys, in key order, for finding the one the user's
+	-- typing the name of; made when first needed.
+	local keyorder: {number}? = nil
+	local function filenamekey(s: string): string
+		return if (ARCH == "windows") then s:lower() else s
+	end
+
+	local function findkey(value: string): number?
+		if not keyorder then
+			local order = {}
+			for index, item in data do
+				if item.key then
+					order[#order+1] = index
+				end
+			end
+			table.sort(order,
+				function(a, b)
+					local ka = filenamekey(data[a].key :: string)
+					local kb = filenamekey(data[b].key :: string)
+					if ka ~= kb then
+						return ka < kb
+					end
+					return a < b
+				end)
+			keyorder = order
+		end
+		local order = keyorder :: {number}
+
+		-- The first key which isn't less than the value is the first one it
+		-- could be a prefix of.
+		value = filenamekey(value)
+		local lo, hi = 1, #order + 1
+		while lo < hi do
+			local mid = (lo + hi) // 2
+			if filenamekey(data[order[mid]].key :: string) < value then
+				lo = mid + 1
+			else
+				hi = mid
+			end
+		end
+		local index = order[lo]
+		if index and compare_filenames(
+				(data[index].key :: string):sub(1, #value), value) then
+			return index
+		end
+		return nil
+	end
+
 	local textfield = Form.TextField {
 		x1 = GetStringWidth(bottommessage) + 3, y1 = -3,
 		x2 = -1, y2 = -2,
@@ -212,12 +273,9 @@ function BrowserForm(title, topmessage, bottommessage, data: {BrowserItem})
 			if (#value == 0) then
 				return
 			end
-			for index, item in ipairs(data) do
-				if item.key and compare_filenames(item.key:sub(1, #value), value) then
-					browser.cursor = index
-					browser:draw()
-					return
-				end
+			local index = findkey(value)
+			if index then
+				browser:_moveCursor(index)
 			end
 		end,
 	}
@@ -299,7 +357,29 @@ function BrowserForm(title, topmessage, bottommessage, data: {BrowserItem})
 			}
 		}
 	}
-	
+
+	if update then
+		-- New entries can turn up anywhere, so keep the cursor on the same
+		-- one.
+		dialogue.poll = function(self: Form): boolean
+			local current = data[browser.cursor]
+			local selected = current and current.data
+			local more, changed = update()
+			if changed then
+				keyorder = nil
+				browser.cursor = 1
+				for i, item in data do
+					if item.data == selected then
+						browser.cursor = i
+						break
+					end
+				end
+				browser:draw()
+			end
+			return more
+		end
+	end
+
 	local result = Form.Run(dialogue, RedrawScreen,
 		"RETURN to confirm, "..ESCAPE_KEY.." to cancel, CTRL+P to go to parent dir")
 	QueueRedraw()
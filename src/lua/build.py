@@ -1,13 +1,13 @@
 from build.ab import normalrule
-from tools.build import multibin
+from tools.build import luabytecode
 
 SRCS = [
     "src/lua/_prologue.lua",
     "src/lua/objects.lua",
     "src/lua/events.lua",
+    "src/lua/tasks.lua",
     "src/lua/margin.lua",
     "src/lua/main.lua",
-    "src/lua/xml.lua",
     "src/lua/utils.lua",
     "src/lua/redraw.lua",
     "src/lua/settings.lua",
@@ -17,25 +17,18 @@ SRCS = [
     "src/lua/forms.lua",
     "src/lua/ui.lua",
     "src/lua/browser.lua",
-    "src/lua/html.lua",
     "src/lua/xpattern.lua",
     "src/lua/fileio.lua",
     "src/lua/export.lua",
-    "src/lua/export/text.lua",
     "src/lua/export/html.lua",
-    "src/lua/export/latex.lua",
-    "src/lua/export/troff.lua",
-    "src/lua/export/opendocument.lua",
-    "src/lua/export/org.lua",
-    "src/lua/export/markdown.lua",
     "src/lua/import.lua",
-    "src/lua/import/html.lua",
-    "src/lua/import/text.lua",
-    "src/lua/import/opendocument.lua",
-    "src/lua/import/markdown.lua",
+    "src/lua/modules.lua",
     "src/lua/navigate.lua",
     "src/lua/addons/goto.lua",
+    "src/lua/addons/findall.lua",
+    "src/lua/addons/compare.lua",
     "src/lua/addons/autosave.lua",
+    "src/lua/addons/fileformat.lua",
     "src/lua/addons/docsetman.lua",
     "src/lua/addons/gui.lua",
     "src/lua/addons/scrapbook.lua",
@@ -48,6 +41,9 @@ SRCS = [
     "src/lua/addons/keymapoverride.lua",
     "src/lua/addons/smartquotes.lua",
     "src/lua/addons/undo.lua",
+    "src/lua/addons/wordindex.lua",
+    "src/lua/addons/derivedcache.lua",
+    "src/lua/addons/statistics.lua",
     "src/lua/addons/spillchocker.lua",
     "src/lua/addons/templates.lua",
     "src/lua/addons/directories.lua",
@@ -57,16 +53,38 @@ SRCS = [
     "src/lua/cli.lua",
 ]
 
-multibin(
+# These are only loaded when something first needs them; see modules.lua.
+LAZY_SRCS = [
+    "src/lua/xml.lua",
+    "src/lua/export/text.lua",
+    "src/lua/export/latex.lua",
+    "src/lua/export/troff.lua",
+    "src/lua/export/opendocument.lua",
+    "src/lua/export/org.lua",
+    "src/lua/export/markdown.lua",
+    "src/lua/import/html.lua",
+    "src/lua/import/text.lua",
+    "src/lua/import/opendocument.lua",
+    "src/lua/import/markdown.lua",
+    "src/lua/viewer.lua",
+]
+
+luabytecode(
     name="luacode",
     symbol="script_table",
     srcs=SRCS,
 )
 
+luabytecode(
+    name="lazycode",
+    symbol="lazy_script_table",
+    srcs=LAZY_SRCS,
+)
+
 normalrule(
     name="typecheck",
-    ins=["tools+typechecker", "./_types.d.lua"] + SRCS,
+    ins=["tools+typechecker", "./_types.d.lua"] + SRCS + LAZY_SRCS,
     outs=["stamp"],
     label="TYPECHECK",
-    commands=["{ins[0]} -t {ins[1]} " + " ".join(SRCS)],
+    commands=["{ins[0]} -t {ins[1]} " + " ".join(SRCS + LAZY_SRCS)],
 )
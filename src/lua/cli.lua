@@ -17,7 +17,9 @@ local import_table =
 
 local export_table =
 {
-	["wg"] = Cmd.SaveCurrentDocumentAs,
+	["wg"] = function(filename)
+		return Cmd.SaveCurrentDocumentAs(filename) and FinishBackgroundSave()
+	end,
 	["odt"] = Cmd.ExportODTFile,
 	["html"] = Cmd.ExportHTMLFile,
 	["tr"] = Cmd.ExportTroffFile,
@@ -28,6 +30,15 @@ local export_table =
 --	["rtf"] = Cmd.ExportRTFFile,
 }
 
+-- These exporters are native (see export.cc), so can export several
+-- documents at once on other threads.
+local native_export_table =
+{
+	["html"] = "html",
+	["md"] = "markdown",
+	["txt"] = "text",
+}
+
 function CLIMessage(...: string)
 	PrintErr("wordgrinder: ", ...)
 	PrintErr("\n")
@@ -39,77 +50,117 @@ function CLIError(...: string)
 end
 		
 --- Engages CLI mode.
+--
+-- @param quiet                 If set, messages aren't printed (but the last
+--                              one is still remembered; see LastCLIMessage)
+
+local lastmessage: string? = nil
+
+function EngageCLI(quiet: boolean?)
+	-- Conversions never last long enough for garbage to matter.
+	wg.setgcmode("batch")
 
-function EngageCLI()
 	function ImmediateMessage(s: string)
-		if s then
+		if s and not quiet then
 			CLIMessage(s)
 		end
 	end
 	
-	function ModalMessage(s1: string, s2: string)
+	function ModalMessage(s1: string?, s2: string)
 		if s2 then
-			CLIMessage(s2)
+			lastmessage = s2
+			if not quiet then
+				CLIMessage(s2)
+			end
 		end
 	end
 end
 
---- Converts between two files.
---
--- @param file1                 Source filename
--- @param file2                 Destination filename
+local function supported_extensions(t)
+	local s = {}
+	for k, v in pairs(t) do
+		s[#s+1] = k
+	end
+	return table_concat(s, " ")
+end
 
-function CliConvert(file1: string, file2: string)
-	EngageCLI()
-	
-	local function decode_filename(f: string): (string, string, string, string)
-		local _, _, root, extension, hassubdoc, subdoc = string_find(f,
+-- A filename of -:ext means stdin or stdout, in the format given by ext.
+-- These formats are read and written in one go, or need to seek, so they
+-- can't be used that way.
+
+local unstreamable_formats =
+{
+	["wg"] = true,
+	["odt"] = true,
+}
+
+local function decode_filename(f: string): (string?, string, string, string)
+	local _, _, root, extension, hassubdoc, subdoc = string_find(f,
+		"^(%-):(%w*)(:?)(.*)$")
+	if not root then
+		_, _, root, extension, hassubdoc, subdoc = string_find(f,
 			"^(.*)%.(%w*)(:?)(.*)$")
-		
-		if not root or not extension then
-			CLIError("unable to parse filename '", f, "'")
-		end
+	end
+	return root, extension or "", hassubdoc or "", subdoc or ""
+end
 
-		assert(root)
-		assert(extension)
-		assert(hassubdoc)
-		assert(subdoc)
-		return root, extension, hassubdoc, subdoc
+local function check_filename(f: string, root: string?,
+		extension: string): string?
+	if not root then
+		if f == "-" then
+			return "'-' needs a format, like -:html"
+		end
+		return "unable to parse filename '"..f.."'"
 	end
-	
+	if (root == "-") and unstreamable_formats[extension] then
+		return "'-' can't be used with the '"..extension.."' format"
+	end
+	return nil
+end
+
+--- Converts between two files, in the current document set.
+--
+-- @param file1                 Source filename
+-- @param file2                 Destination filename
+-- @return                      true, or false and an error message
+
+function ConvertFile(file1: string, file2: string): (boolean, string?)
 	local f1r, f1e, f1hs, f1s = decode_filename(file1)
-	local f1 = f1r.."."..f1e
+	local e = check_filename(file1, f1r, f1e)
+	if e then
+		return false, e
+	end
+	assert(f1r)
+	local f1 = (f1r == "-") and "-" or (f1r.."."..f1e)
 	local f2r, f2e, f2hs, _f2s = decode_filename(file2)
-	local f2 = f2r.."."..f2e
-	
-	if (f2hs ~= "") then
-		CLIError("you cannot specify a document name for the output file")
+	e = check_filename(file2, f2r, f2e)
+	if e then
+		return false, e
 	end
+	assert(f2r)
+	local f2 = (f2r == "-") and "-" or (f2r.."."..f2e)
 	
-	local function supported_extensions(t)
-		local s = {}
-		for k, v in pairs(t) do
-			s[#s+1] = k
-		end
-		return table_concat(s, " ")
+	if (f2hs ~= "") then
+		return false, "you cannot specify a document name for the output file"
 	end
 	
 	local importer = import_table[f1e]
 	if not importer then
-		CLIError("don't know how to import extension '", f1e, "' ",
-			"(supported extensions are: ",
-			supported_extensions(import_table), ")")
+		return false, "don't know how to import extension '"..f1e.."' "..
+			"(supported extensions are: "..
+			supported_extensions(import_table)..")"
 	end
 	
 	local exporter = export_table[f2e]
 	if not exporter then
-		CLIError("don't know how to export extension '", f2e, "' ",
-			"(supported extensions are: ",
-			supported_extensions(export_table), ")")
+		return false, "don't know how to export extension '"..f2e.."' "..
+			"(supported extensions are: "..
+			supported_extensions(export_table)..")"
 	end
 	
+	lastmessage = nil
 	if not importer(f1) then
-		CLIError("failed")
+		return false, lastmessage or "failed"
 	end
 	
 	if (f1hs ~= "") then
@@ -117,9 +168,8 @@ function CliConvert(file1: string, file2: string)
 			-- If the user specified a document name, and we loaded a wg file,
 			-- then select the specified document.
 			
-			local dl = documentSet:getDocumentList()
 			if not documentSet:_findDocument(f1s) then
-				CLIError("no such document '", f1s, "'")
+				return false, "no such document '"..f1s.."'"
 			end
 			documentSet:setCurrent(f1s)
 		else
@@ -131,10 +181,312 @@ function CliConvert(file1: string, file2: string)
 		end
 	end
 	
+	lastmessage = nil
 	if not exporter(f2) then
-		CLIError("failed")
+		return false, lastmessage or "failed"
+	end
+	return true
+end
+
+--- Converts between two files and exits.
+--
+-- @param file1                 Source filename
+-- @param file2                 Destination filename
+
+function CliConvert(file1: string, file2: string)
+	EngageCLI()
+	
+	local ok, e = ConvertFile(file1, file2)
+	if not ok then
+		-- Messages from the importers and exporters have already been shown.
+		if e and (e == lastmessage) then
+			wg.exit(1)
+		end
+		CLIError(e or "failed")
 	end
 	
 	wg.exit(0)
 end
 
+export type ConversionResult = {
+	src: string,
+	dest: string,
+	ok: boolean,
+	message: string?,
+	time: number, -- in seconds
+}
+
+--- Converts every pair of files listed in a manifest, reusing this process
+-- for all of them. Each line of the manifest is a source and a destination
+-- filename separated by a tab; blank lines and lines starting with # are
+-- ignored. Every conversion starts with a fresh document set, and a failure
+-- doesn't stop the rest.
+--
+-- @param manifest              Manifest filename
+-- @return                      An array of ConversionResults, or nil and an
+--                              error message
+
+function ConvertBatch(manifest: string): ({ConversionResult}?, string?)
+	local data, e = wg.readfile(manifest)
+	if not data then
+		return nil, e
+	end
+	
+	local results: {ConversionResult} = {}
+	local lineno = 0
+	for line in (data.."\n"):gmatch("([^\n]*)\n") do
+		lineno = lineno + 1
+		line = line:gsub("\r$", "")
+		if not line:find("^%s*$") and not line:find("^#") then
+			local msrc, mdest = line:match("^([^\t]+)\t+([^\t]+)$")
+			local src: string = msrc or line
+			local dest: string = mdest or ""
+			local before = wg.time()
+			local ok: boolean, message: string?
+			if not msrc then
+				ok, message = false,
+					"manifest line "..lineno.." is not 'source<TAB>destination'"
+			else
+				if (#results > 0) then
+					ResetDocumentSet()
+				end
+				local pok, cok, cmessage = pcall(ConvertFile, src, dest)
+				if pok then
+					ok, message = cok, cmessage
+				else
+					ok, message = false, tostring(cok)
+				end
+			end
+			
+			results[#results+1] = {
+				src = src,
+				dest = dest,
+				ok = ok,
+				message = message,
+				time = wg.time() - before,
+			}
+		end
+	end
+	return results
+end
+
+--- Runs a batch conversion and exits. A line per conversion is written to
+-- stdout, as tab-separated fields: ok or failed, the time taken in
+-- milliseconds, the source and destination filenames and (on failure) an
+-- error message. The exit status is 1 if anything failed.
+--
+-- @param manifest              Manifest filename
+
+function CliConvertBatch(manifest: string)
+	EngageCLI(true)
+	
+	local results, e = ConvertBatch(manifest)
+	if not results then
+		CLIError("unable to read manifest: ", e or "unknown error")
+	end
+	assert(results)
+	
+	local failures = 0
+	for _, r in results do
+		local fields = {
+			r.ok and "ok" or "failed",
+			string.format("%.1f", r.time * 1000),
+			r.src,
+			r.dest,
+		}
+		if not r.ok then
+			failures = failures + 1
+			fields[#fields+1] = (r.message or "failed"):gsub("%s", " ")
+		end
+		print(table_concat(fields, "\t"))
+	end
+	
+	CLIMessage(tostring(#results - failures), " converted, ",
+		tostring(failures), " failed")
+	wg.exit((failures > 0) and 1 or 0)
+end
+
+export type ExportResult = {
+	name: string, -- of the document
+	filename: string,
+	ok: boolean,
+	message: string?,
+}
+
+--- Exports every document in a document set to a file of its own. The
+-- filenames come from the template: output.html becomes output.1.Foo.html,
+-- output.2.Bar.html, and so on, numbered in document order. Formats with a
+-- native exporter are done concurrently; the others one at a time.
+--
+-- @param inputfile             Document set filename
+-- @param template              Output filename template
+-- @return                      An array of ExportResults, in document order,
+--                              or nil and an error message
+
+function ExportAll(inputfile: string, template: string): ({ExportResult}?, string?)
+	local _, _, extension = template:find("%.(%w+)$")
+	extension = extension or ""
+	local native = native_export_table[extension]
+	local exporter = export_table[extension]
+	if not exporter or (extension == "wg") then
+		local supported = table.clone(export_table)
+		supported["wg"] = nil
+		return nil, "don't know how to export extension '"..extension.."' "..
+			"(supported extensions are: "..
+			supported_extensions(supported)..")"
+	end
+
+	lastmessage = nil
+	if not Cmd.LoadDocumentSet(inputfile) then
+		return nil, lastmessage or "failed to load document set"
+	end
+
+	local documents = documentSet:getDocumentList()
+	local results: {ExportResult} = table.create(#documents)
+	local filenames = table.create(#documents)
+	for i, document in documents do
+		local name = document.name
+		local safename = name:gsub("[/\\]", "_")
+		local filename = template:gsub("%.(%w+)$",
+			function(ext)
+				return "."..i.."."..safename.."."..ext
+			end)
+		filenames[i] = filename
+		results[i] = {name = name, filename = filename, ok = false}
+	end
+
+	if native then
+		FlushDeferredEvents()
+		MaterialiseDocuments(documents)
+		for _, document in documents do
+			document:renumber()
+			MaterialiseDocument(document)
+		end
+		local status = wg.exportdocuments(documents, filenames, native,
+			documentSet.addons.htmlexport)
+		for i, r in results do
+			local s = status[i]
+			r.ok = (s == true)
+			if s ~= true then
+				r.message = tostring(s)
+			end
+		end
+	else
+		-- The exporters work on the current document, but there's no need
+		-- to go through setCurrent() for that.
+		local oldcurrent = currentDocument
+		for i, r in results do
+			currentDocument = documents[i]
+			lastmessage = nil
+			local ok, e = pcall(exporter, r.filename)
+			r.ok = ok and (e ~= false)
+			if not r.ok then
+				r.message = ok and (lastmessage or "failed") or tostring(e)
+			end
+		end
+		currentDocument = oldcurrent
+	end
+	return results
+end
+
+--- Runs ExportAll() and exits. A line per document is written to stdout, in
+-- document order, as tab-separated fields: ok or failed, the document's
+-- number and name, the output filename and (on failure) an error message.
+-- The exit status is 1 if anything failed.
+--
+-- @param inputfile             Document set filename
+-- @param template              Output filename template
+
+function CliExportAll(inputfile: string, template: string)
+	EngageCLI(true)
+
+	local results, e = ExportAll(inputfile, template)
+	if not results then
+		CLIError(e or "failed")
+	end
+	assert(results)
+
+	local failures = 0
+	for i, r in results do
+		local fields = {
+			r.ok and "ok" or "failed",
+			tostring(i),
+			r.name,
+			r.filename,
+		}
+		if not r.ok then
+			failures = failures + 1
+			fields[#fields+1] = (r.message or "failed"):gsub("%s", " ")
+		end
+		print(table_concat(fields, "\t"))
+	end
+
+	CLIMessage(tostring(#results - failures), " exported, ",
+		tostring(failures), " failed")
+	wg.exit((failures > 0) and 1 or 0)
+end
+
+--- Joins several document sets into one, one after the other, without
+-- loading them (see concatdocumentsets() in dumpfile.cc). The settings and
+-- the current document come from the first file, and so does the format
+-- of the output. Documents whose names have already been used get a number
+-- added to them.
+--
+-- @param outputfile            Output filename
+-- @param inputfiles            Document set filenames
+-- @return                      true, or false and an error message
+
+function ConcatDocumentSets(outputfile: string,
+		inputfiles: {string}): (boolean, string?)
+	local written, e, errno
+	local ok, pe = pcall(function()
+		written, e, errno = wg.concatdocumentsets(outputfile, inputfiles)
+	end)
+	if not ok then
+		return false, tostring(pe)
+	end
+	if not written then
+		-- Only failing to write the output comes with an errno.
+		if errno then
+			return false, "'"..outputfile.."' could not be written: "..
+				(e or "failed")
+		end
+		return false, e or "failed"
+	end
+	return true
+end
+
+--- Runs ConcatDocumentSets() and exits.
+--
+-- @param outputfile            Output filename
+-- @param ...                   Document set filenames
+
+function CliConcat(outputfile: string, ...: string)
+	EngageCLI(true)
+
+	local ok, e = ConcatDocumentSets(outputfile, {...})
+	if not ok then
+		CLIError(e or "failed")
+	end
+	wg.exit(0)
+end
+
+--- Starts a conversion server (see server.cc) listening on socket. This
+-- process is already fully started up, so it loads everything else it might
+-- need and then forks a child for each job, which starts with it all
+-- already done. Only returns in the children, with the job's arguments.
+--
+-- @param socket                Socket filename
+-- @return                      The job's arguments
+
+function CliServe(socket: string): {string}
+	LoadLazyModules()
+	wg.collectgarbage()
+
+	CLIMessage("serving on ", socket)
+	local args, e = wg.serve(socket)
+	if not args then
+		CLIError("cannot serve on ", socket, ": ", e or "failed")
+	end
+	return assert(args)
+end
@@ -156,27 +156,61 @@ function GetThemes(): {string}
 	return t
 end
 
+-----------------------------------------------------------------------------
+-- Colour pairs are registered with the display once and then set by handle.
+-- The palettes' colours are never changed, so they can be looked up by
+-- identity.
+
+local MakeColour = wg.makecolour
+local UseColour = wg.usecolour
+
+local DEFAULT_FG: Colour = {1.0, 1.0, 1.0}
+local DEFAULT_BG: Colour = {0.0, 0.0, 0.0}
+
+local colourhandles: {[Colour]: {[Colour]: number}} = {}
+
+local function gethandle(fg: Colour?, bg: Colour?): number
+	local fgc = fg or DEFAULT_FG
+	local bgc = bg or DEFAULT_BG
+	local t = colourhandles[fgc]
+	if not t then
+		t = {}
+		colourhandles[fgc] = t
+	end
+	local handle = t[bgc]
+	if not handle then
+		handle = MakeColour(fgc, bgc)
+		t[bgc] = handle
+	end
+	return handle
+end
+
+-- Each paragraph style's colours in the current theme, by style name.
+local paragraphhandles: {[string]: number} = {}
+
 -----------------------------------------------------------------------------
 -- Configures the current theme.
 
 function SetTheme(theme: string)
 	Palette = Palettes[theme] or {}
+
+	paragraphhandles = {}
+	for k in Palette do
+		local style = k:match("^(.*)_[FB]G$")
+		if style then
+			paragraphhandles[style] =
+				gethandle(Palette[style.."_FG"], Palette[style.."_BG"])
+		end
+	end
 end
 
 -----------------------------------------------------------------------------
 -- Actually sets a style for drawing.
 
 function SetColour(fg: Colour?, bg: Colour?)
-	if not fg then
-		fg = {1.0, 1.0, 1.0}
-	end
-	assert(fg)
-
-	if not bg then
-		bg = {0.0, 0.0, 0.0}
-	end
-	assert(bg)
-
-	wg.setcolour(fg, bg)
+	UseColour(gethandle(fg, bg))
 end
 
+function SetParagraphColour(style: string)
+	UseColour(paragraphhandles[style] or gethandle(nil, nil))
+end
@@ -16,6 +16,7 @@ local SetDim = wg.setdim
 local GetStringWidth = wg.getstringwidth
 local GetBytesOfCharacter = wg.getbytesofcharacter
 local GetWordText = wg.getwordtext
+local CombineHashes = wg.combinehashes
 local BOLD = wg.BOLD
 local ITALIC = wg.ITALIC
 local UNDERLINE = wg.UNDERLINE
@@ -43,12 +44,49 @@ Document.__index = Document
 _G.Document = Document
 declare currentDocument: Document
 
-type ShadowDocument = {
-	[number]: Paragraph,
-
+-- One step of undo history: the cursor to restore, plus how to turn this
+-- state into the next older one (replace count paragraphs starting at first
+-- with paragraphs). The oldest entry has no patch.
+type UndoEntry = {
 	cp: number,
 	cw: number,
-	co: number
+	co: number,
+
+	first: number?,
+	count: number?,
+	paragraphs: {Paragraph}?,
+	manifest: {string}?, -- the paragraphs' hashes, once paged out to disk
+	size: number,
+}
+
+-- Consecutive checkpoints of the same kind share one undo entry.
+type UndoGroup = {
+	name: string,
+	time: number, -- of the last checkpoint in the group
+	words: number,
+}
+
+-- A stack of UndoEntrys, newest last. Only the newest state is kept in full
+-- (as mirror); older ones are reached by patching it.
+type UndoStack = {
+	[number]: UndoEntry,
+
+	mirror: {Paragraph}?,
+	generation: number?, -- document generation matching mirror, if any
+	edits: number?, -- documentSet._edits when last checkpointed
+	group: UndoGroup?, -- the run of edits the newest entry is collecting
+	size: number, -- estimated bytes held by the entries
+	spilled: number?, -- how many of the oldest entries are paged out
+}
+
+-- One change found by Document.sync(): count paragraphs starting at first
+-- were replaced by inserted new ones, changing the word count by words.
+type Change = {
+	generation: number,
+	first: number,
+	removed: number,
+	inserted: number,
+	words: number,
 }
 
 type Document = {
@@ -67,9 +105,28 @@ type Document = {
 
 	-- Transient data, not stored in files.
 	_changed: boolean,
-	_undostack: {ShadowDocument}?,
-	_redostack: {ShadowDocument}?,
+	_undostack: UndoStack?,
+	_redostack: UndoStack?,
 	_wrapwidth: number?,
+	_prewrapwidth: number?, -- width prewrap() is working towards
+	_prewrapup: number?, -- next paragraph above the cursor to prewrap
+	_prewrapdown: number?, -- next paragraph below the cursor to prewrap
+	_generation: number?, -- bumped whenever sync() finds a change
+	_syncsnapshot: {Paragraph}?, -- paragraphs as of the last sync()
+	_changelog: {Change}?, -- recent changes, oldest first
+	_changelogbase: number?, -- oldest generation the log can answer for
+	_stamps: {[Paragraph]: number}?, -- weak; when each paragraph appeared
+	_rngeneration: number?, -- generation as of the last renumber
+	_rnstyles: any, -- documentStyles as of the last renumber
+	_rnedits: number?, -- documentSet._edits as of the last setCurrent()
+	_upgradefrom: number?, -- file format whose upgrades are still to do
+	_wordindex: any, -- the word index, if enabled (see addons/wordindex.lua)
+	_statistics: any, -- word and sentence counts (see addons/statistics.lua)
+	_hash: DocumentHash?, -- see hash()
+	_pagelayout: any, -- line count at the page width (see addons/statusbar_pagecount.lua)
+	_outline: any, -- cached headings (see addons/goto.lua)
+	_folding: any, -- the outline view, if it's on (see addons/goto.lua)
+	_misspellings: any, -- misspelt words (see addons/spillchocker.lua)
 	_topp: number?, -- paragraph number of top of screen
 	_topw: number?, -- word number of top of screen
 	_botp: number?, -- paragraph number of bottom of screen
@@ -88,16 +145,27 @@ type Document = {
 
 	cursor: (self: Document) -> {number},
 	appendParagraph: (self: Document, p: Paragraph) -> (),
+	appendParagraphs: (self: Document, paragraphs: {Paragraph}) -> (),
 	insertParagraphBefore: (self: Document, paragraph: Paragraph, pn: number)
 		-> (),
+	insertParagraphsBefore: (self: Document, paragraphs: {Paragraph},
+		pn: number) -> (),
 	deleteParagraphAt: (self: Document, pn: number) -> (),
+	deleteParagraphsAt: (self: Document, pn: number, count: number) -> (),
 	wrap: (self: Document, width: number) -> (),
+	prewrap: (self: Document, budget: number) -> boolean,
 	getMarks: (self: Document)
 		-> (number, number, number, number, number, number),
 	purge: (self: Document) -> (),
 	spaceAbove: (self: Document, pn: number) -> number,
 	spaceBelow: (self: Document, pn: number) -> number,
 	renumber: (self: Document) -> (),
+	sync: (self: Document) -> number,
+	changedSince: (self: Document, generation: number)
+		-> ({{number}}?, number),
+	changedSpan: (self: Document, generation: number?) -> (number, number),
+	generationOf: (self: Document, pn: number) -> number,
+	hash: (self: Document) -> string,
 }
 
 function Document.cursor(self: Document)
@@ -112,14 +180,88 @@ function Document.insertParagraphBefore(self: Document, paragraph, pn)
 	table.insert(self, pn, paragraph)
 end
 
+-- Inserting or deleting a run of paragraphs one at a time moves the rest
+-- of the document once per paragraph; these move it only once.
+
+function Document.insertParagraphsBefore(self: Document, paragraphs, pn)
+	local n = #paragraphs
+	if n > 0 then
+		table.move(self, pn, #self, pn+n)
+		table.move(paragraphs, 1, n, pn, self)
+	end
+end
+
+function Document.appendParagraphs(self: Document, paragraphs)
+	table.move(paragraphs, 1, #paragraphs, #self+1, self)
+end
+
 function Document.deleteParagraphAt(self: Document, pn)
 	table.remove(self, pn)
 end
 
+function Document.deleteParagraphsAt(self: Document, pn, count)
+	local len = #self
+	count = math.min(count, len - pn + 1)
+	if count > 0 then
+		table.move(self, pn+count, len, pn)
+		for i = len-count+1, len do
+			self[i] = nil
+		end
+	end
+end
+
 function Document.wrap(self: Document, width: number)
 	self._wrapwidth = width
 end
 
+-- Wraps paragraphs working outwards from the cursor until the time budget
+-- (in seconds) runs out, so that after a width change moving around the
+-- document finds them already wrapped. Call repeatedly while the user isn't
+-- doing anything; returns true if there's more to do. Starts again from the
+-- cursor whenever the width changes.
+function Document.prewrap(self: Document, budget: number): boolean
+	local width = self._wrapwidth
+	if not width then
+		return false
+	end
+
+	if width ~= self._prewrapwidth then
+		self._prewrapwidth = width
+		self._prewrapup = self.cp - 1
+		self._prewrapdown = self.cp
+	end
+	local up = assert(self._prewrapup)
+	local down = assert(self._prewrapdown)
+
+	local deadline = wg.time() + budget
+	local more = true
+	while more do
+		-- Wrapping a paragraph is much cheaper than reading the clock, so
+		-- do a batch at a time.
+		for i = 1, 16 do
+			local below = self[down]
+			if below then
+				below:wrap(width)
+				down = down + 1
+			end
+			local above = self[up]
+			if above then
+				above:wrap(width)
+				up = up - 1
+			end
+			more = (above ~= nil) or (below ~= nil)
+		end
+
+		if wg.time() >= deadline then
+			break
+		end
+	end
+
+	self._prewrapup = up
+	self._prewrapdown = down
+	return more
+end
+
 function Document.getMarks(self: Document)
 	if not self.mp then
 		return
@@ -182,11 +324,289 @@ function Document.touch(self: Document)
 	FireEvent("DocumentModified", self)
 end
 
-function Document.renumber(self: Document)
+-- Change tracking. Documents are plain arrays and get assigned to directly,
+-- so changes are found by comparing against the array as it was last time
+-- (paragraphs are immutable, so identity is enough). sync() does this once
+-- and records what it found; consumers then ask changedSince() rather than
+-- each scanning the document themselves. Replacement paragraphs get
+-- stamped with the generation in which they appeared.
+
+local CHANGELOGSIZE = 64
+
+function Document.sync(self: Document): number
+	local old = self._syncsnapshot
+	local gen = self._generation or 0
+	local n = #self
+	if not old then
+		gen = gen + 1
+		self._changelog = {}
+		self._changelogbase = gen
+		self._stamps = setmetatable({}, {__mode = "k"}) :: any
+		self._syncsnapshot = table.move(self :: any, 1, n, 1, {})
+	else
+		local m = #old
+		local s = 1
+		while (s <= n) and (s <= m) and rawequal(old[s], self[s]) do
+			s = s + 1
+		end
+		if (s > n) and (s > m) then
+			return gen
+		end
+		local e = 0
+		while (e <= (n-s)) and (e <= (m-s)) and rawequal(old[m-e], self[n-e]) do
+			e = e + 1
+		end
+
+		gen = gen + 1
+		local stamps = self._stamps
+		assert(stamps)
+		local words = 0
+		for i = s, m-e do
+			words = words - #old[i]
+		end
+		for i = s, n-e do
+			local p = self[i]
+			words = words + #p
+			stamps[p] = gen
+		end
+
+		local log = self._changelog
+		assert(log)
+		log[#log+1] = {
+			generation = gen,
+			first = s,
+			removed = m-e-s+1,
+			inserted = n-e-s+1,
+			words = words,
+		}
+		if #log > CHANGELOGSIZE then
+			table.remove(log, 1)
+			self._changelogbase = log[1].generation - 1
+		end
+
+		-- The snapshot is patched rather than copied, as copying the whole
+		-- document on every keystroke adds up.
+		-- (Growing it with table.move() would reallocate the whole array
+		-- for every paragraph added, so it's appended to first.)
+		local removed = m-e-s+1
+		local inserted = n-e-s+1
+		for i = m+1, n do
+			old[i] = self[i]
+		end
+		if (removed ~= inserted) then
+			table.move(old, s+removed, m, s+inserted)
+			for i = n+1, m do
+				old[i] = nil
+			end
+		end
+		table.move(self :: any, s, s+inserted-1, s, old)
+	end
+
+	self._generation = gen
+	return gen
+end
+
+-- Returns the ranges of paragraphs, as {first, last} pairs in current
+-- paragraph numbers, which have changed since the given generation, plus
+-- the change in word count. A range where last == first-1 marks where
+-- paragraphs were only deleted. If the generation is too old to know, the
+-- ranges are nil.
+function Document.changedSince(self: Document, generation: number)
+		: ({{number}}?, number)
+	local gen = self:sync()
+	if generation >= gen then
+		return {}, 0
+	end
+	if generation < (self._changelogbase or gen) then
+		return nil, 0
+	end
+
+	local ranges: {{number}} = {}
+	local words = 0
+	local log: {Change} = self._changelog or {}
+	for _, c in ipairs(log) do
+		if c.generation > generation then
+			words = words + c.words
+
+			local first = c.first
+			local last = c.first + c.inserted - 1
+			local delta = c.inserted - c.removed
+			local newranges = {}
+			for _, r in ipairs(ranges) do
+				if r[2] < (c.first - 1) then
+					newranges[#newranges+1] = r
+				elseif r[1] > (c.first + c.removed) then
+					newranges[#newranges+1] = {r[1] + delta, r[2] + delta}
+				else
+					first = math.min(first, r[1])
+					last = math.max(last, math.max(r[2] + delta, first - 1))
+				end
+			end
+			newranges[#newranges+1] = {first, last}
+			table.sort(newranges, function(a, b) return a[1] < b[1] end)
+			ranges = newranges
+		end
+	end
+	return ranges, words
+end
+
+-- Returns the part of the document which might have changed since the
+-- given generation, as first and last paragraph numbers. If the change log
+-- doesn't go back that far (or there's no generation) this is the whole
+-- document.
+function Document.changedSpan(self: Document, generation: number?)
+		: (number, number)
+	if generation then
+		local ranges = self:changedSince(generation)
+		if ranges then
+			local first = #self + 1
+			local last = #self
+			if #ranges > 0 then
+				first = ranges[1][1]
+				last = first - 1
+				for _, r in ipairs(ranges) do
+					last = math.max(last, r[2])
+				end
+			end
+			return first, last
+		end
+	end
+	return 1, #self
+end
+
+-- Returns the generation in which the given paragraph appeared (or the
+-- first generation, for paragraphs present from the start).
+function Document.generationOf(self: Document, pn: number): number
+	self:sync()
+	local stamps = self._stamps
+	assert(stamps)
+	return stamps[self[pn]] or self._changelogbase or 1
+end
+
+-- Finds the single run of paragraphs which differs between two arrays of
+-- paragraphs (such as an old copy of a document and the document now),
+-- returning where it starts and how long it is in each. Everything in new
+-- before first and after last is already known to be the same as old.
+function DiffParagraphs(old: {Paragraph}, new: {Paragraph}, first: number,
+		last: number): (number, number, number)
+	local n = #new
+	local m = #old
+	local s = first
+	while (s <= n) and (s <= m) and rawequal(old[s], new[s]) do
+		s = s + 1
+	end
+	local e = math.max(0, math.min(n-last, n-s+1, m-s+1))
+	while (e <= (n-s)) and (e <= (m-s)) and rawequal(old[m-e], new[n-e]) do
+		e = e + 1
+	end
+	return s, m-e-s+1, n-e-s+1
+end
+
+-- Returns a hash of the document's content, as a string of 16 hex digits;
+-- documents with the same paragraphs have the same hash. The paragraphs'
+-- hashes are combined a block of HASHBLOCK at a time and the blocks' hashes
+-- combined into the result, so after an edit only the paragraphs which
+-- changed are hashed and only the blocks they're in (or, if paragraphs came
+-- or went, the blocks after them) are combined again.
+
+local HASHBLOCK = 64
+
+type DocumentHash = {
+	generation: number,
+	snapshot: {Paragraph},
+	leaves: {string}, -- the hash of each paragraph
+	blocks: {string}, -- the hash of each HASHBLOCK of leaves
+	root: string,
+}
+
+local function hashblocks(h: DocumentHash, first: number)
+	local leaves = h.leaves
+	local blocks = h.blocks
+	local n = (#leaves + HASHBLOCK - 1) // HASHBLOCK
+	for b = first, n do
+		local s = (b-1)*HASHBLOCK + 1
+		blocks[b] = CombineHashes(leaves, s, math.min(s+HASHBLOCK-1, #leaves))
+	end
+	for b = #blocks, n+1, -1 do
+		blocks[b] = nil
+	end
+	h.root = CombineHashes(blocks, 1, #blocks)
+end
+
+function Document.hash(self: Document): string
+	local gen = self:sync()
+	local h = self._hash
+	if not h then
+		local leaves: {string} = table.create(#self)
+		for i, p in ipairs(self) do
+			leaves[i] = p:hash()
+		end
+		local new: DocumentHash = {
+			generation = gen,
+			snapshot = table.move(self :: any, 1, #self, 1, {}),
+			leaves = leaves,
+			blocks = {},
+			root = "",
+		}
+		hashblocks(new, 1)
+		self._hash = new
+		return new.root
+	end
+
+	if (gen ~= h.generation) then
+		local s, removed, inserted = DiffParagraphs(h.snapshot, self :: any,
+			self:changedSpan(h.generation))
+		local leaves = h.leaves
+		local oldlen = #leaves
+		if (removed ~= inserted) then
+			table.move(leaves, s+removed, oldlen, s+inserted)
+			for i = oldlen, oldlen - removed + inserted + 1, -1 do
+				leaves[i] = nil
+			end
+		end
+		for i = s, s+inserted-1 do
+			leaves[i] = self[i]:hash()
+		end
+
+		local first = (s-1) // HASHBLOCK + 1
+		if (removed == inserted) then
+			-- Only the blocks holding the changed paragraphs are affected.
+			local blocks = h.blocks
+			local last = (s+inserted-2) // HASHBLOCK + 1
+			for b = first, last do
+				local bs = (b-1)*HASHBLOCK + 1
+				blocks[b] = CombineHashes(leaves, bs,
+					math.min(bs+HASHBLOCK-1, #leaves))
+			end
+			h.root = CombineHashes(blocks, 1, #blocks)
+		else
+			hashblocks(h, first)
+		end
+
+		h.snapshot = table.move(self :: any, 1, #self, 1, {})
+		h.generation = gen
+	end
+	return h.root
+end
+
+-- Updates the word count and the numbers of numbered list items. This is
+-- called on every change, so it only looks at what changed since last time,
+-- and renumbers only the list run(s) that touches.
+
+local function isnumbered(p: Paragraph): boolean
+	return documentStyles[p.style].numbered or false
+end
+
+local function islist(p: Paragraph): boolean
+	return documentStyles[p.style].list or false
+end
+
+local function fullrenumber(self: Document)
 	local wc = 0
 	local pn = 1
 
-	for _, p in ipairs(self) do
+	for i = 1, #self do
+		local p = self[i]
 		wc = wc + #p
 
 		local style = documentStyles[p.style]
@@ -201,40 +621,107 @@ function Document.renumber(self: Document)
 	self.wordcount = wc
 end
 
--- Returns how many screen spaces a portion of a string takes up.
-function GetWidthFromOffset(s: string, o: number)
-	return GetStringWidth(s:sub(1, o-1))
-end
+-- Renumbers the list run containing the paragraphs first..last.
+local function renumberrange(self: Document, first: number, last: number)
+	local pn = 1
+	for i = first-1, 1, -1 do
+		local p = self[i]
+		if isnumbered(p) then
+			pn = (p.number or 0) + 1
+			break
+		elseif not islist(p) then
+			break
+		end
+	end
 
--- Returns the offset into a string needed for a screen width.
-function GetOffsetFromWidth(s, x)
-		local len = #s
-		local o = 1
-		while (o <= len) do
-			if (x == 0) then
-				return o
+	for i = first, #self do
+		local p = self[i]
+		if isnumbered(p) then
+			if (i > last) and (p.number == pn) then
+				break
 			end
-
-			local charlen = GetBytesOfCharacter(string.byte(s, o))
-			local char = s:sub(o, o+charlen-1)
-			local ww = GetStringWidth(char)
-			if (ww > x) then
-				return o
+			p.number = pn
+			pn = pn + 1
+		elseif not islist(p) then
+			if i > last then
+				break
 			end
+			pn = 1
+		end
+	end
+end
+
+function Document.renumber(self: Document)
+	local since = self._rngeneration
+	local ranges, words
+	if since and (self._rnstyles == documentStyles) and self.wordcount then
+		ranges, words = self:changedSince(since)
+	end
 
-			x = x - ww
-			o = o + charlen
+	if not ranges then
+		fullrenumber(self)
+	else
+		self.wordcount = self.wordcount + words
+		for _, r in ipairs(ranges) do
+			renumberrange(self, r[1], r[2])
 		end
+	end
+
+	self._rngeneration = self:sync()
+	self._rnstyles = documentStyles
+end
 
-		return len + 1
+-- Returns how many screen spaces a portion of a string takes up.
+function GetWidthFromOffset(s: string, o: number): number
+	return wg.getwidthfromoffset(s, o)
+end
+
+-- Returns the offset into a string needed for a screen width.
+function GetOffsetFromWidth(s: string, x: number): number
+	return wg.getoffsetfromwidth(s, x)
 end
 
-function GetWordSimpleText(s: string): string
-	s = GetWordText(s)
+-- The spellchecker, wordcount and searches call this on every word, and
+-- words repeat a lot, so the results are cached. The cache is thrown away
+-- when it gets big, or when the smartquote settings (which affect the
+-- result) change.
+local simpletextcache: {[string]: string} = {}
+local simpletextcachesize = 0
+local cachedquotes: any = {}
+
+function GetWordSimpleText(word: string): string
+	local q = documentSet.addons.smartquotes or {}
+	if (q.leftdouble ~= cachedquotes.leftdouble)
+			or (q.rightdouble ~= cachedquotes.rightdouble)
+			or (q.leftsingle ~= cachedquotes.leftsingle)
+			or (q.rightsingle ~= cachedquotes.rightsingle) then
+		cachedquotes = {
+			leftdouble = q.leftdouble,
+			rightdouble = q.rightdouble,
+			leftsingle = q.leftsingle,
+			rightsingle = q.rightsingle
+		}
+		simpletextcache = {}
+		simpletextcachesize = 0
+	end
+
+	local cached = simpletextcache[word]
+	if cached then
+		return cached
+	end
+
+	local s = GetWordText(word)
 	s = UnSmartquotify(s)
 	s = s:gsub('[`~#&^$"<>]+', "")
 	s = s:gsub("^[.'([{]+", "")
 	s = s:gsub("[',.!?:;)%]}]+$", "")
+
+	if simpletextcachesize >= 65536 then
+		simpletextcache = {}
+		simpletextcachesize = 0
+	end
+	simpletextcache[word] = s
+	simpletextcachesize = simpletextcachesize + 1
 	return s
 end
 
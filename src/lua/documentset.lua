@@ -27,6 +27,14 @@ local DocumentSet = {}
 DocumentSet.__index = DocumentSet
 _G.DocumentSet = DocumentSet
 
+type Journal = {
+	filename: string,
+	basesize: number?,
+	started: boolean,
+	names: {string},
+	snapshots: {{Paragraph} | false},
+}
+
 type DocumentSet = {
 	fileformat: number,
 	name: string,
@@ -38,11 +46,15 @@ type DocumentSet = {
 	addons: {[string]: any},
 	findtext: string,
 	replacetext: string,
+	findregex: boolean?,
 
 	_documentIndex: {[string]: Document},
+	_documentNumbers: {[string]: number}?, -- name to index in documents
 	_changed: boolean,
 	_justchanged: boolean,
-	_findpatterns: {(string, number?) -> (number?, number?)}?,
+	_edits: number?, -- bumped by every touch()
+	_journal: Journal?,
+	_damaged: {string}?, -- documents whose text failed its checksum on load
 
 	touch: (self: DocumentSet) -> (),
 	clean: (self: DocumentSet) -> (),
@@ -54,7 +66,7 @@ type DocumentSet = {
 		-> (),
 	deleteDocument: (self: DocumentSet, name: string) -> boolean,
 	setCurrent: (self: DocumentSet, name: string) -> (),
-	renameDocument: (self: DocumentSet, oldname: string, newname: string) -> (),
+	renameDocument: (self: DocumentSet, oldname: string, newname: string) -> boolean,
 	setClipboard: (self: DocumentSet, clipboard: Document) -> (),
 	getClipboard: (self: DocumentSet) -> Document?,
 }
@@ -76,6 +88,7 @@ end
 DocumentSet.touch = function(self: DocumentSet)
 	self._changed = true
 	self._justchanged = true
+	self._edits = (self._edits or 0) + 1
 end
 
 DocumentSet.clean = function(self: DocumentSet)
@@ -83,17 +96,108 @@ DocumentSet.clean = function(self: DocumentSet)
 	self._justchanged = false
 end
 
+-----------------------------------------------------------------------------
+-- Lazy documents. After a load, documents other than the current one are
+-- left as text (see dumpfile.cc) and only turned into paragraphs the first
+-- time anything looks at them --- which, as they have no paragraphs yet, is
+-- any index into them. Note that ipairs() doesn't do this, so anything which
+-- walks the paragraphs of a document which might not be the current one
+-- should call MaterialiseDocument() first.
+
+local LazyDocument = {}
+_G.LazyDocument = LazyDocument
+
+function IsLazyDocument(document: any): boolean
+	return getmetatable(document) == LazyDocument
+end
+
+-- A document loaded from an older file format gets the upgrades to its
+-- contents (see UpgradeDocumentContents()) as it's materialised.
+
+local MaterialiseText = wg.materialisedocument
+
+local function upgrade(document: any)
+	local oldversion = document._upgradefrom
+	if oldversion then
+		document._upgradefrom = nil
+		UpgradeDocumentContents(document, oldversion)
+	end
+end
+
+local function MaterialiseDocument(document: any)
+	if not IsLazyDocument(document) then
+		return
+	end
+	MaterialiseText(document)
+	upgrade(document)
+end
+_G.MaterialiseDocument = MaterialiseDocument
+
+-- The same for a list of documents, which is quicker than doing them one at a
+-- time when there are a lot of them, as the native part runs in parallel.
+
+local function MaterialiseDocuments(documents: {any})
+	local lazy = {}
+	for _, document in documents do
+		if IsLazyDocument(document) then
+			lazy[#lazy+1] = document
+		end
+	end
+	wg.materialisedocuments(lazy)
+	for _, document in lazy do
+		upgrade(document)
+	end
+end
+_G.MaterialiseDocuments = MaterialiseDocuments
+
+LazyDocument.__index = function(self, key)
+	MaterialiseDocument(self)
+	return self[key]
+end
+
+LazyDocument.__newindex = function(self, key, value)
+	MaterialiseDocument(self)
+	self[key] = value
+end
+
+LazyDocument.__len = function(self)
+	MaterialiseDocument(self)
+	return #self
+end
+
+LazyDocument.__iter = function(self)
+	MaterialiseDocument(self)
+	return next, self
+end
+
 DocumentSet.getDocumentList = function(self: DocumentSet)
 	return self.documents
 end
 
-DocumentSet._findDocument = function(self: DocumentSet, name): number?
+-- The index of each document is kept by name. The methods below keep it
+-- up to date, or throw it away when that would be as much work as building
+-- it again; as anything else could have changed the documents list too, a
+-- hit is checked and the map rebuilt if it's wrong.
+
+local function numberdocuments(self: DocumentSet): {[string]: number}
+	local numbers = {}
 	for i, d in self.documents do
-		if (d.name == name) then
-			return i
+		numbers[d.name] = i
+	end
+	self._documentNumbers = numbers
+	return numbers
+end
+
+DocumentSet._findDocument = function(self: DocumentSet, name): number?
+	local numbers = self._documentNumbers or numberdocuments(self)
+	local n = numbers[name]
+	if n then
+		local d = self.documents[n]
+		if not d or (d.name ~= name) then
+			n = numberdocuments(self)[name]
 		end
 	end
-	return nil
+	return n
 end
 
 DocumentSet.findDocument = function(self: DocumentSet, name: string)
@@ -118,6 +222,10 @@ DocumentSet.addDocument = function(self, document, name)
 	local n = self:_findDocument(name) or (#self.documents + 1)
 	self.documents[n] = document
 	self._documentIndex[name] = document
+	local numbers = self._documentNumbers
+	if numbers then
+		numbers[name] = n
+	end
 	if not self.current or (self.current.name == name) then
 		self:setCurrent(name)
 	end
@@ -136,6 +244,7 @@ DocumentSet.moveDocumentIndexTo = function(self, name, targetIndex)
 
 	table_remove(self.documents, n)
 	table_insert(self.documents, targetIndex, document)
+	self._documentNumbers = nil
 	self:touch()
 	RebuildDocumentsMenu(self.documents)
 end
@@ -153,6 +262,7 @@ DocumentSet.deleteDocument = function(self, name)
 
 	table.remove(self.documents, n)
 	self._documentIndex[name] = nil
+	self._documentNumbers = nil
 
 	self:touch()
 	RebuildDocumentsMenu(self.documents)
@@ -181,20 +291,37 @@ DocumentSet.setCurrent = function(self, name)
 		currentDocument = self.documents[1]
 	end
 
+	-- Renumbering has to look at every paragraph to find out what's
+	-- changed, so it's skipped if nothing in the document set has been
+	-- edited since this document was last renumbered here. (Rewrapping
+	-- happens on demand anyway, so ResizeScreen() only costs anything if
+	-- the width has changed.)
+
 	self.current = currentDocument
-	currentDocument:renumber()
+	if (currentDocument._rnedits ~= self._edits)
+			or (currentDocument._rnstyles ~= documentStyles)
+			or not currentDocument._rngeneration then
+		currentDocument:renumber()
+		currentDocument._rnedits = self._edits
+	end
 	ResizeScreen()
 end
 
 DocumentSet.renameDocument = function(self, oldname, newname)
-	if self.documents[newname] then
+	local n = self:_findDocument(oldname)
+	if not n or self:_findDocument(newname) then
 		return false
 	end
 
-	local d = self.documents[oldname]
-	self.documents[oldname] = nil
-	self.documents[newname] = d
+	local d = self.documents[n]
+	self._documentIndex[oldname] = nil
+	self._documentIndex[newname] = d
 	d.name = newname
+	local numbers = self._documentNumbers
+	if numbers then
+		numbers[oldname] = nil
+		numbers[newname] = n
+	end
 
 	self:touch()
 	RebuildDocumentsMenu(self.documents)
@@ -4,51 +4,172 @@
 -- file in this distribution for the full text.
 
 type EventToken = {Event}
-type EventCallback = (Event, EventToken, ...any) -> ()
+type EventCallback = (Event, EventToken, ...any) -> ...any
 
-local listeners = {} :: {[Event]: {[EventToken]: EventCallback}}
+type Listener = {
+	token: EventToken,
+	callback: EventCallback,
+	active: (() -> boolean)?,
+	priority: number,
+}
+
+-- Each event's listeners, in the order they're called. The lists are never
+-- changed in place, only replaced, so a listener which adds or removes
+-- listeners while an event is firing doesn't disturb the loop calling it.
+local IsTracing = wg.istracing
+local TraceBegin = wg.tracebegin
+local TraceEnd = wg.traceend
+
+local listeners = {} :: {[Event]: {Listener}}
 local batched = {} :: {[Event]: boolean}
 
+type DeferredListener = {
+	token: EventToken,
+	callback: EventCallback,
+	delay: number,
+	deadline: number?,
+}
+
+-- Deferred listeners with a call pending.
+local deferred = {} :: {[EventToken]: DeferredListener}
+
+type Timer = {
+	deadline: number,
+	interval: number,
+	callback: () -> (),
+	repeating: boolean,
+	index: number?, -- where it is in the heap, or nil once it's gone
+}
+
+-- Pending timers, as a binary min-heap on the deadline.
+local timers = {} :: {Timer}
+
+type WorkerJob = {
+	job: Job,
+	callback: (string?, string?) -> (),
+}
+
+-- Jobs running on worker threads, and when to next look at them.
+local workerjobs = {} :: {WorkerJob}
+local workerdeadline: number? = nil
+local WORKER_POLL = 0.02
+
 type Event =
-	  "BuildStatusBar"    --- (statusbararray) the contents of the statusbar is being calculated
+	  "BackgroundSave"    --- a background save has made progress or finished
+	| "BuildStatusBar"    --- (statusbar) the contents of the statusbar is being calculated
 	| "Changed"           --- the document's been changed
 	| "DocumentCreated"   --- a new documentset has just been created
 	| "DocumentLoaded"    --- a new documentset has just been loaded
 	| "DocumentModified"  --- (document) a document has been modified
+	| "DocumentSaved"     --- (filename) the documentset has been written to disk
 	| "DocumentUpgrade"   --- (oldversion, newversion) the documentset is being upgraded
-	| "DrawWord"          --- (word=, ostyle=, cstyle=) a word is being drawn on the screen
-	| "KeyTyped"          --- (value=) user is typing into the document
+	| "DrawWord"          --- filter (cstyle; word, firstword) a word is being drawn on the screen
+	| "KeyTyped"          --- filter (value) user is typing into the document
+	| "MemoryReport"      --- (add) the heap is being walked; add(name, ...) counts things
 	| "Idle"              --- the user isn't touching the keyboard
 	| "Moved"             --- the cursor has moved
 	| "Redraw"            --- the screen has just been redrawn
 	| "RegisterAddons"    --- all addons should register themselves in the documentset
 	| "WaitingForUser"    --- we're about to wait for a keypress
+	| "WorkerFinished"    --- a job started with SpawnWorker() has finished
 	| "ScreenInitialised" --- the screen has just been set up
 
+-- Filter events are fired with FilterEvent() rather than FireEvent(), and
+-- pass their parameters as arguments rather than in a payload table, which
+-- would be a table per word drawn. These were payload events once, and are
+-- still seen as such by listeners added with AddEventListener() and by
+-- callers which fire them with a table; these are the payload's fields, the
+-- filtered value first.
+local PAYLOADS = {
+	DrawWord = {"cstyle", "word", "firstword"},
+	KeyTyped = {"value"},
+} :: {[Event]: {string}}
+
+local function addlistener(event: Event, callback: EventCallback,
+		active: (() -> boolean)?, priority: number?): EventToken
+	local token: EventToken = {event}
+	local listener: Listener = {
+		token = token,
+		callback = callback,
+		active = active,
+		priority = priority or 0,
+	}
+
+	-- Listeners of the same priority are called in the order they were
+	-- added.
+
+	local old: {Listener} = listeners[event] or {}
+	local new = {}
+	local inserted = false
+	for _, l in old do
+		if not inserted and (l.priority > listener.priority) then
+			new[#new+1] = listener
+			inserted = true
+		end
+		new[#new+1] = l
+	end
+	if not inserted then
+		new[#new+1] = listener
+	end
+	listeners[event] = new
+	return token
+end
+
 --- Adds a listener for a particular event.
 -- The supplied callback is added as a listener for the specified event.
--- The order in which listeners are called is not defined. A callback may
+-- Listeners are called in order of priority, lowest first; listeners with
+-- the same priority are called in the order they were added. A callback may
 -- be registered for any number of events.
 --
 -- The function returns a callback token which is unique for every listener;
 -- it can be used to unregister the listener.
 --
+-- A listener which often has nothing to do may also supply an activity
+-- function, which returns false when the listener currently wouldn't do
+-- anything. This lets expensive event sources (such as DrawWord) check
+-- HasActiveEventListeners() and skip firing the event entirely. FireEvent
+-- itself ignores it and always calls every listener.
+--
+-- Listeners added this way to a filter event get the old payload table.
+--
 -- @param event              the event to register for
 -- @param callback           the callback to register
+-- @param active             optional activity function for the listener
+-- @param priority           optional priority, defaulting to 0
 -- @return                   the callback token
 
-function AddEventListener(event: Event, callback)
-	-- Ensure there's a listener table for this event.
-	
-	if not listeners[event] then
-		listeners[event] = {}
+function AddEventListener(event: Event, callback, active: (() -> boolean)?,
+		priority: number?)
+	local fields = PAYLOADS[event]
+	if fields then
+		local inner = callback
+		callback = function(event, token, ...)
+			local payload = {}
+			for i, field in fields do
+				payload[field] = select(i, ...)
+			end
+			inner(event, token, payload)
+			return payload[fields[1]]
+		end
 	end
-	
-	-- Register the callback.
-	
-	local token: EventToken = {event}
-	listeners[event][token] = callback
-	return token
+
+	return addlistener(event, callback, active, priority)
+end
+
+--- Adds a filter for a particular event.
+-- This is like AddEventListener(), except that the callback is called as
+-- callback(event, token, value, ...) and returns the new value, or nil to
+-- leave it alone. Use FilterEvent() to fire the event.
+--
+-- @param event              the event to register for
+-- @param callback           the callback to register
+-- @param active             optional activity function for the listener
+-- @param priority           optional priority, defaulting to 0
+-- @return                   the callback token
+
+function AddEventFilter(event: Event, callback, active: (() -> boolean)?,
+		priority: number?)
+	return addlistener(event, callback, active, priority)
 end
 
 --- Removes a listener for a particular event.
@@ -59,11 +180,69 @@ end
 
 function RemoveEventListener(token: EventToken)
 	local event: Event = token[1]
-	listeners[event][token] = nil
+	local old = listeners[event]
+	if not old then
+		return
+	end
+
+	local new = {}
+	for _, l in old do
+		if l.token ~= token then
+			new[#new+1] = l
+		end
+	end
+	listeners[event] = new
+	deferred[token] = nil
+end
+
+--- Checks whether firing an event would do anything.
+-- Returns true if any listener for the event has no activity function, or
+-- if its activity function says it's currently active.
+--
+-- @param event              the event to check
+-- @return                   whether the event needs to be fired
+
+function HasActiveEventListeners(event: Event): boolean
+	local l = listeners[event]
+	if l then
+		for _, listener in l do
+			local active = listener.active
+			if not active or active() then
+				return true
+			end
+		end
+	end
+	return false
+end
+
+--- Fires a filter event.
+-- Each listener is passed the value returned by the one before it (or the
+-- supplied value, for the first), along with the other parameters, which
+-- they can't change. Nothing is allocated for the call.
+--
+-- @param event              the event to fire
+-- @param value              the value to filter
+-- @param ...                any additional event parameters
+-- @return                   the filtered value
+
+function FilterEvent(event: Event, value, ...)
+	local l = listeners[event]
+	if l then
+		for i = 1, #l do
+			local listener = l[i]
+			local v = listener.callback(event, listener.token, value, ...)
+			if v ~= nil then
+				value = v
+			end
+		end
+	end
+	return value
 end
 
 --- Fires an event.
--- Any callbacks registered for the event will be called (in any order).
+-- Any callbacks registered for the event will be called, in order of
+-- priority. A filter event may also be fired like this, with its payload
+-- table, for compatibility.
 --
 -- @param event              the event to fire
 -- @param ...                any additional event parameters
@@ -75,9 +254,306 @@ function FireEvent(event, ...)
 	if not l then
 		return
 	end
-	
-	for token, callback in l do
-		callback(event, token, ...)
+
+	local fields = PAYLOADS[event]
+	if fields and (select("#", ...) == 1) and (type((...)) == "table") then
+		local payload = ...
+		local args = {}
+		for i, field in fields do
+			args[i] = payload[field]
+		end
+		payload[fields[1]] = FilterEvent(event, table.unpack(args, 1, #fields))
+		return
+	end
+
+	-- When tracing, each listener gets a span of its own, named after where
+	-- it's defined.
+	if IsTracing() then
+		for i = 1, #l do
+			local listener = l[i]
+			local source, line = debug.info(listener.callback, "sl")
+			source = source:match('^%[string "(.*)"%]$') or source
+			local t = TraceBegin(string.format("%s (%s:%d)", event,
+				source, line))
+			listener.callback(event, listener.token, ...)
+			TraceEnd(t)
+		end
+		return
+	end
+
+	for i = 1, #l do
+		local listener = l[i]
+		listener.callback(event, listener.token, ...)
+	end
+end
+
+--- Adds a deferred listener for a particular event.
+-- This is for listeners which are too expensive to run every time the
+-- event fires, such as on every keystroke. Rather than being called when
+-- the event fires, the callback is called once the event has stopped firing
+-- for the given number of seconds, or when the user goes idle, or when
+-- FlushDeferredEvents() is called (which happens before saving and
+-- exporting). However many times the event fired, the callback is only
+-- called once, and without any event parameters.
+--
+-- @param event              the event to register for
+-- @param callback           the callback to register
+-- @param delay              how long the event must be quiet for, in seconds
+-- @return                   the callback token
+
+function AddDeferredEventListener(event: Event, callback, delay: number)
+	local listener: DeferredListener
+	local token = addlistener(event,
+		function()
+			listener.deadline = wg.time() + delay
+			deferred[listener.token] = listener
+		end)
+	listener = {
+		token = token,
+		callback = callback,
+		delay = delay,
+		deadline = nil,
+	}
+	return token
+end
+
+-----------------------------------------------------------------------------
+-- Timers. These are for things which want doing at a particular time (like
+-- autosaving) rather than when some event happens. The event loop waits for
+-- input for only as long as the nearest one allows, and runs them along
+-- with the deferred listeners, so they never interrupt a burst of typing.
+
+local function swaptimers(i: number, j: number)
+	local a, b = timers[i], timers[j]
+	timers[i], timers[j] = b, a
+	a.index = j
+	b.index = i
+end
+
+local function siftup(i: number)
+	while i > 1 do
+		local parent = i // 2
+		if timers[parent].deadline <= timers[i].deadline then
+			break
+		end
+		swaptimers(i, parent)
+		i = parent
+	end
+end
+
+local function siftdown(i: number)
+	local n = #timers
+	while true do
+		local smallest = i
+		for _, c in {i*2, i*2 + 1} do
+			if (c <= n) and (timers[c].deadline < timers[smallest].deadline) then
+				smallest = c
+			end
+		end
+		if smallest == i then
+			break
+		end
+		swaptimers(i, smallest)
+		i = smallest
+	end
+end
+
+local function inserttimer(timer: Timer)
+	local i = #timers + 1
+	timers[i] = timer
+	timer.index = i
+	siftup(i)
+end
+
+--- Cancels a timer. Cancelling one which has already gone off is harmless.
+--
+-- @param timer              the timer, as returned by AddTimer()
+
+function RemoveTimer(timer: Timer)
+	local i = timer.index
+	if not i then
+		return
+	end
+
+	local last = #timers
+	if i ~= last then
+		swaptimers(i, last)
+	end
+	timers[last] = nil
+	timer.index = nil
+	if i < last then
+		siftup(i)
+		siftdown(i)
+	end
+end
+
+--- Calls a function after a delay, and optionally every so often after that.
+--
+-- @param seconds            the delay, in seconds
+-- @param callback           the function to call, with no parameters
+-- @param repeating          if true, keep calling it every this many seconds
+-- @return                   the timer, for RemoveTimer()
+
+function AddTimer(seconds: number, callback: () -> (),
+		repeating: boolean?): Timer
+	local timer: Timer = {
+		deadline = wg.time() + seconds,
+		interval = seconds,
+		callback = callback,
+		repeating = repeating or false,
+		index = nil,
+	}
+	inserttimer(timer)
+	return timer
+end
+
+--- Calls every timer which is due.
+--
+-- @param now                the time; the default is the current time
+--                           (math.huge calls every timer once)
+
+function RunTimers(now: number?)
+	local t = now or wg.time()
+
+	-- Repeating timers are put back afterwards, so that each goes off at
+	-- most once per call however late it is.
+	local due = {}
+	while (#timers > 0) and (timers[1].deadline <= t) do
+		local timer = timers[1]
+		RemoveTimer(timer)
+		due[#due+1] = timer
+	end
+
+	for _, timer in due do
+		if timer.repeating then
+			timer.deadline = wg.time() + timer.interval
+			inserttimer(timer)
+		end
+		timer.callback()
+	end
+end
+
+--- Returns when the next deferred listener is due, or nil if none are.
+
+function GetDeferredEventDeadline(): number?
+	local deadline: number? = workerdeadline
+	local timer = timers[1]
+	if timer and (not deadline or (timer.deadline < deadline)) then
+		deadline = timer.deadline
+	end
+	for _, listener in deferred do
+		local d = listener.deadline
+		if d and (not deadline or (d < deadline)) then
+			deadline = d
+		end
+	end
+	return deadline
+end
+
+--- Calls any deferred listeners which are due.
+--
+-- @param now                the time; the default is the current time
+--                           (math.huge calls every pending listener)
+
+function RunDeferredEvents(now: number?)
+	local t = now or wg.time()
+	if workerdeadline and (workerdeadline <= t) then
+		PollWorkers()
+	end
+
+	-- Flushing deferred listeners doesn't make timers go off early.
+	RunTimers(math.min(t, wg.time()))
+
+	while true do
+		-- Listeners may cause more events, so look again each time.
+
+		local due: DeferredListener? = nil
+		for _, listener in deferred do
+			local d = listener.deadline
+			if d and (d <= t) then
+				due = listener
+				break
+			end
+		end
+		if not due then
+			break
+		end
+		assert(due)
+
+		deferred[due.token] = nil
+		due.deadline = nil
+		local event: Event = due.token[1]
+		due.callback(event, due.token)
+	end
+end
+
+--- Calls every pending deferred listener now.
+
+function FlushDeferredEvents()
+	RunDeferredEvents(math.huge)
+end
+
+-- The user's gone idle, so there's no point waiting any longer.
+AddEventListener("Idle", FlushDeferredEvents, function()
+	return next(deferred) ~= nil
+end)
+
+--- Runs a pure function on a worker thread.
+-- The code is compiled in an interpreter of its own, with only the standard
+-- libraries, and must return a function; that's called with the input (a
+-- string or mapped file) and must return a string. Once it has, the
+-- callback is called with the result, or nil and an error, and an async
+-- WorkerFinished event fired. The event loop looks for finished jobs as it
+-- runs deferred events.
+--
+-- @param code               the Luau source of the job
+-- @param input              what to call its function with
+-- @param callback           called with the result
+
+function SpawnWorker(code: string, input: any,
+		callback: (string?, string?) -> ())
+	workerjobs[#workerjobs+1] = {
+		job = wg.spawn(code, input),
+		callback = callback,
+	}
+	workerdeadline = workerdeadline or (wg.time() + WORKER_POLL)
+end
+
+--- Calls back for any worker jobs which have finished.
+--
+-- @param timeout            optional time to wait for the first one
+
+function PollWorkers(timeout: number?)
+	local finished: {{w: WorkerJob, done: boolean?, result: string?}} = {}
+	local running: {WorkerJob} = {}
+	for i, w in workerjobs do
+		local done, result = w.job:poll((i == 1) and timeout or 0)
+		if done == false then
+			running[#running+1] = w
+		else
+			finished[#finished+1] = {w = w, done = done, result = result}
+		end
+	end
+
+	workerjobs = running
+	workerdeadline = (#running > 0) and (wg.time() + WORKER_POLL) or nil
+	for _, f in finished do
+		if f.done then
+			f.w.callback(f.result, nil)
+		else
+			f.w.callback(nil, f.result)
+		end
+	end
+	if #finished > 0 then
+		FireAsyncEvent("WorkerFinished")
+	end
+end
+
+--- Waits for every worker job to finish, calling back for each.
+
+function FinishWorkers()
+	while #workerjobs > 0 do
+		PollWorkers(1)
 	end
 end
 
@@ -109,3 +585,10 @@ function FlushAsyncEvents()
 		FireEvent(e)
 	end
 end
+
+-- The listeners are counted after everything else which adds to the memory
+-- report, as through their upvalues they reach most of the program.
+AddEventListener("MemoryReport",
+	function(event, token, report)
+		report.add("Event listeners", listeners, deferred, timers, workerjobs)
+	end, nil, 1)
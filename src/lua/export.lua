@@ -1,4 +1,5 @@
 --!nonstrict
+--!native
 -- © 2008 David Given.
 -- WordGrinder is licensed under the MIT open source license. See the COPYING
 -- file in this distribution for the full text.
@@ -6,7 +7,7 @@
 local ITALIC = wg.ITALIC
 local UNDERLINE = wg.UNDERLINE
 local BOLD = wg.BOLD
-local ParseWord = wg.parseword
+local ParseParagraph = wg.parseparagraph
 local bitand = bit32.band
 local bitor = bit32.bor
 local bitxor = bit32.bxor
@@ -14,6 +15,12 @@ local bit = bit32.btest
 local string_lower = string.lower
 local time = wg.time
 local WriteFile = wg.writefile
+local OpenWriter = wg.openwriter
+local ExportDocument = wg.exportdocument
+local TraceBegin = wg.tracebegin
+local TraceEnd = wg.traceend
+local table_concat = table.concat
+local select = select
 
 type Exporter = {
 	prologue: () -> (),
@@ -36,70 +43,196 @@ type Exporter = {
 	underline_off: () -> (),
 }
 
+-- Exporters which render each paragraph from just the paragraph itself and
+-- the style of the one before it can keep what they render in an export
+-- cache, so that exporting the same document again only reruns the
+-- callbacks for paragraphs which have changed. An exporter opts in by
+-- passing its writer through ExportCache() and handing the result to
+-- ExportFileUsingCallbacks() as cb.cache. The key names the exporter and
+-- anything else which affects its output, such as its settings.
+--
+-- Fragments are keyed by the paragraph's hash, its list number and the
+-- previous paragraph's style, so renumbered list items and paragraphs whose
+-- neighbours have changed style are rendered afresh; list_start() and
+-- list_end() are always called. An exporter which carries any other state
+-- from one paragraph to the next must bring it up to date in cb.cached(),
+-- which is called instead of the paragraph callbacks when a fragment is
+-- reused.
+
+type ExportCacheStore = {
+	current: {[string]: string},
+	previous: {[string]: string},
+	size: number, -- bytes of fragments in current
+}
+
+type ExportCache = {
+	writer: (...string) -> (), -- for the exporter to write with
+	write: (...string) -> (), -- the real writer
+	store: ExportCacheStore,
+	recording: {string}?,
+	hits: number,
+	misses: number,
+}
+
+-- Once a cache's fragments reach this size, they become the previous
+-- generation and a new one is started; fragments which are looked up get
+-- moved into the current one, so the ones which aren't used any more are
+-- dropped the time after.
+local EXPORTCACHESIZE = 16*1024*1024
+
+local exportcaches: {[string]: ExportCacheStore} = {}
+
+function ExportCache(key: string, writer: (...string) -> ()): ExportCache
+	local store = exportcaches[key]
+	if not store then
+		local new: ExportCacheStore = { current = {}, previous = {}, size = 0 }
+		exportcaches[key] = new
+		store = new
+	end
+
+	local cache: ExportCache
+	cache = {
+		writer = function(...: string)
+			local r = cache.recording
+			if r then
+				for i = 1, select("#", ...) do
+					r[#r+1] = (select(i, ...))
+				end
+			end
+			writer(...)
+		end,
+		write = writer,
+		store = store,
+		hits = 0,
+		misses = 0,
+	}
+	return cache
+end
+
+function FlushExportCaches()
+	exportcaches = {}
+end
+
+local function storefragment(store: ExportCacheStore, key: string,
+		fragment: string)
+	if (store.size + #fragment) > EXPORTCACHESIZE then
+		store.previous = store.current
+		store.current = {}
+		store.size = 0
+	end
+	store.current[key] = fragment
+	store.size = store.size + #fragment
+end
+
+local function findfragment(store: ExportCacheStore, key: string): string?
+	local fragment = store.current[key]
+	if not fragment then
+		fragment = store.previous[key]
+		if fragment then
+			storefragment(store, key, fragment)
+		end
+	end
+	return fragment
+end
+
 -- Renders the document by calling the appropriate functions on the cb
 -- table.
 
 function ExportFileUsingCallbacks(document: Document, cb: Exporter)
+	FlushDeferredEvents()
 	document:renumber()
 	cb.prologue()
 
 	local listmode: string? = nil
-	local rawmode = false
-	local italic, underline, bold
-	local olditalic, oldunderline, oldbold
-	local firstword
-	local wordbreak
-	local emptyword
-
-	local wordwriter = function (style, text)
-		italic = bit(style, ITALIC)
-		underline = bit(style, UNDERLINE)
-		bold = bit(style, BOLD)
 
-		local writer
-		if rawmode then
-			writer = cb.rawtext
+	-- Styles are turned on in the order italic, bold, underline, and
+	-- recorded as they are, so that they're always turned off in the reverse
+	-- order; a change of style only turns off what it has to (and whatever
+	-- was turned on after that). The paragraph's runs are already as long as
+	-- they can be (see ParseParagraph()), so this is only called where the
+	-- style really changes.
+	local open: {number} = {}
+
+	local function styleon(style: number)
+		if (style == ITALIC) then
+			cb.italic_on()
+		elseif (style == BOLD) then
+			cb.bold_on()
 		else
-			writer = cb.text
+			cb.underline_on()
 		end
+		open[#open+1] = style
+	end
 
-		-- Underline is stopping, so do so *before* the space
-		if wordbreak and not underline and oldunderline then
+	local function styleoff()
+		local style = open[#open]
+		open[#open] = nil
+		if (style == ITALIC) then
+			cb.italic_off()
+		elseif (style == BOLD) then
+			cb.bold_off()
+		else
 			cb.underline_off()
 		end
+	end
 
-		if wordbreak then
-			writer(' ')
-			wordbreak = false
+	local function setstyle(style: number)
+		local keep = 0
+		while (keep < #open) and bit(style, open[keep+1]) do
+			keep = keep + 1
+		end
+		while (#open > keep) do
+			styleoff()
 		end
 
-		if not wordbreak and oldunderline then
-			cb.underline_off()
+		local current = 0
+		for _, s in open do
+			current = bitor(current, s)
 		end
-		if oldbold then
-			cb.bold_off()
+		if bit(style, ITALIC) and not bit(current, ITALIC) then
+			styleon(ITALIC)
 		end
-		if olditalic then
-			cb.italic_off()
+		if bit(style, BOLD) and not bit(current, BOLD) then
+			styleon(BOLD)
 		end
-		if italic then
-			cb.italic_on()
+		if bit(style, UNDERLINE) and not bit(current, UNDERLINE) then
+			styleon(UNDERLINE)
 		end
-		if bold then
-			cb.bold_on()
+	end
+
+	local function render(paragraph: Paragraph)
+		local writer
+		if (paragraph.style == "RAW") then
+			writer = cb.rawtext
+		else
+			writer = cb.text
 		end
-		if underline then
-			cb.underline_on()
+
+		cb.paragraph_start(paragraph)
+
+		if (#paragraph == 1) and (#paragraph[1] == 0) then
+			cb.notext()
+		else
+			local runs = ParseParagraph(paragraph)
+			for i = 1, #runs, 2 do
+				setstyle(runs[i])
+				writer(runs[i+1])
+			end
+			setstyle(0)
 		end
-		writer(text)
 
-		emptyword = false
-		olditalic = italic
-		oldunderline = underline
-		oldbold = bold
+		cb.paragraph_end(paragraph)
 	end
 
-	for _, paragraph in ipairs(document) do
+	-- These are looked up with rawget(), as cb may be a proxy which supplies
+	-- any callback asked for.
+	local cache: ExportCache? = rawget(cb :: any, "cache")
+	local cached: ((Paragraph) -> ())? = rawget(cb :: any, "cached")
+	local previousstyle = ""
+	MaterialiseDocument(document)
+	local count = #document
+	for pn, paragraph in ipairs(document) do
+		TaskCheckpoint(pn / count)
 		local name = paragraph.style
 		local style = documentStyles[name]
 
@@ -112,48 +245,28 @@ function ExportFileUsingCallbacks(document: Document, cb: Exporter)
 			listmode = name
 		end
 
-		rawmode = (name == "RAW")
-
-		cb.paragraph_start(paragraph)
-
-		if (#paragraph == 1) and (#paragraph[1] == 0) then
-			cb.notext()
-		else
-			firstword = true
-			wordbreak = false
-			olditalic = false
-			oldunderline = false
-			oldbold = false
-
-			for wn, word in ipairs(paragraph) do
-				if firstword then
-					firstword = false
-				else
-					wordbreak = true
-				end
-
-				emptyword = true
-				italic = false
-				underline = false
-				bold = false
-				ParseWord(word, 0, wordwriter) -- FIXME
-				if emptyword then
-					wordwriter(0, "")
+		if cache then
+			local key = previousstyle.." "..(paragraph.number or "").." "..
+				paragraph:hash()
+			local fragment = findfragment(cache.store, key)
+			if fragment then
+				cache.hits = cache.hits + 1
+				cache.write(fragment)
+				if cached then
+					cached(paragraph)
 				end
+			else
+				cache.misses = cache.misses + 1
+				local recording = {}
+				cache.recording = recording
+				render(paragraph)
+				cache.recording = nil
+				storefragment(cache.store, key, table_concat(recording))
 			end
-
-			if underline then
-				cb.underline_off()
-			end
-			if bold then
-				cb.bold_off()
-			end
-			if italic then
-				cb.italic_off()
-			end
+		else
+			render(paragraph)
 		end
-
-		cb.paragraph_end(paragraph)
+		previousstyle = name
 	end
 	if listmode then
 		cb.list_end(listmode)
@@ -161,8 +274,31 @@ function ExportFileUsingCallbacks(document: Document, cb: Exporter)
 	cb.epilogue()
 end
 
+-- The text, Markdown and HTML exporters have native implementations (see
+-- export.cc), which do the same as ExportFileUsingCallbacks() with their Lua
+-- callbacks but much faster. The Lua versions are kept here, indexed by
+-- format, as the reference the native ones are tested against.
+
+LuaExporters = {}
+
+-- If a writer (see wg.openwriter()) is given, the output goes straight to
+-- it and nothing is returned.
+
+function ExportDocumentNatively(document: Document, format: string,
+		settings: any?, sink: Writer?): string?
+	local t = TraceBegin("ExportDocumentNatively")
+	FlushDeferredEvents()
+	document:renumber()
+	MaterialiseDocument(document)
+	local result = ExportDocument(document, format, settings, sink)
+	TraceEnd(t)
+	return result
+end
+
 -- Prompts the user to export a document, and then calls
--- exportcb(writer, document) to actually do the work.
+-- exportcb(writer, document, sink) to actually do the work. The output is
+-- streamed to the file as it's written; sink is the wg.openwriter() object
+-- behind the writer function, for exporters which can use it directly.
 
 function ExportFileWithUI(filename, title, extension, callback)
 	if not filename then
@@ -190,16 +326,23 @@ function ExportFileWithUI(filename, title, extension, callback)
 
 	ImmediateMessage("Exporting "..filename.."...")
 
-        local data: {string} = {}
-        local writer = function(...: string)
-                for _, s in ipairs({...}) do
-                        data[#data+1] = s
-                end
-        end
-
-        callback(writer, currentDocument)
+	local sink, e = OpenWriter(filename)
+	if sink then
+		local writer = function(...: string)
+			sink:write(...)
+		end
 
-	local _, e = WriteFile(filename, table.concat(data))
+		local t = TraceBegin("ExportFileWithUI")
+		local ok = RunTask("Exporting "..filename.."...", callback, writer,
+			currentDocument, sink)
+		TraceEnd(t)
+		local _, closeerror = sink:close()
+		e = closeerror
+		if not ok then
+			wg.remove(filename)
+			return false
+		end
+	end
 	if e then
 		ModalMessage(nil, "Unable to open the output file "..e..".")
 		QueueRedraw()
@@ -220,7 +363,9 @@ function ExportToString(document, callback)
 		end
 	end
 
+	local t = TraceBegin("ExportToString")
 	callback(writer, document)
+	TraceEnd(t)
 
 	return table.concat(ss)
 end
@@ -8,12 +8,7 @@ local string_format = string.format
 -----------------------------------------------------------------------------
 -- The exporter itself.
 
-local function unhtml(s)
-	s = s:gsub("&", "&amp;")
-	s = s:gsub("<", "&lt;")
-	s = s:gsub(">", "&gt;")
-	return s
-end
+local unhtml = wg.escapehtml
 
 local style_tab =
 {
@@ -155,13 +150,21 @@ local function callback(writer: (...string) -> (), document)
 	})
 end
 
+LuaExporters.html = callback
+
+local function nativecallback(writer, document, sink)
+	ExportDocumentNatively(document, "html", documentSet.addons.htmlexport,
+		sink)
+end
+
 function Cmd.ExportHTMLFile(filename)
 	return ExportFileWithUI(filename, "Export HTML File", ".html",
-		callback)
+		nativecallback)
 end
 
 function Cmd.ExportToHTMLString()
-	return ExportToString(currentDocument, callback)
+	return ExportDocumentNatively(currentDocument, "html",
+		documentSet.addons.htmlexport)
 end
 
 -----------------------------------------------------------------------------
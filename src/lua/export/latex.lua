@@ -3,25 +3,7 @@
 -- WordGrinder is licensed under the MIT open source license. See the COPYING
 -- file in this distribution for the full text.
 
-local untextab = {
-	["#"] = "\\#",
-	["$"] = "\\$",
-	["&"] = "\\&",
-	["{"] = "\\{",
-	["}"] = "\\}",
-	["_"] = "\\_{}",
-	["^"] = "\\^{}",
-	["~"] = "\\~{}",
-	["%"] = "\\%",
-	["<"] = "$\\langle$",
-	[">"] = "$\\rangle$",
-	["\\"] = "$\\backslash$"
-}
-
-local function untex(s)
-	s = s:gsub("[#$&{}\\_^~%%<>]", untextab)
-	return s
-end
+local untex = wg.escapelatex
 
 local style_tab: {[string]: {string}} =
 {
@@ -40,8 +22,13 @@ local style_tab: {[string]: {string}} =
 }
 
 local function callback(writer: (...string) -> (), document: Document)
+	local cache = ExportCache("latex", writer)
+	writer = cache.writer
+
 	return ExportFileUsingCallbacks(document,
 	{
+		cache = cache,
+
 		prologue = function()
 			writer('%% This document automatically generated by '..
 				'WordGrinder '..VERSION..'.\n')
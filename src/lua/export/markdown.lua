@@ -113,11 +113,18 @@ local function callback(writer, document)
 	})
 end
 
+LuaExporters.markdown = callback
+
+local function nativecallback(writer, document, sink)
+	ExportDocumentNatively(document, "markdown", nil, sink)
+end
+
 function Cmd.ExportMarkdownFile(filename)
-	return ExportFileWithUI(filename, "Export Markdown File", ".md", callback)
+	return ExportFileWithUI(filename, "Export Markdown File", ".md",
+		nativecallback)
 end
 
 function Cmd.ExportToMarkdownString()
-	return ExportToString(currentDocument, callback)
+	return ExportDocumentNatively(currentDocument, "markdown")
 end
 
@@ -4,18 +4,16 @@
 -- file in this distribution for the full text.
 
 local table_concat = table.concat
-local writezip = wg.writezip
+local zipwriter = wg.zipwriter
 local string_format = string.format
 
 -----------------------------------------------------------------------------
 -- The exporter itself.
 
+local EscapeHTML = wg.escapehtml
+
 local function unhtml(s)
-	s = s:gsub("&", "&amp;")
-	s = s:gsub("<", "&lt;")
-	s = s:gsub(">", "&gt;")
-	s = s:gsub("%s", "<text:s/>")
-	return s
+	return EscapeHTML(s, "<text:s/>")
 end
 
 local function emit(s)
@@ -59,6 +57,9 @@ local style_tab: {[string]: {any}} =
 }
 
 local function callback(writer, document)
+	local cache = ExportCache("opendocument", writer)
+	writer = cache.writer
+
 	local settings = documentSet.addons.htmlexport
 	local currentstylename = nil
 	
@@ -87,6 +88,12 @@ local function callback(writer, document)
 		
 	return ExportFileUsingCallbacks(document,
 	{
+		cache = cache,
+
+		cached = function(para)
+			currentstylename = para.style
+		end,
+
 		prologue = function()
 			writer(
 				[[<?xml version="1.0" encoding="UTF-8"?>
@@ -182,19 +189,12 @@ local function export_odt_with_ui(filename, title, extension)
 		end
 	end
 	
-	ImmediateMessage("Exporting...")
-	
-	local content = {}
-	local writer = function(s)
-		content[#content+1] = s
-	end
-	callback(writer, currentDocument)
-	
-	local xml =
+	-- The mimetype must come first and be stored uncompressed.
+	local members =
 	{
-		["mimetype"] = "application/vnd.oasis.opendocument.text",
+		{"mimetype", "application/vnd.oasis.opendocument.text", "store"},
 
-		["META-INF/manifest.xml"] = [[<?xml version="1.0" encoding="UTF-8"?>
+		{"META-INF/manifest.xml", [[<?xml version="1.0" encoding="UTF-8"?>
 			<manifest:manifest xmlns:manifest="urn:oasis:names:tc:opendocument:xmlns:manifest:1.0"> 
 				<manifest:file-entry
 					manifest:media-type="application/vnd.oasis.opendocument.text"
@@ -212,9 +212,9 @@ local function export_odt_with_ui(filename, title, extension)
 					manifest:media-type="text/xml"
 					manifest:full-path="styles.xml"/> 
 			</manifest:manifest>
-		]],
+		]]},
 		
-		["styles.xml"] = [[<?xml version="1.0" encoding="UTF-8"?>
+		{"styles.xml", [[<?xml version="1.0" encoding="UTF-8"?>
 			<office:document-styles office:version="1.0"
 				xmlns:text="urn:oasis:names:tc:opendocument:xmlns:text:1.0"
 				xmlns:fo="urn:oasis:names:tc:opendocument:xmlns:xsl-fo-compatible:1.0"
@@ -348,27 +348,60 @@ local function export_odt_with_ui(filename, title, extension)
                 	</text:list-style>
 				</office:styles>
 			</office:document-styles>
-		]],
+		]]},
 		
-		["settings.xml"] = [[<?xml version="1.0" encoding="UTF-8"?>
+		{"settings.xml", [[<?xml version="1.0" encoding="UTF-8"?>
 			<office:document-settings office:version="1.0"
 				xmlns:office="urn:oasis:names:tc:opendocument:xmlns:office:1.0"/>
-		]],
+		]]},
 		
-		["meta.xml"] = [[<?xml version="1.0" encoding="UTF-8"?>
+		{"meta.xml", [[<?xml version="1.0" encoding="UTF-8"?>
 			<office:document-meta office:version="1.0"
 				xmlns:office="urn:oasis:names:tc:opendocument:xmlns:office:1.0"/>
-		]],
-		
-		["content.xml"] = table.concat(content)
+		]]},
 	}
-	
-	if not writezip(filename, xml) then
+
+	ImmediateMessage("Exporting...")
+
+	local zw = zipwriter(filename)
+	if not zw then
 		ModalMessage(nil, "Unable to open the output file.")
 		QueueRedraw()
 		return false
 	end
-		
+
+	local ok: boolean? = true
+	for _, m in ipairs(members) do
+		ok = ok and zw:begin(m[1], m[3]) and zw:write(m[2])
+	end
+
+	-- content.xml is streamed into the zip file as it's generated, in
+	-- batches to keep the number of calls into the compressor down.
+	ok = ok and zw:begin("content.xml")
+	local buffer = {}
+	local buffersize = 0
+	local function flush()
+		ok = ok and zw:write(table_concat(buffer))
+		buffer = {}
+		buffersize = 0
+	end
+	local writer = function(s)
+		buffer[#buffer+1] = s
+		buffersize = buffersize + #s
+		if buffersize >= 65536 then
+			flush()
+		end
+	end
+	callback(writer, currentDocument)
+	flush()
+
+	ok = zw:close() and ok
+	if not ok then
+		ModalMessage(nil, "Unable to write the output file.")
+		QueueRedraw()
+		return false
+	end
+
 	QueueRedraw()
 	return true
 end
@@ -27,6 +27,9 @@ local style_tab: {[string]: {any}} =
 }
 
 local function callback(writer: (...string) -> (), document: Document)
+	local cache = ExportCache("org", writer)
+	writer = cache.writer
+
 	local currentpara = nil
 
 	function changepara(newpara)
@@ -53,6 +56,12 @@ local function callback(writer: (...string) -> (), document: Document)
 
 	return ExportFileUsingCallbacks(document,
 	{
+		cache = cache,
+
+		cached = function(para)
+			currentpara = para.style
+		end,
+
 		prologue = function()
 			writer('#+TITLE: ', document.name, '\n')
 		end,
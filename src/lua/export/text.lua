@@ -56,12 +56,18 @@ local function callback(writer, document)
 	})
 end
 
+LuaExporters.text = callback
+
+local function nativecallback(writer, document, sink)
+	ExportDocumentNatively(document, "text", nil, sink)
+end
+
 function Cmd.ExportTextFile(filename)
 	return ExportFileWithUI(filename, "Export Text File", ".txt",
-		callback)
+		nativecallback)
 end
 
 function Cmd.ExportToTextString(document)
 	document = document or currentDocument
-	return ExportToString(document, callback)
+	return ExportDocumentNatively(document, "text")
 end
@@ -3,11 +3,7 @@
 -- WordGrinder is licensed under the MIT open source license. See the COPYING
 -- file in this distribution for the full text.
 
-local NextCharInWord = wg.nextcharinword
-local ReadU8 = wg.readu8
-local string_len = string.len
-local string_char = string.char
-local string_format = string.format
+local EscapeTroff = wg.escapetroff
 local string_gsub = string.gsub
 
 local style_tab: {[string]: string} =
@@ -27,6 +23,9 @@ local style_tab: {[string]: string} =
 }
 
 local function callback(writer, document)
+	local cache = ExportCache("troff", writer)
+	writer = cache.writer
+
 	local currentstyle = nil
 	local ul = false
 	local it = false
@@ -48,24 +47,7 @@ local function callback(writer, document)
 			linestart = false
 		end
 		
-		if embedded then
-			s = string_gsub(s, '"', '\\"')
-		end
-
-		s = string_gsub(s, '\\', '\\\\')
-		
-		local o: number? = 1
-		local n = string_len(s)
-		
-		while o and (o <= n) do
-			local c = ReadU8(s, o)
-			o = NextCharInWord(s, o)
-			if (c < 127) then
-				writer(string_char(c))
-			else
-				writer(string_format('\\[u%04X]', c))
-			end
-		end
+		writer(EscapeTroff(s, embedded))
 	end
 	
 	local function changestate(newit, newul, newbf)
@@ -103,6 +85,14 @@ local function callback(writer, document)
 	
 	return ExportFileUsingCallbacks(document,
 	{
+		cache = cache,
+
+		-- Every paragraph ends at the start of a line with no styles on.
+		cached = function(para)
+			currentstyle = para.style
+			linestart = true
+		end,
+
 		prologue = function()
 			writer('.\\" This document automatically generated by '..
 				'WordGrinder '..VERSION..'.\n')
@@ -1,19 +1,33 @@
 --!nonstrict
+--!native
 -- © 2008 David Given.
 -- WordGrinder is licensed under the MIT open source license. See the COPYING
 -- file in this distribution for the full text.
 
 local ParseWord = wg.parseword
 local WriteFile = wg.writefile
+local SaveObjectToString = wg.savetostring
+local SaveObjectToFile = wg.savedocumentset
+local LoadObjectFromString = wg.loadfromstring
+local LoadObjectFromCompressed = wg.loadfromcompressed
+local LoadObjectFromWordTable = wg.loadfromwordtable
+local LoadObjectFromLegacy = wg.loadfromlegacy
+local LoadHeader = wg.loadheader
+local MapFile = wg.mapfile
+local ReadFile = wg.readfile
+local AppendFile = wg.appendfile
+local Stat = wg.stat
+local StartSave = wg.startsave
+local PollSave = wg.pollsave
+local TraceBegin = wg.tracebegin
+local TraceEnd = wg.traceend
 local bitand = bit32.band
 local bitor = bit32.bor
 local bitxor = bit32.bxor
 local bit = bit32.btest
 local time = wg.time
 local compress = wg.compress
-local decompress = wg.decompress
 local writeu8 = wg.writeu8
-local readu8 = wg.readu8
 local escape = wg.escape
 local unescape = wg.unescape
 local string_format = string.format
@@ -22,545 +36,694 @@ local unpack = rawget(_G, "unpack") or table.unpack
 local MAGIC = "WordGrinder dumpfile v1: this is not a text file!"
 local ZMAGIC = "WordGrinder dumpfile v2: this is not a text file!"
 local TMAGIC = "WordGrinder dumpfile v3: this is a text file; diff me!"
+local CMAGIC = "WordGrinder dumpfile v4: this is not a text file!"
+local WMAGIC = "WordGrinder dumpfile v5: this is not a text file!"
+local JMAGIC = "WordGrinder journal v1: base size "
+local SMAGIC = "WordGrinder autosave manifest v1: this is not a text file!"
 
-local STOP = 0
-local TABLE = 1
-local BOOLEANTRUE = 2
-local BOOLEANFALSE = 3
-local STRING = 4
-local NUMBER = 5
-local CACHE = 6
-local NEGNUMBER = 7
-local BRIEFWORD = 8
-
-local DOCUMENTSETCLASS = 100
-local DOCUMENTCLASS = 101
-local PARAGRAPHCLASS = 102
-local WORDCLASS = 103
-local MENUCLASS = 104
-
-local function writetostreamt(object, write)
-	local writeo = function(k, v)
-		write(k)
-		write(": ")
-		write(v)
-		write("\n")
-	end
-
-	local function save(key: string, t: any)
-		if (type(t) == "table") then
-			local m = GetClass(t)
-			if (m ~= Paragraph) and (key ~= ".current") then
-				for k, i in ipairs(t) do
-					save(key.."."..k, i)
-				end
+-- The v3 writer lives in C (see dumpfile.cc) as walking every word of a
+-- big document in Lua is far too slow.
 
-				-- Save the keys in alphabetical order, so we get repeatable
-				-- files.
-				local keys = {}
-				for k in pairs(t) do
-					if (type(k) ~= "number") then
-						if not k:find("^_") then
-							keys[#keys+1] = k
-						end
-					end
-				end
-				table.sort(keys)
+function SaveToString(object)
+	return SaveObjectToString(object)
+end
 
-				for _, k in ipairs(keys) do
-					save(key.."."..k, t[k])
-				end
-			end
-		elseif (type(t) == "boolean") then
-			writeo(key, tostring(t))
-		elseif (type(t) == "string") then
-			writeo(key, '"'..escape(t)..'"')
-		elseif (type(t) == "number") then
-			writeo(key, tostring(t))
-		else
-			error(string.format("unsupported type %s for key %s", type(t), key))
-		end
-	end
+-- The object is written as text unless format says otherwise (true means
+-- "compressed"). The other formats only work for DocumentSets: "compressed"
+-- is v4, with each document compressed separately, and "wordtable" is v5,
+-- with each distinct word stored once (see dumpfile.cc).
+
+function SaveToFile(filename: string, object: any,
+		format: (boolean | SaveFormat)?): (boolean, string?)
+	-- The file is written to a *different* filename, synced and then renamed
+	-- over the old one, so crashes during writing don't corrupt it (see
+	-- writefileatomically() in filesystem.cc).
+
+	local t = TraceBegin("SaveToFile")
+	local r, e = SaveObjectToFile(filename, object, format)
+	TraceEnd(t)
+	return r or false, e
+end
 
-	local function save_document(i, d)
-		write("#")
-		write(tostring(i))
-		write("\n")
+-- Returns the format the current document set should be saved in.
 
-		for _, p in ipairs(d) do
-			write(p.style)
+function GetSaveFormat(): SaveFormat
+	local settings = documentSet.addons.fileformat
+	if settings and settings.wordtable then
+		return "wordtable"
+	elseif settings and settings.compressed then
+		return "compressed"
+	end
+	return "text"
+end
 
-			for _, s in ipairs(p) do
-				write(" ")
-				write(s)
-			end
+function SaveDocumentSetRaw(filename): (boolean?, string?)
+	return SaveToFile(filename, documentSet, GetSaveFormat())
+end
 
-			write("\n")
-		end
+-----------------------------------------------------------------------------
+-- Background saves. The object is serialised immediately (so later edits
+-- don't affect what gets written), but the disk I/O happens on a worker
+-- thread so the user can carry on typing. Progress is reported via the
+-- async BackgroundSave event; callback is called once the file is on disk.
+
+type BackgroundSave = {
+	filename: string,
+	written: number,
+	total: number,
+	callback: (boolean, string?) -> (),
+}
+
+local backgroundsave: BackgroundSave? = nil
+
+local function pollbackgroundsave(wait: boolean?): (boolean, string?)
+	local s = backgroundsave
+	if not s then
+		return true
+	end
 
-		write(".")
-		write("\n")
+	local finished, written, total, e = PollSave(wait)
+	s.written = written
+	s.total = total
+	FireAsyncEvent("BackgroundSave")
+	if not finished then
+		return true
 	end
 
-	save("", object)
+	backgroundsave = nil
+	s.callback(not e, e)
+	return not e, e
+end
 
-	local class = GetClass(object)
-	if class == DocumentSet then
-		if object.current then
-			save(".current", object:_findDocument(object.current.name))
-		end
+function SaveToFileInBackground(filename: string, object: any,
+		callback: (boolean, string?) -> (), format: (boolean | SaveFormat)?)
+	FinishBackgroundSave()
+
+	local total = StartSave(filename, object, format)
+	backgroundsave = {
+		filename = filename,
+		written = 0,
+		total = total,
+		callback = callback,
+	}
+end
+
+-- Returns the save in progress, if there is one.
+
+function GetBackgroundSave(): BackgroundSave?
+	return backgroundsave
+end
+
+-- Blocks until any save in progress is on disk. Returns false and the error
+-- if it failed.
 
-		for i, d in ipairs(object.documents) do
-			save_document(i, d)
+function FinishBackgroundSave(): (boolean, string?)
+	return pollbackgroundsave(true)
+end
+
+do
+	local function cb()
+		pollbackgroundsave()
+		if backgroundsave then
+			-- Keep checking until it's finished.
+			RequestIdle(IDLE_TIME)
 		end
 	end
 
-	return true
+	AddEventListener("WaitingForUser", cb)
+	AddEventListener("Idle", cb)
 end
 
-function SaveToString(object)
-	local ss = {}
-	local write = function(s)
-		ss[#ss+1] = s
+do
+	local function cb()
+		local s = backgroundsave
+		if s and (s.total > 0) then
+			NonmodalMessage(string_format("Saving... %d%%",
+				(s.written * 100) // s.total))
+		end
 	end
 
-	writetostreamt(object, write)
-	return table.concat(ss)
+	AddEventListener("BackgroundSave", cb)
 end
 
-function SaveToFile(filename: string, object: any): (boolean, string?)
-	-- Write the file to a *different* filename (so that crashes during
-	-- writing doesn't corrupt the file).
+-----------------------------------------------------------------------------
+-- Journals. Rather than rewriting the whole document set, the journal
+-- autosave mode appends the paragraphs which have changed since the last
+-- full save to a sidecar file next to the document. Each record replaces a
+-- range of paragraphs in one document:
+--
+--   #<document index> <first paragraph> <number of paragraphs deleted>
+--   <style> <word> <word>...
+--   .
+--
+-- Changes are found by comparing the document against a snapshot of its
+-- paragraph array; as paragraphs are immutable, identity is enough. The
+-- journal is only valid against the exact file it was started on, so the
+-- header records its size; a journal for anything else is ignored.
+
+local function journalfilename(filename: string): string
+	return filename..".journal"
+end
 
-	local s = TMAGIC .. "\n" .. SaveToString(object)
+-- Lazy documents are recorded as false; when they're materialised they get
+-- a snapshot of what was loaded.
 
-	local new_filename = filename..".new"
-	local _, e = WriteFile(new_filename, s)
-	if e then
-		return false, e
+local function snapshot(document: Document): {Paragraph} | false
+	if IsLazyDocument(document) then
+		return false
 	end
+	return table.move(document, 1, #document, 1, {})
+end
 
-	-- At this point, we know the new file has been written correctly.
-	-- We can remove the old one and rename the new one to be the old
-	-- one. On proper operating systems we could do this in a single
-	-- os.rename, but Windows doesn't support clobbering renames.
-
-	wg.remove(filename)
-	local r, e = wg.rename(new_filename, filename)
-	if e then
-		-- Yikes! The old file has gone, but we couldn't rename the new
-		-- one...
-		return r, e..": the filename of your document has changed"
+-- Makes the current state of the document set the base the journal is
+-- relative to. Call this after the document set has been written to (or
+-- read from) filename in full.
+
+function ResetJournal(filename: string, started: boolean?): Journal
+	local st = Stat(filename)
+	local names = {}
+	local snapshots: {{Paragraph} | false} = {}
+	for i, d in documentSet.documents do
+		names[i] = d.name
+		snapshots[i] = snapshot(d)
 	end
-	return r, e
+
+	local j = {
+		filename = filename,
+		basesize = st and st.size or 0,
+		started = started or false,
+		names = names,
+		snapshots = snapshots,
+	}
+	documentSet._journal = j
+	return j
 end
 
-function SaveDocumentSetRaw(filename): (boolean?, string?)
-	return SaveToFile(filename, documentSet)
+-- Throws away the journal, and stops journalling until the next full save.
+
+function DiscardJournal()
+	local j = documentSet._journal
+	if j then
+		wg.remove(journalfilename(j.filename))
+		documentSet._journal = nil
+	end
 end
 
-function Cmd.SaveCurrentDocumentAs(filename: string?): boolean
-	if not filename then
-		filename = FileBrowser("Save Document Set", "Save as:", true)
-		if not filename then
+-- Appends any changes since the last call to the journal. Returns false
+-- with no error if the changes can't be journalled (e.g. documents have been
+-- added or renamed), in which case a full save is needed.
+
+function AppendToJournal(): (boolean, string?)
+	local j = documentSet._journal
+	if not j or (j.filename ~= documentSet.name) then
+		return false
+	end
+	local basesize = j.basesize
+	if not basesize then
+		-- The base file is still being written; try again later.
+		return true
+	end
+
+	local documents = documentSet.documents
+	if #documents ~= #j.names then
+		return false
+	end
+	for i, d in documents do
+		if d.name ~= j.names[i] then
 			return false
 		end
-		assert(filename)
-		if filename:find("/[^.]*$") then
-			filename = filename .. ".wg"
-		end
 	end
-	assert(filename)
-	documentSet.name = filename
 
-	ImmediateMessage("Saving...")
-	documentSet:clean()
-	local r, e = SaveDocumentSetRaw(documentSet.name)
-	if not r then
-		assert(e)
-		ModalMessage("Save failed", "The document could not be saved: "..e)
-	else
-		NonmodalMessage("Save succeeded.")
-	end
-	return assert(r)
-end
+	local ss = {}
 
-function Cmd.SaveCurrentDocument()
-	local name: string? = documentSet.name
-	if not name then
-		name = FileBrowser("Save Document Set", "Save as:", true)
-		if not name then
-			return false
+	for i, d in documents do
+		local old: any = j.snapshots[i]
+		if not old then
+			if IsLazyDocument(d) then
+				continue
+			end
+			old = (d::any)._dumpsnapshot
 		end
-		assert(name)
-		if name:find("/[^.]*$") then
-			name = name .. ".wg"
+		local n = #old
+		local m = #d
+
+		local s = 1
+		while (s <= n) and (s <= m) and rawequal(old[s], d[s]) do
+			s = s + 1
+		end
+		local e = 0
+		while (e <= (n-s)) and (e <= (m-s)) and rawequal(old[n-e], d[m-e]) do
+			e = e + 1
+		end
+
+		if ((s+e) <= n) or ((s+e) <= m) then
+			ss[#ss+1] = string_format("#%d %d %d\n", i, s, n-e-s+1)
+			for pn = s, m-e do
+				local p = d[pn]
+				ss[#ss+1] = p.style.." "..p:join().."\n"
+			end
+			ss[#ss+1] = ".\n"
+			j.snapshots[i] = snapshot(d)
 		end
-		documentSet.name = name
 	end
-	assert(name)
 
-	return Cmd.SaveCurrentDocumentAs(name)
+	if (#ss == 0) then
+		return true
+	end
+	if not j.started then
+		table.insert(ss, 1, string_format("%s%d\n", JMAGIC, basesize))
+	end
+
+	local data = table.concat(ss)
+	local _, e
+	if j.started then
+		_, e = AppendFile(journalfilename(j.filename), data)
+	else
+		_, e = WriteFile(journalfilename(j.filename), data)
+	end
+	if e then
+		return false, e
+	end
+	j.started = true
+	return true
 end
 
-local function loadfromstream(fp): DocumentSet
-	type Value = {[number]: any, text: string?}
-	local cache: {any} = {}
-	local load
+-- Applies the journal for filename, if there is a valid one, to the
+-- (just loaded) current document set. A torn record at the end of the file
+-- (from a crash mid-write) is ignored. Returns true if anything changed.
 
-	local function populate_table(t)
-		local n = assert(tonumber(fp:read("*l")))
-		for i = 1, n do
-			t[i] = load()
+function ReplayJournal(filename: string): boolean
+	local data = ReadFile(journalfilename(filename))
+	local st = Stat(filename)
+	if not data or not st then
+		return false
+	end
+
+	local fp = CreateIStream(data)
+	if (fp:read("*l") ~= string_format("%s%d", JMAGIC, st.size)) then
+		return false
+	end
+
+	local replayed = false
+	while true do
+		local line = fp:read("*l")
+		if not line then
+			break
+		end
+		local _, _, di, ps, pn = line:find("^#(%d+) (%d+) (%d+)$")
+		local document = di and documentSet.documents[tonumber(di)::number]
+		if not document then
+			break
+		end
+		local s = tonumber(ps)::number
+		local n = tonumber(pn)::number
+		local len = #document
+		if ((s+n-1) > len) then
+			break
 		end
 
+		local paragraphs = {}
+		local complete = false
 		while true do
-			local k = load()
-			if not k then
+			local line = fp:read("*l")
+			if not line then
 				break
 			end
-
-			t[k] = load()
-		end
-
-		return t
-	end
-
-	local load_cb = {
-		["DS"] = function()
-			local t: any = {}
-			setmetatable(t, DocumentSet)
-			cache[#cache + 1] = t
-			return populate_table(t)
-		end,
-
-		["D"] = function()
-			local t: any = {}
-			setmetatable(t, Document)
-			cache[#cache + 1] = t
-			return populate_table(t)
-		end,
-
-		["P"] = function()
-			local t: any = {}
-			setmetatable(t, Paragraph)
-			cache[#cache + 1] = t
-			return populate_table(t)
-		end,
-
-		["W"] = function()
-			-- Words used to be objects of their own; they've been replaced
-			-- with simple strings.
-			local t: any = {}
-
-			-- Ensure we allocate a cache entry *before* calling
-			-- populate_table(), or else the numbers will go all wrong; the
-			-- original implementation put t here.
-			local cn = #cache + 1
-			cache[cn] = {}
-
-			populate_table(t)
-
-			cache[cn] = t.text
-			return t.text
-		end,
-
-		["M"] = function()
-			local t: any = {}
-			setmetatable(t, MenuTree)
-			cache[#cache + 1] = t
-			return populate_table(t)
-		end,
-
-		["T"] = function()
-			local t: any = {}
-			cache[#cache + 1] = t
-			return populate_table(t)
-		end,
-
-		["S"] = function()
-			local s = fp:read("*l")
-			cache[#cache + 1] = s
-			return s
-		end,
-
-		["N"] = function()
-			local n = tonumber(fp:read("*l"))
-			cache[#cache + 1] = n
-			return n
-		end,
-
-		["B"] = function()
-			local s = fp:read("*l")
-			s = (s == "T")
-			cache[#cache + 1] = s
-			return s
-		end,
-
-		["."] = function()
-			return nil
+			if (line == ".") then
+				complete = true
+				break
+			end
+			local _, _, style, words = line:find("^([^ ]+) (.*)$")
+			if not style then
+				break
+			end
+			paragraphs[#paragraphs+1] = CreateParagraph(style,
+				SplitString(words, " "))
 		end
-	}
-
-	load = function()
-		local s = fp:read("*l")
-		if not s then
-			error("unexpected EOF when reading file")
+		if not complete or ((len - n + #paragraphs) == 0) then
+			break
 		end
 
-		local n = tonumber(s)
-		if n then
-			return cache[n]
+		local tail = table.move(document, s+n, len, 1, {})
+		for i = len, s, -1 do
+			document[i] = nil
 		end
+		table.move(paragraphs, 1, #paragraphs, s, document)
+		table.move(tail, 1, #tail, s+#paragraphs, document)
+		replayed = true
+	end
 
-		local f = load_cb[s]
-		if not f then
-			error("can't load type "..s)
+	if replayed then
+		for _, d in documentSet.documents do
+			if IsLazyDocument(d) then
+				continue
+			end
+			if (d.cp > #d) then
+				d.cp = #d
+			end
+			if (d.cw > #d[d.cp]) then
+				d.cw = 1
+				d.co = 1
+			end
+			d.mp = nil
 		end
-		return f()
 	end
-
-	return load()
+	return replayed
 end
 
-local function loadfromstreamz(fp): DocumentSet
-	local cache: {any} = {}
-	local load
-	local data = decompress(fp:read("*a"))
-	local offset = 1
+-----------------------------------------------------------------------------
+-- Autosave stores. Rather than writing out a full copy of the document set
+-- each time, the store autosave mode keeps every paragraph it has saved in
+-- a pack file shared by all of a document set's autosaves, once each, by
+-- its hash (see Paragraph.hash()). The pack is only ever appended to:
+--
+--   <hash> <style> <word> <word>...
+--
+-- Each autosave is then a manifest naming the pack (which lives in the same
+-- directory) and listing the hashes of each document's paragraphs, followed
+-- by the rest of the document set in the text format with the documents
+-- left empty:
+--
+--   <SMAGIC>
+--   <pack leafname>
+--   #<number of paragraphs>
+--   <hash>
+--   ...
+--   .
+--   <document set>
+--
+-- So an autosave only costs the paragraphs which have never been saved
+-- before, plus the manifest. Manifests load with LoadFromFile() like any
+-- other file.
+
+type PackIndex = {
+	size: number, -- of the pack file when last looked at
+	records: {[string]: number}, -- length of each paragraph's record
+}
+
+local packs: {[string]: PackIndex} = {}
+
+-- Finds out what's in a pack. A torn record at the end (from a crash
+-- mid-write) is cut off, so the next append starts on a fresh line.
+
+local function readpack(packname: string): (PackIndex?, string?)
+	local index = packs[packname]
+	local st = Stat(packname)
+	local size = st and st.size or 0
+	if index and (index.size == size) then
+		return index
+	end
 
-	local function populate_table(t)
-		local n
-		n, offset = readu8(data, offset)
-		for i = 1, n do
-			t[i] = load()
+	local records = {}
+	if (size > 0) then
+		local data, e = ReadFile(packname)
+		if not data then
+			return nil, e
 		end
-
+		local offset = 1
 		while true do
-			local k = load()
-			if not k then
+			local e = data:find("\n", offset, true)
+			if not e then
 				break
 			end
+			records[data:sub(offset, offset+15)] = e - offset + 1
+			offset = e + 1
+		end
+		if (offset <= #data) then
+			local _, e = WriteFile(packname, data:sub(1, offset-1))
+			if e then
+				return nil, e
+			end
+			size = offset - 1
+		end
+	end
 
-			t[k] = load()
-		end
-
-		return t
-	end
-
-	local load_cb = {
-		[CACHE] = function()
-			local n
-			n, offset = readu8(data, offset)
-			return cache[n]
-		end,
-
-		[DOCUMENTSETCLASS] = function()
-			local t: any = {}
-			setmetatable(t, DocumentSet)
-			cache[#cache + 1] = t
-			return populate_table(t)
-		end,
-
-		[DOCUMENTCLASS] = function()
-			local t: any = {}
-			setmetatable(t, Document)
-			cache[#cache + 1] = t
-			return populate_table(t)
-		end,
-
-		[PARAGRAPHCLASS] = function()
-			local t: any = {}
-			setmetatable(t, Paragraph)
-			cache[#cache + 1] = t
-			return populate_table(t)
-		end,
-
-		[WORDCLASS] = function()
-			-- Words used to be objects of their own; they've been replaced
-			-- with simple strings.
-			local t: any = {}
-
-			-- Ensure we allocate a cache slot *before* calling populate_table,
-			-- or else the numbers all go wrong.
-			local cn = #cache + 1
-			cache[cn] = {}
-
-			populate_table(t)
-
-			cache[cn] = t.text
-			return t.text
-		end,
-
-		[BRIEFWORD] = function()
-			-- Words used to be objects of their own; they've been replaced
-			-- with simple strings.
-
-			local t: any = load()
-			cache[#cache+1] = t
-			return t
-		end,
-
-		[MENUCLASS] = function()
-			local t: any = {}
-			setmetatable(t, MenuTree)
-			cache[#cache + 1] = t
-			return populate_table(t)
-		end,
-
-		[TABLE] = function()
-			local t: any = {}
-			cache[#cache + 1] = t
-			return populate_table(t)
-		end,
-
-		[STRING] = function()
-			local n
-			n, offset = readu8(data, offset)
-			local s = data:sub(offset, offset+n-1)
-			offset = offset + n
-
-			cache[#cache + 1] = s
-			return s
-		end,
-
-		[NUMBER] = function()
-			local n
-			n, offset = readu8(data, offset)
-			cache[#cache + 1] = n
-			return n
-		end,
-
-		[NEGNUMBER] = function()
-			local n
-			n, offset = readu8(data, offset)
-			n = -n
-			cache[#cache + 1] = n
-			return n
-		end,
-
-		[BOOLEANTRUE] = function()
-			cache[#cache + 1] = true
-			return true
-		end,
+	local new: PackIndex = { size = size, records = records }
+	packs[packname] = new
+	return new
+end
 
-		[BOOLEANFALSE] = function()
-			cache[#cache + 1] = false
-			return false
-		end,
+local function packrecord(p: Paragraph): string
+	return p:hash().." "..p.style.." "..p:join().."\n"
+end
 
-		[STOP] = function()
-			return nil
-		end
-	}
+-- Writes the document set as a manifest to filename, adding any paragraphs
+-- the pack hasn't got to it first.
 
-	load = function()
-		local n
-		n, offset = readu8(data, offset)
+function SaveToStore(filename: string, packname: string,
+		ds: DocumentSet): (boolean, string?)
+	local index, e = readpack(packname)
+	if not index then
+		return false, e
+	end
+	local records = index.records
+
+	local manifest = { SMAGIC, "\n", Leafname(packname), "\n" }
+	local added: {string} = {}
+	local addedlengths: {[string]: number} = {}
+	local skeletons = {}
+	local current = nil
+	for i, d in ds.documents do
+		if IsLazyDocument(d) then
+			MaterialiseDocument(d)
+		end
+		manifest[#manifest+1] = string_format("#%d\n", #d)
+		for _, p in ipairs(d) do
+			local h = p:hash()
+			if not records[h] and not addedlengths[h] then
+				local r = packrecord(p)
+				added[#added+1] = r
+				addedlengths[h] = #r
+			end
+			manifest[#manifest+1] = h
+			manifest[#manifest+1] = "\n"
+		end
 
-		local f = load_cb[n]
-		if not f then
-			error("can't load type "..n.." at offset "..offset)
+		local skeleton = setmetatable({}, getmetatable(d :: any))
+		for k, v in pairs(d) do
+			if (typeof(k) == "string") then
+				skeleton[k] = v
+			end
+		end
+		skeletons[i] = skeleton
+		if (d == ds.current) then
+			current = skeleton
+		end
+	end
+	manifest[#manifest+1] = ".\n"
+
+	local dsskeleton = setmetatable(table.clone(ds :: any),
+		getmetatable(ds :: any))
+	dsskeleton.documents = skeletons
+	dsskeleton.current = current
+	manifest[#manifest+1] = SaveToString(dsskeleton)
+
+	if (#added > 0) then
+		local _, e = AppendFile(packname, table.concat(added))
+		if e then
+			packs[packname] = nil
+			return false, e
+		end
+		for h, n in addedlengths do
+			records[h] = n
+			index.size = index.size + n
 		end
-		return f()
 	end
 
-	return load()
+	local _, e = WriteFile(filename..".new", table.concat(manifest))
+	if not e then
+		_, e = wg.rename(filename..".new", filename)
+	end
+	if e then
+		return false, e
+	end
+	return true
 end
 
-local function loadfromstreamt(fp): DocumentSet
-	local data = CreateDocumentSet()
-	data.menu = CreateMenuTree()
-	data.documents = {}
+-- Reads the hashes from a manifest, as a list for each document, and the
+-- offset of the document set after them.
 
-	local function readl(): string?
-		local s = fp:read("*l")
-		if s then
-			return s:gsub("\r", "")
-		end
+local function readmanifest(data: any, offset: number)
+		: ({{string}}?, string?, number?)
+	local e = data:find("\n", offset, true)
+	if not e then
 		return nil
 	end
+	local packleaf = data:sub(offset, e-1)
+	offset = e + 1
 
+	local documents = {}
 	while true do
-		local line = readl()
-		if not line then
+		e = data:find("\n", offset, true)
+		if not e then
+			return nil
+		end
+		local line = data:sub(offset, e-1)
+		offset = e + 1
+		if (line == ".") then
 			break
 		end
-		assert(line)
+		local n = tonumber(line:match("^#(%d+)$"))
+		if not n then
+			return nil
+		end
+		local hashes = table.create(n)
+		for i = 1, n do
+			hashes[i] = data:sub(offset, offset+15)
+			offset = offset + 17
+		end
+		documents[#documents+1] = hashes
+	end
+	return documents, packleaf, offset
+end
 
-		if line:find("^%.") then
-			local s, _, k: any, p: any, v: any
-				= line:find("^(.*)%.([^.:]+): (.*)$")
-			if not s then
-				error(
-					string.format("malformed line when reading file: '%s'", line))
-			end
+-- Rewrites the pack with only the paragraphs which the given manifests
+-- use, if that would get rid of more than it keeps.
 
-			-- This is setting a property value.
-			local o: any = data
-			for e in k:gmatch("[^.]+") do
-				local en: any = e
-				if e:find('^[0-9]+$') then
-					en = assert(tonumber(e))
-				end
-				if not o[en] then
-					if (o == data.documents) then
-						o[en] = CreateDocument()
-					else
-						o[en] = {}
-					end
+function CompactStore(packname: string, manifests: {string})
+		: (boolean, string?)
+	local index, e = readpack(packname)
+	if not index then
+		return false, e
+	end
+
+	local live = {}
+	local livesize = 0
+	for _, filename in manifests do
+		local data = ReadFile(filename)
+		local documents = nil
+		if data and (data:sub(1, #SMAGIC) == SMAGIC) then
+			documents = readmanifest(data, #SMAGIC + 2)
+		end
+		if not documents then
+			-- Something we don't understand; keep everything.
+			return true
+		end
+		for _, hashes in documents do
+			for _, h in hashes do
+				if not live[h] then
+					live[h] = true
+					livesize = livesize + (index.records[h] or 0)
 				end
-				o = o[en]
 			end
+		end
+	end
+	if (livesize*2 >= index.size) then
+		return true
+	end
 
-			if v:find('^-?[0-9][0-9.e+-]*$') then
-				v = tonumber(v)
-			elseif (v == "true") then
-				v = true
-			elseif (v == "false") then
-				v = false
-			elseif v:find('^".*"$') then
-				v = v:sub(2, -2)
-				v = unescape(v)
-			else
-				error(
-					string.format("malformed property %s.%s: %s", k, p, v))
-			end
+	local pack, e = ReadFile(packname)
+	if not pack then
+		return false, e
+	end
+	local kept = {}
+	local records = {}
+	local offset = 1
+	while true do
+		local e = pack:find("\n", offset, true)
+		if not e then
+			break
+		end
+		local h = pack:sub(offset, offset+15)
+		if live[h] and not records[h] then
+			kept[#kept+1] = pack:sub(offset, e)
+			records[h] = e - offset + 1
+		end
+		offset = e + 1
+	end
 
-			if p:find('^[0-9]+$') then
-				p = tonumber(p)
-			end
+	local data = table.concat(kept)
+	local _, e = WriteFile(packname..".new", data)
+	if not e then
+		_, e = wg.rename(packname..".new", packname)
+	end
+	if e then
+		return false, e
+	end
+	packs[packname] = { size = #data, records = records }
+	return true
+end
+
+function Cmd.SaveCurrentDocumentAs(filename: string?): boolean
+	if not filename then
+		filename = FileBrowser("Save Document Set", "Save as:", true)
+		if not filename then
+			return false
+		end
+		assert(filename)
+		if filename:find("/[^.]*$") then
+			filename = filename .. ".wg"
+		end
+	end
+	assert(filename)
+	documentSet.name = filename
+
+	ImmediateMessage("Saving...")
+	FlushDeferredEvents()
+	documentSet:clean()
 
-			o[p] = v
-		elseif line:find("^#") then
-			local id = line:sub(2)
-			local doc: Document
-			if id == "clipboard" then
-				doc = assert(data.clipboard)
+	-- The journal restarts from what's being saved, but there's nothing to
+	-- journal against until the file is actually on disk.
+
+	local oldjournal = documentSet._journal
+	local journal = ResetJournal(filename)
+	journal.basesize = nil
+
+	local ds = documentSet
+	SaveToFileInBackground(filename, documentSet,
+		function(r: boolean, e: string?)
+			if not r then
+				ModalMessage("Save failed", "The document could not be saved: "..
+					assert(e))
+				ds:touch()
+				if ds._journal == journal then
+					ds._journal = nil
+				end
 			else
-				local n = assert(tonumber(id))
-				doc = data.documents[n]
+				-- The file now contains everything the old journal did.
+				if oldjournal then
+					wg.remove(journalfilename(oldjournal.filename))
+				end
+				wg.remove(journalfilename(filename))
+				local st = Stat(filename)
+				journal.basesize = st and st.size or 0
+				FireEvent("DocumentSaved", filename)
+				NonmodalMessage("Save succeeded.")
 			end
+		end, GetSaveFormat())
+	return true
+end
 
-			local index = 1
-			while true do
-				line = readl()
-				if not line or (line == ".") then
-					break
-				end
+function Cmd.SaveCurrentDocument()
+	local name: string? = documentSet.name
+	if not name then
+		name = FileBrowser("Save Document Set", "Save as:", true)
+		if not name then
+			return false
+		end
+		assert(name)
+		if name:find("/[^.]*$") then
+			name = name .. ".wg"
+		end
+		documentSet.name = name
+	end
+	assert(name)
+
+	return Cmd.SaveCurrentDocumentAs(name)
+end
 
-				local words = SplitString(line, " ")
-				local para = CreateParagraph(unpack(words))
+-- The parsers themselves all live in C (see dumpfile.cc); this just does
+-- the fixups afterwards.
 
-				doc[index] = para
-				index = index + 1
-			end
-		elseif line == "" then
-			-- Just ignore these.
-		else
-			error(
-				string.format("malformed line when reading file: '%s'", line))
-		end
+local function loadfromstringt(s: string | MappedFile, offset: number,
+		format: SaveFormat?): DocumentSet
+	local data: DocumentSet
+	if format == "compressed" then
+		data = LoadObjectFromCompressed(s, offset)
+	elseif format == "wordtable" then
+		data = LoadObjectFromWordTable(s, offset)
+	else
+		data = LoadObjectFromString(s, offset)
 	end
 
 	-- Bugfix: previously, the document metadata was written twice to the file,
@@ -591,35 +754,241 @@ local function loadfromstreamt(fp): DocumentSet
 end
 
 function LoadFromString(s)
-	return loadfromstreamt(CreateIStream(s))
+	return loadfromstringt(s, 1)
 end
 
-function LoadFromFile(filename): (DocumentSet?, string?)
-	local data, _, e = wg.readfile(filename);
+-- Manifests made by SaveToStore() are put back together from their pack.
+
+local function loadfromstore(data: MappedFile, offset: number,
+		dirname: string): (DocumentSet?, string?)
+	local documents, packleaf, dsoffset = readmanifest(data, offset)
+	if not documents then
+		return nil, "the autosave manifest is corrupt"
+	end
+	assert(packleaf)
+	local packname = dirname.."/"..packleaf
+
+	local wanted = {}
+	for _, hashes in documents do
+		for _, h in hashes do
+			wanted[h] = true
+		end
+	end
+	local pack, e = ReadFile(packname)
+	if not pack then
+		return nil, "the autosave's paragraphs could not be read: "..assert(e)
+	end
+	local paragraphs = {}
+	local offset = 1
+	while true do
+		local e = pack:find("\n", offset, true)
+		if not e then
+			break
+		end
+		local h = pack:sub(offset, offset+15)
+		if wanted[h] then
+			local _, _, style, words = pack:find("^([^ ]+) ([^\n]*)",
+				offset+17)
+			if style and words then
+				paragraphs[h] = CreateParagraph(style, SplitString(words, " "))
+				wanted[h] = nil
+			end
+		end
+		offset = e + 1
+	end
+	if next(wanted) then
+		return nil, "some of the autosave's paragraphs are missing"
+	end
+
+	local result = loadfromstringt(data, dsoffset :: number)
+	for i, hashes in documents do
+		local d = result.documents[i]
+		if not d then
+			return nil, "the autosave manifest is corrupt"
+		end
+		if IsLazyDocument(d) then
+			MaterialiseDocument(d)
+		end
+		for pn = #d, 1, -1 do
+			d[pn] = nil
+		end
+		for pn, h in hashes do
+			d[pn] = paragraphs[h]
+		end
+	end
+	return result
+end
+
+local function loadfromfile(filename): (DocumentSet?, string?)
+	-- The file is mapped rather than read, so the text loader can scan it in
+	-- place.
+
+	local data, e = MapFile(filename)
 	if not data then
 		assert(e)
 		return nil, ("'"..filename.."' could not be opened: "..e)
 	end
 	assert(data)
-	local fp = CreateIStream(data)
 
-	local loader = nil
-	local magic = fp:read("*l"):gsub("\r", "")
+	local e = data:find("\n", 1, true) or #data
+	local magic = data:sub(1, e):gsub("[\r\n]", "")
+	local result: DocumentSet?
 	if (magic == MAGIC) then
-		loader = loadfromstream
+		result = LoadObjectFromLegacy(data, e+1, false)
 	elseif (magic == ZMAGIC) then
-		loader = loadfromstreamz
+		result = LoadObjectFromLegacy(data, e+1, true)
 	elseif (magic == TMAGIC) then
-		loader = loadfromstreamt
+		result = loadfromstringt(data, e+1)
+	elseif (magic == CMAGIC) then
+		result = loadfromstringt(data, e+1, "compressed")
+	elseif (magic == WMAGIC) then
+		result = loadfromstringt(data, e+1, "wordtable")
+	elseif (magic == SMAGIC) then
+		local r, e = loadfromstore(data, e+1, Dirname(filename))
+		if not r then
+			data:close()
+			return nil, ("'"..filename.."' could not be loaded: "..assert(e))
+		end
+		result = r
 	else
-		fp:close()
+		data:close()
 		return nil, ("'"..filename.."' is not a valid WordGrinder file.")
 	end
 
-	return loader(fp)
+	data:close()
+
+	-- The older formats don't have the index by name.
+	if result and not (result :: any)._documentIndex then
+		local index = {}
+		for _, d in result.documents do
+			index[d.name] = d
+		end
+		result._documentIndex = index
+	end
+	return result
+end
+
+function LoadFromFile(filename): (DocumentSet?, string?)
+	local t = TraceBegin("LoadFromFile")
+	local result, e = loadfromfile(filename)
+	TraceEnd(t)
+	return result, e
+end
+
+-- Reads just the properties of a file, stopping before the text of the
+-- documents: for things which only want the metadata, or files (like the
+-- settings) which don't have any documents in them. The result is the raw
+-- property tree in plain tables, with no fixups; the documents are just
+-- their properties, and current is still a number. The older formats can't
+-- be read this way, so they get loaded in full.
+
+function LoadHeaderFromFile(filename: string): (any?, string?)
+	local data, e = MapFile(filename)
+	if not data then
+		assert(e)
+		return nil, ("'"..filename.."' could not be opened: "..e)
+	end
+	assert(data)
+
+	local e = data:find("\n", 1, true) or #data
+	local magic = data:sub(1, e):gsub("[\r\n]", "")
+	local format: SaveFormat? = if (magic == TMAGIC) then "text"
+		elseif (magic == CMAGIC) then "compressed"
+		elseif (magic == WMAGIC) then "wordtable"
+		else nil
+	if format then
+		local result = LoadHeader(data, e+1, format)
+		data:close()
+		return result
+	end
+
+	data:close()
+	return LoadFromFile(filename)
+end
+
+-----------------------------------------------------------------------------
+-- Resident document sets.
+--
+-- When a document set with no unsaved changes is replaced (by loading
+-- another file, or starting a new one), it's kept in memory, so going back
+-- to it (from the recent files menu, say) just picks it up again with its
+-- wrapping, spellchecking and undo intact; the dictionary and word caches
+-- are shared by everything already. The most recently used are kept until their files add up to more
+-- than the budget. One whose file has changed since is thrown away.
+
+local MAX_RESIDENT = 4
+local RESIDENT_BUDGET = 64*1024*1024 -- bytes on disk
+
+type ResidentSet = {
+	documentSet: DocumentSet,
+	size: number,
+	mtime: number?,
+}
+
+local resident: {ResidentSet} = {}
+
+-- Called just before the current document set is replaced by another (or
+-- by a blank one, if replacement is nil).
+function RetireDocumentSet(replacement: DocumentSet?)
+	local ds = documentSet
+	local filename = ds.name
+	if not filename or ds._changed or (ds == replacement)
+			or (replacement and (replacement.name == filename)) then
+		return
+	end
+	local st = Stat(filename)
+	if not st or (st.mode ~= "file") then
+		return
+	end
+
+	table.insert(resident, 1,
+		{ documentSet = ds, size = st.size, mtime = st.mtime })
+	local total = 0
+	for i, r in resident do
+		total = total + r.size
+		if (i > MAX_RESIDENT) or (total > RESIDENT_BUDGET) then
+			for j = #resident, i, -1 do
+				resident[j] = nil
+			end
+			break
+		end
+	end
+end
+
+-- Removes a resident document set from the list and returns it, if there's
+-- one for the file and the file hasn't changed since.
+local function takeresident(filename: string): DocumentSet?
+	for i, r in resident do
+		if (r.documentSet.name == filename) then
+			table.remove(resident, i)
+			local st = Stat(filename)
+			if st and (st.size == r.size) and (st.mtime == r.mtime) then
+				return r.documentSet
+			end
+			return nil
+		end
+	end
+	return nil
+end
+
+function GetResidentDocumentSets(): {DocumentSet}
+	local sets = {}
+	for i, r in resident do
+		sets[i] = r.documentSet
+	end
+	return sets
+end
+
+function ForgetResidentDocumentSets()
+	resident = {}
 end
 
 local function loaddocument(filename): (DocumentSet?, string?)
+	local r = takeresident(filename)
+	if r then
+		return r
+	end
+
 	local d: DocumentSet?, e = LoadFromFile(filename)
 	if e then
 		return nil, e
@@ -669,6 +1038,7 @@ function Cmd.LoadDocumentSet(filename): (boolean, string?)
 		return false, "Incompatible version"
 	end
 
+	RetireDocumentSet(d)
 	documentSet = d
 	currentDocument = d.current
 
@@ -679,6 +1049,9 @@ function Cmd.LoadDocumentSet(filename): (boolean, string?)
 		documentSet.fileformat = FILEFORMAT
 		documentSet.menu = CreateMenuTree()
 	end
+	local recovered = ReplayJournal(filename)
+	ResetJournal(filename, recovered)
+
 	FireEvent("RegisterAddons")
 	documentSet:touch()
 
@@ -698,31 +1071,73 @@ function Cmd.LoadDocumentSet(filename): (boolean, string?)
 			"to their default values.")
 	end
 
-	-- The document is NOT dirty immediately after a load.
+	local damaged = documentSet._damaged
+	if damaged then
+		documentSet._damaged = nil
+		ModalMessage("Document damaged",
+			"The text of "..table.concat(damaged, ", ").." doesn't match "..
+			"the checksum saved with it. It may have been edited outside "..
+			"WordGrinder, or the file may be damaged; check it before "..
+			"saving over it.")
+	end
+
+	-- The document is NOT dirty immediately after a load, unless there were
+	-- journalled changes which haven't been saved to it yet.
 	
-	documentSet._changed = false
+	documentSet._changed = recovered
+	if recovered then
+		NonmodalMessage("Recovered unsaved changes from the journal.")
+	end
 
 	return true
 end
 
-function UpgradeDocument(oldversion)
-	documentSet.addons = documentSet.addons or {}
+-- The upgrades which only change what's inside a document. Documents which
+-- are still lazy (see documentset.lua) are left until they're materialised,
+-- so upgrading a big file only costs what gets looked at.
 
+function UpgradeDocumentContents(document: Document, oldversion: number)
 	-- Upgrade version 1 to 2.
 
 	if (oldversion < 2) then
 		-- Update wordcount.
 
-		for _, document in ipairs(documentSet.documents) do
-			local wc = 0
+		local wc = 0
+		for _, p in ipairs(document) do
+			wc = wc + #p
+		end
+		document.wordcount = wc
+	end
+
+	-- Upgrade version 6 to 7.
+
+	if (oldversion < 7) then
+		-- This is the version where documentSet.styles vanished. Each paragraph.style
+		-- is now a string containing the name of the style; styles are looked up on
+		-- demand.
 
-			for _, p in ipairs(document) do
-				wc = wc + #p
+		for _, p in ipairs(document) do
+			if (type(p.style) ~= "string") then
+				p.style = (p.style::any).name
 			end
+		end
+	end
+end
 
-			document.wordcount = wc
+function UpgradeDocument(oldversion)
+	documentSet.addons = documentSet.addons or {}
+
+	for _, document in ipairs(documentSet.documents) do
+		if IsLazyDocument(document) then
+			rawset(document :: any, "_upgradefrom", oldversion)
+		else
+			UpgradeDocumentContents(document, oldversion)
 		end
+	end
+
+	-- Upgrade version 1 to 2.
 
+	if (oldversion < 2) then
 		-- Status bar defaults to on.
 
 		documentSet.statusbar = true
@@ -747,21 +1162,8 @@ function UpgradeDocument(oldversion)
 	-- Upgrade version 6 to 7.
 
 	if (oldversion < 7) then
-		-- This is the version where documentSet.styles vanished. Each paragraph.style
-		-- is now a string containing the name of the style; styles are looked up on
-		-- demand.
+		-- The documents' styles are converted by UpgradeDocumentContents().
 
-        local function convertStyles(document: Document)
-            for _, p in ipairs(document) do
-                if (type(p.style) ~= "string") then
-                    p.style = (p.style::any).name
-                end
-            end
-        end
-
-		for _, document in ipairs(documentSet.documents) do
-            convertStyles(document)
-        end
 		(documentSet::any).styles = nil
 	end
 
@@ -779,8 +1181,41 @@ function UpgradeDocument(oldversion)
 	end
 end
 
+-- The clipboard is kept here, as a document whose paragraphs (which are
+-- immutable) are shared with wherever they were copied from. Exporting it as
+-- text and serialising it for the system clipboard is only done once the
+-- user pauses, or is about to quit, so copying a large selection is quick.
+-- Until then, and afterwards for as long as the system clipboard still holds
+-- what was put there, pasting uses the document directly.
+
+local PUBLISH_DELAY = 0.5
+
+local clipboard: any = nil
+local unpublished = false
+local publishedwgdata: string? = nil
+
+-- Callers are free to change the paragraph list they're given.
+local function copyclipboard(d: Document): Document
+	local copy = CreateDocument()
+	if #d > 0 then
+		table.move(d :: any, 1, #d, 1, copy :: any)
+	end
+	return copy
+end
+
 function GetClipboard()
+	if clipboard and unpublished then
+		return copyclipboard(clipboard)
+	end
+
 	local text, wgdata = wg.clipboard_get()
+	if clipboard and (wgdata == publishedwgdata) then
+		return copyclipboard(clipboard)
+	end
+
+	-- Something else has been copied since.
+	clipboard = nil
+	publishedwgdata = nil
 	if wgdata then
 		return LoadFromString(wgdata).documents[1]
 	end
@@ -791,13 +1226,31 @@ function GetClipboard()
 end
 
 function SetClipboard(document)
-	local text = Cmd.ExportToTextString(document)
-
-	local documentSet = CreateDocumentSet()
 	document.name = "clipboard"
-	documentSet.documents = { document }
+	clipboard = document
+	unpublished = true
+	publishedwgdata = nil
+	RequestIdle(PUBLISH_DELAY)
+end
+
+--- Writes the clipboard to the system clipboard, if it hasn't been yet.
+
+function PublishClipboard()
+	local document = clipboard
+	if not unpublished or not document then
+		return
+	end
+
+	-- (The text exporter is loaded lazily, which confuses the typechecker.)
+	local text = (Cmd :: any).ExportToTextString(document)
+
+	local ds = CreateDocumentSet()
+	ds.documents = { document }
 
-	local wgdata = SaveToString(documentSet)
+	local wgdata = SaveToString(ds)
 	wg.clipboard_set(text, wgdata)
+	publishedwgdata = wgdata
+	unpublished = false
 end
 
+AddEventListener("Idle", PublishClipboard, function() return unpublished end)
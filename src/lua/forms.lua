@@ -19,9 +19,14 @@ local Write = wg.write
 local int = math.floor
 local string_rep = string.rep
 
+local POLL_INTERVAL = 0.1
+
 ESCAPE_KEY = (FRONTEND == "ncurses") and "CTRL+C" or "ESCAPE"
 
-type FormCommand = "nop" | "confirm" | "redraw" | "cancel"
+-- "redraw" draws everything again, including the screen behind the form;
+-- "repaint" only draws the form, over what's already there, as long as it
+-- hasn't moved.
+type FormCommand = "nop" | "confirm" | "redraw" | "repaint" | "cancel"
 type ActionResult = FormCommand | MenuCallback
 type FormAction = FormCommand | ((Form, any) -> ActionResult)
 type ActionTable = {[string]: FormAction}
@@ -35,6 +40,11 @@ type Form = {
 
 	focus: number?,
 
+	-- If set, called every POLL_INTERVAL seconds while the form is open, for
+	-- forms which are filled in as something happens in the background;
+	-- polling stops once it returns false.
+	poll: ((self: Form) -> boolean)?,
+
 	actions: ActionTable,
 	widgets: {Widget}
 }
@@ -63,7 +73,7 @@ declare class Widget extends Object
 	init: (self: Widget) -> ()
 	draw: (self: Widget) -> ()
 	calculate_height: (self: Widget) -> number
-	changed: (self: Widget) -> ()
+	changed: (self: Widget) -> ActionResult?
 	key: (self: Widget, key: KeyboardEvent) -> FormAction
 	click: (self: Widget, event: MouseEvent) -> FormAction
 	action: (self: Widget, event: InputEvent) -> ActionResult
@@ -180,8 +190,9 @@ local Checkbox: CheckboxWidget = Form.Widget {
 	
 	[" "] = function(self: CheckboxWidget, key)
 		self.value = not self.value
-		self:changed()
+		local action: ActionResult? = self:changed()
 		self:draw()
+		return action or "nop"
 	end,
 }
 Form.Checkbox = Checkbox
@@ -379,8 +390,9 @@ local TextField: TextFieldWidget = Form.Widget {
 
 			self.value = self.value:sub(1, self.cursor - 1) ..
 				self.value:sub(self.cursor + w)
-			self:changed()
+			local action: ActionResult? = self:changed()
 			self:draw()
+			return action or "nop"
 		end
 
 		return "nop"
@@ -393,8 +405,9 @@ local TextField: TextFieldWidget = Form.Widget {
 			local w = GetBytesOfCharacter(self.value:byte(self.cursor))
 			self.value = self.value:sub(1, self.cursor - 1) ..
 				self.value:sub(self.cursor + w)
-			self:changed()
+			local action: ActionResult? = self:changed()
 			self:draw()
+			return action or "nop"
 		end
 
 		return "nop"
@@ -405,17 +418,17 @@ local TextField: TextFieldWidget = Form.Widget {
 		self.cursor = 1
 		self.offset = 1
 		self.value = ""
-			self:changed()
+		local action: ActionResult? = self:changed()
 		self:draw()
 
-		return "nop"
+		return action or "nop"
 	end,
 
 	click = function(self: TextFieldWidget, m: MouseEvent)
 		local c = m.x - self.realx1 + self.offset
 		if (c >= 1) and (c <= #self.value) then
 			self.cursor = c
-			return "redraw"
+			return "repaint"
 		end
 		return "nop"
 	end,
@@ -425,8 +438,9 @@ local TextField: TextFieldWidget = Form.Widget {
 			discard_transient_textfield(self)
 			self.value = self.value:sub(1, self.cursor-1) .. key .. self.value:sub(self.cursor)
 			self.cursor = self.cursor + GetBytesOfCharacter(key:byte(1))
-			self:changed()
+			local action: ActionResult? = self:changed()
 			self:draw()
+			return action or "nop"
 		end
 		return "nop"
 	end,
@@ -449,6 +463,8 @@ declare class BrowserWidget extends Widget
 	label: string
 
 	_adjustOffset: (self: BrowserWidget) -> ()
+	_drawRow: (self: BrowserWidget, i: number) -> ()
+	_moveCursor: (self: BrowserWidget, cursor: number) -> ()
 end
 
 local Browser: BrowserWidget = Form.Widget {
@@ -505,43 +521,68 @@ local Browser: BrowserWidget = Form.Widget {
 
 		-- Draw the data.
 
-		local space = string_rep(" ", w - 2)
 		for i = 0, h-2 do
-			local index = self.offset + i
-			local item = self.data[index]
-			if not item then
+			if not self.data[self.offset + i] then
 				break
 			end
+			self:_drawRow(i)
+		end
+		SetNormal()
+	end,
 
-			if (index == self.cursor) then
-				SetReverse()
-			else
-				SetNormal()
-			end
+	-- Draws one visible row, counting from 0.
+	_drawRow = function(self: BrowserWidget, i: number)
+		local x = self.realx1
+		local y = self.realy1
+		local w = self.realwidth
+		local h = self.realheight
+		local index = self.offset + i
+		local item = self.data[index]
+		if not item then
+			return
+		end
 
-			Write(x+1, y+1+i, space)
-			local s = GetBoundedString(item.label, w-4)
-			Write(x+2, y+1+i, s)
-
-			if (#self.data > (h-2)) then
-				SetNormal()
-				SetBright()
-				s = "│"
-				local yf = (i+1) * #self.data / (h-1)
-				if (yf >= self.offset) and (yf <= (self.offset + h-2)) then
-					s = "║"
-				end
-				Write(x+w-1, y+1+i, s)
-			end
+		if (index == self.cursor) then
+			SetReverse()
+		else
+			SetNormal()
+		end
+
+		Write(x+1, y+1+i, string_rep(" ", w - 2))
+		local s = GetBoundedString(item.label, w-4)
+		Write(x+2, y+1+i, s)
+
+		if (#self.data > (h-2)) then
 			SetNormal()
+			SetBright()
+			s = "│"
+			local yf = (i+1) * #self.data / (h-1)
+			if (yf >= self.offset) and (yf <= (self.offset + h-2)) then
+				s = "║"
+			end
+			Write(x+w-1, y+1+i, s)
 		end
 		SetNormal()
 	end,
 
+	-- Moves the cursor. Unless the list has to scroll, only the rows the
+	-- cursor leaves and lands on are drawn, which keeps long lists quick.
+	_moveCursor = function(self: BrowserWidget, cursor: number)
+		local oldcursor = self.cursor
+		local oldoffset = self.offset
+		self.cursor = cursor
+		self:_adjustOffset()
+		if (oldoffset ~= 0) and (self.offset == oldoffset) then
+			self:_drawRow(oldcursor - self.offset)
+			self:_drawRow(cursor - self.offset)
+		else
+			self:draw()
+		end
+	end,
+
 	["KEY_UP"] = function(self: BrowserWidget, key)
 		if (self.cursor > 1) then
-			self.cursor = self.cursor - 1
-			self:draw()
+			self:_moveCursor(self.cursor - 1)
 			return self:changed()
 		end
 
@@ -550,8 +591,7 @@ local Browser: BrowserWidget = Form.Widget {
 
 	["KEY_DOWN"] = function(self: BrowserWidget, key)
 		if (self.cursor < #self.data) then
-			self.cursor = self.cursor + 1
-			self:draw()
+			self:_moveCursor(self.cursor + 1)
 			return self:changed()
 		end
 
@@ -559,28 +599,19 @@ local Browser: BrowserWidget = Form.Widget {
 	end,
 
 	["KEY_PGUP"] = function(self: BrowserWidget, key)
-		local oldcursor = self.cursor
-		self.cursor = oldcursor - int(self.realheight/2)
-		if (self.cursor < 1) then
-			self.cursor = 1
-		end
-
-		if (self.cursor ~= oldcursor) then
-			self:draw()
+		local cursor = math.max(self.cursor - int(self.realheight/2), 1)
+		if (cursor ~= self.cursor) then
+			self:_moveCursor(cursor)
 			return self:changed()
 		end
 		return "nop"
 	end,
 
 	["KEY_PGDN"] = function(self: BrowserWidget, key)
-		local oldcursor = self.cursor
-		self.cursor = oldcursor + int(self.realheight/2)
-		if (self.cursor > #self.data) then
-			self.cursor = #self.data
-		end
-
-		if (self.cursor ~= oldcursor) then
-			self:draw()
+		local cursor = math.min(self.cursor + int(self.realheight/2),
+			#self.data)
+		if (cursor ~= self.cursor) then
+			self:_moveCursor(cursor)
 			return self:changed()
 		end
 		return "nop"
@@ -600,7 +631,7 @@ local standard_actions: {[string]: FormAction} =
 				local widget = form.widgets[f]
 				if widget.focusable then
 					form.focus = f
-					return "redraw"
+					return "repaint"
 				end
 
 				f = f - 1
@@ -621,7 +652,7 @@ local standard_actions: {[string]: FormAction} =
 				local widget = form.widgets[f]
 				if widget.focusable then
 					form.focus = f
-					return "redraw"
+					return "repaint"
 				end
 
 				f = f + 1
@@ -670,14 +701,18 @@ local function findmouseaction(form, m)
 			if not action and widget.mouse then
 				action = widget:mouse(m)
 			end
-			return action or "redraw"
+			return action or "repaint"
 		end
 	end
 	return nil
 end
 
 function Form.Run(form: Form, redraw: (() -> ())?, helptext: string?)
-	local function redraw_form()
+	-- Where the form was last drawn, so that it can be drawn again without
+	-- the backdrop if it hasn't moved.
+	local drawnat: string? = nil
+
+	local function redraw_form(backdrop: boolean)
 		-- Ensure the screen is properly sized.
 
 		ResizeScreen()
@@ -701,12 +736,6 @@ function Form.Run(form: Form, redraw: (() -> ())?, helptext: string?)
 			end
 		end
 
-		-- Redraw the backdrop.
-
-		if redraw then
-			redraw()
-		end
-
 		-- Size the form.
 
 		local realwidth = 0
@@ -762,6 +791,18 @@ function Form.Run(form: Form, redraw: (() -> ())?, helptext: string?)
 			widget.realheight = widget.realy2 - widget.realy1
 		end
 
+		-- Redraw the backdrop, unless what's already on the screen will do.
+
+		local at = table.concat(
+			{ ScreenWidth, ScreenHeight, realx, realy, realwidth, realheight },
+			",")
+		if backdrop or (at ~= drawnat) then
+			if redraw then
+				redraw()
+			end
+		end
+		drawnat = at
+
 		-- Draw the form itself.
 
 		SetColour(Palette.ControlFG, Palette.ControlBG)
@@ -793,19 +834,28 @@ function Form.Run(form: Form, redraw: (() -> ())?, helptext: string?)
 
 	-- Process keys.
 
-	redraw_form()
+	redraw_form(true)
 	while not Quitting do
 		HideCursor()
+		local timeout = if form.poll then POLL_INTERVAL else nil
 		local key = if form.focus then
-			GetCharWithBlinkingCursor() else GetChar()
+			GetCharWithBlinkingCursor(timeout) else GetChar(timeout)
+
+		if key == "KEY_TIMEOUT" then
+			local poll = form.poll
+			if poll and not poll(form) then
+				form.poll = nil
+			end
+			continue
+		end
 
 		if form.transient then
-			redraw_form()
+			redraw_form(true)
 		end
 
 		if (key == "KEY_RESIZE") then
 			ResizeScreen()
-			redraw_form()
+			redraw_form(true)
 		end
 		if (key == "KEY_QUIT") then
 			QuitForcedBySystem()
@@ -844,7 +894,9 @@ function Form.Run(form: Form, redraw: (() -> ())?, helptext: string?)
 		elseif (action == "confirm") then
 			return true
 		elseif (action == "redraw") then
-			redraw_form()
+			redraw_form(true)
+		elseif (action == "repaint") then
+			redraw_form(false)
 		end
 	end
 	return false
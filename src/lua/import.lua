@@ -8,6 +8,10 @@ local UNDERLINE = wg.UNDERLINE
 local ParseWord = wg.parseword
 local WriteU8 = wg.writeu8
 local ReadFile = wg.readfile
+local MapFile = wg.mapfile
+local CreateNativeImporter = wg.createimporter
+local TraceBegin = wg.tracebegin
+local TraceEnd = wg.traceend
 local bitand = bit32.band
 local bitor = bit32.bor
 local bitxor = bit32.bxor
@@ -26,69 +30,25 @@ type Importer = {
 	flushparagraph: (Importer, string) -> (),
 }
 
--- Import helper functions. These functions build styled words and paragraphs.
+-- Import helper functions. These functions build styled words and paragraphs;
+-- the work is done natively (see importer.cc), and each finished paragraph
+-- is appended to the document.
 
 function CreateImporter(document: Document): Importer
-	local pbuffer
-	local wbuffer
-	local oldattr
-	local attr
-
-	return
-	{
-		reset = function(self)
-			pbuffer = {}
-			wbuffer = {}
-			oldattr = 0
-			attr = 0
-		end,
-
-		style_on = function(self, a)
-			attr = bitor(attr, a)
-		end,
-
-		style_off = function(self, a)
-			attr = bitxor(bitor(attr, a), a)
-		end,
-
-		text = function(self, t)
-			if (oldattr ~= attr) then
-				wbuffer[#wbuffer + 1] = string_char(16 + attr)
-				oldattr = attr
-			end
-
-			wbuffer[#wbuffer + 1] = t
-		end,
-
-		flushword = function(self, force)
-			if (#wbuffer > 0) or force then
-				local s = table_concat(wbuffer)
-				pbuffer[#pbuffer + 1] = s
-				wbuffer = {}
-				oldattr = 0
-			end
-		end,
-
-		flushparagraph = function(self, style)
-			style = style or "P"
-
-			if (#wbuffer > 0) then
-				self:flushword()
-			end
-
-			if (#pbuffer > 0) then
-				local p = CreateParagraph(style, pbuffer)
-				document:appendParagraph(p)
-
-				pbuffer = {}
-			end
-		end
-	}
+	return CreateNativeImporter(
+		function(style: string, words: {string})
+			document:appendParagraph(CreateParagraph(style, words))
+		end)
 end
 
 -- Does the standard selector-box-and-progress UI for each importer.
 
-function ImportFileWithUI(filename, title, callback: (string) -> Document?): boolean
+-- If mapped is set, the callback is passed a MappedFile rather than a string;
+-- this avoids loading huge files into memory for importers which can scan
+-- them in place.
+
+function ImportFileWithUI(filename, title, callback: (any) -> Document?,
+		mapped: boolean?): boolean
 	if not filename then
 		filename = FileBrowser(title, "Import from:", false)
 		if not filename then
@@ -101,13 +61,23 @@ function ImportFileWithUI(filename, title, callback: (string) -> Document?): boo
 
 	-- Actually import the file.
 
-	local data, e = ReadFile(filename)
+	local data: any, e
+	if mapped then
+		data, e = MapFile(filename)
+	else
+		data, e = ReadFile(filename)
+	end
 	if not data then
 		return false
 	end
 
 	assert(data)
+	local t = TraceBegin("ImportFileWithUI")
 	local document = callback(data)
+	TraceEnd(t)
+	if mapped then
+		data:close()
+	end
 	if not document then
 		ModalMessage(nil, "The import failed, probably because the file could not be found.")
 		QueueRedraw()
@@ -8,6 +8,8 @@ local UNDERLINE = wg.UNDERLINE
 local BOLD = wg.BOLD
 local ParseWord = wg.parseword
 local WriteU8 = wg.writeu8
+local HTMLTokens = wg.htmltokens
+local DecodeEntities = wg.decodeentities
 local bitand = bit32.band
 local bitor = bit32.bor
 local bitxor = bit32.bxor
@@ -21,55 +23,15 @@ local table_concat = table.concat
 -- The importer itself.
 
 function Cmd.ImportHTMLString(data)
-	-- Collapse whitespace; this makes things far easier to parse.
+	-- The tokeniser collapses whitespace, makes the text valid UTF-8 and
+	-- reduces tags to a canonical form, all in one pass.
 
-	data = data:gsub("[\t\f]", " ")
-	data = data:gsub("\r\n", "\n")
+	local tokens = HTMLTokens(data)
 
-	-- Canonicalise the string, making it valid UTF-8.
-
-	data = CanonicaliseString(data)
-	
-	-- Collapse complex elements.
-	
-	data = data:gsub("< ?(%w+) ?[^>]*(/?)>", "<%1%2>")
-	
-	-- Helper function for reading tokens from the HTML stream.
-	
-	local pos: number = 1
-	local len = data:len()
-	local function tokens(): string?
-		if (pos >= len) then
-			return nil
-		end
-		
-		local s, e, t
-		s, e, t = string.find(data, "^([ \n])", pos)
-		if s then pos = assert(e)+1 return t end
-		
-		if string.find(data, "^%c") then
-			pos = pos + 1
-			return tokens()
-		end
-		
-		s, e, t = string.find(data, "^(<[^>]*>)", pos)
-		if s then pos = assert(e)+1 return assert(t):lower() end
-		
-		s, e, t = string.find(data, "^(&[^;]-;)", pos)
-		if s then pos = assert(e)+1 return t end
-		
-		s, e, t = string.find(data, "^([^ <&\n]+)", pos)
-		if s then pos = assert(e)+1 return t end
-		
-		t = string.sub(data, pos, pos+1)
-		pos = pos + 1
-		return t
-	end
-	
 	-- Skip tokens until we hit a <body>.
-	
-	for t in tokens do
-		if (t == "<body>") then
+
+	for kind, t in tokens do
+		if (kind == "tag") and (t == "<body>") then
 			break
 		end
 	end
@@ -131,19 +93,21 @@ function Cmd.ImportHTMLString(data)
 	-- Actually do the parsing.
 	
 	importer:reset()
-	for t in tokens do
-		local e = elements[t]
-		if e then
-			e()
-		elseif string_find(t, "^<") then
-			-- do nothing
-		elseif string_find(t, "^&") then
-			e = DecodeHTMLEntity(t)
-			if e then
+	for kind, t in tokens do
+		if (kind == "text") then
+			importer:text(t)
+		elseif (kind == "entity") then
+			-- Unknown entities come back unchanged, and are dropped.
+			local e = DecodeEntities(t)
+			if e ~= t then
 				importer:text(e)
 			end
 		else
-			importer:text(t)
+			-- Tags we don't understand are ignored.
+			local e = elements[t]
+			if e then
+				e()
+			end
 		end
 	end
 	flush()
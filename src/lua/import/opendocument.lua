@@ -8,7 +8,8 @@ local UNDERLINE = wg.UNDERLINE
 local BOLD = wg.BOLD
 local ParseWord = wg.parseword
 local WriteU8 = wg.writeu8
-local ReadFromZip = wg.readfromzip
+local OpenZip = wg.openzip
+local XMLTokens = wg.xmltokens
 local bitand = bit32.band
 local bitor = bit32.bor
 local bitxor = bit32.bxor
@@ -36,166 +37,293 @@ type ODStyleMap = {
 	[string]: ODStyle
 }
 
+-- A style with everything it inherits folded in, so that looking one up
+-- while importing is a single table access.
+type ODResolvedStyle = {
+	attrs: number, -- the ITALIC, BOLD and UNDERLINE bits
+	paragraph: string?, -- the WordGrinder style it forces, if any
+}
+
+type ODResolvedStyleMap = {
+	[string]: ODResolvedStyle
+}
+
+local NO_STYLE: ODResolvedStyle = { attrs = 0 }
+
 -----------------------------------------------------------------------------
--- The importer itself.
+-- The importer itself. A big document's content.xml can be tens of
+-- megabytes, so rather than parse it into a tree it's streamed a token at a
+-- time (see wg.xmltokens()); each of the functions below is called just
+-- after an element's opening tag, reads up to and including its closing
+-- tag, and turns what it found into styles or paragraphs.
+
+type Tokens = () -> (string?, any, any, any)
+
+-- Skips over the rest of an element.
+local function skip_element(tokens: Tokens)
+	local depth = 1
+	while true do
+		local event = tokens()
+		if not event then
+			return
+		elseif (event == "opentag") then
+			depth = depth + 1
+		elseif (event == "closetag") then
+			depth = depth - 1
+			if (depth == 0) then
+				return
+			end
+		end
+	end
+end
 
-local function parse_style(styles: ODStyleMap, xml)
+local function parse_style(styles: ODStyleMap, tokens: Tokens, attrs)
 	local NAME = STYLE_NS .. " name"
-	local FAMILY = STYLE_NS .. " family"
 	local PARENT_NAME = STYLE_NS .. " parent-name"
-	local TEXT_PROPERTIES = STYLE_NS .. " text-properties"
-	local PARAGRAPH_PROPERTIES = STYLE_NS .. " paragraph-properties"
 	local FONT_STYLE = FO_NS .. " font-style"
 	local FONT_WEIGHT = FO_NS .. " font-weight"
 	local UNDERLINE_STYLE = STYLE_NS .. " text-underline-style"
 	local MARGIN_LEFT = FO_NS .. " margin-left"
-	
-	local name = xml[NAME]
+
 	local style =
 	{
-		parent = xml[PARENT_NAME]
+		parent = attrs[PARENT_NAME]
 	}
 
-	for _, element in ipairs(xml) do
-		if (element._name == TEXT_PROPERTIES) then
-			style.italic = element[FONT_STYLE] == "italic"
-			style.bold = element[FONT_WEIGHT] == "bold"
-			style.underline = element[UNDERLINE_STYLE] == "solid"
-		elseif (element._name == PARAGRAPH_PROPERTIES) then
-			style.indented = element[MARGIN_LEFT]
+	while true do
+		local event, ns, name, a = tokens()
+		if not event or (event == "closetag") then
+			break
+		elseif (event == "opentag") then
+			if (ns == STYLE_NS) and (name == "text-properties") then
+				style.italic = a[FONT_STYLE] == "italic"
+				style.bold = a[FONT_WEIGHT] == "bold"
+				style.underline = a[UNDERLINE_STYLE] == "solid"
+			elseif (ns == STYLE_NS) and (name == "paragraph-properties") then
+				style.indented = a[MARGIN_LEFT]
+			end
+			skip_element(tokens)
 		end
 	end
 
-	styles[name] = style
+	styles[attrs[NAME]] = style
 end
 
-local function resolve_parent_styles(styles: ODStyleMap)
-	local function recursively_fetch(name, attr)
+-- A style has an attribute if it or any of its ancestors sets it. Each
+-- style is resolved once, however many others inherit from it; parents
+-- which don't exist, or which loop, are ignored.
+local function resolve_parent_styles(styles: ODStyleMap): ODResolvedStyleMap
+	local resolved: ODResolvedStyleMap = {}
+	local visiting = {}
+
+	local function resolve(name: string): ODResolvedStyle
+		local r = resolved[name]
+		if r then
+			return r
+		end
 		local style = styles[name]
-		if style[attr] then
-			return true
+		if not style or visiting[name] then
+			return NO_STYLE
+		end
+
+		visiting[name] = true
+		local parent = style.parent and resolve(style.parent) or NO_STYLE
+		visiting[name] = nil
+
+		local attrs = parent.attrs
+		if style.italic then
+			attrs = bitor(attrs, ITALIC)
 		end
-		if style.parent then
-			return recursively_fetch(style.parent, attr)
+		if style.bold then
+			attrs = bitor(attrs, BOLD)
 		end
-		return false
+		if style.underline then
+			attrs = bitor(attrs, UNDERLINE)
+		end
+		local new: ODResolvedStyle = {
+			attrs = attrs,
+			paragraph = style.indented and "Q" or parent.paragraph,
+		}
+		resolved[name] = new
+		return new
 	end
 
-	for k, v in styles do
-		v.italic = recursively_fetch(k, "italic")
-		v.bold = recursively_fetch(k, "bold")
-		v.underline = recursively_fetch(k, "underline")
-		v.indented = recursively_fetch(k, "indented")
+	for k in styles do
+		resolve(k)
 	end
+	return resolved
 end
 
-local function collect_styles(styles, xml)
-	local STYLES = OFFICE_NS .. " styles"
-	local AUTOMATIC_STYLES = OFFICE_NS .. " automatic-styles"
-	local STYLE = STYLE_NS .. " style"
-
-	for _, element in ipairs(xml) do
-		if (element._name == STYLES) or (element._name == AUTOMATIC_STYLES) then
-			for _, element in ipairs(element) do
-				if (element._name == STYLE) then
-					parse_style(styles, element)
-				end
+-- Reads an office:styles or office:automatic-styles element.
+local function collect_styles(styles: ODStyleMap, tokens: Tokens)
+	while true do
+		local event, ns, name, attrs = tokens()
+		if not event or (event == "closetag") then
+			return
+		elseif (event == "opentag") then
+			if (ns == STYLE_NS) and (name == "style") then
+				parse_style(styles, tokens, attrs)
+			else
+				skip_element(tokens)
 			end
 		end
 	end
 end
 
-local function add_text(styles: ODStyleMap, importer, xml)
-	local SPACE = TEXT_NS .. " s"
+-- Reads the text of a paragraph or heading. Spans can nest as deeply as the
+-- file likes, so rather than recursing, the style of each element still open
+-- is kept on a stack (with 0 for anything which isn't a span).
+local function add_text(styles: ODResolvedStyleMap, importer, tokens: Tokens)
 	local SPACECOUNT = TEXT_NS .. " c"
-	local SPAN = TEXT_NS .. " span"
 	local STYLENAME = TEXT_NS .. " style-name"
-	
-	for _, element: any in ipairs(xml) do
-		if (type(element) == "string") then
+	local open: {number} = {}
+
+	while true do
+		local event, ns, name, attrs = tokens()
+		if not event then
+			return
+		elseif (event == "closetag") then
+			local depth = #open
+			if (depth == 0) then
+				return
+			end
+			local a = open[depth]
+			open[depth] = nil
+			if a ~= 0 then
+				importer:style_off(a)
+			end
+		elseif (event == "text") then
+			local text = ns
 			local needsflush = false
-			if string_find(element, "^ ") then
+			if string_find(text, "^ ") then
 				needsflush = true
 			end
-			for word in string_gmatch(element, "%S+") do
+			for word in string_gmatch(text, "%S+") do
 				if needsflush then
 					importer:flushword(false)
 				end
 				importer:text(word)
 				needsflush = true
 			end
-			if string_find(element, " $") then
+			if string_find(text, " $") then
 				importer:flushword(false)
 			end
-		elseif (element._name == SPACE) then
-			local count = tonumber(element[SPACECOUNT]) or 0
-			for i = 1, count+1 do
-				importer:flushword(false)
-			end
-		elseif (element._name == SPAN) then
-			local stylename = element[STYLENAME] or ""
-			local style = styles[stylename] or {}::ODStyle
-			
-			if style.italic then
-				importer:style_on(ITALIC)
-			end
-			if style.bold then
-				importer:style_on(BOLD)
-			end
-			if style.underline then
-				importer:style_on(UNDERLINE)
-			end
-			add_text(styles, importer, element)
-			if style.underline then
-				importer:style_off(UNDERLINE)
-			end
-			if style.bold then
-				importer:style_off(BOLD)
-			end
-			if style.italic then
-				importer:style_off(ITALIC)
+		elseif (event == "opentag") then
+			if (ns == TEXT_NS) and (name == "s") then
+				local count = tonumber(attrs[SPACECOUNT]) or 0
+				for i = 1, count+1 do
+					importer:flushword(false)
+				end
+				skip_element(tokens)
+			elseif (ns == TEXT_NS) and (name == "span") then
+				local style = styles[attrs[STYLENAME] or ""] or NO_STYLE
+				local a = style.attrs
+
+				if a ~= 0 then
+					importer:style_on(a)
+				end
+				open[#open+1] = a
+			else
+				open[#open+1] = 0
 			end
-		else
-			add_text(styles, importer, element)
 		end
 	end
 end
 
+local import_list
+
 local function import_paragraphs(
-		styles: ODStyleMap, importer: Importer, xml, defaultstyle)
-	local PARAGRAPH = TEXT_NS .. " p"
-	local HEADER = TEXT_NS .. " h"
-	local LIST = TEXT_NS .. " list"
+		styles: ODResolvedStyleMap, importer: Importer, tokens: Tokens,
+		defaultstyle)
 	local OUTLINELEVEL = TEXT_NS .. " outline-level"
 	local STYLENAME = TEXT_NS .. " style-name"
-	local STARTVALUE = TEXT_NS .. " start-value"
-	
-	for _, element in ipairs(xml) do
-		if (element._name == PARAGRAPH) then
-			local stylename = element[STYLENAME] or ""
-			local style = styles[stylename] or {}::ODStyle
-			local wgstyle = defaultstyle
-			
-			if style.indented then
-				wgstyle = "Q"
-			end
-			
-			add_text(styles, importer, element)
-			importer:flushparagraph(wgstyle)
-		elseif (element._name == HEADER) then
-			local level = assert(tonumber(element[OUTLINELEVEL] or 1))
-			if level > 4 then
-				level = 4
+
+	while true do
+		local event, ns, name, attrs = tokens()
+		if not event or (event == "closetag") then
+			return
+		elseif (event == "opentag") then
+			if (ns == TEXT_NS) and (name == "p") then
+				local style = styles[attrs[STYLENAME] or ""] or NO_STYLE
+
+				add_text(styles, importer, tokens)
+				importer:flushparagraph(style.paragraph or defaultstyle)
+			elseif (ns == TEXT_NS) and (name == "h") then
+				local level = assert(tonumber(attrs[OUTLINELEVEL] or 1))
+				if level > 4 then
+					level = 4
+				end
+
+				add_text(styles, importer, tokens)
+				importer:flushparagraph("H"..level)
+			elseif (ns == TEXT_NS) and (name == "list") then
+				import_list(styles, importer, tokens)
+			else
+				skip_element(tokens)
 			end
-			
-			add_text(styles, importer, element)
-			importer:flushparagraph("H"..level)
-		elseif (element._name == LIST) then
-			for _, element in ipairs(element) do
-				local hasnumber = element[STARTVALUE] ~= nil
-				import_paragraphs(styles, importer, element,
-					hasnumber and "LN" or "LB"
-				)
+		end
+	end
+end
+
+import_list = function(
+		styles: ODResolvedStyleMap, importer: Importer, tokens: Tokens)
+	local STARTVALUE = TEXT_NS .. " start-value"
+
+	while true do
+		local event, ns, name, attrs = tokens()
+		if not event or (event == "closetag") then
+			return
+		elseif (event == "opentag") then
+			local hasnumber = attrs[STARTVALUE] ~= nil
+			import_paragraphs(styles, importer, tokens,
+				hasnumber and "LN" or "LB"
+			)
+		end
+	end
+end
+
+-- Reads a styles.xml or content.xml document, collecting the styles it
+-- defines and (given an importer) importing the text.
+local function import_xml(styles: ODStyleMap, importer: Importer?, xml)
+	local tokens: Tokens = XMLTokens(xml)
+
+	-- Find the root element.
+
+	while true do
+		local event = tokens()
+		if not event then
+			return
+		elseif (event == "opentag") then
+			break
+		end
+	end
+
+	while true do
+		local event, ns, name = tokens()
+		if not event or (event == "closetag") then
+			return
+		elseif (event == "opentag") then
+			if (ns == OFFICE_NS)
+					and ((name == "styles") or (name == "automatic-styles")) then
+				collect_styles(styles, tokens)
+			elseif importer and (ns == OFFICE_NS) and (name == "body") then
+				-- All the styles come before the body.
+				local resolved = resolve_parent_styles(styles)
+
+				while true do
+					local event, ns, name = tokens()
+					if not event or (event == "closetag") then
+						break
+					elseif (event == "opentag") then
+						if (ns == OFFICE_NS) and (name == "text") then
+							import_paragraphs(resolved, importer, tokens, "P")
+						else
+							skip_element(tokens)
+						end
+					end
+				end
+			else
+				skip_element(tokens)
 			end
 		end
 	end
@@ -212,44 +340,33 @@ function Cmd.ImportODTFile(filename)
 	
 	ImmediateMessage("Importing...")	
 
-	-- Load the styles and content subdocuments.
+	-- Open the styles and content subdocuments; these are decompressed as
+	-- they're parsed.
 	
-	local stylesxml: any = ReadFromZip(filename, "styles.xml")
-	local contentxml: any = ReadFromZip(filename, "content.xml")
+	local zip = OpenZip(filename)
+	local stylesxml = zip and zip:open("styles.xml")
+	local contentxml = zip and zip:open("content.xml")
+	if zip then
+		zip:close()
+	end
 	if not stylesxml or not contentxml then
 		ModalMessage(nil, "The import failed, probably because the file could not be found.")
 		QueueRedraw()
 		return false
 	end
 		
-	stylesxml = ParseXML(stylesxml)
-	contentxml = ParseXML(contentxml)
-
 	-- Find out what text styles the document creates (so we can identify
-	-- italic and underlined text).
-	
-	local styles: ODStyleMap = {}
-	collect_styles(styles, stylesxml)
-	collect_styles(styles, contentxml)
-	resolve_parent_styles(styles)
+	-- italic and underlined text), and then actually import the content.
 
-	-- Actually import the content.
-	
+	local styles: ODStyleMap = {}
 	local document = CreateDocument()
 	local importer = CreateImporter(document)
 	importer:reset()
 
-	local BODY = OFFICE_NS .. " body"
-	local TEXT = OFFICE_NS .. " text"
-	for _, element in ipairs(contentxml) do
-		if (element._name == BODY) then
-			for _, element in ipairs(element) do
-				if (element._name == TEXT) then
-					import_paragraphs(styles, importer, element, "P")
-				end
-			end
-		end 
-	end
+	import_xml(styles, nil, stylesxml)
+	import_xml(styles, importer, contentxml)
+	stylesxml:close()
+	contentxml:close()
 
 	-- All the importers produce a blank line at the beginning of the
 	-- document (the default content made by CreateDocument()). Remove it.
@@ -7,6 +7,7 @@ local ITALIC = wg.ITALIC
 local UNDERLINE = wg.UNDERLINE
 local ParseWord = wg.parseword
 local WriteU8 = wg.writeu8
+local ImportText = wg.importtext
 local bitand = bit32.band
 local bitor = bit32.bor
 local bitxor = bit32.bxor
@@ -19,14 +20,10 @@ local table_concat = table.concat
 -----------------------------------------------------------------------------
 -- The importer itself.
 
-function Cmd.ImportTextString(data: string)
+function Cmd.ImportTextString(data: string | MappedFile)
 	local document = CreateDocument()
-	local fp = CreateIStream(data)
-	for l in fp:lines() do
-		l = CanonicaliseString(l)
-		l = l:gsub("%c+", "")
-		local p = CreateParagraph("P", ParseStringIntoWords(l))
-		document:appendParagraph(p)
+	for _, words in ImportText(data) do
+		document:appendParagraph(CreateParagraph("P", words))
 	end
 
 	-- Remove the blank paragraph at the beginning of the document.
@@ -39,5 +36,6 @@ function Cmd.ImportTextString(data: string)
 end
 
 function Cmd.ImportTextFile(filename)
-	return ImportFileWithUI(filename, "Import Text File", Cmd.ImportTextString)
+	return ImportFileWithUI(filename, "Import Text File", Cmd.ImportTextString,
+		true)
 end
@@ -18,6 +18,9 @@ local SetUnicode = wg.setunicode
 local PrintErr = wg.printerr
 local PrintOut = wg.printout
 local ReadFile = wg.readfile
+local Sync = wg.sync
+local GetTime = wg.time
+local TraceStartup = wg.tracestartup
 
 local redrawpending = true
 
@@ -39,6 +42,9 @@ HOME = wg.getenv("HOME") or wg.getenv("USERPROFILE") or "."
 CONFIGDIR = HOME .. "/.wordgrinder"
 local configfile = CONFIGDIR.."/startup.lua"
 
+-- Where --trace-startup wants the timeline; false once it's been written.
+local startuptrace: (string | false)? = nil
+
 -- Determine the installation directory (Windows only).
 
 if (ARCH == "windows") then
@@ -90,6 +96,7 @@ function ResetDocumentSet()
 
     FireEvent("DocumentCreated")
     FireEvent("RegisterAddons")
+    TraceStartup("RegisterAddons")
 end
 
 do
@@ -107,6 +114,88 @@ end
 -- This function contains the word processor proper, including the main event
 -- loop.
 
+-- Idle listeners with something to do later (such as an autosave which
+-- isn't due yet) ask for the next Idle event here; if none do, the event
+-- loop sleeps until the next key.
+
+local idlerequest: number? = nil
+
+function RequestIdle(delay: number)
+    local t = wg.time() + delay
+    if not idlerequest or (t < idlerequest) then
+        idlerequest = t
+    end
+end
+
+-- Returns the function which the event loop hands each key and mouse event
+-- to. The typing benchmarks replay recorded keys through one of these too.
+
+function CreateEventHandler(): (InputEvent) -> ()
+    local masterkeymap: {[string]: MenuCallback} = {
+        ["KEY_RESIZE"] = GroupCallback{ResizeScreen, RedrawScreen},
+        ["KEY_REDRAW"] = RedrawScreen,
+
+        [" "] = GroupCallback{ function() return Cmd.Checkpoint("word") end,
+            Cmd.TypeWhileSelected, Cmd.SplitCurrentWord },
+        ["KEY_RETURN"] = GroupCallback{ Cmd.Checkpoint, Cmd.TypeWhileSelected,
+            Cmd.SplitCurrentParagraph },
+        ["KEY_ESCAPE"] = GroupCallback{ Cmd.ActivateMenu },
+        ["KEY_MENU"] = GroupCallback{ Cmd.ActivateMenu },
+        ["KEY_QUIT"] = GroupCallback{ Cmd.TerminateProgram },
+    }
+
+    local function handle_key_event(c)
+        -- Anything in masterkeymap overrides everything else.
+        local f = masterkeymap[c]
+        if f then
+            f()
+        else
+            -- It's not in masterkeymap. If it's printable, insert it; if it's
+            -- not, look it up in the menu hierarchy.
+
+            if not c:match("^KEY_") then
+                Cmd.Checkpoint("typing")
+                Cmd.TypeWhileSelected()
+
+                Cmd.InsertStringIntoWord(FilterEvent("KeyTyped", c))
+            else
+                f = documentSet.menu:lookupAccelerator(c)
+                if f then
+                    f()
+                else
+                    NonmodalMessage(c:gsub("^KEY_", "").." is not bound --- try ESCAPE for a menu")
+                end
+            end
+        end
+    end
+
+    local oldmb = false
+    local oldmx, oldmy
+    local function handle_mouse_event(m)
+        if m.b and not oldmb then
+            oldmx = m.x
+            oldmy = m.y
+            Cmd.UnsetMark()
+            Cmd.GotoXYPosition(m.x, m.y)
+            Cmd.SetMark()
+        else
+            Cmd.GotoXYPosition(m.x, m.y)
+        end
+        if not m.b and oldmb and (m.x == oldmx) and (m.y == oldmy) then
+            Cmd.UnsetMark();
+        end
+        oldmb = m.b
+    end
+
+    return function(c: InputEvent)
+        if type(c) == "table" then
+            handle_mouse_event(c)
+        else
+            handle_key_event(c)
+        end
+    end
+end
+
 function WordProcessor(filename)
     ResetDocumentSet()
 
@@ -157,11 +246,14 @@ function WordProcessor(filename)
             CLIError("config file load error: "..e)
         end
     end
+    TraceStartup("config file")
 
     wg.initscreen()
 	FireEvent("ScreenInitialised")
     ResizeScreen()
+    TraceStartup("initscreen")
     RedrawScreen()
+    TraceStartup("first RedrawScreen")
 
     if filename then
         if not Cmd.LoadDocumentSet(filename) then
@@ -169,71 +261,58 @@ function WordProcessor(filename)
             -- doesn't exist, then we prime the document name so that saving the file is easy.
             documentSet.name = filename
         end
+        TraceStartup("load document")
     else
         FireEvent("DocumentLoaded")
     end
 
-    local masterkeymap: {[string]: MenuCallback} = {
-        ["KEY_RESIZE"] = GroupCallback{ResizeScreen, RedrawScreen},
-        ["KEY_REDRAW"] = RedrawScreen,
-
-        [" "] = GroupCallback{ Cmd.Checkpoint, Cmd.TypeWhileSelected,
-            Cmd.SplitCurrentWord },
-        ["KEY_RETURN"] = GroupCallback{ Cmd.Checkpoint, Cmd.TypeWhileSelected,
-            Cmd.SplitCurrentParagraph },
-        ["KEY_ESCAPE"] = GroupCallback{ Cmd.ActivateMenu },
-        ["KEY_MENU"] = GroupCallback{ Cmd.ActivateMenu },
-        ["KEY_QUIT"] = GroupCallback{ Cmd.TerminateProgram },
-    }
-
-    local function handle_key_event(c)
-        -- Anything in masterkeymap overrides everything else.
-        local f = masterkeymap[c]
-        if f then
-            f()
-        else
-            -- It's not in masterkeymap. If it's printable, insert it; if it's
-            -- not, look it up in the menu hierarchy.
-
-            if not c:match("^KEY_") then
-                Cmd.Checkpoint()
-                Cmd.TypeWhileSelected()
+    local handle_event = CreateEventHandler()
 
-                local payload = { value = c }
-                FireEvent("KeyTyped", payload)
+    -- When the debug addon is recording latencies, each event is timed from
+    -- when it arrives to when its command finishes and to when the screen
+    -- has been redrawn; events waiting for a redraw are kept here.
+    type PendingLatency = {name: string, received: number, dispatched: number}
+    local pendinglatencies: {PendingLatency} = {}
 
-                Cmd.InsertStringIntoWord(payload.value)
-            else
-                f = documentSet.menu:lookupAccelerator(c)
-                if f then
-                    f()
-                else
-                    NonmodalMessage(c:gsub("^KEY_", "").." is not bound --- try ESCAPE for a menu")
-                end
-            end
+    local function latencyname(c: InputEvent): string
+        if type(c) == "table" then
+            return "(mouse)"
+        elseif not c:match("^KEY_") then
+            return "(typing)"
         end
+        return c
     end
 
-    local oldmb = false
-    local oldmx, oldmy
-    local function handle_mouse_event(m)
-        if m.b and not oldmb then
-            oldmx = m.x
-            oldmy = m.y
-            Cmd.UnsetMark()
-            Cmd.GotoXYPosition(m.x, m.y)
-            Cmd.SetMark()
-        else
-            Cmd.GotoXYPosition(m.x, m.y)
+    local function redraw()
+        if not IsRecordingLatencies() then
+            table.clear(pendinglatencies)
+            RedrawScreen()
+            return
         end
-        if not m.b and oldmb and (m.x == oldmx) and (m.y == oldmy) then
-            Cmd.UnsetMark();
+
+        local start = GetTime()
+        RedrawScreen()
+        local drawn = GetTime()
+        Sync()
+        local synced = GetTime()
+        RecordLatency("(redraw)", drawn - start, synced - start)
+        for _, p in pendinglatencies do
+            RecordLatency(p.name, p.dispatched - p.received, synced - p.received)
         end
-        oldmb = m.b
+        table.clear(pendinglatencies)
     end
 
+    local lastredraw = 0
+    local idledeadline: number? = wg.time() + IDLE_TIME
+
+    -- While the user is typing, the collector is held back (see
+    -- wg.setgcmode) and only fed small steps between frames; once they
+    -- stop, the rest of the cycle is done in slices, checking for input
+    -- between each one.
+    local gcdeadline: number? = nil
     local function eventloop()
         local nl = string.char(13)
+        SetTaskPolling(true)
         while true do
             if documentSet._justchanged then
                 FireEvent("Changed")
@@ -242,25 +321,111 @@ function WordProcessor(filename)
 
             FlushAsyncEvents()
             FireEvent("WaitingForUser")
-            local c: InputEvent = "KEY_TIMEOUT"
+            -- Anything typed while a task was running comes first.
+            local buffered = TakeBufferedInput()
+            local c: InputEvent = buffered or "KEY_TIMEOUT"
             while (c == "KEY_TIMEOUT") do
                 if redrawpending then
-                    RedrawScreen()
-                    redrawpending = false
+                    -- If more input has already arrived (from a paste, or
+                    -- key repeat outrunning the redraw), deal with that
+                    -- first and redraw once it's all been done; but don't
+                    -- let the screen fall too far behind.
+                    if (wg.time() - lastredraw) < MAX_REDRAW_DELAY then
+                        c = wg.getchar(0)
+                    end
+
+                    if c == "KEY_TIMEOUT" then
+                        redraw()
+                        redrawpending = false
+                        lastredraw = wg.time()
+                        if gcdeadline then
+                            wg.gcstep(GC_FRAME_SLICE)
+                        end
+                    else
+                        break
+                    end
+                end
+
+                if startuptrace ~= false then
+                    -- This is as far as startup goes.
+                    TraceStartup("ready")
+                    local _, e = wg.finishstartuptrace(startuptrace)
+                    if e then
+                        NonmodalMessage("Cannot write startup trace: "..e)
+                    end
+                    startuptrace = false
                 end
 
-                c = GetCharWithBlinkingCursor(IDLE_TIME)
-                if (c == "KEY_TIMEOUT") then
-                    FireEvent("Idle")
+                if currentDocument:prewrap(PREWRAP_SLICE) then
+                    -- There's more to do; just check for input and go round
+                    -- again.
+                    c = wg.getchar(PREWRAP_POLL)
+                elseif gcdeadline and (wg.time() >= gcdeadline) then
+                    if wg.gcstep(GC_IDLE_SLICE) then
+                        wg.setgcmode("interactive")
+                        gcdeadline = nil
+                    else
+                        c = wg.getchar(PREWRAP_POLL)
+                    end
+                else
+                    -- Idle fires once the user stops typing, and then only
+                    -- when a listener has asked for it; otherwise, wait
+                    -- for input for as long as it takes. Deferred
+                    -- listeners may want waking up sooner.
+                    local deadline = idledeadline
+                    if gcdeadline and (not deadline or (gcdeadline < deadline)) then
+                        deadline = gcdeadline
+                    end
+                    local deferred = GetDeferredEventDeadline()
+                    local isdeferred = false
+                    if deferred and (not deadline or (deferred < deadline)) then
+                        deadline = deferred
+                        isdeferred = true
+                    end
+                    local timeout
+                    if deadline then
+                        timeout = math.max(0, deadline - wg.time())
+                    end
+                    c = GetCharWithBlinkingCursor(timeout)
+                    if (c == "KEY_TIMEOUT") and isdeferred then
+                        RunDeferredEvents()
+                        FlushAsyncEvents()
+                    elseif (c == "KEY_TIMEOUT") and gcdeadline
+                            and (wg.time() < (idledeadline or math.huge)) then
+                        -- Time to collect; go round again.
+                    elseif (c == "KEY_TIMEOUT") then
+                        idlerequest = nil
+                        FireEvent("Idle")
+                        FlushAsyncEvents()
+                        idledeadline = idlerequest
+                    end
                 end
             end
+            -- Keys are timed from when they reached the terminal, where the
+            -- backend knows, so time spent before reading them counts.
+            local received = GetTime()
+            idledeadline = received + IDLE_TIME
+            if not gcdeadline and (c ~= "KEY_TIMEOUT") then
+                wg.setgcmode("typing")
+            end
+            gcdeadline = received + GC_IDLE_DELAY
+            if not buffered and (c ~= "KEY_TIMEOUT") then
+                received = math.min(received, wg.getkeytime() or received)
+            end
             if c ~= "KEY_RESIZE" then
                 ResetNonmodalMessages()
             end
-            if type(c) == "table" then
-                handle_mouse_event(c)
-            else
-                handle_key_event(c)
+            handle_event(c)
+
+            if IsRecordingLatencies() then
+                local now = GetTime()
+                local name = latencyname(c)
+                if redrawpending then
+                    pendinglatencies[#pendinglatencies+1] =
+                        {name = name, received = received, dispatched = now}
+                else
+                    RecordLatency(name, now - received, now - received)
+                end
             end
 
             -- Process system quit messages.
@@ -297,11 +462,13 @@ function Main(...)
 
     ResetDocumentSet()
     LoadGlobalSettings()
+    TraceStartup("LoadGlobalSettings")
     ResetDocumentSet()
 
     local arg = {...}
     table_remove(arg, 1) -- contains the executable name
     local filename = nil
+    local session = nil
     do
         local function do_help()
             PrintErr("WordGrinder version ", VERSION, " © 2007-2020 David Given\n")
@@ -318,7 +485,33 @@ Options:
          --exec 'lua code'     Loads and executes the supplied code and then exits
                                (remaining arguments are passed to the script)
    -c    --convert src dest    Converts from one file format to another
+         --convert-batch file  Does every conversion listed in file, which has
+                               a source and destination per line separated by
+                               a tab, and reports on each to stdout
+         --export-all src.wg template
+                               Exports every document in src.wg to a file of
+                               its own, named after template, and reports on
+                               each to stdout
+         --concat out.wg in.wg...
+                               Writes out.wg with all the documents of each
+                               in.wg in turn, without loading them (the
+                               remaining arguments are all input files)
+         --server socket       Runs a conversion server on a Unix socket
+         --via socket ...      Runs the remaining options (which must be
+                               for conversions) on the server at socket
+         --session socket      Edits in a session which keeps running in the
+                               background, attaching to it if it already is
+         --attach socket       Attaches to the session at socket
          --config file.lua     Sets the name of the user config file
+         --stats               Reports how much memory was allocated on exit
+         --profile out.txt     Profiles the scripts, writing folded stacks to
+                               out.txt on exit
+         --record-keys keys.txt
+                               Records every key pressed, with timings, to
+                               keys.txt (for the typing benchmarks)
+         --trace-startup out.txt
+                               Writes how long each stage of startup took to
+                               out.txt once the editor is ready
 
 Only one filename may be specified, which is the name of a WordGrinder
 file to load on startup. If not given, you get a blank document instead.
@@ -328,6 +521,26 @@ extension. To specify a document name, use :name as a suffix. e.g.:
 
     wordgrinder --convert filename.wg:"Chapter 1" chapter1.odt
 
+A filename of - followed by a format reads from stdin or writes to stdout
+(except for .wg and .odt files). e.g.:
+
+    curl https://example.com | wordgrinder --convert -:html -:md
+
+With --export-all, each document is numbered and named in the output
+filename, so --export-all novel.wg out.html writes out.1.Foo.html,
+out.2.Bar.html and so on.
+
+For lots of conversions, start a server once and submit each one to it;
+they then skip starting up, and run in parallel. --via must come first:
+
+    wordgrinder --server /tmp/wg.sock &
+    wordgrinder --via /tmp/wg.sock --convert chapter1.wg chapter1.html
+
+A session outlives its terminal: File → Detach session (or closing the
+terminal) leaves it running with all its documents, and --attach or
+--session picks it up again from any other terminal. Sessions need the
+terminal version of WordGrinder.
+
 The user config file is a Lua file which is loaded and executed before
 the program starts up (but after any --lua files). It defaults to:
 
@@ -382,6 +595,71 @@ the program starts up (but after any --lua files). It defaults to:
             return 2
         end
 
+        local function do_convert_batch(opt)
+            if not opt then
+                CLIError("--convert-batch must have an argument")
+            end
+
+            CliConvertBatch(opt)
+            return 1
+        end
+
+        local function do_export_all(opt1, opt2)
+            if not opt1 or not opt2 then
+                CLIError("--export-all must have two arguments")
+            end
+
+            CliExportAll(opt1, opt2)
+            return 2
+        end
+
+        local function do_concat(opt1, opt2, ...)
+            if not opt1 or not opt2 then
+                CLIError("--concat must have an output file and at least one input file")
+            end
+
+            CliConcat(opt1, opt2, ...)
+        end
+
+        -- The job's process returns from CliServe() already started up, and
+        -- just runs the job's options.
+        local function do_server(opt)
+            if not opt then
+                CLIError("--server must have an argument")
+            end
+
+            local job = CliServe(opt)
+            local function unsupported(arg)
+                CLIError("'", arg, "' cannot be run on a server")
+            end
+            ParseArguments(job, {
+                ["c"]             = do_convert,
+                ["convert"]       = do_convert,
+                ["convert-batch"] = do_convert_batch,
+                ["export-all"]    = do_export_all,
+                [FILENAME_ARG]    = unsupported,
+                [UNKNOWN_ARG]     = unsupported,
+            })
+            wg.exit(0)
+        end
+
+        local function do_session(opt)
+            if not opt then
+                CLIError("--session must have an argument")
+            end
+            if not wg.startsession then
+                CLIError("sessions need the terminal version of WordGrinder")
+            end
+
+            session = opt
+            return 1
+        end
+
+        local function do_attach(opt)
+            -- Normally handled by main.cc, before any of this starts up.
+            CLIError("--attach must come first, and have an argument")
+        end
+
         local function do_config(opt)
             if not opt then
                 CLIError("--config must have an argument")
@@ -404,22 +682,67 @@ the program starts up (but after any --lua files). It defaults to:
             return 0
         end
 
+        local function do_stats(opt)
+            wg.reportallocations()
+            return 0
+        end
+
+        local function do_profile(opt)
+            if not opt then
+                CLIError("--profile must have an argument")
+            end
+
+            wg.startprofiler(opt)
+            return 1
+        end
+
+        local function do_record_keys(opt)
+            if not opt then
+                CLIError("--record-keys must have an argument")
+            end
+
+            local _, e = wg.recordkeys(opt)
+            if e then
+                CLIError("cannot record keys: "..e)
+            end
+            return 1
+        end
+
+        local function do_trace_startup(opt)
+            if not opt then
+                CLIError("--trace-startup must have an argument")
+            end
+
+            startuptrace = opt
+            return 1
+        end
+
         local function unrecognisedarg(arg)
             CLIError("unrecognised option '", arg, "' --- try --help for help")
             assert(false)
         end
 
         local argmap = {
-            ["h"]          = do_help,
-            ["help"]       = do_help,
-            ["lua"]        = do_lua,
-            ["exec"]       = do_exec,
-            ["c"]          = do_convert,
-            ["convert"]    = do_convert,
-            ["config"]     = do_config,
-            ["8"]          = do_8bit,
-            [FILENAME_ARG] = do_filename,
-            [UNKNOWN_ARG]  = unrecognisedarg,
+            ["h"]            = do_help,
+            ["help"]         = do_help,
+            ["lua"]          = do_lua,
+            ["exec"]         = do_exec,
+            ["c"]            = do_convert,
+            ["convert"]      = do_convert,
+            ["convert-batch"] = do_convert_batch,
+            ["export-all"]   = do_export_all,
+            ["concat"]       = do_concat,
+            ["server"]       = do_server,
+            ["session"]      = do_session,
+            ["attach"]       = do_attach,
+            ["config"]       = do_config,
+            ["8"]            = do_8bit,
+            ["stats"]        = do_stats,
+            ["profile"]      = do_profile,
+            ["record-keys"]  = do_record_keys,
+            ["trace-startup"] = do_trace_startup,
+            [FILENAME_ARG]   = do_filename,
+            [UNKNOWN_ARG]    = unrecognisedarg,
         }
 
         -- Do the actual argument parsing.
@@ -427,6 +750,15 @@ the program starts up (but after any --lua files). It defaults to:
         ParseArguments(arg, argmap)
     end
 
+    -- Only the session itself returns from this; the process which was run
+    -- becomes its first client.
+    if session then
+        local _, e = assert(wg.startsession)(session)
+        if e then
+            CLIError("cannot start a session on ", session, ": ", e)
+        end
+    end
+
     if filename and
             not filename:find("^/") and
             not filename:find("^[a-zA-Z]:[/\\]") then
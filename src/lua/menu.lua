@@ -18,6 +18,17 @@ local menu_tab = {}
 local key_tab: {[string]: string} = {}
 local menu_stack: {StackedMenu} = {}
 
+-- What each key does, as worked out by lookupAccelerator(), so that a
+-- keystroke is one lookup however many menus and overrides there are. It's
+-- for one menu tree at a time, and is forgotten whenever a menu, an
+-- accelerator or a key override changes. Keys which aren't bound are false.
+local key_callbacks: {[string]: any} = {}
+local key_callbacks_tree: MenuTree? = nil
+
+function ForgetKeyCallbacks()
+	key_callbacks = {}
+end
+
 local UseUnicode = wg.useunicode
 
 type MenuItem = {
@@ -96,6 +107,7 @@ function CreateMenu(n: string, m: {MenuItem}, replaces: Menu?): Menu
 	end
 
 	menu.maxwidth = w
+	ForgetKeyCallbacks()
 	return menu
 end
 
@@ -108,12 +120,16 @@ local function submenu(menu: Menu)
 			key_tab[item.ak] = nil
 		end
 	end
+	ForgetKeyCallbacks()
 end
 
 local DocumentsMenu = CreateMenu("Documents", {})
 local ParagraphStylesMenu = CreateMenu("Paragraph Styles", {})
 
 local cp = Cmd.Checkpoint
+local function dcp()
+	return Cmd.Checkpoint("delete")
+end
 
 function GroupCallback(fns: {MenuCallback})
 	return function()
@@ -177,11 +193,13 @@ local ExportMenu = CreateMenu("Export current document",
 local DocumentSettingsMenu = CreateMenu("Document settings",
 {
     E("FSautosave",     "A", "Autosave...",       nil,         Cmd.ConfigureAutosave),
+    E("FSfileformat",   "F", "File format...",    nil,         Cmd.ConfigureFileFormat),
     E("FSscrapbook",    "S", "Scrapbook...",      nil,         Cmd.ConfigureScrapbook),
     E("FSHTMLExport",   "H", "HTML export...",    nil,         Cmd.ConfigureHTMLExport),
 	E("FSPageCount",    "P", "Page count...",     nil,         Cmd.ConfigurePageCount),
 	E("FSSmartquotes",  "Q", "Smart quotes...",   nil,         Cmd.ConfigureSmartQuotes),
 	E("FSSpellchecker", "K", "Spellchecker...",   nil,         Cmd.ConfigureSpellchecker),
+	E("FSWordIndex",    "W", "Word index...",     nil,         Cmd.ConfigureWordIndex),
 })
 
 local GlobalSettingsMenu = CreateMenu("Global settings",
@@ -190,8 +208,14 @@ local GlobalSettingsMenu = CreateMenu("Global settings",
 	E("FSlookandfeel", "L", "Change look and feel...",       nil,   Cmd.ConfigureLookAndFeel),
 	E("FSDictionary",  "D", "Load new system dictionary...", nil,   Cmd.ConfigureSystemDictionary),
 	E("FSdirectories", "R", "Change directories...",         nil,   Cmd.ConfigureDirectories),
+	E("FSundo",        "U", "Undo buffer...",                nil,   Cmd.ConfigureUndo),
+	E("FScache",       "C", "Session cache...",              nil,   Cmd.ConfigureDerivedCache),
 	separator,
 	E("FSDebug",       "X", "Debugging options...",    		 nil,   Cmd.ConfigureDebug),
+	E("FSProfile",     "P", "Start/stop profiler",           nil,   Cmd.ToggleProfiler),
+	E("FSTrace",       "T", "Start/stop span trace",         nil,   Cmd.ToggleTrace),
+	E("FSLatency",     "K", "Keystroke latencies...",        nil,   Cmd.ShowLatencies),
+	E("FSMemory",      "M", "Memory report...",              nil,   Cmd.MemoryReport),
 })
 
 local FileMenu = CreateMenu("File",
@@ -201,6 +225,8 @@ local FileMenu = CreateMenu("File",
 	E("FS",         "S", "Save document set",         "^S",        Cmd.SaveCurrentDocument),
 	E("FA",         "A", "Save document set as...",   nil,         Cmd.SaveCurrentDocumentAs),
 	E("FR",         "R", "Load recent document >",    nil,         Cmd.LoadRecentDocument),
+	E("FV",         "V", "View text file...",         nil,         Cmd.ViewTextFile),
+	E("FK",         "K", "Compare with file...",      nil,         Cmd.CompareWithFile),
 	separator,
 	E("FCtemplate", "C", "Create from template...",   nil,         Cmd.CreateDocumentSetFromTemplate),
 	E("FMtemplate", "M", "Save as template...",       nil,         Cmd.SaveCurrentDocumentAsTemplate),
@@ -214,6 +240,7 @@ local FileMenu = CreateMenu("File",
 	M("Fglobals",   "G", "Global settings >",         nil,         GlobalSettingsMenu),
 	separator,
 	E("Fabout",     "Z", "About WordGrinder...",      nil,         Cmd.AboutWordGrinder),
+	E("FY",         "Y", "Detach session",            nil,         Cmd.DetachSession),
 	E("FQ",         "X", "Exit",                      "^Q",        Cmd.TerminateProgram),
 })
 
@@ -228,6 +255,7 @@ local SpellcheckMenu = CreateMenu("Spellchecker",
 {
 	E("ECfind",     "F", "Find next misspelt word",        "^L",   Cmd.FindNextMisspeltWord),
 	E("ECadd",      "A", "Add current word to dictionary", "^M",   cp, Cmd.AddToUserDictionary),
+	E("ECsuggest",  "S", "Suggest spellings...",           nil,    cp, Cmd.SuggestSpelling),
 })
 
 local EditMenu = CreateMenu("Edit",
@@ -243,10 +271,15 @@ local EditMenu = CreateMenu("Edit",
 	E("EF",         "F", "Find and replace...",       "^F",        Cmd.Find),
 	E("EN",         "N", "Find next",                 "^K",        Cmd.FindNext),
 	E("ER",         "R", "Replace then find",         "^R",        cp, Cmd.ReplaceThenFind),
+	E("EA",         "A", "Replace all",               nil,         cp, Cmd.ReplaceAll),
+	E("EI",         "I", "Find in all documents...",  nil,         Cmd.FindInAllDocuments),
 	E("Esq",        "Q", "Smartquotify selection",    nil,         Cmd.Smartquotify),
 	E("Eusq",       "W", "Unsmartquotify selection",  nil,         Cmd.Unsmartquotify),
 	separator,
 	E("EG",         "G", "Go to...",                  "^G",        Cmd.Goto),
+	E("EJ",         "J", "Go to page...",             nil,         Cmd.GotoPage),
+	E("EO",         "O", "Word frequencies...",       nil,         Cmd.ShowWordFrequencies),
+	E("EB",         "B", "Document statistics...",    nil,         Cmd.ShowDocumentStatistics),
 	M("Escrapbook", "S", "Scrapbook >",               nil,         ScrapbookMenu),
 	M("Espell",     "K", "Spellchecker >",            nil,         SpellcheckMenu),
 })
@@ -268,6 +301,8 @@ local StyleMenu = CreateMenu("Style",
 	separator,
 	M("SP",     "P", "Change paragraph style >",   "^P",        ParagraphStylesMenu),
 	M("SM",     "M", "Set margin mode >",          nil,         MarginMenu),
+	E("SV",     "V", "Toggle outline view",        nil,         Cmd.ToggleOutlineView),
+	E("SF",     "F", "Fold or unfold section",     nil,         Cmd.ToggleOutlineSection),
 	E("SS",     "S", "Toggle status bar",          nil,         Cmd.ToggleStatusBar),
 })
 
@@ -304,8 +339,8 @@ local NavigationMenu = CreateMenu("Navigation",
 	E("ZPGDN",  nil, "Page down",                    "PGDN",       Cmd.MoveWhileSelected, Cmd.GotoNextPage),
 	E("ZSPGUP", nil, "Selection page up",            "SPGUP",      Cmd.SetMark, Cmd.GotoPreviousPage),
 	E("ZSPGDN", nil, "Selection page down",          "SPGDN",      Cmd.SetMark, Cmd.GotoNextPage),
-	E("ZDPC",   nil, "Delete previous character",    "BACKSPACE",  cp, Cmd.DeleteSelectionOrPreviousChar),
-	E("ZDNC",   nil, "Delete next character",        "DELETE",     cp, Cmd.DeleteSelectionOrNextChar),
+	E("ZDPC",   nil, "Delete previous character",    "BACKSPACE",  dcp, Cmd.DeleteSelectionOrPreviousChar),
+	E("ZDNC",   nil, "Delete next character",        "DELETE",     dcp, Cmd.DeleteSelectionOrNextChar),
 	E("ZDW",    nil, "Delete word",                  "^E",         cp, Cmd.TypeWhileSelected, Cmd.DeleteWord),
 	E("ZM",     nil, "Toggle mark",                  "^@",         Cmd.ToggleMark),
 })
@@ -509,6 +544,7 @@ function MenuTree.runmenu(self, x: number, y: number, menu: Menu): boolean?
 						if ak then
 							self.accelerators[ak] = nil
 							self.accelerators[item.id] = nil
+							ForgetKeyCallbacks()
 							self:drawmenustack()
 						end
 					end
@@ -534,6 +570,7 @@ function MenuTree.runmenu(self, x: number, y: number, menu: Menu): boolean?
 
 									self.accelerators[ak] = item.id
 									self.accelerators[item.id] = ak
+									ForgetKeyCallbacks()
 								end
 								self:drawmenustack()
 							end
@@ -595,7 +632,7 @@ function MenuTree.runmenu(self, x: number, y: number, menu: Menu): boolean?
 	end
 end
 
-function MenuTree.lookupAccelerator(self, c)
+local function findaccelerator(self, c: string): any
 	c = c:gsub("^KEY_", ""):upper()
 
 	-- Check the overrides table and only then the documentset keymap.
@@ -631,6 +668,20 @@ function MenuTree.lookupAccelerator(self, c)
 	return f
 end
 
+function MenuTree.lookupAccelerator(self, c)
+	if key_callbacks_tree ~= self then
+		ForgetKeyCallbacks()
+		key_callbacks_tree = self
+	end
+
+	local f = key_callbacks[c]
+	if f == nil then
+		f = findaccelerator(self, c) or false
+		key_callbacks[c] = f
+	end
+	return f or nil
+end
+
 function CreateMenuTree(): MenuTree
 	local my_key_tab: {[string|boolean]: string|boolean} = {}
 	for ak, id in pairs(key_tab) do
@@ -0,0 +1,94 @@
+--!nonstrict
+-- © 2026 David Given.
+-- WordGrinder is licensed under the MIT open source license. See the COPYING
+-- file in this distribution for the full text.
+
+-----------------------------------------------------------------------------
+-- Most sessions never import or export anything, so those modules aren't
+-- loaded at startup (they're LAZY_SRCS in src/lua/build.py). Instead each of
+-- the globals they define starts off as a stub which loads the module, which
+-- replaces the stub, and then calls the real thing. Anything holding on to a
+-- stub (like the menus) keeps working.
+
+local LoadModule = wg.loadmodule
+
+local loaded: {[string]: boolean} = {}
+local modules: {string} = {}
+
+local function ensureloaded(module: string)
+	if not loaded[module] then
+		loaded[module] = true
+		LoadModule(module)
+	end
+end
+
+local function stubs(module: string, t: {[string]: any}, names: {string})
+	modules[#modules+1] = module
+	for _, name in names do
+		local function stub(...)
+			ensureloaded(module)
+			local f = rawget(t, name)
+			assert(f ~= stub, "module "..module.." didn't define "..name)
+			return f(...)
+		end
+		t[name] = stub
+	end
+end
+
+stubs("src/lua/xml.lua", _G, {"ParseXML"})
+
+stubs("src/lua/export/text.lua", Cmd,
+	{"ExportTextFile", "ExportToTextString"})
+stubs("src/lua/export/latex.lua", Cmd,
+	{"ExportLatexFile", "ExportToLatexString"})
+stubs("src/lua/export/troff.lua", Cmd,
+	{"ExportTroffFile", "ExportToTroffString"})
+stubs("src/lua/export/opendocument.lua", Cmd,
+	{"ExportODTFile", "ExportToODTString"})
+stubs("src/lua/export/org.lua", Cmd,
+	{"ExportOrgFile", "ExportToOrgString"})
+stubs("src/lua/export/markdown.lua", Cmd,
+	{"ExportMarkdownFile", "ExportToMarkdownString"})
+
+stubs("src/lua/import/html.lua", Cmd,
+	{"ImportHTMLString", "ImportHTMLFile"})
+stubs("src/lua/import/text.lua", Cmd,
+	{"ImportTextString", "ImportTextFile"})
+stubs("src/lua/import/opendocument.lua", Cmd,
+	{"ImportODTFile"})
+stubs("src/lua/import/markdown.lua", Cmd,
+	{"ImportMarkdownString", "ImportMarkdownFile"})
+
+stubs("src/lua/viewer.lua", Cmd, {"ViewTextFile"})
+
+-- The Lua reference exporters are looked up by format name.
+
+local EXPORTERMODULES: {[string]: string} =
+{
+	text = "src/lua/export/text.lua",
+	markdown = "src/lua/export/markdown.lua",
+}
+
+setmetatable(LuaExporters, {
+	__index = function(t, format)
+		local module = EXPORTERMODULES[format]
+		if module then
+			ensureloaded(module)
+			return rawget(t, format)
+		end
+		return nil
+	end
+})
+
+-- Loads every lazy module now, for processes which are going to be forked
+-- (see CliServe()) and would otherwise each load them again.
+
+function LoadLazyModules()
+	for _, module in modules do
+		ensureloaded(module)
+	end
+	for _, module in EXPORTERMODULES do
+		ensureloaded(module)
+	end
+end
+
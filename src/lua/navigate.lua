@@ -4,18 +4,18 @@
 -- file in this distribution for the full text.
 
 local int = math.floor
-local GetBytesOfCharacter = wg.getbytesofcharacter
 local GetStringWidth = wg.getstringwidth
 local NextCharInWord = wg.nextcharinword
 local PrevCharInWord = wg.prevcharinword
 local InsertIntoWord = wg.insertintoword
 local DeleteFromWord = wg.deletefromword
-local ApplyStyleToWord = wg.applystyletoword
+local ApplyStyleToParagraph = wg.applystyletoparagraph
 local GetStyleFromWord = wg.getstylefromword
 local CreateStyleByte = wg.createstylebyte
-local ReadU8 = wg.readu8
-local WriteU8 = wg.writeu8
-local P = M.P
+local FindText = wg.findtext
+local FindAllText = wg.findalltext
+local FindInParagraph = wg.findinparagraph
+local FindInParagraphs = wg.findinparagraphs
 local table_concat = table.concat
 local unpack = rawget(_G, "unpack") or table.unpack
 
@@ -51,13 +51,18 @@ function Cmd.GotoEndOfDocument()
 	return Cmd.GotoEndOfParagraph()
 end
 
+-- In the outline view, moving between paragraphs steps over folded
+-- sections (see addons/goto.lua).
+
 function Cmd.GotoPreviousParagraph()
 	if (currentDocument.cp == 1) then
 		QueueRedraw()
 		return false
 	end
 
-	currentDocument.cp = currentDocument.cp - 1
+	local cp = currentDocument.cp
+	local folds = GetOutlineFolds(currentDocument)
+	currentDocument.cp = (folds and folds(cp - 1)) or (cp - 1)
 	currentDocument.cw = 1
 	currentDocument.co = 1
 
@@ -66,12 +71,18 @@ function Cmd.GotoPreviousParagraph()
 end
 
 function Cmd.GotoNextParagraph()
-	if (currentDocument.cp == #currentDocument) then
+	local cp = currentDocument.cp
+	local folds = GetOutlineFolds(currentDocument)
+	local _, last = nil, nil
+	if folds then
+		_, last = folds(cp)
+	end
+	if (cp == #currentDocument) or (last == #currentDocument) then
 		QueueRedraw()
 		return false
 	end
 
-	currentDocument.cp = currentDocument.cp + 1
+	currentDocument.cp = (last or cp) + 1
 	currentDocument.cw = 1
 	currentDocument.co = 1
 
@@ -183,10 +194,7 @@ function Cmd.InsertStringIntoWord(c)
 	if not co then
 		return false
 	else
-		currentDocument[cp] = CreateParagraph(paragraph.style,
-			paragraph:sub(1, cw-1),
-			s,
-			paragraph:sub(cw+1))
+		currentDocument[cp] = paragraph:replaceWords(cw, 1, s)
 		currentDocument.co = co
 
 		documentSet:touch()
@@ -244,11 +252,8 @@ function Cmd.SplitCurrentWord()
 	local left = DeleteFromWord(word, co, #word+1)
 	local right = DeleteFromWord(word, 1, co)
 
-	currentDocument[cp] = CreateParagraph(paragraph.style,
-		paragraph:sub(1, cw-1),
-		left,
-		styleprime..right,
-		paragraph:sub(cw+1))
+	currentDocument[cp] = paragraph:replaceWords(cw, 1,
+		left, styleprime..right)
 
 	currentDocument.cw = cw + 1
 	currentDocument.co = 1 + styleprimelen -- yes, this means that co has a minimum of 2
@@ -264,7 +269,7 @@ function Cmd.JoinWithNextParagraph()
 		return false
 	end
 
-	currentDocument[cp] = CreateParagraph(currentDocument[cp].style,
+	currentDocument[cp] = CreateHashedParagraph(currentDocument[cp].style,
 		currentDocument[cp],
 		currentDocument[cp+1])
 	currentDocument:deleteParagraphAt(cp+1)
@@ -288,10 +293,7 @@ function Cmd.JoinWithNextWord()
 	local word, co, _ = InsertIntoWord(paragraph[cw+1], paragraph[cw], 1, 0)
 	if word and co then
 		currentDocument.co = co
-		currentDocument[cp] = CreateParagraph(paragraph.style,
-			paragraph:sub(1, cw-1),
-			word,
-			paragraph:sub(cw+2))
+		currentDocument[cp] = paragraph:replaceWords(cw, 2, word)
 
 		documentSet:touch()
 		QueueRedraw()
@@ -323,10 +325,8 @@ function Cmd.DeleteNextChar()
 	end
 	assert(nextco)
 
-	currentDocument[cp] = CreateParagraph(paragraph.style,
-		paragraph:sub(1, cw-1),
-		DeleteFromWord(word, co, nextco),
-		paragraph:sub(cw+1))
+	currentDocument[cp] = paragraph:replaceWords(cw, 1,
+		DeleteFromWord(word, co, nextco))
 
 	documentSet:touch()
 	QueueRedraw()
@@ -348,10 +348,8 @@ function Cmd.DeleteWordLeftOfCursor()
 	local paragraph = currentDocument[cp]
 	local word = paragraph[cw]
 
-	currentDocument[cp] = CreateParagraph(paragraph.style,
-		paragraph:sub(1, cw-1),
-		DeleteFromWord(word, 1, co),
-		paragraph:sub(cw+1))
+	currentDocument[cp] = paragraph:replaceWords(cw, 1,
+		DeleteFromWord(word, 1, co))
 	currentDocument.co = 1
 
 	documentSet:touch()
@@ -376,7 +374,10 @@ function Cmd.DeleteWord()
 	return true
 end
 
-function Cmd.SplitCurrentParagraph()
+-- Splits the current paragraph at the cursor, leaving the cursor at the
+-- beginning of the second half. Any paragraphs given are put between the
+-- halves, with the same single move of the rest of the document.
+local function splitcurrentparagraph(between: {Paragraph}?): boolean
 	if (currentDocument.co == 1) and (currentDocument.cw == 1) then
 		-- Beginning of paragraph; we're going to create a new, empty paragraph
 		-- so we need to split to make sure there's an empty word for it to
@@ -392,18 +393,26 @@ function Cmd.SplitCurrentParagraph()
 
 	local cp, cw = currentDocument.cp, currentDocument.cw
 	local paragraph = currentDocument[cp]
-	local p1 = CreateParagraph(paragraph.style, paragraph:sub(1, cw-1))
-	local p2 = CreateParagraph(paragraph.style, paragraph:sub(cw))
+	local p1 = CreateHashedParagraph(paragraph.style, paragraph:slice(1, cw-1))
+	local p2 = CreateHashedParagraph(paragraph.style, paragraph:slice(cw))
 
+	local inserted = { p1 }
+	if between then
+		table.move(between, 1, #between, 2, inserted)
+	end
 	currentDocument[cp] = p2
-	currentDocument:insertParagraphBefore(p1, cp)
-	currentDocument.cp = currentDocument.cp + 1
+	currentDocument:insertParagraphsBefore(inserted, cp)
+	currentDocument.cp = currentDocument.cp + #inserted
 	currentDocument.cw = 1
 	currentDocument.co = 1
 	QueueRedraw()
 	return true
 end
 
+function Cmd.SplitCurrentParagraph()
+	return splitcurrentparagraph()
+end
+
 function Cmd.GotoXPosition(pos: number)
 	local paragraph = currentDocument[currentDocument.cp]
 	local wd = paragraph:wrap()
@@ -548,44 +557,26 @@ function Cmd.ApplyStyleToSelection(s)
 
 	for p = mp1, mp2 do
 		local paragraph = currentDocument[p]
-		local firstword = 1
-		local lastword = #paragraph
+		local firstword, fo = 1, 1
+		local lastword, lo = #paragraph, 0
 
 		if (p == mp1) then
-			firstword = mw1
+			firstword, fo = mw1, mo1
 		end
 		if (p == mp2) then
-			lastword = mw2
+			lastword, lo = mw2, mo2
 		end
 
-		local words = {}
-		for wn = firstword, lastword do
-			local word = paragraph[wn]
+		-- Paragraphs which already have the style are left alone.
 
-			local fo = 1
-			local lo = #word + 1
-
-			if (p == mp1) and (wn == mw1) then
-				fo = mo1
+		local words, newco = ApplyStyleToParagraph(paragraph, sor, sand,
+			firstword, fo, lastword, lo, (p == cp) and cw or 0, co)
+		if words then
+			currentDocument[p] = CreateHashedParagraph(paragraph.style, words)
+			if (p == cp) then
+				currentDocument.co = newco
 			end
-
-			if (p == mp2) and (wn == mw2) then
-				lo = mo2
-			end
-
-			if (p == cp) and (wn == cw) then
-				word, currentDocument.co = ApplyStyleToWord(word, sor, sand, fo, lo, co)
-			else
-				word = ApplyStyleToWord(word, sor, sand, fo, lo, 0)
-			end
-
-			words[#words+1] = word
 		end
-
-		currentDocument[p] = CreateParagraph(paragraph.style,
-			paragraph:sub(1, firstword-1),
-			words,
-			paragraph:sub(lastword+1))
 	end
 
 	Cmd.UnsetMark()
@@ -643,24 +634,42 @@ end
 -- @return                   true if it's all right to go ahead, false to cancel
 
 function ConfirmDocumentErasure()
+	-- A failed save will mark the document set as changed again.
+	FinishBackgroundSave()
+
 	if documentSet._changed then
 		if not PromptForYesNo("Document set not saved!", "Some of the documents in this document set contain unsaved edits. Are you sure you want to discard them, without saving first?") then
 			return false
 		end
+		DiscardJournal()
 	end
 	return true
 end
 
 function Cmd.TerminateProgram()
 	if ConfirmDocumentErasure() then
+		PublishClipboard()
+		DiscardUndoSpill()
+		FlushDerivedData()
 		wg.exit(0)
 	end
 
 	return false
 end
 
+function Cmd.DetachSession()
+	-- Everything is left just as it is for the next client.
+	local detach = wg.detachsession
+	if not detach or not detach() then
+		ModalMessage("Not in a session", "This WordGrinder isn't running as a session, so there's nothing to detach from. (Use --session to start one.)")
+		return false
+	end
+	return true
+end
+
 function Cmd.CreateBlankDocumentSet()
 	if ConfirmDocumentErasure() then
+		RetireDocumentSet()
 		ResetDocumentSet()
 		QueueRedraw()
 		return true
@@ -685,7 +694,7 @@ function Cmd.ChangeParagraphStyle(style)
 	end
 
 	for p = first, last do
-		currentDocument[p] = CreateParagraph(style, currentDocument[p])
+		currentDocument[p] = CreateHashedParagraph(style, currentDocument[p])
 	end
 
 	documentSet:touch()
@@ -784,11 +793,15 @@ function Cmd.Copy(keepselection: boolean?)
 	local buffer = CreateDocument()
 
 	-- Copy all the paragraphs from the selected area into the clipboard.
+	-- Paragraphs are immutable, so the clipboard can share them, except for
+	-- numbered ones, which the clipboard will renumber.
 
 	for p = mp1, mp2 do
 		local paragraph = currentDocument[p]
-
-		buffer:appendParagraph(paragraph:copy())
+		if documentStyles[paragraph.style].numbered then
+			paragraph = paragraph:copy()
+		end
+		buffer:appendParagraph(paragraph)
 	end
 
 	-- Remove the default content of the clipboard document.
@@ -801,7 +814,7 @@ function Cmd.Copy(keepselection: boolean?)
 	if (mw1 > 1) then
 		paragraph = buffer[1]
 		buffer[1] = CreateParagraph(paragraph.style,
-			paragraph:sub(mw1))
+			paragraph:slice(mw1))
 		if (mp1 == mp2) then
 			mw2 = mw2 - mw1 + 1
 		end
@@ -813,7 +826,7 @@ function Cmd.Copy(keepselection: boolean?)
 	paragraph = buffer[#buffer]
 	if (mw2 < #paragraph) then
 		buffer[#buffer] = CreateParagraph(paragraph.style,
-			paragraph:sub(1, mw2))
+			paragraph:slice(1, mw2))
 	end
 
 	-- Remove any characters in the trailing word that weren't copied.
@@ -822,7 +835,7 @@ function Cmd.Copy(keepselection: boolean?)
 	local word = paragraph[#paragraph]
 	if word then
 		buffer[#buffer] = CreateParagraph(paragraph.style,
-			paragraph:sub(1, #paragraph-1),
+			paragraph:slice(1, #paragraph-1),
 			DeleteFromWord(word, mo2, word:len()+1))
 	end
 
@@ -833,7 +846,7 @@ function Cmd.Copy(keepselection: boolean?)
 	if word then
 		buffer[1] = CreateParagraph(paragraph.style,
 			{DeleteFromWord(word, 1, mo1)},
-			paragraph:sub(2))
+			paragraph:slice(2))
 	end
 
 	buffer:renumber()
@@ -864,10 +877,10 @@ function Cmd.Paste()
 	Cmd.SplitCurrentWord()
 	local paragraph = currentDocument[currentDocument.cp]
 
-	currentDocument[currentDocument.cp] = CreateParagraph(paragraph.style,
-		paragraph:sub(1, cw),
+	currentDocument[currentDocument.cp] = CreateHashedParagraph(paragraph.style,
+		paragraph:slice(1, cw),
 		buffer[1],
-		paragraph:sub(cw+1))
+		paragraph:slice(cw+1))
 	currentDocument.cw = currentDocument.cw + #buffer[1]
 	currentDocument.co = 1
 
@@ -883,21 +896,17 @@ function Cmd.Paste()
 	-- More than one paragraph?
 
 	if (#buffer > 1) then
-		-- Copy any remaining paragraphs in whole.
-
-		Cmd.SplitCurrentParagraph()
-
-		local p = 2
-		for p = 2, #buffer do
-			local paragraph = buffer[p]
-			currentDocument:insertParagraphBefore(
-				CreateParagraph(paragraph.style, paragraph),
-				currentDocument.cp)
-
-			currentDocument.cp = currentDocument.cp + 1
-			currentDocument.cw = 1
-			currentDocument.co = 1
+		-- Copy any remaining paragraphs in whole, splitting the current
+		-- paragraph around them. They're copied as paragraphs can't appear
+		-- twice in a document (they carry their list numbers, and the change
+		-- tracking goes by identity), and the clipboard's may be this
+		-- document's own.
+
+		local paragraphs = table.move(buffer, 2, #buffer, 1, {})
+		for i, paragraph in paragraphs do
+			paragraphs[i] = CreateParagraph(paragraph.style, paragraph)
 		end
+		splitcurrentparagraph(paragraphs)
 	end
 
 	-- Splice the last word of the section just pasted.
@@ -914,121 +923,276 @@ function Cmd.Delete()
 
 	local mp1, mw1, mo1, mp2, mw2, mo2 = currentDocument:getMarks()
 
-	-- Put the cursor at the end of the selection and split.
+	-- What's left of the paragraphs the selection spans, the part before its
+	-- start and the part after its end, becomes a single paragraph, so the
+	-- rest of the document only moves once however much is deleted.
 
-	currentDocument.cp = mp2
-	currentDocument.cw = mw2
-	currentDocument.co = mo2
-	if not Cmd.SplitCurrentParagraph() then
-		return false
-	end
+	local first = currentDocument[mp1]
+	local last = currentDocument[mp2]
+	local lastword = last[mw2]
+	local right = DeleteFromWord(lastword, 1, mo2)
+
+	local paragraph: Paragraph, co: number
+	if (mo1 == 1) and (mw1 > 1) then
+		-- The selection started at a word boundary, so keep it.
 
-	-- Put the cursor at the beginning of the selection and split.
+		paragraph = CreateHashedParagraph(first.style,
+			first:slice(1, mw1-1), {right}, last:slice(mw2+1))
+		co = 1
+	else
+		-- Otherwise merge the two partial words.
+
+		local firstword = first[mw1]
+		local left = DeleteFromWord(firstword, mo1, #firstword+1)
+		local word, wco = InsertIntoWord(right, left, 1, 0)
+		if not word or not wco then
+			return false
+		end
+		co = wco
 
+		paragraph = CreateHashedParagraph(first.style,
+			first:slice(1, mw1-1), {word}, last:slice(mw2+1))
+	end
+
+	currentDocument[mp1] = paragraph
+	currentDocument:deleteParagraphsAt(mp1+1, mp2 - mp1)
 	currentDocument.cp = mp1
 	currentDocument.cw = mw1
-	currentDocument.co = mo1
-	if not Cmd.SplitCurrentParagraph() then
-		return false
+	currentDocument.co = co
+	documentSet:touch()
+	QueueRedraw()
+
+	NonmodalMessage("Selected area deleted.")
+	return Cmd.UnsetMark()
+end
+
+-- Incremental find. While the find dialogue is open, every match for what's
+-- been typed so far is highlighted. The document-wide search only works out
+-- which paragraphs have matches, and as typing more can only take matches
+-- away, each keystroke just searches the paragraphs the previous one found.
+-- Where in the paragraph the matches are is only worked out for the ones
+-- which are drawn.
+
+type IncrementalFind = {
+	text: string,
+	regex: boolean,
+	document: Document,
+	generation: number,
+	paragraphs: {number},
+	candidates: {[number]: boolean},
+	highlights: {[number]: {{number}}},
+}
+
+local incremental: IncrementalFind? = nil
+
+-- The trailing arguments to the find functions: the smart quotes, which also
+-- match plain ones, and whether the text is a regular expression.
+local function getfindoptions(regex: boolean?)
+	local smartquotes = documentSet.addons.smartquotes or {}
+	return smartquotes.leftsingle, smartquotes.rightsingle,
+		smartquotes.leftdouble, smartquotes.rightdouble, regex or false
+end
+
+-- Returns the text to search for, or nil and a message saying why there
+-- isn't any. Words in ordinary search text are matched against consecutive
+-- words in the document, however they were separated, so the whitespace
+-- is normalised; regular expressions are used as they are.
+function GetSearchText(findtext: string?, regex: boolean?): (string?, string?)
+	if not findtext then
+		return nil, "Nothing to search for."
 	end
+	assert(findtext)
 
-	-- We now have a whole number of paragraphs containing the area to delete.
-	-- Delete them.
+	if regex then
+		if (findtext == "") then
+			return nil, "Nothing to search for."
+		end
+		local e = wg.checkregex(findtext)
+		if e then
+			return nil, "Bad regular expression: "..e.."."
+		end
+		return findtext
+	end
 
-	for i = 1, (mp2 - mp1 + 1) do
-		currentDocument:deleteParagraphAt(currentDocument.cp)
+	local text = table_concat(SplitString(findtext, "%s"), " ")
+	if (text == "") then
+		return nil, "Nothing to search for."
 	end
+	return text
+end
 
-	-- And merge the two areas together again.
+-- Updates the highlighted matches for new search text, returning how many
+-- paragraphs contain one; nil or empty text (or a bad regular expression)
+-- turns highlighting off.
+function SetIncrementalFind(findtext: string?, isregex: boolean?): number?
+	local regex = isregex or false
+	local text = GetSearchText(findtext, regex)
+	if not text then
+		incremental = nil
+		QueueRedraw()
+		return nil
+	end
 
-	if not (Cmd.GotoPreviousWordW() and
-	        Cmd.GotoEndOfWord() and
-			Cmd.JoinWithNextWord()) then
-		return false
+	local generation = currentDocument:sync()
+	local old = incremental
+	local previous: {number}? = nil
+	if old and (old.document == currentDocument)
+			and (old.generation == generation) and (old.regex == regex) then
+		if old.text == text then
+			return #old.paragraphs
+		end
+		if not regex and (text:sub(1, #old.text) == old.text) then
+			previous = old.paragraphs
+		end
 	end
 
-	-- If the selection started at a word boundary, make sure it's preserved.
+	local paragraphs = FindInParagraphs(currentDocument, text, previous,
+		getfindoptions(regex))
+	local candidates = {}
+	for _, pn in paragraphs do
+		candidates[pn] = true
+	end
 
-	if (mo1 == 1) and (mw1 > 1) then
-		if not Cmd.SplitCurrentWord() then
-			return false
+	incremental = {
+		text = text,
+		regex = regex,
+		document = currentDocument,
+		generation = generation,
+		paragraphs = paragraphs,
+		candidates = candidates,
+		highlights = {},
+	}
+	QueueRedraw()
+	return #paragraphs
+end
+
+-- Returns the parts of paragraph pn covered by matches, as an array of
+-- {first word, first offset, last word, end offset} (where an end offset of
+-- 0 means the end of the word), or nil if there aren't any.
+function GetIncrementalFindHighlights(pn: number): {{number}}?
+	local inc = incremental
+	if not inc or (inc.document ~= currentDocument) then
+		return nil
+	end
+
+	local cached = inc.highlights[pn]
+	if cached then
+		return (#cached > 0) and cached or nil
+	end
+	local highlights = {}
+
+	-- Matches can start in an earlier paragraph, but they can only span
+	-- as many paragraph breaks as there are spaces in the text (and regular
+	-- expressions never span any).
+	local _, spaces = inc.text:gsub(" ", "")
+	if inc.regex then
+		spaces = 0
+	end
+	for sp = math.max(1, pn - spaces), pn do
+		if inc.candidates[sp] then
+			local m = FindInParagraph(currentDocument, inc.text, sp,
+				getfindoptions(inc.regex))
+			for i = 1, #m, 5 do
+				local mw, mo, ep, ew, eo = m[i], m[i+1], m[i+2], m[i+3], m[i+4]
+				if (ep >= pn) then
+					if (sp < pn) then
+						mw, mo = 1, 1
+					end
+					if (ep > pn) then
+						ew, eo = #currentDocument[pn], 0
+					end
+					highlights[#highlights+1] = {mw, mo, ew, eo}
+				end
+			end
 		end
 	end
 
-	NonmodalMessage("Selected area deleted.")
-	return Cmd.UnsetMark()
+	inc.highlights[pn] = highlights
+	return (#highlights > 0) and highlights or nil
 end
 
-function Cmd.Find(findtext, replacetext)
+function Cmd.Find(findtext, replacetext, regex: boolean?)
 	if not findtext then
-		findtext, replacetext = FindAndReplaceDialogue()
+		findtext, replacetext, regex = FindAndReplaceDialogue(nil, nil,
+			documentSet.findregex)
 		if not findtext or (findtext == "") then
 			return false
 		end
 	end
 
 	documentSet.findtext = findtext
-	documentSet._findpatterns = nil
 	documentSet.replacetext = replacetext
+	documentSet.findregex = regex or false
 	return Cmd.FindNext()
 end
 
-local function compile_patterns(text)
-	local patterns = {}
-	local words = SplitString(text, "%s")
-	local smartquotes = documentSet.addons.smartquotes or {}
-
-	for _, w in ipairs(words) do
-		-- w is a word from the pattern. We need to perform the following
-		-- changes:
-		--   - we need to insert %c* between all letters, to allow it to match
-		--     control codes;
-		--   - we want to  convert single letters like 'q' into '[qQ]' to make
-		--     the pattern case insensitive;
-		--   - we want to anchor internal word boundaries with ^ and $ to make
-		--     them match whole words.
-		-- This is done in several stages, for simplicity.
-
-		local wp = {}
-		local i = 1
-		local len = w:len()
-		while (i <= len) do
-			local c: any = WriteU8((ReadU8(w, i)))
-			i = i + GetBytesOfCharacter(c)
-
-			if ((c >= "A") and (c <= "Z")) or
-			    ((c >= "a") and (c <= "z")) then
-				c = P("["..c:upper()..c:lower().."]")
-			elseif (c == "'") then
-				c = P("'") + P(smartquotes.leftsingle) + P(smartquotes.rightsingle)
-			elseif (c == '"') then
-				c = P('"') + P(smartquotes.leftdouble) + P(smartquotes.rightdouble)
+-- With the word index turned on (see addons/wordindex.lua), only the
+-- paragraphs containing a word which the text could start in need to be
+-- searched. Returns those, or nil if the index can't be used: that's when
+-- it's off, or when the first word of the text contains anything but
+-- letters and digits, which might be folded differently from the index.
+local function getfindcandidates(text: string): {number}?
+	local first = text:match("^[^ ]+")
+	if not first or not first:find("^%w+$") then
+		return nil
+	end
+	first = first:lower()
+
+	return GetIndexedParagraphs(currentDocument,
+		function(w)
+			return w:lower():find(first, 1, true) ~= nil
+		end)
+end
+
+-- Does the same as FindText(), but only looks in the given paragraphs.
+local function findincandidates(text: string, pns: {number})
+		: (number?, number?, number?, number?, number?, number?)
+	local n = #pns
+	if (n == 0) then
+		return nil
+	end
+
+	local cp, cw, co =
+		currentDocument.cp, currentDocument.cw, currentDocument.co
+	local first = 1
+	while (first <= n) and (pns[first] < cp) do
+		first = first + 1
+	end
+
+	-- The last pass goes back to the first candidate, in case the only
+	-- matches in the current paragraph are before the cursor.
+	for pass = 0, n do
+		local pn = pns[((first - 1 + pass) % n) + 1]
+		local m = FindInParagraph(currentDocument, text, pn, getfindoptions())
+		for i = 1, #m, 5 do
+			if (pn ~= cp) or (pass == n)
+					or (m[i] > cw) or ((m[i] == cw) and (m[i+1] >= co)) then
+				return pn, m[i], m[i+1], m[i+2], m[i+3], m[i+4]
 			end
-
-			wp[#wp+1] = P(c)
 		end
-
-		patterns[#patterns + 1] = P(unpack(Intersperse(wp, "%c*")))
-	end
-
-	for i = 2, (#patterns - 1) do
-		patterns[i] = P("^%c*", patterns[i], "%c*$")
-	end
-
-	if (#patterns > 1) then
-		patterns[1] = P(patterns[1], "%c*$")
-		patterns[#patterns] = P("^%c*", patterns[#patterns])
-	end
-
-	for i = 1, #patterns do
-		patterns[i] = P("()", patterns[i], "()")
 	end
-
-	for i = 1, #patterns do
-		patterns[i] = patterns[i]:compile()
+	return nil
+end
+
+-- Searches the document a piece at a time, as a task.
+local FIND_SLICE = 1000
+
+local function findtext(text: string, regex: boolean?)
+		: (number?, number?, number?, number?, number?, number?)
+	local lsq, rsq, ldq, rdq = getfindoptions(regex)
+	local cp, cw, co =
+		currentDocument.cp, currentDocument.cw, currentDocument.co
+	local n = #currentDocument
+	for pass = 0, n, FIND_SLICE do
+		TaskCheckpoint(pass / n)
+		local mp, mw, mo, ep, ew, eo = FindText(currentDocument, text,
+			cp, cw, co, lsq, rsq, ldq, rdq, regex or false,
+			pass, pass + FIND_SLICE - 1)
+		if mp then
+			return mp, mw, mo, ep, ew, eo
+		end
 	end
-
-	return patterns
+	return nil
 end
 
 function Cmd.FindNext()
@@ -1038,102 +1202,45 @@ function Cmd.FindNext()
 
 	ImmediateMessage("Searching...")
 
-	-- Get the compiled pattern for the text we're searching for.
-
-	if not documentSet._findpatterns then
-		documentSet._findpatterns = compile_patterns(documentSet.findtext)
-	end
-	assert(documentSet._findpatterns)
-	local patterns = documentSet._findpatterns
-
-	-- Start at the current cursor position.
-
-	local cp, cw, co = currentDocument.cp, currentDocument.cw, currentDocument.co
-	if (#patterns == 0) then
+	local regex = documentSet.findregex
+	local text, e = GetSearchText(documentSet.findtext, regex)
+	if not text then
 		QueueRedraw()
-		NonmodalMessage("Nothing to search for.")
+		NonmodalMessage(assert(e))
 		return false
 	end
+	assert(text)
 
-	local pattern = patterns[1]
-
-	-- Keep looping until we reach the starting point again.
-
-	while true do
-		local word = currentDocument[cp][cw]
-		local s, e = pattern(word, co)
-		local _
-
-		if s then
-			-- We got a match! First, though, check to see if the remaining
-			-- words in the pattern match.
-
-			local ep, ew = cp, cw
-			local pi = 2
-			local found = true
-			while (pi <= #patterns) do
-				ew = ew + 1
-				if (ew > #currentDocument[ep]) then
-					ep = ep + 1
-					ew = 1
-					if (ep > #currentDocument) then
-						found = false
-						break
-					end
-				end
-
-				word = currentDocument[ep][ew]
-				if not word then
-					found = false
-					break
-				end
-
-				_, e = patterns[pi](word)
-				if not e then
-					found = false
-					break
-				end
-
-				pi = pi + 1
-			end
-
-			if found then
-				assert(s)
-				assert(e)
-				currentDocument.cp = ep
-				currentDocument.cw = ew
-				currentDocument.co = e
-				currentDocument.mp = cp
-				currentDocument.mw = cw
-				currentDocument.mo = s
-				NonmodalMessage("Found.")
-				QueueRedraw()
-				return true
-			end
-		end
-
-		-- Nothing. Move on to the next word.
-
-		co = 1
-		cw = cw + 1
-		if (cw > #currentDocument[cp]) then
-			cw = 1
-			cp = cp + 1
-			if (cp > #currentDocument) then
-				cp = 1
-			end
-		end
-
-		-- Check to see if we've scanned everything.
-
-		if (cp == currentDocument.cp) and (cw == currentDocument.cw) and (co == 1) then
-			break
-		end
+	local mp, mw, mo, cp, cw, co
+	local candidates = nil
+	if not regex then
+		candidates = getfindcandidates(text)
+	end
+	local ok
+	if candidates then
+		ok, mp, mw, mo, cp, cw, co = true, findincandidates(text, candidates)
+	else
+		ok, mp, mw, mo, cp, cw, co = RunTask("Searching...", findtext, text,
+			regex)
 	end
 
 	QueueRedraw()
-	NonmodalMessage("Not found.")
-	return false
+	if not ok then
+		return false
+	end
+	if not mp then
+		NonmodalMessage("Not found.")
+		return false
+	end
+
+	currentDocument.cp = assert(cp)
+	currentDocument.cw = assert(cw)
+	currentDocument.co = assert(co)
+	currentDocument.mp = mp
+	currentDocument.mw = mw
+	currentDocument.mo = mo
+	NonmodalMessage("Found.")
+	return true
 end
 
 function Cmd.ReplaceThenFind()
@@ -1162,6 +1269,125 @@ function Cmd.ReplaceThenFind()
 	return Cmd.FindNext()
 end
 
+-- Appends a piece of a word to a paragraph under construction, either as
+-- a new word or joined to the end of the last one.
+local function appendpiece(words: {string}, piece: string, newword: boolean)
+	local n = #words
+	if newword or (n == 0) then
+		words[n+1] = piece
+	else
+		words[n] = (InsertIntoWord(words[n], piece, #words[n]+1, 0))
+	end
+end
+
+-- Appends the part of paragraph p between (sw, so) and (ew, eo) to a
+-- paragraph under construction; the first piece is joined on.
+local function appendrange(words: {string}, p: Paragraph, sw: number,
+		so: number, ew: number, eo: number)
+	local w = p[sw]
+	if sw == ew then
+		appendpiece(words, DeleteFromWord(DeleteFromWord(w, eo, #w+1), 1, so),
+			false)
+		return
+	end
+
+	appendpiece(words, DeleteFromWord(w, 1, so), false)
+	for i = sw+1, ew-1 do
+		appendpiece(words, p[i], true)
+	end
+	w = p[ew]
+	appendpiece(words, DeleteFromWord(w, eo, #w+1), true)
+end
+
+-- Replaces every match in the document at once. Paragraphs without a match
+-- are kept as they are; the rest are rebuilt from the pieces between the
+-- matches, so this is a single change (and a single undo step) no matter
+-- how many matches there are.
+function Cmd.ReplaceAll()
+	if not documentSet.findtext then
+		return false
+	end
+
+	ImmediateMessage("Replacing...")
+	QueueRedraw()
+
+	local text, e = GetSearchText(documentSet.findtext, documentSet.findregex)
+	if not text then
+		NonmodalMessage(assert(e))
+		return false
+	end
+	assert(text)
+
+	local doc = currentDocument
+	local matches = FindAllText(doc, text,
+		getfindoptions(documentSet.findregex))
+	if (#matches == 0) then
+		NonmodalMessage("Not found.")
+		return false
+	end
+
+	local replacement = SplitString(documentSet.replacetext or "", "%s")
+	local out: {Paragraph} = {}
+	local done = 0
+	local words: {string}? = nil
+	local style = ""
+	local sp, sw, so = 1, 1, 1
+	local cp, cw, co = 1, 1, 1
+
+	local function finish()
+		local p = doc[sp]
+		local w = assert(words)
+		appendrange(w, p, sw, so, #p, #p[#p]+1)
+		out[#out+1] = CreateParagraph(style, w)
+		words = nil
+		done = sp
+	end
+
+	for _, m in matches do
+		local mp, mw, mo, ep, ew, eo = unpack(m)
+		if words and (sp ~= mp) then
+			finish()
+		end
+		if not words then
+			table.move(doc :: any, done+1, mp-1, #out+1, out)
+			words = {}
+			style = doc[mp].style
+			sp, sw, so = mp, 1, 1
+		end
+
+		local w = assert(words)
+		appendrange(w, doc[mp], sw, so, mw, mo)
+		local last = w[#w]
+		local hint = last and GetStyleFromWord(last, #last+1) or 0
+		for i, r in replacement do
+			if (i > 1) then
+				w[#w+1] = ""
+			end
+			w[#w] = (InsertIntoWord(w[#w] or "", r, #(w[#w] or "")+1, hint))
+		end
+
+		sp, sw, so = ep, ew, eo
+		cp, cw = #out+1, math.max(#w, 1)
+		co = #(w[cw] or "") + 1
+	end
+	finish()
+	table.move(doc :: any, done+1, #doc, #out+1, out)
+
+	table.move(out, 1, #out, 1, doc :: any)
+	for i = #doc, #out+1, -1 do
+		doc[i] = nil
+	end
+	doc.cp = cp
+	doc.cw = cw
+	doc.co = math.min(co, #doc[cp][cw]+1)
+	doc.mp = nil
+	documentSet:touch()
+
+	NonmodalMessage(string.format("Replaced %d %s.", #matches,
+		(#matches == 1) and "match" or "matches"))
+	return true
+end
+
 function Cmd.ToggleStatusBar()
 	if documentSet.statusbar then
 		documentSet.statusbar = false
@@ -1,3 +1,4 @@
+--!native
 -- © 2023 David Given.
 -- WordGrinder is licensed under the MIT open source license. See the COPYING
 -- file in this distribution for the full text.
@@ -6,7 +7,8 @@ local table_remove = table.remove
 local table_insert = table.insert
 local table_concat = table.concat
 local Write = wg.write
-local WriteStyled = wg.writestyled
+local WriteStyledLine = wg.writestyledline
+local WriteParagraphLine = wg.writeparagraphline
 local ClearToEOL = wg.cleartoeol
 local SetNormal = wg.setnormal
 local SetBold = wg.setbold
@@ -16,6 +18,13 @@ local SetDim = wg.setdim
 local GetStringWidth = wg.getstringwidth
 local GetBytesOfCharacter = wg.getbytesofcharacter
 local GetWordText = wg.getwordtext
+local NativeCreateParagraph = wg.createparagraph
+local NativeCreateHashedParagraph = wg.createhashedparagraph
+local GetPackedWord = wg.getpackedword
+local PackParagraphs = wg.packparagraphs
+local ReplaceWords = wg.replacewords
+local WrapParagraph = wg.wrapparagraph
+local ParagraphHash = wg.paragraphhash
 local BOLD = wg.BOLD
 local ITALIC = wg.ITALIC
 local UNDERLINE = wg.UNDERLINE
@@ -39,11 +48,31 @@ type Line = {[number]: number, wn: number}
 
 type WrapData = {
 	wrapwidth: number,
+	indent1: number,
+	indent2: number,
+	fullstopspaces: boolean,
 	sentences: {[number]: boolean},
 	lines: {Line},
 	xs: {number},
 }
 
+-- The layout of a giant paragraph which an edit made this one from; see
+-- Paragraph.replaceWords().
+type WrapBase = {
+	wrapdata: WrapData,
+	first: number,
+	removed: number,
+	inserted: number,
+}
+
+-- A view of a run of a paragraph's words; see Paragraph.slice().
+type ParagraphSlice = {
+	[number]: string,
+	_of: any, -- the paragraph
+	_first: number,
+	_count: number,
+}
+
 type Paragraph = {
 	[number]: string,
 	__iter: (self: Paragraph) -> (any, any, number),
@@ -52,10 +81,17 @@ type Paragraph = {
 	style: string,
 
 	_wrapdata: WrapData?,
+	_wrapcache: {WrapData}?, -- older wrap results, most recent first
+	_wrapbase: WrapBase?, -- the layout this was edited from, until wrapped
+
+	_words: PackedWords?,
 
 	copy: (self: Paragraph) -> Paragraph,
+	replaceWords: (self: Paragraph, first: number, count: number,
+		...string) -> Paragraph,
 	wrap: (self: Paragraph, width: number?) -> WrapData,
-	renderLine: (self: Paragraph, line: Line, x: number, y: number) -> (),
+	renderLine: (self: Paragraph, line: Line, x: number, y: number,
+		highlights: {{number}}?) -> (),
 	renderMarkedLine: (self: Paragraph,
 		line: Line, x: number, y: number, width: number?, pn: number) -> (),
 	getLineOfWord: (self: Paragraph, wn: number) -> (number, number),
@@ -63,7 +99,10 @@ type Paragraph = {
 	getWordOfLine: (self: Paragraph, ln: number) -> number,
 	getXOffsetOfWord: (self: Paragraph, wn: number) -> (number, number, number),
 	sub: (self: Paragraph, start: number, count: number?) -> {string},
+	slice: (self: Paragraph, start: number, count: number?) -> ParagraphSlice,
 	asString: (self: Paragraph) -> string,
+	join: (self: Paragraph) -> string,
+	hash: (self: Paragraph) -> string,
 }
 
 function Paragraph.__iter(self: Paragraph)
@@ -79,25 +118,99 @@ function Paragraph.__iter(self: Paragraph)
 	return iter, self, 0
 end
 
-function CreateParagraph(style: string, ...: ({string}|string)): Paragraph
-	if type(style) ~= "string" then
-		error("paragraph style is not a string")
+-- Packed paragraphs keep their words in a single C userdata rather than as
+-- one string per word, which is much kinder to memory and the GC on large
+-- documents. They behave exactly like ordinary paragraphs as long as they're
+-- accessed through #p, p[i] and generalised iteration (not ipairs(), which
+-- ignores metamethods).
+
+local PackedParagraph = {}
+_G.PackedParagraph = PackedParagraph
+
+function PackedParagraph.__index(self: any, k: any): any
+	if type(k) == "number" then
+		return GetPackedWord(rawget(self, "_words"), k)
 	end
-	local words = {
-		style = style
-	}
+	return Paragraph[k]
+end
 
-	for _, t in ipairs({...}) do
-		if type(t) == "table" then
-			for _, w in ipairs(t) do
-				words[#words+1] = w
-			end
-		elseif type(t) == "string" then
-			words[#words+1] = t
+function PackedParagraph.__newindex(self: any, k: any, v: any)
+	if type(k) == "number" then
+		error("paragraphs are immutable")
+	end
+	rawset(self, k, v)
+end
+
+function PackedParagraph.__len(self: any): number
+	return #rawget(self, "_words")
+end
+
+function PackedParagraph.__iter(self: any)
+	local words = rawget(self, "_words")
+	local function iter(words: PackedWords, i: number): (number?, string?)
+		i = i + 1
+		local v = GetPackedWord(words, i)
+		if v then
+			return i, v
+		end
+		return nil, nil
+	end
+
+	return iter, words, 0
+end
+
+local packing = false
+
+-- Selects whether new paragraphs (including those read by the loader) are
+-- packed. Existing paragraphs are left as they are.
+function SetParagraphPacking(enabled: boolean)
+	packing = enabled
+	PackParagraphs(enabled)
+end
+
+-- A slice is a read-only view of a run of a paragraph's words, made by
+-- Paragraph.slice(). It's meant for passing to CreateParagraph(), which
+-- copies the words straight out of the original, but it can be indexed and
+-- iterated like an array too.
+
+local ParagraphSlice = {}
+
+function ParagraphSlice.__index(self: any, k: any): any
+	if (type(k) == "number") and (k >= 1) and (k <= rawget(self, "_count")) then
+		return rawget(self, "_of")[rawget(self, "_first") + k - 1]
+	end
+	return nil
+end
+
+function ParagraphSlice.__newindex(self: any, k: any, v: any)
+	error("paragraph slices are immutable")
+end
+
+function ParagraphSlice.__len(self: any): number
+	return rawget(self, "_count")
+end
+
+function ParagraphSlice.__iter(self: any)
+	local function iter(self: any, i: number): (number?, string?)
+		i = i + 1
+		local v = self[i]
+		if v then
+			return i, v
 		end
+		return nil, nil
 	end
 
-	return (setmetatable(words, Paragraph)::any) :: Paragraph
+	return iter, self, 0
+end
+
+-- The words may be given as strings, arrays of words, paragraphs or slices,
+-- in any combination; they're all flattened into the new paragraph in C.
+function CreateParagraph(style: string,
+		...: ({string}|ParagraphSlice|string)): Paragraph
+	if type(style) ~= "string" then
+		error("paragraph style is not a string")
+	end
+	return NativeCreateParagraph(style, ...)
 end
 
 function Paragraph.copy(self: Paragraph): Paragraph
@@ -110,100 +223,256 @@ function Paragraph.copy(self: Paragraph): Paragraph
 	return CreateParagraph(self.style, words)
 end
 
+-- Returns a new paragraph with count words starting at first replaced with
+-- the given ones; used by the editing commands, so it's done in C. For giant
+-- paragraphs, the new one remembers the old one's layout, so that wrapping it
+-- only has to rework the lines around the change.
+local BIGPARAGRAPH = 1000
+
+function Paragraph.replaceWords(self: Paragraph, first: number,
+		count: number, ...: string): Paragraph
+	local p = ReplaceWords(self, first, count, ...)
+	local wd = self._wrapdata
+	if wd and (#self >= BIGPARAGRAPH) then
+		local base: WrapBase = {
+			wrapdata = wd,
+			first = first,
+			removed = math.min(count, #self - first + 1),
+			inserted = select("#", ...),
+		}
+		p._wrapbase = base
+	end
+	return p
+end
+
+-- Returns the paragraph's layout for the given width and the current indent
+-- and full stop settings. A few older layouts are kept so that switching back
+-- and forth (between windowed and fullscreen, say) doesn't rewrap anything.
+local WRAPCACHESIZE = 3
+
+-- Layouts cost memory in proportion to the number of words in them, and
+-- every paragraph which has ever been displayed (including old versions on
+-- the undo stack) would otherwise keep its forever. So the total is kept
+-- under a budget by throwing away the layouts of the paragraphs which were
+-- least recently used; they'll just be rewrapped if they're wanted again.
+-- This is done from a timer, so that no layout disappears in the middle of
+-- a redraw.
+
+local layoutbudget = 500000 -- in words; 0 for no limit
+local layoutcost = 0 -- an overestimate, corrected by each eviction pass
+local layouttick = 0
+local layoutused: {[Paragraph]: number} = setmetatable({}, {__mode = "k"}) :: any
+local evicting = false
+
+local function costoflayouts(p: Paragraph): number
+	local cost = 0
+	local wd = p._wrapdata
+	if wd then
+		cost += #wd.xs + 1
+	end
+	local cache = p._wrapcache
+	if cache then
+		for _, wd in cache do
+			cost += #wd.xs + 1
+		end
+	end
+	return cost
+end
+
+-- Throws away the least recently used paragraph layouts until there are
+-- comfortably fewer than the budget allows (or all of them, if the budget is
+-- zero).
+
+function EvictParagraphLayouts(budget: number?)
+	evicting = false
+	budget = budget or layoutbudget
+	assert(budget)
+
+	local used = {}
+	local total = 0
+	for p, tick in layoutused do
+		local cost = costoflayouts(p)
+		if cost == 0 then
+			layoutused[p] = nil
+		else
+			used[#used+1] = {p = p, tick = tick, cost = cost}
+			total += cost
+		end
+	end
+	layoutcost = total
+	if (budget > 0) and (total <= budget) then
+		return
+	end
+
+	table.sort(used, function(a, b) return a.tick < b.tick end)
+	local target = budget * 3 // 4
+	for _, u in used do
+		if layoutcost <= target then
+			break
+		end
+		u.p._wrapdata = nil
+		u.p._wrapcache = nil
+		u.p._wrapbase = nil
+		layoutused[u.p] = nil
+		layoutcost -= u.cost
+	end
+end
+
+-- Sets the number of words' worth of layouts to keep, or 0 for no limit.
+
+function SetParagraphLayoutBudget(words: number)
+	layoutbudget = words
+	if (words > 0) and (layoutcost > words) then
+		EvictParagraphLayouts()
+	end
+end
+
+-- Returns the number of words' worth of layouts currently kept.
+
+function GetParagraphLayoutCost(): number
+	return layoutcost
+end
+
+local function wrapmatches(wd: WrapData?, width: number, indent1: number,
+		indent2: number, fullstopspaces: boolean): boolean
+	return (wd ~= nil) and (wd.wrapwidth == width)
+		and (wd.indent1 == indent1) and (wd.indent2 == indent2)
+		and (wd.fullstopspaces == fullstopspaces)
+end
+
 function Paragraph.wrap(self: Paragraph, width: number?): ()
 	width = width or currentDocument._wrapwidth or 80
 	assert(width)
 
-	if not self._wrapdata or self._wrapdata.wrapwidth ~= width then
-		local wrapdata = {}
-		wrapdata.wrapwidth = width
-
-		-- Recompute sentences.
-		
-		local issentence = true
-		local sentences = {}
-		for wn, word in self do
-			if issentence then
-				sentences[wn] = true
-				issentence = false
-			end
+	local indent1 = self:getIndentOfLine(1)
+	local indent2 = self:getIndentOfLine(2)
+	local fullstopspaces = WantFullStopSpaces()
 
-			if word:find("[^%a]$") then
-				issentence = true
-			end
-		end
-		sentences[#self] = true
-		wrapdata.sentences = sentences
-
-		-- Recompute line wrapping.
-		
-		local lines = {}
-		local line = {wn = 1}
-		local w = 0
-		local xs = {}
-		local fullstopspaces = WantFullStopSpaces()
-
-		width = width - self:getIndentOfLine(1)
-
-		for wn, word in ipairs(self) do
-			-- get width of word (including space)
-			local ww = GetStringWidth(word) + 1
-
-			-- add an extra space if the user asked for it
-			if fullstopspaces and word:find("%.$") then
-				ww = ww + 1
-			end
+	layouttick += 1
+	layoutused[self] = layouttick
 
-			xs[wn] = w
-			w = w + ww
-			if (w >= width) then
-				lines[#lines+1] = line
-				if #lines == 1 then
-					width = width + self:getIndentOfLine(1) - self:getIndentOfLine(2)
-				end
-				line = {wn = wn}
-				w = ww
-				xs[wn] = 0
-			end
+	local current = self._wrapdata
+	if wrapmatches(current, width, indent1, indent2, fullstopspaces) then
+		return current
+	end
+
+	local cache = self._wrapcache
+	if not cache then
+		cache = {}
+		self._wrapcache = cache
+	end
+	assert(cache)
 
-			line[#line+1] = wn
+	local wrapdata
+	for i, wd in ipairs(cache) do
+		if wrapmatches(wd, width, indent1, indent2, fullstopspaces) then
+			wrapdata = table_remove(cache, i)
+			break
 		end
+	end
+	if current then
+		table_insert(cache, 1, current)
+		cache[WRAPCACHESIZE] = nil
+	end
 
-		if (#line > 0) then
-			lines[#lines+1] = line
+	if not wrapdata then
+		local lines, xs, sentences
+		local base = self._wrapbase
+		if base and wrapmatches(base.wrapdata, width, indent1, indent2,
+				fullstopspaces) then
+			local old = base.wrapdata
+			lines, xs, sentences = WrapParagraph(self, width,
+				indent1, indent2, fullstopspaces,
+				old.lines, old.xs, old.sentences,
+				base.first, base.removed, base.inserted)
+		else
+			lines, xs, sentences = WrapParagraph(self, width,
+				indent1, indent2, fullstopspaces)
 		end
 
-		wrapdata.lines = lines
-		wrapdata.xs = xs
-		self._wrapdata = wrapdata
-		return wrapdata
-	else
-		return self._wrapdata
+		wrapdata = {
+			wrapwidth = width,
+			indent1 = indent1,
+			indent2 = indent2,
+			fullstopspaces = fullstopspaces,
+			lines = lines,
+			xs = xs,
+			sentences = sentences,
+		}
+
+		layoutcost += #xs + 1
+		if (layoutbudget > 0) and (layoutcost > layoutbudget)
+				and not evicting then
+			evicting = true
+			AddTimer(0, function() EvictParagraphLayouts() end)
+		end
+	end
+	self._wrapdata = wrapdata
+	self._wrapbase = nil
+	return wrapdata
+end
+
+-- Works out the highlight start and stop offsets for each word on a line
+-- from an array of {first word, first offset, last word, end offset}
+-- ranges, as used by WriteParagraphLine. Each word only has one highlight,
+-- so where several ranges cover it they're merged.
+local function gethighlights(line, ranges): ({number}, {number})
+	local revons = {}
+	local revoffs = {}
+	local lwn = line.wn
+	for i = 1, #line do
+		revons[i] = 0
+		revoffs[i] = 0
+	end
+
+	for _, r in ranges do
+		local w1, o1, w2, o2 = r[1], r[2], r[3], r[4]
+		for wn = math.max(w1, lwn), math.min(w2, lwn + #line - 1) do
+			local i = wn - lwn + 1
+			local s = (wn == w1) and o1 or 1
+			local e = (wn == w2) and o2 or 0
+			if (revons[i] == 0) then
+				revons[i] = s
+				revoffs[i] = e
+			else
+				revons[i] = math.min(revons[i], s)
+				if (revoffs[i] ~= 0) and ((e == 0) or (e > revoffs[i])) then
+					revoffs[i] = e
+				end
+			end
+		end
 	end
+	return revons, revoffs
 end
 
-function Paragraph.renderLine(self: Paragraph, line, x: number, y: number): ()
+function Paragraph.renderLine(self: Paragraph, line, x: number, y: number,
+		highlights: {{number}}?): ()
 	local cstyle = stylemarkup[self.style] or 0
-	local ostyle = 0
 	local wd = self._wrapdata
 	assert(wd)
 
-	for _, wn in ipairs(line) do
-		local w = self[wn]
+	local revons, revoffs
+	if highlights then
+		revons, revoffs = gethighlights(line, highlights)
+	end
 
-		local payload = {
-			word = w,
-			ostyle = ostyle,
-			cstyle = cstyle,
-			firstword = wd.sentences[wn]
-		}
-		FireEvent("DrawWord", payload)
+	if not HasActiveEventListeners("DrawWord") then
+		WriteParagraphLine(y, self, line, x, wd.xs, cstyle, revons, revoffs)
+		return
+	end
 
-		ostyle = WriteStyled(
-			x+wd.xs[wn], y,
-			payload.word,
-			payload.ostyle, 0, 0, payload.cstyle)
+	local xs = {}
+	local words = {}
+	local cstyles = {}
+	for i, wn in ipairs(line) do
+		local w = self[wn]
+
+		xs[i] = x+wd.xs[wn]
+		words[i] = w
+		cstyles[i] = FilterEvent("DrawWord", cstyle, w, wd.sentences[wn])
 	end
+
+	WriteStyledLine(y, xs, words, cstyles, revons, revoffs)
 end
 
 function Paragraph.renderMarkedLine(self: Paragraph, line, x, y, width, pn): ()
@@ -213,11 +482,17 @@ function Paragraph.renderMarkedLine(self: Paragraph, line, x, y, width, pn): ()
 	local mp1, mw1, mo1, mp2, mw2, mo2 = currentDocument:getMarks()
 
 	local cstyle = stylemarkup[self.style] or 0
-	local ostyle = 0
-	for wn, w in ipairs(line) do
+	local wd = self:wrap()
+	local fast = not HasActiveEventListeners("DrawWord")
+	local xs = {}
+	local words = {}
+	local cstyles = {}
+	local revons = {}
+	local revoffs = {}
+	for i, w in ipairs(line) do
 		local s, e
 
-		wn = lwn + wn - 1
+		local wn = lwn + i - 1
 
 		if (pn < mp1) or (pn > mp2) then
 			s = 0
@@ -252,32 +527,47 @@ function Paragraph.renderMarkedLine(self: Paragraph, line, x, y, width, pn): ()
 			end
 		end
 
-		local wd = self:wrap()
-		local payload = {
-			word = self[w],
-			ostyle = ostyle,
-			cstyle = cstyle,
-			firstword = wd.sentences[wn]
-		}
-		FireEvent("DrawWord", payload)
+		revons[i] = s or 0
+		revoffs[i] = e or 0
+
+		if not fast then
+			local word = self[w]
+
+			xs[i] = x+wd.xs[w]
+			words[i] = word
+			cstyles[i] = FilterEvent("DrawWord", cstyle, word, wd.sentences[wn])
+		end
+	end
 
-		ostyle = WriteStyled(x+wd.xs[w], y, payload.word,
-			payload.ostyle, s, e, payload.cstyle)
+	if fast then
+		WriteParagraphLine(y, self, line, x, wd.xs, cstyle, revons, revoffs)
+	else
+		WriteStyledLine(y, xs, words, cstyles, revons, revoffs)
 	end
 end
 
 -- returns: line number, word number in line
+-- Each line knows its first word, so this is a binary search; paragraphs can
+-- be thousands of words long. The first line can be empty (when the first
+-- word doesn't fit on it), hence looking for the last line starting at or
+-- before the word.
 function Paragraph.getLineOfWord(self: Paragraph, wn: number): (number, number)
-	local wd = self:wrap()
-	for ln, l in wd.lines do
-		if (wn <= #l) then
-			return ln, wn
-		end
-
-		wn = wn - #l
+	local lines = self:wrap().lines
+	local lo, hi = 1, #lines
+	local last = lines[hi]
+	if not last or (wn >= (last.wn + #last)) then
+		error("word out of range")
 	end
 
-	error("word out of range")
+	while (lo < hi) do
+		local mid = (lo + hi + 1) // 2
+		if (lines[mid].wn <= wn) then
+			lo = mid
+		else
+			hi = mid - 1
+		end
+	end
+	return lo, wn - lines[lo].wn + 1
 end
 
 
@@ -322,6 +612,28 @@ function Paragraph.sub(self: Paragraph, start: number, count: number?): {string}
 	return t
 end
 
+-- Like sub(), but returns a view of the words rather than copying them.
+function Paragraph.slice(self: Paragraph, start: number, count: number?):
+		ParagraphSlice
+	local n = #self - start + 1
+	count = if count then math.min(count, n) else n
+	local s = {
+		_of = self,
+		_first = start,
+		_count = math.max(assert(count), 0),
+	}
+	return (setmetatable(s, ParagraphSlice)::any) :: ParagraphSlice
+end
+
+-- return the (styled) words of the paragraph, separated by spaces.
+function Paragraph.join(self: Paragraph): string
+	local words = self._words
+	if words then
+		return words:join()
+	end
+	return table_concat(self :: any, " ")
+end
+
 -- return an unstyled string containing the contents of the paragraph.
 function Paragraph.asString(self: Paragraph): string
 	local s = {}
@@ -331,3 +643,30 @@ function Paragraph.asString(self: Paragraph): string
 
 	return table_concat(s, " ")
 end
+
+-- Returns a hash of the paragraph's style and words, as a string of 16 hex
+-- digits; paragraphs with the same content have the same hash. Paragraphs
+-- are immutable, so it's only worked out once.
+
+local hashes: {[Paragraph]: string} = setmetatable({}, {__mode = "k"}) :: any
+
+function Paragraph.hash(self: Paragraph): string
+	local h = hashes[self]
+	if not h then
+		h = ParagraphHash(self)
+		hashes[self] = h
+	end
+	return h
+end
+
+-- Like CreateParagraph(), but works out the hash while copying the words;
+-- for paragraphs going into a document, which will be hashed soon anyway.
+function CreateHashedParagraph(style: string,
+		...: ({string}|ParagraphSlice|string)): Paragraph
+	if type(style) ~= "string" then
+		error("paragraph style is not a string")
+	end
+	local p, h = NativeCreateHashedParagraph(style, ...)
+	hashes[p] = h
+	return p
+end
@@ -1,12 +1,13 @@
 --!nonstrict
+--!native
 -- © 2008 David Given.
 -- WordGrinder is licensed under the MIT open source license. See the COPYING
 -- file in this distribution for the full text.
 
 local Write = wg.write
 local GotoXY = wg.gotoxy
-local ClearScreen = wg.clearscreen
 local ClearArea = wg.cleararea
+local ScrollArea = wg.scrollarea
 local SetNormal = wg.setnormal
 local SetBold = wg.setbold
 local SetBright = wg.setbright
@@ -16,7 +17,10 @@ local SetDim = wg.setdim
 local GetStringWidth = wg.getstringwidth
 local ShowCursor = wg.showcursor
 local HideCursor = wg.hidecursor
+local SetCursorBlink = wg.setcursorblink
 local Sync = wg.sync
+local TraceBegin = wg.tracebegin
+local TraceEnd = wg.traceend
 
 local UseUnicode = wg.useunicode
 local BLINK_TIME = 0.8
@@ -69,16 +73,19 @@ function ResizeScreen()
 	return true
 end
 
-local function drawmargin(y: number, pn: number, p: Paragraph)
+local function getmargincontent(pn: number, p: Paragraph): string?
 	local controller = marginControllers[currentDocument.viewmode]
 	if controller.getcontent then
-		local s: string? = assert(controller.getcontent)(controller, pn, p)
+		return assert(controller.getcontent)(controller, pn, p)
+	end
+	return nil
+end
 
-		if s then
-			SetColour(Palette.StyleFG, Palette.Desktop)
-			SetDim()
-			RAlignInField(0, y, papermargin - 1, s)
-		end
+local function drawmargin(y: number, p: Paragraph, s: string?)
+	if s then
+		SetColour(Palette.StyleFG, Palette.Desktop)
+		SetDim()
+		RAlignInField(0, y, papermargin - 1, s)
 	end
 
 	local style = documentStyles[p.style]
@@ -109,35 +116,183 @@ local changed_tab =
 	[true] = "CHANGED"
 }
 
+-- The statusbar's fields, sorted by priority. These are reused for every
+-- redraw.
+local statusbarpriorities: {number} = {}
+local statusbarvalues: {string} = {}
+local statusbarcount = 0
+
+local function addstatusbarfield(self: StatusBar, priority: number,
+		value: string)
+	-- Insertion sort, keeping fields of the same priority in the order they
+	-- were added.
+	local n = statusbarcount + 1
+	while (n > 1) and (statusbarpriorities[n-1] > priority) do
+		statusbarpriorities[n] = statusbarpriorities[n-1]
+		statusbarvalues[n] = statusbarvalues[n-1]
+		n = n - 1
+	end
+	statusbarpriorities[n] = priority
+	statusbarvalues[n] = value
+	statusbarcount = statusbarcount + 1
+end
+
+local statusbar: StatusBar = { add = addstatusbarfield }
+
+-- Fields added with AddStatusBarField(), sorted by priority.
+local cachedfields: {CachedStatusbarField} = {}
+local cachedfieldsof: any = nil
+
+--- Adds a cached statusbar field.
+-- Rather than being rebuilt on every redraw, as BuildStatusBar fields are,
+-- the field's value is built by calling build() and then reused until one
+-- of the listed events fires, or (if an interval is given) that many
+-- seconds have gone by. build() may return nil to show nothing. Everything
+-- is rebuilt when a document is loaded or created, or the current document
+-- changes; anything else which changes what a field shows should call
+-- InvalidateStatusBarField().
+--
+-- @param priority           where the field goes; lower is further left
+-- @param events             the events which invalidate the field
+-- @param build              returns the field's value
+-- @param interval           optional maximum age of the value, in seconds
+-- @return                   the field, for InvalidateStatusBarField()
+
+function AddStatusBarField(priority: number, events: {string},
+		build: () -> string?, interval: number?): CachedStatusbarField
+	local field: CachedStatusbarField = {
+		priority = priority,
+		build = build,
+		interval = interval,
+		value = nil,
+		dirty = true,
+		expires = 0,
+	}
+
+	local n = #cachedfields + 1
+	while (n > 1) and (cachedfields[n-1].priority > priority) do
+		n = n - 1
+	end
+	table.insert(cachedfields, n, field)
+
+	for _, event in events do
+		AddEventListener(event :: any,
+			function()
+				field.dirty = true
+			end)
+	end
+	return field
+end
+
+--- Forces a cached statusbar field to be rebuilt on the next redraw.
+--
+-- @param field              the field returned by AddStatusBarField()
+
+function InvalidateStatusBarField(field: CachedStatusbarField)
+	field.dirty = true
+end
+
+--- Forces all cached statusbar fields to be rebuilt on the next redraw.
+
+function InvalidateStatusBar()
+	for _, f in cachedfields do
+		f.dirty = true
+	end
+end
+
+-- What was drawn last time, so that it only needs putting together again
+-- when something's changed.
+local lastleft = ""
+local lastleftname: string? = nil
+local lastleftdocument: string? = nil
+local lastleftchanged = false
+local lastvalues: {string} = {}
+local lastcount = -1
+local lastright = ""
+
 local function redrawstatus()
 	local y = ScreenHeight - 1
 
 	if documentSet.statusbar then
-		local s = {
-			Leafname(documentSet.name or "(unnamed)"),
-			"[",
-			currentDocument.name or "",
-			"] ",
-			changed_tab[documentSet._changed] or "",
-		}
+		local changed = documentSet._changed == true
+		if (lastleft == "") or (lastleftname ~= documentSet.name)
+				or (lastleftdocument ~= currentDocument.name)
+				or (lastleftchanged ~= changed) then
+			lastleftname = documentSet.name
+			lastleftdocument = currentDocument.name
+			lastleftchanged = changed
+			lastleft = Leafname(documentSet.name or "(unnamed)").."["..
+				(currentDocument.name or "").."] "..
+				(changed_tab[changed] or "")
+		end
 
 		-- Reversed due to SetReverse later.
 		SetColour(Palette.StatusbarBG, Palette.StatusbarFG)
 		SetReverse()
 		ClearArea(0, ScreenHeight-1, ScreenWidth-1, ScreenHeight-1)
-		LAlignInField(0, ScreenHeight-1, ScreenWidth, table.concat(s, ""))
+		LAlignInField(0, ScreenHeight-1, ScreenWidth, lastleft)
 
-		local ss: {StatusbarField} = {}
-		FireEvent("BuildStatusBar", ss)
-		table.sort(ss, function(x, y) return x.priority < y.priority end)
+		if cachedfieldsof ~= currentDocument then
+			cachedfieldsof = currentDocument
+			InvalidateStatusBar()
+		end
 
-		local s = {" "}
-		for _, v in ipairs(ss) do
-			s[#s+1] = v.value
+		statusbarcount = 0
+		local now
+		for _, f in cachedfields do
+			local interval = f.interval
+			if interval then
+				now = now or wg.time()
+				if now >= f.expires then
+					f.dirty = true
+					f.expires = now + interval
+				end
+			end
+			if f.dirty then
+				f.dirty = false
+				f.value = f.build()
+			end
+
+			local value = f.value
+			if value then
+				addstatusbarfield(statusbar, f.priority, value)
+			end
 		end
-		local ss = table.concat(s, " │ ")
-		if (string.sub(ss, #ss) == " ") then
-			ss = string.sub(ss, 1, #ss-1)
+
+		FireEvent("BuildStatusBar", statusbar)
+
+		-- Older listeners append {priority=, value=} fields instead of
+		-- calling add().
+		local n = #statusbar
+		for i = 1, n do
+			local v = statusbar[i]
+			statusbar:add(v.priority, v.value)
+			statusbar[i] = nil
+		end
+
+		local same = (statusbarcount == lastcount)
+		if same then
+			for i = 1, statusbarcount do
+				if statusbarvalues[i] ~= lastvalues[i] then
+					same = false
+					break
+				end
+			end
+		end
+
+		local ss = lastright
+		if not same then
+			ss = " "
+			if statusbarcount > 0 then
+				ss = "  │ "..table.concat(statusbarvalues, " │ ", 1, statusbarcount)
+			end
+			if (string.sub(ss, #ss) == " ") then
+				ss = string.sub(ss, 1, #ss-1)
+			end
+
+			table.move(statusbarvalues, 1, statusbarcount, 1, lastvalues)
+			lastcount = statusbarcount
+			lastright = ss
 		end
 
 		RAlignInField(0, ScreenHeight-1, ScreenWidth, ss)
@@ -161,73 +316,148 @@ local function redrawstatus()
 	end
 end
 
-local function drawtopmarker(y)
+-- The markers are drawn a row at a time: the edge of the paper, the ticks
+-- above or below it, and (at the top) the scale.
+
+local function drawtopmarker(y: number, part: string)
 	local lm = papermargin
 	local rm = ScreenWidth - lm - 1
-	local w = rm - lm + 1
 	local u = UseUnicode() and 1 or 2
 
 	SetNormal()
-	SetColour(Palette.MarkerFG, Palette.Desktop)
-	if y > 2 then
+	if part == "scale" then
+		SetColour(Palette.MarkerFG, Palette.Desktop)
 		local n = 0
 		for i = lm, rm, 10 do
-			Write(i, y-2, SYMBOLS[n][u])
+			Write(i, y, SYMBOLS[n][u])
 			n = n + 1
 			if n == 10 then
 				n = 0
 			end
 		end
-	end
-	if y > 1 then
-		Write(lm, y-1, SYMBOLS.dl[u])
+	elseif part == "ticks" then
+		SetColour(Palette.MarkerFG, Palette.Desktop)
+		Write(lm, y, SYMBOLS.dl[u])
 		for i = lm+5, rm, 10 do
-			Write(i, y-1, SYMBOLS.dms[u])
+			Write(i, y, SYMBOLS.dms[u])
 		end
 		for i = lm+10, rm, 10 do
-			Write(i, y-1, SYMBOLS.dm[u])
+			Write(i, y, SYMBOLS.dm[u])
+		end
+		Write(rm, y, SYMBOLS.dr[u])
+	else
+		SetColour(Palette.MarkerFG, Palette.Paper)
+		ClearArea(lm, y, rm, y)
+		for i = lm+1, rm-1 do
+			Write(i, y, SYMBOLS.lt[u])
 		end
-		Write(rm, y-1, SYMBOLS.dr[u])
-	end
-
-	SetColour(Palette.MarkerFG, Palette.Paper)
-	ClearArea(lm, y, rm, y)
-	for i = lm+1, rm-1 do
-		Write(i, y, SYMBOLS.lt[u])
 	end
 end
 
-local function drawbottommarker(y)
+local function drawbottommarker(y: number, part: string)
 	local lm = papermargin
 	local rm = ScreenWidth - lm - 1
-	local w = rm - lm + 1
 	local u = UseUnicode() and 1 or 2
 
 	SetNormal()
-	SetColour(Palette.MarkerFG, Palette.Paper)
-	ClearArea(lm, y, rm, y)
-	for i = lm+1, rm-1 do
-		Write(i, y, SYMBOLS.lb[u])
-	end
-	y = y + 1
-	if y < ScreenHeight then
+	if part == "ticks" then
 		SetColour(Palette.MarkerFG, Palette.Desktop)
 		Write(lm, y, SYMBOLS.ul[u])
 		for i = lm+10, rm, 10 do
 			Write(i, y, SYMBOLS.um[u])
 		end
 		Write(rm, y, SYMBOLS.ur[u])
+	else
+		SetColour(Palette.MarkerFG, Palette.Paper)
+		ClearArea(lm, y, rm, y)
+		for i = lm+1, rm-1 do
+			Write(i, y, SYMBOLS.lb[u])
+		end
 	end
 end
 
-function RedrawScreen()
+-- What was drawn on each screen row last time, and what the screen looked
+-- like as a whole. Rows whose description hasn't changed aren't redrawn,
+-- unless something else has drawn on the screen in the meantime.
+
+type ScreenRow = {[string]: any}
+
+local drawnrows: {[number]: ScreenRow} = {}
+local drawnframe: ScreenRow = {}
+local drawncount = -1
+
+local desktoprow: ScreenRow = {kind = "desktop"}
+local spacerow: ScreenRow = {kind = "space"}
+
+local function samerow(a: ScreenRow, b: ScreenRow?): boolean
+	if rawequal(a, b) then
+		return true
+	end
+	if not b then
+		return false
+	end
+	for k, v in pairs(a) do
+		if b[k] ~= v then
+			return false
+		end
+	end
+	for k in pairs(b) do
+		if a[k] == nil then
+			return false
+		end
+	end
+	return true
+end
+
+-- If the document has just moved up or down the screen (because the
+-- cursor has gone off the edge), works out by how many rows, by looking
+-- for the first text line of the new screen among the old rows. Only
+-- reports a scroll if it would leave more rows already correct than not
+-- scrolling at all.
+local function findscroll(rows: {[number]: ScreenRow}, height: number): number
+	local first
+	for y = 0, height-1 do
+		local row = rows[y]
+		if row and (row.kind == "line") then
+			first = y
+			break
+		end
+	end
+	if not first then
+		return 0
+	end
+
+	local delta = 0
+	for y = 0, height-1 do
+		if samerow(rows[first], drawnrows[y]) then
+			delta = y - first
+			break
+		end
+	end
+	if delta == 0 then
+		return 0
+	end
+
+	local unscrolled = 0
+	local scrolled = 0
+	for y = 0, height-1 do
+		local row = rows[y] or desktoprow
+		if samerow(row, drawnrows[y]) then
+			unscrolled = unscrolled + 1
+		end
+		if samerow(row, drawnrows[y + delta]) then
+			scrolled = scrolled + 1
+		end
+	end
+	return (scrolled > unscrolled) and delta or 0
+end
+
+local function redrawscreen()
 	-- We can't actual draw until the first resize event has been processed.
 	if ScreenHeight == 0 then
 		return
 	end
 
-	SetColour(nil, Palette.Desktop)
-	ClearScreen()
 	if not currentDocument._sp then
 		currentDocument._sp = currentDocument.cp
 		currentDocument._sw = currentDocument.cw
@@ -247,6 +477,32 @@ function RedrawScreen()
 		end
 	end
 
+	-- In the outline view, a folded section is drawn as just its heading
+	-- (see addons/goto.lua); none of the rest of it is wrapped or drawn.
+	-- These return the paragraph which is drawn for pn, and the last one
+	-- it stands for.
+
+	local folds = GetOutlineFolds(currentDocument)
+	local function shownfirst(pn: number): number
+		if folds then
+			return folds(pn) or pn
+		end
+		return pn
+	end
+	local function shownlast(pn: number): number
+		if folds then
+			local _, last = folds(pn)
+			return last or pn
+		end
+		return pn
+	end
+
+	local fp = shownfirst(sp)
+	if fp ~= sp then
+		sp = fp
+		sw = 1
+	end
+
 	-- Find out the offset of the paragraph at the middle of the screen.
 
 	local paragraph = currentDocument[sp]
@@ -261,7 +517,18 @@ function RedrawScreen()
 	assert(sl)
 
 	-- So, line sl on sp is supposed to be in the middle. We now work up
-	-- and down to find the real cursor position.
+	-- and down to find the real cursor position. Every paragraph is at least
+	-- one line high, so as soon as the cursor is known to be off the screen
+	-- we can stop and recentre on it; this keeps the number of paragraphs
+	-- wrapped proportional to the screen height rather than to the distance
+	-- the cursor has moved (which after a jump to the end of the document
+	-- would be all of it).
+
+	local function recentre()
+		currentDocument._sp = cp
+		currentDocument._sw = cw
+		return RedrawScreen()
+	end
 
 	local cy = math.floor(ScreenHeight / 2) - sl
 	if cp >= sp then
@@ -269,28 +536,34 @@ function RedrawScreen()
 		
 		while p < cp do
 			local wd = currentDocument[p]:wrap()
+			p = shownlast(p)
 			cy = cy + #wd.lines + currentDocument:spaceBelow(p)
 			p = p + 1
+			if cy >= (ScreenHeight-5) then
+				return recentre()
+			end
 		end
 		cy = cy + currentDocument[p]:getLineOfWord(cw) - 1
 		if cy >= (ScreenHeight-5) then
-			currentDocument._sp = cp
-			currentDocument._sw = cw
-			return RedrawScreen()
+			return recentre()
 		end
 	else
 		local p = sp
 
 		while p > cp do
+			-- The cursor's paragraph will move it up at least one more line.
+			if (cy - 1) < 4 then
+				return recentre()
+			end
 			p = p - 1
+			local below = currentDocument:spaceBelow(p)
+			p = shownfirst(p)
 			local wd = currentDocument[p]:wrap()
-			cy = cy - #wd.lines - currentDocument:spaceBelow(p)
+			cy = cy - #wd.lines - below
 		end
 		cy = cy + currentDocument[p]:getLineOfWord(cw) - 1
 		if cy < 4 then
-			currentDocument._sp = cp
-			currentDocument._sw = cw
-			return RedrawScreen()
+			return recentre()
 		end
 	end
 
@@ -307,63 +580,63 @@ function RedrawScreen()
 			cy)
 	end
 
-	-- Cache values for mark drawing.
-
-	local mp = currentDocument.mp
-	local mw = currentDocument.mw
-	local mo = currentDocument.mo
+	local mp1, mw1, mo1, mp2, mw2, mo2 = currentDocument:getMarks()
+	local marks = mp1 and table.concat({mp1, mw1, mo1, mp2, mw2, mo2}, " ")
 
 	local lm = papermargin
 	local rm = ScreenWidth - lm - 1
 
-	local function setparacolour(paragraph: Paragraph)
-		SetColour(
-			Palette[paragraph.style.."_FG"],
-			Palette[paragraph.style.."_BG"])
-	end
-
-	local function clear(y1, y2)
-		SetNormal()
-		ClearArea(lm, y1, rm, y2)
-	end
-
-	-- Draw backwards.
+	-- Work out what goes on each screen row; nothing is actually drawn until
+	-- afterwards.
 
-	local pn = sp - 1
-	local sa = currentDocument:spaceAbove(sp)
-	local y = math.floor(ScreenHeight/2) - sl - 1 - sa
-	local paragraph = currentDocument[sp]
-	if paragraph then
-		SetColour(Palette.Paper, Palette.Paper)
-		clear(y+1, y+sa)
-	end
+	local rows: {[number]: ScreenRow} = {}
 	lineindex = {}
 
-	local function drawline(paragraph: Paragraph, line: Line, ln: number)
-		local x = paragraph:getIndentOfLine(ln)
-
-		setparacolour(paragraph)
-		clear(y, y)
-		if not mp then
-			paragraph:renderLine(line, tx + x, y)
-		else
-			paragraph:renderMarkedLine(line, tx + x, y, nil, pn)
+	local function space(y1: number, y2: number)
+		for y = y1, y2 do
+			rows[y] = spacerow
 		end
+	end
 
-		if (ln == 1) then
-			drawmargin(y, pn, paragraph)
-		end
+	local function line(paragraph: Paragraph, wd, ln: number, pn: number,
+			y: number)
+		local marked = mp1 and (pn >= mp1) and (pn <= mp2)
+		rows[y] = {
+			kind = "line",
+			paragraph = paragraph,
+			wd = wd,
+			ln = ln,
+			pn = pn,
+			number = paragraph.number,
+			margin = (ln == 1) and getmargincontent(pn, paragraph) or nil,
+			marking = (mp1 ~= nil),
+			marks = marked and marks or nil,
+			highlights = GetIncrementalFindHighlights(pn),
+			folded = (ln == 1) and folds and (shownlast(pn) - pn) or nil,
+		}
 
 		lineindex[y] = {
 			p = pn,
-			w = paragraph:getWordOfLine(ln),
+			w = wd.lines[ln].wn,
 			x = tx
 		}
 	end
 
+	-- Backwards.
+
+	local pn = sp - 1
+	local sa = currentDocument:spaceAbove(sp)
+	local y = math.floor(ScreenHeight/2) - sl - 1 - sa
+	if currentDocument[sp] then
+		space(y+1, y+sa)
+	end
+
 	currentDocument._topp = nil
 	currentDocument._topw = nil
 	while (y >= 0) do
+		if pn >= 1 then
+			pn = shownfirst(pn)
+		end
 		local paragraph = currentDocument[pn]
 		if not paragraph then
 			break
@@ -372,7 +645,7 @@ function RedrawScreen()
 		local wd = paragraph:wrap()
 		for ln = #wd.lines, 1, -1 do
 			local l = wd.lines[ln]
-			drawline(paragraph, l, ln)
+			line(paragraph, wd, ln, pn, y)
 
 			currentDocument._topp = pn
 			currentDocument._topw = l.wn
@@ -385,16 +658,21 @@ function RedrawScreen()
 
 		local sa = currentDocument:spaceAbove(pn)
 		y = y - sa
-		SetColour(Palette.Paper, Palette.Paper)
-		clear(y, y+sa)
+		space(y, y+sa)
 		pn = pn - 1
 	end
 
 	if (y >= 0) and WantTerminators() then
-		drawtopmarker(y)
+		rows[y] = {kind = "topmarker", part = "edge"}
+		if y > 1 then
+			rows[y-1] = {kind = "topmarker", part = "ticks"}
+		end
+		if y > 2 then
+			rows[y-2] = {kind = "topmarker", part = "scale"}
+		end
 	end
 
-	-- Draw forwards.
+	-- Forwards.
 
 	y = math.floor(ScreenHeight/2) - sl
 	pn = sp
@@ -404,11 +682,9 @@ function RedrawScreen()
 			break
 		end
 
-		drawmargin(y, pn, paragraph)
-
 		local wd = paragraph:wrap()
 		for ln, l in wd.lines do
-			drawline(paragraph, l, ln)
+			line(paragraph, wd, ln, pn, y)
 
 			-- If the top of the page hasn't already been set, then the
 			-- current paragraph extends off the top of the screen.
@@ -426,10 +702,10 @@ function RedrawScreen()
 				break
 			end
 		end
+		pn = shownlast(pn)
 		local sb = currentDocument:spaceBelow(pn)
 		y = y + sb
-		SetColour(Palette.Paper, Palette.Paper)
-		clear(y-sb, y-1)
+		space(y-sb, y-1)
 		pn = pn + 1
 	end
 
@@ -442,25 +718,131 @@ function RedrawScreen()
 	end
 
 	if (y <= ScreenHeight) and WantTerminators() then
-		drawbottommarker(y)
+		rows[y] = {kind = "bottommarker", part = "edge"}
+		rows[y+1] = {kind = "bottommarker", part = "ticks"}
+	end
+
+	-- Now draw the rows which have changed. The status bar and messages are
+	-- drawn every time, so the rows underneath them are left alone.
+
+	local frame: ScreenRow = {
+		width = ScreenWidth,
+		height = ScreenHeight,
+		margin = papermargin,
+		document = currentDocument,
+		unicode = UseUnicode(),
+		spelling = GetSpellcheckerGeneration(),
+	}
+	local full = (wg.getdrawcount() ~= drawncount)
+		or not samerow(frame, drawnframe)
+	drawnframe = frame
+
+	local statustop = ScreenHeight - #messages
+		- (documentSet.statusbar and 1 or 0)
+
+	-- Where the document has just scrolled, get the display to move what's
+	-- already there and only draw the rows which have come into view.
+	if not full then
+		local delta = findscroll(rows, statustop)
+		if delta ~= 0 then
+			ScrollArea(0, statustop-1, delta)
+			local moved = {}
+			for y = 0, statustop-1 do
+				moved[y] = drawnrows[y + delta]
+			end
+			drawnrows = moved
+		end
+	end
+
+	for y = 0, ScreenHeight-1 do
+		local row = rows[y] or desktoprow
+		if y >= statustop then
+			drawnrows[y] = nil
+		elseif full or not samerow(row, drawnrows[y]) then
+			SetNormal()
+			SetColour(nil, Palette.Desktop)
+			ClearArea(0, y, ScreenWidth-1, y)
+
+			local kind = row.kind
+			if kind == "line" then
+				local paragraph: Paragraph = row.paragraph
+				local ln = row.ln
+				SetParagraphColour(paragraph.style)
+				SetNormal()
+				ClearArea(lm, y, rm, y)
+
+				local x = tx + paragraph:getIndentOfLine(ln)
+				local l = row.wd.lines[ln]
+				if not row.marking then
+					paragraph:renderLine(l, x, y, row.highlights)
+				else
+					paragraph:renderMarkedLine(l, x, y, nil, row.pn)
+				end
+
+				if ln == 1 then
+					drawmargin(y, paragraph, row.margin)
+				end
+
+				local folded = row.folded
+				if folded and (folded > 0) then
+					SetColour(Palette.StyleFG, nil)
+					SetDim()
+					RAlignInField(lm, y, rm - lm + 1,
+						string.format(" [+%d]", folded))
+				end
+			elseif kind == "space" then
+				SetColour(Palette.Paper, Palette.Paper)
+				SetNormal()
+				ClearArea(lm, y, rm, y)
+			elseif kind == "topmarker" then
+				drawtopmarker(y, row.part)
+			elseif kind == "bottommarker" then
+				drawbottommarker(y, row.part)
+			end
+
+			drawnrows[y] = row
+		end
 	end
 
 	redrawstatus()
 
 	FireEvent("Redraw")
+	drawncount = wg.getdrawcount()
+end
+
+function RedrawScreen()
+	local t = TraceBegin("RedrawScreen")
+	redrawscreen()
+	TraceEnd(t)
 end
 
+-- Returns the position of the text line on or above screen line y (lines
+-- between paragraphs have no entry of their own).
 function GetPositionOfLine(y)
-	local r = nil
-	for yy = 1, y do
-		r = lineindex[yy] or r
+	for yy = y, 1, -1 do
+		local r = lineindex[yy]
+		if r then
+			return r
+		end
 	end
-	return r
+	return nil
 end
 
+-- Where the display can blink the cursor by itself (a terminal, say), it's
+-- left to, so that nothing at all happens until a key or the timeout;
+-- otherwise it's blinked here.
 function GetCharWithBlinkingCursor(timeout: number?)
 	ShowCursor()
 
+	local blink = WantBlinkingCursor()
+	if SetCursorBlink(blink) or not blink then
+		if timeout then
+			return wg.getchar(timeout)
+		else
+			return wg.getchar()
+		end
+	end
+
 	timeout = timeout or 1E10
 	assert(timeout)
 
@@ -496,3 +878,18 @@ do
 
 	AddEventListener("Changed", cb)
 end
+
+-----------------------------------------------------------------------------
+-- Rebuilds all the cached statusbar fields when the document set is
+-- replaced or the screen is set up.
+
+do
+	local function cb()
+		InvalidateStatusBar()
+	end
+
+	AddEventListener("DocumentCreated", cb)
+	AddEventListener("DocumentLoaded", cb)
+	AddEventListener("RegisterAddons", cb)
+	AddEventListener("ScreenInitialised", cb)
+end
@@ -13,7 +13,9 @@ function LoadGlobalSettings(f: string?)
 	end
 	assert(f)
 
-	local s = LoadFromFile(f)
+	-- There aren't any documents in the settings file, so there's no need
+	-- to make a DocumentSet out of it.
+	local s = LoadHeaderFromFile(f)
 	if s then
 		if s.globalSettings then
 			GlobalSettings = s.globalSettings
@@ -0,0 +1,142 @@
+--!nonstrict
+-- © 2026 David Given.
+-- WordGrinder is licensed under the MIT open source license. See the COPYING
+-- file in this distribution for the full text.
+
+-- Long-running commands run their work as a task: a coroutine which calls
+-- TaskCheckpoint() every so often. Once it's been running for TASK_SLICE
+-- seconds the task is suspended while the keyboard is looked at and the
+-- progress shown, and then carries on. Pressing ESCAPE cancels the task;
+-- anything else that's typed is kept and handed to the event loop once the
+-- task is over, so the document doesn't change underneath it.
+--
+-- Outside the event loop (in tests, scripts, and the command line) tasks
+-- just run to completion.
+
+type Task = {
+	message: string,
+	progress: number?,
+	shown: string?,
+	deadline: number,
+	cancelled: boolean,
+}
+
+local CANCELLED = {}
+
+local polling = false
+local current: Task? = nil
+local bufferedinput: {InputEvent} = {}
+
+--- Enables or disables looking at the keyboard while tasks run.
+-- The event loop turns this on.
+
+function SetTaskPolling(enabled: boolean)
+	polling = enabled
+end
+
+--- Returns the next key typed while a task was running, if any.
+
+function TakeBufferedInput(): InputEvent?
+	return table.remove(bufferedinput, 1)
+end
+
+local function service(task: Task)
+	while true do
+		local c = wg.getchar(0)
+		if c == "KEY_TIMEOUT" then
+			break
+		elseif (c == "KEY_ESCAPE") or (c == "KEY_^C") then
+			task.cancelled = true
+		else
+			bufferedinput[#bufferedinput+1] = c
+		end
+	end
+
+	local s = task.message
+	local progress = task.progress
+	if progress then
+		s = string.format("%s %d%%", s, math.floor(progress * 100))
+	end
+	s = s.." ("..ESCAPE_KEY.." to cancel)"
+	if s ~= task.shown then
+		task.shown = s
+		ImmediateMessage(s)
+	end
+
+	task.deadline = wg.time() + TASK_SLICE
+end
+
+--- Called by tasks every so often.
+-- If the task has used up its slice, this lets the user interface catch up.
+-- It's cheap enough to call for every paragraph.
+--
+-- @param progress           optional fraction of the work done so far
+
+function TaskCheckpoint(progress: number?)
+	local task = current
+	if not task then
+		return
+	end
+	if progress then
+		task.progress = progress
+	end
+	if wg.time() < task.deadline then
+		return
+	end
+
+	if coroutine.isyieldable() then
+		coroutine.yield()
+	else
+		-- Called from somewhere the coroutine can't yield from, so do the
+		-- work here instead.
+		service(task)
+		if task.cancelled then
+			error(CANCELLED)
+		end
+	end
+end
+
+--- Runs a function as a task.
+-- A task run from inside another just becomes part of it.
+--
+-- @param message            what to show while the task runs
+-- @param fn                 the work to do
+-- @param ...                parameters for fn
+-- @return                   false if the user cancelled the task, or true
+--                           and whatever fn returned
+
+function RunTask(message: string, fn: (...any) -> ...any, ...): (boolean, ...any)
+	if current or not polling then
+		return true, fn(...)
+	end
+
+	local task: Task = {
+		message = message,
+		progress = nil,
+		shown = nil,
+		deadline = wg.time() + TASK_SLICE,
+		cancelled = false,
+	}
+	current = task
+
+	local co = coroutine.create(fn)
+	local results = table.pack(coroutine.resume(co, ...))
+	while (coroutine.status(co) ~= "dead") and not task.cancelled do
+		service(task)
+		if not task.cancelled then
+			results = table.pack(coroutine.resume(co))
+		end
+	end
+	current = nil
+
+	if task.cancelled or ((results[2] :: any) == CANCELLED) then
+		coroutine.close(co)
+		QueueRedraw()
+		NonmodalMessage("Cancelled.")
+		return false
+	end
+	if not results[1] then
+		error(debug.traceback(co, tostring(results[2])), 0)
+	end
+	return true, table.unpack(results, 2, results.n)
+end
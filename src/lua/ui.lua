@@ -194,17 +194,54 @@ function PromptForString(title: string, message: string, default: string?)
 	end
 end
 
-function FindAndReplaceDialogue(defaultfind: string?, defaultreplace: string?)
+function FindAndReplaceDialogue(defaultfind: string?, defaultreplace: string?,
+		defaultregex: boolean?)
 	defaultfind = defaultfind or ""
 	defaultreplace = defaultreplace or ""
 	assert(defaultfind)
 	assert(defaultreplace)
 
+	local matcheslabel = Form.Label {
+		value = "",
+		x1 = 1, y1 = 6, x2 = -1, y2 = 6,
+		align = "left",
+	}
+
+	local regexcheckbox = Form.Checkbox {
+		label = "Regular expression",
+		value = defaultregex or false,
+		x1 = 1, y1 = 5, x2 = -1, y2 = 5,
+	}
+
+	-- Matches are highlighted in the document as the search text is typed.
+	local function update(text: string)
+		local n = SetIncrementalFind(text, regexcheckbox.value)
+		if not n then
+			matcheslabel.value = ""
+		elseif (n == 0) then
+			matcheslabel.value = "Not found."
+		else
+			matcheslabel.value = string.format("Found in %d %s.", n,
+				(n == 1) and "paragraph" or "paragraphs")
+		end
+	end
+
 	local findfield = Form.TextField {
 		value = defaultfind,
 		cursor = defaultfind:len() + 1,
 		x1 = 11, y1 = 1, x2 = -1, y2 = 2,
+
+		changed = function(self)
+			update(self.value)
+			return "redraw"
+		end,
 	}
+	update(defaultfind)
+
+	regexcheckbox.changed = function(self)
+		update(findfield.value)
+		return "redraw"
+	end
 
 	local replacefield = Form.TextField {
 		value = defaultreplace,
@@ -216,7 +253,7 @@ function FindAndReplaceDialogue(defaultfind: string?, defaultreplace: string?)
 	{
 		title = "Find and Replace",
 		width = "large",
-		height = 5,
+		height = 7,
 
 		actions = {
 			["KEY_RETURN"] = "confirm",
@@ -238,15 +275,18 @@ function FindAndReplaceDialogue(defaultfind: string?, defaultreplace: string?)
 
 			findfield,
 			replacefield,
+			regexcheckbox,
+			matcheslabel,
 		}
 	}
 
 	local result = Form.Run(dialogue, RedrawScreen,
 		"RETURN to confirm, "..ESCAPE_KEY.." to cancel")
 
+	SetIncrementalFind(nil)
 	QueueRedraw()
 	if result then
-		return findfield.value, replacefield.value
+		return findfield.value, replacefield.value, regexcheckbox.value
 	else
 		return nil
 	end
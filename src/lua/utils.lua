@@ -80,7 +80,20 @@ end
 -- @param delim              the delimiter
 -- @return                   the list of words
 
+-- The delimiters SplitString() can hand to wg.splitstring(), which splits
+-- at any of a set of bytes: single characters which aren't pattern magic,
+-- and %s.
+local splitdelimiters: {[string]: string} = { ["%s"] = " \t\n\v\f\r" }
+
 function SplitString(str: string, delim: string): {string}
+	local delimiters = splitdelimiters[delim]
+	if not delimiters and (#delim == 1) and not delim:find("[%^%$%(%)%%%.%[%]%*%+%-%?]") then
+		delimiters = delim
+	end
+	if delimiters then
+		return wg.splitstring(str, delimiters)
+	end
+
     -- Eliminate bad cases...
     if not str:find(delim) then
     	return {str}
@@ -253,14 +266,7 @@ end
 -- Splits a string by whitespace.
 
 function ParseStringIntoWords(s: string): {string}
-	local words = {}
-	for w in s:gmatch("[^ \t\r\n]+") do
-		words[#words + 1] = w
-	end
-	if (#words == 0) then
-		return {""}
-	end
-	return words
+	return wg.splitwords(s)
 end
 
 -- Convert an array to a map.
@@ -440,10 +446,16 @@ function InterleaveArray(array, x)
 end
 
 -- Create an input stream, from which lines can be read as if it were a file.
--- It's incredibly limited to just the functions we need.
+-- It's incredibly limited to just the functions we need. Reading starts at
+-- offset, if given. data may be either a string or a mapped file.
 
-function CreateIStream(data: string): any
-	local ptr = 1
+function CreateIStream(data: string | MappedFile, offset: number?): any
+	local data: any = data
+	if type(data) ~= "userdata" then
+		data = tostring(data)
+	end
+	local ptr = offset or 1
+	local len = #data
 	local o = {}
 	setmetatable(o,
 	{
@@ -451,16 +463,22 @@ function CreateIStream(data: string): any
 		{
 			read = function(self, a: string): string?
 				if a == "*l" then
-					local _, e, s, n = string_find(data, "([^\n]*)(\n?)", ptr)
-					if (s == "") and (n == "") then
+					if ptr > len then
 						return nil
 					end
-					assert(e)
-					ptr = e + 1
+					local e = data:find("\n", ptr, true)
+					local s
+					if e then
+						s = data:sub(ptr, e-1)
+						ptr = e + 1
+					else
+						s = data:sub(ptr)
+						ptr = len + 1
+					end
 					return s
 				elseif a == "*a" then
 					local s = data:sub(ptr)
-					ptr = #data
+					ptr = len + 1
 					return s
 				else
 					error("unsupported read parameter '"..a.."'")
@@ -477,4 +495,3 @@ function CreateIStream(data: string): any
 
 	return o
 end
-
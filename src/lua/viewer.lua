@@ -0,0 +1,323 @@
+--!nonstrict
+-- © 2026 David Given.
+-- WordGrinder is licensed under the MIT open source license. See the COPYING
+-- file in this distribution for the full text.
+
+-----------------------------------------------------------------------------
+-- A read-only viewer for text files which are too big to be worth importing
+-- (see the text views in importer.cc). The file is mapped, not read, and
+-- only its line starts are indexed; each line is turned into a paragraph
+-- when it scrolls into view, and only the most recent few hundred of those
+-- are kept. Searches run over the mapped file itself.
+
+local GetChar = wg.getchar
+local HideCursor = wg.hidecursor
+local SetNormal = wg.setnormal
+local ClearArea = wg.cleararea
+local ViewText = wg.viewtext
+local int = math.floor
+
+-- Paragraphs kept before the cache is thrown away and started again.
+local CACHESIZE = 512
+
+-- How much of the file is searched between checks of the keyboard.
+local FIND_SLICE = 4*1024*1024
+
+type Match = {
+	ln: number,
+	mw: number,
+	mo: number,
+	ew: number,
+	eo: number,
+	at: number,
+}
+
+type Viewer = {
+	view: any,
+	filename: string,
+	lines: number,
+
+	-- The line at the top of the screen, and which of its wrapped lines.
+	top: number,
+	sub: number,
+
+	cache: {[number]: Paragraph},
+	cached: number,
+	match: Match?,
+}
+
+local findtext: string? = nil
+local findregex = false
+
+local function getparagraph(v: Viewer, ln: number): Paragraph
+	local p = v.cache[ln]
+	if not p then
+		if (v.cached >= CACHESIZE) then
+			v.cache = {}
+			v.cached = 0
+		end
+		p = CreateParagraph("P", v.view:words(ln))
+		v.cache[ln] = p
+		v.cached = v.cached + 1
+	end
+	return p
+end
+
+local function getwidth(): number
+	return math.max(ScreenWidth - 2, 1)
+end
+
+local function countrows(v: Viewer, ln: number): number
+	return #getparagraph(v, ln):wrap(getwidth()).lines
+end
+
+-- Moves the top of the screen by delta wrapped lines.
+local function scroll(v: Viewer, delta: number)
+	while (delta > 0) do
+		if (v.sub < countrows(v, v.top)) then
+			v.sub = v.sub + 1
+		elseif (v.top < v.lines) then
+			v.top = v.top + 1
+			v.sub = 1
+		else
+			break
+		end
+		delta = delta - 1
+	end
+
+	while (delta < 0) do
+		if (v.sub > 1) then
+			v.sub = v.sub - 1
+		elseif (v.top > 1) then
+			v.top = v.top - 1
+			v.sub = countrows(v, v.top)
+		else
+			break
+		end
+		delta = delta + 1
+	end
+end
+
+local function gotoline(v: Viewer, ln: number)
+	v.top = math.max(math.min(int(ln), v.lines), 1)
+	v.sub = 1
+end
+
+local function redraw(v: Viewer)
+	local width = getwidth()
+	local height = ScreenHeight - 1
+	local s = SpellcheckerOff()
+
+	local ln = v.top
+	local sub = v.sub
+	local y = 0
+	while (y < height) do
+		SetNormal()
+		SetColour(nil, Palette.Desktop)
+		ClearArea(0, y, ScreenWidth-1, y)
+
+		if (ln <= v.lines) then
+			local paragraph = getparagraph(v, ln)
+			local wd = paragraph:wrap(width)
+			local match = v.match
+			local highlights = nil
+			if match and (match.ln == ln) then
+				highlights = {{match.mw, match.mo, match.ew, match.eo}}
+			end
+
+			SetParagraphColour(paragraph.style)
+			SetNormal()
+			paragraph:renderLine(wd.lines[sub], 1, y, highlights)
+
+			sub = sub + 1
+			if (sub > #wd.lines) then
+				ln = ln + 1
+				sub = 1
+			end
+		end
+		y = y + 1
+	end
+	SpellcheckerRestore(s)
+
+	SetColour(Palette.StatusbarBG, Palette.StatusbarFG)
+	DrawStatusLine(string.format(
+		"%s (read only) │ line %d of %d │ ^F find │ ^K next │ ^G go to │ %s closes",
+		Leafname(v.filename), v.top, v.lines, ESCAPE_KEY))
+	HideCursor()
+end
+
+-- Searches forward from the start of the top line (just after the current
+-- match, if it's visible), wrapping round at the end of the file.
+local function findnext(v: Viewer): boolean
+	local text, e = GetSearchText(findtext, findregex)
+	if not text then
+		ModalMessage("Find", assert(e))
+		return false
+	end
+
+	local len = v.view:len()
+	local start = v.view:offset(v.top)
+	local match = v.match
+	if match and (match.ln == v.top) then
+		start = match.at + 1
+	end
+
+	local function search(from: number, to: number): Match?
+		for i = from, to, FIND_SLICE do
+			TaskCheckpoint((i - from) / math.max(to - from, 1))
+			local ln, mw, mo, ew, eo, at = v.view:find(text, findregex,
+				i, math.min(i + FIND_SLICE - 1, to))
+			if ln then
+				return {ln = ln, mw = mw, mo = mo, ew = ew, eo = eo, at = at}
+			end
+		end
+		return nil
+	end
+
+	local ok, found = RunTask("Searching...", function()
+		return search(start, len) or search(1, start - 1)
+	end)
+	if not ok then
+		return false
+	end
+	if not found then
+		ModalMessage("Find", "Not found.")
+		return false
+	end
+
+	v.match = found
+	gotoline(v, found.ln)
+
+	-- Leave the match a few lines down, so there's some context.
+	scroll(v, -int((ScreenHeight - 1) / 3))
+	return true
+end
+
+local function finddialogue(v: Viewer): boolean
+	local findfield = Form.TextField {
+		value = findtext or "",
+		cursor = (findtext or ""):len() + 1,
+		x1 = 11, y1 = 1, x2 = -1, y2 = 2,
+	}
+
+	local regexcheckbox = Form.Checkbox {
+		label = "Regular expression",
+		value = findregex,
+		x1 = 1, y1 = 3, x2 = -1, y2 = 3,
+	}
+
+	local dialogue: Form =
+	{
+		title = "Find",
+		width = "large",
+		height = 4,
+
+		actions = {
+			["KEY_RETURN"] = "confirm",
+			["KEY_ENTER"] = "confirm",
+		},
+
+		widgets = {
+			Form.Label {
+				value = "Find:",
+				x1 = 1, y1 = 1, x2 = 10, y2 = 1,
+				align = "left",
+			},
+
+			findfield,
+			regexcheckbox,
+		}
+	}
+
+	if not Form.Run(dialogue, function() redraw(v) end,
+			"RETURN to confirm, "..ESCAPE_KEY.." to cancel") then
+		return false
+	end
+	findtext = findfield.value
+	findregex = regexcheckbox.value
+	return findnext(v)
+end
+
+local function gotodialogue(v: Viewer)
+	local s = PromptForString("Go to line",
+		string.format("Which line (1 to %d)?", v.lines), tostring(v.top))
+	local ln = s and tonumber(s)
+	if ln then
+		gotoline(v, ln)
+	end
+end
+
+local function run(v: Viewer)
+	local actions = {
+		["KEY_UP"] = function() scroll(v, -1) end,
+		["KEY_DOWN"] = function() scroll(v, 1) end,
+		["KEY_PGUP"] = function() scroll(v, -(ScreenHeight - 2)) end,
+		["KEY_PGDN"] = function() scroll(v, ScreenHeight - 2) end,
+		["KEY_^PGUP"] = function() gotoline(v, 1) end,
+		["KEY_^PGDN"] = function() gotoline(v, v.lines) end,
+		["KEY_^F"] = function() finddialogue(v) end,
+		["KEY_^K"] = function()
+			if findtext then
+				findnext(v)
+			else
+				finddialogue(v)
+			end
+		end,
+		["KEY_^G"] = function() gotodialogue(v) end,
+		["KEY_RESIZE"] = function() ResizeScreen() end,
+	}
+
+	ResizeScreen()
+	while not Quitting do
+		redraw(v)
+		local key = GetChar()
+		if (key == "KEY_QUIT") then
+			QuitForcedBySystem()
+		elseif (key == "KEY_ESCAPE") or (key == "KEY_^C") or (key == "q") then
+			break
+		elseif (type(key) == "string") then
+			local action = actions[key]
+			if action then
+				action()
+			end
+		end
+	end
+end
+
+--- Views a text file, without importing it.
+--
+-- @param filename           the file to view, or nil to ask for one
+-- @return                   true if the file could be opened
+
+function Cmd.ViewTextFile(filename: string?): boolean
+	if not filename then
+		filename = FileBrowser("View Text File", "View:", false)
+		if not filename then
+			return false
+		end
+	end
+	assert(filename)
+
+	ImmediateMessage("Opening...")
+	local view, e = ViewText(filename)
+	if not view then
+		ModalMessage("Unable to open file", "The file could not be opened: "..
+			(e or "unknown error"))
+		QueueRedraw()
+		return false
+	end
+
+	local v: Viewer = {
+		view = view,
+		filename = filename,
+		lines = view:lines(),
+		top = 1,
+		sub = 1,
+		cache = {},
+		cached = 0,
+	}
+	run(v)
+	view:close()
+	QueueRedraw()
+	return true
+end
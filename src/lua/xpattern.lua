@@ -362,11 +362,38 @@ end
 M.code_of = code_of
 
 
+-- Cache of compiled functions, keyed by their generated code, so that
+-- compiling an equivalent pattern again doesn't need another `load`.
+-- `cache_order` lists the keys from least to most recently used; once there
+-- are more than `M.cache_size` the oldest are dropped.
+M.cache_size = 32
+local cache = {}
+local cache_order = {}
+
+local function touch_cache(code: string)
+  for i = #cache_order, 1, -1 do
+    if cache_order[i] == code then
+      table.remove(cache_order, i)
+      break
+    end
+  end
+  cache_order[#cache_order+1] = code
+  while #cache_order > M.cache_size do
+    cache[table.remove(cache_order, 1)] = nil
+  end
+end
+
+
 -- Compiles pattern object `epat` to Lua function `f`.
 local function compile(epat: any)
   local code = code_of(epat)
   if M.debug then print('DEBUG:\n' .. code) end
-  local f = assert(loadstring(code))(match)
+  local f = cache[code]
+  if not f then
+    f = assert(loadstring(code))(match)
+    cache[code] = f
+  end
+  touch_cache(code)
   return f
 end
 M.compile = compile
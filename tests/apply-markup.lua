@@ -12,3 +12,36 @@ AssertEquals(1, #currentDocument)
 AssertEquals(1, #currentDocument[1])
 AssertEquals("foo\024bar", currentDocument[1][1])
 
+
+-- Styling a selection spanning paragraphs; those already in the style are
+-- left as they were.
+
+ResetDocumentSet()
+Cmd.InsertStringIntoParagraph("one two")
+Cmd.SplitCurrentParagraph()
+Cmd.InsertStringIntoParagraph("three")
+Cmd.SplitCurrentParagraph()
+Cmd.InsertStringIntoParagraph("four five")
+Cmd.GotoBeginningOfDocument()
+Cmd.GotoNextWord()
+Cmd.SetMark()
+Cmd.GotoEndOfDocument()
+Cmd.GotoPreviousWord()
+Cmd.GotoNextCharW()
+Cmd.SetStyle("b")
+
+AssertTableEquals({"one", "\024two"}, currentDocument[1])
+AssertTableEquals({"\024three"}, currentDocument[2])
+AssertTableEquals({"\024four", "\024f\016ive"}, currentDocument[3])
+AssertEquals(4, currentDocument.co)
+
+local second = currentDocument[2]
+currentDocument.cp = 1
+currentDocument.cw = 2
+currentDocument.co = 1
+Cmd.SetMark()
+currentDocument.cp = 3
+currentDocument.cw = 1
+currentDocument.co = 1
+Cmd.SetStyle("b")
+AssertEquals(second, currentDocument[2])
@@ -0,0 +1,84 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+local dir = wg.mkdtemp()
+for i = 1, 100 do
+	Cmd.InsertStringIntoParagraph("paragraph"..i.." with some words in")
+	Cmd.SplitCurrentParagraph()
+end
+Cmd.AddBlankDocument("other")
+Cmd.InsertStringIntoParagraph("other")
+Cmd.ChangeDocument("main")
+AssertEquals(Cmd.SaveCurrentDocumentAs(dir.."/doc.wg"), true)
+AssertEquals(FinishBackgroundSave(), true)
+
+local pack = dir.."/doc.autosave.pack"
+local function size(filename)
+	return wg.stat(filename).size
+end
+
+-- Snapshots only add the paragraphs which haven't been stored before.
+
+local original = DocumentSetContents(documentSet)
+AssertEquals(SaveToStore(dir.."/a1", pack, documentSet), true)
+local packsize = size(pack)
+
+currentDocument.cp = 50
+currentDocument.cw = 1
+currentDocument.co = 1
+Cmd.InsertStringIntoWord("x")
+local edited = DocumentSetContents(documentSet)
+AssertEquals(SaveToStore(dir.."/a2", pack, documentSet), true)
+AssertEquals(size(pack) - packsize < 64, true)
+packsize = size(pack)
+AssertEquals(SaveToStore(dir.."/a3", pack, documentSet), true)
+AssertEquals(size(pack), packsize)
+
+-- They load like any other file.
+
+local ds = LoadFromFile(dir.."/a1")
+AssertTableEquals(original, DocumentSetContents(ds))
+AssertEquals("main", ds.current.name)
+AssertEquals(ds:findDocument("other"), ds.documents[2])
+AssertTableEquals(edited, DocumentSetContents(LoadFromFile(dir.."/a2")))
+
+-- A torn record at the end of the pack is thrown away.
+
+wg.appendfile(pack, "0123456789abcdef P torn")
+Cmd.InsertStringIntoWord("y")
+AssertEquals(SaveToStore(dir.."/a3", pack, documentSet), true)
+AssertTableEquals(DocumentSetContents(documentSet),
+	DocumentSetContents(LoadFromFile(dir.."/a3")))
+
+-- Compacting keeps only what the remaining snapshots use, once that's less
+-- than half of it.
+
+AssertEquals(CompactStore(pack, {dir.."/a1", dir.."/a2", dir.."/a3"}), true)
+AssertEquals(size(pack) > packsize, true)
+documentSet.documents[1]:deleteParagraphsAt(1, 90)
+AssertEquals(SaveToStore(dir.."/a4", pack, documentSet), true)
+AssertEquals(CompactStore(pack, {dir.."/a4"}), true)
+AssertEquals(size(pack) < packsize/2, true)
+AssertTableEquals(DocumentSetContents(documentSet),
+	DocumentSetContents(LoadFromFile(dir.."/a4")))
+local ds, e = LoadFromFile(dir.."/a1")
+AssertNull(ds)
+AssertNotNull(e)
+
+-- The autosave addon uses the store when asked.
+
+local settings = documentSet.addons.autosave
+settings.enabled = true
+settings.store = true
+settings.lastsaved = 0
+currentDocument.cp = 1
+currentDocument.cw = 1
+currentDocument.co = 1
+FireEvent("DocumentLoaded") -- starts the timer
+settings.lastsaved = 0
+Cmd.InsertStringIntoWord("z")
+RunTimers(math.huge)
+AssertNull(GetBackgroundSave())
+local autosavename = dir.."/doc.autosave."..os.date("%Y-%m-%d.%H%M")..".wg"
+AssertTableEquals(DocumentSetContents(documentSet),
+	DocumentSetContents(LoadFromFile(autosavename)))
@@ -0,0 +1,63 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+local dir = wg.mkdtemp()
+Cmd.InsertStringIntoParagraph("fnord")
+AssertEquals(Cmd.SaveCurrentDocumentAs(dir.."/doc.wg"), true)
+AssertEquals(FinishBackgroundSave(), true)
+
+-- Some old autosaves, and one of a different document.
+
+for i = 1, 3 do
+	wg.writefile(dir.."/doc.autosave.2020-01-0"..i..".1200.wg", "")
+end
+wg.writefile(dir.."/other.autosave.2020-01-01.1200.wg", "")
+
+local settings = documentSet.addons.autosave
+settings.enabled = true
+settings.period = 10
+settings.keep = 2
+FireEvent("DocumentLoaded") -- starts the timer
+
+local function autosave()
+	settings.lastsaved = 0
+	RunTimers(math.huge)
+end
+
+local function files()
+	local f = {}
+	for _, name in assert(wg.readdir(dir)) do
+		if not name:find("^%.") then
+			f[#f+1] = name
+		end
+	end
+	table.sort(f)
+	return f
+end
+
+-- Autosaving prunes all but the newest autosaves of this document.
+
+Cmd.InsertStringIntoParagraph("blarg")
+autosave()
+AssertNotNull(GetBackgroundSave())
+AssertEquals(FinishBackgroundSave(), true)
+
+local autosavename = "doc.autosave."..os.date("%Y-%m-%d.%H%M")..".wg"
+AssertTableEquals({
+	"doc.autosave.2020-01-03.1200.wg",
+	autosavename,
+	"doc.wg",
+	"other.autosave.2020-01-01.1200.wg"
+}, files())
+
+-- Nothing is written if nothing has changed since.
+
+documentSet:touch()
+autosave()
+AssertNull(GetBackgroundSave())
+AssertEquals(settings.lastsaved ~= 0, true)
+
+Cmd.InsertStringIntoParagraph("x")
+autosave()
+AssertNotNull(GetBackgroundSave())
+AssertEquals(FinishBackgroundSave(), true)
@@ -0,0 +1,35 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+Cmd.InsertStringIntoParagraph("fnord")
+
+local events = 0
+AddEventListener("BackgroundSave", function() events = events + 1 end)
+
+local filename = wg.mkdtemp().."/tempfile"
+AssertEquals(Cmd.SaveCurrentDocumentAs(filename), true)
+AssertNotNull(GetBackgroundSave())
+AssertEquals(documentSet._changed, false)
+
+-- Edits made while the save is in progress don't end up in the file.
+
+Cmd.InsertStringIntoParagraph("blarg")
+AssertEquals(documentSet._changed, true)
+
+AssertEquals(FinishBackgroundSave(), true)
+AssertNull(GetBackgroundSave())
+AssertNull(wg.stat(filename..".new"))
+FlushAsyncEvents()
+AssertEquals(events, 1)
+
+documentSet:clean()
+AssertEquals(Cmd.LoadDocumentSet(filename), true)
+AssertTableEquals({"fnord"}, currentDocument[1])
+
+-- Failures are reported when the save finishes.
+
+local result
+SaveToFileInBackground(wg.mkdtemp().."/nonexistent/tempfile", documentSet,
+	function(r, e) result = r end)
+AssertEquals(FinishBackgroundSave(), false)
+AssertEquals(result, false)
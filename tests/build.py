@@ -4,10 +4,26 @@ from config import TEST_BINARY
 TESTS = [
     "apply-markup",
     "argument-parser",
+    "autosave",
+    "autosave-store",
+    "background-save",
     "change-paragraph-style",
+    "change-tracking",
     "clipboard",
+    "compare-documents",
+    "compress",
+    "concat-document-sets",
+    "convert-batch",
     "delete-selection",
+    "derived-cache",
+    "dictionary",
+    "document-lookup",
+    "document-model",
+    "document-statistics",
     "escape-strings",
+    "events",
+    "export-all",
+    "export-cache",
     "export-to-html",
     "export-to-latex",
     "export-to-markdown",
@@ -17,14 +33,24 @@ TESTS = [
     "export-to-troff",
     "filesystem",
     "find-and-replace",
+    "gc-stepping",
     "get-style-from-word",
+    "html-tokens",
     "immutable-paragraphs",
     "import-from-html",
     "import-from-markdown",
     "import-from-opendocument",
+    "import-large-opendocument",
     "import-from-text",
     "insert-space-with-style-hint",
+    "journal",
+    "key-bindings",
+    "latency-recording",
+    "layout-eviction",
+    "lazy-modules",
+    "lazy-upgrade",
     "line-down-into-style",
+    "line-of-word",
     "line-up",
     "line-wrapping",
     "load-0.1",
@@ -38,16 +64,35 @@ TESTS = [
     "load-0.8.crlf",
     "load-0.8",
     "load-failed",
+    "load-header",
     "lowlevelclipboard",
+    "materialise-documents",
+    "memory-report",
+    "misspelling-index",
     "move-while-selected",
+    "native-exporters",
     "numbered-lists",
+    "outline",
+    "packed-paragraphs",
+    "paragraph-hashes",
+    "page-count",
     "parse-string-into-words",
+    "pathological-inputs",
+    "prewrap",
+    "regex",
+    "resident-document-sets",
+    "save-checksums",
+    "save-compressed",
     "save-format-escaped-strings",
+    "save-to-string",
+    "save-wordtable",
+    "scrapbook",
     "simple-editing",
     "smartquotes-selection",
     "smartquotes-typing",
     "spellchecker",
     "tableio",
+    "trace-spans",
     "type-while-selected",
     "undo",
     "utf8",
@@ -70,9 +115,14 @@ TESTS = [
     "weirdness-upgrade-0.6-with-clipboard",
     "weirdness-word-left-from-end-of-line",
     "weirdness-word-right-to-last-word-in-doc",
+    "width-from-offset",
     "windows-installdir",
     "word",
+    "word-index",
+    "worker-jobs",
+    "xml-tokens",
     "xpattern",
+    "zip-archives",
 ]
 
 
@@ -89,6 +139,21 @@ def test(self, name, exe: Target = None):
     )
 
 
-tests = [test(name=t, exe=TEST_BINARY) for t in TESTS]
+HEADLESS_TESTS = [
+    "find-in-all-documents",
+    "headless-allocation-budgets",
+    "headless-forms",
+    "headless-outline-view",
+    "headless-record-keys",
+    "headless-redraw",
+    "headless-resize",
+    "headless-tasks",
+    "headless-text-viewer",
+]
+
+
+tests = [test(name=t, exe=TEST_BINARY) for t in TESTS] + [
+    test(name=t, exe="src/c/+wordgrinder-headless") for t in HEADLESS_TESTS
+]
 
 export(name="tests", deps=tests)
@@ -0,0 +1,40 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+local function P(w)
+	return CreateParagraph("P", {w})
+end
+
+local d = CreateDocument()
+for i = 1, 10 do
+	d[i] = P(tostring(i))
+end
+
+local g = d:sync()
+AssertEquals(g, d:sync())
+AssertTableAndPropertiesEquals({}, (d:changedSince(g)))
+
+d[3] = P("x")
+local ranges, words = d:changedSince(g)
+AssertTableAndPropertiesEquals({{3, 3}}, ranges)
+AssertEquals(0, words)
+AssertEquals(g+1, d:generationOf(3))
+AssertEquals(g, d:generationOf(4))
+
+d:insertParagraphsBefore({P("y"), P("z")}, 8)
+d:sync()
+d:deleteParagraphAt(1)
+ranges, words = d:changedSince(g)
+AssertTableAndPropertiesEquals({{1, 0}, {2, 2}, {7, 8}}, ranges)
+AssertEquals(1, words)
+
+local g2 = d:sync()
+d:deleteParagraphsAt(4, 2)
+AssertTableAndPropertiesEquals({{4, 3}}, (d:changedSince(g2)))
+
+-- Too old to know.
+for i = 1, 100 do
+	d[1] = P(tostring(i))
+	d:sync()
+end
+AssertNull((d:changedSince(g)))
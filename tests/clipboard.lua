@@ -79,3 +79,79 @@ AssertEquals("RAW", currentDocument[4].style)
 AssertTableEquals({"dogdog."}, currentDocument[5])
 AssertEquals("P", currentDocument[5].style)
 
+
+local d = CreateDocument()
+d[1] = CreateParagraph("P", {"a"})
+d[2] = CreateParagraph("P", {"d"})
+d:insertParagraphsBefore({CreateParagraph("P", {"b"}), CreateParagraph("P", {"c"})}, 2)
+AssertEquals(4, #d)
+AssertEquals("abcd", d[1][1]..d[2][1]..d[3][1]..d[4][1])
+d:deleteParagraphsAt(2, 2)
+AssertEquals(2, #d)
+AssertEquals("ad", d[1][1]..d[2][1])
+d:deleteParagraphsAt(2, 5)
+AssertEquals(1, #d)
+
+-- The system clipboard is only written to once the user pauses; until then,
+-- and while it still holds what was copied, pasting doesn't read it back.
+
+wg.clipboard_set("other", nil)
+ResetDocumentSet()
+Cmd.InsertStringIntoParagraph("one")
+Cmd.SplitCurrentParagraph()
+Cmd.InsertStringIntoParagraph("two")
+Cmd.SplitCurrentParagraph()
+Cmd.InsertStringIntoParagraph("three")
+Cmd.GotoBeginningOfDocument()
+Cmd.SetMark()
+Cmd.GotoNextParagraph()
+Cmd.GotoNextParagraph()
+Cmd.Copy()
+AssertEquals("other", (wg.clipboard_get()))
+AssertEquals(currentDocument[2], GetClipboard()[2])
+
+FireEvent("Idle")
+local text, wgdata = wg.clipboard_get()
+AssertEquals("one\ntwo\n\n", text)
+AssertNotNull(wgdata)
+AssertEquals(currentDocument[2], GetClipboard()[2])
+
+-- Something copied elsewhere replaces it.
+
+wg.clipboard_set("four", nil)
+AssertTableEquals({"four"}, GetClipboard()[1])
+
+-- Copying part of a numbered list doesn't renumber the document's own.
+
+ResetDocumentSet()
+Cmd.InsertStringIntoParagraph("one")
+Cmd.ChangeParagraphStyle("LN")
+for _, w in {"two", "three", "four"} do
+	Cmd.SplitCurrentParagraph()
+	Cmd.InsertStringIntoParagraph(w)
+	Cmd.ChangeParagraphStyle("LN")
+end
+FireEvent("Changed")
+
+currentDocument.cp = 2
+currentDocument.cw = 1
+currentDocument.co = 1
+Cmd.SetMark()
+Cmd.GotoNextParagraph()
+Cmd.GotoNextParagraph()
+Cmd.Copy()
+AssertEquals(2, currentDocument[2].number)
+AssertEquals(3, currentDocument[3].number)
+
+-- Pasting puts the middle paragraphs in with a single splice.
+
+Cmd.GotoEndOfDocument()
+Cmd.Paste()
+FireEvent("Changed")
+AssertEquals(6, #currentDocument)
+AssertTableEquals({"fourtwo", ""}, currentDocument[4])
+AssertTableEquals({"three"}, currentDocument[5])
+AssertTableEquals({""}, currentDocument[6])
+for i = 1, 6 do
+	AssertEquals(i, currentDocument[i].number)
+end
@@ -0,0 +1,154 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+-- wg.diff() finds the runs where two sequences differ.
+
+local function diff(a, b)
+	local s = {}
+	for i, r in wg.diff(a, b) do
+		s[i] = table.concat(r, " ")
+	end
+	return s
+end
+
+AssertTableEquals({}, diff({"a", "b"}, {"a", "b"}))
+AssertTableEquals({"2 1 2 1"}, diff({"a", "b", "c"}, {"a", "x", "c"}))
+AssertTableEquals({"2 0 2 2"}, diff({"a", "b"}, {"a", "x", "y", "b"}))
+AssertTableEquals({"1 1 1 0", "3 1 2 0"}, diff({"a", "b", "c"}, {"b"}))
+AssertTableEquals({"1 2 1 3"}, diff({"a", "b"}, {"x", "y", "z"}))
+AssertTableEquals({"1 0 1 1"}, diff({}, {"a"}))
+
+-- The matches it leaves are as long as they can be.
+
+local function lcs(a, b)
+	local previous = {}
+	for j = 0, #b do
+		previous[j] = 0
+	end
+	for i = 1, #a do
+		local current = { [0] = 0 }
+		for j = 1, #b do
+			if a[i] == b[j] then
+				current[j] = previous[j-1] + 1
+			else
+				current[j] = math.max(previous[j], current[j-1])
+			end
+		end
+		previous = current
+	end
+	return previous[#b]
+end
+
+local seed = 1
+local function random(n)
+	seed = (seed * 1103515245 + 12345) % 2147483648
+	return (seed // 65536) % n + 1
+end
+
+for t = 1, 200 do
+	local a = {}
+	local b = {}
+	for i = 1, random(30) - 1 do
+		a[i] = tostring(random(6))
+	end
+	for i = 1, random(30) - 1 do
+		b[i] = tostring(random(6))
+	end
+
+	local runs = wg.diff(a, b)
+	local ai, bi, matched = 1, 1, 0
+	for _, r in runs do
+		while ai < r[1] do
+			AssertEquals(a[ai], b[bi])
+			ai, bi, matched = ai + 1, bi + 1, matched + 1
+		end
+		AssertEquals(bi, r[3])
+		ai, bi = ai + r[2], bi + r[4]
+	end
+	AssertEquals(#a - ai, #b - bi)
+	while ai <= #a do
+		AssertEquals(a[ai], b[bi])
+		ai, bi, matched = ai + 1, bi + 1, matched + 1
+	end
+	AssertEquals(lcs(a, b), matched)
+end
+
+-- Documents are compared a paragraph at a time, and changed paragraphs a
+-- word at a time.
+
+local function paragraphs(...)
+	local ps = {}
+	for i, s in {...} do
+		ps[i] = CreateParagraph("P", SplitString(s, " "))
+	end
+	return ps
+end
+
+local old = paragraphs("one two three", "four five", "six", "seven eight",
+	"nine")
+local new = paragraphs("one two three", "four FIVE", "six", "new text",
+	"nine", "ten")
+new[3] = CreateParagraph("H1", {"six"})
+
+local differences = CompareDocuments(old, new)
+local labels = {}
+local where = {}
+for i, d in differences do
+	labels[i] = d.label
+	where[i] = d.kind..":"..d.pn..":"..d.wn
+end
+AssertTableEquals({
+	"2: \"five\" → \"FIVE\"",
+	"3: style changed to H1",
+	"4: \"seven eight\" → \"new text\"",
+	"6: added \"ten\"",
+}, labels)
+AssertTableEquals({"changed:2:2", "changed:3:1", "changed:4:1", "added:6:1"},
+	where)
+
+differences = CompareDocuments(new, old)
+AssertEquals("removed", differences[#differences].kind)
+AssertEquals("6: removed 1 paragraph \"ten\"", differences[#differences].label)
+AssertEquals(5, differences[#differences].pn)
+
+-- Comparing with an unchanged file finds nothing.
+
+local filename = wg.mkdtemp().."/tempfile"
+Cmd.InsertStringIntoParagraph("some text")
+AssertEquals(true, Cmd.SaveCurrentDocumentAs(filename))
+AssertEquals(true, FinishBackgroundSave())
+AssertEquals(false, Cmd.CompareWithFile(filename))
+AssertEquals(0, #CompareDocuments(
+	LoadFromFile(filename):findDocument(currentDocument.name),
+	currentDocument))
+
+-- Once the search gives up on a heavily reordered document, comparing it
+-- stays quick and doesn't need much more memory than the document itself.
+
+local original = {}
+local shuffled = {}
+for i = 1, 200000 do
+	original[i] = "paragraph "..i
+	shuffled[i] = original[i]
+end
+for i = #shuffled, 2, -1 do
+	local j = random(i)
+	shuffled[i], shuffled[j] = shuffled[j], shuffled[i]
+end
+
+wg.collectgarbage()
+local before = wg.allocstats().maxrss
+local t = wg.time()
+local runs = wg.diff(original, shuffled)
+t = wg.time() - t
+AssertEquals(true, #runs > 0)
+if t > 2.0 then
+	error(string.format("comparing reordered paragraphs took %.3fs", t))
+end
+if before then
+	local used = wg.allocstats().maxrss - before
+	if used > (64 * 1024 * 1024) then
+		error(string.format("comparing reordered paragraphs needed %d MB",
+			used // (1024*1024)))
+	end
+end
@@ -0,0 +1,29 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+local parts = {}
+for i = 1, 20000 do
+	parts[#parts+1] = "line "..i.." of some fairly compressible text\n"
+end
+local data = table.concat(parts)
+
+local c = wg.compress(data)
+AssertEquals(true, #c < #data)
+AssertEquals(data, wg.decompress(c))
+AssertEquals(data, wg.decompress(c, #data))
+AssertEquals(data, wg.decompress(c, 1))
+AssertEquals("", wg.decompress(wg.compress("")))
+AssertNull(wg.decompress("not a zlib stream"))
+AssertNull(wg.decompress(c:sub(1, #c // 2)))
+
+local d = wg.deflater()
+local out = {}
+for _, p in ipairs(parts) do
+	out[#out+1] = d:write(p)
+end
+out[#out+1] = d:finish()
+AssertEquals(data, wg.decompress(table.concat(out)))
+
+d = wg.deflater(9)
+AssertEquals(data, wg.decompress(d:write(data)..d:finish("tail")):sub(1, #data))
+AssertEquals(false, pcall(d.write, d, "more"))
@@ -0,0 +1,69 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+local dir = wg.mkdtemp()
+
+local a = dir.."/a.wg"
+local b = dir.."/b.wg"
+SaveTestDocumentSet(a, "text", "chapter", {
+	{"main", {"a one", "a \17two\16"}},
+	{"chapter", {"a three"}},
+})
+SaveTestDocumentSet(b, "compressed", "extra", {
+	{"main", {"b one"}},
+	{"extra", {"b two", "b three"}},
+	{"main (2)", {"b four"}},
+})
+
+-- The output is in the first file's format, and has its settings and
+-- current document; later documents are renumbered, and renamed where their
+-- names clash.
+
+local out = dir.."/out.wg"
+AssertEquals(true, (ConcatDocumentSets(out, {a, b})))
+AssertEquals(wg.readfile(a):sub(1, 20), wg.readfile(out):sub(1, 20))
+local ds = LoadFromFile(out)
+AssertTableEquals({
+	"main\nP a one\nP a \17two\16",
+	"chapter\nP a three",
+	"main (2)\nP b one",
+	"extra\nP b two\nP b three",
+	"main (2) (2)\nP b four",
+}, DocumentSetContents(ds))
+AssertEquals("chapter", ds.current.name)
+AssertEquals(a, ds.addons.test.from)
+AssertEquals(nil, ds._damaged)
+
+AssertEquals(true, (ConcatDocumentSets(out, {b, a, a})))
+AssertEquals(wg.readfile(b):sub(1, 20), wg.readfile(out):sub(1, 20))
+ds = LoadFromFile(out)
+AssertTableEquals({
+	"main\nP b one",
+	"extra\nP b two\nP b three",
+	"main (2)\nP b four",
+	"main (3)\nP a one\nP a \17two\16",
+	"chapter\nP a three",
+	"main (4)\nP a one\nP a \17two\16",
+	"chapter (2)\nP a three",
+}, DocumentSetContents(ds))
+AssertEquals("extra", ds.current.name)
+AssertEquals(b, ds.addons.test.from)
+
+-- Only files of the same version in the text and compressed formats can be
+-- done like this.
+
+local c = dir.."/c.wg"
+SaveTestDocumentSet(c, "wordtable", "main", {{"main", {"c one"}}})
+local ok, e = ConcatDocumentSets(out, {a, c})
+AssertEquals(false, ok)
+AssertNotNull(e:find("can be concatenated", 1, true))
+
+local old = dir.."/old.wg"
+wg.writefile(old, (wg.readfile(a):gsub("%.fileformat: %d+", ".fileformat: 7")))
+ok, e = ConcatDocumentSets(out, {a, old})
+AssertEquals(false, ok)
+AssertNotNull(e:find("different version", 1, true))
+
+ok, e = ConcatDocumentSets(out, {a, dir.."/missing.wg"})
+AssertEquals(false, ok)
+AssertNotNull(e:find("could not be opened", 1, true))
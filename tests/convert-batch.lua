@@ -0,0 +1,60 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+local dir = wg.mkdtemp()
+AssertNull(wg.writefile(dir.."/one.txt", "first\n\nsecond paragraph\n"))
+AssertNull(wg.writefile(dir.."/two.txt", "another"))
+
+local manifest = dir.."/manifest"
+AssertNull(wg.writefile(manifest, table.concat({
+	"# a comment",
+	dir.."/one.txt\t"..dir.."/one.md",
+	"",
+	dir.."/two.txt\t"..dir.."/two.html",
+	dir.."/two.txt\t"..dir.."/two.xyzzy",
+	"no tab here",
+	dir.."/two.txt\t"..dir.."/two.md\r",
+}, "\n")))
+
+local results = ConvertBatch(manifest)
+AssertEquals(5, #results)
+
+AssertEquals(true, results[1].ok)
+AssertEquals(dir.."/one.txt", results[1].src)
+AssertEquals(dir.."/one.md", results[1].dest)
+AssertEquals(true, wg.readfile(dir.."/one.md"):find("second paragraph", 1, true) ~= nil)
+
+AssertEquals(true, results[2].ok)
+AssertEquals(true, wg.readfile(dir.."/two.html"):find("another", 1, true) ~= nil)
+
+AssertEquals(false, results[3].ok)
+AssertEquals(true, results[3].message:find("don't know how to export", 1, true) ~= nil)
+
+AssertEquals(false, results[4].ok)
+AssertEquals(true, results[4].message:find("manifest line 6", 1, true) ~= nil)
+
+-- Each conversion gets a fresh document set, so nothing leaks between them.
+AssertEquals(true, results[5].ok)
+local two = wg.readfile(dir.."/two.md")
+AssertEquals(true, two:find("another", 1, true) ~= nil)
+AssertEquals(nil, two:find("first", 1, true))
+
+for _, r in results do
+	AssertEquals("number", type(r.time))
+end
+
+AssertNull(ConvertBatch(dir.."/missing"))
+
+-- - is stdin or stdout, which needs a format and can't be used for every one.
+local ok, e = ConvertFile("-", dir.."/out.md")
+AssertEquals(false, ok)
+AssertEquals("'-' needs a format, like -:html", e)
+ok, e = ConvertFile(dir.."/two.txt", "-:odt")
+AssertEquals(false, ok)
+AssertEquals("'-' can't be used with the 'odt' format", e)
+
+-- A document name renames the imported document.
+ResetDocumentSet()
+AssertEquals(true, (ConvertFile(dir.."/two.txt:Chapter", dir.."/named.html")))
+AssertEquals("Chapter", currentDocument.name)
+AssertEquals(true, wg.readfile(dir.."/named.html"):find("<title>Chapter</title>", 1, true) ~= nil)
@@ -40,3 +40,41 @@ AssertEquals("", currentDocument[1][1])
 AssertEquals(1, currentDocument.co)
 
 
+
+-- Selections spanning paragraphs leave one paragraph behind, made of what
+-- was before the start and after the end.
+
+local function deleterange(p1, w1, o1, p2, w2, o2)
+	ResetDocumentSet()
+	Cmd.InsertStringIntoParagraph("aaa bbb ccc")
+	for i = 1, 5 do
+		Cmd.SplitCurrentParagraph()
+		Cmd.InsertStringIntoParagraph("p"..i.." xxx yyy")
+	end
+	Cmd.ChangeParagraphStyle("Q")
+
+	currentDocument.cp, currentDocument.cw, currentDocument.co = p1, w1, o1
+	Cmd.SetMark()
+	currentDocument.cp, currentDocument.cw, currentDocument.co = p2, w2, o2
+	AssertEquals(true, Cmd.Delete())
+end
+
+deleterange(1, 2, 1, 4, 3, 2)
+AssertEquals(3, #currentDocument)
+AssertTableEquals({"aaa", "yy"}, currentDocument[1])
+AssertEquals("P", currentDocument[1].style)
+AssertTableEquals({"p4", "xxx", "yyy"}, currentDocument[2])
+AssertTableEquals({1, 2, 1}, currentDocument:cursor())
+
+deleterange(1, 2, 2, 4, 3, 1)
+AssertTableEquals({"aaa", "byyy"}, currentDocument[1])
+AssertTableEquals({1, 2, 2}, currentDocument:cursor())
+
+deleterange(1, 3, 4, 3, 1, 1)
+AssertEquals(4, #currentDocument)
+AssertTableEquals({"aaa", "bbb", "cccp2", "xxx", "yyy"}, currentDocument[1])
+AssertTableEquals({1, 3, 4}, currentDocument:cursor())
+
+deleterange(1, 1, 1, 6, 3, 4)
+AssertEquals(1, #currentDocument)
+AssertTableEquals({""}, currentDocument[1])
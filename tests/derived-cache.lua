@@ -0,0 +1,74 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+local dir = wg.mkdtemp()
+local cachedir = dir.."/cache"
+local filename = dir.."/tempfile"
+
+local function cachefiles()
+	local files = {}
+	for _, f in wg.readdir(cachedir) or {} do
+		if (f:sub(1, 1) ~= ".") then
+			files[#files+1] = f
+		end
+	end
+	return files
+end
+
+Cmd.InsertStringIntoParagraph("one two")
+Cmd.SplitCurrentParagraph()
+Cmd.InsertStringIntoParagraph("three")
+
+-- Off by default.
+
+AssertEquals(false, GlobalSettings.derivedcache.enabled)
+StoreDerivedData("test", currentDocument[1], {1})
+AssertEquals(nil, LookupDerivedData("test", currentDocument[1]))
+
+-- The cache for a file is picked up when it's loaded, and written out when
+-- asked to.
+
+GlobalSettings.derivedcache.enabled = true
+GlobalSettings.derivedcache.directory = cachedir
+AssertEquals(true, Cmd.SaveCurrentDocumentAs(filename))
+AssertEquals(true, FinishBackgroundSave())
+AssertEquals(true, Cmd.LoadDocumentSet(filename))
+
+local stats = GetDocumentStatistics(currentDocument)
+StoreDerivedData("test", currentDocument[2], {0, 7, 70000})
+FlushDerivedData()
+AssertEquals(1, #cachefiles())
+
+AssertEquals(true, Cmd.LoadDocumentSet(filename))
+AssertTableEquals({0, 7, 70000}, LookupDerivedData("test", currentDocument[2]))
+AssertTableEquals({wg.paragraphstats(currentDocument[1])},
+	LookupDerivedData("stats", currentDocument[1]))
+AssertEquals(nil, LookupDerivedData("test", currentDocument[1]))
+
+-- Entries belong to paragraph contents, not positions.
+
+local p = CreateParagraph("P", {"three"})
+AssertTableEquals({0, 7, 70000}, LookupDerivedData("test", p))
+
+-- Saving a changed file moves the cache to go with it.
+
+local oldname = cachefiles()[1]
+Cmd.GotoEndOfDocument()
+Cmd.SplitCurrentParagraph()
+Cmd.InsertStringIntoParagraph("four")
+AssertEquals(true, Cmd.SaveCurrentDocument())
+AssertEquals(true, FinishBackgroundSave())
+local files = cachefiles()
+AssertEquals(1, #files)
+AssertEquals(true, files[1] ~= oldname)
+
+AssertEquals(true, Cmd.LoadDocumentSet(filename))
+AssertTableEquals({0, 7, 70000}, LookupDerivedData("test", p))
+
+-- A damaged cache file is ignored.
+
+FlushDerivedData()
+wg.writefile(cachedir.."/"..files[1], "WGDERIV1 rubbish")
+AssertEquals(true, Cmd.LoadDocumentSet(filename))
+AssertEquals(nil, LookupDerivedData("test", p))
+AssertEquals(stats.words + 1, GetDocumentStatistics(currentDocument).words)
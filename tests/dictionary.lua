@@ -0,0 +1,120 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+local dir = wg.mkdtemp()
+local words = dir.."/words"
+local cache = dir.."/words.wgdict"
+AssertNull(wg.writefile(words, "apple\r\nBanana\n\ncherry\napple\ndurian"))
+
+local d = assert(wg.dictionary(words, cache))
+AssertEquals(true, d:contains("apple"))
+AssertEquals(true, d:contains("Banana"))
+AssertEquals(false, d:contains("banana"))
+AssertEquals(true, d:contains("cherry"))
+AssertEquals(true, d:contains("durian"))
+AssertEquals(false, d:contains("appl"))
+AssertEquals(false, d:contains(""))
+AssertNotNull(wg.stat(cache))
+
+-- The cache is picked up on the next open.
+d = assert(wg.dictionary(words, cache))
+AssertEquals(true, d:contains("cherry"))
+
+-- Changing the word list rebuilds the cache.
+AssertNull(wg.writefile(words, "elderberry\nfig\n"))
+d = assert(wg.dictionary(words, cache))
+AssertEquals(false, d:contains("cherry"))
+AssertEquals(true, d:contains("elderberry"))
+AssertEquals(true, d:contains("fig"))
+
+-- Cache locations which can't be written are skipped, and if there are none
+-- the dictionary is just kept in memory.
+local other = dir.."/other.wgdict"
+d = assert(wg.dictionary(words, dir.."/missing/words.wgdict", other))
+AssertEquals(true, d:contains("fig"))
+AssertNotNull(wg.stat(other))
+d = assert(wg.dictionary(words))
+AssertEquals(true, d:contains("fig"))
+
+-- A corrupt cache is ignored.
+AssertNull(wg.writefile(cache, "WGDICT rubbish"))
+d = assert(wg.dictionary(words, cache))
+AssertEquals(true, d:contains("elderberry"))
+
+local d, e = wg.dictionary(dir.."/nonexistent", cache)
+AssertEquals(nil, d)
+AssertNotNull(e)
+
+-- Building the cache can be done in the background; the dictionary is empty
+-- until it's finished.
+AssertNull(wg.writefile(words, "grape\nhuckleberry\n"))
+d = assert(wg.loaddictionary(words, cache))
+AssertEquals(true, d:poll(true))
+AssertEquals(true, d:contains("grape"))
+AssertEquals(true, d:poll())
+
+-- A damaged cache with no empty slots doesn't make lookups go round forever.
+local image = wg.readfile(cache)
+local full = string.rep(string.pack("I4", 1), 16)
+AssertNull(wg.writefile(cache, image:sub(1, 48)..full..image:sub(49 + #full)))
+d = assert(wg.dictionary(words, cache))
+AssertEquals(false, d:contains("fig"))
+
+-- The spellchecker uses it.
+GlobalSettings.systemdictionary.filename = words
+AssertEquals(true, GetSystemDictionary():contains("huckleberry"))
+
+documentSet.addons.spellchecker.enabled = true
+documentSet.addons.spellchecker.usesystemdictionary = true
+documentSet.addons.spellchecker.useuserdictionary = false
+AssertEquals(false, IsWordMisspelt("huckleberry", false))
+AssertEquals(true, IsWordMisspelt("fig", false))
+AssertEquals(false, IsWordMisspelt("Grape", true))
+AssertEquals(true, IsWordMisspelt("Grape", false))
+
+-- Suggestions are the nearest words, best first, and their edit distances.
+AssertNull(wg.writefile(words,
+	"the\nthen\nthey\nother\naccommodation\naccommodate\nLondon\nlonging\n"))
+d = assert(wg.dictionary(words, cache))
+local s, distances = d:suggest("teh")
+AssertEquals("the", s[1])
+AssertEquals(1, distances[1])
+AssertTableEquals({"accommodation"}, (d:suggest("acommodation")))
+AssertTableEquals({"London"}, (d:suggest("londn")))
+AssertTableEquals({"then"}, (d:suggest("the", 1)))
+AssertTableEquals({}, (d:suggest("zzzzzz")))
+AssertTableEquals({}, (d:suggest("")))
+AssertEquals(1, wg.editdistance("form", "from"))
+AssertEquals(3, wg.editdistance("kitten", "sitting"))
+AssertEquals(2, wg.editdistance("kitten", "sitting", 1))
+
+-- The spellchecker adds in the user dictionary, and capitalises at the
+-- start of sentences.
+SetSystemDictionaryForTesting({"the", "then", "they", "other"})
+AssertTableEquals({"The", "Then", "They"},
+	GetSpellingSuggestions("Thw"))
+documentSet.addons.spellchecker.useuserdictionary = true
+Cmd.InsertStringIntoParagraph("thw")
+Cmd.AddToUserDictionary()
+AssertTableEquals({"the"}, GetSpellingSuggestions("thx", 1))
+AssertTableEquals({"the", "thw"}, GetSpellingSuggestions("thwe", 2))
+
+-- Suggestions from a big dictionary are quick.
+local big = {}
+local seed = 1
+for i = 1, 50000 do
+	local w = {}
+	for j = 1, 5 + (i % 8) do
+		seed = (seed * 1103515245 + 12345) % 2147483648
+		w[j] = string.char(97 + (seed // 65536) % 26)
+	end
+	big[i] = table.concat(w)
+end
+AssertNull(wg.writefile(words, table.concat(big, "\n")))
+d = assert(wg.dictionary(words, cache))
+AssertEquals(true, d:contains(big[1000]))
+AssertEquals(true, table.find(d:suggest(big[1000]:sub(2)), big[1000]) ~= nil)
+AssertTimeBelow(0.001,
+	function()
+		d:suggest(big[1234]:sub(1, 3)..big[1234]:sub(5))
+	end)
@@ -0,0 +1,58 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+for i = 1, 100 do
+	Cmd.AddBlankDocument("d"..i)
+end
+AssertEquals(#documentSet.documents, 101)
+
+local function check()
+	for i, d in documentSet.documents do
+		AssertEquals(documentSet:_findDocument(d.name), i)
+	end
+	AssertEquals(documentSet:_findDocument("missing"), nil)
+end
+
+check()
+documentSet:moveDocumentIndexTo("d50", 1)
+AssertEquals(documentSet:_findDocument("d50"), 1)
+check()
+AssertEquals(documentSet:deleteDocument("d10"), true)
+AssertEquals(documentSet:_findDocument("d10"), nil)
+check()
+AssertEquals(documentSet:renameDocument("d20", "twenty"), true)
+AssertEquals(documentSet:_findDocument("d20"), nil)
+AssertEquals(documentSet:renameDocument("twenty", "d21"), false)
+check()
+
+-- Changes made behind the document set's back are noticed.
+
+local d = table.remove(documentSet.documents, 2)
+table.insert(documentSet.documents, d)
+AssertEquals(documentSet:_findDocument(d.name), #documentSet.documents)
+check()
+
+-- Switching between documents only renumbers them if something might have
+-- changed.
+
+local renumbered = 0
+local renumber = Document.renumber
+Document.renumber = function(self)
+	renumbered = renumbered + 1
+	return renumber(self)
+end
+
+Cmd.ChangeDocument("d1")
+Cmd.ChangeDocument("d2")
+renumbered = 0
+Cmd.ChangeDocument("d1")
+Cmd.ChangeDocument("d2")
+AssertEquals(renumbered, 0)
+
+Cmd.InsertStringIntoParagraph("one two three")
+Cmd.ChangeDocument("d1")
+Cmd.ChangeDocument("d2")
+AssertEquals(currentDocument.wordcount, 3)
+AssertEquals(renumbered > 0, true)
+
+Document.renumber = renumber
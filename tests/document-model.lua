@@ -0,0 +1,83 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+-- Reading a file into the native document model and writing it again gives
+-- exactly what WordGrinder itself saves, in both formats.
+
+local dir = wg.mkdtemp()
+
+local ds = CreateDocumentSet()
+ds.addons.test = { text = "quotes \" and\nnewlines", number = 1.5, flag = true }
+for i, name in {"main", "the \"second\" one", "extra\\", "empty"} do
+	local document = CreateDocument()
+	if name ~= "empty" then
+		for j = 1, 3 do
+			document[j] = CreateParagraph((j == 1) and "H1" or "P",
+				{"doc", tostring(i), "\17styled\16", "é", tostring(j)})
+		end
+	end
+	document.viewmode = i
+	ds:addDocument(document, name)
+end
+ds:setCurrent("extra\\")
+
+local text = dir.."/text.wg"
+local compressed = dir.."/compressed.wg"
+AssertEquals(true, SaveToFile(text, ds, "text"))
+AssertEquals(true, SaveToFile(compressed, ds, "compressed"))
+local textdata = wg.readfile(text)
+local compresseddata = wg.readfile(compressed)
+
+AssertEquals(textdata, wg.recodedocumentset(textdata, "text"))
+AssertEquals(textdata, wg.recodedocumentset(compresseddata, "text"))
+AssertEquals(compresseddata, wg.recodedocumentset(textdata, "compressed"))
+AssertEquals(compresseddata, wg.recodedocumentset(compresseddata, true))
+
+-- Files which have been through something which added carriage returns can
+-- be read too.
+
+AssertEquals(textdata, wg.recodedocumentset(textdata:gsub("\n", "\r\n"), "text"))
+
+-- What's read back by WordGrinder is what was saved.
+
+local converted = dir.."/converted.wg"
+wg.writefile(converted, wg.recodedocumentset(textdata, "compressed"))
+local loaded = LoadFromFile(converted)
+AssertEquals("extra\\", loaded.current.name)
+AssertEquals("quotes \" and\nnewlines", loaded.addons.test.text)
+local second = loaded:findDocument("the \"second\" one")
+MaterialiseDocument(second)
+AssertEquals(2, second.viewmode)
+AssertTableEquals({"doc", "2", "\17styled\16", "é", "3"}, {table.unpack(second[3])})
+
+-- Bad files are reported rather than being loaded.
+
+local r, e = wg.recodedocumentset("not a file", "text")
+AssertNull(r)
+AssertNotNull(e:find("not a text or compressed", 1, true))
+
+r, e = wg.recodedocumentset(textdata:gsub("\n#2\n", "\n#7\n"), "text")
+AssertNull(r)
+AssertNotNull(e:find("document 7 is missing", 1, true))
+
+local corrupt = compresseddata:sub(1, -20)..string.rep("x", 19)
+r, e = wg.recodedocumentset(corrupt, "text")
+AssertNull(r)
+AssertNotNull(e:find("corrupt", 1, true))
+
+-- A frame index claiming more than deflate could possibly produce is
+-- rejected before anything's allocated for it, by both readers.
+
+local header, csize, rest = compresseddata:match("^([^\n]*\n[^\n]*\n)(%d+) %d+(.*)$")
+AssertNotNull(header)
+local huge = header..csize.." 99999999999999"..rest
+r, e = wg.recodedocumentset(huge, "text")
+AssertNull(r)
+AssertNotNull(e:find("malformed frame index", 1, true))
+
+local hugefile = dir.."/huge.wg"
+wg.writefile(hugefile, huge)
+local ok
+ok, e = pcall(LoadFromFile, hugefile)
+AssertEquals(false, ok)
+AssertNotNull(tostring(e):find("malformed frame index", 1, true))
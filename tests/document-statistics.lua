@@ -0,0 +1,75 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+-- What gets counted in a single paragraph.
+
+AssertTableEquals({ 3, 12, 2 },
+	{ wg.paragraphstats(CreateParagraph("P", "One.", "Two", "three")) })
+AssertTableEquals({ 2, 9, 2 },
+	{ wg.paragraphstats(CreateParagraph("P", "“Why?”", "\24No!\16")) })
+AssertTableEquals({ 1, 3, 1 },
+	{ wg.paragraphstats(CreateParagraph("P", "日本語")) })
+AssertTableEquals({ 0, 0, 0 }, { wg.paragraphstats(CreateParagraph("P")) })
+AssertTableEquals({ 0, 0, 0 },
+	{ wg.paragraphstats(CreateParagraph("P", "", "\16")) })
+
+SetDocumentParagraphs({ "One two.", "Two (three) four!", "", "one" })
+
+local stats = GetDocumentStatistics(currentDocument)
+AssertEquals(6, stats.words)
+AssertEquals(25, stats.characters)
+AssertEquals(3, stats.spaces)
+AssertEquals(3, stats.sentences)
+AssertEquals(3, stats.paragraphcount)
+AssertEquals(nil, stats.counts)
+
+-- Word counts are made when first asked for.
+
+stats = GetDocumentStatistics(currentDocument, true)
+AssertEquals(1, stats.counts["two"])
+AssertEquals(1, stats.counts["Two"])
+AssertEquals(6, stats.distinct)
+
+local function frequent(n)
+	local t = {}
+	for _, f in GetMostFrequentWords(currentDocument, n) do
+		t[#t+1] = f[1]..":"..f[2]
+	end
+	return t
+end
+AssertTableEquals({ "one:2", "two:2", "four:1" }, frequent(3))
+
+-- Edits are picked up, and give the same answer as starting again.
+
+Cmd.GotoBeginningOfDocument()
+Cmd.InsertStringIntoParagraph("Zero ")
+Cmd.GotoEndOfDocument()
+Cmd.SplitCurrentParagraph()
+Cmd.InsertStringIntoParagraph("Five six. Seven")
+currentDocument:deleteParagraphAt(2)
+
+stats = GetDocumentStatistics(currentDocument, true)
+local counts = {}
+for w, n in stats.counts do
+	counts[#counts+1] = w..":"..n
+end
+table.sort(counts)
+
+currentDocument._statistics = nil
+local fresh = GetDocumentStatistics(currentDocument, true)
+AssertEquals(fresh.words, stats.words)
+AssertEquals(fresh.characters, stats.characters)
+AssertEquals(fresh.spaces, stats.spaces)
+AssertEquals(fresh.sentences, stats.sentences)
+AssertEquals(fresh.paragraphcount, stats.paragraphcount)
+AssertEquals(fresh.distinct, stats.distinct)
+local freshcounts = {}
+for w, n in fresh.counts do
+	freshcounts[#freshcounts+1] = w..":"..n
+end
+table.sort(freshcounts)
+AssertTableEquals(freshcounts, counts)
+
+AssertEquals(6, stats.words)
+AssertEquals(4, stats.sentences)
+AssertEquals(3, stats.paragraphcount)
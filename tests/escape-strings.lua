@@ -1,5 +1,8 @@
 local escape = wg.escape
 local unescape = wg.unescape
+local escapehtml = wg.escapehtml
+local escapelatex = wg.escapelatex
+local escapetroff = wg.escapetroff
 
 --!nonstrict
 loadfile("tests/testsuite.lua")()
@@ -19,3 +22,35 @@ AssertEquals("12💩34", unescape("12💩34"))
 AssertEquals('12\"34', unescape('12\\"34'))
 AssertEquals('12\\34', unescape('12\\\\34'))
 AssertEquals("", unescape(""))
+
+-- Specials after the first sixteen bytes, and among multibyte characters,
+-- are still found. Malformed UTF-8 isn't passed through as it is.
+AssertEquals("abcdefghijklmnopqrst\\nuv", escape("abcdefghijklmnopqrst\nuv"))
+AssertEquals("日本語の\\\"文章\\\"", escape('日本語の"文章"'))
+AssertEquals("abcdefghijklmnopqrst\nuv", unescape("abcdefghijklmnopqrst\\nuv"))
+AssertEquals("日本語の\"文章\"", unescape('日本語の\\"文章\\"'))
+AssertEquals("a\0b", escape("a\xc0\x80b"))
+AssertEquals("a\0b", unescape("a\xc0\x80b"))
+
+-- Long strings cover both the vector scan and the scalar tail.
+local long = string.rep("abcdefghij", 10)
+
+AssertEquals("1234", escapehtml("1234"))
+AssertEquals(long, escapehtml(long))
+AssertEquals("&lt;b&gt; &amp; c", escapehtml("<b> & c"))
+AssertEquals(long.."&amp;"..long, escapehtml(long.."&"..long))
+AssertEquals("a<text:s/>b<text:s/>&lt;", escapehtml("a b\t<", "<text:s/>"))
+AssertEquals("", escapehtml(""))
+
+AssertEquals(long, escapelatex(long))
+AssertEquals("\\#\\$\\&\\{\\}\\%", escapelatex("#$&{}%"))
+AssertEquals("\\_{}\\^{}\\~{}", escapelatex("_^~"))
+AssertEquals("$\\langle$$\\rangle$$\\backslash$", escapelatex("<>\\"))
+AssertEquals(long.."\\_{}"..long, escapelatex(long.."_"..long))
+
+AssertEquals(long, escapetroff(long))
+AssertEquals('a\\\\b"c', escapetroff('a\\b"c'))
+AssertEquals('a\\\\b\\\\"c', escapetroff('a\\b"c', true))
+AssertEquals("12\\[u1F4A9]34", escapetroff("12💩34"))
+AssertEquals("\\[u007F]", escapetroff("\127"))
+AssertEquals(long.."\\[u00E9]"..long, escapetroff(long.."é"..long))
@@ -0,0 +1,134 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+-- Listeners are called in order of priority, and in the order they were
+-- added within a priority.
+
+local calls = {}
+local function listener(name)
+	return function(event, token, ...)
+		calls[#calls+1] = name
+	end
+end
+
+local t1 = AddEventListener("WaitingForUser", listener("a"), nil, 10)
+local t2 = AddEventListener("WaitingForUser", listener("b"), nil, -10)
+local t3 = AddEventListener("WaitingForUser", listener("c"), nil, 10)
+local t4 = AddEventListener("WaitingForUser", listener("d"), nil, 5)
+FireEvent("WaitingForUser")
+AssertTableEquals({"b", "d", "a", "c"}, calls)
+
+-- Removing a listener while an event is firing doesn't upset the others.
+
+calls = {}
+local t5 = AddEventListener("WaitingForUser",
+	function()
+		calls[#calls+1] = "remover"
+		RemoveEventListener(t3)
+	end, nil, 7)
+FireEvent("WaitingForUser")
+AssertTableEquals({"b", "d", "remover", "a", "c"}, calls)
+calls = {}
+FireEvent("WaitingForUser")
+AssertTableEquals({"b", "d", "remover", "a"}, calls)
+
+for _, t in {t1, t2, t4, t5} do
+	RemoveEventListener(t)
+end
+calls = {}
+FireEvent("WaitingForUser")
+AssertTableEquals({}, calls)
+
+-- Filters see the value returned by the one before.
+
+documentSet.addons.spellchecker.enabled = false
+local f1 = AddEventFilter("DrawWord",
+	function(event, token, cstyle, word, firstword)
+		AssertEquals("word", word)
+		AssertEquals(true, firstword)
+		return cstyle + 1
+	end, nil, 1)
+local f2 = AddEventFilter("DrawWord",
+	function(event, token, cstyle, word, firstword)
+		return nil
+	end, nil, 2)
+local f3 = AddEventFilter("DrawWord",
+	function(event, token, cstyle, word, firstword)
+		return cstyle * 10
+	end, nil, 3)
+AssertEquals(10, FilterEvent("DrawWord", 0, "word", true))
+
+-- Old-style listeners get, and old-style callers pass, a payload table.
+
+local l1 = AddEventListener("DrawWord",
+	function(event, token, payload)
+		AssertEquals("word", payload.word)
+		payload.cstyle = payload.cstyle + 2
+	end, nil, 4)
+AssertEquals(12, FilterEvent("DrawWord", 0, "word", true))
+
+local payload = { word="word", cstyle=1, firstword=true }
+FireEvent("DrawWord", payload)
+AssertEquals(22, payload.cstyle)
+
+for _, t in {f1, f2, f3, l1} do
+	RemoveEventListener(t)
+end
+AssertEquals(3, FilterEvent("DrawWord", 3, "word", true))
+
+-- Deferred listeners are called once, when things go quiet.
+
+local deferredcalls = 0
+local d1 = AddDeferredEventListener("WaitingForUser",
+	function(event, token, ...)
+		AssertEquals("WaitingForUser", event)
+		AssertEquals(0, select("#", ...))
+		deferredcalls = deferredcalls + 1
+	end, 1000)
+FireEvent("WaitingForUser", "ignored")
+FireEvent("WaitingForUser")
+RunDeferredEvents()
+AssertEquals(0, deferredcalls)
+AssertEquals(true, GetDeferredEventDeadline() ~= nil)
+RunDeferredEvents(wg.time() + 1001)
+AssertEquals(1, deferredcalls)
+AssertNull(GetDeferredEventDeadline())
+
+FireEvent("WaitingForUser")
+FireEvent("Idle")
+AssertEquals(2, deferredcalls)
+
+FireEvent("WaitingForUser")
+FlushDeferredEvents()
+FlushDeferredEvents()
+AssertEquals(3, deferredcalls)
+
+FireEvent("WaitingForUser")
+RemoveEventListener(d1)
+FlushDeferredEvents()
+AssertEquals(3, deferredcalls)
+
+-- Timers go off in order of deadline, and only once they're due.
+
+local fired = {}
+local t3 = AddTimer(3000, function() fired[#fired+1] = 3 end)
+AddTimer(1000, function() fired[#fired+1] = 1 end)
+local t2 = AddTimer(2000, function() fired[#fired+1] = 2 end, true)
+AddTimer(4000, function() fired[#fired+1] = 4 end)
+RunTimers()
+AssertTableEquals({}, fired)
+AssertEquals(true, GetDeferredEventDeadline() ~= nil)
+
+RemoveTimer(t3)
+RemoveTimer(t3)
+RunTimers(wg.time() + 2500)
+AssertTableEquals({1, 2}, fired)
+
+-- A repeating timer comes back, but only once per call.
+
+RunTimers(math.huge)
+AssertTableEquals({1, 2, 2, 4}, fired)
+RemoveTimer(t2)
+RunTimers(math.huge)
+AssertTableEquals({1, 2, 2, 4}, fired)
+AssertNull(GetDeferredEventDeadline())
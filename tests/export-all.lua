@@ -0,0 +1,63 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+local dir = wg.mkdtemp()
+
+currentDocument[1] = CreateParagraph("H1", {"Main"})
+AddTestDocument("one", {
+	"A fish",
+	CreateParagraph("LN", {"first"}),
+	CreateParagraph("LN", {"second"}),
+})
+AddTestDocument("two/three", {CreateParagraph("Q", {"blue", "\17fish\16"})})
+documentSet:setCurrent("main")
+AssertEquals(true, Cmd.SaveCurrentDocumentAs(dir.."/set.wg"))
+AssertEquals(true, FinishBackgroundSave())
+
+-- The native formats are exported on other threads, but must come out just
+-- as they would on this one. Each document is numbered on its own.
+
+local expected = {}
+for i, document in documentSet:getDocumentList() do
+	expected[i] = ExportDocumentNatively(document, "html",
+		documentSet.addons.htmlexport)
+end
+
+ResetDocumentSet()
+local results = ExportAll(dir.."/set.wg", dir.."/out.html")
+AssertEquals(3, #results)
+AssertEquals("main", results[1].name)
+AssertEquals(dir.."/out.1.main.html", results[1].filename)
+AssertEquals("one", results[2].name)
+AssertEquals(dir.."/out.2.one.html", results[2].filename)
+AssertEquals("two/three", results[3].name)
+AssertEquals(dir.."/out.3.two_three.html", results[3].filename)
+for i, r in results do
+	AssertEquals(true, r.ok)
+	AssertEquals(expected[i], wg.readfile(r.filename))
+end
+AssertEquals(true, wg.readfile(dir.."/out.2.one.html"):find("value=2>second", 1, true) ~= nil)
+
+-- Other formats go through the Lua exporters, one at a time.
+
+local results = ExportAll(dir.."/set.wg", dir.."/out.tex")
+AssertEquals(3, #results)
+for _, r in results do
+	AssertEquals(true, r.ok)
+end
+AssertEquals(true, wg.readfile(dir.."/out.2.one.tex"):find("fish", 1, true) ~= nil)
+AssertEquals(nil, wg.readfile(dir.."/out.2.one.tex"):find("blue", 1, true))
+AssertEquals(true, wg.readfile(dir.."/out.3.two_three.tex"):find("blue", 1, true) ~= nil)
+
+-- Failures are per document.
+
+local results = ExportAll(dir.."/set.wg", dir.."/missing/out.txt")
+AssertEquals(3, #results)
+for _, r in results do
+	AssertEquals(false, r.ok)
+	AssertEquals("string", type(r.message))
+end
+
+local results, e = ExportAll(dir.."/set.wg", dir.."/out.wg")
+AssertNull(results)
+AssertEquals(true, e:find("don't know how to export", 1, true) ~= nil)
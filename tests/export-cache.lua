@@ -0,0 +1,92 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+local function original()
+	return {
+		CreateParagraph("H1", "Title"),
+		"some \024bold text",
+		CreateParagraph("LN", "one"),
+		CreateParagraph("LN", "two"),
+		CreateParagraph("LN", "three"),
+		"between",
+		CreateParagraph("PRE", "code"),
+		CreateParagraph("PRE", "more", "code"),
+		"end",
+	}
+end
+
+SetDocumentParagraphs(original())
+
+-- A counting exporter: only the paragraphs which have changed get rendered
+-- again.
+
+local texts = 0
+local lastcache
+local function counting(writer, document)
+	local cache = ExportCache("test", writer)
+	lastcache = cache
+	writer = cache.writer
+	local function nothing() end
+	ExportFileUsingCallbacks(document, {
+		cache = cache,
+		prologue = nothing, epilogue = nothing,
+		paragraph_start = function(p) writer("<", p.style, ">") end,
+		paragraph_end = function(p) writer("</", p.style, ">") end,
+		list_start = nothing, list_end = nothing,
+		text = function(s) texts = texts + 1 writer(s) end,
+		rawtext = function(s) writer(s) end,
+		notext = nothing,
+		italic_on = nothing, italic_off = nothing,
+		bold_on = nothing, bold_off = nothing,
+		underline_on = nothing, underline_off = nothing,
+	})
+end
+
+local first = ExportToString(currentDocument, counting)
+AssertEquals(9, lastcache.misses)
+local firsttexts = texts
+
+texts = 0
+AssertEquals(first, ExportToString(currentDocument, counting))
+AssertEquals(0, texts)
+AssertEquals(9, lastcache.hits)
+
+currentDocument:deleteParagraphAt(6)
+currentDocument:insertParagraphBefore(CreateParagraph("P", "changed"), 6)
+currentDocument:touch()
+texts = 0
+local changed = ExportToString(currentDocument, counting)
+AssertEquals(1, texts)
+AssertEquals(1, lastcache.misses)
+AssertEquals(true, changed:find("<P>changed</P>", 1, true) ~= nil)
+
+-- The real exporters produce the same output from the cache as they do
+-- from scratch, even when list items are renumbered and paragraphs change
+-- style next to ones which haven't.
+
+local exporters = {
+	Cmd.ExportToLatexString,
+	Cmd.ExportToTroffString,
+	Cmd.ExportToOrgString,
+	Cmd.ExportToODTString,
+}
+
+local function edit()
+	currentDocument:insertParagraphBefore(CreateParagraph("LN", "zero"), 3)
+	currentDocument:deleteParagraphAt(8)
+	currentDocument:insertParagraphBefore(CreateParagraph("P", "code"), 8)
+	currentDocument:touch()
+end
+
+for _, export in ipairs(exporters) do
+	SetDocumentParagraphs(original())
+	FlushExportCaches()
+	local a = export()
+	AssertEquals(a, export())
+
+	edit()
+	local cached = export()
+	FlushExportCaches()
+	AssertEquals(export(), cached)
+	AssertEquals(false, cached == a)
+end
@@ -48,7 +48,7 @@ local expected = [[
 </head><body>
 
 <p>one two three</p>
-<p>four <b>bold</b><i><b>italic</b></i><i><b><u>underline </u></b></i><i><b><u>stillunderline</u></b></i>plain</p>
+<p>four <b>bold<i>italic<u>underline stillunderline</u></i></b>plain</p>
 <h1>heading</h1>
 <ul>
 <li>bullet</li>
@@ -64,3 +64,11 @@ expected = expected:gsub("@@@", VERSION)
 local output = Cmd.ExportToHTMLString()
 AssertEquals(expected, output)
 
+
+-- Underlining which stops at the end of a word is closed before the space,
+-- and only once.
+
+currentDocument:deleteParagraphsAt(2, #currentDocument - 1)
+currentDocument[1] = CreateParagraph("P", {"\018under\016", "plain"})
+output = Cmd.ExportToHTMLString()
+AssertNotNull(output:find("<p><u>under</u> plain</p>", 1, true))
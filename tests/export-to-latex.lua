@@ -52,7 +52,7 @@ local expected = [[
 \maketitle
 one two three
 
-four \textbf{bold}\textit{\textbf{italic}}\textit{\textbf{\underline{underline }}}\textit{\textbf{\underline{stillunderline}}}plain
+four \textbf{bold\textit{italic\underline{underline stillunderline}}}plain
 
 \section{heading}
 \begin{enumerate}
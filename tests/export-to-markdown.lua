@@ -44,7 +44,7 @@ local expected = [[
 
 one two three
 
-four <b>bold</b><i><b>italic</b></i><i><b><u>underline </u></b></i><i><b><u>stillunderline</u></b></i>plain
+four <b>bold<i>italic<u>underline stillunderline</u></i></b>plain
 
 # heading
 
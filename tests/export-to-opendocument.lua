@@ -50,7 +50,7 @@ local expected = [[
 					<office:body><office:text>
 				
 <text:p text:style-name="P">one<text:s/>two<text:s/>three</text:p>
-<text:p text:style-name="P">four<text:s/><text:span text:style-name="B">bold</text:span><text:span text:style-name="I"><text:span text:style-name="B">italic</text:span></text:span><text:span text:style-name="I"><text:span text:style-name="B"><text:span text:style-name="UL">underline<text:s/></text:span></text:span></text:span><text:span text:style-name="I"><text:span text:style-name="B"><text:span text:style-name="UL">stillunderline</text:span></text:span></text:span>plain</text:p>
+<text:p text:style-name="P">four<text:s/><text:span text:style-name="B">bold<text:span text:style-name="I">italic<text:span text:style-name="UL">underline<text:s/>stillunderline</text:span></text:span></text:span>plain</text:p>
 <text:h text:style-name="H1" text:outline-level="1">heading</text:h>
 <text:list text:style-name="LB"><text:list-item><text:p text:style-name="P">bullet</text:p></text:list-item></text:list>
 <text:list text:style-name="L"><text:list-item><text:p text:style-name="P">no<text:s/>bullet</text:p></text:list-item></text:list>
@@ -62,3 +62,20 @@ local expected = [[
 local output = Cmd.ExportToODTString()
 AssertEquals(expected, output)
 
+
+local filename = wg.mkdtemp().."/test.odt"
+AssertEquals(true, Cmd.ExportODTFile(filename))
+AssertEquals(expected, wg.readfromzip(filename, "content.xml"))
+AssertEquals("application/vnd.oasis.opendocument.text",
+	wg.readfromzip(filename, "mimetype"))
+
+local zw = wg.zipwriter(filename)
+AssertEquals(true, zw:begin("stored", "store"))
+AssertEquals(true, zw:write("one "))
+AssertEquals(true, zw:write("two"))
+AssertEquals(true, zw:begin("fast", "fast"))
+AssertEquals(true, zw:write(string.rep("x", 100000)))
+AssertEquals(true, zw:close())
+AssertEquals("one two", wg.readfromzip(filename, "stored"))
+AssertEquals(string.rep("x", 100000), wg.readfromzip(filename, "fast"))
+AssertEquals(false, pcall(zw.write, zw, "more"))
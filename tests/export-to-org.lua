@@ -45,7 +45,7 @@ local expected = [[
 
 one two three
 
-four *bold*/*italic*//*_underline _*//*_stillunderline_*/plain
+four *bold/italic_underline stillunderline_/*plain
 
 * heading
 
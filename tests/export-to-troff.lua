@@ -48,11 +48,9 @@ main
 .LP
 one two three
 .LP
-four \fBbold\fR\fI\f(BIitalic\fI\fR\fI\f(BI
-.UL "\f(BIunderline \f(BI"
-\fI\fR\fI\f(BI
-.UL "\f(BIstillunderline\f(BI"
-\fI\fRplain
+four \fBbold\f(BIitalic
+.UL "\f(BIunderline stillunderline\f(BI"
+\fB\fRplain
 .NH 1
 heading
 .IP \[bu] 3
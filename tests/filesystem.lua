@@ -11,6 +11,50 @@ AssertEquals(nil, errno)
 table.sort(t)
 AssertTableEquals({ ".", "..", "baz" }, t)
 
+-- scandir() sorts directories first and can filter by prefix.
+local function scan(name, prefix)
+	local t, _, errno = wg.scandir(name, prefix)
+	AssertEquals(nil, errno)
+	local names = {}
+	for _, f in t do
+		names[#names+1] = f.name..":"..f.mode
+	end
+	return names
+end
+wg.mkdirs(dir.."/scan/beta")
+wg.writefile(dir.."/scan/alpha", "")
+wg.writefile(dir.."/scan/bar", "")
+wg.mkdirs(dir.."/scan/baz")
+AssertTableEquals({ "..:directory", "baz:directory", "beta:directory",
+	"alpha:file", "bar:file" }, scan(dir.."/scan"))
+AssertTableEquals({ "baz:directory", "bar:file" }, scan(dir.."/scan", "ba"))
+
+-- The same from a background scan; the listing is remembered, but not once
+-- the directory changes.
+local function background(name, prefix)
+	local scan = wg.startscandir(name)
+	local finished
+	repeat
+		finished = scan:poll(1)
+	until finished ~= false
+	AssertEquals(true, finished)
+	local names = {}
+	for _, f in scan:entries(prefix) do
+		names[#names+1] = f.name..":"..f.mode
+	end
+	return names
+end
+AssertTableEquals({ "baz:directory", "bar:file" },
+	background(dir.."/scan", "ba"))
+AssertTableEquals({ "baz:directory", "bar:file" },
+	background(dir.."/scan", "ba"))
+wg.writefile(dir.."/scan/bat", "")
+AssertTableEquals({ "baz:directory", "bar:file", "bat:file" },
+	background(dir.."/scan", "ba"))
+AssertEquals(nil, (wg.startscandir(dir.."/foo/bar/bloo"):poll(10)))
+t, _, errno = wg.scandir(dir.."/foo/bar/bloo")
+AssertEquals(wg.ENOENT, errno)
+
 t, _, errno = wg.stat(dir.."/foo/bar/baz")
 AssertEquals(nil, errno)
 AssertEquals("directory", t.mode)
@@ -18,3 +62,45 @@ AssertEquals("directory", t.mode)
 t, _, errno = wg.stat(dir.."/foo/bar/bloo")
 AssertEquals(wg.ENOENT, errno)
 
+
+wg.writefile(dir.."/file", "one\ntwo\r\n\nthree")
+AssertEquals("one\ntwo\r\n\nthree", wg.readfile(dir.."/file"))
+
+local mf = wg.mapfile(dir.."/file")
+AssertEquals(15, #mf)
+AssertEquals(15, mf:len())
+AssertEquals("one", mf:sub(1, 3))
+AssertEquals("three", mf:sub(-5))
+AssertEquals("", mf:sub(5, 4))
+AssertEquals(4, (mf:find("\n")))
+AssertEquals(9, (mf:find("\n", 5)))
+AssertEquals(nil, mf:find("four"))
+t = {}
+for l in mf:lines() do
+	t[#t+1] = l
+end
+AssertTableEquals({"one", "two\r", "", "three"}, t)
+t = {}
+for l in CreateIStream(mf, 5):lines() do
+	t[#t+1] = l
+end
+AssertTableEquals({"two\r", "", "three"}, t)
+mf:close()
+AssertEquals(0, #mf)
+
+wg.writefile(dir.."/empty", "")
+mf = wg.mapfile(dir.."/empty")
+AssertEquals(0, #mf)
+AssertEquals("", mf:sub(1))
+
+t, _, errno = wg.mapfile(dir.."/foo/bar/bloo")
+AssertEquals(wg.ENOENT, errno)
+
+local w = wg.openwriter(dir.."/written")
+w:write("one", "\n", "two")
+w:write(string.rep("x", 100000))
+AssertEquals(true, w:close())
+AssertEquals("one\ntwo"..string.rep("x", 100000), wg.readfile(dir.."/written"))
+
+t, _, errno = wg.openwriter(dir.."/missing/file")
+AssertEquals(wg.ENOENT, errno)
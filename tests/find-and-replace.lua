@@ -53,3 +53,94 @@ Cmd.Find("fred", " ")
 Cmd.ReplaceThenFind()
 AssertTableEquals({"boris", "TWO", "Three", "Three"}, currentDocument[1])
 
+
+-- Style bytes are invisible to the search, and offsets come back in terms
+-- of the original words.
+
+currentDocument[2] = CreateParagraph("P", {"\017Wo\016rd\016", "Thr\017ee"})
+Cmd.GotoBeginningOfDocument()
+Cmd.Find("word three")
+assert_sel({2, 1, 2}, {2, 2, 7})
+
+-- Searches wrap round to the beginning of the document, but matches can't
+-- wrap across its end.
+
+Cmd.GotoBeginningOfDocument()
+Cmd.GotoNextParagraph()
+AssertEquals(true, Cmd.Find("boris"))
+assert_sel({1, 1, 1}, {1, 1, 6})
+AssertEquals(false, Cmd.Find("WordSix boris"))
+AssertEquals(false, Cmd.Find("nonexistent"))
+
+-- Replace all rewrites every match at once, including ones which span
+-- paragraphs, and leaves the paragraphs without matches alone.
+
+SetDocumentParagraphs({"one two one", "three", "xoney two"})
+local untouched = currentDocument[2]
+Cmd.Find("one", "fred bloggs")
+AssertEquals(true, Cmd.ReplaceAll())
+AssertEquals(3, #currentDocument)
+AssertTableEquals({"fred", "bloggs", "two", "fred", "bloggs"}, currentDocument[1])
+AssertEquals(true, rawequal(untouched, currentDocument[2]))
+AssertTableEquals({"xfred", "bloggsy", "two"}, currentDocument[3])
+AssertTableEquals({3, 2, 7}, {currentDocument.cp, currentDocument.cw, currentDocument.co})
+
+SetDocumentParagraphs({"a end", "start b", "end", "start c"})
+Cmd.Find("end start", "-")
+AssertEquals(true, Cmd.ReplaceAll())
+AssertEquals(2, #currentDocument)
+AssertTableEquals({"a", "-", "b"}, currentDocument[1])
+AssertTableEquals({"-", "c"}, currentDocument[2])
+
+SetDocumentParagraphs({"aaaa"})
+Cmd.Find("aa", "b")
+AssertEquals(true, Cmd.ReplaceAll())
+AssertTableEquals({"bb"}, currentDocument[1])
+
+SetDocumentParagraphs({"\017Bold\016 plain"})
+Cmd.Find("ld pl", "")
+AssertEquals(true, Cmd.ReplaceAll())
+AssertTableEquals({"\017Bo\016ain"}, currentDocument[1])
+
+AssertEquals(false, Cmd.Find("nonexistent"))
+AssertEquals(false, Cmd.ReplaceAll())
+
+-- It's a single undo step.
+
+SetDocumentParagraphs({"x y x", "x"})
+Cmd.Checkpoint()
+Cmd.Find("x", "z")
+Cmd.Checkpoint()
+Cmd.ReplaceAll()
+AssertTableEquals({"z", "y", "z"}, currentDocument[1])
+AssertTableEquals({"z"}, currentDocument[2])
+Cmd.Undo()
+AssertTableEquals({"x", "y", "x"}, currentDocument[1])
+AssertTableEquals({"x"}, currentDocument[2])
+
+-- Incremental find highlights every match, narrowing down the paragraphs
+-- searched as the text gets longer.
+
+local function assert_highlights(pn, want)
+	local got = GetIncrementalFindHighlights(pn)
+	AssertEquals(want and #want or nil, got and #got or nil)
+	for i, r in want or {} do
+		AssertTableEquals(r, got[i])
+	end
+end
+
+SetDocumentParagraphs({"alpha beta", "alphabet", "gamma al", "pha x"})
+AssertEquals(3, SetIncrementalFind("al"))
+assert_highlights(1, {{1, 1, 1, 3}})
+assert_highlights(2, {{1, 1, 1, 3}})
+AssertEquals(2, SetIncrementalFind("alph"))
+assert_highlights(3, nil)
+AssertEquals(1, SetIncrementalFind("alpha bet"))
+assert_highlights(1, {{1, 1, 2, 4}})
+assert_highlights(2, nil)
+AssertEquals(1, SetIncrementalFind("al pha"))
+assert_highlights(3, {{2, 1, 2, 0}})
+assert_highlights(4, {{1, 1, 1, 4}})
+AssertEquals(0, SetIncrementalFind("al phax"))
+AssertEquals(nil, SetIncrementalFind(""))
+assert_highlights(1, nil)
@@ -0,0 +1,33 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+-- Runs against the headless display, so that the list of results can be
+-- answered with queued keypresses.
+
+wg.initscreen()
+ResizeScreen()
+
+Cmd.InsertStringIntoParagraph("Nothing to see here")
+
+AddTestDocument("one", {"A fish", "no", "red Fish"})
+AddTestDocument("two", {"blue fish"})
+documentSet:setCurrent("main")
+
+-- Matches are listed in document order; pick the third, which is the first
+-- one in "two".
+
+headless.queuekey("KEY_DOWN")
+headless.queuekey("KEY_DOWN")
+headless.queuekey("KEY_RETURN")
+AssertEquals(true, Cmd.FindInAllDocuments("fish"))
+AssertEquals("two", currentDocument.name)
+AssertTableEquals({1, 2, 1}, {currentDocument.mp, currentDocument.mw, currentDocument.mo})
+AssertTableEquals({1, 2, 5}, {currentDocument.cp, currentDocument.cw, currentDocument.co})
+
+headless.queuekey("KEY_DOWN")
+headless.queuekey("KEY_RETURN")
+AssertEquals(true, Cmd.FindInAllDocuments("fish"))
+AssertEquals("one", currentDocument.name)
+AssertTableEquals({3, 2, 1}, {currentDocument.mp, currentDocument.mw, currentDocument.mo})
+
+AssertEquals(false, Cmd.FindInAllDocuments("nonexistent"))
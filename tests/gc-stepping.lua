@@ -0,0 +1,35 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+-- Explicit collection steps run until the cycle is done or they run out of
+-- time, and are counted either way.
+
+wg.setgcmode("typing")
+local before = wg.gcstats()
+
+-- Make some garbage, so there's work to do.
+for i = 1, 10000 do
+	local _ = {tostring(i)}
+end
+
+local finished = false
+local calls = 0
+while not finished do
+	finished = wg.gcstep(0.001)
+	AssertEquals("boolean", type(finished))
+	calls = calls + 1
+	assert(calls < 100000, "collection never finished")
+end
+
+local after = wg.gcstats()
+AssertEquals(before.steps + calls, after.steps)
+AssertEquals(before.cycles + 1, after.cycles)
+assert(after.total >= before.total)
+assert(after.max >= after.last)
+assert(after.last >= 0)
+
+-- A zero budget still makes progress.
+wg.gcstep(0)
+AssertEquals(after.steps + 1, wg.gcstats().steps)
+
+wg.setgcmode("interactive")
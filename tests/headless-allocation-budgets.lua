@@ -0,0 +1,93 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+-- What the things done on every keystroke are allowed to cost. The document
+-- is big enough that anything which copies it (even just an array of its
+-- paragraphs) goes well over budget.
+
+local words = {}
+for i = 1, 20 do
+	words[i] = "word"..i
+end
+for i = 1, 20000 do
+	currentDocument[i] = CreateParagraph("P", words)
+end
+currentDocument.cp = 10000
+currentDocument.cw = 10
+currentDocument.co = 3
+documentSet:touch()
+Cmd.Checkpoint()
+
+wg.initscreen()
+ResizeScreen()
+RedrawScreen()
+
+-- Typing a character into the middle of a paragraph, and the change
+-- tracking finding it.
+
+AssertAllocationsBelow(8192,
+	function()
+		Cmd.InsertStringIntoParagraph("x")
+		currentDocument:sync()
+	end)
+
+-- Checkpointing after each edit, whether or not it's part of a group, and
+-- when it's a new paragraph.
+
+AssertAllocationsBelow(8192,
+	function()
+		Cmd.InsertStringIntoParagraph("x")
+		Cmd.Checkpoint("typing")
+	end)
+
+AssertAllocationsBelow(8192,
+	function()
+		Cmd.InsertStringIntoParagraph("x")
+		Cmd.Checkpoint()
+	end)
+
+AssertAllocationsBelow(8192,
+	function()
+		Cmd.SplitCurrentParagraph()
+		Cmd.Checkpoint()
+	end)
+
+AssertAllocationsBelow(64, Cmd.Checkpoint)
+
+-- Redrawing a screen where nothing has changed.
+
+AssertAllocationsBelow(32768, RedrawScreen)
+AssertTimeBelow(0.02, RedrawScreen)
+
+-- Asking the spellchecker about a word as it's drawn, both as a filter and
+-- with the older payload table.
+
+SetSystemDictionaryForTesting({"word1"})
+documentSet.addons.spellchecker.enabled = true
+documentSet.addons.spellchecker.usesystemdictionary = true
+documentSet.addons.spellchecker.useuserdictionary = false
+
+AssertAllocationsBelow(16,
+	function()
+		FilterEvent("DrawWord", 0, "word2", false)
+	end, 1000)
+
+local payload = { cstyle = 0, word = "word2", firstword = false }
+AssertAllocationsBelow(256,
+	function()
+		payload.cstyle = 0
+		FireEvent("DrawWord", payload)
+	end, 1000)
+AssertTimeBelow(0.0005,
+	function()
+		FilterEvent("DrawWord", 0, "word2", false)
+	end, 1000)
+
+-- And the whole lot together, as a keystroke does it.
+
+AssertAllocationsBelow(65536,
+	function()
+		Cmd.Checkpoint("typing")
+		Cmd.InsertStringIntoParagraph("x")
+		RedrawScreen()
+	end)
@@ -0,0 +1,74 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+-- Forms only draw what they have to.
+
+wg.initscreen()
+ResizeScreen()
+while wg.getchar(0) ~= "KEY_TIMEOUT" do
+end
+
+local data = {}
+for i = 1, 10000 do
+	data[i] = { data = tostring(i), label = "item "..i }
+end
+
+local browser = Form.Browser {
+	focusable = true,
+	x1 = 1, y1 = 1,
+	x2 = -1, y2 = -1,
+	data = data,
+	cursor = 1
+}
+
+local backdrops = 0
+local dialogue = {
+	title = "Test",
+	width = "large",
+	height = "large",
+	actions = {
+		["KEY_RETURN"] = "confirm",
+		["KEY_^R"] = "repaint",
+		["KEY_^L"] = "redraw",
+	},
+	widgets = { browser }
+}
+
+headless.queuekey("KEY_DOWN")
+headless.queuekey("KEY_^R")
+headless.queuekey("KEY_^L")
+headless.queuekey("KEY_PGDN")
+headless.queuekey("KEY_RETURN")
+AssertEquals(true, Form.Run(dialogue,
+	function()
+		backdrops = backdrops + 1
+		RedrawScreen()
+	end))
+
+-- Once to start with, and once for the explicit redraw.
+
+AssertEquals(2, backdrops)
+AssertEquals(2 + math.floor(browser.realheight/2), browser.cursor)
+
+-- Moving the cursor within the visible rows only draws two of them.
+
+headless.resetstats()
+browser:draw()
+local full = headless.getstats().writes
+headless.resetstats()
+browser["KEY_DOWN"](browser)
+local moved = headless.getstats().writes
+AssertEquals(true, (moved > 0) and (moved <= (full * 2 / (browser.realheight - 1))))
+
+-- The rows look the same as a full draw would have made them.
+
+local before = {}
+for y = browser.realy1, browser.realy2 do
+	before[#before+1] = headless.getrow(y)
+end
+browser:draw()
+local after = {}
+for y = browser.realy1, browser.realy2 do
+	after[#after+1] = headless.getrow(y)
+end
+AssertTableEquals(after, before)
@@ -0,0 +1,69 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+wg.initscreen()
+ResizeScreen()
+
+local doc = currentDocument
+doc[1] = CreateParagraph("H1", {"First"})
+for i = 2, 1001 do
+	doc[i] = CreateParagraph("P", {"body"..i})
+end
+doc[1002] = CreateParagraph("H2", {"Second"})
+doc[1003] = CreateParagraph("P", {"tail"})
+doc.cp = 1
+doc.cw = 1
+doc.co = 1
+
+-- Folded sections are drawn as their headings, without the rest of them
+-- being wrapped.
+
+Cmd.ToggleOutlineView()
+RedrawScreen()
+AssertEquals(true, ScreenContains("First"))
+AssertEquals(true, ScreenContains("Second"))
+AssertEquals(true, ScreenContains("[+1000]"))
+AssertEquals(false, ScreenContains("body2"))
+AssertEquals(false, ScreenContains("tail"))
+AssertEquals(nil, doc[2]._wrapdata)
+AssertEquals(nil, doc[500]._wrapdata)
+
+-- Moving goes from heading to heading.
+
+Cmd.GotoNextLine()
+AssertEquals(1002, doc.cp)
+Cmd.GotoNextLine()
+AssertEquals(1002, doc.cp)
+Cmd.GotoPreviousLine()
+AssertEquals(1, doc.cp)
+
+-- Sections can be unfolded, and folded again.
+
+Cmd.ToggleOutlineSection()
+RedrawScreen()
+AssertEquals(true, ScreenContains("body2"))
+AssertEquals(false, ScreenContains("[+1000]"))
+Cmd.GotoNextLine()
+Cmd.GotoNextLine()
+AssertEquals(3, doc.cp)
+Cmd.ToggleOutlineSection()
+AssertEquals(1, doc.cp)
+RedrawScreen()
+AssertEquals(false, ScreenContains("body2"))
+
+-- The section the cursor is in is always shown.
+
+doc.cp = 500
+RedrawScreen()
+AssertEquals(true, ScreenContains("body500"))
+AssertEquals(false, ScreenContains("tail"))
+Cmd.GotoPreviousParagraph()
+AssertEquals(499, doc.cp)
+
+-- Without the outline view, everything's there.
+
+doc.cp = 1
+Cmd.ToggleOutlineView()
+RedrawScreen()
+AssertEquals(true, ScreenContains("body2"))
+AssertEquals(false, ScreenContains("[+1000]"))
@@ -0,0 +1,50 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+-- Records some keys and plays them back through the event loop's handler.
+
+wg.initscreen()
+ResizeScreen()
+while wg.getchar(0) ~= "KEY_TIMEOUT" do
+end
+
+local keyfile = wg.mkdtemp().."/keys.txt"
+AssertEquals(true, wg.recordkeys(keyfile))
+
+headless.queuekeys("ab c")
+headless.queuekey("KEY_RETURN")
+headless.queuemouse(3, 4, true)
+local events = {}
+while true do
+	local c = wg.getchar(0)
+	if c == "KEY_TIMEOUT" then
+		break
+	end
+	events[#events+1] = c
+end
+AssertEquals(true, wg.recordkeys())
+AssertEquals(6, #events)
+AssertTableEquals({x=3, y=4, b=true, clicked=true}, events[6])
+
+local data = wg.readfile(keyfile)
+local keys = {}
+for line in data:gmatch("[^\n]+") do
+	local t, key = line:match("^([%d%.]+)\t(.+)$")
+	AssertNotNull(t)
+	keys[#keys+1] = key
+end
+AssertTableEquals({"a", "b", " ", "c", "KEY_RETURN", "MOUSE 3 4 1"}, keys)
+
+-- Stopped, so nothing else is written.
+headless.queuekeys("d")
+AssertEquals("d", wg.getchar(0))
+AssertEquals(data, wg.readfile(keyfile))
+
+local handle = CreateEventHandler()
+for i = 1, 5 do
+	handle(events[i])
+end
+AssertTableEquals({"ab", "c"}, currentDocument[1])
+AssertEquals(2, #currentDocument)
+
+wg.deinitscreen()
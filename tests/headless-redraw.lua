@@ -0,0 +1,115 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+-- Runs against the headless display only, which counts what the redraw code
+-- does to the screen.
+
+wg.initscreen()
+ResizeScreen()
+
+Cmd.InsertStringIntoParagraph("Hello, world!")
+headless.resetstats()
+RedrawScreen()
+
+AssertEquals(true, ScreenContains("Hello, world!"))
+
+local first = headless.getstats()
+AssertEquals(true, first.writes > 0)
+
+-- Nothing has changed, so the second redraw should only need to touch the
+-- status bar.
+
+headless.resetstats()
+RedrawScreen()
+local second = headless.getstats()
+AssertEquals(0, second.scrolls)
+AssertEquals(true, second.writes < first.writes)
+AssertEquals(true, second.clears < first.clears)
+
+-- Statusbar fields come out in order of priority, both those added with
+-- add() and those appended by older listeners.
+
+local s1 = AddEventListener("BuildStatusBar",
+	function(event, token, terms)
+		terms[#terms+1] = { priority=1, value="legacy" }
+	end)
+local s2 = AddEventListener("BuildStatusBar",
+	function(event, token, terms)
+		terms:add(0, "first")
+		terms:add(1000, "last")
+	end)
+RedrawScreen()
+local status = headless.getrow(ScreenHeight - 1)
+local a = status:find("first", 1, true)
+local b = status:find("legacy", 1, true)
+local c = status:find("last", 1, true)
+AssertEquals(true, (a ~= nil) and (b ~= nil) and (c ~= nil))
+AssertEquals(true, (a < b) and (b < c))
+RemoveEventListener(s1)
+RemoveEventListener(s2)
+
+-- Cached fields are only rebuilt when one of their events fires.
+
+local builds = 0
+local field = AddStatusBarField(500, {"Moved"},
+	function()
+		builds = builds + 1
+		return "built "..builds
+	end)
+RedrawScreen()
+RedrawScreen()
+AssertEquals(1, builds)
+AssertEquals(true,
+	headless.getrow(ScreenHeight - 1):find("built 1", 1, true) ~= nil)
+
+FireEvent("Moved")
+RedrawScreen()
+AssertEquals(2, builds)
+InvalidateStatusBarField(field)
+RedrawScreen()
+RedrawScreen()
+AssertEquals(3, builds)
+AssertEquals(true,
+	headless.getrow(ScreenHeight - 1):find("built 3", 1, true) ~= nil)
+
+-- Colours are only sent to the display when they change, and paragraph styles
+-- use the theme's colours.
+
+headless.resetstats()
+SetColour(Palette.P_FG, Palette.P_BG)
+SetColour(Palette.P_FG, Palette.P_BG)
+SetParagraphColour("P")
+AssertEquals(1, headless.getstats().colours)
+SetParagraphColour("H1")
+SetColour(nil, nil)
+SetParagraphColour("NOSUCHSTYLE")
+AssertEquals(3, headless.getstats().colours)
+
+-- Changing what counts as misspelt redraws every word, even though nothing
+-- in the document has changed.
+
+local function attrof(word)
+	for y = 0, ScreenHeight - 1 do
+		local x = headless.getrow(y):find(word, 1, true)
+		if x then
+			return headless.getattr(x - 1, y)
+		end
+	end
+end
+
+SetSystemDictionaryForTesting({"hello", "there"})
+documentSet.addons.spellchecker.enabled = true
+documentSet.addons.spellchecker.usesystemdictionary = true
+documentSet.addons.spellchecker.useuserdictionary = true
+SetDocumentParagraphs({"hello wrold there"})
+currentDocument.cw = 2
+RedrawScreen()
+AssertEquals(wg.DIM, bit32.band(attrof("wrold"), wg.DIM))
+AssertEquals(0, bit32.band(attrof("hello"), wg.DIM))
+
+Cmd.AddToUserDictionary()
+AssertEquals(false, IsWordMisspelt("wrold"))
+RedrawScreen()
+AssertEquals(0, bit32.band(attrof("wrold"), wg.DIM))
+
+wg.deinitscreen()
@@ -0,0 +1,26 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+-- A burst of resizes is passed on as one, once it settles; anything typed
+-- in the middle of it comes out afterwards, in order.
+
+wg.initscreen()
+while wg.getchar(0) ~= "KEY_TIMEOUT" do
+end
+
+headless.queuekey("KEY_RESIZE")
+headless.queuekey("KEY_RESIZE")
+headless.queuekey("KEY_RESIZE")
+AssertEquals("KEY_RESIZE", wg.getchar(0))
+AssertEquals("KEY_TIMEOUT", wg.getchar(0))
+
+headless.queuekey("KEY_RESIZE")
+headless.queuekeys("a")
+headless.queuekey("KEY_RESIZE")
+headless.queuekey("KEY_RESIZE")
+headless.queuekeys("b")
+AssertEquals("KEY_RESIZE", wg.getchar(0))
+AssertEquals("a", wg.getchar(0))
+AssertEquals("KEY_RESIZE", wg.getchar(0))
+AssertEquals("b", wg.getchar(0))
+AssertEquals("KEY_TIMEOUT", wg.getchar(0))
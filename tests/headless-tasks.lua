@@ -0,0 +1,60 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+-- Tasks, which only look at the keyboard when the event loop lets them.
+
+local function work(n)
+	local deadline = wg.time() + n
+	while wg.time() < deadline do
+		TaskCheckpoint()
+	end
+	return "done", n
+end
+
+AssertTableEquals({true, "done", 0.01}, {RunTask("Working...", work, 0.01)})
+
+wg.initscreen()
+ResizeScreen()
+while wg.getchar(0) ~= "KEY_TIMEOUT" do
+end
+SetTaskPolling(true)
+
+-- Keys typed while a task runs are kept for later.
+
+headless.queuekeys("ab")
+AssertTableEquals({true, "done", TASK_SLICE * 3},
+	{RunTask("Working...", work, TASK_SLICE * 3)})
+AssertEquals("a", TakeBufferedInput())
+AssertEquals("b", TakeBufferedInput())
+AssertNull(TakeBufferedInput())
+
+-- ESCAPE cancels, even if the task can't yield.
+
+headless.queuekeys("c")
+headless.queuekey("KEY_ESCAPE")
+AssertEquals(false, RunTask("Working...", work, 10))
+AssertEquals("c", TakeBufferedInput())
+
+headless.queuekey("KEY_ESCAPE")
+local finished = false
+AssertEquals(false, RunTask("Working...",
+	function()
+		table.sort({3, 2, 1},
+			function(a, b)
+				work(10)
+				return a < b
+			end)
+		finished = true
+	end))
+AssertEquals(false, finished)
+
+-- Tasks inside tasks are just part of the outer one.
+
+AssertTableEquals({true, true, "done", 0},
+	{RunTask("Outer...",
+		function()
+			return RunTask("Inner...", work, 0)
+		end)})
+
+SetTaskPolling(false)
+wg.deinitscreen()
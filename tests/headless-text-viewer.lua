@@ -0,0 +1,65 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+-- Text views index a file's lines without reading them in.
+
+local dir = wg.mkdtemp()
+local filename = dir.."/big.txt"
+local lines = {}
+for i = 1, 1000 do
+	lines[i] = "Line "..i.." of  the\tfile"
+end
+wg.writefile(filename, table.concat(lines, "\n").."\nlast")
+
+local view = wg.viewtext(filename)
+AssertEquals(1001, view:lines())
+AssertTableEquals({ "Line", "1", "of", "thefile" }, view:words(1))
+AssertTableEquals({ "Line", "700", "of", "thefile" }, view:words(700))
+AssertTableEquals({ "last" }, view:words(1001))
+AssertEquals(#lines[1] + 2, view:offset(2))
+
+-- Matches are given as words in the line's paragraph, and can be searched
+-- for a range of the file at a time.
+
+local len = view:len()
+AssertTableEquals({ 500, 1, 1, 2, 4, view:offset(500) },
+	{ view:find("LINE 500 ", false, 1, len) })
+AssertTableEquals({ 1, 4, 4, 4, 8, 16 },
+	{ view:find("file", false, 1, len) })
+AssertEquals(nil, view:find("line 500 ", false, 1, view:offset(400)))
+AssertEquals(999, (view:find("^line 9\\d\\d ", true, view:offset(999), len)))
+AssertEquals(nil, view:find("last", false, 1, len - 4))
+AssertEquals(1001, (view:find("last", false, 1, len)))
+
+-- Empty files are one blank line.
+
+wg.writefile(dir.."/empty.txt", "")
+local empty = wg.viewtext(dir.."/empty.txt")
+AssertEquals(1, empty:lines())
+AssertTableEquals({ "" }, empty:words(1))
+AssertEquals(nil, (wg.viewtext(dir.."/nonexistent")))
+
+-- The viewer draws only what's on the screen; the File menu command.
+
+wg.initscreen()
+ResizeScreen()
+while wg.getchar(0) ~= "KEY_TIMEOUT" do
+end
+
+headless.queuekey("KEY_DOWN")
+headless.queuekey("KEY_^F")
+for c in ("line 800 "):gmatch(".") do
+	headless.queuekey(c)
+end
+headless.queuekey("KEY_RETURN")
+AssertEquals(true, Cmd.ViewTextFile(filename))
+AssertEquals(true, ScreenContains("800 of thefile"))
+AssertEquals(true, ScreenContains("of 1001"))
+AssertEquals(false, ScreenContains("Line 1 of thefile"))
+CancelQuit()
+
+-- Escape closes it again.
+
+headless.queuekey("KEY_ESCAPE")
+AssertEquals(true, Cmd.ViewTextFile(filename))
+AssertEquals(false, Quitting)
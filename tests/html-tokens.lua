@@ -0,0 +1,61 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+local function tokenise(s)
+	local t = {}
+	for kind, value in wg.htmltokens(s) do
+		t[#t+1] = kind..":"..value
+	end
+	return t
+end
+
+-- Tags are lowercased and their attributes discarded.
+
+AssertTableEquals(
+	{
+		"tag:<p>", "text:one", "space: ", "tag:<br/>", "tag:</p>",
+		"tag:<h1>", "tag:</h1>"
+	},
+	tokenise([==[<P class="x>y">one <BR /></ p ><h1 id='a'></H1>]==]))
+
+-- Whitespace: tabs and form feeds are spaces, CRLF is one newline, and
+-- other control characters vanish.
+
+AssertTableEquals(
+	{ "text:a", "space: ", "space: ", "text:b", "space:\n", "text:c", "text:d" },
+	tokenise("a\t\fb\r\nc\1d"))
+
+-- Entities are passed through; things which only look like markup are text.
+
+AssertTableEquals(
+	{
+		"text:AT", "entity:&amp;", "text:T", "space: ", "text:<", "space: ",
+		"text:&", "text:b", "space: ", "text:<", "text:3"
+	},
+	tokenise("AT&amp;T < &b <3"))
+
+-- Comments, doctypes and processing instructions are skipped.
+
+AssertTableEquals(
+	{ "tag:<html>", "text:x" },
+	tokenise("<!DOCTYPE html><?xml version='1.0'?><!-- <p> --><html>x"))
+
+-- Invalid UTF-8 is dropped.
+
+AssertTableEquals(
+	{ "text:caf\xc3\xa9", "space: ", "text:ab" },
+	tokenise("caf\xc3\xa9 a\xc3b\x80"))
+
+-- An unterminated tag swallows the rest of the document.
+
+AssertTableEquals({ "text:a" }, tokenise("a<p class='b"))
+
+-- Entities are decoded in a single pass; anything which isn't a valid one
+-- is left alone.
+
+local decode = wg.decodeentities
+AssertEquals("AT&T <3 é'", decode("AT&amp;T &lt;3 &eacute;&apos;"))
+AssertEquals("A\xe2\x82\xac\xf0\x9f\x98\x80", decode("&#65;&#x20ac;&#X1F600;"))
+AssertEquals("&nosuch; &#; &#xd800; &#1114112; &amp", decode("&nosuch; &#; &#xd800; &#1114112; &amp"))
+AssertEquals("&&", decode("&&amp;"))
+AssertEquals("plain", decode("plain"))
@@ -15,3 +15,48 @@ AssertTableEquals({"one", "two", "three"}, p:sub(1))
 AssertTableEquals({"two", "three"}, p:sub(2, 2))
 AssertTableEquals({"two", "three"}, p:sub(2, 3))
 AssertTableEquals({"two", "three"}, p:sub(2))
+
+-- Slices are views rather than copies, and CreateParagraph() takes them
+-- alongside arrays, strings and whole paragraphs, packed or not.
+for _, packed in {false, true} do
+	SetParagraphPacking(packed)
+	local p = CreateParagraph("P", {"one", "two", "three"})
+	local s = p:slice(2)
+	AssertEquals(2, #s)
+	AssertEquals("two", s[1])
+	AssertEquals("three", s[2])
+	AssertNull(s[3])
+	AssertNull(s[0])
+	AssertTableEquals({"two", "three"}, s)
+	AssertEquals(0, #p:slice(4))
+	AssertEquals(0, #p:slice(2, 0))
+	AssertTableEquals({"one"}, p:slice(1, 1))
+
+	local words = {}
+	for i, w in p:slice(2, 1) do
+		words[i] = w
+	end
+	AssertTableEquals({"two"}, words)
+
+	local q = CreateParagraph("H1", p:slice(3), "four", {"five"}, p,
+		p:slice(1, 1), p:slice(4))
+	AssertEquals("H1", q.style)
+	AssertEquals(packed, q._words ~= nil)
+	AssertTableEquals({"three", "four", "five", "one", "two", "three", "one"}, q)
+	AssertTableEquals({"one"}, CreateParagraph("P", q:slice(4, 1)))
+	AssertEquals(0, #CreateParagraph("P"))
+	AssertEquals(0, #CreateParagraph("P", p:slice(2, 0), {}))
+end
+SetParagraphPacking(false)
+
+-- CreateHashedParagraph() works out the same hash during the copy.
+for _, packed in {false, true} do
+	SetParagraphPacking(packed)
+	local p = CreateParagraph("P", {"one", "two", "three"})
+	local q = CreateHashedParagraph("H1", p:slice(2), "four", {"five"})
+	AssertEquals(getmetatable(p), getmetatable(q))
+	AssertTableEquals({"two", "three", "four", "five"}, q)
+	AssertEquals(wg.paragraphhash(q), q:hash())
+	AssertEquals(CreateParagraph("H1", q):hash(), q:hash())
+end
+SetParagraphPacking(false)
@@ -93,7 +93,7 @@ local expected = [[<html xmlns="http://www.w3.org/1999/xhtml"><head>
 <h1>Header 1</h1>
 <h2>Header 2</h2>
 <p>This is normal paragraph text.</p>
-<p>This is normal paragraph text with <b>bold</b> and <i>italic</i>. And <b>bold</b> and <i>italic</i> and <u>underline</u>. And <i><b><u>all three!</u></b></i></p>
+<p>This is normal paragraph text with <b>bold </b>and <i>italic</i>. And <b>bold </b>and <i>italic </i>and <u>underline</u>. And <i><b><u>all three!</u></b></i></p>
 <p>Some of this is <u>code</u>.</p>
 <ul>
 <li>bullet point one</li>
@@ -143,3 +143,10 @@ AssertEquals(expected, output)
 
 
 
+
+-- Text is broken into words, and verbatim text keeps its spacing.
+
+document = Cmd.ImportMarkdownString("one *two three*\n\n    a  b\n")
+AssertTableEquals({"one", "\17two", "\17three"}, {unpack(document[2])})
+AssertEquals("PRE", document[3].style)
+AssertTableEquals({"a", "", "b"}, {unpack(document[3])})
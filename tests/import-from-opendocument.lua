@@ -14,7 +14,7 @@ local expected = [[
 \author{(no author)}
 \maketitle
 \section{Heading 1}
-This is \textbf{bold }\textit{\textbf{bolditalic }}\textit{\textbf{\underline{bolditalicunderline }}}\textit{\underline{italicunderline }}\underline{underline} }plain
+This is \textbf{bold \textit{bolditalic \underline{bolditalicunderline }}}\textit{\underline{italicunderline }}\underline{underline} plain
 
 normal text
 
@@ -40,3 +40,43 @@ local output = Cmd.ExportToLatexString()
 AssertEquals(expected, output)
 
 
+
+-- Styles inherit from their parents, however deep; parents which don't
+-- exist, or which loop back round, are ignored.
+
+local content = [[<?xml version="1.0" encoding="UTF-8"?>
+<office:document-content
+	xmlns:office="urn:oasis:names:tc:opendocument:xmlns:office:1.0"
+	xmlns:style="urn:oasis:names:tc:opendocument:xmlns:style:1.0"
+	xmlns:fo="urn:oasis:names:tc:opendocument:xmlns:xsl-fo-compatible:1.0"
+	xmlns:text="urn:oasis:names:tc:opendocument:xmlns:text:1.0">
+<office:automatic-styles>
+	<style:style style:name="I"><style:text-properties fo:font-style="italic"/></style:style>
+	<style:style style:name="IB" style:parent-name="I"><style:text-properties fo:font-weight="bold"/></style:style>
+	<style:style style:name="IBU" style:parent-name="IB"><style:text-properties style:text-underline-style="solid"/></style:style>
+	<style:style style:name="Orphan" style:parent-name="Missing"><style:text-properties fo:font-weight="bold"/></style:style>
+	<style:style style:name="Loop1" style:parent-name="Loop2"><style:text-properties fo:font-style="italic"/></style:style>
+	<style:style style:name="Loop2" style:parent-name="Loop1"/>
+	<style:style style:name="Indent"><style:paragraph-properties fo:margin-left="1cm"/></style:style>
+	<style:style style:name="IndentChild" style:parent-name="Indent"/>
+</office:automatic-styles>
+<office:body><office:text>
+<text:p><text:span text:style-name="IBU">one</text:span><text:s/><text:span text:style-name="Orphan">two</text:span><text:s/><text:span text:style-name="Loop2">three</text:span><text:s/><text:span text:style-name="Unknown">four</text:span></text:p>
+<text:p text:style-name="IndentChild">quoted</text:p>
+</office:text></office:body>
+</office:document-content>
+]]
+
+local filename = wg.mkdtemp().."/styles.odt"
+AssertEquals(true, wg.writezip(filename, {
+	["content.xml"] = content,
+	["styles.xml"] = [[<?xml version="1.0"?><office:document-styles xmlns:office="urn:oasis:names:tc:opendocument:xmlns:office:1.0"/>]],
+}))
+AssertEquals(true, Cmd.ImportODTFile(filename))
+
+local imported = documentSet:findDocument("styles.odt")
+AssertEquals(2, #imported)
+AssertEquals("P", imported[1].style)
+AssertTableEquals({"\27one", "\24two", "\17three", "four"},
+	{table.unpack(imported[1])})
+AssertEquals("Q", imported[2].style)
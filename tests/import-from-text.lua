@@ -45,3 +45,24 @@ documentSet:setCurrent("imported")
 AssertTableEquals({"no", "trailing", "newline"}, currentDocument[1])
 
 
+
+-- Invalid UTF-8 and control characters are dropped, and words are split at
+-- spaces only.
+
+document = Cmd.ImportTextString("caf\xc3\xa9 a\x80b\tc \xe2\x82\r\n  \n")
+AssertTableEquals({"caf\xc3\xa9", "abc"}, {unpack(document[1])})
+AssertTableEquals({""}, {unpack(document[2])})
+AssertEquals(2, #document)
+
+-- Big documents are split in chunks; the lines must still come out in order.
+
+local lines = {}
+for i = 1, 100000 do
+	lines[i] = "line "..i.." of some text"
+end
+document = Cmd.ImportTextString(table.concat(lines, "\n"))
+AssertEquals(100000, #document)
+for _, i in {1, 2, 54321, 99999, 100000} do
+	AssertTableEquals({"line", tostring(i), "of", "some", "text"},
+		{unpack(document[i])})
+end
@@ -0,0 +1,37 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+-- A document whose content.xml is much bigger than the chunks it's read in,
+-- so that tags and text get split across chunk boundaries.
+
+local doc = currentDocument
+for i = 1, 3000 do
+	doc[i] = CreateParagraph((i % 7 == 0) and "H1" or "P",
+		{"paragraph", tostring(i), "has", "some", "words", "&", "<more>"})
+end
+
+local filename = wg.mkdtemp().."/large.odt"
+AssertEquals(true, Cmd.ExportODTFile(filename))
+AssertEquals(true, Cmd.ImportODTFile(filename))
+
+local imported = documentSet:findDocument("large.odt")
+AssertEquals(3000, #imported)
+for i = 1, 3000 do
+	AssertEquals(doc[i].style, imported[i].style)
+	AssertTableEquals({table.unpack(doc[i])}, {table.unpack(imported[i])})
+end
+
+-- Streaming a member of the zip file directly.
+
+local zr = assert(wg.zipreader(filename, "content.xml"))
+local size = 0
+while true do
+	local s = zr:read(1000)
+	if not s then
+		break
+	end
+	size = size + #s
+end
+zr:close()
+AssertEquals(true, size > 65536)
+AssertNull(wg.zipreader(filename, "nonexistent.xml"))
@@ -0,0 +1,62 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+Cmd.InsertStringIntoParagraph("one")
+Cmd.SplitCurrentParagraph()
+Cmd.InsertStringIntoParagraph("two")
+Cmd.SplitCurrentParagraph()
+Cmd.InsertStringIntoParagraph("three")
+
+local filename = wg.mkdtemp().."/tempfile"
+AssertEquals(Cmd.SaveCurrentDocumentAs(filename), true)
+AssertEquals(FinishBackgroundSave(), true)
+
+-- Nothing has changed, so nothing gets written.
+
+AssertEquals(AppendToJournal(), true)
+AssertEquals(wg.stat(filename..".journal"), nil)
+
+-- Change the middle paragraph, then add one at the end.
+
+Cmd.GotoBeginningOfDocument()
+Cmd.GotoNextParagraph()
+Cmd.InsertStringIntoParagraph("X")
+AssertEquals(AppendToJournal(), true)
+Cmd.GotoEndOfDocument()
+Cmd.SplitCurrentParagraph()
+Cmd.InsertStringIntoParagraph("four")
+AssertEquals(AppendToJournal(), true)
+
+-- A torn record at the end of the journal is ignored.
+
+wg.appendfile(filename..".journal", "#1 1 1\nP fnord\n")
+
+local want = {}
+for i, p in ipairs(currentDocument) do
+	want[i] = table.move(p, 1, #p, 1, {})
+end
+
+-- Pretend to crash, so the journal is left behind.
+
+documentSet:clean()
+AssertEquals(Cmd.LoadDocumentSet(filename), true)
+AssertEquals(documentSet._changed, true)
+AssertEquals(#currentDocument, 4)
+for i, p in ipairs(currentDocument) do
+	AssertTableEquals(want[i], p)
+	AssertEquals("P", p.style)
+end
+
+-- An explicit save folds the journal into the file.
+
+AssertEquals(Cmd.SaveCurrentDocumentAs(filename), true)
+AssertEquals(FinishBackgroundSave(), true)
+AssertEquals(wg.stat(filename..".journal"), nil)
+AssertEquals(Cmd.LoadDocumentSet(filename), true)
+AssertEquals(documentSet._changed, false)
+AssertEquals(#currentDocument, 4)
+
+-- Adding a document can't be journalled.
+
+Cmd.AddBlankDocument("other")
+AssertEquals(AppendToJournal(), false)
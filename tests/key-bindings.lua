@@ -0,0 +1,40 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+local menu = documentSet.menu
+
+-- Keys are looked up once and then remembered.
+
+local save = menu:lookupAccelerator("KEY_^S")
+AssertEquals("function", type(save))
+AssertEquals(save, menu:lookupAccelerator("KEY_^S"))
+AssertEquals(nil, menu:lookupAccelerator("KEY_^F12"))
+AssertEquals(nil, menu:lookupAccelerator("KEY_^F12"))
+
+-- Overrides take effect straight away.
+
+local function override() end
+OverrideKey("^S", override)
+AssertEquals(override, menu:lookupAccelerator("KEY_^S"))
+OverrideKey("^F12", override)
+AssertEquals(override, menu:lookupAccelerator("KEY_^F12"))
+
+-- So do new menus.
+
+local called = false
+CreateMenu("Test", {
+	{ id = "Ttest", label = "Test", ak = "^F11",
+		fn = function() called = true return true end }
+})
+local tree = CreateMenuTree()
+tree:lookupAccelerator("KEY_^F11")()
+AssertEquals(true, called)
+
+-- And a different menu tree has its own bindings.
+
+tree.accelerators["^F10"] = "Ttest"
+tree.accelerators["Ttest"] = "^F10"
+AssertEquals(nil, menu:lookupAccelerator("KEY_^F10"))
+called = false
+tree:lookupAccelerator("KEY_^F10")()
+AssertEquals(true, called)
@@ -0,0 +1,41 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+ResetLatencies()
+AssertTableEquals({}, GetLatencySummaries())
+
+for i = 1, 100 do
+	RecordLatency("KEY_DOWN", i / 1000, i / 100)
+end
+RecordLatency("(typing)", 0.001, 0.002)
+
+local summaries = GetLatencySummaries()
+AssertEquals(2, #summaries)
+
+-- Slowest first.
+local s = summaries[1]
+AssertEquals("KEY_DOWN", s.name)
+AssertEquals(100, s.count)
+AssertEquals(0.05, s.dispatch50)
+AssertEquals(0.099, s.dispatch99)
+AssertEquals(0.1, s.dispatchmax)
+AssertEquals(0.5, s.screen50)
+AssertEquals(1, s.screenmax)
+AssertEquals("(typing)", summaries[2].name)
+
+-- Only the most recent samples count towards the percentiles, but the
+-- maximum and count are for everything.
+for i = 1, 2000 do
+	RecordLatency("KEY_DOWN", 0, 0)
+end
+s = GetLatencySummaries()[2]
+AssertEquals("KEY_DOWN", s.name)
+AssertEquals(2100, s.count)
+AssertEquals(0, s.dispatch99)
+AssertEquals(0.1, s.dispatchmax)
+
+local dir = wg.mkdtemp()
+AssertNull(DumpLatencies(dir.."/latency.txt"))
+local dump = wg.readfile(dir.."/latency.txt")
+AssertEquals(true, dump:find("^command ") ~= nil)
+AssertEquals(true, dump:find("\nKEY_DOWN +2100 ") ~= nil)
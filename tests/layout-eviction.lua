@@ -0,0 +1,64 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+-- Paragraphs' layouts are thrown away, least recently used first, once there
+-- are more of them than the budget allows.
+
+local paras = {}
+for i = 1, 10 do
+	paras[i] = CreateParagraph("P", {"one", "two", "three", "four", "five",
+		"six", "seven", "eight", "nine", tostring(i)})
+end
+
+EvictParagraphLayouts(0)
+AssertEquals(0, GetParagraphLayoutCost())
+SetParagraphLayoutBudget(60)
+
+for i = 1, 5 do
+	paras[i]:wrap(20)
+end
+RunTimers(math.huge)
+for i = 1, 5 do
+	AssertNotNull(paras[i]._wrapdata)
+end
+
+-- Using a layout again makes it recent.
+
+paras[1]:wrap(20)
+for i = 6, 8 do
+	paras[i]:wrap(20)
+end
+RunTimers(math.huge)
+AssertNotNull(paras[1]._wrapdata)
+AssertNull(paras[2]._wrapdata)
+AssertNull(paras[3]._wrapdata)
+AssertNull(paras[4]._wrapdata)
+AssertNull(paras[5]._wrapdata)
+for i = 6, 8 do
+	AssertNotNull(paras[i]._wrapdata)
+end
+AssertEquals(true, GetParagraphLayoutCost() <= 45)
+
+-- Older layouts count too, and go with the paragraph.
+
+paras[1]:wrap(30)
+AssertEquals(1, #paras[1]._wrapcache)
+EvictParagraphLayouts(1)
+AssertNull(paras[1]._wrapdata)
+AssertNull(paras[1]._wrapcache)
+AssertEquals(0, GetParagraphLayoutCost())
+
+-- An evicted layout comes back when it's wanted.
+
+AssertEquals(paras[2]:wrap(20).wrapwidth, 20)
+
+-- With no budget, nothing goes.
+
+SetParagraphLayoutBudget(0)
+for i = 1, 10 do
+	paras[i]:wrap(20)
+end
+RunTimers(math.huge)
+for i = 1, 10 do
+	AssertNotNull(paras[i]._wrapdata)
+end
@@ -0,0 +1,20 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+-- The LaTeX exporter isn't loaded until it's first used, at which point the
+-- stub is replaced by the real function.
+
+local stub = Cmd.ExportToLatexString
+Cmd.InsertStringIntoParagraph("foo_bar")
+AssertEquals(true, stub():find("foo\\_{}bar", 1, true) ~= nil)
+AssertEquals(false, rawequal(stub, Cmd.ExportToLatexString))
+
+-- Calling the stub again goes straight to the real thing.
+AssertEquals(Cmd.ExportToLatexString(), stub())
+
+-- Globals defined by lazy modules work the same way.
+AssertEquals("urn:n a", ParseXML([[<n:a xmlns:n="urn:n"/>]])._name)
+
+-- The reference exporters load on demand too.
+AssertEquals("function", type(LuaExporters.markdown))
+AssertNull(LuaExporters.nonexistent)
@@ -0,0 +1,28 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+-- Documents in an old file which weren't loaded straight away only get
+-- upgraded once they're looked at.
+
+Cmd.InsertStringIntoParagraph("current")
+Cmd.AddBlankDocument("other")
+Cmd.InsertStringIntoParagraph("other")
+Cmd.ChangeDocument("main")
+
+local filename = wg.mkdtemp().."/old.wg"
+AssertEquals(Cmd.SaveCurrentDocumentAs(filename), true)
+AssertEquals(FinishBackgroundSave(), true)
+local data = wg.readfile(filename)
+wg.writefile(filename, (data:gsub("%.fileformat: %d+", ".fileformat: 7")))
+
+AssertEquals(Cmd.LoadDocumentSet(filename), true)
+AssertEquals(documentSet.fileformat, FILEFORMAT)
+
+local other = documentSet.documents[2]
+AssertEquals(IsLazyDocument(currentDocument), false)
+AssertEquals(IsLazyDocument(other), true)
+AssertEquals(rawget(other, "_upgradefrom"), 7)
+
+AssertEquals(other[1][1], "other")
+AssertEquals(IsLazyDocument(other), false)
+AssertNull(rawget(other, "_upgradefrom"))
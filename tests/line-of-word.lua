@@ -0,0 +1,44 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+-- Finds the line of every word of a long paragraph, checked against a walk
+-- over the lines. Paragraphs wrap to the document's width unless told
+-- otherwise.
+currentDocument:wrap(40)
+local words = {}
+for i = 1, 5000 do
+	words[i] = string.rep("x", (i * 7) % 13)
+end
+local p = CreateParagraph("P", words)
+local wd = p:wrap()
+
+local n = 0
+for ln, line in wd.lines do
+	for i = 1, #line do
+		n = n + 1
+		local l, w = p:getLineOfWord(n)
+		AssertEquals(ln, l)
+		AssertEquals(i, w)
+	end
+end
+AssertEquals(5000, n)
+AssertEquals(false, pcall(p.getLineOfWord, p, 5001))
+
+-- A first word too wide for the screen leaves the first line empty.
+p = CreateParagraph("P", {string.rep("x", 50), "y"})
+wd = p:wrap()
+AssertEquals(0, #wd.lines[1])
+AssertEquals(2, (p:getLineOfWord(1)))
+AssertEquals(3, (p:getLineOfWord(2)))
+
+-- Moving down a line at a time visits every line, keeping the column.
+currentDocument:insertParagraphBefore(CreateParagraph("P", words), 1)
+currentDocument.cp = 1
+currentDocument.cw = 1
+currentDocument.co = 3
+local lines = currentDocument[1]:wrap().lines
+for ln = 2, #lines do
+	Cmd.GotoNextLine()
+	AssertEquals(1, currentDocument.cp)
+	AssertEquals(ln, (currentDocument[1]:getLineOfWord(currentDocument.cw)))
+end
@@ -46,3 +46,154 @@ AssertTableEquals({5, 6, 7}, wd.lines[3])
 AssertTableEquals({8, 9}, wd.lines[4])
 
 AssertTableEquals({0, 0, 6, 12, 0, 6, 11, 0, 5}, wd.xs)
+
+-- Check the native wrapper against the original Lua version, for both kinds
+-- of paragraph and with and without full stop spaces.
+
+local function referencewrap(words, width, indent1, indent2, fullstopspaces)
+	local issentence = true
+	local sentences = {}
+	for wn, word in ipairs(words) do
+		if issentence then
+			sentences[wn] = true
+			issentence = false
+		end
+		if word:find("[^%a]$") then
+			issentence = true
+		end
+	end
+	sentences[#words] = true
+
+	local lines = {}
+	local line = {wn = 1}
+	local w = 0
+	local xs = {}
+	width = width - indent1
+	for wn, word in ipairs(words) do
+		local ww = wg.getstringwidth(word) + 1
+		if fullstopspaces and word:find("%.$") then
+			ww = ww + 1
+		end
+
+		xs[wn] = w
+		w = w + ww
+		if (w >= width) then
+			lines[#lines+1] = line
+			if #lines == 1 then
+				width = width + indent1 - indent2
+			end
+			line = {wn = wn}
+			w = ww
+			xs[wn] = 0
+		end
+		line[#line+1] = wn
+	end
+	if (#line > 0) then
+		lines[#lines+1] = line
+	end
+	return lines, xs, sentences
+end
+
+local vocabulary = {"a", "fox.", "jumps,", "日本語", "", "\16bold\16",
+	"supercalifragilistic", "over"}
+local seed = 11
+for n = 1, 100 do
+	local words = {}
+	for i = 1, (n % 40) do
+		seed = (seed * 1103515245 + 12345) % 2147483648
+		words[i] = vocabulary[(seed % #vocabulary) + 1]
+	end
+
+	local width = 5 + (n % 30)
+	local indent1 = n % 7
+	local indent2 = n % 3
+	local fullstopspaces = (n % 2) == 0
+	local rlines, rxs, rsentences =
+		referencewrap(words, width, indent1, indent2, fullstopspaces)
+
+	for _, packed in {false, true} do
+		SetParagraphPacking(packed)
+		local p = CreateParagraph("P", words)
+		local lines, xs, sentences =
+			wg.wrapparagraph(p, width, indent1, indent2, fullstopspaces)
+		AssertTableAndPropertiesEquals(rlines, lines)
+		AssertTableEquals(rxs, xs)
+		AssertTableEquals(rsentences, sentences)
+	end
+end
+SetParagraphPacking(false)
+
+-- Recent layouts are kept, and the indent and full stop settings are part of
+-- the key.
+
+documentStyles["P"].indent = 0
+documentStyles["P"].firstindent = nil
+local para = CreateParagraph("P", {"One.", "two", "three."})
+local wd20 = para:wrap(20)
+local wd30 = para:wrap(30)
+AssertEquals(false, rawequal(wd20, wd30))
+AssertEquals(true, rawequal(wd20, para:wrap(20)))
+AssertEquals(true, rawequal(wd30, para:wrap(30)))
+
+documentStyles["P"].indent = 4
+local wdindented = para:wrap(20)
+AssertEquals(false, rawequal(wd20, wdindented))
+AssertEquals(4, wdindented.indent2)
+documentStyles["P"].indent = 0
+AssertEquals(true, rawequal(wd20, para:wrap(20)))
+
+GlobalSettings.lookandfeel.fullstopspaces = true
+local wdspaces = para:wrap(20)
+AssertTableEquals({0, 6, 10}, wdspaces.xs)
+GlobalSettings.lookandfeel.fullstopspaces = false
+AssertTableEquals({0, 5, 9}, para:wrap(20).xs)
+
+-- Rewrapping a giant paragraph after an edit only reworks the lines around
+-- the change, but must give the same layout as wrapping it from scratch.
+
+for _, packed in {false, true} do
+	SetParagraphPacking(packed)
+	local words = {}
+	for i = 1, 3000 do
+		seed = (seed * 1103515245 + 12345) % 2147483648
+		words[i] = vocabulary[(seed % #vocabulary) + 1]
+	end
+	local p = CreateParagraph("P", words)
+	p:wrap(40)
+
+	for n = 1, 60 do
+		seed = (seed * 1103515245 + 12345) % 2147483648
+		local first = (seed % (#p + 1)) + 1
+		local count = (n % 3 == 0) and 0 or (n % 4)
+		local new = {}
+		for i = 1, (n % 5 == 0) and 0 or (n % 3) do
+			new[i] = vocabulary[((seed // 7 + i) % #vocabulary) + 1]
+		end
+		if n == 1 then
+			first, count, new = 1, 1, {"x"}
+		elseif n == 2 then
+			first, count, new = #p, 1, {"supercalifragilistic"}
+		end
+
+		p = p:replaceWords(first, count, table.unpack(new))
+		local wd = p:wrap(40)
+
+		local lines, xs, sentences = wg.wrapparagraph(p, 40, wd.indent1,
+			wd.indent2, wd.fullstopspaces)
+		AssertEquals(#lines, #wd.lines)
+		for ln = 1, #lines do
+			AssertTableAndPropertiesEquals(lines[ln], wd.lines[ln])
+		end
+		AssertTableEquals(xs, wd.xs)
+		AssertTableAndPropertiesEquals(sentences, wd.sentences)
+	end
+
+	-- Changing a word in the middle leaves the lines after it alone.
+
+	local old = p:wrap(40)
+	p = p:replaceWords(1500, 1, "a")
+	local wd = p:wrap(40)
+	AssertEquals(true, rawequal(old.lines[#old.lines], wd.lines[#wd.lines]))
+	AssertEquals(true, rawequal(old.lines[1], wd.lines[1]))
+end
+SetParagraphPacking(false)
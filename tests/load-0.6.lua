@@ -5,3 +5,6 @@ local r = Cmd.LoadDocumentSet("testdocs/README-v0.6.wg")
 AssertEquals(true, r)
 
 
+
+-- The document index isn't in files this old.
+AssertEquals(currentDocument, documentSet:findDocument(currentDocument.name))
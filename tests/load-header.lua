@@ -0,0 +1,58 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+Cmd.InsertStringIntoParagraph("fnord")
+Cmd.SplitCurrentParagraph()
+Cmd.InsertStringIntoParagraph("blarg")
+Cmd.AddBlankDocument("other")
+Cmd.InsertStringIntoParagraph("other")
+Cmd.ChangeDocument("main")
+
+local dir = wg.mkdtemp()
+
+-- Only the properties are read, into plain tables.
+
+local function check(h)
+	AssertEquals(h.current, 1)
+	AssertEquals(h.documents[1].name, "main")
+	AssertEquals(h.documents[2].name, "other")
+	AssertEquals(h.documents[1][1], nil)
+	AssertEquals(getmetatable(h), nil)
+	AssertEquals(getmetatable(h.documents[1]), nil)
+end
+
+for _, compressed in { false, true } do
+	local filename = dir.."/tempfile"
+	AssertEquals(SaveToFile(filename, documentSet, compressed), true)
+	check(LoadHeaderFromFile(filename))
+end
+
+-- Nothing after the first document's text marker is looked at, so it doesn't
+-- matter what's there.
+
+local filename = dir.."/truncated"
+AssertEquals(SaveToFile(filename, documentSet), true)
+local data = wg.readfile(filename)
+local s = data:find("\n#1\n", 1, true)
+AssertNotNull(s)
+wg.writefile(filename, data:sub(1, s).."#1\nthis isn't a paragraph\n")
+check(LoadHeaderFromFile(filename))
+
+-- The older formats are loaded in full.
+
+local h = LoadHeaderFromFile("testdocs/README-v0.6.wg")
+AssertNotNull(h)
+AssertNotNull(h.documents[1])
+
+local h, e = LoadHeaderFromFile(dir.."/missing")
+AssertEquals(h, nil)
+AssertNotNull(e)
+
+-- The settings go through the header reader.
+
+filename = dir.."/settings"
+GlobalSettings.test = { value = "fnord" }
+SaveGlobalSettings(filename)
+GlobalSettings = {}
+LoadGlobalSettings(filename)
+AssertEquals(GlobalSettings.test.value, "fnord")
@@ -0,0 +1,79 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+-- Lazy documents can be materialised all at once, from text files and
+-- compressed ones.
+
+local dir = wg.mkdtemp()
+
+local function makeset(filename, format)
+	local documents = {}
+	for i = 1, 8 do
+		local paragraphs = {}
+		for j = 1, i do
+			paragraphs[j] = CreateParagraph((j == 1) and "H1" or "P",
+				{"doc", tostring(i), "para", tostring(j)})
+		end
+		documents[i] = {"doc"..i, paragraphs}
+	end
+	SaveTestDocumentSet(filename, format, "doc1", documents)
+end
+
+local function check(ds)
+	local documents = ds:getDocumentList()
+	AssertEquals(false, IsLazyDocument(documents[1]))
+	for i = 2, #documents do
+		AssertEquals(true, IsLazyDocument(documents[i]))
+	end
+
+	MaterialiseDocuments(documents)
+	for i, document in documents do
+		AssertEquals(false, IsLazyDocument(document))
+		AssertNull(rawget(document, "_lazytext"))
+		AssertEquals(i, rawlen(document))
+		for j = 1, i do
+			local p = rawget(document, j)
+			AssertEquals((j == 1) and "H1" or "P", p.style)
+			AssertTableEquals({"doc", tostring(i), "para", tostring(j)},
+				{table.unpack(p)})
+		end
+	end
+end
+
+for _, format in {"text", "compressed"} do
+	local filename = dir.."/"..format..".wg"
+	makeset(filename, format)
+	check(LoadFromFile(filename))
+end
+
+-- Text files which have been through something which added carriage returns
+-- still have their sections found.
+
+local filename = dir.."/crlf.wg"
+makeset(filename, "text")
+wg.writefile(filename, (wg.readfile(filename):gsub("\n", "\r\n")))
+local ds = LoadFromFile(filename)
+AssertNull(ds._damaged)
+check(ds)
+
+-- Documents from an older file format are upgraded as they're materialised.
+
+makeset(filename, "text")
+wg.writefile(filename, (wg.readfile(filename):gsub("%.fileformat: %d+",
+	".fileformat: 7")))
+AssertEquals(true, Cmd.LoadDocumentSet(filename))
+local other = documentSet.documents[2]
+AssertEquals(7, rawget(other, "_upgradefrom"))
+MaterialiseDocuments(documentSet:getDocumentList())
+AssertNull(rawget(other, "_upgradefrom"))
+
+-- A damaged frame is an error rather than an empty document.
+
+filename = dir.."/corrupt.wg"
+makeset(filename, "compressed")
+ds = LoadFromFile(filename)
+other = ds.documents[3]
+rawset(other, "_dumpframe", string.rep("x", #other._dumpframe))
+local ok = pcall(function() MaterialiseDocuments({other}) end)
+AssertEquals(false, ok)
+AssertEquals(true, IsLazyDocument(other))
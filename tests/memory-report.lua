@@ -0,0 +1,70 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+-- The heap walk: each object is counted once, against the first root set
+-- which reaches it, and the walks don't go through metatables.
+
+local words = {}
+for i = 1, 1000 do
+	words[i] = string.rep("x", 100)..i
+end
+local shared = { words = words }
+local first = { shared = shared }
+local second = { shared = shared, own = {1, 2, 3} }
+setmetatable(second, { __index = { big = string.rep("y", 100000) } })
+
+local counts, total = wg.heapreport({{first}, {second}, {}})
+AssertEquals(4, #counts)
+AssertEquals(true, counts[1].bytes > 100000)
+AssertEquals(true, counts[1].objects >= 1003)
+AssertEquals(true, counts[2].bytes < 1000)
+AssertEquals(true, counts[2].objects < 5)
+AssertTableEquals({bytes=0, objects=0}, counts[3])
+AssertEquals(true, counts[4].bytes > 100000)
+AssertEquals(true, total.bytes >= counts[1].bytes + counts[2].bytes + counts[4].bytes)
+
+local together = wg.heapreport({{first, second}})
+AssertEquals(counts[1].objects + counts[2].objects, together[1].objects)
+AssertEquals(counts[1].bytes + counts[2].bytes, together[1].bytes)
+
+-- Fields starting with an underscore can be left for later.
+
+local p = { text = "text", _cache = { string.rep("z", 10000) } }
+local counts = wg.heapreport({{p, skipunderscore=true}, {p._cache}})
+AssertEquals(true, counts[1].bytes < 1000)
+AssertEquals(true, counts[2].bytes > 10000)
+
+-- The report as a whole: the document owns its words, the layouts are
+-- counted separately, and everything adds up.
+
+for i = 1, 2000 do
+	currentDocument[i] = CreateParagraph("P", {"paragraph", tostring(i), "of",
+		string.rep("text", 10)})
+end
+documentSet:touch()
+for i = 1, #currentDocument do
+	currentDocument[i]:wrap(80)
+end
+Cmd.GotoBeginningOfDocument()
+Cmd.InsertStringIntoParagraph("x")
+Cmd.Checkpoint()
+
+local lines, total = GetMemoryReport()
+local byname = {}
+local sum = 0
+for _, l in lines do
+	byname[l.name] = l
+	sum = sum + l.bytes
+end
+-- (Only a few of the interpreter's own strings aren't reachable at all.)
+AssertEquals(true, sum <= total.bytes)
+AssertEquals(true, (total.bytes - sum) < 65536)
+AssertEquals("Everything else", lines[#lines].name)
+
+local document = byname["Document "..currentDocument.name]
+AssertEquals(true, document.objects > 2000)
+AssertEquals(true, byname["Layout"].objects >= 2000)
+AssertEquals(true, byname["Undo and redo"].bytes > 0)
+AssertEquals(true, byname["Undo and redo"].bytes < document.bytes)
+AssertEquals(true, byname["Event listeners"].bytes > 0)
+AssertEquals(true, byname["Spelling dictionaries"] ~= nil)
@@ -0,0 +1,53 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+local function findnext()
+	Cmd.FindNextMisspeltWord()
+	return {currentDocument.mp, currentDocument.mw}
+end
+
+SetSystemDictionaryForTesting({"good", "words", "here"})
+documentSet.addons.spellchecker.enabled = true
+documentSet.addons.spellchecker.usesystemdictionary = true
+documentSet.addons.spellchecker.useuserdictionary = false
+
+SetDocumentParagraphs({"good words here", "bad wrds", "good", "more baad"})
+
+-- Nothing's been counted until the document has been checked.
+
+AssertNull(GetMisspeltWordCount())
+AssertTableEquals({2, 1}, findnext())
+AssertEquals(4, GetMisspeltWordCount())
+AssertTableEquals({2, 2}, findnext())
+AssertTableEquals({4, 1}, findnext())
+AssertTableEquals({4, 2}, findnext())
+AssertTableEquals({2, 1}, findnext())
+
+-- Edits are picked up.
+
+currentDocument[3] = CreateParagraph("P", {"gooood", "here"})
+AssertEquals(5, GetMisspeltWordCount())
+currentDocument:insertParagraphBefore(CreateParagraph("P", {"xyzzy"}), 1)
+AssertEquals(6, GetMisspeltWordCount())
+currentDocument:deleteParagraphAt(3)
+AssertEquals(4, GetMisspeltWordCount())
+
+currentDocument.mp = nil
+currentDocument.cp, currentDocument.cw = 2, 1
+AssertTableEquals({3, 1}, findnext())
+AssertTableEquals({4, 1}, findnext())
+AssertTableEquals({4, 2}, findnext())
+AssertTableEquals({1, 1}, findnext())
+
+-- Changing the dictionary throws the index away.
+
+SetSystemDictionaryForTesting({"good", "words", "here", "xyzzy"})
+AssertNull(GetMisspeltWordCount())
+AssertTableEquals({3, 1}, findnext())
+AssertEquals(3, GetMisspeltWordCount())
+
+-- A document with nothing wrong with it.
+
+SetDocumentParagraphs({"good words", "here"})
+AssertEquals(false, Cmd.FindNextMisspeltWord())
+AssertEquals(0, GetMisspeltWordCount())
@@ -0,0 +1,53 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+-- The native exporters must produce exactly what the Lua reference
+-- exporters do.
+
+Cmd.InsertStringIntoParagraph("Plain *text* with <html> & _markdown_ # - specials")
+Cmd.SplitCurrentParagraph()
+Cmd.SetStyle("b")
+Cmd.InsertStringIntoParagraph("bold")
+Cmd.SetStyle("o")
+Cmd.InsertStringIntoParagraph(" plain ")
+Cmd.SetStyle("u")
+Cmd.InsertStringIntoParagraph("under lined")
+Cmd.SetStyle("o")
+Cmd.InsertStringIntoParagraph(" end")
+
+local function add(style, text)
+	Cmd.SplitCurrentParagraph()
+	Cmd.ChangeParagraphStyle(style)
+	if text then
+		Cmd.InsertStringIntoParagraph(text)
+	end
+end
+
+add("H1", "Heading one")
+add("LB", "bullet one")
+add("LB", "bullet two")
+add("LN", "numbered one")
+add("LN", "numbered two")
+add("P", nil)
+add("PRE", "pre  formatted")
+add("PRE", nil)
+add("PRE", "more <pre>")
+add("RAW", "<div>raw & unescaped</div>")
+add("Q", "quoted")
+add("L", "unbulleted")
+add("P", "the end")
+
+for format, cmd in {
+	text = Cmd.ExportToTextString,
+	markdown = Cmd.ExportToMarkdownString,
+	html = Cmd.ExportToHTMLString,
+} do
+	local reference = ExportToString(currentDocument, LuaExporters[format])
+	AssertEquals(reference, cmd())
+end
+
+-- Exporting to a file streams the same output to disk.
+
+local filename = wg.mkdtemp().."/export.md"
+AssertEquals(true, Cmd.ExportMarkdownFile(filename))
+AssertEquals(Cmd.ExportToMarkdownString(), wg.readfile(filename))
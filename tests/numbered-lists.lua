@@ -47,3 +47,48 @@ FireEvent("Changed")
 AssertEquals(1, currentDocument[1].number)
 AssertEquals(2, currentDocument[3].number)
 
+
+-- Incremental renumbering must agree with numbering from scratch.
+
+local styles = {"P", "LN", "LN", "LB", "L", "H1"}
+local d = CreateDocument()
+for i = 1, 50 do
+	d[i] = CreateParagraph(styles[(i % #styles) + 1], {"a", "b"})
+end
+d:renumber()
+local seed = 1
+local function random(n)
+	seed = (seed * 1103515245 + 12345) % 2147483648
+	return (seed % n) + 1
+end
+for i = 1, 200 do
+	local pn = random(#d)
+	local op = random(3)
+	local p = CreateParagraph(styles[random(#styles)], string.rep("w ", random(4)):split(" "))
+	if op == 1 then
+		d[pn] = p
+	elseif op == 2 then
+		d:insertParagraphBefore(p, pn)
+	elseif #d > 1 then
+		d:deleteParagraphAt(pn)
+	end
+	if random(3) == 1 then
+		-- Let several changes build up between renumbers.
+		continue
+	end
+	d:renumber()
+
+	local fresh = CreateDocument()
+	local wc = 0
+	for j = 1, #d do
+		fresh[j] = d[j]:copy()
+		wc = wc + #d[j]
+	end
+	fresh:renumber()
+	AssertEquals(wc, d.wordcount)
+	for j = 1, #d do
+		if documentStyles[d[j].style].numbered then
+			AssertEquals(fresh[j].number, d[j].number)
+		end
+	end
+end
@@ -0,0 +1,65 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+local function outline()
+	local s = {}
+	for _, h in GetDocumentOutline(currentDocument) do
+		s[#s+1] = h.pn .. ":" .. h.number .. " " .. h.text
+	end
+	return s
+end
+
+SetDocumentParagraphs({
+	"intro",
+	CreateParagraph("H1", "one"),
+	"text",
+	CreateParagraph("H2", "one", "a"),
+	CreateParagraph("H2", "one", "b"),
+	CreateParagraph("H1", "two"),
+	CreateParagraph("H2", "two", "a"),
+})
+
+local want = {"2:1. one", "4:1.1. one a", "5:1.2. one b", "6:2. two",
+	"7:2.1. two a"}
+AssertTableEquals(want, outline())
+
+-- Asking again without any changes returns the same thing.
+
+local headings = GetDocumentOutline(currentDocument)
+AssertEquals(headings, GetDocumentOutline(currentDocument))
+
+-- Editing a plain paragraph leaves the headings alone.
+
+currentDocument[3] = CreateParagraph("P", {"more", "text"})
+AssertTableEquals(want, outline())
+
+-- Inserting a heading renumbers the ones after it and moves the rest down.
+-- An outline which was handed out earlier is left as it was.
+
+local before = GetDocumentOutline(currentDocument)
+table.insert(currentDocument, 3, CreateParagraph("H2", {"new"}))
+AssertTableEquals({"2:1. one", "3:1.1. new", "5:1.2. one a",
+	"6:1.3. one b", "7:2. two", "8:2.1. two a"}, outline())
+AssertEquals(4, before[2].pn)
+AssertEquals("1.1.", before[2].number)
+AssertEquals(7, before[5].pn)
+
+-- Deleting one does the reverse.
+
+table.remove(currentDocument, 6)
+AssertTableEquals({"2:1. one", "3:1.1. new", "5:1.2. one a", "6:2. two",
+	"7:2.1. two a"}, outline())
+
+-- Changing a heading's style is picked up.
+
+currentDocument[6] = CreateParagraph("H3", {"two"})
+AssertTableEquals({"2:1. one", "3:1.1. new", "5:1.2. one a",
+	"6:1.2.1. two", "7:1.3. two a"}, outline())
+
+-- Sections.
+
+headings = GetDocumentOutline(currentDocument)
+AssertEquals(nil, GetOutlineSection(headings, 1))
+AssertEquals(1, GetOutlineSection(headings, 2))
+AssertEquals(3, GetOutlineSection(headings, 5))
+AssertEquals(5, GetOutlineSection(headings, 7))
@@ -0,0 +1,91 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+SetParagraphPacking(true)
+
+local p = CreateParagraph("P", {"one", "two"}, "three")
+AssertEquals("P", p.style)
+AssertEquals(3, #p)
+AssertEquals("two", p[2])
+AssertNull(p[4])
+AssertEquals("one two three", p:join())
+AssertEquals("one two three", p:asString())
+AssertTableEquals({"two", "three"}, p:sub(2))
+
+local words = {}
+for i, w in p do
+	words[i] = w
+end
+AssertTableEquals({"one", "two", "three"}, words)
+
+local q = p:copy()
+AssertEquals(false, rawequal(p, q))
+AssertEquals(3, #q)
+AssertEquals("three", q[3])
+AssertEquals(false, pcall(function() p[1] = "x" end))
+
+-- Styles can be applied to them in one go too.
+
+local styled, co = wg.applystyletoparagraph(p, 8, 0xff, 2, 2, 3, 3, 3, 3)
+AssertTableEquals({"one", "t\024wo", "\024th\016ree"}, styled)
+AssertEquals(5, co)
+AssertNull((wg.applystyletoparagraph(p, 0, 0xff, 1, 1, 3, 0)))
+
+p = CreateParagraph("P", {""})
+AssertEquals(1, #p)
+AssertEquals("", p[1])
+AssertEquals(0, #CreateParagraph("P"))
+
+Cmd.InsertStringIntoParagraph("one two three")
+Cmd.SplitCurrentParagraph()
+Cmd.InsertStringIntoParagraph("four")
+Cmd.SplitCurrentWord()
+Cmd.SetMark()
+Cmd.InsertStringIntoParagraph("bold")
+Cmd.SetStyle("b")
+Cmd.SplitCurrentParagraph()
+Cmd.InsertStringIntoParagraph("heading")
+Cmd.ChangeParagraphStyle("H1")
+
+AssertEquals("one two three\nfour bold\nheading\n", Cmd.ExportToTextString())
+
+local s = SaveToString(documentSet)
+local filename = wg.mkdtemp().."/temp.wg"
+AssertEquals(true, (SaveToFile(filename, documentSet)))
+local ds = LoadFromFile(filename)
+local d = ds.documents[1]
+AssertNotNull(rawget(d[2], "_words"))
+AssertEquals(3, #d)
+AssertEquals("four", d[2][1])
+AssertEquals("H1", d[3].style)
+AssertEquals(s, SaveToString(ds))
+
+SetParagraphPacking(false)
+ds = LoadFromFile(filename)
+AssertNull(rawget(ds.documents[1][2], "_words"))
+AssertEquals(s, SaveToString(ds))
+
+local d = CreateDocument()
+d[1] = CreateParagraph("P", {"the", "cat", "the"})
+SetParagraphPacking(true)
+d[2] = CreateParagraph("P", {"the", "dog"})
+SetParagraphPacking(false)
+AssertTableEquals({5, 3, 15, 9}, {wg.wordstats(d)})
+
+for _, packed in ipairs({false, true}) do
+	SetParagraphPacking(packed)
+	local p = CreateParagraph("Q", {"one", "two", "three"})
+	p:wrap(80)
+	local q = p:replaceWords(2, 1, "2a", "2b")
+	AssertEquals("Q", q.style)
+	AssertEquals("one 2a 2b three", q:join())
+	AssertNull(rawget(q, "_wrapdata"))
+	AssertEquals(getmetatable(p), getmetatable(q))
+	AssertEquals("one three", p:replaceWords(2, 1):join())
+	AssertEquals("one two three four", p:replaceWords(4, 0, "four"):join())
+	AssertEquals("x", p:replaceWords(1, 3, "x"):join())
+	AssertEquals(false, pcall(p.replaceWords, p, 2, -1, "x"))
+	AssertEquals(false, pcall(p.replaceWords, p, 5, 0, "x"))
+	AssertEquals("one two three", p:join())
+end
+SetParagraphPacking(false)
@@ -0,0 +1,96 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+-- Counting lines gives the same answer as wrapping.
+
+local words = {}
+for i = 1, 200 do
+	words[i] = string.rep("x", (i * 7) % 13 + 1)..(((i % 9) == 0) and "." or "")
+end
+local p = CreateParagraph("P", words)
+for _, width in { 1, 5, 20, 65, 1000 } do
+	for _, fss in { false, true } do
+		local lines = wg.wrapparagraph(p, width, 4, 0, fss)
+		AssertEquals(#lines, wg.countlines(p, width, 4, 0, fss))
+	end
+end
+AssertEquals(1, wg.countlines(CreateParagraph("P", ""), 65, 0, 0, false))
+
+-- The document's line count is kept up to date as it changes.
+
+local settings = documentSet.addons.pagecount
+settings.enabled = true
+settings.bylayout = true
+settings.linewidth = 20
+settings.linesperpage = 10
+
+for i = 1, 30 do
+	Cmd.InsertStringIntoParagraph("The quick brown fox jumps over the lazy dog.")
+	Cmd.SplitCurrentParagraph()
+end
+Cmd.ChangeParagraphStyle("H1")
+Cmd.InsertStringIntoParagraph("Heading")
+
+local function fresh()
+	currentDocument._pagelayout = nil
+	return GetDocumentLayoutLines(currentDocument)
+end
+
+local lines = GetDocumentLayoutLines(currentDocument)
+AssertEquals(fresh(), lines)
+
+Cmd.GotoBeginningOfDocument()
+Cmd.InsertStringIntoParagraph("More words which make it longer. ")
+Cmd.GotoEndOfDocument()
+Cmd.SplitCurrentParagraph()
+Cmd.InsertStringIntoParagraph("And some more.")
+currentDocument:deleteParagraphAt(5)
+local updated = GetDocumentLayoutLines(currentDocument)
+AssertEquals(true, updated ~= lines)
+AssertEquals(fresh(), updated)
+
+Cmd.ChangeParagraphStyle("H1")
+updated = GetDocumentLayoutLines(currentDocument)
+AssertEquals(fresh(), updated)
+
+AssertEquals(math.ceil(updated / 10), GetDocumentPageCount(currentDocument))
+
+-- Going to a page.
+
+AssertEquals(true, Cmd.GotoPage(1))
+AssertEquals(1, currentDocument.cp)
+AssertEquals(1, currentDocument.cw)
+
+AssertEquals(true, Cmd.GotoPage(3))
+local pn, wn = currentDocument.cp, currentDocument.cw
+AssertEquals(true, pn > 1)
+
+-- The page starts with the line after the previous page's last one.
+local line = 0
+for i = 1, pn-1 do
+	local q = currentDocument[i]
+	line = line + #wg.wrapparagraph(q, 20, q:getIndentOfLine(1),
+		q:getIndentOfLine(2), WantFullStopSpaces())
+	line = line + math.max(documentStyles[q.style].below or 0,
+		documentStyles[currentDocument[i+1].style].above or 0)
+end
+local q = currentDocument[pn]
+for _, l in wg.wrapparagraph(q, 20, q:getIndentOfLine(1),
+		q:getIndentOfLine(2), WantFullStopSpaces()) do
+	if l.wn == wn then
+		break
+	end
+	line = line + 1
+end
+AssertEquals(20, line)
+
+AssertEquals(true, Cmd.GotoPage(1000))
+AssertEquals(#currentDocument, currentDocument.cp)
+
+-- Without the layout, pages are so many words long.
+
+settings.bylayout = false
+settings.wordsperpage = #currentDocument[1] + 2
+AssertEquals(true, Cmd.GotoPage(2))
+AssertEquals(2, currentDocument.cp)
+AssertEquals(3, currentDocument.cw)
@@ -0,0 +1,58 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+-- Paragraphs with the same content hash the same, packed or not.
+
+local p = CreateParagraph("P", {"one", "two", "three"})
+AssertEquals(16, #p:hash())
+AssertEquals(p:hash(), CreateParagraph("P", {"one", "two", "three"}):hash())
+AssertEquals(false, p:hash() == CreateParagraph("Q", {"one", "two", "three"}):hash())
+AssertEquals(false, p:hash() == CreateParagraph("P", {"one", "two", "four"}):hash())
+AssertEquals(false, p:hash() == CreateParagraph("P", {"onetwo", "three"}):hash())
+AssertEquals(false, p:hash() == CreateParagraph("P", {"one", "two"}):hash())
+
+SetParagraphPacking(true)
+local q = CreateParagraph("P", {"one", "two", "three"})
+AssertEquals(p:hash(), q:hash())
+SetParagraphPacking(false)
+
+-- A document's hash follows its edits, and matches one worked out from
+-- scratch.
+
+local function fresh(document)
+	local d = CreateDocument()
+	d:deleteParagraphAt(1)
+	for _, p in ipairs(document) do
+		d:appendParagraph(p)
+	end
+	return d:hash()
+end
+
+for i = 1, 200 do
+	Cmd.InsertStringIntoParagraph("word"..i)
+	Cmd.SplitCurrentParagraph()
+end
+local document = currentDocument
+local h = document:hash()
+AssertEquals(h, document:hash())
+AssertEquals(h, fresh(document))
+
+Cmd.Checkpoint()
+document.cp = 100
+document.cw = 1
+document.co = 1
+Cmd.InsertStringIntoWord("x")
+local changed = document:hash()
+AssertEquals(false, changed == h)
+AssertEquals(changed, fresh(document))
+
+Cmd.Undo()
+AssertEquals(h, document:hash())
+
+document.cp = 10
+Cmd.SplitCurrentParagraph()
+AssertEquals(fresh(document), document:hash())
+document:deleteParagraphsAt(20, 70)
+AssertEquals(fresh(document), document:hash())
+document:deleteParagraphsAt(1, #document - 1)
+AssertEquals(fresh(document), document:hash())
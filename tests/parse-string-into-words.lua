@@ -5,3 +5,7 @@ local words = ParseStringIntoWords("The quick brown fox jumps over the lazy dog.
 AssertTableEquals({"The", "quick", "brown", "fox", "jumps", "over", "the",
 	"lazy", "dog."}, words)
 
+
+AssertTableEquals({"a", "b"}, ParseStringIntoWords("  a\t\r\nb  "))
+AssertTableEquals({""}, ParseStringIntoWords(" \t "))
+AssertTableEquals({""}, ParseStringIntoWords(""))
@@ -0,0 +1,214 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+-- Inputs built to be as awkward as possible for each importer and for the
+-- loader: huge paragraphs, deep nesting, enormous numbers of tiny elements,
+-- and strings which are nothing but escapes. Each is read at two sizes, and
+-- reading the bigger one must take no more than a few times as long as the
+-- smaller (it's four times the input, so anything quadratic would be
+-- sixteen times slower), as well as staying under an overall limit for time
+-- and for the memory allocated per byte of input.
+
+local SIZE = 10000
+local TIMELIMIT = 2.0
+local MAXRATIO = 8
+local MINTIME = 0.005
+
+local dir = wg.mkdtemp()
+
+-- Returns the time fn takes and what it allocates, per call. Each of a few
+-- runs calls it until at least MINTIME has passed (so that quick inputs are
+-- timed over long enough to mean something), and the lowest of the runs is
+-- used. (The tests run in parallel, so any one run can be slowed down a
+-- lot.)
+local function measure(fn)
+	local best = math.huge
+	local allocated = math.huge
+	for i = 1, 5 do
+		wg.collectgarbage()
+		local a = wg.allocstats().total
+		local t = wg.time()
+		local calls = 0
+		repeat
+			fn()
+			calls = calls + 1
+		until (wg.time() - t) >= MINTIME
+		best = math.min(best, (wg.time() - t) / calls)
+		allocated = math.min(allocated, (wg.allocstats().total - a) / calls)
+	end
+	return best, allocated
+end
+
+-- Each case makes its input for a size, returning a function which reads it
+-- (and returns the result) and the input's length in bytes.
+local function check(name, bytelimit, make, verify)
+	local small = make(SIZE)
+	local smalltime = measure(small)
+	local large, length = make(SIZE*4)
+	local largetime, allocated = measure(large)
+
+	local ratio = largetime / smalltime
+	if (ratio > MAXRATIO) or (largetime > TIMELIMIT) then
+		error(string.format("%s: took %.3fs for %d bytes, %.1f times as long "
+			.."as a quarter of it", name, largetime, length, ratio))
+	end
+	if (allocated > (length * bytelimit)) then
+		error(string.format("%s: allocated %d bytes for %d bytes of input",
+			name, allocated, length))
+	end
+
+	verify(large(), SIZE*4)
+end
+
+local function countwords(document)
+	local n = 0
+	for i = 1, #document do
+		n = n + #document[i]
+	end
+	return n
+end
+
+-- HTML: a single huge paragraph, inline tags nested thousands deep, and
+-- lists which are opened but never closed.
+
+check("HTML paragraph", 32,
+	function(n)
+		local s = "<html><body><p>"..string.rep("word &amp; ", n)
+			.."</p></body></html>"
+		return function() return Cmd.ImportHTMLString(s) end, #s
+	end,
+	function(document, n)
+		AssertEquals(1, #document)
+		AssertEquals(n*2, #document[1])
+	end)
+
+check("HTML nesting", 32,
+	function(n)
+		local s = "<html><body><p>"..string.rep("<span><b>x ", n)
+			..string.rep("</b></span>", n).."</p></body></html>"
+		return function() return Cmd.ImportHTMLString(s) end, #s
+	end,
+	function(document, n)
+		AssertEquals(n, countwords(document))
+	end)
+
+check("HTML unclosed lists", 64,
+	function(n)
+		local s = "<html><body>"..string.rep("<li>x <ul>", n).."</body></html>"
+		return function() return Cmd.ImportHTMLString(s) end, #s
+	end,
+	function(document, n)
+		AssertEquals(n, countwords(document))
+	end)
+
+-- Markdown: a very long list, very deep quoting, and emphasis markers which
+-- never pair up.
+
+check("Markdown list", 128,
+	function(n)
+		local s = string.rep("- item\n", n)
+		return function() return Cmd.ImportMarkdownString(s) end, #s
+	end,
+	function(document, n)
+		-- (After the blank paragraph every document starts with.)
+		AssertEquals(n+1, #document)
+		AssertEquals("LB", document[n+1].style)
+	end)
+
+check("Markdown quoting", 32,
+	function(n)
+		local s = string.rep("> ", n).."text\n"
+		return function() return Cmd.ImportMarkdownString(s) end, #s
+	end,
+	function(document, n)
+		AssertEquals("Q", document[#document].style)
+		AssertTableEquals({"text"}, {table.unpack(document[#document])})
+	end)
+
+check("Markdown emphasis", 32,
+	function(n)
+		local s = string.rep("*a **b ", n).."\n"
+		return function() return Cmd.ImportMarkdownString(s) end, #s
+	end,
+	function(document, n)
+		AssertEquals(n*2, #document[#document])
+	end)
+
+-- Text: one enormous line, and nothing but blank lines (where every byte
+-- is a paragraph of its own).
+
+check("Text line", 32,
+	function(n)
+		local s = string.rep("word ", n)
+		return function() return Cmd.ImportTextString(s) end, #s
+	end,
+	function(document, n)
+		AssertEquals(1, #document)
+		AssertEquals(n, #document[1])
+	end)
+
+check("Text blank lines", 512,
+	function(n)
+		local s = string.rep("\n", n)
+		return function() return Cmd.ImportTextString(s) end, #s
+	end,
+	function(document, n)
+		AssertEquals(n, #document)
+	end)
+
+-- OpenDocument: spans nested thousands deep (which used to overflow the
+-- stack).
+
+check("OpenDocument nesting", 32,
+	function(n)
+		local content = [[<?xml version="1.0"?>
+<office:document-content
+	xmlns:office="urn:oasis:names:tc:opendocument:xmlns:office:1.0"
+	xmlns:style="urn:oasis:names:tc:opendocument:xmlns:style:1.0"
+	xmlns:text="urn:oasis:names:tc:opendocument:xmlns:text:1.0"
+	xmlns:fo="urn:oasis:names:tc:opendocument:xmlns:xsl-fo-compatible:1.0">
+<office:automatic-styles>
+	<style:style style:name="I"><style:text-properties fo:font-style="italic"/></style:style>
+</office:automatic-styles>
+<office:body><office:text><text:p>]]
+			..string.rep('<text:span text:style-name="I">x ', n)
+			..string.rep("</text:span>", n)
+			.."</text:p><text:p>after</text:p></office:text></office:body></office:document-content>"
+		local filename = dir.."/nested"..n..".odt"
+		AssertEquals(true, wg.writezip(filename, {
+			["content.xml"] = content,
+			["styles.xml"] = [[<?xml version="1.0"?><office:document-styles xmlns:office="urn:oasis:names:tc:opendocument:xmlns:office:1.0"/>]],
+		}))
+		return function()
+			AssertEquals(true, Cmd.ImportODTFile(filename))
+			local document = currentDocument
+			documentSet:deleteDocument(document.name)
+			return document
+		end, #content
+	end,
+	function(document, n)
+		AssertEquals(2, #document)
+		AssertEquals(n, #document[1])
+		AssertEquals("\17x", document[1][1])
+		AssertTableEquals({"after"}, {table.unpack(document[2])})
+	end)
+
+-- The file format: a word and a setting which are nothing but characters
+-- that need escaping (words can't have newlines in them, but settings can).
+
+check("Escaped strings", 64,
+	function(n)
+		local ds = CreateDocumentSet()
+		local document = CreateDocument()
+		document[1] = CreateParagraph("P", {string.rep("\\\"é", n)})
+		ds:addDocument(document, "main")
+		ds.addons = { text = string.rep("a\\\"\n\1", n) }
+		local s = SaveToString(ds)
+		return function() return LoadFromString(s) end, #s
+	end,
+	function(ds, n)
+		AssertEquals(string.rep("a\\\"\n\1", n), ds.addons.text)
+		local document = ds:findDocument("main")
+		MaterialiseDocument(document)
+		AssertEquals(string.rep("\\\"é", n), document[1][1])
+	end)
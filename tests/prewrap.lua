@@ -0,0 +1,32 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+for i = 1, 1000 do
+	currentDocument[i] = CreateParagraph("P", {"word", tostring(i)})
+end
+currentDocument.cp = 500
+currentDocument:wrap(40)
+
+-- A tiny budget still makes progress, outwards from the cursor.
+
+AssertEquals(true, currentDocument:prewrap(0))
+AssertNotNull(currentDocument[500]._wrapdata)
+AssertNotNull(currentDocument[499]._wrapdata)
+AssertNull(currentDocument[1]._wrapdata)
+AssertNull(currentDocument[1000]._wrapdata)
+
+while currentDocument:prewrap(0) do
+end
+for i = 1, #currentDocument do
+	AssertEquals(40, currentDocument[i]._wrapdata.wrapwidth)
+end
+AssertEquals(false, currentDocument:prewrap(1))
+
+-- Changing the width starts again.
+
+currentDocument:wrap(20)
+while currentDocument:prewrap(1) do
+end
+for i = 1, #currentDocument do
+	AssertEquals(20, currentDocument[i]._wrapdata.wrapwidth)
+end
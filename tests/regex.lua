@@ -0,0 +1,86 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+local function find(pattern, pn)
+	if pn then
+		currentDocument.cp, currentDocument.cw, currentDocument.co = pn, 1, 1
+	end
+	if not Cmd.Find(pattern, nil, true) then
+		return nil
+	end
+	local d = currentDocument
+	return {d.mp, d.mw, d.mo, d.cp, d.cw, d.co}
+end
+
+local function findall(pattern)
+	local s = {}
+	for _, m in wg.findalltext(currentDocument, pattern,
+			nil, nil, nil, nil, true) do
+		s[#s+1] = table.concat(m, ",")
+	end
+	return s
+end
+
+-- Syntax errors.
+
+AssertEquals(nil, wg.checkregex("a(b|c)*d"))
+AssertEquals("missing )", wg.checkregex("(ab"))
+AssertEquals("unmatched )", wg.checkregex("ab)"))
+AssertEquals("nothing to repeat", wg.checkregex("*a"))
+AssertEquals("unterminated class", wg.checkregex("[ab"))
+AssertEquals("bad escape", wg.checkregex("\\q"))
+AssertEquals("bad repeat count", wg.checkregex("a{3,2}"))
+AssertEquals("pattern too big", wg.checkregex("(((a{1000}){1000}){1000})"))
+
+SetDocumentParagraphs({
+	"The cat sat on the mat.",
+	"It was \24Catastrophic\16.",
+	"Numbers: 42, 1999 and 7.",
+})
+
+-- Case is ignored, and matches map back to words, through styles.
+
+AssertTableEquals({1, 1, 1, 1, 1, 4}, find("the"))
+AssertTableEquals({1, 5, 1, 1, 5, 4}, find("the"))
+AssertTableEquals({1, 2, 1, 1, 2, 4}, find("\\bc.t\\b"))
+AssertTableEquals({2, 3, 2, 2, 3, 5}, find("CAT"))
+AssertTableEquals({2, 3, 2, 2, 3, 14}, find("cat\\w*", 2))
+
+-- Spaces between words can be matched, but not paragraph breaks.
+
+AssertTableEquals({1, 2, 1, 1, 3, 4}, find("cat\\s+sat"))
+AssertEquals(nil, find("mat\\.\\s*It"))
+
+-- Classes, repeats and alternation.
+
+AssertTableEquals({"3,2,1,3,2,3", "3,3,1,3,3,5"}, findall("\\d{2,}"))
+AssertTableEquals({"3,2,1,3,2,3", "3,3,1,3,3,5", "3,5,1,3,5,2"},
+	findall("[0-9]+"))
+AssertTableEquals({"1,2,1,1,2,4", "1,6,1,1,6,4", "2,3,2,2,3,5"},
+	findall("[cm]at"))
+AssertTableEquals({"1,3,1,1,3,4", "1,6,1,1,6,4"}, findall("[^c ]at"))
+AssertTableEquals({"1,4,1,1,4,3", "2,1,1,2,1,3"}, findall("^it|on"))
+AssertTableEquals({"3,5,1,3,5,3"}, findall("\\d\\.$"))
+
+-- Leftmost-first, with lazy repeats.
+
+AssertTableEquals({"1,1,1,1,6,4"}, findall("^t.*t"))
+AssertTableEquals({"1,1,1,1,2,4", "1,3,3,1,5,2", "2,1,2,2,3,5"},
+	findall("t.*?t"))
+
+-- Matches are never empty.
+
+AssertTableEquals({"1,2,1,1,2,2", "2,3,2,2,3,3", "2,3,13,2,3,14"},
+	findall("c*"))
+
+-- Pathological patterns don't take exponential time.
+
+SetDocumentParagraphs({string.rep("a", 5000)})
+local t = wg.time()
+AssertEquals(nil, find("(a*)*b"))
+AssertEquals(nil, find("(a|a)*(a|a)*(a|a)*c"))
+AssertEquals(true, (wg.time() - t) < 10)
+
+-- Bad patterns don't crash the find commands.
+
+AssertEquals(false, Cmd.Find("(", nil, true))
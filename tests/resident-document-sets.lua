@@ -0,0 +1,51 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+local dir = wg.mkdtemp()
+local a = dir.."/a.wg"
+local b = dir.."/b.wg"
+
+Cmd.InsertStringIntoParagraph("alpha")
+AssertEquals(Cmd.SaveCurrentDocumentAs(b), true)
+AssertEquals(FinishBackgroundSave(), true)
+Cmd.InsertStringIntoParagraph(" beta")
+Cmd.Checkpoint()
+AssertEquals(Cmd.SaveCurrentDocumentAs(a), true)
+AssertEquals(FinishBackgroundSave(), true)
+
+-- Loading another file keeps the clean set resident, and going back to it
+-- gets the same one again, undo and all.
+
+local first = documentSet
+local undo = currentDocument._undostack
+AssertNotNull(undo)
+AssertEquals(Cmd.LoadDocumentSet(b), true)
+AssertEquals(GetResidentDocumentSets()[1] == first, true)
+
+AssertEquals(Cmd.LoadDocumentSet(a), true)
+AssertEquals(documentSet == first, true)
+AssertEquals(currentDocument._undostack == undo, true)
+AssertEquals(documentSet._changed, false)
+AssertEquals(#GetResidentDocumentSets(), 1)
+AssertEquals(GetResidentDocumentSets()[1].name, b)
+
+-- A set with unsaved changes isn't kept.
+
+Cmd.InsertStringIntoParagraph("x")
+AssertEquals(documentSet._changed, true)
+RetireDocumentSet()
+AssertEquals(#GetResidentDocumentSets(), 1)
+
+-- If the file changes on disk, it's loaded afresh.
+
+local edited = documentSet
+documentSet:clean()
+AssertEquals(Cmd.CreateBlankDocumentSet(), true)
+AssertEquals(GetResidentDocumentSets()[1] == edited, true)
+wg.writefile(a, wg.readfile(b))
+AssertEquals(Cmd.LoadDocumentSet(a), true)
+AssertEquals(documentSet == edited, false)
+AssertEquals(currentDocument[1][1], "alpha")
+
+ForgetResidentDocumentSets()
+AssertEquals(#GetResidentDocumentSets(), 0)
@@ -0,0 +1,59 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+Cmd.InsertStringIntoParagraph("fnord")
+Cmd.AddBlankDocument("other")
+Cmd.InsertStringIntoParagraph("other")
+Cmd.ChangeDocument("main")
+
+local dir = wg.mkdtemp()
+local filename = dir.."/tempfile"
+
+-- Text files which have been changed by hand still load, but the documents
+-- which don't match their checksums are listed.
+
+AssertEquals(SaveToFile(filename, documentSet), true)
+local data = wg.readfile(filename)
+AssertNotNull(data:find(".documents.2._checksum: ", 1, true))
+
+local ds = LoadFromFile(filename)
+AssertEquals(ds._damaged, nil)
+AssertEquals(ds.documents[1]._checksum, nil)
+
+wg.writefile(filename, (data:gsub("P other", "P changed")))
+ds = LoadFromFile(filename)
+AssertTableEquals({"other"}, ds._damaged)
+AssertEquals(ds.documents[2][1][1], "changed")
+
+-- Files from before checksums are fine.
+
+wg.writefile(filename, (data:gsub("[^\n]*_checksum[^\n]*\n", "")))
+ds = LoadFromFile(filename)
+AssertEquals(ds._damaged, nil)
+
+-- Compressed files which don't match don't load.
+
+AssertEquals(SaveToFile(filename, documentSet, true), true)
+data = wg.readfile(filename)
+AssertTableEquals({"fnord"}, LoadFromFile(filename).documents[1][1])
+local bad = data:gsub("^([^\n]*\n[^\n]*\n[^\n]* )%d+", "%11")
+AssertEquals(bad == data, false)
+wg.writefile(filename, bad)
+AssertEquals(pcall(LoadFromFile, filename), false)
+
+-- Saving what's already in the file doesn't write it again.
+
+AssertEquals(SaveToFile(filename, documentSet), true)
+local st = wg.stat(filename)
+AssertEquals(SaveToFile(filename, documentSet), true)
+AssertEquals(wg.stat(filename).mtime, st.mtime)
+
+SaveToFileInBackground(filename, documentSet, function() end)
+AssertEquals(FinishBackgroundSave(), true)
+AssertEquals(wg.stat(filename).mtime, st.mtime)
+
+-- ...unless something else has changed the file.
+
+wg.writefile(filename, "")
+AssertEquals(SaveToFile(filename, documentSet), true)
+AssertTableEquals({"fnord"}, LoadFromFile(filename).documents[1][1])
@@ -0,0 +1,56 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+Cmd.InsertStringIntoParagraph("fnord")
+Cmd.SplitCurrentParagraph()
+Cmd.InsertStringIntoParagraph("blarg")
+Cmd.AddBlankDocument("other")
+Cmd.InsertStringIntoParagraph("other")
+Cmd.ChangeDocument("main")
+
+local filename = wg.mkdtemp().."/tempfile"
+AssertEquals(SaveToFile(filename, documentSet, true), true)
+
+local data = wg.readfile(filename)
+AssertEquals(data:sub(1, 50), "WordGrinder dumpfile v4: this is not a text file!\n")
+
+local want = DocumentSetContents(documentSet)
+local ds = LoadFromFile(filename)
+AssertEquals(ds.current.name, "main")
+
+-- Only the current document is loaded up front.
+
+AssertEquals(IsLazyDocument(ds.documents[1]), false)
+AssertEquals(IsLazyDocument(ds.documents[2]), true)
+AssertEquals(ds.documents[2].name, "other")
+AssertEquals(IsLazyDocument(ds.documents[2]), true)
+AssertTableEquals(want, DocumentSetContents(ds))
+AssertEquals(IsLazyDocument(ds.documents[2]), false)
+
+-- Saving the loaded file again doesn't need to recompress anything, and gives
+-- the same result.
+
+local other = ds.documents[2]
+local frame = other._dumpframe
+AssertNotNull(frame)
+documentSet = ds
+AssertEquals(SaveToFile(filename, ds, true), true)
+AssertEquals(other._dumpframe, frame)
+AssertEquals(wg.readfile(filename), data)
+
+-- Changing a document means it gets recompressed.
+
+ds.documents[1][1] = CreateParagraph("P", {"changed"})
+AssertEquals(SaveToFile(filename, ds, true), true)
+AssertEquals(LoadFromFile(filename).documents[1][1][1], "changed")
+
+-- Uncompressed files load lazily too, and lazy documents save unchanged.
+
+AssertEquals(SaveToFile(filename, ds), true)
+local text = wg.readfile(filename)
+ds = LoadFromFile(filename)
+AssertEquals(IsLazyDocument(ds.documents[2]), true)
+AssertEquals(SaveToFile(filename, ds), true)
+AssertEquals(wg.readfile(filename), text)
+AssertEquals(IsLazyDocument(ds.documents[2]), true)
+AssertTableEquals({"other"}, ds.documents[2][1])
@@ -0,0 +1,52 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+local ds = CreateDocumentSet()
+local d = CreateDocument()
+d[1] = CreateParagraph("H1", {"Title"})
+d[2] = CreateParagraph("P", {"one", "\"two\"", "th\\ree"})
+ds:addDocument(d, "main")
+ds.addons = {
+	flag = false,
+	number = 1.5,
+	negative = -3,
+	_transient = "not saved",
+	text = "line\nbreak",
+	list = { 1, "two", true },
+}
+
+AssertEquals(
+	'.addons.flag: false\n'..
+	'.addons.list.1: 1\n'..
+	'.addons.list.2: "two"\n'..
+	'.addons.list.3: true\n'..
+	'.addons.negative: -3\n'..
+	'.addons.number: 1.5\n'..
+	'.addons.text: "line\\nbreak"\n'..
+	'.documents.1.co: 1\n'..
+	'.documents.1.cp: 1\n'..
+	'.documents.1.cw: 1\n'..
+	'.documents.1.margin: 0\n'..
+	'.documents.1.name: "main"\n'..
+	'.documents.1.viewmode: 1\n'..
+	'.documents.1.wordcount: 4\n'..
+	'.fileformat: '..FILEFORMAT..'\n'..
+	'.statusbar: true\n'..
+	'.current: 1\n'..
+	'.documents.1._checksum: 1533376334\n'..
+	'#1\n'..
+	'H1 Title\n'..
+	'P one "two" th\\ree\n'..
+	'.\n',
+	SaveToString(ds))
+
+local filename = wg.mkdtemp().."/temp.wg"
+AssertEquals(true, (SaveToFile(filename, ds)))
+local data = wg.readfile(filename)
+AssertEquals(
+	"WordGrinder dumpfile v3: this is a text file; diff me!\n"..SaveToString(ds),
+	data)
+
+local ds2 = LoadFromFile(filename)
+AssertTableEquals(d[2], ds2.documents[1][2])
+AssertEquals("P", ds2.documents[1][2].style)
@@ -0,0 +1,69 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+Cmd.InsertStringIntoParagraph("the zebra sat on the zebra")
+Cmd.SplitCurrentParagraph()
+Cmd.ChangeParagraphStyle("H1")
+Cmd.InsertStringIntoParagraph("the \017bold\016 cat")
+Cmd.SplitCurrentParagraph()
+Cmd.AddBlankDocument("other")
+Cmd.InsertStringIntoParagraph("other")
+Cmd.ChangeDocument("main")
+
+local filename = wg.mkdtemp().."/tempfile"
+AssertEquals(SaveToFile(filename, documentSet, "wordtable"), true)
+
+local data = wg.readfile(filename)
+AssertEquals(data:sub(1, 50), "WordGrinder dumpfile v5: this is not a text file!\n")
+
+local want = DocumentSetContents(documentSet)
+local ds = LoadFromFile(filename)
+AssertEquals(ds.current.name, "main")
+AssertEquals(ds._documentIndex.other, ds.documents[2])
+AssertTableEquals(want, DocumentSetContents(ds))
+
+-- Each word is only stored once.
+
+local n = 0
+for _ in data:gmatch("zebra") do
+	n = n + 1
+end
+AssertEquals(n, 1)
+
+-- Lazy documents are saved from their text.
+
+AssertEquals(SaveToFile(filename, ds), true)
+ds = LoadFromFile(filename)
+AssertEquals(IsLazyDocument(ds.documents[2]), true)
+AssertEquals(SaveToFile(filename, ds, "wordtable"), true)
+AssertEquals(wg.readfile(filename), data)
+AssertTableEquals(want, DocumentSetContents(LoadFromFile(filename)))
+
+-- Packed paragraphs load and save the same way.
+
+SetParagraphPacking(true)
+ds = LoadFromFile(filename)
+AssertTableEquals(want, DocumentSetContents(ds))
+AssertEquals(SaveToFile(filename, ds, "wordtable"), true)
+AssertEquals(wg.readfile(filename), data)
+SetParagraphPacking(false)
+
+-- The header can be read on its own.
+
+local h = LoadHeaderFromFile(filename)
+AssertEquals(h.current, 1)
+AssertEquals(h.documents[2].name, "other")
+AssertEquals(h.documents[1][1], nil)
+
+-- And the setting chooses the format.
+
+documentSet.addons.fileformat.wordtable = true
+AssertEquals(GetSaveFormat(), "wordtable")
+documentSet.addons.fileformat.wordtable = false
+documentSet.addons.fileformat.compressed = true
+AssertEquals(GetSaveFormat(), "compressed")
+
+-- Damaged files don't crash.
+
+wg.writefile(filename, data:sub(1, #data - 3))
+AssertEquals(pcall(LoadFromFile, filename), false)
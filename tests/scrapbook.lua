@@ -0,0 +1,44 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+-- Pasting to the scrapbook appends to it without switching to it.
+
+currentDocument[1] = CreateParagraph("P", {"first", "paragraph"})
+currentDocument[2] = CreateParagraph("Q", {"second", "paragraph"})
+currentDocument.cp = 1
+currentDocument.cw = 1
+currentDocument.co = 1
+Cmd.SetMark()
+Cmd.GotoEndOfDocument()
+AssertEquals(true, Cmd.Copy())
+Cmd.UnsetMark()
+Cmd.GotoBeginningOfDocument()
+
+local settings = documentSet.addons.scrapbook
+settings.timestamp = false
+local main = currentDocument
+Cmd.PasteToScrapbook()
+AssertEquals(main, currentDocument)
+AssertEquals(1, currentDocument.cp)
+
+-- A new scrapbook doesn't keep its empty paragraph.
+local scrapbook = documentSet:findDocument(settings.document)
+AssertEquals(2, #scrapbook)
+AssertEquals("P", scrapbook[1].style)
+AssertTableEquals({"first", "paragraph"}, {table.unpack(scrapbook[1])})
+AssertEquals("Q", scrapbook[2].style)
+AssertTableEquals({"second", "paragraph"}, {table.unpack(scrapbook[2])})
+
+-- The clippings are copies, not the document's own paragraphs.
+AssertEquals(false, scrapbook[1] == main[1])
+
+-- Later clippings go on the end, after a heading if there is one.
+settings.timestamp = true
+settings.pattern = "From %N:"
+Cmd.PasteToScrapbook()
+AssertEquals(5, #scrapbook)
+AssertEquals("H1", scrapbook[3].style)
+AssertTableEquals({"From", "main:"}, {table.unpack(scrapbook[3])})
+AssertTableEquals({"first", "paragraph"}, {table.unpack(scrapbook[4])})
+AssertTableEquals({"second", "paragraph"}, {table.unpack(scrapbook[5])})
+AssertEquals(true, documentSet._changed)
@@ -77,3 +77,20 @@ Cmd.Unsmartquotify()
 AssertTableEquals({'"Once', "upon", "a", 'time,"', "said", "K'trx'frn,",
 	'"there', "was", "an", "aardvark", "called", 'Albert."'}, currentDocument[7])
 
+
+-- The native conversion, on ordinary and packed paragraphs. The quotes are
+-- plain strings, not patterns.
+
+local function smartquote(p)
+	return wg.smartquoteparagraph(p, "%<", ">%", "<", ">")
+end
+
+for _, packed in { false, true } do
+	SetParagraphPacking(packed)
+	local p = CreateParagraph("P", "\"quoted\"", "plain", "it's", "%<'a'")
+	AssertTableEquals({ "%<quoted>%", "plain", "it>s", "%<<a>" },
+		smartquote(p))
+	AssertEquals(nil, smartquote(CreateParagraph("P", "no", "quotes")))
+	AssertEquals(nil, smartquote(CreateParagraph("P")))
+end
+SetParagraphPacking(false)
@@ -1,25 +1,18 @@
 --!nonstrict
 loadfile("tests/testsuite.lua")()
 
-local function unset(s)
-	local a = {}
-	for k in pairs(s) do
-		a[#a+1] = k
-	end
-	return a
-end
-
 SetSystemDictionaryForTesting({"lower", "UPPER"})
 
 Cmd.InsertStringIntoWord("fnord")
 Cmd.AddToUserDictionary()
-AssertTableEquals({"fnord"}, unset(GetUserDictionary()))
+AssertTableEquals({"fnord"}, GetUserDictionary():words())
 
 Cmd.DeleteWord()
 Cmd.AddToUserDictionary()
-AssertTableEquals({"fnord"}, unset(GetUserDictionary()))
+AssertTableEquals({"fnord"}, GetUserDictionary():words())
 
 documentSet.addons.spellchecker.enabled = false
+AssertEquals(false, HasActiveEventListeners("DrawWord"))
 local payload = { word="fnord", cstyle=0, ostyle=0 }
 FireEvent("DrawWord", payload)
 AssertTableEquals({"fnord", 0, 0},
@@ -28,6 +21,7 @@ AssertTableEquals({"fnord", 0, 0},
 documentSet.addons.spellchecker.enabled = true
 documentSet.addons.spellchecker.useuserdictionary = true
 documentSet.addons.spellchecker.usesystemdictionary = false
+AssertEquals(true, HasActiveEventListeners("DrawWord"))
 local payload = { word="fnord", cstyle=0, ostyle=0 }
 FireEvent("DrawWord", payload)
 AssertTableEquals({"fnord", 0, 0},
@@ -84,3 +78,48 @@ Cmd.FindNextMisspeltWord()
 AssertTableEquals({1, 6, 1}, {currentDocument.mp, currentDocument.mw, currentDocument.mo})
 AssertTableEquals({1, 6, 10}, {currentDocument.cp, currentDocument.cw, currentDocument.co})
 
+
+AssertEquals(3, GetMisspeltWordCount())
+
+-- The user dictionary follows its document as it changes; adding a word only
+-- needs the words which were misspelt checking again.
+
+local userdoc = documentSet:findDocument("User dictionary")
+currentDocument.cp = 1
+currentDocument.cw = 3
+Cmd.AddToUserDictionary()
+AssertTableEquals({"baz", "fnord"}, GetUserDictionary():words())
+AssertEquals(false, IsWordMisspelt("baz", false))
+AssertEquals(true, IsWordMisspelt("foo", false))
+Cmd.FindNextMisspeltWord()
+AssertEquals(2, GetMisspeltWordCount())
+
+userdoc:appendParagraph(CreateParagraph("V", "foo"))
+documentSet:touch()
+AssertEquals(false, IsWordMisspelt("foo", false))
+Cmd.FindNextMisspeltWord()
+AssertEquals(1, GetMisspeltWordCount())
+
+-- Taking words out makes them misspelt again.
+
+userdoc:deleteParagraphsAt(#userdoc - 1, 2)
+documentSet:touch()
+AssertTableEquals({"fnord"}, GetUserDictionary():words())
+AssertEquals(true, IsWordMisspelt("baz", false))
+Cmd.FindNextMisspeltWord()
+AssertEquals(3, GetMisspeltWordCount())
+
+-- The native dictionary counts words added more than once.
+
+local d = wg.createdictionary()
+d:add("Wibble")
+d:add("Wibble")
+AssertEquals(true, d:contains("Wibble"))
+AssertEquals(false, d:contains("wibble"))
+AssertTableEquals({"Wibble"}, (d:suggest("Wobble")))
+AssertEquals(true, d:remove("Wibble"))
+AssertEquals(true, d:contains("Wibble"))
+AssertEquals(true, d:remove("Wibble"))
+AssertEquals(false, d:contains("Wibble"))
+AssertEquals(false, d:remove("Wibble"))
+AssertTableEquals({}, d:words())
@@ -92,6 +92,124 @@ function AssertTableAndPropertiesEquals(want, got)
 	end
 end
 
+-- Allocation and time budgets. The interpreter carves its small objects
+-- out of pages, and the allocator only sees the pages, so one call of fn
+-- says very little; instead it's called runs times (after once to warm up)
+-- and the average per call is checked. Allocation is in bytes.
+
+local BUDGET_RUNS = 100
+
+local function measure(fn, runs)
+	runs = runs or BUDGET_RUNS
+	fn()
+	wg.collectgarbage()
+	local before = wg.allocstats()
+	local start = wg.time()
+	for i = 1, runs do
+		fn()
+	end
+	local elapsed = wg.time() - start
+	local after = wg.allocstats()
+	return (after.total - before.total) / runs, elapsed / runs
+end
+
+function AssertAllocationsBelow(bytes, fn, runs)
+	local got = measure(fn, runs)
+	if (got >= bytes) then
+		error(
+			string.format("Assertion failed: wanted fewer than %d bytes "
+				.. "allocated per call; got %.0f\n", bytes, got))
+	end
+end
+
+function AssertTimeBelow(seconds, fn, runs)
+	local _, got = measure(fn, runs)
+	if (got >= seconds) then
+		error(
+			string.format("Assertion failed: wanted less than %.3fms per call; "
+				.. "got %.3fms\n", seconds*1000, got*1000))
+	end
+end
+
+local function makeparagraph(p)
+	if type(p) == "string" then
+		return CreateParagraph("P", SplitString(p, " "))
+	end
+	return p
+end
+
+-- Replaces everything in the current document and moves the cursor to its
+-- start. Each paragraph is either a Paragraph or a string, which becomes a
+-- P paragraph of its space-separated words.
+function SetDocumentParagraphs(paragraphs)
+	local document = currentDocument
+	document:deleteParagraphsAt(1, #document)
+	for _, p in ipairs(paragraphs) do
+		document:appendParagraph(makeparagraph(p))
+	end
+	document.mp = nil
+	document:touch()
+	documentSet:touch()
+	Cmd.GotoBeginningOfDocument()
+end
+
+-- Adds a new document to the document set, with paragraphs given as for
+-- SetDocumentParagraphs(), and returns it.
+function AddTestDocument(name, paragraphs)
+	local document = CreateDocument()
+	for i, p in ipairs(paragraphs) do
+		document[i] = makeparagraph(p)
+	end
+	documentSet:addDocument(document, name)
+	return document
+end
+
+-- Saves a new document set to a file, in the given format. Its documents are
+-- {name, paragraphs} pairs, with the paragraphs given as for
+-- SetDocumentParagraphs(), and current names the current one. The set's
+-- addons.test.from is the file name, so that it can be told apart from
+-- others once loaded.
+function SaveTestDocumentSet(filename, format, current, documents)
+	local ds = CreateDocumentSet()
+	ds.addons.test = { from = filename }
+	for _, d in documents do
+		local document = CreateDocument()
+		for i, p in ipairs(d[2]) do
+			document[i] = makeparagraph(p)
+		end
+		ds:addDocument(document, d[1])
+	end
+	ds:setCurrent(current)
+	AssertEquals(true, SaveToFile(filename, ds, format))
+	return ds
+end
+
+-- Returns what's in every document of a document set, for comparing: one
+-- string for each document, of its name and then each paragraph's style and
+-- words, a line each.
+function DocumentSetContents(ds)
+	local t = {}
+	for _, d in ds.documents do
+		MaterialiseDocument(d)
+		local dt = { d.name }
+		for _, p in ipairs(d) do
+			dt[#dt+1] = p.style.." "..p:join()
+		end
+		t[#t+1] = table.concat(dt, "\n")
+	end
+	return t
+end
+
+-- Returns whether the given text appears anywhere on the headless screen.
+function ScreenContains(s)
+	for y = 0, ScreenHeight - 1 do
+		if headless.getrow(y):find(s, 1, true) then
+			return true
+		end
+	end
+	return false
+end
+
 function LoggingObject()
 	local object = {}
 	local result = {}
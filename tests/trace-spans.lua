@@ -0,0 +1,51 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+-- Nothing is recorded until tracing starts.
+AssertEquals(false, wg.istracing())
+local t = wg.tracebegin("before")
+wg.traceend(t)
+
+wg.starttrace(4)
+AssertEquals(true, wg.istracing())
+
+local outer = wg.tracebegin("outer")
+local inner = wg.tracebegin("inner \"quoted\"")
+wg.traceend(inner)
+wg.traceend(outer)
+
+-- Ending an outer span closes any inner ones an error left open.
+local outer = wg.tracebegin("unwound")
+wg.tracebegin("abandoned")
+wg.traceend(outer)
+
+local trace = wg.dumptrace()
+AssertEquals(nil, trace:find('"before"', 1, true))
+AssertEquals(true, trace:find('"inner \\"quoted\\""', 1, true) ~= nil)
+local _, count = trace:gsub('"ph":"X"', "")
+AssertEquals(4, count)
+
+-- Spans come out in the order they finish.
+local names = {}
+for name in trace:gmatch('"name":"(%a+)') do
+	names[#names+1] = name
+end
+AssertTableEquals({"inner", "outer", "abandoned", "unwound"}, names)
+
+-- The ring buffer keeps only the most recent spans; C code and listeners
+-- make them too.
+AddEventListener("Changed", function() end)
+FireEvent("Changed")
+CreateParagraph("P", {"one", "two"}):wrap(80)
+local trace = wg.dumptrace()
+local _, count = trace:gsub('"ph":"X"', "")
+AssertEquals(4, count)
+AssertEquals(nil, trace:find('"inner', 1, true))
+AssertEquals(true, trace:find('"Changed (', 1, true) ~= nil)
+AssertEquals(true, trace:find('"Paragraph.wrap"', 1, true) ~= nil)
+
+wg.stoptrace()
+AssertEquals(false, wg.istracing())
+local t = wg.tracebegin("after")
+wg.traceend(t)
+AssertEquals(nil, wg.dumptrace():find('"after"', 1, true))
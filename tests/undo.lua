@@ -40,3 +40,187 @@ Cmd.Checkpoint()
 AssertEquals(2, #currentDocument._undostack)
 AssertEquals(0, #currentDocument._redostack)
 
+
+-- Several steps in different places should all unwind correctly.
+
+local function snapshot()
+	local t = {}
+	for i = 1, #currentDocument do
+		t[i] = currentDocument[i]
+	end
+	return t
+end
+
+local states = {}
+Cmd.GotoBeginningOfDocument()
+Cmd.InsertStringIntoParagraph("A")
+Cmd.SplitCurrentParagraph()
+Cmd.Checkpoint()
+states[1] = snapshot()
+Cmd.GotoEndOfDocument()
+Cmd.InsertStringIntoParagraph("Z")
+Cmd.Checkpoint()
+states[2] = snapshot()
+Cmd.GotoBeginningOfDocument()
+Cmd.DeleteNextChar()
+Cmd.Checkpoint()
+states[3] = snapshot()
+
+for i = 3, 1, -1 do
+	AssertEquals(true, Cmd.Undo())
+	AssertTableEquals(states[i], snapshot())
+end
+
+while Cmd.Redo() do
+end
+AssertTableEquals(states[3], snapshot())
+
+-- The buffer is limited by memory, so a zero limit keeps only the newest
+-- entry.
+
+GlobalSettings.undo.limit = 0
+Cmd.InsertStringIntoParagraph("more")
+Cmd.Checkpoint()
+AssertEquals(1, #currentDocument._undostack)
+AssertEquals(64, currentDocument._undostack.size)
+
+-- Consecutive typing shares one undo step, but a new paragraph or a pause
+-- starts another.
+
+GlobalSettings.undo.limit = 16384
+GlobalSettings.undo.grouptime = 1000
+Cmd.Checkpoint()
+local before = #currentDocument._undostack
+for _, c in {"a", "b", " ", "c"} do
+	if c == " " then
+		Cmd.Checkpoint("word")
+		Cmd.SplitCurrentWord()
+	else
+		Cmd.Checkpoint("typing")
+		Cmd.InsertStringIntoWord(c)
+	end
+end
+AssertEquals(before+1, #currentDocument._undostack)
+
+Cmd.Checkpoint()
+Cmd.SplitCurrentParagraph()
+Cmd.Checkpoint("typing")
+Cmd.InsertStringIntoWord("d")
+AssertEquals(before+3, #currentDocument._undostack)
+
+GlobalSettings.undo.grouptime = -1
+Cmd.Checkpoint("typing")
+Cmd.InsertStringIntoWord("e")
+Cmd.Checkpoint("typing")
+AssertEquals(before+5, #currentDocument._undostack)
+
+-- A checkpoint which doesn't record anything still ends the group.
+
+GlobalSettings.undo.grouptime = 1000
+Cmd.Checkpoint("typing")
+Cmd.InsertStringIntoWord("f")
+Cmd.Checkpoint("typing")
+before = #currentDocument._undostack
+Cmd.Checkpoint()
+Cmd.Checkpoint("typing")
+Cmd.InsertStringIntoWord("g")
+Cmd.Checkpoint("typing")
+AssertEquals(before+1, #currentDocument._undostack)
+
+-- Once over the limit, older entries are paged out to disk rather than
+-- discarded, and read back in when they're undone.
+
+CONFIGDIR = wg.mkdtemp()
+local function hashes()
+	local t = {}
+	for i = 1, #currentDocument do
+		t[i] = currentDocument[i]:hash()
+	end
+	return t
+end
+
+local function spillfiles()
+	local n = 0
+	for _, name in wg.readdir(CONFIGDIR.."/undo") do
+		if not name:find("^%.") then
+			n = n + 1
+		end
+	end
+	return n
+end
+
+GlobalSettings.undo.limit = 1
+GlobalSettings.undo.grouptime = -1
+currentDocument._undostack = nil
+currentDocument._redostack = nil
+Cmd.Checkpoint()
+states = {[0] = hashes()}
+for i = 1, 5 do
+	Cmd.GotoBeginningOfDocument()
+	Cmd.InsertStringIntoParagraph(string.rep("x", 200)..i)
+	Cmd.SplitCurrentParagraph()
+	Cmd.Checkpoint()
+	states[i] = hashes()
+end
+
+local undostack = currentDocument._undostack
+AssertEquals(6, #undostack)
+AssertEquals(true, undostack.spilled >= 2)
+AssertNull(undostack[2].paragraphs)
+AssertNotNull(undostack[2].manifest)
+AssertNotNull(undostack[6].paragraphs)
+AssertEquals(1, spillfiles())
+
+wg.collectgarbage()
+for i = 5, 0, -1 do
+	AssertEquals(true, Cmd.Undo())
+	AssertTableEquals(states[i], hashes())
+end
+AssertEquals(false, Cmd.Undo())
+
+-- And the redo stack is paged out the same way.
+
+AssertEquals(true, currentDocument._redostack.spilled > 0)
+while Cmd.Redo() do
+end
+AssertTableEquals(states[5], hashes())
+
+DiscardUndoSpill()
+AssertEquals(0, spillfiles())
+
+-- A long session keeps paging out its newest history, as the spill file is
+-- compacted once most of what's in it is no longer needed.
+
+GlobalSettings.undo.limit = 1
+GlobalSettings.undo.spill = 4
+currentDocument._undostack = nil
+currentDocument._redostack = nil
+Cmd.Checkpoint()
+states = {}
+local n = 200
+for i = 1, n do
+	Cmd.GotoBeginningOfDocument()
+	Cmd.InsertStringIntoParagraph(string.rep("y", 200)..i)
+	Cmd.SplitCurrentParagraph()
+	Cmd.Checkpoint()
+	states[i] = hashes()
+end
+
+undostack = currentDocument._undostack
+AssertEquals(true, #undostack >= 4)
+AssertNotNull(undostack[#undostack-1].manifest)
+AssertEquals(1, spillfiles())
+for _, name in wg.readdir(CONFIGDIR.."/undo") do
+	if not name:find("^%.") then
+		AssertEquals(true, wg.stat(CONFIGDIR.."/undo/"..name).size <= 4096)
+	end
+end
+
+wg.collectgarbage()
+for i = n, n - #undostack + 1, -1 do
+	AssertEquals(true, Cmd.Undo())
+	AssertTableEquals(states[i], hashes())
+end
+
+DiscardUndoSpill()
+AssertEquals(0, spillfiles())
@@ -29,3 +29,50 @@ for i, bytes in ipairs(values) do
 	AssertEquals(i, readu8(v))
 end
 
+
+-- The width scanners have a vectorised path for runs of printable ASCII;
+-- check it against the one-character-at-a-time path.
+
+local pieces = {"a", "b", " ", "~", "\016", "\017", "é", "日", "\127", "zz"}
+local seed = 7
+for n = 1, 200 do
+	local t = {}
+	for i = 1, (n % 70) do
+		seed = (seed * 1103515245 + 12345) % 2147483648
+		t[#t+1] = pieces[(seed % #pieces) + 1]
+	end
+	local s = table.concat(t)
+
+	local width = 0
+	for _, c in ipairs(t) do
+		for _, cp in utf8.codes(c) do
+			width = width + wg.getstringwidth(utf8.char(cp))
+		end
+	end
+	AssertEquals(width, wg.getstringwidth(s))
+
+	for w = -1, width + 1, 7 do
+		local bounded = wg.getboundedstring(s, w)
+		AssertEquals(true, wg.getstringwidth(bounded) <= math.max(w, 0))
+		AssertEquals(bounded, s:sub(1, #bounded))
+		if #bounded < #s then
+			local nextbytes = wg.getbytesofcharacter(s:byte(#bounded + 1))
+			local next = s:sub(#bounded + 1, #bounded + nextbytes)
+			AssertEquals(true, wg.getstringwidth(bounded..next) > w)
+		end
+	end
+end
+
+-- Character widths come from the generated table, so they're the same
+-- everywhere.
+
+AssertEquals(1, wg.getstringwidth("a"))
+AssertEquals(1, wg.getstringwidth("é"))
+AssertEquals(0, wg.getstringwidth("e\u{301}") - 1)
+AssertEquals(0, wg.getstringwidth("\u{200b}"))
+AssertEquals(1, wg.getstringwidth("\u{ad}"))
+AssertEquals(4, wg.getstringwidth("日本"))
+AssertEquals(2, wg.getstringwidth("\u{ff21}"))
+AssertEquals(2, wg.getstringwidth("\u{1f600}"))
+AssertEquals(2, wg.getstringwidth("\u{2a6d6}"))
+AssertEquals(1, wg.getstringwidth("\u{10fffd}"))
@@ -2,6 +2,24 @@
 loadfile("tests/testsuite.lua")()
 
 AssertTableEquals({"one", "two", "three"}, SplitString("one two three", "%s"))
+AssertTableEquals({"one", "", "two", ""}, SplitString("one\t two\n", "%s"))
+AssertTableEquals({"a", "b c", ""}, SplitString("a|b c|", "|"))
+AssertTableEquals({"abc"}, SplitString("abc", " "))
+AssertTableEquals({""}, SplitString("", " "))
+AssertTableEquals({"a", "b"}, SplitString("a.b", "%."))
+AssertTableEquals({"a", "c"}, SplitString("abbc", "b+"))
+
+-- Valid UTF-8 is left alone; stray bytes and truncated sequences are dropped
+-- and overlong forms shortened, at any offset.
+local long = "abcdefghijklmnopqrstuvwxyz"
+AssertEquals(long, CanonicaliseString(long))
+AssertEquals("日本語の文章💩", CanonicaliseString("日本語の文章💩"))
+AssertEquals("\xed\xa0\x80", CanonicaliseString("\xed\xa0\x80"))
+AssertEquals(long.."ab", CanonicaliseString(long.."a\x80b"))
+AssertEquals(long.."A", CanonicaliseString(long.."\xc1\x81"))
+AssertEquals("日本x", CanonicaliseString("日本\xe8\xaax"))
+AssertEquals(long, CanonicaliseString(long.."\xf0\x9f\x92"))
+AssertEquals("", CanonicaliseString(""))
 
 AssertEquals("foo",     GetWordSimpleText("foo"))
 AssertEquals("foo",		GetWordSimpleText("foo."))
@@ -58,3 +76,47 @@ for s in fp:lines() do
 end
 AssertTableEquals({"foo", "bar", "baz", "", "bib"}, t)
 
+
+-- The standard libraries are frozen, but scripts can still replace the
+-- editor's own globals and the built-in code sees the new versions.
+AssertEquals(false, (pcall(function() string.foo = 1 end)))
+AssertEquals(nil, rawget(string, "foo"))
+
+local oldleafname = Leafname
+function Leafname(s)
+	return "replaced"
+end
+AssertEquals("replaced", rawget(_G, "Leafname")("foo/bar"))
+Leafname = oldleafname
+
+-- The GC can be switched between modes, but only known ones.
+wg.setgcmode("batch")
+wg.setgcmode("interactive")
+AssertEquals(false, (pcall(wg.setgcmode, "xyzzy")))
+
+-- The allocator keeps count of what it's done.
+local stats = wg.allocstats()
+AssertEquals(true, stats.live > 0)
+AssertEquals(true, stats.peak >= stats.live)
+AssertEquals(true, stats.total >= stats.live)
+AssertEquals(true, stats.allocations >= stats.reused)
+local pooled = 0
+for size, count in stats.classes do
+	AssertEquals(0, size % 512)
+	pooled = pooled + count
+end
+AssertEquals(true, pooled > 0)
+
+-- The profiler produces folded stacks.
+AssertEquals(true, wg.startprofiler())
+AssertEquals(false, wg.startprofiler())
+AssertEquals(true, wg.isprofiling())
+local function spin()
+	local deadline = wg.time() + 0.05
+	while wg.time() < deadline do
+	end
+end
+spin()
+local profile = wg.stopprofiler()
+AssertEquals(false, wg.isprofiling())
+AssertEquals(true, profile:find("^Main %(src/lua/main.lua:%d+%);[^\n]* %d+\n") ~= nil)
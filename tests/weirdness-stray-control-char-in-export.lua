@@ -46,7 +46,6 @@ AssertTableAndPropertiesEquals(
 		["prologue"] = {{}},
 		["text"] = {
 			{"one"},
-			{""},
 			{"two"}
 		},
 		["epilogue"] = {{}}
@@ -0,0 +1,51 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+-- The native conversions between offsets and widths agree with walking the
+-- word a character at a time.
+local function widthfromoffset(s, o)
+	return wg.getstringwidth(s:sub(1, o-1))
+end
+
+local function offsetfromwidth(s, x)
+	local o = 1
+	while (o <= #s) do
+		if (x == 0) then
+			return o
+		end
+
+		local charlen = wg.getbytesofcharacter(string.byte(s, o))
+		local ww = wg.getstringwidth(s:sub(o, o+charlen-1))
+		if (ww > x) then
+			return o
+		end
+
+		x = x - ww
+		o = o + charlen
+	end
+	return #s + 1
+end
+
+local B = string.char(16 + 8)
+local N = string.char(16)
+for _, w in {
+	"",
+	"consectetur",
+	B.."bold"..N.."plain",
+	"日本語の文章",
+	"ab日本"..B.."cd語"..N,
+	"abcdefghijklmnopqrstuvwxyz日本語",
+} do
+	local o = 1
+	while (o <= (#w + 1)) do
+		AssertEquals(widthfromoffset(w, o), GetWidthFromOffset(w, o))
+		o = o + math.max(wg.getbytesofcharacter(string.byte(w, o) or 0), 1)
+	end
+	for x = -1, wg.getstringwidth(w) + 2 do
+		AssertEquals(offsetfromwidth(w, x), GetOffsetFromWidth(w, x))
+	end
+end
+
+-- Offsets past either end are clamped.
+AssertEquals(0, GetWidthFromOffset("abc", -5))
+AssertEquals(3, GetWidthFromOffset("abc", 10))
@@ -0,0 +1,120 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+local function containing(word)
+	return GetIndexedParagraphs(currentDocument,
+		function(w)
+			return w == word
+		end)
+end
+
+SetDocumentParagraphs({"one two", "two three", "(three) four"})
+
+-- Off by default.
+
+AssertEquals(nil, GetWordIndex(currentDocument))
+AssertEquals(nil, containing("two"))
+
+documentSet.addons.wordindex.enabled = true
+AssertTableEquals({1, 2}, containing("two"))
+AssertTableEquals({2, 3}, containing("three"))
+AssertTableEquals({}, containing("five"))
+
+local index = GetWordIndex(currentDocument)
+AssertEquals(2, index.counts["two"])
+AssertEquals(1, index.counts["four"])
+
+-- Edits are picked up.
+
+currentDocument[1] = CreateParagraph("P", {"one", "five"})
+AssertTableEquals({2}, containing("two"))
+AssertTableEquals({1}, containing("five"))
+AssertEquals(1, GetWordIndex(currentDocument).counts["two"])
+
+Cmd.GotoEndOfDocument()
+Cmd.SplitCurrentParagraph()
+Cmd.InsertStringIntoParagraph("two")
+AssertTableEquals({2, 4}, containing("two"))
+
+-- Finding uses it.
+
+Cmd.GotoBeginningOfDocument()
+Cmd.Find("two")
+AssertEquals(2, currentDocument.mp)
+AssertEquals(1, currentDocument.mw)
+Cmd.FindNext()
+AssertEquals(4, currentDocument.mp)
+Cmd.FindNext()
+AssertEquals(2, currentDocument.mp)
+Cmd.Find("five two")
+AssertEquals(1, currentDocument.mp)
+AssertEquals(2, currentDocument.mw)
+AssertEquals(2, currentDocument.cp)
+AssertEquals(1, currentDocument.cw)
+Cmd.Find("hre")
+AssertEquals(2, currentDocument.mp)
+AssertEquals(2, currentDocument.mw)
+AssertEquals(2, currentDocument.mo)
+AssertEquals(false, Cmd.Find("six"))
+
+-- So does the spellchecker.
+
+SetSystemDictionaryForTesting({"one", "two", "three", "four"})
+documentSet.addons.spellchecker.enabled = true
+documentSet.addons.spellchecker.usesystemdictionary = true
+documentSet.addons.spellchecker.useuserdictionary = false
+Cmd.GotoBeginningOfDocument()
+AssertEquals(true, Cmd.FindNextMisspeltWord())
+AssertEquals(1, currentDocument.mp)
+AssertEquals(2, currentDocument.mw)
+AssertEquals(true, Cmd.FindNextMisspeltWord())
+AssertEquals(1, currentDocument.mp)
+AssertEquals(2, currentDocument.mw)
+documentSet.addons.spellchecker.enabled = false
+
+-- The index is saved alongside the document set, and used again on load.
+
+local filename = wg.mkdtemp().."/tempfile"
+AssertEquals(Cmd.SaveCurrentDocumentAs(filename), true)
+AssertEquals(FinishBackgroundSave(), true)
+AssertEquals(true, wg.stat(filename..".index") ~= nil)
+
+AssertEquals(Cmd.LoadDocumentSet(filename), true)
+local loaded = currentDocument._wordindex
+AssertEquals(true, loaded ~= nil)
+AssertTableEquals({2, 4}, containing("two"))
+AssertEquals(loaded, GetWordIndex(currentDocument))
+
+-- Turning it off forgets it.
+
+documentSet.addons.wordindex.enabled = false
+AssertEquals(nil, containing("two"))
+
+-- The saved index really is what's used, rather than a rebuilt one.
+
+documentSet.addons.wordindex.enabled = true
+AssertEquals(SaveToFile(filename, documentSet, "text"), true)
+documentSet:clean()
+local saved = LoadFromFile(filename..".index")
+saved.size = wg.stat(filename).size
+saved.indices[currentDocument.name].postings["planted"] = {3, 1}
+AssertEquals(SaveToFile(filename..".index", saved), true)
+
+AssertEquals(Cmd.LoadDocumentSet(filename), true)
+AssertTableEquals({3}, containing("planted"))
+
+-- But only for documents whose content is what was indexed, even if the
+-- file has been replaced by one of the same size with the same number of
+-- words in each paragraph.
+
+currentDocument[1] = CreateParagraph("P", {"one", "nine"})
+AssertEquals(SaveToFile(filename, documentSet, "text"), true)
+documentSet:clean()
+saved.size = wg.stat(filename).size
+AssertEquals(SaveToFile(filename..".index", saved), true)
+
+AssertEquals(Cmd.LoadDocumentSet(filename), true)
+AssertTableEquals({1}, containing("nine"))
+AssertTableEquals({}, containing("five"))
+AssertTableEquals({}, containing("planted"))
+AssertTableEquals({2, 4}, containing("two"))
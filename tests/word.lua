@@ -21,3 +21,17 @@ AssertEquals(DeleteFromWord("abcd", 2, 4), "ad")
 AssertEquals(DeleteFromWord("abcd", 1, 3), "cd")
 AssertEquals(DeleteFromWord("abcd", 2, 4), "ad")
 
+
+-- Word metrics are cached; make sure repeated and styled lookups agree.
+local styled = "\017fo\016o\018bar"
+for i = 1, 2 do
+	AssertEquals(6, GetStringWidth(styled))
+	AssertEquals("foobar", wg.getwordtext(styled))
+	local runs = {}
+	wg.parseword(styled, 0, function(s, t) runs[#runs+1] = s..":"..t end)
+	AssertTableEquals({"1:fo", "0:o", "2:bar"}, runs)
+end
+
+AssertTableEquals(
+	{0, "one ", 1, "fo", 0, "o "},
+	wg.parseparagraph(CreateParagraph("P", {"one", "\017fo\016o", ""})))
@@ -0,0 +1,62 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+local CODE = [[
+	return function(input)
+		local n = 0
+		for w in input:gmatch("%S+") do
+			n = n + 1
+		end
+		return tostring(n)
+	end
+]]
+
+-- Jobs run on other threads, and each callback gets its own job's result.
+
+local results = {}
+for i = 1, 20 do
+	SpawnWorker(CODE, string.rep("word ", i),
+		function(result, e)
+			AssertEquals(nil, e)
+			results[i] = tonumber(result)
+		end)
+end
+
+local fired = 0
+AddEventListener("WorkerFinished", function() fired = fired + 1 end)
+FinishWorkers()
+FlushAsyncEvents()
+for i = 1, 20 do
+	AssertEquals(i, results[i])
+end
+AssertEquals(1, fired)
+
+-- Errors in the code, or in what it returns, come back as errors.
+
+local errors = {}
+SpawnWorker("syntax error here", "", function(r, e) errors[1] = e end)
+SpawnWorker("return 42", "", function(r, e) errors[2] = e end)
+SpawnWorker("return function() return {} end", "", function(r, e) errors[3] = e end)
+SpawnWorker("return function() error('oops') end", "", function(r, e) errors[4] = e end)
+FinishWorkers()
+for i = 1, 4 do
+	AssertEquals("string", type(errors[i]))
+end
+AssertEquals(true, errors[2]:find("must return a function", 1, true) ~= nil)
+AssertEquals(true, errors[4]:find("oops", 1, true) ~= nil)
+
+-- Workers are sandboxed: they can't reach the editor, and globals the job
+-- sets don't leak into the standard libraries.
+
+local r
+SpawnWorker("return function() return tostring(wg) .. ' ' .. tostring(string.upper == nil) end",
+	"", function(result) r = result end)
+FinishWorkers()
+AssertEquals("nil false", r)
+
+-- The job is the same object as wg.spawn() returns.
+
+local job = wg.spawn(CODE, "a b c")
+local done, result = job:poll(10)
+AssertEquals(true, done)
+AssertEquals("3", result)
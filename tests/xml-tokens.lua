@@ -0,0 +1,106 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+local function tokens(xml)
+	local t = {}
+	for event, a, b, c in wg.xmltokens(xml) do
+		local s = event
+		if (event == "opentag") then
+			s = s .. " " .. a .. "|" .. b
+			local keys = {}
+			for k in c do
+				keys[#keys+1] = k
+			end
+			table.sort(keys)
+			for _, k in keys do
+				s = s .. " [" .. k .. "]=" .. c[k]
+			end
+		elseif (event == "closetag") then
+			s = s .. " " .. a .. "|" .. b
+		elseif (event == "processing") then
+			s = s .. " " .. a
+		else
+			s = s .. " <" .. a .. ">"
+		end
+		t[#t+1] = s
+	end
+	return t
+end
+
+AssertTableEquals({
+		"processing xml",
+		"opentag |doc",
+		"opentag |p [a]=1 [b]=two words",
+		"text <one two>",
+		"closetag |p",
+		"opentag |br",
+		"closetag |br",
+		"text < three>",
+		"closetag |doc",
+	},
+	tokens([[<?xml version="1.0"?>
+		<!-- a comment -->
+		<doc>
+			<p a="1" b='two	words'>one
+				two</p>
+			<br/> three
+			</doc>]]))
+
+-- Namespaces.
+
+AssertTableEquals({
+		"opentag urn:x|a",
+		"opentag urn:y|b [d]=2 [urn:x c]=1",
+		"closetag urn:y|b",
+		"opentag urn:x|e",
+		"closetag urn:x|e",
+		"opentag q|z",
+		"closetag q|z",
+		"closetag urn:x|a",
+	},
+	tokens([[<x:a xmlns:x="urn:x"><b xmlns="urn:y" x:c="1" d="2"/><x:e/><q:z/></x:a>]]))
+
+-- Entities and CDATA.
+
+AssertTableEquals({
+		"opentag |a [t]=<\"'>",
+		"text <& é é &bogus; & x>",
+		"text < <raw> >",
+		"closetag |a",
+	},
+	tokens([==[<a t="&lt;&quot;&apos;&gt;">&amp; &#233; &#xe9; &bogus; & x<![CDATA[ <raw> ]]></a>]==]))
+
+-- Character references which aren't characters are left alone.
+
+AssertTableEquals({
+		"opentag |a",
+		"text <&#0; &#xd800; &#x110000; &#4294967337; &#-1; &#x; \u{10ffff}>",
+		"closetag |a",
+	},
+	tokens("<a>&#0; &#xd800; &#x110000; &#4294967337; &#-1; &#x; &#x10FFFF;</a>"))
+
+-- Unclosed elements are closed at the end, and garbage is an error.
+
+AssertTableEquals({
+		"opentag |a",
+		"opentag |b",
+		"closetag |b",
+		"closetag |a",
+	},
+	tokens("<a><b>"))
+
+AssertTableEquals({
+		"opentag |a",
+		"error <<%>>",
+		"closetag |a",
+	},
+	tokens("<a><%>"))
+
+-- The tree builder.
+
+local tree = ParseXML([[<n:a xmlns:n="urn:n" n:x="1">b<n:c/>d</n:a>]])
+AssertEquals("urn:n a", tree._name)
+AssertEquals("1", tree["urn:n x"])
+AssertEquals("b", tree[1])
+AssertEquals("urn:n c", tree[2]._name)
+AssertEquals("d", tree[3])
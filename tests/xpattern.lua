@@ -174,3 +174,14 @@ assert(m'cos(12.3/2)+mod(2,3) ' == nil) -- ' '
 assert(m' cos(12.3/2)+mod(2,3)' == nil) -- ' '
 assert(m'cos(12.3/2)+mod+2' == nil) -- no '('
 
+
+-- compiling an equivalent pattern again reuses the compiled function,
+-- until enough other patterns have been compiled to push it out
+local m1 = (P'a+' * P'b'):compile()
+local m2 = (P'a+' * P'b'):compile()
+assert(rawequal(m1, m2))
+for i = 1, M.cache_size do
+  P('x' .. i):compile()
+end
+assert(not rawequal(m1, (P'a+' * P'b'):compile()))
+assert(m1'caab' == 'aab')
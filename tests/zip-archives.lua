@@ -0,0 +1,94 @@
+--!nonstrict
+loadfile("tests/testsuite.lua")()
+
+local dir = wg.mkdtemp()
+local filename = dir.."/test.zip"
+local big = string.rep("some text which compresses well ", 10000)
+AssertEquals(true, wg.writezip(filename, {
+	["one.txt"] = "first",
+	["dir/two.txt"] = "second",
+	["big.txt"] = big,
+}))
+
+-- The directory is read once, when the archive is opened.
+
+local zip = assert(wg.openzip(filename))
+local names = zip:list()
+table.sort(names)
+AssertTableEquals({"big.txt", "dir/two.txt", "one.txt"}, names)
+
+AssertEquals("first", zip:read("one.txt"))
+AssertEquals("second", zip:read("dir/two.txt"))
+AssertEquals(big, zip:read("big.txt"))
+AssertEquals("first", zip:read("one.txt"))
+AssertNull(zip:read("missing.txt"))
+
+-- Any number of members can be streamed at once, and the readers outlive
+-- the archive.
+
+local r1 = assert(zip:open("big.txt"))
+local r2 = assert(zip:open("one.txt"))
+AssertNull(zip:open("missing.txt"))
+zip:close()
+
+AssertEquals("first", r2:read())
+AssertNull(r2:read())
+r2:close()
+
+local chunks = {}
+while true do
+	local s = r1:read(1000)
+	if not s then
+		break
+	end
+	chunks[#chunks+1] = s
+end
+r1:close()
+AssertEquals(big, table.concat(chunks))
+
+local ok = pcall(function() zip:read("one.txt") end)
+AssertEquals(false, ok)
+
+-- Things which aren't zip files.
+
+local _, e = wg.openzip(dir.."/missing.zip")
+AssertEquals("string", type(e))
+AssertNull(wg.writefile(dir.."/notzip.zip", "this is not a zip file"))
+local _, e = wg.openzip(dir.."/notzip.zip")
+AssertEquals("not a zip file", e)
+
+-- Members are compressed in chunks on other threads, but must still come
+-- out as one stream, whatever the mix of methods and sizes.
+
+local lines = {}
+for i = 1, 20000 do
+	lines[i] = "line "..i.." "..string.rep(string.char(65 + (i % 26)), i % 50).."\n"
+end
+local long = table.concat(lines)
+
+local zw = assert(wg.zipwriter(filename))
+AssertEquals(true, zw:begin("mimetype", "store"))
+AssertEquals(true, zw:write("application/x-test"))
+AssertEquals(true, zw:begin("long.txt"))
+for i = 1, #long, 5000 do
+	AssertEquals(true, zw:write(long:sub(i, i + 4999)))
+end
+AssertEquals(true, zw:begin("fast.txt", "fast"))
+AssertEquals(true, zw:write(long))
+AssertEquals(true, zw:begin("empty.txt"))
+AssertEquals(true, zw:close())
+
+local zip = assert(wg.openzip(filename))
+AssertTableEquals({"mimetype", "long.txt", "fast.txt", "empty.txt"}, zip:list())
+AssertEquals("application/x-test", zip:read("mimetype"))
+AssertEquals(long, zip:read("long.txt"))
+AssertEquals(long, zip:read("fast.txt"))
+AssertEquals("", zip:read("empty.txt"))
+zip:close()
+
+AssertEquals(true, wg.writezip(filename, {
+	["long.txt"] = long,
+	["short.txt"] = "short",
+}))
+AssertEquals(long, wg.readfromzip(filename, "long.txt"))
+AssertEquals("short", wg.readfromzip(filename, "short.txt"))
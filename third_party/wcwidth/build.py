@@ -1,6 +0,0 @@
-from build.c import cxxlibrary
-
-cxxlibrary(
-    name="wcwidth",
-    srcs=["./wcwidth.cc"],
-)
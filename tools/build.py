@@ -1,4 +1,4 @@
-from build.ab import normalrule, Rule, Targets
+from build.ab import normalrule, Rule, Targets, filenamesof
 from build.c import cxxprogram
 
 
@@ -13,6 +13,23 @@ def multibin(self, name, symbol, srcs: Targets = []):
     )
 
 
+@Rule
+def luabytecode(self, name, symbol, srcs: Targets = []):
+    normalrule(
+        replaces=self,
+        ins=["tools+luacompile"] + srcs,
+        outs=[symbol + ".h"],
+        commands=[
+            "{ins[0]} " + symbol + " " + " ".join(filenamesof(srcs)) + " > {outs}"
+        ],
+        label="LUACOMPILE",
+    )
+
+
+cxxprogram(
+    name="luacompile", srcs=["./luacompile.cc"], deps=["third_party/luau"]
+)
+
 cxxprogram(
     name="typechecker", srcs=["./typechecker.cc"], deps=["third_party/luau"]
 )
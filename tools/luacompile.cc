@@ -0,0 +1,86 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <sstream>
+#include <fstream>
+#include "Luau/Compiler.h"
+
+/* Compiles the Lua sources named on the command line and writes a C++
+ * header defining a FileDescriptor table of their bytecode, in order, for
+ * script_load_from_table(). The options here must match the ones
+ * luaL_loadstring() uses at run time. */
+
+static Luau::CompileOptions copts()
+{
+    Luau::CompileOptions result = {};
+    result.optimizationLevel = 2;
+    result.debugLevel = 1;
+    result.coverageLevel = 0;
+    return result;
+}
+
+static Luau::ParseOptions popts()
+{
+    Luau::ParseOptions result = {};
+    result.allowDeclarationSyntax = true;
+    return result;
+}
+
+int main(int argc, char* const* argv)
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "syntax: luacompile <symbol> <file.lua>...\n");
+        exit(1);
+    }
+    const char* symbol = argv[1];
+
+    for (int i = 2; i < argc; i++)
+    {
+        std::ifstream f(argv[i], std::ios::binary);
+        if (!f)
+        {
+            perror(argv[i]);
+            exit(1);
+        }
+
+        std::stringstream ss;
+        ss << f.rdbuf();
+        std::string bytecode = Luau::compile(ss.str(), copts(), popts());
+
+        /* Failed compilations produce a zero version byte followed by the
+         * error message. */
+
+        if (bytecode.empty() || (bytecode[0] == 0))
+        {
+            fprintf(stderr,
+                "%s%s\n",
+                argv[i],
+                bytecode.empty() ? ": compilation failed" : &bytecode[1]);
+            exit(1);
+        }
+
+        printf("\n/* This is %s */\n", argv[i]);
+        printf("static const unsigned char %s_%d[] = {", symbol, i - 2);
+        for (size_t j = 0; j < bytecode.size(); j++)
+        {
+            if ((j % 12) == 0)
+                printf("\n ");
+            printf(" 0x%02x,", (unsigned char)bytecode[j]);
+        }
+        printf("\n};\n");
+    }
+
+    printf("const FileDescriptor %s[] = {\n", symbol);
+    for (int i = 2; i < argc; i++)
+        printf("  { std::string((const char*) %s_%d, sizeof(%s_%d)), "
+               "\"%s\" },\n",
+            symbol,
+            i - 2,
+            symbol,
+            i - 2,
+            argv[i]);
+    printf("  {}\n");
+    printf("};\n");
+
+    return 0;
+}
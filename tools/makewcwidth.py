@@ -0,0 +1,98 @@
+# Generates the character width table used by emu_wcwidth() (see core/wgcore.h).
+#
+# The rules are Markus Kuhn's, applied to Python's copy of the Unicode
+# database:
+#
+#   - U+0000 is 0 columns wide; other C0/C1 controls and DEL are -1.
+#   - Non-spacing and enclosing marks (Mn, Me), format characters (Cf) other
+#     than SOFT HYPHEN, ZERO WIDTH SPACE and the Hangul Jamo medial vowels and
+#     final consonants are 0 columns wide.
+#   - East Asian Wide and Fullwidth characters, and anything in the
+#     supplementary ideographic planes, are 2 columns wide.
+#   - Everything else is 1 column wide.
+#
+# The result is a two-stage table: the top bits of a code point index a list
+# of blocks, and identical blocks are shared, so almost all of the range
+# collapses into a handful of entries. Each block entry is two bits.
+#
+# Which Unicode that is depends on which Python runs this, so the output is
+# checked in (as src/c/core/wcwidth.cc) rather than made by the build, and the
+# version is pinned here; moving to a newer one is a deliberate change:
+#
+#   python3 tools/makewcwidth.py > src/c/core/wcwidth.cc
+
+import sys
+import unicodedata
+
+UNICODEVERSION = "14.0.0"
+
+if unicodedata.unidata_version != UNICODEVERSION:
+    sys.exit(
+        "makewcwidth.py: this Python has Unicode %s, not %s; update"
+        " UNICODEVERSION if that's intended"
+        % (unicodedata.unidata_version, UNICODEVERSION)
+    )
+
+BLOCKSHIFT = 8
+BLOCKSIZE = 1 << BLOCKSHIFT
+MAXCHAR = 0x110000
+
+
+def width(c):
+    if c == 0:
+        return 0
+    if (c < 32) or (0x7F <= c < 0xA0):
+        return -1
+
+    ch = chr(c)
+    cat = unicodedata.category(ch)
+    if (0x1160 <= c <= 0x11FF) or (c == 0x200B):
+        return 0
+    if (cat in ("Mn", "Me", "Cf")) and (c != 0x00AD):
+        return 0
+
+    if unicodedata.east_asian_width(ch) in ("W", "F"):
+        return 2
+    if (0x20000 <= c <= 0x2FFFD) or (0x30000 <= c <= 0x3FFFD):
+        return 2
+    return 1
+
+
+def encode(w):
+    return 3 if w < 0 else w
+
+
+index = []
+blocks = []
+blockmap = {}
+for base in range(0, MAXCHAR, BLOCKSIZE):
+    packed = bytearray(BLOCKSIZE // 4)
+    for i in range(BLOCKSIZE):
+        packed[i >> 2] |= encode(width(base + i)) << ((i & 3) * 2)
+    packed = bytes(packed)
+
+    if packed not in blockmap:
+        blockmap[packed] = len(blocks)
+        blocks.append(packed)
+    index.append(blockmap[packed])
+
+assert len(blocks) <= 256
+
+print(
+    "/* Generated by tools/makewcwidth.py from Unicode %s; don't edit. */"
+    % UNICODEVERSION
+)
+print('#include "wgcore.h"')
+print()
+print("const uint8_t wcwidth_index[%d] = {" % len(index))
+for i in range(0, len(index), 16):
+    print("    " + ", ".join(str(b) for b in index[i : i + 16]) + ",")
+print("};")
+print()
+print("const uint8_t wcwidth_blocks[%d][%d] = {" % (len(blocks), BLOCKSIZE // 4))
+for block in blocks:
+    print("    {")
+    for i in range(0, len(block), 16):
+        print("        " + ", ".join("0x%02x" % b for b in block[i : i + 16]) + ",")
+    print("    },")
+print("};")